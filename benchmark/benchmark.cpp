@@ -3,6 +3,7 @@
 #define FIXED_64_ENABLE_TRIG_LUT 1
 #define FIXED_64_ENABLE_FORCEINLINE 1
 #include "fixed64.hpp"
+#include "piecewise_chebyshev.hpp"
 #include <math.h>
 #include <assert.h>
 #include <algorithm>
@@ -127,6 +128,164 @@ static const char* get_arch()
 
 using fp = float;
 
+static inline fp rsqrt(fp x) { return 1 / std::sqrt(x); }
+static inline void sincos(fp x, fp* s, fp* c) { *s = std::sin(x); *c = std::cos(x); }
+static inline fp cot(fp x) { return 1 / std::tan(x); }
+static inline void sinhcosh(fp x, fp* s, fp* c) { *s = std::sinh(x); *c = std::cosh(x); }
+
+#define TIER_FUNC(NAME) \
+	static inline fp fast_##NAME(fp x) { return std::NAME(x); } \
+	static inline fp precise_##NAME(fp x) { return std::NAME(x); } \
+	template<unsigned int F> \
+	static inline f64::fixed64<F> fast_##NAME(f64::fixed64<F> x) { return f64::fast::NAME(x); } \
+	template<unsigned int F> \
+	static inline f64::fixed64<F> precise_##NAME(f64::fixed64<F> x) { return f64::precise::NAME(x); }
+
+TIER_FUNC(exp) TIER_FUNC(exp2) TIER_FUNC(expm1) TIER_FUNC(log) TIER_FUNC(log2) TIER_FUNC(log10) TIER_FUNC(log1p)
+TIER_FUNC(sinh) TIER_FUNC(cosh) TIER_FUNC(tanh)
+TIER_FUNC(sin) TIER_FUNC(cos) TIER_FUNC(tan) TIER_FUNC(asin) TIER_FUNC(acos) TIER_FUNC(atan)
+
+static inline fp fast_pow(fp x, fp y) { return std::pow(x, y); }
+static inline fp precise_pow(fp x, fp y) { return std::pow(x, y); }
+static inline fp fast_atan2(fp y, fp x) { return std::atan2(y, x); }
+static inline fp precise_atan2(fp y, fp x) { return std::atan2(y, x); }
+static inline fp polar_sum(fp r, fp t) { return r * std::cos(t) + r * std::sin(t); }
+static inline fp to_polar_sum(fp x, fp y) { return std::hypot(x, y) + std::atan2(y, x); }
+static inline fp falloff(fp x) { return std::exp(-x * x); }
+static inline fp lut_linear(fp x) { return falloff(x); }
+static inline fp lut_cubic(fp x) { return falloff(x); }
+static const fp polyline_x[] = { 0, 0.5f, 1, 2, 3, 5, 8, 12, 20 };
+static const fp polyline_y[] = { 0, 0.04f, 0.15f, 0.5f, 0.9f, 1.7f, 2.6f, 3.4f, 4.0f };
+static inline fp polyline(fp x)
+{
+	const size_t k = std::upper_bound(polyline_x + 1, polyline_x + 8, x) - polyline_x;
+	return polyline_y[k - 1] + (polyline_y[k] - polyline_y[k - 1]) * (x - polyline_x[k - 1]) / (polyline_x[k] - polyline_x[k - 1]);
+}
+static inline fp piecewise(fp x) { return polyline(x); }
+static const f64::gradient_noise<32> noise(2024);
+static inline fp noise_dot(const int8_t* g, const fp* d, int n) { fp r = 0; for (int i = 0; i < n; ++i) r += g[i] * d[i]; return r; }
+static inline fp perlin3(fp x, fp y)
+{
+	const uint8_t* p = noise.permutation();
+	const fp v[3] = { x, y, (x + y) / 2 };
+	int cell[3]; fp f[3], u[3];
+	for (int i = 0; i < 3; ++i)
+	{
+		cell[i] = int(std::floor(v[i])) & 255;
+		f[i] = v[i] - std::floor(v[i]);
+		u[i] = f[i] * f[i] * f[i] * (f[i] * (f[i] * 6 - 15) + 10);
+	}
+	fp c[8];
+	for (int k = 0; k < 8; ++k)
+	{
+		const int o[3] = { k & 1, (k >> 1) & 1, (k >> 2) & 1 };
+		const fp d[3] = { f[0] - o[0], f[1] - o[1], f[2] - o[2] };
+		c[k] = noise_dot(f64::internal::noise_gradients<3>::data[p[cell[0] + o[0] + p[cell[1] + o[1] + p[cell[2] + o[2]]]] & 15], d, 3);
+	}
+	for (int k = 0; k < 4; ++k) c[k] = c[2 * k] + u[0] * (c[2 * k + 1] - c[2 * k]);
+	for (int k = 0; k < 2; ++k) c[k] = c[2 * k] + u[1] * (c[2 * k + 1] - c[2 * k]);
+	return c[0] + u[2] * (c[1] - c[0]);
+}
+static inline fp simplex2(fp x, fp y)
+{
+	const uint8_t* p = noise.permutation();
+	const fp F2 = fp(0.36602540378), G2 = fp(0.2113248654);
+	const fp s = (x + y) * F2;
+	const fp i = std::floor(x + s), j = std::floor(y + s);
+	const fp t = (i + j) * G2;
+	const fp x0 = x - (i - t), y0 = y - (j - t);
+	const int i1 = x0 > y0, j1 = !i1;
+	const fp d[3][2] = { { x0, y0 }, { x0 - i1 + G2, y0 - j1 + G2 }, { x0 - 1 + 2 * G2, y0 - 1 + 2 * G2 } };
+	const int ii = int(i) & 255, jj = int(j) & 255;
+	const int h[3] = { p[ii + p[jj]], p[ii + i1 + p[jj + j1]], p[ii + 1 + p[jj + 1]] };
+	fp n = 0;
+	for (int k = 0; k < 3; ++k)
+	{
+		const fp r = fp(0.5) - d[k][0] * d[k][0] - d[k][1] * d[k][1];
+		if (r > 0) n += r * r * r * r * noise_dot(f64::internal::noise_gradients<2>::data[h[k] & 7], d[k], 2);
+	}
+	return 70 * n;
+}
+static inline fp simplex_grid(fp x)
+{
+	fp out[256];
+	for (int j = 0; j < 16; ++j)
+		for (int i = 0; i < 16; ++i)
+			out[j * 16 + i] = simplex2(x + fp(0.05) * i, x + fp(0.05) * j);
+	return out[255];
+}
+static inline fp poly_exp(fp x) { return 1 + x * (1 + x * (fp(1) / 2 + x * (fp(1) / 6 + x * (fp(1) / 24 + x * (fp(1) / 120 + x * (fp(1) / 720 + x * (fp(1) / 5040))))))); }
+
+template<class T>
+static inline T sincos_sum(T x) { T s, c; sincos(x, &s, &c); return s + c; }
+template<class T>
+static inline T sinhcosh_sum(T x) { T s, c; sinhcosh(x, &s, &c); return s + c; }
+static inline fp sequence_sum(fp x)
+{
+	fp s[64], c[64];
+	for (int i = 0; i < 64; ++i)
+		sincos(x + fp(0.01) * i, &s[i], &c[i]);
+	return s[63] + c[63];
+}
+template<unsigned int F>
+static inline f64::fixed64<F> sequence_sum(f64::fixed64<F> x)
+{
+	f64::fixed64<F> s[64], c[64];
+	f64::sincos_sequence<F>(x, f64::fixed64<F>(0.01)).fill(s, c, 64);
+	return s[63] + c[63];
+}
+
+template<unsigned int F>
+static inline f64::fixed64<F> fast_pow(f64::fixed64<F> x, f64::fixed64<F> y) { return f64::fast::pow(x, y); }
+template<unsigned int F>
+static inline f64::fixed64<F> precise_pow(f64::fixed64<F> x, f64::fixed64<F> y) { return f64::precise::pow(x, y); }
+template<unsigned int F>
+static inline f64::fixed64<F> fast_atan2(f64::fixed64<F> y, f64::fixed64<F> x) { return f64::fast::atan2(y, x); }
+template<unsigned int F>
+static inline f64::fixed64<F> precise_atan2(f64::fixed64<F> y, f64::fixed64<F> x) { return f64::precise::atan2(y, x); }
+template<unsigned int F>
+static inline f64::fixed64<F> polar_sum(f64::fixed64<F> r, f64::fixed64<F> t) { f64::fixed64<F> x, y; f64::cordic::polar(r, t, &x, &y); return x + y; }
+template<unsigned int F>
+static constexpr inline f64::fixed64<F> falloff(f64::fixed64<F> x) { return f64::exp(-(x * x)); }
+static constexpr auto falloff_linear = f64::lut<32, 256, 1>::generate([](f64::fixed64<32> x) { return falloff(x); }, 0, 2);
+static constexpr auto falloff_cubic = f64::lut<32, 64, 3>::generate([](f64::fixed64<32> x) { return falloff(x); }, 0, 2);
+template<unsigned int F>
+static inline f64::fixed64<F> lut_linear(f64::fixed64<F> x) { return falloff_linear(x); }
+template<unsigned int F>
+static inline f64::fixed64<F> lut_cubic(f64::fixed64<F> x) { return falloff_cubic(x); }
+static const auto polyline_pieces = [] {
+	f64::fixed64<32> x[9], y[9];
+	for (int i = 0; i < 9; ++i)
+	{
+		x[i] = polyline_x[i];
+		y[i] = polyline_y[i];
+	}
+	f64::piecewise_chebyshev<32> p;
+	p.fit(x, y, 9, f64::fixed64<32>(0.0001));
+	return p;
+}();
+template<unsigned int F>
+static inline f64::fixed64<F> piecewise(f64::fixed64<F> x) { return polyline_pieces(x); }
+template<unsigned int F>
+static inline f64::fixed64<F> poly_exp(f64::fixed64<F> x)
+{
+	constexpr int64_t ONE = int64_t(1) << F;
+	return f64::poly_eval<ONE, ONE, ONE / 2, ONE / 6, ONE / 24, ONE / 120, ONE / 720, ONE / 5040>(x);
+}
+template<unsigned int F>
+static inline f64::fixed64<F> perlin3(f64::fixed64<F> x, f64::fixed64<F> y) { return noise.perlin(x, y, (x + y) / 2); }
+template<unsigned int F>
+static inline f64::fixed64<F> simplex2(f64::fixed64<F> x, f64::fixed64<F> y) { return noise.simplex(x, y); }
+template<unsigned int F>
+static inline f64::fixed64<F> simplex_grid(f64::fixed64<F> x)
+{
+	f64::fixed64<F> out[256];
+	noise.simplex_grid(x, x, f64::fixed64<F>(0.05), 16, 16, out);
+	return out[255];
+}
+template<unsigned int F>
+static inline f64::fixed64<F> to_polar_sum(f64::fixed64<F> x, f64::fixed64<F> y) { f64::fixed64<F> r, t; f64::cordic::vector_to_polar(x, y, &r, &t); return r + t; }
+
 struct Counter
 {
 	using time_t = std::chrono::high_resolution_clock;
@@ -308,18 +467,87 @@ int main()
 	RUN_METHOD_TEST_GROUP("round", round(a), 0xff, count3, -2, 2);
 	RUN_METHOD_TEST_GROUP("abs", abs(a), 0xff, count3, -2, 2);
 	RUN_METHOD_TEST_GROUP("exp", exp(a), 0xf, count3, 0, 1);
+	RUN_METHOD_TEST_GROUP("exp", exp(a), 0xf, count3, -10, 10);
 	RUN_METHOD_TEST_GROUP("exp2", exp2(a), 0xf, count3, 0, 1);
+	RUN_METHOD_TEST_GROUP("fast exp2", fast_exp2(a), 0xf, count3, 0, 1);
 	RUN_METHOD_TEST_GROUP("sqrt", sqrt(a), 0xf, count3, 0, 100);
+	RUN_METHOD_TEST_GROUP("rsqrt", rsqrt(a), 0xf, count3, 1, 100);
+	RUN_METHOD_TEST_GROUP("x*rsqrt(x)", a * rsqrt(a), 0xf, count3, 1, 100);
+	RUN_METHOD_TEST_GROUP("cbrt", cbrt(a), 0xf, count3, -100, 100);
+	RUN_METHOD_TEST_GROUP("hypot", hypot(a, b), 0xf, count3, -100, 100);
 	RUN_METHOD_TEST_GROUP("log2", log2(a), 0xf, count3, 1, 100);
+	RUN_METHOD_TEST_GROUP("fast log2", fast_log2(a), 0xf, count3, 1, 100);
 	RUN_METHOD_TEST_GROUP("log", log(a), 0xf, count3, 1, 100);
 	RUN_METHOD_TEST_GROUP("log10", log10(a), 0xf, count3, 1, 100);
+	RUN_METHOD_TEST_GROUP("log1p", log1p(a), 0xf, count3, -0.5, 1);
+	RUN_METHOD_TEST_GROUP("expm1", expm1(a), 0xf, count3, -1, 1);
+	RUN_METHOD_TEST_GROUP("sinh", sinh(a), 0xf, count3, -5, 5);
+	RUN_METHOD_TEST_GROUP("cosh", cosh(a), 0xf, count3, -5, 5);
+	RUN_METHOD_TEST_GROUP("tanh", tanh(a), 0xf, count3, -5, 5);
+	RUN_METHOD_TEST_GROUP("sinhcosh", sinhcosh_sum(a), 0xf, count3, -5, 5);
+	RUN_METHOD_TEST_GROUP("pow", pow(a, b), 0xf, count3, 0.5, 4);
+	RUN_METHOD_TEST_GROUP("pow int", pow(a, 5), 0xf, count3, 0.5, 4);
+	RUN_METHOD_TEST_GROUP("pow -int", pow(a, -5), 0xf, count3, 0.5, 4);
 
 	RUN_METHOD_TEST_GROUP("sin", sin(a), 0xf, count3, -10, 10);
 	RUN_METHOD_TEST_GROUP("cos", cos(a), 0xf, count3, -10, 10);
+	RUN_METHOD_TEST_GROUP("sincos", sincos_sum(a), 0xf, count3, -10, 10);
+	const uint64_t count4 = count3 / 64;
+	RUN_METHOD_TEST_GROUP("sincos_sequence x64", sequence_sum(a), 0xf, count4, -10, 10);
 	RUN_METHOD_TEST_GROUP("tan", tan(a), 0xf, count3, -1, 1);
+	RUN_METHOD_TEST_GROUP("cot", cot(a), 0xf, count3, 0.1, 1.5);
 	RUN_METHOD_TEST_GROUP("asin", asin(a), 0xf, count3, -1, 1);
 	RUN_METHOD_TEST_GROUP("acos", acos(a), 0xf, count3, -1, 1);
 	RUN_METHOD_TEST_GROUP("atan", atan(a), 0xf, count3, -100, 100);
+	RUN_METHOD_TEST_GROUP("atan2", atan2(a, b), 0xf, count3, -100, 100);
+	RUN_METHOD_TEST_GROUP("hypot+atan2", hypot(a, b) + atan2(b, a), 0xf, count3, -100, 100);
+	RUN_METHOD_TEST_GROUP("cordic polar", polar_sum(a, b), 0xf, count3, -10, 10);
+	RUN_METHOD_TEST_GROUP("cordic to polar", to_polar_sum(a, b), 0xf, count3, -100, 100);
+	RUN_METHOD_TEST_GROUP("poly_eval degree 7", poly_exp(a), 0xf, count3, -0.5, 0.5);
+	RUN_METHOD_TEST_GROUP("exp(-x*x)", falloff(a), 0xf, count3, 0, 2);
+	RUN_METHOD_TEST_GROUP("lut linear 256", lut_linear(a), 0xf, count3, 0, 2);
+	RUN_METHOD_TEST_GROUP("lut cubic 64", lut_cubic(a), 0xf, count3, 0, 2);
+	RUN_METHOD_TEST_GROUP("piecewise chebyshev", piecewise(a), 0xf, count3, 0, 20);
+	RUN_METHOD_TEST_GROUP("perlin 3d", perlin3(a, b), 0xf, count3, -100, 100);
+	RUN_METHOD_TEST_GROUP("simplex 2d", simplex2(a, b), 0xf, count3, -100, 100);
+	const uint64_t count5 = count3 / 256;
+	RUN_METHOD_TEST_GROUP("simplex grid 16x16", simplex_grid(a), 0xf, count5, -100, 100);
+
+	RUN_METHOD_TEST_GROUP("fast exp", fast_exp(a), 0xf, count3, -10, 10);
+	RUN_METHOD_TEST_GROUP("fast expm1", fast_expm1(a), 0xf, count3, -1, 1);
+	RUN_METHOD_TEST_GROUP("fast log", fast_log(a), 0xf, count3, 1, 100);
+	RUN_METHOD_TEST_GROUP("fast log10", fast_log10(a), 0xf, count3, 1, 100);
+	RUN_METHOD_TEST_GROUP("fast log1p", fast_log1p(a), 0xf, count3, -0.5, 1);
+	RUN_METHOD_TEST_GROUP("fast pow", fast_pow(a, b), 0xf, count3, 0.5, 4);
+	RUN_METHOD_TEST_GROUP("fast sinh", fast_sinh(a), 0xf, count3, -5, 5);
+	RUN_METHOD_TEST_GROUP("fast cosh", fast_cosh(a), 0xf, count3, -5, 5);
+	RUN_METHOD_TEST_GROUP("fast tanh", fast_tanh(a), 0xf, count3, -5, 5);
+	RUN_METHOD_TEST_GROUP("fast sin", fast_sin(a), 0xf, count3, -10, 10);
+	RUN_METHOD_TEST_GROUP("fast cos", fast_cos(a), 0xf, count3, -10, 10);
+	RUN_METHOD_TEST_GROUP("fast tan", fast_tan(a), 0xf, count3, -1, 1);
+	RUN_METHOD_TEST_GROUP("fast asin", fast_asin(a), 0xf, count3, -1, 1);
+	RUN_METHOD_TEST_GROUP("fast acos", fast_acos(a), 0xf, count3, -1, 1);
+	RUN_METHOD_TEST_GROUP("fast atan", fast_atan(a), 0xf, count3, -100, 100);
+	RUN_METHOD_TEST_GROUP("fast atan2", fast_atan2(a, b), 0xf, count3, -100, 100);
+
+	RUN_METHOD_TEST_GROUP("precise exp", precise_exp(a), 0xf, count3, -10, 10);
+	RUN_METHOD_TEST_GROUP("precise exp2", precise_exp2(a), 0xf, count3, 0, 1);
+	RUN_METHOD_TEST_GROUP("precise expm1", precise_expm1(a), 0xf, count3, -1, 1);
+	RUN_METHOD_TEST_GROUP("precise log", precise_log(a), 0xf, count3, 1, 100);
+	RUN_METHOD_TEST_GROUP("precise log2", precise_log2(a), 0xf, count3, 1, 100);
+	RUN_METHOD_TEST_GROUP("precise log10", precise_log10(a), 0xf, count3, 1, 100);
+	RUN_METHOD_TEST_GROUP("precise log1p", precise_log1p(a), 0xf, count3, -0.5, 1);
+	RUN_METHOD_TEST_GROUP("precise pow", precise_pow(a, b), 0xf, count3, 0.5, 4);
+	RUN_METHOD_TEST_GROUP("precise sinh", precise_sinh(a), 0xf, count3, -5, 5);
+	RUN_METHOD_TEST_GROUP("precise cosh", precise_cosh(a), 0xf, count3, -5, 5);
+	RUN_METHOD_TEST_GROUP("precise tanh", precise_tanh(a), 0xf, count3, -5, 5);
+	RUN_METHOD_TEST_GROUP("precise sin", precise_sin(a), 0xf, count3, -10, 10);
+	RUN_METHOD_TEST_GROUP("precise cos", precise_cos(a), 0xf, count3, -10, 10);
+	RUN_METHOD_TEST_GROUP("precise tan", precise_tan(a), 0xf, count3, -1, 1);
+	RUN_METHOD_TEST_GROUP("precise asin", precise_asin(a), 0xf, count3, -1, 1);
+	RUN_METHOD_TEST_GROUP("precise acos", precise_acos(a), 0xf, count3, -1, 1);
+	RUN_METHOD_TEST_GROUP("precise atan", precise_atan(a), 0xf, count3, -100, 100);
+	RUN_METHOD_TEST_GROUP("precise atan2", precise_atan2(a, b), 0xf, count3, -100, 100);
 
 	return 0;
 }
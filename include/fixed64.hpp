@@ -8,6 +8,8 @@
 #include <bit> // for clz
 #include <iostream> 
 #include <string>
+#include <cmath> // for sqrt seed
+#include <type_traits>
 
 #if __cplusplus >= 202002L // c++20, MSVC requires /Zc:__cplusplus
 #define FIXED_64_ENABLE_CPP20 1
@@ -28,7 +30,6 @@
 #endif
 
 #if FIXED_64_ENABLE_TRIG_LUT
-#define FIXED_64_TRIG_LUT_COUNT 10000
 #include "trig_lut.hpp"
 #endif
 
@@ -490,409 +491,3396 @@ namespace f64
 	}
 
 
-	template <unsigned int F, class T, typename std::enable_if<std::is_integral<T>::value>::type* = nullptr>
-	constexpr inline fixed64<F> pow(fixed64<F> base, T exp) noexcept
+	// Unsigned 128-bit intermediate, used where a product or a sum of products
+	// does not fit in 64 bits.
+	struct uint128
 	{
-		using Fixed = fixed64<F>;
+		uint64_t hi;
+		uint64_t lo;
 
-		if (base == Fixed(0)) {
-			FIXED_64_ASSERT(exp > 0);
-			return Fixed(0);
+		static constexpr FIXED_64_FORCEINLINE uint128 mul(uint64_t a, uint64_t b) noexcept
+		{
+#if FIXED_64_ENABLE_INT128_ACCELERATION && !FIXED_64_FORCE_EVALUATE_IN_COMPILE_TIME
+#if FIXED_64_ENABLE_CPP20
+			// the intrinsic is not constexpr
+			if (std::is_constant_evaluated())
+				return mul_soft(a, b);
+#endif
+			uint64_t hi = 0;
+			uint64_t lo = _umul128(a, b, &hi);
+			return { hi, lo };
+#elif defined(__SIZEOF_INT128__)
+			__extension__ typedef unsigned __int128 u128;
+			u128 p = u128(a) * b;
+			return { uint64_t(p >> 64), uint64_t(p) };
+#else
+			return mul_soft(a, b);
+#endif
+		}
+
+		// 4 partial products of 32 x 32 bits
+		static constexpr FIXED_64_FORCEINLINE uint128 mul_soft(uint64_t a, uint64_t b) noexcept
+		{
+			uint64_t a_hi = a >> 32, a_lo = a & 0xFFFFFFFF;
+			uint64_t b_hi = b >> 32, b_lo = b & 0xFFFFFFFF;
+
+			uint64_t lo_lo = a_lo * b_lo;
+			uint64_t hi_lo = a_hi * b_lo + (lo_lo >> 32);
+			uint64_t lo_hi = a_lo * b_hi + (hi_lo & 0xFFFFFFFF);
+
+			return { a_hi * b_hi + (hi_lo >> 32) + (lo_hi >> 32), (lo_hi << 32) | (lo_lo & 0xFFFFFFFF) };
+		}
+
+		// n / d for n.hi < d, the quotient fits in 64 bits
+		static constexpr FIXED_64_FORCEINLINE uint64_t div(uint128 n, uint64_t d) noexcept
+		{
+#if FIXED_64_ENABLE_INT128_ACCELERATION && !FIXED_64_FORCE_EVALUATE_IN_COMPILE_TIME
+#if FIXED_64_ENABLE_CPP20
+			// the intrinsic is not constexpr
+			if (std::is_constant_evaluated())
+				return div_soft(n, d);
+#endif
+			uint64_t remainder = 0;
+			return _udiv128(n.hi, n.lo, d, &remainder);
+#elif defined(__SIZEOF_INT128__)
+			// a library call, which runs one hardware divide on x86-64
+			__extension__ typedef unsigned __int128 u128;
+			return uint64_t(((u128(n.hi) << 64) | n.lo) / d);
+#else
+			return div_soft(n, d);
+#endif
+		}
+
+		// two 32-bit quotient digits on the normalized divisor (Knuth's algorithm D),
+		// each estimated by one 64-bit divide and corrected at most twice
+		static constexpr FIXED_64_FORCEINLINE uint64_t div_soft(uint128 n, uint64_t d) noexcept
+		{
+			constexpr uint64_t BASE = uint64_t(1) << 32;
+
+			const long s = fixed64<0>::clz(d);
+			d <<= s;
+			const uint64_t d_hi = d >> 32, d_lo = d & 0xFFFFFFFF;
+			const uint64_t n_32 = s == 0 ? n.hi : (n.hi << s) | (n.lo >> (64 - s));
+			const uint64_t n_10 = n.lo << s;
+			const uint64_t n_1 = n_10 >> 32, n_0 = n_10 & 0xFFFFFFFF;
+
+			uint64_t q_1 = n_32 / d_hi;
+			uint64_t r = n_32 - q_1 * d_hi;
+			while (q_1 >= BASE || q_1 * d_lo > ((r << 32) | n_1))
+			{
+				--q_1;
+				r += d_hi;
+				if (r >= BASE)
+					break;
+			}
+
+			const uint64_t n_21 = (n_32 << 32) + n_1 - q_1 * d;
+			uint64_t q_0 = n_21 / d_hi;
+			r = n_21 - q_0 * d_hi;
+			while (q_0 >= BASE || q_0 * d_lo > ((r << 32) | n_0))
+			{
+				--q_0;
+				r += d_hi;
+				if (r >= BASE)
+					break;
+			}
+			return (q_1 << 32) + q_0;
+		}
+
+		friend constexpr FIXED_64_FORCEINLINE uint128 operator+ (uint128 a, uint128 b) noexcept
+		{
+			uint64_t lo = a.lo + b.lo;
+			return { a.hi + b.hi + (lo < a.lo), lo };
+		}
+
+		friend constexpr FIXED_64_FORCEINLINE uint128 operator- (uint128 a, uint128 b) noexcept
+		{
+			return { a.hi - b.hi - (a.lo < b.lo), a.lo - b.lo };
+		}
+
+		friend constexpr FIXED_64_FORCEINLINE uint128 operator<< (uint128 a, unsigned int shift) noexcept
+		{
+			if (shift == 0) return a;
+			if (shift >= 64) return { a.lo << (shift - 64), 0 };
+			return { (a.hi << shift) | (a.lo >> (64 - shift)), a.lo << shift };
+		}
+
+		friend constexpr FIXED_64_FORCEINLINE uint128 operator>> (uint128 a, unsigned int shift) noexcept
+		{
+			if (shift == 0) return a;
+			if (shift >= 64) return { 0, a.hi >> (shift - 64) };
+			return { a.hi >> shift, (a.lo >> shift) | (a.hi << (64 - shift)) };
+		}
+
+		friend constexpr FIXED_64_FORCEINLINE bool operator< (uint128 a, uint128 b) noexcept
+		{
+			return a.hi < b.hi || (a.hi == b.hi && a.lo < b.lo);
+		}
+
+		friend constexpr FIXED_64_FORCEINLINE bool operator<= (uint128 a, uint128 b) noexcept
+		{
+			return !(b < a);
+		}
+
+		friend constexpr FIXED_64_FORCEINLINE bool operator> (uint128 a, uint128 b) noexcept
+		{
+			return b < a;
+		}
+
+		friend constexpr FIXED_64_FORCEINLINE bool operator>= (uint128 a, uint128 b) noexcept
+		{
+			return !(a < b);
+		}
+
+		friend constexpr FIXED_64_FORCEINLINE bool operator== (uint128 a, uint128 b) noexcept
+		{
+			return a.hi == b.hi && a.lo == b.lo;
+		}
+
+		friend constexpr FIXED_64_FORCEINLINE bool operator!= (uint128 a, uint128 b) noexcept
+		{
+			return !(a == b);
+		}
+	};
+
+	namespace internal
+	{
+		// (a * b) >> shift on signed operands, rounding toward negative infinity.
+		// The shifted result must fit in 64 bits.
+		constexpr FIXED_64_FORCEINLINE int64_t mul_shift(int64_t a, int64_t b, unsigned int shift) noexcept
+		{
+#if !FIXED_64_ENABLE_INT128_ACCELERATION && defined(__SIZEOF_INT128__)
+			__extension__ typedef __int128 i128;
+			return int64_t((i128(a) * b) >> shift);
+#else
+			uint128 p = uint128::mul(uint64_t(a), uint64_t(b));
+			p.hi -= uint64_t(a >> 63) & uint64_t(b);
+			p.hi -= uint64_t(b >> 63) & uint64_t(a);
+			if (shift == 0)
+				return int64_t(p.lo);
+			if (shift >= 64)
+				return int64_t(p.hi) >> (shift - 64);
+			return int64_t((p.lo >> shift) | (p.hi << (64 - shift)));
+#endif
+		}
+
+		// (n * c) >> shift for n in [0, 64], c in [0, 2^62] and shift in [0, 62], from two
+		// 64-bit products, so range constants stay plain constant expressions
+		constexpr FIXED_64_FORCEINLINE int64_t scale_q62(int64_t n, int64_t c, unsigned int shift) noexcept
+		{
+			const int64_t hi = n * (c >> 32);
+			const int64_t lo = n * (c & 0xFFFFFFFF);
+			return shift >= 32 ? (hi + (lo >> 32)) >> (shift - 32) : (hi << (32 - shift)) + (lo >> shift);
 		}
 
-		Fixed result{ 1 };
-		if (exp < 0)
+		// Q(Q) to Q(F), rounded symmetrically around 0, saturated when F > Q
+		template <unsigned int F, unsigned int Q>
+		constexpr FIXED_64_FORCEINLINE fixed64<F> from_q(int64_t v) noexcept
 		{
-			for (Fixed intermediate = base; exp != 0; exp /= 2)
+			using Fixed = fixed64<F>;
+			if (F > Q)
 			{
-				if ((exp % 2) != 0)
+				constexpr unsigned int UP = F > Q ? F - Q : 0;
+				if (v > (Fixed::MAXIMUM >> UP) || v < -(Fixed::MAXIMUM >> UP))
 				{
-					result /= intermediate;
+					FIXED_64_OVERFLOW_ALERT();
+					return Fixed::from_raw(v > 0 ? Fixed::MAXIMUM : Fixed::MINIMUM);
 				}
-				if (exp != 1)
-					intermediate *= intermediate;
+				return Fixed::from_raw(int64_t(uint64_t(v) << UP));
 			}
+
+			constexpr unsigned int SHIFT = F > Q ? 0 : Q - F;
+			if (SHIFT == 0)
+				return Fixed::from_raw(v);
+
+			constexpr int64_t HALF = int64_t(1) << (SHIFT == 0 ? 0 : SHIFT - 1);
+			return Fixed::from_raw(v >= 0 ? ((v + HALF) >> SHIFT) : -((HALF - v) >> SHIFT));
 		}
-		else
+
+		// Q1.62 to Q(F), rounded symmetrically around 0
+		template <unsigned int F>
+		constexpr FIXED_64_FORCEINLINE fixed64<F> from_q62(int64_t v) noexcept
+		{
+			return from_q<F, 62>(v);
+		}
+
+		// floor(sqrt(n))
+		constexpr inline uint64_t isqrt_bitwise(uint64_t n) noexcept
+		{
+			/*
+				from https://en.wikipedia.org/wiki/Methods_of_computing_square_roots#Binary_numeral_system_.28base_2.29
+			*/
+			if (n == 0)
+				return 0;
+
+			uint64_t x = n;
+			uint64_t c = 0;
+
+			uint64_t d = uint64_t(1) << ((64 - fixed64<0>::clz(n) - 1) & ~(1));
+
+			while (d != 0)
+			{
+				auto a = c + d;
+				if (x >= a)
+				{
+					x -= a;
+					c = (c >> 1) + d;
+				}
+				else
+				{
+					c >>= 1;
+				}
+				d >>= 2;
+			}
+			return c;
+		}
+
+		// floor(sqrt(n)), seeded by hardware sqrt and fixed up in integer,
+		// so the result is exact whatever the seed is.
+		constexpr inline uint64_t isqrt(uint64_t n) noexcept
+		{
+#if FIXED_64_FORCE_EVALUATE_IN_COMPILE_TIME
+			return isqrt_bitwise(n);
+#else
+#if FIXED_64_ENABLE_CPP20
+			if (std::is_constant_evaluated())
+				return isqrt_bitwise(n);
+#endif
+			constexpr uint64_t MAX_ROOT = 0xFFFF'FFFF;
+			uint64_t c = static_cast<uint64_t>(std::sqrt(static_cast<double>(n)));
+			if (c > MAX_ROOT)
+				c = MAX_ROOT;
+
+			// IEEE sqrt is correctly rounded, so each loop runs once at most
+			while (c * c > n)
+				c--;
+			while (c < MAX_ROOT && (c + 1) * (c + 1) <= n)
+				c++;
+			return c;
+#endif
+		}
+
+		// floor(sqrt(n)) of a 128-bit value
+		constexpr inline uint64_t isqrt_bitwise(uint128 n) noexcept
 		{
-			for (Fixed intermediate = base; exp != 0; exp /= 2)
+			if (n.hi == 0)
+				return isqrt_bitwise(n.lo);
+
+			uint128 x = n;
+			uint128 c = { 0, 0 };
+			uint128 d = uint128{ 0, 1 } << ((128 - fixed64<0>::clz(n.hi) - 1) & ~(1));
+
+			while (d != uint128{ 0, 0 })
 			{
-				if ((exp % 2) != 0)
+				auto a = c + d;
+				if (x >= a)
 				{
-					result *= intermediate;
+					x = x - a;
+					c = (c >> 1) + d;
 				}
-				if (exp != 1)
-					intermediate *= intermediate;
+				else
+				{
+					c = c >> 1;
+				}
+				d = d >> 2;
+			}
+			return c.lo;
+		}
+
+		constexpr inline uint64_t isqrt(uint128 n) noexcept
+		{
+			if (n.hi == 0)
+				return isqrt(n.lo);
+#if FIXED_64_FORCE_EVALUATE_IN_COMPILE_TIME
+			return isqrt_bitwise(n);
+#else
+#if FIXED_64_ENABLE_CPP20
+			if (std::is_constant_evaluated())
+				return isqrt_bitwise(n);
+#endif
+			constexpr uint64_t MAX_ROOT = ~uint64_t(0);
+			constexpr double TWO_64 = 18446744073709551616.0;
+
+			// the seed is only good for ~52 bits, one Newton step in double on the
+			// exact integer residual brings it to within one of the root
+			const double d = std::sqrt(double(n.hi) * TWO_64 + double(n.lo));
+			uint64_t c = d >= TWO_64 ? MAX_ROOT : static_cast<uint64_t>(d);
+
+			const uint128 sq = uint128::mul(c, c);
+			const double residual = (sq <= n) ?
+				double((n - sq).hi) * TWO_64 + double((n - sq).lo) :
+				-(double((sq - n).hi) * TWO_64 + double((sq - n).lo));
+			const double step = residual / (2.0 * double(c));
+			if (step >= 0)
+			{
+				const uint64_t inc = static_cast<uint64_t>(step);
+				c = (MAX_ROOT - c < inc) ? MAX_ROOT : c + inc;
+			}
+			else
+			{
+				c -= static_cast<uint64_t>(-step);
+			}
+
+			while (uint128::mul(c, c) > n)
+				c--;
+			while (c < MAX_ROOT && uint128::mul(c + 1, c + 1) <= n)
+				c++;
+			return c;
+#endif
+		}
+	}
+
+	template<unsigned int F>
+	constexpr inline fixed64<F> sqrt(fixed64<F> v) noexcept
+	{
+		FIXED_64_ASSERT(v >= 0 && "sqrt input should be non-negative");
+
+		if (v.raw_value() == 0)
+		{
+			return v;
+		}
+
+		using Fixed = fixed64<F>;
+
+		uint64_t n = v.raw_value();
+		n <<= (F & 1);
+
+		return Fixed::from_raw(int64_t(internal::isqrt(n) << (F / 2)));
+	}
+
+	// Square of the raw value, without the shift back to F.
+	// Sums of these are fed to sqrt_wide.
+	template<unsigned int F>
+	constexpr FIXED_64_FORCEINLINE uint128 square_wide(fixed64<F> v) noexcept
+	{
+		const uint64_t n = v.raw_value() >= 0 ? uint64_t(v.raw_value()) : uint64_t(0) - uint64_t(v.raw_value());
+		return uint128::mul(n, n);
+	}
+
+	// Square root of a sum of unshifted squares (see square_wide),
+	// the root of a Q(2F) value is already a Q(F) value.
+	template<unsigned int F>
+	constexpr inline fixed64<F> sqrt_wide(uint128 v) noexcept
+	{
+		using Fixed = fixed64<F>;
+		const uint64_t root = internal::isqrt(v);
+		if (root > uint64_t(Fixed::MAXIMUM))
+		{
+			FIXED_64_OVERFLOW_ALERT();
+			return Fixed::from_raw(Fixed::MAXIMUM);
+		}
+		return Fixed::from_raw(int64_t(root));
+	}
+
+	template<unsigned int F>
+	constexpr inline fixed64<F> length2(fixed64<F> x, fixed64<F> y) noexcept
+	{
+		return sqrt_wide<F>(square_wide(x) + square_wide(y));
+	}
+
+	template<unsigned int F>
+	constexpr inline fixed64<F> length3(fixed64<F> x, fixed64<F> y, fixed64<F> z) noexcept
+	{
+		return sqrt_wide<F>(square_wide(x) + square_wide(y) + square_wide(z));
+	}
+
+	namespace internal
+	{
+		constexpr inline int bit_length(uint64_t v) noexcept
+		{
+			return v == 0 ? 0 : 64 - int(fixed64<0>::clz(v));
+		}
+
+		// (a * b) >> shift floored into r for shift in [0, 63], false when it does not fit in 64 bits
+		constexpr FIXED_64_FORCEINLINE bool mul_shift_checked(int64_t a, int64_t b, unsigned int shift, int64_t* r) noexcept
+		{
+			uint128 p = uint128::mul(uint64_t(a), uint64_t(b));
+			p.hi -= uint64_t(a >> 63) & uint64_t(b);
+			p.hi -= uint64_t(b >> 63) & uint64_t(a);
+			const uint64_t lo = shift == 0 ? p.lo : (p.lo >> shift) | (p.hi << (64 - shift));
+			const int64_t rest = shift == 0 ? int64_t(p.hi) : int64_t(p.hi) >> shift;
+			*r = int64_t(lo);
+			return rest == (int64_t(lo) >> 63);
+		}
+
+		// largest power of two below n, where Estrin's scheme splits n terms
+		constexpr int estrin_split(int n) noexcept
+		{
+			return n <= 2 ? 1 : 2 * estrin_split((n + 1) / 2);
+		}
+
+		// k for 2^k = n
+		constexpr int estrin_level(int n) noexcept
+		{
+			return n <= 1 ? 0 : 1 + estrin_level(n / 2);
+		}
+
+		// Estrin's scheme over c[LO .. LO + N) in Q(W) with pw[k] = x^(2^k) in Q(W):
+		// the lower half plus x^H times the upper half, H the largest power of two
+		// below N. Both halves are independent, so the dependent chain is
+		// log2(N) multiplies deep where Horner is N - 1.
+		template <unsigned int W, int LO, int N>
+		struct estrin
+		{
+			template <class C>
+			static constexpr FIXED_64_FORCEINLINE int64_t eval(const C& c, const int64_t* pw) noexcept
+			{
+				constexpr int H = estrin_split(N);
+				return estrin<W, LO, H>::eval(c, pw) + mul_shift(estrin<W, LO + H, N - H>::eval(c, pw), pw[estrin_level(H)], W);
+			}
+		};
+
+		template <unsigned int W, int LO>
+		struct estrin<W, LO, 1>
+		{
+			template <class C>
+			static constexpr FIXED_64_FORCEINLINE int64_t eval(const C& c, const int64_t*) noexcept
+			{
+				return int64_t(c[LO]);
+			}
+		};
+
+		// c[0] + c[1] x + ... + c[N - 1] x^(N - 1) with everything in Q(W), products floored
+		template <unsigned int W, int N, class C>
+		constexpr FIXED_64_FORCEINLINE int64_t estrin_eval(const C& c, int64_t x) noexcept
+		{
+			constexpr int LEVELS = estrin_level(estrin_split(N)) + 1;
+			int64_t pw[LEVELS] = { x };
+			for (int k = 1; k < LEVELS; ++k)
+				pw[k] = mul_shift(pw[k - 1], pw[k - 1], W);
+			return estrin<W, 0, N>::eval(c, pw);
+		}
+
+		// Estrin's scheme over the unsigned Q0.64 Lut::poly[LO .. LO + N) with pw[k] = s^(2^k).
+		// ALTERNATING subtracts every odd term, which only happens inside a pair, so
+		// every partial sum stays positive when poly[k] > poly[k + 1].
+		template <class Lut, int LO, int N, bool ALTERNATING>
+		struct estrin_q64
+		{
+			static constexpr FIXED_64_FORCEINLINE uint64_t eval(const uint64_t* pw) noexcept
+			{
+				constexpr int H = estrin_split(N);
+				const uint64_t upper = uint128::mul(estrin_q64<Lut, LO + H, N - H, ALTERNATING>::eval(pw), pw[estrin_level(H)]).hi;
+				const uint64_t lower = estrin_q64<Lut, LO, H, ALTERNATING>::eval(pw);
+				return ALTERNATING && H == 1 ? lower - upper : lower + upper;
+			}
+		};
+
+		template <class Lut, int LO, bool ALTERNATING>
+		struct estrin_q64<Lut, LO, 1, ALTERNATING>
+		{
+			static constexpr FIXED_64_FORCEINLINE uint64_t eval(const uint64_t*) noexcept
+			{
+				return Lut::poly[LO];
+			}
+		};
+
+		// Lut::poly[K] +- s * poly[K + 1] + s^2 * poly[K + 2] +- ... in Q0.64 with s in [0, 1),
+		// every step is one multiply-high. ALTERNATING needs poly[k] > poly[k + 1].
+		template <class Lut, int K, int DEGREE, bool ALTERNATING>
+		struct series
+		{
+			static constexpr FIXED_64_FORCEINLINE uint64_t eval(uint64_t s) noexcept
+			{
+				constexpr int N = DEGREE - K + 1;
+				constexpr int LEVELS = estrin_level(estrin_split(N)) + 1;
+				uint64_t pw[LEVELS] = { s };
+				for (int k = 1; k < LEVELS; ++k)
+					pw[k] = uint128::mul(pw[k - 1], pw[k - 1]).hi;
+				return estrin_q64<Lut, K, N, ALTERNATING>::eval(pw);
+			}
+		};
+
+		// The signed Q1.62 row of Lut::poly for DEGREE at z in Q1.62, c[0] + c[1] z + ...
+		// Lut::poly keeps one minimax set per degree from Lut::MIN_DEGREE on, so the
+		// kernel picks its precision tier at compile time.
+		template <class Lut, int DEGREE>
+		constexpr FIXED_64_FORCEINLINE int64_t poly_q62(int64_t z) noexcept
+		{
+			return estrin_eval<62, DEGREE + 1>(Lut::poly[DEGREE - Lut::MIN_DEGREE], z);
+		}
+	}
+
+	namespace internal
+	{
+		// bits of sum |c[k]| over the raw coefficients, 64 once the sum passes 2^63
+		template <size_t N>
+		constexpr int poly_sum_bits(const std::array<int64_t, N>& c) noexcept
+		{
+			uint64_t sum = 0;
+			for (size_t k = 0; k < N; ++k)
+			{
+				const uint64_t a = c[k] < 0 ? uint64_t(0) - uint64_t(c[k]) : uint64_t(c[k]);
+				if (sum + a < sum || sum + a > (uint64_t(1) << 63))
+					return 64;
+				sum += a;
+			}
+			return bit_length(sum);
+		}
+	}
+
+	// c[0] + c[1] x + ... + c[n - 1] x^(n - 1) for raw coefficients C in Q(F), by
+	// Estrin's scheme: terms pair up and x^2, x^4 ... square alongside, so the
+	// dependent chain is log2(n) multiplies deep. Intermediates keep (63 - F) / 2
+	// guard bits and only the sum is rounded back to Q(F), while sum |c[k]| |x|^k
+	// leaves room for them. Beyond that, Horner's rule runs in Q(F) with every
+	// step checked in 128 bits, and a result out of range saturates toward the
+	// sign of the term that overflowed.
+	//
+	//   constexpr auto C0 = fixed64<32>(1).raw_value(), C1 = fixed64<32>(0.5).raw_value();
+	//   poly_eval<C0, C1>(x); // 1 + x / 2
+	template <int64_t... C, unsigned int F>
+	constexpr inline fixed64<F> poly_eval(fixed64<F> x) noexcept
+	{
+		using Fixed = fixed64<F>;
+		constexpr int N = int(sizeof...(C));
+		static_assert(N > 0, "poly_eval needs at least one coefficient");
+		constexpr std::array<int64_t, N> raw = { C... };
+		constexpr unsigned int GUARD = (63 - F) / 2;
+
+		// every partial sum is below sum |c[k]| * 2^(e k) for |x| < 2^e, e >= 0, and
+		// the powers of x below 2^(F + e (n - 1))
+		constexpr int BASE = internal::poly_sum_bits(raw) > int(F) + 1 ? internal::poly_sum_bits(raw) : int(F) + 1;
+		constexpr int ROOM = 62 - int(GUARD) - BASE;
+		const int64_t v = x.raw_value();
+		const int bits = internal::bit_length(v < 0 ? uint64_t(0) - uint64_t(v) : uint64_t(v));
+		const int e = bits > int(F) ? bits - int(F) : 0;
+		if (ROOM >= 0 && e * (N - 1) <= ROOM)
+		{
+			constexpr std::array<int64_t, N> c = { (C * (int64_t(1) << (ROOM >= 0 ? GUARD : 0)))... };
+			const int64_t r = internal::estrin_eval<F + GUARD, N>(c, v * (int64_t(1) << GUARD));
+			return Fixed::from_raw(GUARD == 0 ? r : (r + (int64_t(1) << (GUARD == 0 ? 0 : GUARD - 1))) >> GUARD);
+		}
+
+		int64_t acc = raw[N - 1];
+		for (int k = N - 2; k >= 0; --k)
+		{
+			int64_t t = 0;
+			const bool fits = internal::mul_shift_checked(acc, v, F, &t);
+			const int64_t sum = int64_t(uint64_t(t) + uint64_t(raw[k]));
+			if (!fits || ((t ^ sum) & (raw[k] ^ sum)) < 0)
+			{
+				// the sign of this term, times x for each of the k multiplies left
+				const bool negative = (fits ? t < 0 : (acc < 0) != (v < 0)) != (v < 0 && (k & 1));
+				FIXED_64_OVERFLOW_ALERT();
+				return Fixed::from_raw(negative ? Fixed::MINIMUM : Fixed::MAXIMUM);
+			}
+			acc = sum;
+		}
+		return Fixed::from_raw(acc);
+	}
+
+	namespace internal
+	{
+
+		struct exp2_lut
+		{
+			// 2^(i/64) in Q1.62
+			static constexpr std::array<int64_t, 64> lut =
+			{
+				0x4000000000000000, 0x40B268F9DE0183BA, 0x4166C34C5615D0EC, 0x421D1461D66F2023,
+				0x42D561B3E6243D8A, 0x438FB0CB4F468808, 0x444C0740496D4294, 0x450A6ABAA4B77ECD,
+				0x45CAE0F1F545EB73, 0x468D6FADBF2DD4F3, 0x47521CC5A2E6A9E0, 0x4818EE218A3358EE,
+				0x48E1E9B9D588E19B, 0x49AD159789F37496, 0x4A7A77D47F7B84B1, 0x4B4A169B900C2D00,
+				0x4C1BF828C6DC54B8, 0x4CF022C9905BFD32, 0x4DC69CDCEAA72A9C, 0x4E9F6CD3967FDBA8,
+				0x4F7A993048D088D7, 0x50582887DCB8A7E1, 0x513821818624B40C, 0x521A8AD704F3404F,
+				0x52FF6B54D8A89C75, 0x53E6C9DA74B29AB5, 0x54D0AD5A753E077C, 0x55BD1CDAD49F699C,
+				0x56AC1F752150A563, 0x579DBC56B48521BA, 0x5891FAC0E95612C8, 0x5988E20954889245,
+				0x5A827999FCEF3242, 0x5B7EC8F19468BBC9, 0x5C7DD7A3B17DCF75, 0x5D7FAD59099F22FE,
+				0x5E8451CFAC061B5F, 0x5F8BCCDB3D398841, 0x6096266533384A2B, 0x61A3666D124BB204,
+				0x62B39508AA836D6F, 0x63C6BA6455DCD8AE, 0x64DCDEC3371793D1, 0x65F60A7F79393E2E,
+				0x6712460A8FC24072, 0x683199ED779592CA, 0x69540EC8F895722D, 0x6A79AD55E7F6FD10,
+				0x6BA27E656B4EB57A, 0x6CCE8AE13C57EBDB, 0x6DFDDBCBED791BAB, 0x6F307A412F074892,
+				0x70666F76154A7089, 0x719FC4B95F452D29, 0x72DC8373BE41A454, 0x741CB5281E25EE34,
+				0x75606373EE921C97, 0x76A7980F6CCA15C2, 0x77F25CCDEE6D7AE6, 0x7940BB9E2CFFD89D,
+				0x7A92BE8A92436616, 0x7BE86FB985689DDC, 0x7D41D96DB915019D, 0x7E9F06067A4360BA,
+			};
+
+			// (ln(2) / 64)^k / k! in Q0.64 for k >= 1, the series of 2^(s / 64) - 1 for s in [0, 1)
+			static constexpr std::array<uint64_t, 8> poly =
+			{
+				0, 199786072581291495, 1081884007225522, 3905754423444,
+				10575244791, 22906878, 41349, 64,
+			};
+		};
+
+		// degree of the series that keeps the truncation over [0, 1/64) below 2^-(F+2)
+		//   2: 2^-22.2, 3: 2^-30.7, 4: 2^-39.6, 5: 2^-48.7, 6: 2^-58.0, 7: 2^-67.5
+		template <unsigned int F>
+		constexpr FIXED_64_FORCEINLINE int exp2_degree() noexcept
+		{
+			return F <= 20 ? 2 : F <= 28 ? 3 : F <= 37 ? 4 : F <= 46 ? 5 : F <= 56 ? 6 : 7;
+		}
+
+		// degree of the series that keeps the truncation over [0, 1/64) below 2^-(F+2)
+		//   3: 2^-25.5, 4: 2^-31.8, 5: 2^-38.1, 6: 2^-44.3, 7: 2^-50.5, 8: 2^-56.6, 9: 2^-62.8, 10: 2^-68.9
+		template <unsigned int F>
+		constexpr FIXED_64_FORCEINLINE int log2_degree() noexcept
+		{
+			return F <= 22 ? 3 : F <= 29 ? 4 : F <= 36 ? 5 : F <= 42 ? 6 : F <= 48 ? 7 : F <= 54 ? 8 : F <= 60 ? 9 : 10;
+		}
+
+		// 2^f in Q1.62 for f in [0, 1) given in Q0.64, the top 6 bits index the table
+		// and the series covers the rest. The result is in [2^62, 2^63].
+		template <int DEGREE>
+		constexpr FIXED_64_FORCEINLINE uint64_t exp2_frac_q62(uint64_t f) noexcept
+		{
+			const uint64_t s = f << 6;
+			const uint64_t p = uint128::mul(series<exp2_lut, 1, DEGREE, false>::eval(s), s).hi;
+
+			const uint64_t t = uint64_t(exp2_lut::lut[f >> 58]);
+			return t + uint128::mul(t, p).hi;
+		}
+
+		// 2^(n + f) in Q(F) for n in [-(F + 1), 62 - F] and f in Q0.64, rounded
+		template <unsigned int F, int DEGREE>
+		constexpr FIXED_64_FORCEINLINE fixed64<F> exp2_scale(int64_t n, uint64_t f) noexcept
+		{
+			using Fixed = fixed64<F>;
+			const uint64_t v = exp2_frac_q62<DEGREE>(f);
+			const unsigned int shift = unsigned(int64_t(62 - F) - n);
+			const uint64_t r = shift == 0 ? v : (v + (uint64_t(1) << (shift - 1))) >> shift;
+			return Fixed::from_raw(r > uint64_t(Fixed::MAXIMUM) ? Fixed::MAXIMUM : int64_t(r));
+		}
+
+		template <unsigned int F, int DEGREE>
+		constexpr FIXED_64_FORCEINLINE fixed64<F> exp2(fixed64<F> x) noexcept
+		{
+			using Fixed = fixed64<F>;
+			// 63 - F and -(F + 1) in Q(F), nothing rounds to 0 above Q58
+			constexpr int64_t UPPER = int64_t(63 - F) << F;
+			constexpr int64_t LOWER = F >= 58 ? Fixed::MINIMUM : -(int64_t(F + 1) << F);
+			if (x.raw_value() >= UPPER)
+			{
+				FIXED_64_OVERFLOW_ALERT();
+				return Fixed::from_raw(Fixed::MAXIMUM);
+			}
+			if (x.raw_value() < LOWER)
+				return Fixed::from_raw(0);
+
+			const uint64_t f = F == 0 ? 0 : uint64_t(x.raw_value()) << (F == 0 ? 0 : 64 - F);
+			return exp2_scale<F, DEGREE>(x.raw_value() >> F, f);
+		}
+
+		struct log2_lut
+		{
+			// 1 / (1 + i/64) in Q1.63 rounded up, so m * inv never falls below 1
+			static constexpr std::array<uint64_t, 64> inv =
+			{
+				0x8000000000000000, 0x7E07E07E07E07E08, 0x7C1F07C1F07C1F08, 0x7A44C6AFC2DD9CA9,
+				0x7878787878787879, 0x76B981DAE6076B99, 0x7507507507507508, 0x73615A240E6C2B45,
+				0x71C71C71C71C71C8, 0x70381C0E070381C1, 0x6EB3E45306EB3E46, 0x6D3A06D3A06D3A07,
+				0x6BCA1AF286BCA1B0, 0x6A63BD81A98EF607, 0x6906906906906907, 0x67B23A5440CF6475,
+				0x6666666666666667, 0x6522C3F35BA78195, 0x63E7063E7063E707, 0x62B2E43DAFCEA68E,
+				0x6186186186186187, 0x6060606060606061, 0x5F417D05F417D060, 0x5E293205E293205F,
+				0x5D1745D1745D1746, 0x5C0B81702E05C0B9, 0x5B05B05B05B05B06, 0x5A05A05A05A05A06,
+				0x590B21642C8590B3, 0x5816058160581606, 0x572620AE4C415C99, 0x563B48C20563B48D,
+				0x5555555555555556, 0x54741FAB8BE05475, 0x5397829CBC14E5E1, 0x52BF5A814AFD6A06,
+				0x51EB851EB851EB86, 0x511BE1958B67EBBA, 0x5050505050505051, 0x4F88B2F392A409F2,
+				0x4EC4EC4EC4EC4EC5, 0x4E04E04E04E04E05, 0x4D4873ECADE304D5, 0x4C8F8D28AC42FD9C,
+				0x4BDA12F684BDA130, 0x4B27ED3604B27ED4, 0x4A7904A7904A7905, 0x49CD42E2049CD42F,
+				0x4924924924924925, 0x487EDE0487EDE049, 0x47DC11F7047DC120, 0x473C1AB68A0473C2,
+				0x469EE58469EE5847, 0x4604604604604605, 0x456C797DD49C3412, 0x44D72044D72044D8,
+				0x4444444444444445, 0x43B3D5AF9A723F79, 0x4325C53EF368EB05, 0x429A0429A0429A05,
+				0x4210842108421085, 0x4189374BC6A7EF9E, 0x4104104104104105, 0x4081020408102041,
+			};
+
+			// -log2(inv[i]) in Q1.63
+			static constexpr std::array<uint64_t, 64> log =
+			{
+				0x0000000000000000, 0x02DCF2D0B85A4531, 0x05AEB4DD63BF61CC, 0x08759C4FD14FCD59,
+				0x0B31FB7D64898B3E, 0x0DE4212056D5DD30, 0x108C588CDA79E395, 0x132AE9E278AE1A1F,
+				0x15C01A39FBD6879E, 0x184C2BD02F03B2FE, 0x1ACF5E2DB4EC93EF, 0x1D49EE4C32596FC9,
+				0x1FBC16B902680A22, 0x22260FB5A616EB95, 0x24880F561C0E7304, 0x26E2499D499BD9B3,
+				0x2934F0979A3715FB, 0x2B803473F7AD0F3E, 0x2DC4439B3A19BCAE, 0x30014AC62C38A865,
+				0x323775123E2E1168, 0x3466EC14FEC0A13A, 0x368FD7EE71054147, 0x38B25F5A52B6ACFB,
+				0x3ACEA7C065D41DFC, 0x3CE4D543CEA9A417, 0x3EF50AD1960D9D9C, 0x40FF6A2E5E65FCCE,
+				0x4304140358EA9960, 0x450327EA87950E77, 0x46FCC47A5740378E, 0x48F107509C9F201E,
+				0x4AE00D1CFDEB43CE, 0x4CC9F1AAD2729B20, 0x4EAECFEA80859B32, 0x508EC1FA61AAA59A,
+				0x5269E12F346E2BF7, 0x5440461C22A3E375, 0x5612089A6274CF0D, 0x57DF3FD07826BAE1,
+				0x59A802391E232F35, 0x5B6C65A9D8652766, 0x5D2C7F59381D4F1A, 0x5EE863E4D40B9026,
+				0x60A02756F9C1CB6E, 0x6253DD2C1BBE2D00, 0x64039858000B33F8, 0x65AF6B4AB2D7D7BE,
+				0x675767F54042CD99, 0x68FB9FCE38607B41, 0x6A9C23D600534DF2, 0x6C39049AF321AF5E,
+				0x6DD2523D54CB692C, 0x6F681C7319F9B6D3, 0x70FA728B868154CC, 0x72896372A4CC58D6,
+				0x7414FDB4982259CA, 0x759D4F80CBA83BF8, 0x772266ACFFD5B177, 0x78A450B83805007D,
+				0x7A231ACD89A9CAA6, 0x7B9ED1C6CEA541F5, 0x7D17822F3C195537, 0x7E8D3845DF08CD89,
+			};
+
+			// 1 / (k * ln(2) * 64^k) in Q0.64 for k >= 1, the series of log2(1 + s / 64) for s in [0, 1)
+			static constexpr std::array<uint64_t, 11> poly =
+			{
+				0, 415828534307635078, 3248660424278399, 33840212752900,
+				396564993198, 4957062415, 64545084, 864443,
+				11819, 164, 2,
+			};
+		};
+
+		// log2(m) in Q1.63 for m in [2^63, 2^64) representing [1, 2) in Q1.63.
+		// The top 6 bits of the mantissa pick a reciprocal that maps m to 1 + z with
+		// z in [0, 1/64), then log2(1 + z) is an alternating series.
+		template <int DEGREE>
+		constexpr FIXED_64_FORCEINLINE uint64_t log2_mantissa_q63(uint64_t m) noexcept
+		{
+			const auto index = (m >> 57) & 63;
+			uint128 z = uint128::mul(m, log2_lut::inv[index]);
+			z.hi -= uint64_t(1) << 62;
+			const uint64_t s = (z.hi << 8) | (z.lo >> 56);
+
+			const uint64_t p = uint128::mul(series<log2_lut, 1, DEGREE, true>::eval(s), s).hi;
+
+			return log2_lut::log[index] + (p >> 1);
+		}
+
+		template <unsigned int F, int DEGREE>
+		constexpr FIXED_64_FORCEINLINE fixed64<F> log2(fixed64<F> x) noexcept
+		{
+			using Fixed = fixed64<F>;
+			FIXED_64_ASSERT(x > Fixed(0));
+
+			const auto lz = Fixed::clz(x.raw_value());
+			const uint64_t frac = log2_mantissa_q63<DEGREE>(uint64_t(x.raw_value()) << lz);
+			const int64_t exponent = int64_t(63 - F) - lz;
+			// only above Q57 can the exponent of the smallest values leave the format
+			if (F >= 58 && exponent < 1 - (int64_t(1) << (F >= 58 ? 63 - F : 0)))
+			{
+				FIXED_64_OVERFLOW_ALERT();
+				return Fixed::from_raw(Fixed::MINIMUM);
+			}
+			return Fixed::from_raw(int64_t(uint64_t(exponent) << F) + int64_t((frac + (uint64_t(1) << (62 - F))) >> (63 - F)));
+		}
+
+		// log2(v / 2^F) in Q6.57 for a raw value v > 0, wide enough for every exponent
+		template <unsigned int F, int DEGREE>
+		constexpr FIXED_64_FORCEINLINE int64_t log2_q57(uint64_t v) noexcept
+		{
+			FIXED_64_ASSERT(v > 0);
+			const auto lz = fixed64<0>::clz(v);
+			const uint64_t frac = log2_mantissa_q63<DEGREE>(v << lz);
+			return int64_t(uint64_t(int64_t(63 - F) - lz) << 57) + int64_t((frac + 32) >> 6);
+		}
+	}
+
+	// exp(x) = 2^(x * log2(e)), the integer part of the exponent is a shift of the
+	// table result. Saturated above, 0 once the result rounds to 0.
+	template <unsigned int F, unsigned int P = F>
+	constexpr inline fixed64<F> exp(fixed64<F> x) noexcept
+	{
+		using Fixed = fixed64<F>;
+		constexpr int64_t LOG2_E = 6653256548922161246ll; // Q1.62
+		constexpr int64_t LN2 = 3196577161300663915ll; // Q1.62
+
+		// (63 - F) * ln(2) and -(F + 1) * ln(2) in Q(F), nothing rounds to 0 above Q58
+		constexpr int64_t UPPER = internal::scale_q62(63 - F, LN2, 62 - F);
+		constexpr int64_t LOWER = F >= 58 ? Fixed::MINIMUM : -internal::scale_q62(F + 1, LN2, 62 - F);
+		if (x.raw_value() >= UPPER)
+		{
+			FIXED_64_OVERFLOW_ALERT();
+			return Fixed::from_raw(Fixed::MAXIMUM);
+		}
+		if (x.raw_value() < LOWER)
+			return Fixed::from_raw(0);
+
+		// exponent in Q6.57, floored so the fraction is never negative
+		const int64_t y = internal::mul_shift(x.raw_value(), LOG2_E, F + 5);
+		return internal::exp2_scale<F, internal::exp2_degree<P>()>(y >> 57, uint64_t(y) << 7);
+	}
+
+	// 2^x to the precision of the format, saturated above
+	template <unsigned int F, unsigned int P = F>
+	constexpr inline fixed64<F> exp2(fixed64<F> x) noexcept
+	{
+		return internal::exp2<F, internal::exp2_degree<P>()>(x);
+	}
+
+	// log2(x) to the precision of the format
+	template <unsigned int F, unsigned int P = F>
+	constexpr inline fixed64<F> log2(fixed64<F> x) noexcept
+	{
+		return internal::log2<F, internal::log2_degree<P>()>(x);
+	}
+
+	// log(x) = log2(x) * ln(2), a multiply by the constant in place of a division.
+	// Above Q57 the last F - 57 bits are not computed.
+	template <unsigned int F, unsigned int P = F>
+	constexpr inline fixed64<F> log(fixed64<F> x) noexcept
+	{
+		FIXED_64_ASSERT(x > fixed64<F>(0));
+		constexpr int64_t LN2 = 6393154322601327830ll; // Q0.63
+		const int64_t l = internal::log2_q57<F, internal::log2_degree<P>()>(uint64_t(x.raw_value()));
+		return internal::from_q<F, 57>(internal::mul_shift(l, LN2, 63));
+	}
+
+	template <unsigned int F, unsigned int P = F>
+	constexpr inline fixed64<F> log10(fixed64<F> x) noexcept
+	{
+		FIXED_64_ASSERT(x > fixed64<F>(0));
+		constexpr int64_t LOG10_2 = 2776511644261678566ll; // Q0.63
+		const int64_t l = internal::log2_q57<F, internal::log2_degree<P>()>(uint64_t(x.raw_value()));
+		return internal::from_q<F, 57>(internal::mul_shift(l, LOG10_2, 63));
+	}
+
+	// log(1 + x) for x > -1. For |x| < 1/64 the series runs on x itself in Q0.64,
+	// alternating above 0 and all positive below, elsewhere 1 + x is exact.
+	template <unsigned int F, unsigned int P = F>
+	constexpr inline fixed64<F> log1p(fixed64<F> x) noexcept
+	{
+		using Fixed = fixed64<F>;
+		FIXED_64_ASSERT(x > Fixed(-1));
+		constexpr int DEGREE = internal::log2_degree<P>();
+		constexpr uint64_t LN2 = 12786308645202655660ull; // Q0.64
+
+		const int64_t v = x.raw_value();
+		const uint64_t a = v >= 0 ? uint64_t(v) : uint64_t(0) - uint64_t(v);
+		if (F > 6 && a < (uint64_t(1) << (F > 6 ? F - 6 : 0)))
+		{
+			// s = 64 * |x| in Q0.64
+			const uint64_t s = a << (F > 6 ? 70 - F : 0);
+			const uint64_t p = v >= 0
+				? uint128::mul(internal::series<internal::log2_lut, 1, DEGREE, true>::eval(s), s).hi
+				: uint128::mul(internal::series<internal::log2_lut, 1, DEGREE, false>::eval(s), s).hi;
+			const uint64_t r = uint128::mul(p, LN2).hi;
+			const int64_t raw = int64_t((r + (uint64_t(1) << (63 - F))) >> (64 - F));
+			return Fixed::from_raw(v >= 0 ? raw : -raw);
+		}
+
+		constexpr int64_t LN2_Q63 = 6393154322601327830ll;
+		const int64_t l = internal::log2_q57<F, DEGREE>(uint64_t(v) + (uint64_t(1) << F));
+		return internal::from_q<F, 57>(internal::mul_shift(l, LN2_Q63, 63));
+	}
+
+	// exp(x) - 1. For |x| < ln(2)/64 the series of exp2 runs on x itself in Q0.64,
+	// elsewhere subtracting 1 from exp(x) is exact.
+	template <unsigned int F, unsigned int P = F>
+	constexpr inline fixed64<F> expm1(fixed64<F> x) noexcept
+	{
+		using Fixed = fixed64<F>;
+		constexpr int DEGREE = internal::exp2_degree<P>();
+		constexpr uint64_t LN2 = 12786308645202655660ull; // Q0.64
+		constexpr uint64_t INV_LN2 = 13306513097844322492ull; // 64 / ln(2) in Q7.57
+
+		const int64_t v = x.raw_value();
+		const uint64_t a = v >= 0 ? uint64_t(v) : uint64_t(0) - uint64_t(v);
+		if (F > 6 && a < (LN2 >> (F > 6 ? 70 - F : 0)))
+		{
+			// s = 64 * |x| / ln(2) in Q0.64
+			const uint64_t s = (uint128::mul(a << (F > 6 ? 64 - F : 0), INV_LN2) >> 57).lo;
+			const uint64_t p = v >= 0
+				? uint128::mul(internal::series<internal::exp2_lut, 1, DEGREE, false>::eval(s), s).hi
+				: uint128::mul(internal::series<internal::exp2_lut, 1, DEGREE, true>::eval(s), s).hi;
+			const int64_t raw = int64_t((p + (uint64_t(1) << (63 - F))) >> (64 - F));
+			return Fixed::from_raw(v >= 0 ? raw : -raw);
+		}
+		return Fixed::from_raw(exp<F, P>(x).raw_value() - (int64_t(1) << F));
+	}
+
+	namespace internal
+	{
+		struct recip_lut
+		{
+			// 1/m in Q1.31 for m in [1, 2], 64 entries per unit
+			static constexpr std::array<uint32_t, 65> lut =
+			{
+				0x80000000, 0x7E07E07E, 0x7C1F07C2, 0x7A44C6B0, 0x78787878, 0x76B981DB, 0x75075075, 0x73615A24,
+				0x71C71C72, 0x70381C0E, 0x6EB3E453, 0x6D3A06D4, 0x6BCA1AF3, 0x6A63BD82, 0x69069069, 0x67B23A54,
+				0x66666666, 0x6522C3F3, 0x63E7063E, 0x62B2E43E, 0x61861862, 0x60606060, 0x5F417D06, 0x5E293206,
+				0x5D1745D1, 0x5C0B8170, 0x5B05B05B, 0x5A05A05A, 0x590B2164, 0x58160581, 0x572620AE, 0x563B48C2,
+				0x55555555, 0x54741FAC, 0x5397829D, 0x52BF5A81, 0x51EB851F, 0x511BE196, 0x50505050, 0x4F88B2F4,
+				0x4EC4EC4F, 0x4E04E04E, 0x4D4873ED, 0x4C8F8D29, 0x4BDA12F7, 0x4B27ED36, 0x4A7904A8, 0x49CD42E2,
+				0x49249249, 0x487EDE05, 0x47DC11F7, 0x473C1AB7, 0x469EE584, 0x46046046, 0x456C797E, 0x44D72045,
+				0x44444444, 0x43B3D5B0, 0x4325C53F, 0x429A042A, 0x42108421, 0x4189374C, 0x41041041, 0x40810204,
+				0x40000000,
+			};
+		};
+
+		// 1/m in Q2.62 for m in [2^63, 2^64) representing [1, 2) in Q1.63.
+		// Within 2 ulp, used in place of a long division.
+		constexpr inline uint64_t recip_q62(uint64_t m) noexcept
+		{
+			// linearly interpolated seed, ~14 bits
+			const auto index = (m >> 57) - 64;
+			const uint64_t frac = (m >> 25) & 0xFFFF'FFFF;
+			uint64_t y = recip_lut::lut[index] - (((recip_lut::lut[index] - recip_lut::lut[index + 1]) * frac) >> 32);
+
+			// one Newton-Raphson step in 64-bit, y' = y * (2 - m * y)
+			const uint64_t t_31 = ((m >> 32) * y) >> 31;
+			y = (y * ((uint64_t(2) << 31) - t_31)) >> 31;
+
+			// last step in 128-bit with the second order term, y' = y + y * (e + e^2), e = 1 - m * y
+			y <<= 31;
+			const int64_t e = int64_t(((uint128{ uint64_t(1) << 61, 0 } - uint128::mul(m, y)) >> 61).lo);
+			return y + mul_shift(int64_t(y), e + mul_shift(e, e, 64), 64);
+		}
+
+		struct rsqrt_lut
+		{
+			// 1/sqrt(m) in Q1.31 for m in [1, 4], 64 entries per unit
+			static constexpr std::array<uint32_t, 193> lut =
+			{
+				0x80000000, 0x7F02F623, 0x7E0BB221, 0x7D19FCA0, 0x7C2DA123, 0x7B466DD8, 0x7A64336B, 0x7986C4E4,
+				0x78ADF778, 0x77D9A26E, 0x77099EFB, 0x763DC824, 0x7575FAA4, 0x74B214D4, 0x73F1F68D, 0x73358118,
+				0x727C9717, 0x71C71C72, 0x7114F644, 0x70660ACC, 0x6FBA415C, 0x6F11824C, 0x6E6BB6E9, 0x6DC8C96E,
+				0x6D28A4F0, 0x6C8B355B, 0x6BF06762, 0x6B582874, 0x6AC266BA, 0x6A2F1107, 0x699E16D0, 0x690F682B,
+				0x6882F5C0, 0x67F8B0C5, 0x67708AF9, 0x66EA769B, 0x66666666, 0x65E44D8C, 0x65641FAE, 0x64E5D0DA,
+				0x64695585, 0x63EEA287, 0x6375AD16, 0x62FE6AC2, 0x6288D173, 0x6214D764, 0x61A27320, 0x61319B7C,
+				0x60C2479B, 0x60546EE2, 0x5FE808FC, 0x5F7D0DD6, 0x5F137599, 0x5EAB38AC, 0x5E444FAF, 0x5DDEB37A,
+				0x5D7A5D1B, 0x5D1745D1, 0x5CB56711, 0x5C54BA7D, 0x5BF539E5, 0x5B96DF46, 0x5B39A4C7, 0x5ADD84BB,
+				0x5A82799A, 0x5A287E03, 0x59CF8CBC, 0x5977A0AC, 0x5920B4DF, 0x58CAC480, 0x5875CADE, 0x5821C364,
+				0x57CEA99D, 0x577C7930, 0x572B2DE0, 0x56DAC38E, 0x568B3632, 0x563C81E0, 0x55EEA2C4, 0x55A19522,
+				0x55555555, 0x5509DFD0, 0x54BF311A, 0x547545D0, 0x542C1AA4, 0x53E3AC5B, 0x539BF7CD, 0x5354F9E7,
+				0x530EAFA5, 0x52C91618, 0x52842A5F, 0x523FE9AC, 0x51FC5140, 0x51B95E6B, 0x51770E8F, 0x51355F1A,
+				0x50F44D89, 0x50B3D768, 0x5073FA50, 0x5034B3E7, 0x4FF601E0, 0x4FB7E1FA, 0x4F7A5202, 0x4F3D4FCF,
+				0x4F00D944, 0x4EC4EC4F, 0x4E8986EA, 0x4E4EA718, 0x4E144AE9, 0x4DDA7073, 0x4DA115DA, 0x4D683948,
+				0x4D2FD8F4, 0x4CF7F31B, 0x4CC08605, 0x4C899000, 0x4C530F65, 0x4C1D0294, 0x4BE767F5, 0x4BB23DF9,
+				0x4B7D8317, 0x4B4935CF, 0x4B1554A6, 0x4AE1DE2A, 0x4AAED0F0, 0x4A7C2B93, 0x4A49ECB3, 0x4A1812FA,
+				0x49E69D16, 0x49B589BB, 0x4984D7A4, 0x49548592, 0x49249249, 0x48F4FC97, 0x48C5C34B, 0x4896E53D,
+				0x48686148, 0x483A364D, 0x480C6332, 0x47DEE6E1, 0x47B1C049, 0x4784EE60, 0x4758701C, 0x472C447C,
+				0x47006A81, 0x46D4E130, 0x46A9A794, 0x467EBCBA, 0x46541FB4, 0x4629CF98, 0x45FFCB80, 0x45D6128A,
+				0x45ACA3D5, 0x45837E88, 0x455AA1CB, 0x45320CC8, 0x4509BEB0, 0x44E1B6B4, 0x44B9F40B, 0x449275ED,
+				0x446B3B96, 0x44444444, 0x441D8F3B, 0x43F71BBF, 0x43D0E917, 0x43AAF68F, 0x43854374, 0x435FCF15,
+				0x433A98C6, 0x43159FDC, 0x42F0E3AE, 0x42CC6398, 0x42A81EF6, 0x42841527, 0x4260458E, 0x423CAF8D,
+				0x4219528B, 0x41F62DF2, 0x41D3412A, 0x41B08BA2, 0x418E0CC8, 0x416BC40D, 0x4149B0E5, 0x4127D2C3,
+				0x41062920, 0x40E4B374, 0x40C3713B, 0x40A261EF, 0x40818512, 0x4060DA22, 0x404060A1, 0x40201814,
+				0x40000000,
+			};
+		};
+
+		// 1/sqrt(m) in Q2.62 for m in [2^62, 2^64) representing [1, 4) in Q2.62.
+		// Relative error is below 2^-58.
+		constexpr inline uint64_t rsqrt_q62(uint64_t m) noexcept
+		{
+			// linearly interpolated seed, ~15 bits
+			const auto index = (m >> 56) - 64;
+			const uint64_t frac = (m >> 24) & 0xFFFF'FFFF;
+			uint64_t y = rsqrt_lut::lut[index] - (((rsqrt_lut::lut[index] - rsqrt_lut::lut[index + 1]) * frac) >> 32);
+
+			// one Newton-Raphson step in 64-bit, y' = y * (3 - m * y^2) / 2
+			const uint64_t m30 = m >> 32;
+			const uint64_t y2_31 = (y * y) >> 31;
+			const uint64_t t_31 = (m30 * y2_31) >> 30;
+			y = (y * ((uint64_t(3) << 31) - t_31)) >> 32;
+
+			// last step in 128-bit, y' = y + y * (1 - m * y^2) / 2
+			y <<= 31;
+			const uint64_t yy = (uint128::mul(y, y) >> 62).lo;
+			const uint64_t t = (uint128::mul(m, yy) >> 62).lo;
+			const int64_t e = int64_t((uint64_t(1) << 62) - t);
+			return y + mul_shift(int64_t(y), e, 63);
+		}
+	}
+
+	// Reciprocal square root, 1 / sqrt(v).
+	// At most 1 ulp off while the raw result is below 2^57,
+	// the relative error stays below 2^-58 above that.
+	template<unsigned int F>
+	constexpr inline fixed64<F> rsqrt(fixed64<F> v) noexcept
+	{
+		using Fixed = fixed64<F>;
+		FIXED_64_ASSERT(v > Fixed(0) && "rsqrt input should be positive");
+
+		if (v.raw_value() <= 0)
+		{
+			return Fixed::from_raw(Fixed::MAXIMUM);
+		}
+
+		// normalize to m in [1, 4) with an exponent parity that makes the root exact
+		const uint64_t n = v.raw_value();
+		long shift = Fixed::clz(n);
+		if ((shift ^ F) & 1)
+			shift--;
+		const uint64_t y = internal::rsqrt_q62(n << shift);
+
+		// v = m * 2^(62 - shift - F), result = 1/sqrt(m) * 2^((3F + shift - 62) / 2)
+		const long exponent = (long(3 * F) + shift - 62) / 2;
+		if (exponent > 62)
+		{
+			const long up = exponent - 62;
+			if (up >= 63 || y > (uint64_t(Fixed::MAXIMUM) >> up))
+			{
+				FIXED_64_OVERFLOW_ALERT();
+				return Fixed::from_raw(Fixed::MAXIMUM);
+			}
+			return Fixed::from_raw(int64_t(y << up));
+		}
+
+		const long down = 62 - exponent;
+		if (down >= 64)
+			return Fixed::from_raw(0);
+		if (down == 0)
+			return Fixed::from_raw(int64_t(y));
+		return Fixed::from_raw(int64_t((y + (uint64_t(1) << (down - 1))) >> down));
+	}
+
+	namespace internal
+	{
+		// a *= b for mantissas in [2^63, 2^64) with exponents, |v| = m * 2^(e - 63).
+		// The product keeps its top 64 bits, the exponent is held in [-2^20, 2^20]
+		// which is far past anything that still fits the format.
+		constexpr FIXED_64_FORCEINLINE void mul_q63(uint64_t& am, int64_t& ae, uint64_t bm, int64_t be) noexcept
+		{
+			constexpr int64_t LIMIT = int64_t(1) << 20;
+			const uint128 p = uint128::mul(am, bm);
+			const uint64_t carry = p.hi >> 63;
+			am = carry ? p.hi : (p.hi << 1) | (p.lo >> 63);
+			ae += be + int64_t(carry);
+			ae = ae > LIMIT ? LIMIT : ae < -LIMIT ? -LIMIT : ae;
+		}
+
+		// m * 2^(e - 63) in Q(F) for m in [2^63, 2^64), rounded and saturated
+		template <unsigned int F>
+		constexpr FIXED_64_FORCEINLINE fixed64<F> from_q63(uint64_t m, int64_t e) noexcept
+		{
+			using Fixed = fixed64<F>;
+			const int64_t shift = int64_t(63 - F) - e;
+			if (shift > 64)
+				return Fixed::from_raw(0);
+			if (shift == 64)
+				return Fixed::from_raw(1);
+
+			const uint64_t r = shift <= 0 ? ~uint64_t(0) : (m >> shift) + ((m >> (shift - 1)) & 1);
+			if (r > uint64_t(Fixed::MAXIMUM))
+			{
+				FIXED_64_OVERFLOW_ALERT();
+				return Fixed::from_raw(Fixed::MAXIMUM);
+			}
+			return Fixed::from_raw(int64_t(r));
+		}
+	}
+
+	// base^exp by square and multiply on a normalized 64-bit mantissa, one
+	// rounding at the end. A negative exponent takes the positive power and a
+	// single reciprocal. The relative error stays below (2 log2|exp| + 2) * 2^-63.
+	template <unsigned int F, class T, typename std::enable_if<std::is_integral<T>::value>::type* = nullptr>
+	constexpr inline fixed64<F> pow(fixed64<F> base, T exp) noexcept
+	{
+		using Fixed = fixed64<F>;
+
+		if (base == Fixed(0)) {
+			FIXED_64_ASSERT(exp > 0);
+			return Fixed(0);
+		}
+
+		const bool negative_exp = exp < 0;
+		uint64_t n = negative_exp ? uint64_t(0) - uint64_t(exp) : uint64_t(exp);
+		if (n == 0)
+			return Fixed(1);
+		if (n == 1)
+			return negative_exp ? 1 / base : base;
+		if (n == 2 && !negative_exp)
+			return base * base;
+
+		const bool negative = base.raw_value() < 0 && (n & 1);
+
+		const uint64_t a = base.raw_value() < 0 ? uint64_t(0) - uint64_t(base.raw_value()) : uint64_t(base.raw_value());
+		const auto lz = Fixed::clz(a);
+		uint64_t m = a << lz;
+		int64_t e = int64_t(63 - F) - lz;
+
+		uint64_t rm = uint64_t(1) << 63;
+		int64_t re = 0;
+		for (;;)
+		{
+			if (n & 1)
+				internal::mul_q63(rm, re, m, e);
+			n >>= 1;
+			if (n == 0)
+				break;
+			internal::mul_q63(m, e, m, e);
+		}
+
+		if (negative_exp)
+		{
+			// 1 / (m * 2^(e - 63)) with the reciprocal in (2^61, 2^62]
+			const uint64_t r = internal::recip_q62(rm);
+			const auto rz = Fixed::clz(r);
+			rm = r << rz;
+			re = 1 - rz - re;
+		}
+
+		const Fixed result = internal::from_q63<F>(rm, re);
+		return negative ? -result : result;
+	}
+
+	// base^exp for base > 0 as 2^(exp * log2(base)). The logarithm is carried in
+	// Q6.57 into the exp2 kernel so the product does not round at the output
+	// format. Integer exponents and +-0.5 take the integer, root and reciprocal
+	// root paths.
+	template <unsigned int F, unsigned int P = F>
+	constexpr inline fixed64<F> pow(fixed64<F> base, fixed64<F> exp) noexcept
+	{
+		using Fixed = fixed64<F>;
+
+		if (base == Fixed(0)) {
+			FIXED_64_ASSERT(exp > Fixed(0));
+			return Fixed(0);
+		}
+
+		constexpr auto FRAC = Fixed::FRACTION;
+		if (exp.raw_value() % FRAC == 0)
+		{
+			return pow(base, exp.raw_value() / FRAC);
+		}
+
+		FIXED_64_ASSERT(base > Fixed(0));
+
+		constexpr int64_t HALF = int64_t(1) << (F == 0 ? 0 : F - 1);
+		if (exp.raw_value() == HALF)
+			return sqrt_wide<F>(uint128{ 0, uint64_t(base.raw_value()) } << F);
+		if (exp.raw_value() == -HALF)
+			return rsqrt(base);
+
+		// full degree kernels unless a lower tier is asked for, the exponent scales
+		// any error of the logarithm
+		constexpr unsigned int WIDE = P < F ? P : 63;
+		const int64_t l = internal::log2_q57<F, internal::log2_degree<WIDE>()>(uint64_t(base.raw_value()));
+		const bool negative = (l < 0) != (exp.raw_value() < 0);
+		const uint64_t al = l < 0 ? uint64_t(0) - uint64_t(l) : uint64_t(l);
+		const uint64_t ae = exp.raw_value() < 0 ? uint64_t(0) - uint64_t(exp.raw_value()) : uint64_t(exp.raw_value());
+		const uint128 p = uint128::mul(al, ae) >> F;
+
+		// 63 - F and F + 1 in Q6.57, as for exp2
+		constexpr uint64_t UPPER = uint64_t(63 - F) << 57;
+		constexpr uint64_t LOWER = uint64_t(F + 1) << 57;
+		if (!negative && (p.hi != 0 || p.lo >= UPPER))
+		{
+			FIXED_64_OVERFLOW_ALERT();
+			return Fixed::from_raw(Fixed::MAXIMUM);
+		}
+		if (negative && (p.hi != 0 || p.lo > LOWER))
+			return Fixed::from_raw(0);
+
+		const int64_t y = negative ? -int64_t(p.lo) : int64_t(p.lo);
+		return internal::exp2_scale<F, internal::exp2_degree<WIDE>()>(y >> 57, uint64_t(y) << 7);
+	}
+
+	namespace internal
+	{
+		struct sinh_lut
+		{
+			// 1 / ((2k + 1)! * 256^k) in Q0.64, sinh(x) / x as a series in (16x)^2
+			static constexpr std::array<uint64_t, 5> poly =
+			{
+				0, 12009599006321323, 2345624805922, 218157069, 11836,
+			};
+		};
+
+		struct tanh_lut
+		{
+			// |tanh coefficient k| / 256^k in Q0.64, tanh(x) / x as a series in (16x)^2
+			static constexpr std::array<uint64_t, 7> poly =
+			{
+				0, 24019198012642645, 37529996894754, 59338722769, 93928738, 148700, 235,
+			};
+		};
+
+		// degrees that keep the series for |x| < 1/16 within a quarter ulp
+		template <unsigned int F>
+		constexpr int sinh_degree() noexcept
+		{
+			return F <= 24 ? 1 : F <= 38 ? 2 : F <= 52 ? 3 : 4;
+		}
+
+		template <unsigned int F>
+		constexpr int tanh_degree() noexcept
+		{
+			return F <= 20 ? 1 : F <= 30 ? 2 : F <= 39 ? 3 : F <= 48 ? 4 : F <= 58 ? 5 : 6;
+		}
+
+		// x in Q0.64 to Q(F), rounded
+		template <unsigned int F>
+		constexpr FIXED_64_FORCEINLINE int64_t from_q64(uint64_t v) noexcept
+		{
+			return int64_t((v + (uint64_t(1) << (F == 0 ? 0 : 63 - F))) >> (F == 0 ? 63 : 64 - F));
+		}
+
+		// e^a for a raw a in [0, (64 - F) * ln(2)) as t * 2^(n - 62) with t in [2^62, 2^63),
+		// and e^-a as r * 2^(-n - 62) with r in (2^61, 2^62], one exp2 kernel and one reciprocal
+		template <unsigned int F, unsigned int P>
+		constexpr FIXED_64_FORCEINLINE int64_t exp_pair_q62(uint64_t a, uint64_t* t, uint64_t* r) noexcept
+		{
+			constexpr int64_t LOG2_E = 6653256548922161246ll; // Q1.62
+			const int64_t y = mul_shift(int64_t(a), LOG2_E, F + 5);
+			int64_t n = y >> 57;
+			uint64_t v = exp2_frac_q62<exp2_degree<P>()>(uint64_t(y) << 7);
+			if (v >> 63)
+			{
+				v >>= 1;
+				++n;
+			}
+			*t = v;
+			*r = recip_q62(v << 1);
+			return n;
+		}
+
+		// (e^a +- e^-a) / 2 in Q(F) from exp_pair_q62
+		template <unsigned int F, bool SUM>
+		constexpr FIXED_64_FORCEINLINE fixed64<F> exp_pair_half(int64_t n, uint64_t t, uint64_t r) noexcept
+		{
+			const uint64_t tail = 2 * n >= 64 ? 0 : r >> (2 * n);
+			const uint64_t v = SUM ? t + tail : t - tail;
+			if (v == 0)
+				return fixed64<F>::from_raw(0);
+			const auto lz = fixed64<0>::clz(v);
+			return from_q63<F>(v << lz, n - lz);
+		}
+
+		// sinh(a) in Q(F) for a raw a < 2^(F - 4), the odd series with no cancellation
+		template <unsigned int F, unsigned int P>
+		constexpr FIXED_64_FORCEINLINE int64_t sinh_small(uint64_t a) noexcept
+		{
+			const uint64_t x = a << (F > 4 ? 64 - F : 0);
+			const uint64_t s = uint128::mul(x << 4, x << 4).hi;
+			const uint64_t p = uint128::mul(series<sinh_lut, 1, sinh_degree<P>(), false>::eval(s), s).hi;
+			return from_q64<F>(x + uint128::mul(x, p).hi);
+		}
+
+		// ln(2) * (64 - F) in Q(F), where cosh and |sinh| pass the largest value
+		template <unsigned int F>
+		constexpr int64_t hyperbolic_upper() noexcept
+		{
+			return scale_q62(64 - F, 3196577161300663915ll, 62 - F);
+		}
+	}
+
+	// Hyperbolic functions on a single exp2 kernel evaluation, e^-x is the
+	// reciprocal of e^x. sinh and tanh run an odd series below |x| = 1/16 so
+	// nothing cancels, tanh is exactly +-1 once 1 - tanh drops below half an ulp.
+	template <unsigned int F, unsigned int P = F>
+	constexpr inline fixed64<F> sinh(fixed64<F> x) noexcept
+	{
+		using Fixed = fixed64<F>;
+		const int64_t v = x.raw_value();
+		const uint64_t a = v >= 0 ? uint64_t(v) : uint64_t(0) - uint64_t(v);
+		if (F > 4 && a < (uint64_t(1) << (F > 4 ? F - 4 : 0)))
+		{
+			const int64_t raw = internal::sinh_small<F, P>(a);
+			return Fixed::from_raw(v >= 0 ? raw : -raw);
+		}
+		if (a >= uint64_t(internal::hyperbolic_upper<F>()))
+		{
+			FIXED_64_OVERFLOW_ALERT();
+			return Fixed::from_raw(v >= 0 ? Fixed::MAXIMUM : -Fixed::MAXIMUM);
+		}
+
+		uint64_t t = 0, r = 0;
+		const int64_t n = internal::exp_pair_q62<F, P>(a, &t, &r);
+		const Fixed result = internal::exp_pair_half<F, false>(n, t, r);
+		return v >= 0 ? result : -result;
+	}
+
+	template <unsigned int F, unsigned int P = F>
+	constexpr inline fixed64<F> cosh(fixed64<F> x) noexcept
+	{
+		using Fixed = fixed64<F>;
+		const int64_t v = x.raw_value();
+		const uint64_t a = v >= 0 ? uint64_t(v) : uint64_t(0) - uint64_t(v);
+		if (a >= uint64_t(internal::hyperbolic_upper<F>()))
+		{
+			FIXED_64_OVERFLOW_ALERT();
+			return Fixed::from_raw(Fixed::MAXIMUM);
+		}
+
+		uint64_t t = 0, r = 0;
+		const int64_t n = internal::exp_pair_q62<F, P>(a, &t, &r);
+		return internal::exp_pair_half<F, true>(n, t, r);
+	}
+
+	template <unsigned int F, unsigned int P = F>
+	constexpr inline void sinhcosh(fixed64<F> x, fixed64<F>* s, fixed64<F>* c) noexcept
+	{
+		using Fixed = fixed64<F>;
+		const int64_t v = x.raw_value();
+		const uint64_t a = v >= 0 ? uint64_t(v) : uint64_t(0) - uint64_t(v);
+		if (a >= uint64_t(internal::hyperbolic_upper<F>()))
+		{
+			FIXED_64_OVERFLOW_ALERT();
+			*s = Fixed::from_raw(v >= 0 ? Fixed::MAXIMUM : -Fixed::MAXIMUM);
+			*c = Fixed::from_raw(Fixed::MAXIMUM);
+			return;
+		}
+
+		uint64_t t = 0, r = 0;
+		const int64_t n = internal::exp_pair_q62<F, P>(a, &t, &r);
+		const Fixed sv = F > 4 && a < (uint64_t(1) << (F > 4 ? F - 4 : 0))
+			? Fixed::from_raw(internal::sinh_small<F, P>(a))
+			: internal::exp_pair_half<F, false>(n, t, r);
+		*s = v >= 0 ? sv : -sv;
+		*c = internal::exp_pair_half<F, true>(n, t, r);
+	}
+
+	// tanh(x) = (1 - u) / (1 + u) with u = e^(-2|x|) from one exp2 kernel evaluation
+	template <unsigned int F, unsigned int P = F>
+	constexpr inline fixed64<F> tanh(fixed64<F> x) noexcept
+	{
+		using Fixed = fixed64<F>;
+		constexpr int64_t LOG2_E = 6653256548922161246ll; // Q1.62
+		// (F + 2) * ln(2) / 2 in Q(F), where 1 - tanh falls below a quarter ulp
+		constexpr int64_t LIMIT = F >= 59 ? Fixed::MAXIMUM : internal::scale_q62(F + 2, 3196577161300663915ll, 63 - F);
+
+		const int64_t v = x.raw_value();
+		const uint64_t a = v >= 0 ? uint64_t(v) : uint64_t(0) - uint64_t(v);
+		int64_t raw = 0;
+		if (F > 4 && a < (uint64_t(1) << (F > 4 ? F - 4 : 0)))
+		{
+			const uint64_t q = a << (F > 4 ? 64 - F : 0);
+			const uint64_t s = uint128::mul(q << 4, q << 4).hi;
+			const uint64_t p = uint128::mul(internal::series<internal::tanh_lut, 1, internal::tanh_degree<P>(), true>::eval(s), s).hi;
+			raw = internal::from_q64<F>(q - uint128::mul(q, p).hi);
+		}
+		else if (a >= uint64_t(LIMIT))
+		{
+			raw = internal::from_q62<F>(int64_t(1) << 62).raw_value();
+		}
+		else
+		{
+			// -2|x| * log2(e) in Q6.57, floored
+			const int64_t y = -internal::mul_shift(int64_t(a), LOG2_E, F + 4);
+			const int64_t shift = -(y >> 57);
+			const uint64_t e = internal::exp2_frac_q62<internal::exp2_degree<P>()>(uint64_t(y) << 7);
+			const uint64_t u = shift >= 63 ? 0 : e >> shift;
+
+			constexpr uint64_t ONE = uint64_t(1) << 62;
+			const uint64_t q = (uint128::mul(ONE - u, internal::recip_q62((ONE + u) << 1)) >> 62).lo;
+			raw = internal::from_q62<F>(int64_t(q)).raw_value();
+		}
+		return Fixed::from_raw(v >= 0 ? raw : -raw);
+	}
+
+	namespace internal
+	{
+		struct rcbrt_lut
+		{
+			// 1/cbrt(m) in Q1.31 for m in [1, 8], 64 entries per unit
+			static constexpr std::array<uint32_t, 449> lut =
+			{
+				0x80000000, 0x7F5716FC, 0x7EB19BFC, 0x7E0F7046, 0x7D7076A0, 0x7CD4933F, 0x7C3BABAA, 0x7BA5A6AA,
+				0x7B126C30, 0x7A81E54D, 0x79F3FC18, 0x79689BA2, 0x78DFAFEC, 0x785925D1, 0x77D4EB02, 0x7752EDF3,
+				0x76D31DD8, 0x76556A94, 0x75D9C4B2, 0x75601D5F, 0x74E8665D, 0x747291FF, 0x73FE931E, 0x738C5D18,
+				0x731BE3C3, 0x72AD1B6C, 0x723FF8CD, 0x71D4710D, 0x716A79B5, 0x710208B2, 0x709B1448, 0x70359318,
+				0x6FD17C13, 0x6F6EC67B, 0x6F0D69DF, 0x6EAD5E15, 0x6E4E9B3B, 0x6DF119B2, 0x6D94D218, 0x6D39BD4D,
+				0x6CDFD468, 0x6C8710B9, 0x6C2F6BC6, 0x6BD8DF4B, 0x6B836533, 0x6B2EF799, 0x6ADB90C8, 0x6A892B35,
+				0x6A37C17F, 0x69E74E70, 0x6997CCF7, 0x69493829, 0x68FB8B41, 0x68AEC19B, 0x6862D6B6, 0x6817C630,
+				0x67CD8BC7, 0x67842357, 0x673B88D9, 0x66F3B862, 0x66ACAE23, 0x66666666, 0x6620DD8F, 0x65DC1018,
+				0x6597FA95, 0x655499B1, 0x6511EA2A, 0x64CFE8D7, 0x648E92A2, 0x644DE486, 0x640DDB96, 0x63CE74F5,
+				0x638FADD8, 0x63518386, 0x6313F356, 0x62D6FAB1, 0x629A970E, 0x625EC5F5, 0x622384FC, 0x61E8D1C7,
+				0x61AEAA09, 0x61750B82, 0x613BF400, 0x6103615C, 0x60CB517C, 0x6093C255, 0x605CB1E3, 0x60261E31,
+				0x5FF00553, 0x5FBA6569, 0x5F853C9C, 0x5F508920, 0x5F1C4934, 0x5EE87B1E, 0x5EB51D30, 0x5E822DC2,
+				0x5E4FAB38, 0x5E1D93FD, 0x5DEBE685, 0x5DBAA14A, 0x5D89C2D1, 0x5D5949A5, 0x5D293458, 0x5CF98185,
+				0x5CCA2FCC, 0x5C9B3DD6, 0x5C6CAA52, 0x5C3E73F6, 0x5C10997C, 0x5BE319A7, 0x5BB5F340, 0x5B892514,
+				0x5B5CADF7, 0x5B308CC4, 0x5B04C059, 0x5AD9479B, 0x5AAE2173, 0x5A834CD1, 0x5A58C8A9, 0x5A2E93F3,
+				0x5A04ADAC, 0x59DB14D9, 0x59B1C87E, 0x5988C7A7, 0x59601165, 0x5937A4CB, 0x590F80F0, 0x58E7A4F1,
+				0x58C00FEF, 0x5898C10C, 0x5871B771, 0x584AF24A, 0x582470C4, 0x57FE3213, 0x57D8356D, 0x57B27A0B,
+				0x578CFF2A, 0x5767C409, 0x5742C7ED, 0x571E0A1B, 0x56F989DD, 0x56D5467F, 0x56B13F50, 0x568D73A2,
+				0x5669E2CA, 0x56468C20, 0x56236EFD, 0x56008AC0, 0x55DDDEC6, 0x55BB6A73, 0x55992D2A, 0x55772652,
+				0x55555555, 0x5533B99F, 0x5512529C, 0x54F11FBD, 0x54D02074, 0x54AF5436, 0x548EBA78, 0x546E52B5,
+				0x544E1C65, 0x542E1706, 0x540E4216, 0x53EE9D15, 0x53CF2786, 0x53AFE0EC, 0x5390C8CE, 0x5371DEB4,
+				0x53532225, 0x533492AF, 0x53162FDC, 0x52F7F93D, 0x52D9EE5F, 0x52BC0ED7, 0x529E5A35, 0x5280D00F,
+				0x52636FFC, 0x52463992, 0x52292C6B, 0x520C4820, 0x51EF8C4F, 0x51D2F894, 0x51B68C8D, 0x519A47DB,
+				0x517E2A1E, 0x516232FA, 0x51466211, 0x512AB708, 0x510F3187, 0x50F3D133, 0x50D895B6, 0x50BD7EB9,
+				0x50A28BE6, 0x5087BCEA, 0x506D1172, 0x5052892B, 0x503823C4, 0x501DE0EE, 0x5003C05A, 0x4FE9C1BA,
+				0x4FCFE4C0, 0x4FB62921, 0x4F9C8E92, 0x4F8314C9, 0x4F69BB7D, 0x4F508265, 0x4F37693B, 0x4F1E6FB7,
+				0x4F059594, 0x4EECDA8E, 0x4ED43E5F, 0x4EBBC0C7, 0x4EA36181, 0x4E8B204D, 0x4E72FCEA, 0x4E5AF718,
+				0x4E430E98, 0x4E2B432B, 0x4E139495, 0x4DFC0297, 0x4DE48CF5, 0x4DCD3375, 0x4DB5F5DB, 0x4D9ED3ED,
+				0x4D87CD73, 0x4D70E231, 0x4D5A11F2, 0x4D435C7D, 0x4D2CC19C, 0x4D164117, 0x4CFFDABB, 0x4CE98E50,
+				0x4CD35BA4, 0x4CBD4282, 0x4CA742B7, 0x4C915C11, 0x4C7B8E5C, 0x4C65D969, 0x4C503D05, 0x4C3AB900,
+				0x4C254D2A, 0x4C0FF955, 0x4BFABD50, 0x4BE598EE, 0x4BD08C00, 0x4BBB965A, 0x4BA6B7CD, 0x4B91F02F,
+				0x4B7D3F53, 0x4B68A50E, 0x4B542134, 0x4B3FB39A, 0x4B2B5C18, 0x4B171A83, 0x4B02EEB1, 0x4AEED87B,
+				0x4ADAD7B8, 0x4AC6EC3F, 0x4AB315EA, 0x4A9F5491, 0x4A8BA80D, 0x4A781038, 0x4A648CEC, 0x4A511E04,
+				0x4A3DC35B, 0x4A2A7CCB, 0x4A174A30, 0x4A042B66, 0x49F1204A, 0x49DE28B8, 0x49CB448D, 0x49B873A7,
+				0x49A5B5E2, 0x49930B1E, 0x49807339, 0x496DEE11, 0x495B7B86, 0x49491B76, 0x4936CDC2, 0x49249249,
+				0x491268EC, 0x4900518C, 0x48EE4C08, 0x48DC5844, 0x48CA761F, 0x48B8A57C, 0x48A6E63E, 0x48953845,
+				0x48839B76, 0x48720FB2, 0x486094DE, 0x484F2ADC, 0x483DD190, 0x482C88DF, 0x481B50AD, 0x480A28DD,
+				0x47F91156, 0x47E809FC, 0x47D712B3, 0x47C62B63, 0x47B553F0, 0x47A48C41, 0x4793D43C, 0x47832BC7,
+				0x477292C9, 0x47620929, 0x47518ECE, 0x474123A0, 0x4730C785, 0x47207A67, 0x47103C2D, 0x47000CBF,
+				0x46EFEC06, 0x46DFD9EA, 0x46CFD655, 0x46BFE12F, 0x46AFFA61, 0x46A021D6, 0x46905777, 0x46809B2D,
+				0x4670ECE4, 0x46614C84, 0x4651B9F9, 0x4642352D, 0x4632BE0B, 0x4623547E, 0x4613F871, 0x4604A9D0,
+				0x45F56885, 0x45E6347E, 0x45D70DA5, 0x45C7F3E7, 0x45B8E72F, 0x45A9E76B, 0x459AF487, 0x458C0E6F,
+				0x457D3511, 0x456E6859, 0x455FA835, 0x4550F492, 0x45424D5D, 0x4533B284, 0x452523F6, 0x4516A19F,
+				0x45082B6E, 0x44F9C151, 0x44EB6337, 0x44DD110E, 0x44CECAC5, 0x44C0904A, 0x44B2618D, 0x44A43E7D,
+				0x44962708, 0x44881B1F, 0x447A1AB1, 0x446C25AD, 0x445E3C02, 0x44505DA2, 0x44428A7C, 0x4434C280,
+				0x4427059E, 0x441953C8, 0x440BACEC, 0x43FE10FC, 0x43F07FE9, 0x43E2F9A3, 0x43D57E1C, 0x43C80D45,
+				0x43BAA70E, 0x43AD4B69, 0x439FFA48, 0x4392B39C, 0x43857757, 0x4378456A, 0x436B1DC8, 0x435E0062,
+				0x4350ED2B, 0x4343E414, 0x4336E511, 0x4329F013, 0x431D050C, 0x431023F0, 0x43034CB2, 0x42F67F43,
+				0x42E9BB98, 0x42DD01A2, 0x42D05156, 0x42C3AAA6, 0x42B70D85, 0x42AA79E7, 0x429DEFC0, 0x42916F02,
+				0x4284F7A2, 0x42788994, 0x426C24CB, 0x425FC93B, 0x425376D8, 0x42472D96, 0x423AED6A, 0x422EB647,
+				0x42228823, 0x421662F1, 0x420A46A6, 0x41FE3337, 0x41F22898, 0x41E626BE, 0x41DA2D9F, 0x41CE3D2E,
+				0x41C25561, 0x41B6762C, 0x41AA9F86, 0x419ED164, 0x41930BBA, 0x41874E7E, 0x417B99A5, 0x416FED26,
+				0x416448F5, 0x4158AD08, 0x414D1956, 0x41418DD3, 0x41360A76, 0x412A8F35, 0x411F1C06, 0x4113B0DE,
+				0x41084DB5, 0x40FCF280, 0x40F19F35, 0x40E653CB, 0x40DB1039, 0x40CFD474, 0x40C4A074, 0x40B9742E,
+				0x40AE4F9B, 0x40A332B0, 0x40981D64, 0x408D0FAE, 0x40820985, 0x40770AE0, 0x406C13B6, 0x406123FF,
+				0x40563BB1, 0x404B5AC3, 0x4040812E, 0x4035AEE7, 0x402AE3E7, 0x40202026, 0x40156399, 0x400AAE3A,
+				0x40000000,
+			};
+		};
+
+		// cbrt(m) in Q2.62 for m in [2^61, 2^64) representing [1, 8) in Q3.61.
+		// Relative error is below 2^-55.
+		constexpr inline uint64_t cbrt_q62(uint64_t m) noexcept
+		{
+			// linearly interpolated seed of 1/cbrt(m), ~16 bits
+			const auto index = (m >> 55) - 64;
+			const uint64_t frac = (m >> 23) & 0xFFFF'FFFF;
+			int64_t r = rcbrt_lut::lut[index] - (((rcbrt_lut::lut[index] - rcbrt_lut::lut[index + 1]) * frac) >> 32);
+
+			// one Newton-Raphson step in 64-bit, r' = r + r * (1 - m * r^3) / 3
+			const int64_t m29 = int64_t(m >> 32);
+			const int64_t r3_31 = (((r * r) >> 31) * r) >> 31;
+			const int64_t t_31 = (m29 * r3_31) >> 29;
+			r += ((r * ((int64_t(1) << 31) - t_31)) >> 31) / 3;
+
+			// last step in 128-bit
+			r <<= 31;
+			const int64_t r2 = mul_shift(r, r, 62);
+			const uint64_t r3 = uint64_t(mul_shift(r2, r, 62));
+			const uint64_t t = (uint128::mul(m, r3) >> 61).lo;
+			r += mul_shift(r, int64_t((uint64_t(1) << 62) - t), 62) / 3;
+
+			// cbrt(m) = m / cbrt(m)^2 = m * r^2
+			return (uint128::mul(m, uint64_t(mul_shift(r, r, 62))) >> 61).lo;
+		}
+	}
+
+	// Cube root, the relative error is below 2^-55.
+	template<unsigned int F>
+	constexpr inline fixed64<F> cbrt(fixed64<F> v) noexcept
+	{
+		using Fixed = fixed64<F>;
+		if (v.raw_value() == 0)
+		{
+			return v;
+		}
+
+		const uint64_t n = v.raw_value() >= 0 ? uint64_t(v.raw_value()) : uint64_t(0) - uint64_t(v.raw_value());
+
+		// normalize to m in [1, 8) with an exponent that is a multiple of 3,
+		// v = m * 2^(61 - shift - F), result = cbrt(m) * 2^((61 - shift + 2F) / 3 - F)
+		const long lz = Fixed::clz(n);
+		const long shift = lz - (3 - (long(61 + 2 * F) - lz + 3 * 64) % 3) % 3;
+		const uint64_t m = shift >= 0 ? (n << shift) : (n >> -shift);
+		const uint64_t c = internal::cbrt_q62(m);
+
+		const long down = 62 - (long(61 + 2 * F) - shift) / 3;
+		const uint64_t root = down == 0 ? c : ((c + (uint64_t(1) << (down - 1))) >> down);
+		return Fixed::from_raw(v.raw_value() >= 0 ? int64_t(root) : -int64_t(root));
+	}
+
+	// sqrt(x^2 + y^2) without intermediate overflow
+	template<unsigned int F>
+	constexpr inline fixed64<F> hypot(fixed64<F> x, fixed64<F> y) noexcept
+	{
+		return length2(x, y);
+	}
+
+	// sqrt(x^2 + y^2 + z^2) without intermediate overflow
+	template<unsigned int F>
+	constexpr inline fixed64<F> hypot(fixed64<F> x, fixed64<F> y, fixed64<F> z) noexcept
+	{
+		return length3(x, y, z);
+	}
+
+	template <unsigned int F>
+	constexpr FIXED_64_FORCEINLINE fixed64<F> copysign(fixed64<F> x, fixed64<F> y) noexcept
+	{
+		x = abs(x);
+		return (y >= fixed64<F>{0}) ? x : -x;
+	}
+
+
+	namespace internal
+	{
+		// Angles are reduced to a binary fraction of a full turn, 2^64 is one turn.
+		// Quarter-wave kernels take a 64-bit fraction of a quarter turn and return Q1.62.
+		constexpr uint64_t QUARTER_TURN = uint64_t(1) << 62;
+		constexpr int64_t ONE_Q62 = int64_t(1) << 62;
+		constexpr int64_t HALF_PI_Q62 = 7244019458077122842ll;
+
+		// whether sin, cos, tan and atan interpolate the tables by default,
+		// precise:: and fast:: always take the polynomials
+		constexpr bool TRIG_TABLE = FIXED_64_ENABLE_TRIG_LUT != 0;
+
+		// |x| as a fraction of a full turn.
+		// The raw value is multiplied by 2^128 / 2pi and the turn is taken from bits
+		// [64 + F, 128 + F) of the 192-bit product, so no division is involved and
+		// the result is within one bit of the exact turn for any input.
+		template <unsigned int F>
+		constexpr FIXED_64_FORCEINLINE uint64_t to_turn(fixed64<F> x) noexcept
+		{
+			constexpr uint64_t INV_TWO_PI_HI = 0x28BE'60DB'9391'054Aull;
+			constexpr uint64_t INV_TWO_PI_LO = 0x7F09'D5F4'7D4D'3770ull;
+
+			const uint64_t a = x.raw_value() >= 0 ? uint64_t(x.raw_value()) : uint64_t(0) - uint64_t(x.raw_value());
+			const uint128 hi = uint128::mul(a, INV_TWO_PI_HI);
+			const uint64_t lo = uint128::mul(a, INV_TWO_PI_LO).hi;
+
+			const uint64_t mid = hi.lo + lo;
+			const uint64_t top = hi.hi + (mid < lo);
+			if (F == 0)
+				return mid;
+			return (mid >> F) | (top << (F == 0 ? 0 : 64 - F));
+		}
+
+#if FIXED_64_ENABLE_TRIG_LUT
+		// table value at pos / 2^64 of its span
+		template <class Lut>
+		constexpr FIXED_64_FORCEINLINE int64_t lut_lookup(uint64_t pos) noexcept
+		{
+			const auto& e = Lut::data[pos >> (64 - Lut::BITS)];
+			const int64_t t = int64_t((pos << Lut::BITS) >> 1);
+#if FIXED_64_TRIG_LUT_INTERPOLATION >= 2
+			return e.value + mul_shift(e.slope + mul_shift(e.curve, t, 63), t, 63);
+#else
+			return e.value + mul_shift(e.slope, t, 63);
+#endif
+		}
+#endif
+
+		struct sin_poly_lut
+		{
+			// minimax P in Q1.62 for sin(x * pi/2) = x * P(x^2) over [0, 1],
+			// one row per degree with its absolute error
+			static constexpr int MIN_DEGREE = 2;
+			static constexpr std::array<std::array<int64_t, 9>, 7> poly =
+			{{
+				{ 7241822877565602508, -2961224317819891931ll, 331399699118332017, 0, 0, 0, 0, 0, 0 }, // 2: 2^-13.9
+				{ 7243994943651117392, -2978655023675035103ll, 366326256459571716, -19982874975550249ll, 0, 0, 0, 0, 0 }, // 3: 2^-20.7
+				{ 7244019288490748543, -2978980195081240611ll, 367498251452344270, -21546848088110239ll, 695537047872534, 0, 0, 0, 0 }, // 4: 2^-28.2
+				{ 7244019457279209969, -2978983574492622592ll, 367517190785503097, -21590163115845285ll, 738871635318607, -15763725497960ll, 0, 0, 0 }, // 5: 2^-36.1
+				{ 7244019458074404297, -2978983596774004725ll, 367517369132242700, -21590774845568166ll, 739891525139126, -16579860099972ll, 251175455768, 0, 0 }, // 6: 2^-44.5
+				{ 7244019458077115826, -2978983596875284701ll, 367517370226484852, -21590780057842405ll, 739904269452719, -16596547057904ll, 262302066181, -2967547077ll, 0 }, // 7: 2^-53.3
+				{ 7244019458077122828, -2978983596875620905ll, 367517370231193048, -21590780087443669ll, 739904368142753, -16596733702453ll, 262503096332, -3082435487ll, 27035459 }, // 8: 2^-61.0
+			}};
+		};
+
+		// degree of sin_poly_lut that keeps the error below 2^-(F+2), the last
+		// row is held at 2^-61 by the Q1.62 coefficients
+		template <unsigned int F>
+		constexpr FIXED_64_FORCEINLINE int sin_degree() noexcept
+		{
+			return F <= 11 ? 2 : F <= 18 ? 3 : F <= 26 ? 4 : F <= 34 ? 5 : F <= 42 ? 6 : F <= 51 ? 7 : 8;
+		}
+
+		// sin(pos * pi/2 / 2^64), interpolated from the quarter-wave table whatever the
+		// precision of the result when TABLE is set, by the polynomial of the precision
+		// tier P otherwise
+		template <unsigned int P, bool TABLE>
+		constexpr FIXED_64_FORCEINLINE int64_t sin_quarter(uint64_t pos) noexcept
+		{
+#if FIXED_64_ENABLE_TRIG_LUT
+			if (TABLE)
+				return lut_lookup<sin_lut>(pos);
+#endif
+			const int64_t x = int64_t(pos >> 2);
+			return mul_shift(x, poly_q62<sin_poly_lut, sin_degree<P>()>(mul_shift(x, x, 62)), 62);
+		}
+
+		// sin(pi/2 - pos * pi/2 / 2^64)
+		template <unsigned int P, bool TABLE>
+		constexpr FIXED_64_FORCEINLINE int64_t cos_quarter(uint64_t pos) noexcept
+		{
+			return pos == 0 ? ONE_Q62 : sin_quarter<P, TABLE>(uint64_t(0) - pos);
+		}
+
+		template <unsigned int P, bool TABLE>
+		constexpr FIXED_64_FORCEINLINE int64_t sin_turn(uint64_t turn) noexcept
+		{
+			const uint64_t pos = turn << 2;
+			const int64_t v = (turn & QUARTER_TURN) ? cos_quarter<P, TABLE>(pos) : sin_quarter<P, TABLE>(pos);
+			return (turn >> 63) ? -v : v;
+		}
+
+		template <unsigned int P, bool TABLE>
+		constexpr FIXED_64_FORCEINLINE void sincos_turn(uint64_t turn, int64_t* s, int64_t* c) noexcept
+		{
+			const uint64_t pos = turn << 2;
+			const int64_t rising = sin_quarter<P, TABLE>(pos);
+			const int64_t falling = cos_quarter<P, TABLE>(pos);
+
+			// quadrant 0: (r, f), 1: (f, -r), 2: (-r, -f), 3: (-f, r)
+			const uint64_t quadrant = turn >> 62;
+			const int64_t sv = (quadrant & 1) ? falling : rising;
+			const int64_t cv = (quadrant & 1) ? rising : falling;
+			*s = (quadrant & 2) ? -sv : sv;
+			*c = ((quadrant + 1) & 2) ? -cv : cv;
+		}
+	}
+
+	template <unsigned int F, unsigned int P = F, bool TABLE = internal::TRIG_TABLE>
+	constexpr inline fixed64<F> sin(fixed64<F> x) noexcept
+	{
+		const int64_t v = internal::sin_turn<P, TABLE>(internal::to_turn(x));
+		return internal::from_q62<F>(x.raw_value() < 0 ? -v : v);
+	}
+
+	template <unsigned int F, unsigned int P = F, bool TABLE = internal::TRIG_TABLE>
+	constexpr inline fixed64<F> cos(fixed64<F> x) noexcept
+	{
+		return internal::from_q62<F>(internal::sin_turn<P, TABLE>(internal::to_turn(x) + internal::QUARTER_TURN));
+	}
+
+	// sin and cos sharing one range reduction
+	template <unsigned int F, unsigned int P = F, bool TABLE = internal::TRIG_TABLE>
+	constexpr inline void sincos(fixed64<F> x, fixed64<F>* s, fixed64<F>* c) noexcept
+	{
+		int64_t sv = 0, cv = 0;
+		internal::sincos_turn<P, TABLE>(internal::to_turn(x), &sv, &cv);
+
+		*s = internal::from_q62<F>(x.raw_value() < 0 ? -sv : sv);
+		*c = internal::from_q62<F>(cv);
+	}
+
+	// Binary angle, a fraction of a full turn stored in 64 bits where 2^64 is one turn.
+	// Wrapping is plain integer overflow, and sin/cos index the table from the top bits
+	// without any range reduction.
+	class angle
+	{
+	public:
+		using raw_type = uint64_t;
+		static constexpr raw_type HALF_TURN = raw_type(1) << 63;
+		static constexpr raw_type QUARTER_TURN = raw_type(1) << 62;
+
+	public:
+		constexpr FIXED_64_FORCEINLINE angle() noexcept = default;
+
+		constexpr FIXED_64_FORCEINLINE angle(const angle& val) noexcept = default;
+
+		static constexpr FIXED_64_FORCEINLINE angle from_raw(raw_type val) noexcept
+		{
+			angle ret{};
+			ret.value = val;
+			return ret;
+		}
+
+		// exact up to the last bit of the turn
+		template<unsigned int F>
+		static constexpr FIXED_64_FORCEINLINE angle from_radians(fixed64<F> rad) noexcept
+		{
+			const raw_type turn = internal::to_turn(rad);
+			return from_raw(rad.raw_value() < 0 ? raw_type(0) - turn : turn);
+		}
+
+		template<unsigned int F>
+		static constexpr FIXED_64_FORCEINLINE angle from_turns(fixed64<F> turns) noexcept
+		{
+			return from_raw(F == 0 ? 0 : raw_type(turns.raw_value()) << (F == 0 ? 0 : 64 - F));
+		}
+
+		constexpr FIXED_64_FORCEINLINE raw_type raw_value() const noexcept
+		{
+			return value;
+		}
+
+		// radians in [-pi, pi), rounded to nearest
+		template<unsigned int F>
+		constexpr FIXED_64_FORCEINLINE fixed64<F> radians() const noexcept
+		{
+			static_assert(F <= 60, "radians need F <= 60, pi with its rounding bit takes Q(F + 1)");
+			constexpr int64_t TWO_PI = 7244019458077122842ll; // Q4.60
+			const int64_t rad = internal::mul_shift(int64_t(value), TWO_PI, 123 - F);
+			return fixed64<F>::from_raw((rad + 1) >> 1);
+		}
+
+		// turns in [-0.5, 0.5)
+		template<unsigned int F>
+		constexpr FIXED_64_FORCEINLINE fixed64<F> turns() const noexcept
+		{
+			return fixed64<F>::from_raw(F == 0 ? 0 : int64_t(value) >> (F == 0 ? 0 : 64 - F));
+		}
+
+		constexpr FIXED_64_FORCEINLINE angle operator-() const noexcept
+		{
+			return from_raw(raw_type(0) - value);
+		}
+
+		constexpr FIXED_64_FORCEINLINE angle& operator+=(angle val) noexcept
+		{
+			value += val.value;
+			return *this;
+		}
+
+		constexpr FIXED_64_FORCEINLINE angle& operator-=(angle val) noexcept
+		{
+			value -= val.value;
+			return *this;
+		}
+
+		friend constexpr FIXED_64_FORCEINLINE angle operator+ (angle v1, angle v2) noexcept
+		{
+			return v1 += v2;
+		}
+
+		friend constexpr FIXED_64_FORCEINLINE angle operator- (angle v1, angle v2) noexcept
+		{
+			return v1 -= v2;
+		}
+
+		template <typename T, typename std::enable_if<std::is_integral<T>::value>::type* = nullptr>
+		constexpr FIXED_64_FORCEINLINE angle& operator*= (T val) noexcept
+		{
+			value *= raw_type(val);
+			return *this;
+		}
+
+		template <typename T, typename std::enable_if<std::is_integral<T>::value>::type* = nullptr>
+		friend constexpr FIXED_64_FORCEINLINE angle operator* (angle v1, T v2) noexcept
+		{
+			return v1 *= v2;
+		}
+
+		template <typename T, typename std::enable_if<std::is_integral<T>::value>::type* = nullptr>
+		friend constexpr FIXED_64_FORCEINLINE angle operator* (T v1, angle v2) noexcept
+		{
+			return v2 *= v1;
+		}
+
+		friend constexpr FIXED_64_FORCEINLINE bool operator== (angle v1, angle v2) noexcept
+		{
+			return v1.value == v2.value;
+		}
+
+		friend constexpr FIXED_64_FORCEINLINE bool operator!= (angle v1, angle v2) noexcept
+		{
+			return v1.value != v2.value;
+		}
+
+	private:
+		raw_type value = 0;
+	};
+
+	template <unsigned int F, unsigned int P = F, bool TABLE = internal::TRIG_TABLE>
+	constexpr inline fixed64<F> sin(angle a) noexcept
+	{
+		return internal::from_q62<F>(internal::sin_turn<P, TABLE>(a.raw_value()));
+	}
+
+	template <unsigned int F, unsigned int P = F, bool TABLE = internal::TRIG_TABLE>
+	constexpr inline fixed64<F> cos(angle a) noexcept
+	{
+		return internal::from_q62<F>(internal::sin_turn<P, TABLE>(a.raw_value() + angle::QUARTER_TURN));
+	}
+
+	template <unsigned int F, unsigned int P = F, bool TABLE = internal::TRIG_TABLE>
+	constexpr inline void sincos(angle a, fixed64<F>* s, fixed64<F>* c) noexcept
+	{
+		int64_t sv = 0, cv = 0;
+		internal::sincos_turn<P, TABLE>(a.raw_value(), &sv, &cv);
+		*s = internal::from_q62<F>(sv);
+		*c = internal::from_q62<F>(cv);
+	}
+
+	namespace internal
+	{
+		// num / den for num, den in [0, 1] Q1.62 with one reciprocal,
+		// saturated when the quotient does not fit
+		template <unsigned int F>
+		constexpr FIXED_64_FORCEINLINE fixed64<F> ratio_q62(uint64_t num, uint64_t den, bool negative) noexcept
+		{
+			using Fixed = fixed64<F>;
+			if (den == 0)
+				return Fixed::from_raw(negative ? Fixed::MINIMUM : Fixed::MAXIMUM);
+
+			// den = m * 2^(1 - shift) with m in [1, 2), num / den = num * (1/m) * 2^(shift - 1)
+			const long shift = Fixed::clz(den);
+			const uint128 p = uint128::mul(num, recip_q62(den << shift));
+			const long down = 125 - long(F) - shift;
+
+			uint128 q = p;
+			if (down > 0)
+				q = (p + (uint128{ 0, 1 } << (down - 1))) >> down;
+			if (q.hi != 0 || q.lo > uint64_t(Fixed::MAXIMUM))
+				return Fixed::from_raw(negative ? Fixed::MINIMUM : Fixed::MAXIMUM);
+
+			return Fixed::from_raw(negative ? -int64_t(q.lo) : int64_t(q.lo));
+		}
+
+		// tan of a turn, or cot when inverse is set
+		template <unsigned int F, unsigned int P, bool TABLE>
+		constexpr FIXED_64_FORCEINLINE fixed64<F> tan_turn(uint64_t turn, bool negative, bool inverse) noexcept
+		{
+			// quadrant 0 and 2: tan of the position, 1 and 3: -cot
+			const uint64_t pos = turn << 2;
+			const bool odd = ((turn >> 62) & 1) != 0;
+			const bool flip = odd != inverse;
+			negative = odd != negative;
+#if FIXED_64_ENABLE_TRIG_LUT
+			if (TABLE)
+			{
+				// the second octant looks up its mirror, ~(2 * pos) is 2 * (pi/2 - pos) off by 2^-64
+				const bool upper = (pos >> 63) != 0;
+				const uint64_t t = uint64_t(lut_lookup<tan_lut>(upper ? ~(pos << 1) : pos << 1));
+				if (upper != flip)
+					return ratio_q62<F>(uint64_t(ONE_Q62), t, negative);
+
+				const fixed64<F> r = from_q62<F>(int64_t(t));
+				return negative ? -r : r;
+			}
+#endif
+			const uint64_t s = uint64_t(sin_quarter<P, false>(pos));
+			const uint64_t c = uint64_t(cos_quarter<P, false>(pos));
+			return ratio_q62<F>(flip ? c : s, flip ? s : c, negative);
+		}
+	}
+
+	// Tangent, saturated at the poles.
+	template <unsigned int F, unsigned int P = F, bool TABLE = internal::TRIG_TABLE>
+	constexpr inline fixed64<F> tan(fixed64<F> x) noexcept
+	{
+		return internal::tan_turn<F, P, TABLE>(internal::to_turn(x), x.raw_value() < 0, false);
+	}
+
+	// Cotangent, saturated at the poles.
+	template <unsigned int F, unsigned int P = F, bool TABLE = internal::TRIG_TABLE>
+	constexpr inline fixed64<F> cot(fixed64<F> x) noexcept
+	{
+		return internal::tan_turn<F, P, TABLE>(internal::to_turn(x), x.raw_value() < 0, true);
+	}
+
+	template <unsigned int F, unsigned int P = F, bool TABLE = internal::TRIG_TABLE>
+	constexpr inline fixed64<F> tan(angle a) noexcept
+	{
+		return internal::tan_turn<F, P, TABLE>(a.raw_value(), false, false);
+	}
+
+	template <unsigned int F, unsigned int P = F, bool TABLE = internal::TRIG_TABLE>
+	constexpr inline fixed64<F> cot(angle a) noexcept
+	{
+		return internal::tan_turn<F, P, TABLE>(a.raw_value(), false, true);
+	}
+
+	// sin and cos of start + k * step for k = 0, 1, 2 ..., one complex multiply per
+	// sample. The rotation by the step runs in Q1.62 and gains about 2^-60 a sample,
+	// so the sequence re-anchors on a full sincos every 2^(58 - F) samples (at most
+	// 4096) and stays within the error of sincos. Radians are rounded to a 64-bit
+	// turn, the k-th sample of a radian step is off by up to k * 2^-62.
+	//
+	//   sincos_sequence<32> ring(fixed64<32>(0), fixed64<32>(0.01));
+	//   ring.fill(s, c, 628); // a circle
+	template <unsigned int F, unsigned int P = F, bool TABLE = internal::TRIG_TABLE>
+	class sincos_sequence
+	{
+	public:
+		using fixed = fixed64<F>;
+		static constexpr uint64_t ANCHOR = uint64_t(1) << (F >= 58 ? 0 : 58 - F < 12 ? 58 - F : 12);
+
+	public:
+		constexpr sincos_sequence(angle start, angle step) noexcept :
+			turn(start.raw_value()), delta(step.raw_value())
+		{
+			internal::sincos_turn<62, false>(delta, &rot_sin, &rot_cos);
+			internal::sincos_turn<P, TABLE>(turn, &sin_value, &cos_value);
+		}
+
+		constexpr sincos_sequence(fixed start, fixed step) noexcept :
+			sincos_sequence(angle::from_radians(start), angle::from_radians(step))
+		{
+		}
+
+		// the current sample, then steps once
+		constexpr FIXED_64_FORCEINLINE void next(fixed* s, fixed* c) noexcept
+		{
+			fill(s, c, 1);
+		}
+
+		// the next n samples into s[0 .. n) and c[0 .. n)
+		constexpr inline void fill(fixed* s, fixed* c, size_t n) noexcept
+		{
+			while (n != 0)
+			{
+				const size_t run = n < left ? n : size_t(left);
+				for (size_t i = 0; i < run; ++i)
+				{
+					s[i] = internal::from_q62<F>(sin_value);
+					c[i] = internal::from_q62<F>(cos_value);
+					const int64_t sv = internal::mul_shift(sin_value, rot_cos, 62) + internal::mul_shift(cos_value, rot_sin, 62);
+					cos_value = internal::mul_shift(cos_value, rot_cos, 62) - internal::mul_shift(sin_value, rot_sin, 62);
+					sin_value = sv;
+				}
+				s += run;
+				c += run;
+				n -= run;
+				left -= run;
+				turn += delta * run;
+				if (left == 0)
+				{
+					left = ANCHOR;
+					internal::sincos_turn<P, TABLE>(turn, &sin_value, &cos_value);
+				}
+			}
+		}
+
+		// angle of the current sample
+		constexpr FIXED_64_FORCEINLINE angle current() const noexcept
+		{
+			return angle::from_raw(turn);
+		}
+
+	private:
+		uint64_t turn = 0;
+		uint64_t delta = 0;
+		uint64_t left = ANCHOR;
+		int64_t sin_value = 0;
+		int64_t cos_value = 0;
+		int64_t rot_sin = 0;
+		int64_t rot_cos = 0;
+	};
+
+
+	namespace internal
+	{
+		// num / den in Q62 for num <= den < 2^63, one quotient bit per step
+		constexpr inline uint64_t div_q62(uint64_t num, uint64_t den) noexcept
+		{
+			uint64_t quot = 0;
+			for (int i = 0; i <= 62; ++i)
+			{
+				quot <<= 1;
+				if (num >= den)
+				{
+					num -= den;
+					quot |= 1;
+				}
+				num <<= 1;
+			}
+			return quot;
+		}
+
+		// num / den in Q1.62 for num <= den, 0 < den < 2^63
+		constexpr FIXED_64_FORCEINLINE uint64_t unit_ratio_q62(uint64_t num, uint64_t den) noexcept
+		{
+			// num >> 2 < den, so the quotient fits in 64 bits
+			return uint128::div({ num >> 2, num << 62 }, den);
+		}
+
+		struct atan_poly_lut
+		{
+			// minimax P in Q1.62 for atan(u) = u + u^3 * P(u^2) over [0, tan(pi/8)],
+			// one row per degree with its absolute error
+			static constexpr int MIN_DEGREE = 2;
+			static constexpr std::array<std::array<int64_t, 12>, 10> poly =
+			{{
+				{ -1536856155326769084ll, 908284297898671431, -512426153173708694ll, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // 2: 2^-21.6
+				{ -1537212539339306670ll, 921289308367350492, -639298569905900529ll, 368241345487368281, 0, 0, 0, 0, 0, 0, 0, 0 }, // 3: 2^-26.5
+				{ -1537227995961010012ll, 922269557622543200, -656841102658107856ll, 487984855893424568, -278234088052670466ll, 0, 0, 0, 0, 0, 0, 0 }, // 4: 2^-31.4
+				{ -1537228644904453614ll, 922333221689429575, -658645123962933252ll, 509316429499169011, -390427387481786306ll, 217348532305290639, 0, 0, 0, 0, 0, 0 }, // 5: 2^-36.2
+				{ -1537228671670857009ll, 922336983743232153, -658799719361057686ll, 512086216235371458, -414873409513242573ll, 322018032190375599, -173868532785008975ll, 0, 0, 0, 0, 0 }, // 6: 2^-41.1
+				{ -1537228672763019810ll, 922337192088131144, -658811422701425565ll, 512380076834816155, -418702603656745145ll, 348978257287643096, -271252295085943655ll, 141585039526258033, 0, 0, 0, 0 }, // 7: 2^-45.9
+				{ -1537228672807270457ll, 922337203095147351, -658812232580753865ll, 512407131955394955, -419186275082111616ll, 353920446312437457, -300196735250634967ll, 232022792953586091, -116902861800693639ll, 0, 0, 0 }, // 8: 2^-50.7
+				{ -1537228672809054624ll, 922337203656248157, -658812284938042871ll, 512409373371927306, -419238651988662567ll, 354644070836727794, -306272628057494279ll, 262486135180989462, -200780092788730756ll, 97598049162144734, 0, 0 }, // 9: 2^-55.5
+				{ -1537228672809126309ll, 922337203684062172, -658812288147050257ll, 512409544480162402, -419243700250986557ll, 354734105471687360, -307283973242933873ll, 269689749099558626, -232355780372854326ll, 175315885786398497, -82222537903480921ll, 0 }, // 10: 2^-60.2
+				{ -1537228672809129182ll, 922337203685410282, -658812288335469056ll, 512409556716213857, -419244144231757041ll, 354743995566067350, -307426058404824386ll, 271032766039293410, -240659757770609535ll, 207650335753105953, -154180950633324164ll, 69794109100968822 }, // 11: 2^-64.9
+			}};
+		};
+
+		// degree of atan_poly_lut that keeps the error below 2^-(F+2)
+		template <unsigned int F>
+		constexpr FIXED_64_FORCEINLINE int atan_degree() noexcept
+		{
+			return F <= 19 ? 2 : F <= 24 ? 3 : F <= 29 ? 4 : F <= 34 ? 5 : F <= 39 ? 6 :
+				F <= 43 ? 7 : F <= 48 ? 8 : F <= 53 ? 9 : F <= 58 ? 10 : 11;
+		}
+
+		// atan(u) for u in [0, tan(pi/8)] in Q1.62 by the polynomial of the precision tier P
+		template <unsigned int P>
+		constexpr inline int64_t atan_poly(int64_t u) noexcept
+		{
+			const int64_t z = mul_shift(u, u, 62);
+			return u + mul_shift(mul_shift(u, z, 62), poly_q62<atan_poly_lut, atan_degree<P>()>(z), 62);
+		}
+
+		// atan(t) for t in [0, 1] in Q1.62, interpolated from the table whatever the
+		// precision of the result when TABLE is set. Otherwise by the polynomial,
+		// atan(t) = pi/4 - atan((1 - t) / (1 + t)) above tan(pi/8).
+		template <unsigned int P, bool TABLE>
+		constexpr inline int64_t atan_unit(uint64_t t) noexcept
+		{
+			constexpr uint64_t TAN_PI_8 = 1910222894239003202ull;
+			constexpr int64_t QUARTER_PI = 3622009729038561421ll;
+
+#if FIXED_64_ENABLE_TRIG_LUT
+			if (TABLE)
+				return lut_lookup<atan_lut>(t >= uint64_t(ONE_Q62) ? ~uint64_t(0) : t << 2);
+#endif
+			if (t <= TAN_PI_8)
+				return atan_poly<P>(int64_t(t));
+			return QUARTER_PI - atan_poly<P>(int64_t(unit_ratio_q62(uint64_t(ONE_Q62) - t, uint64_t(ONE_Q62) + t)));
+		}
+	}
+
+	// atan by the table on [0, 1], and atan(x) = pi/2 - atan(1/x) above
+	template <unsigned int F, unsigned int P = F, bool TABLE = internal::TRIG_TABLE>
+	constexpr inline fixed64<F> atan(fixed64<F> x) noexcept
+	{
+		constexpr uint64_t ONE = uint64_t(1) << F;
+		const uint64_t a = x.raw_value() >= 0 ? uint64_t(x.raw_value()) : uint64_t(0) - uint64_t(x.raw_value());
+
+		const int64_t r = a <= ONE ?
+			internal::atan_unit<P, TABLE>(a << (62 - F)) :
+			internal::HALF_PI_Q62 - internal::atan_unit<P, TABLE>(internal::unit_ratio_q62(ONE, a));
+		return internal::from_q62<F>(x.raw_value() < 0 ? -r : r);
+	}
+
+	// atan2 folds (x, y) onto the first octant, one reciprocal of the larger side,
+	// then unfolds in Q2.61. atan2(0, 0) is 0.
+	template <unsigned int F, unsigned int P = F, bool TABLE = internal::TRIG_TABLE>
+	constexpr inline fixed64<F> atan2(fixed64<F> y, fixed64<F> x) noexcept
+	{
+		const uint64_t ax = x.raw_value() >= 0 ? uint64_t(x.raw_value()) : uint64_t(0) - uint64_t(x.raw_value());
+		const uint64_t ay = y.raw_value() >= 0 ? uint64_t(y.raw_value()) : uint64_t(0) - uint64_t(y.raw_value());
+		if (ax == 0 && ay == 0)
+			return fixed64<F>::from_raw(0);
+
+		// pi in Q2.61 has the raw value of pi/2 in Q1.62
+		const bool steep = ay > ax;
+		const int64_t t = internal::atan_unit<P, TABLE>(internal::unit_ratio_q62(steep ? ax : ay, steep ? ay : ax));
+		int64_t r = ((steep ? internal::HALF_PI_Q62 - t : t) + 1) >> 1;
+		if (x.raw_value() < 0)
+			r = internal::HALF_PI_Q62 - r;
+		return internal::from_q<F, 61>(y.raw_value() < 0 ? -r : r);
+	}
+
+
+	namespace internal
+	{
+		// sqrt(v) in Q2.62 for v in [0, 4) in Q2.62, through rsqrt of the normalized value
+		constexpr FIXED_64_FORCEINLINE uint64_t sqrt_q62(uint64_t v) noexcept
+		{
+			if (v == 0)
+				return 0;
+
+			// v = m * 2^-shift with m in [1, 4), sqrt(m) = m / sqrt(m)
+			const long shift = fixed64<0>::clz(v) & ~1l;
+			const uint64_t m = v << shift;
+			return (uint128::mul(m, rsqrt_q62(m)) >> (62 + shift / 2)).lo;
+		}
+
+		struct asin_poly_lut
+		{
+			// minimax P in Q1.62 for asin(a) = a + a * z * P(z), z = a^2 over [0, 0.25],
+			// one row per degree with its absolute error
+			static constexpr int MIN_DEGREE = 2;
+			static constexpr std::array<std::array<int64_t, 14>, 12> poly =
+			{{
+				{ 769230397283896262, 330733275789550786, 299638905560681839, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // 2: 2^-19.8
+				{ 768571319450808182, 347735143897080220, 183947941710657431, 232914947033938406, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // 3: 2^-23.9
+				{ 768617310026372816, 345676684385703148, 209673551950361213, 110943481178278346, 196243920981216893, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // 4: 2^-28.1
+				{ 768614131326207796, 345896239574020377, 205328934723739328, 146649364106298314, 66108689066624144, 174351164076456967, 0, 0, 0, 0, 0, 0, 0, 0 }, // 5: 2^-32.2
+				{ 768614350554470571, 345874595767289156, 205949693204020166, 138918454167630271, 113409473201934874, 34223715909503436, 160826610754928868, 0, 0, 0, 0, 0, 0, 0 }, // 6: 2^-36.2
+				{ 768614335426787243, 345876618703997685, 205870444407455854, 140301404600286393, 100915606951661467, 95102110827008487, 8844250022141020, 152559924396194048, 0, 0, 0, 0, 0, 0 }, // 7: 2^-40.3
+				{ 768614336472255816, 345876436730635688, 205879774447953277, 140084857623506936, 103599415455062248, 76121533364940038, 85685787955476890, -13241848756340147ll, 147885660457835059, 0, 0, 0, 0, 0 }, // 8: 2^-44.3
+				{ 768614336399869429, 345876452636147060, 205878741077517601, 140115580732649855, 103101781602135559, 80879971211098486, 58065242444527550, 82402922968817902, -33856444922674364ll, 145849441633253490, 0, 0, 0, 0 }, // 9: 2^-48.3
+				{ 768614336404890927, 345876451276638041, 205878850203152659, 140111541473172391, 103184366912387021, 79860646162024496, 65980636598536304, 43461783146144630, 83952472231785437, -54158606080341537ll, 145879672439467717, 0, 0, 0 }, // 10: 2^-52.3
+				{ 768614336404541938, 345876451390785132, 205878839111656295, 140112041266901692, 103171802801710675, 80054311267245024, 64057337232887115, 56018222820639061, 30365791289560101, 89776773014628996, -74970817254775048ll, 147626444896423401, 0, 0 }, // 11: 2^-56.2
+				{ 768614336404566234, 345876451381339767, 205878840204194373, 140111982412341438, 103173584695292332, 80020853363577084, 64468931923222396, 52606206228703293, 49566725190980478, 17435237140866146, 99750613862739626, -96940824602119580ll, 150876621468748332, 0 }, // 12: 2^-60.2
+				{ 768614336404564540, 345876451382111933, 205878840099356914, 140111989063278842, 103173346202409786, 80026202778274628, 64389344235915894, 53418258048194085, 43797293117425022, 45951154761684308, 3592785346879645, 114036381091441820, -120629307678903170ll, 155506501409785995 }, // 13: 2^-64.1
+			}};
+		};
+
+		// degree of asin_poly_lut that keeps the error below 2^-(F+3),
+		// asin and acos double it above 0.5
+		template <unsigned int F>
+		constexpr FIXED_64_FORCEINLINE int asin_degree() noexcept
+		{
+			return F <= 16 ? 2 : F <= 20 ? 3 : F <= 25 ? 4 : F <= 29 ? 5 : F <= 33 ? 6 : F <= 37 ? 7 :
+				F <= 41 ? 8 : F <= 45 ? 9 : F <= 49 ? 10 : F <= 53 ? 11 : F <= 57 ? 12 : 13;
+		}
+
+		// z * P(z) for z = a^2 in [0, 0.25] in Q1.62. It only takes z, so the sqrt
+		// above 0.5 runs alongside.
+		template <unsigned int P>
+		constexpr FIXED_64_FORCEINLINE int64_t asin_poly(int64_t z) noexcept
+		{
+			return mul_shift(z, poly_q62<asin_poly_lut, asin_degree<P>()>(z), 62);
+		}
+
+		// asin(a) for a in [0, 0.5] in Q1.62
+		template <unsigned int P>
+		constexpr FIXED_64_FORCEINLINE int64_t asin_half(int64_t a) noexcept
+		{
+			return a + mul_shift(a, asin_poly<P>(mul_shift(a, a, 62)), 62);
+		}
+
+		// asin(sqrt(z)) for z in [0, 0.25] in Q1.62
+		template <unsigned int P>
+		constexpr FIXED_64_FORCEINLINE int64_t asin_sqrt(int64_t z) noexcept
+		{
+			const int64_t s = int64_t(sqrt_q62(uint64_t(z)));
+			return s + mul_shift(s, asin_poly<P>(z), 62);
+		}
+
+		// |x| in Q1.62, clamped to 1
+		template <unsigned int F>
+		constexpr FIXED_64_FORCEINLINE int64_t unit_q62(fixed64<F> x) noexcept
+		{
+			const uint64_t a = x.raw_value() >= 0 ? uint64_t(x.raw_value()) : uint64_t(0) - uint64_t(x.raw_value());
+			return a >= (uint64_t(1) << F) ? ONE_Q62 : int64_t(a << (62 - F));
+		}
+	}
+
+	// asin by the polynomial on [0, 0.5], and asin(x) = pi/2 - 2 * asin(sqrt((1 - x) / 2)) above
+	template <unsigned int F, unsigned int P = F>
+	constexpr inline fixed64<F> asin(fixed64<F> x) noexcept
+	{
+		using Fixed = fixed64<F>;
+		FIXED_64_ASSERT(x >= Fixed(-1) && x <= Fixed(+1));
+
+		const int64_t a = internal::unit_q62(x);
+		int64_t r = 0;
+		if (a <= internal::ONE_Q62 / 2)
+			r = internal::asin_half<P>(a);
+		else
+			r = internal::HALF_PI_Q62 - 2 * internal::asin_sqrt<P>((internal::ONE_Q62 - a) >> 1);
+
+		return internal::from_q62<F>(x.raw_value() < 0 ? -r : r);
+	}
+
+	// acos in Q2.61 by the same kernel, acos(x) = 2 * asin(sqrt((1 - x) / 2)) for x > 0.5
+	// and pi - 2 * asin(sqrt((1 + x) / 2)) for x < -0.5
+	template <unsigned int F, unsigned int P = F>
+	constexpr inline fixed64<F> acos(fixed64<F> x) noexcept
+	{
+		using Fixed = fixed64<F>;
+		FIXED_64_ASSERT(x >= Fixed(-1) && x <= Fixed(+1));
+
+		const int64_t a = internal::unit_q62(x);
+		const bool negative = x.raw_value() < 0;
+		int64_t r = 0;
+		if (a <= internal::ONE_Q62 / 2)
+		{
+			const int64_t k = internal::asin_half<P>(a);
+			r = int64_t((uint64_t(internal::HALF_PI_Q62) + uint64_t(negative ? k : -k) + 1) >> 1);
+		}
+		else
+		{
+			// 2 * k in Q2.61 has the raw value of k in Q1.62, so has pi of pi/2
+			const int64_t k = internal::asin_sqrt<P>((internal::ONE_Q62 - a) >> 1);
+			r = negative ? internal::HALF_PI_Q62 - k : k;
+		}
+
+		return internal::from_q<F, 61>(r);
+	}
+
+	// Accuracy tiers that can be mixed in one binary. The default functions take the
+	// precision P their kernels are selected for and the table switch as trailing
+	// template parameters, the tiers fix both.
+	//
+	// fast:: runs the kernels of 18 fraction bits (F below that), and the tables for
+	// sin, cos, tan and atan when they are compiled in. Max error whatever F is above
+	// 18, absolute unless noted:
+	//   exp exp2 pow cosh        2e-7 relative
+	//   sinh                     5e-7 relative
+	//   expm1                    6e-7
+	//   tanh                     1.3e-7
+	//   log log2 log10 log1p     2e-8
+	//   asin acos                1.3e-7
+	//   sin cos sincos           6e-7, the table as the default one with FIXED_64_ENABLE_TRIG_LUT
+	//   tan cot                  6e-7 / cos(x) relative, the table likewise
+	//   atan atan2               3.2e-7, the table likewise
+	namespace internal
+	{
+		template <unsigned int F>
+		constexpr FIXED_64_FORCEINLINE unsigned int fast_bits() noexcept
+		{
+			return F < 18 ? F : 18;
+		}
+	}
+
+	namespace fast
+	{
+		template <unsigned int F>
+		constexpr inline fixed64<F> exp(fixed64<F> x) noexcept
+		{
+			return f64::exp<F, internal::fast_bits<F>()>(x);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> exp2(fixed64<F> x) noexcept
+		{
+			return f64::exp2<F, internal::fast_bits<F>()>(x);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> expm1(fixed64<F> x) noexcept
+		{
+			return f64::expm1<F, internal::fast_bits<F>()>(x);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> log(fixed64<F> x) noexcept
+		{
+			return f64::log<F, internal::fast_bits<F>()>(x);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> log2(fixed64<F> x) noexcept
+		{
+			return f64::log2<F, internal::fast_bits<F>()>(x);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> log10(fixed64<F> x) noexcept
+		{
+			return f64::log10<F, internal::fast_bits<F>()>(x);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> log1p(fixed64<F> x) noexcept
+		{
+			return f64::log1p<F, internal::fast_bits<F>()>(x);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> pow(fixed64<F> base, fixed64<F> exp) noexcept
+		{
+			return f64::pow<F, internal::fast_bits<F>()>(base, exp);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> sinh(fixed64<F> x) noexcept
+		{
+			return f64::sinh<F, internal::fast_bits<F>()>(x);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> cosh(fixed64<F> x) noexcept
+		{
+			return f64::cosh<F, internal::fast_bits<F>()>(x);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> tanh(fixed64<F> x) noexcept
+		{
+			return f64::tanh<F, internal::fast_bits<F>()>(x);
+		}
+
+		template <unsigned int F>
+		constexpr inline void sinhcosh(fixed64<F> x, fixed64<F>* s, fixed64<F>* c) noexcept
+		{
+			f64::sinhcosh<F, internal::fast_bits<F>()>(x, s, c);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> sin(fixed64<F> x) noexcept
+		{
+			return f64::sin<F, internal::fast_bits<F>(), internal::TRIG_TABLE>(x);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> cos(fixed64<F> x) noexcept
+		{
+			return f64::cos<F, internal::fast_bits<F>(), internal::TRIG_TABLE>(x);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> tan(fixed64<F> x) noexcept
+		{
+			return f64::tan<F, internal::fast_bits<F>(), internal::TRIG_TABLE>(x);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> cot(fixed64<F> x) noexcept
+		{
+			return f64::cot<F, internal::fast_bits<F>(), internal::TRIG_TABLE>(x);
+		}
+
+		template <unsigned int F>
+		constexpr inline void sincos(fixed64<F> x, fixed64<F>* s, fixed64<F>* c) noexcept
+		{
+			f64::sincos<F, internal::fast_bits<F>(), internal::TRIG_TABLE>(x, s, c);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> sin(angle a) noexcept
+		{
+			return f64::sin<F, internal::fast_bits<F>(), internal::TRIG_TABLE>(a);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> cos(angle a) noexcept
+		{
+			return f64::cos<F, internal::fast_bits<F>(), internal::TRIG_TABLE>(a);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> tan(angle a) noexcept
+		{
+			return f64::tan<F, internal::fast_bits<F>(), internal::TRIG_TABLE>(a);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> cot(angle a) noexcept
+		{
+			return f64::cot<F, internal::fast_bits<F>(), internal::TRIG_TABLE>(a);
+		}
+
+		template <unsigned int F>
+		constexpr inline void sincos(angle a, fixed64<F>* s, fixed64<F>* c) noexcept
+		{
+			f64::sincos<F, internal::fast_bits<F>(), internal::TRIG_TABLE>(a, s, c);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> asin(fixed64<F> x) noexcept
+		{
+			return f64::asin<F, internal::fast_bits<F>()>(x);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> acos(fixed64<F> x) noexcept
+		{
+			return f64::acos<F, internal::fast_bits<F>()>(x);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> atan(fixed64<F> x) noexcept
+		{
+			return f64::atan<F, internal::fast_bits<F>(), internal::TRIG_TABLE>(x);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> atan2(fixed64<F> y, fixed64<F> x) noexcept
+		{
+			return f64::atan2<F, internal::fast_bits<F>(), internal::TRIG_TABLE>(y, x);
+		}
+	}
+
+	// precise:: runs the polynomial tier of F everywhere and never the tables, every
+	// function is within about 1 ulp up to Q56. The exp, log and hyperbolic functions
+	// are the default ones, sin, cos, tan and atan are what the default ones are
+	// without FIXED_64_ENABLE_TRIG_LUT.
+	namespace precise
+	{
+		template <unsigned int F>
+		constexpr inline fixed64<F> exp(fixed64<F> x) noexcept
+		{
+			return f64::exp<F, F>(x);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> exp2(fixed64<F> x) noexcept
+		{
+			return f64::exp2<F, F>(x);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> expm1(fixed64<F> x) noexcept
+		{
+			return f64::expm1<F, F>(x);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> log(fixed64<F> x) noexcept
+		{
+			return f64::log<F, F>(x);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> log2(fixed64<F> x) noexcept
+		{
+			return f64::log2<F, F>(x);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> log10(fixed64<F> x) noexcept
+		{
+			return f64::log10<F, F>(x);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> log1p(fixed64<F> x) noexcept
+		{
+			return f64::log1p<F, F>(x);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> pow(fixed64<F> base, fixed64<F> exp) noexcept
+		{
+			return f64::pow<F, F>(base, exp);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> sinh(fixed64<F> x) noexcept
+		{
+			return f64::sinh<F, F>(x);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> cosh(fixed64<F> x) noexcept
+		{
+			return f64::cosh<F, F>(x);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> tanh(fixed64<F> x) noexcept
+		{
+			return f64::tanh<F, F>(x);
+		}
+
+		template <unsigned int F>
+		constexpr inline void sinhcosh(fixed64<F> x, fixed64<F>* s, fixed64<F>* c) noexcept
+		{
+			f64::sinhcosh<F, F>(x, s, c);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> sin(fixed64<F> x) noexcept
+		{
+			return f64::sin<F, F, false>(x);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> cos(fixed64<F> x) noexcept
+		{
+			return f64::cos<F, F, false>(x);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> tan(fixed64<F> x) noexcept
+		{
+			return f64::tan<F, F, false>(x);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> cot(fixed64<F> x) noexcept
+		{
+			return f64::cot<F, F, false>(x);
+		}
+
+		template <unsigned int F>
+		constexpr inline void sincos(fixed64<F> x, fixed64<F>* s, fixed64<F>* c) noexcept
+		{
+			f64::sincos<F, F, false>(x, s, c);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> sin(angle a) noexcept
+		{
+			return f64::sin<F, F, false>(a);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> cos(angle a) noexcept
+		{
+			return f64::cos<F, F, false>(a);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> tan(angle a) noexcept
+		{
+			return f64::tan<F, F, false>(a);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> cot(angle a) noexcept
+		{
+			return f64::cot<F, F, false>(a);
+		}
+
+		template <unsigned int F>
+		constexpr inline void sincos(angle a, fixed64<F>* s, fixed64<F>* c) noexcept
+		{
+			f64::sincos<F, F, false>(a, s, c);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> asin(fixed64<F> x) noexcept
+		{
+			return f64::asin<F, F>(x);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> acos(fixed64<F> x) noexcept
+		{
+			return f64::acos<F, F>(x);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> atan(fixed64<F> x) noexcept
+		{
+			return f64::atan<F, F, false>(x);
+		}
+
+		template <unsigned int F>
+		constexpr inline fixed64<F> atan2(fixed64<F> y, fixed64<F> x) noexcept
+		{
+			return f64::atan2<F, F, false>(y, x);
+		}
+	}
+
+	namespace internal
+	{
+		struct cordic_lut
+		{
+			// atan(2^-i) in binary turns, 2^64 per turn
+			static constexpr std::array<int64_t, 62> angle =
+			{
+				0x2000000000000000, 0x12E4051D9DF30866, 0x09FB385B5EE39E8E, 0x051111D41DDD9A1B,
+				0x028B0D430E589AED, 0x0145D7E159046278, 0x00A2F61E5C28262A, 0x00517C5511D442AF,
+				0x0028BE5346D0C337, 0x00145F2EBB30AB38, 0x000A2F980091BA7B, 0x000517CC14A80CB7,
+				0x00028BE60CDFEC62, 0x000145F306C172F2, 0x0000A2F9836AE911, 0x0000517CC1B6BA7C,
+				0x000028BE60DB85FC, 0x0000145F306DC816, 0x00000A2F9836E4AE, 0x00000517CC1B726B,
+				0x0000028BE60DB938, 0x00000145F306DC9C, 0x000000A2F9836E4E, 0x000000517CC1B727,
+				0x00000028BE60DB94, 0x000000145F306DCA, 0x0000000A2F9836E5, 0x0000000517CC1B72,
+				0x000000028BE60DB9, 0x0000000145F306DD, 0x00000000A2F9836E, 0x00000000517CC1B7,
+				0x0000000028BE60DC, 0x00000000145F306E, 0x000000000A2F9837, 0x000000000517CC1B,
+				0x00000000028BE60E, 0x000000000145F307, 0x0000000000A2F983, 0x0000000000517CC2,
+				0x000000000028BE61, 0x0000000000145F30, 0x00000000000A2F98, 0x00000000000517CC,
+				0x0000000000028BE6, 0x00000000000145F3, 0x000000000000A2FA, 0x000000000000517D,
+				0x00000000000028BE, 0x000000000000145F, 0x0000000000000A30, 0x0000000000000518,
+				0x000000000000028C, 0x0000000000000146, 0x00000000000000A3, 0x0000000000000051,
+				0x0000000000000029, 0x0000000000000014, 0x000000000000000A, 0x0000000000000005,
+				0x0000000000000003, 0x0000000000000001,
+			};
+
+			// 1 / prod(sqrt(1 + 2^-2i)) in Q1.62, converged well before the 24th step
+			static constexpr int64_t GAIN = 2800459870029452954ll;
+		};
+
+		// one step per bit of the result, F + 2 covers the rounding of the last one
+		template <unsigned int F>
+		constexpr FIXED_64_FORCEINLINE int cordic_iterations() noexcept
+		{
+			return F + 2 < 24 ? 24 : (F + 2 > 62 ? 62 : int(F + 2));
+		}
+
+		// scales x and y together so the larger magnitude lands in [2^59, 2^60),
+		// which leaves room for the CORDIC gain. returns the left shift applied.
+		constexpr FIXED_64_FORCEINLINE int cordic_normalize(int64_t& x, int64_t& y) noexcept
+		{
+			const uint64_t ax = x >= 0 ? uint64_t(x) : uint64_t(0) - uint64_t(x);
+			const uint64_t ay = y >= 0 ? uint64_t(y) : uint64_t(0) - uint64_t(y);
+			const int shift = int(fixed64<0>::clz(ax > ay ? ax : ay)) - 4;
+			if (shift >= 0)
+			{
+				x = int64_t(uint64_t(x) << shift);
+				y = int64_t(uint64_t(y) << shift);
+			}
+			else
+			{
+				x >>= -shift;
+				y >>= -shift;
+			}
+			return shift;
+		}
+
+		// removes the gain and the normalization shift, saturated
+		template <unsigned int F>
+		constexpr FIXED_64_FORCEINLINE fixed64<F> cordic_result(int64_t v, int shift) noexcept
+		{
+			using Fixed = fixed64<F>;
+			const int64_t g = mul_shift(v, cordic_lut::GAIN, 62);
+			if (shift > 0)
+				return Fixed::from_raw((g + (int64_t(1) << (shift - 1))) >> shift);
+
+			if (g > (Fixed::MAXIMUM >> -shift) || g < -(Fixed::MAXIMUM >> -shift))
+			{
+				FIXED_64_OVERFLOW_ALERT();
+				return Fixed::from_raw(g > 0 ? Fixed::MAXIMUM : Fixed::MINIMUM);
+			}
+			return Fixed::from_raw(int64_t(uint64_t(g) << -shift));
+		}
+
+		// rotation mode, turns (x, y) by z in [-1/8, 1/8] turn while driving z to 0.
+		// the direction is a sign mask, (v ^ d) - d negates v when d is -1.
+		template <int N>
+		constexpr FIXED_64_FORCEINLINE void cordic_rotate(int64_t& x, int64_t& y, int64_t z) noexcept
+		{
+			for (int i = 0; i < N; ++i)
+			{
+				const int64_t d = z >> 63;
+				const int64_t dx = ((y >> i) ^ d) - d;
+				const int64_t dy = ((x >> i) ^ d) - d;
+				x -= dx;
+				y += dy;
+				z -= (cordic_lut::angle[i] ^ d) - d;
+			}
+		}
+
+		// vectoring mode, turns (x, y) with x >= 0 onto the x axis and accumulates the angle
+		template <int N>
+		constexpr FIXED_64_FORCEINLINE void cordic_vector(int64_t& x, int64_t& y, uint64_t& z) noexcept
+		{
+			for (int i = 0; i < N; ++i)
+			{
+				const int64_t d = y >> 63;
+				const int64_t dx = ((y >> i) ^ d) - d;
+				const int64_t dy = ((x >> i) ^ d) - d;
+				x += dx;
+				y -= dy;
+				z += uint64_t((cordic_lut::angle[i] ^ d) - d);
 			}
 		}
-		return result;
 	}
 
-	template <unsigned int F>
-	constexpr inline fixed64<F> pow(fixed64<F> base, fixed64<F> exp) noexcept
+	// CORDIC, shift-and-add rotations on the raw values with the gain removed by
+	// a single multiply at the end. Every function gives both outputs of one pass,
+	// and all functions are constexpr.
+	namespace cordic
 	{
-		using Fixed = fixed64<F>;
+		// (x, y) rotated counterclockwise by a
+		template <unsigned int F>
+		constexpr inline void rotate(fixed64<F> x, fixed64<F> y, angle a, fixed64<F>* rx, fixed64<F>* ry) noexcept
+		{
+			// exact quarter turns first, the remainder is within an octant
+			const uint64_t turn = a.raw_value();
+			const uint64_t quadrant = (turn + (uint64_t(1) << 61)) >> 62;
+			const int64_t z = int64_t(turn - (quadrant << 62));
+
+			int64_t vx = x.raw_value();
+			int64_t vy = y.raw_value();
+			if (quadrant & 1)
+			{
+				const int64_t t = vx;
+				vx = -vy;
+				vy = t;
+			}
+			if (quadrant & 2)
+			{
+				vx = -vx;
+				vy = -vy;
+			}
 
-		if (base == Fixed(0)) {
-			FIXED_64_ASSERT(exp > Fixed(0));
-			return Fixed(0);
+			const int shift = internal::cordic_normalize(vx, vy);
+			internal::cordic_rotate<internal::cordic_iterations<F>()>(vx, vy, z);
+			*rx = internal::cordic_result<F>(vx, shift);
+			*ry = internal::cordic_result<F>(vy, shift);
 		}
 
-		if (exp < Fixed(0))
+		template <unsigned int F>
+		constexpr inline void rotate(fixed64<F> x, fixed64<F> y, fixed64<F> rad, fixed64<F>* rx, fixed64<F>* ry) noexcept
 		{
-			return 1 / pow(base, -exp);
+			rotate(x, y, angle::from_radians(rad), rx, ry);
 		}
 
-		constexpr auto FRAC = Fixed::FRACTION;
-		if (exp.raw_value() % FRAC == 0)
+		// (r cos(theta), r sin(theta))
+		template <unsigned int F>
+		constexpr inline void polar(fixed64<F> r, angle theta, fixed64<F>* x, fixed64<F>* y) noexcept
 		{
-			return pow(base, exp.raw_value() / FRAC);
+			rotate(r, fixed64<F>::from_raw(0), theta, x, y);
 		}
 
-		FIXED_64_ASSERT(base > Fixed(0));
-		return exp2(log2(base) * exp);
-	}
-
-
-	template <unsigned int F>
-	constexpr inline fixed64<F> exp(fixed64<F> x) noexcept
-	{
-		using Fixed = fixed64<F>;
-		if (x < Fixed(0)) {
-			return 1 / exp(-x);
+		template <unsigned int F>
+		constexpr inline void polar(fixed64<F> r, fixed64<F> theta, fixed64<F>* x, fixed64<F>* y) noexcept
+		{
+			rotate(r, fixed64<F>::from_raw(0), angle::from_radians(theta), x, y);
 		}
-		constexpr auto FRAC = Fixed::FRACTION;
-		auto x_int = x.raw_value() / FRAC;
-		x -= x_int;
-		FIXED_64_ASSERT(x >= Fixed(0) && x < Fixed(1));
 
-		constexpr Fixed fA = Fixed(1.3903728105644451e-2); // 
-		constexpr Fixed fB = Fixed(3.4800571158543038e-2); // 
-		constexpr Fixed fC = Fixed(1.7040197373796334e-1); // 
-		constexpr Fixed fD = Fixed(4.9909609871464493e-1); // 
-		constexpr Fixed fE = Fixed(1.0000794567422495); // 
-		constexpr Fixed fF = Fixed(9.9999887043019773e-1); // 
+		// hypot(x, y) and atan2(y, x) in one pass, (0, 0) gives (0, 0)
+		template <unsigned int F>
+		constexpr inline void vector_to_polar(fixed64<F> x, fixed64<F> y, fixed64<F>* r, angle* theta) noexcept
+		{
+			int64_t vx = x.raw_value();
+			int64_t vy = y.raw_value();
+			if (vx == 0 && vy == 0)
+			{
+				*r = fixed64<F>::from_raw(0);
+				*theta = angle::from_raw(0);
+				return;
+			}
 
-		return  pow(Fixed::e(), x_int) * (((((fA * x + fB) * x + fC) * x + fD) * x + fE) * x + fF);
-	}
+			uint64_t z = 0;
+			if (vx < 0)
+			{
+				vx = -vx;
+				vy = -vy;
+				z = angle::HALF_TURN;
+			}
 
-	template < unsigned int F>
-	constexpr inline fixed64<F> exp2(fixed64<F> x) noexcept
-	{
-		using Fixed = fixed64<F>;
-		if (x < Fixed(0)) {
-			return 1 / exp2(-x);
+			const int shift = internal::cordic_normalize(vx, vy);
+			internal::cordic_vector<internal::cordic_iterations<F>()>(vx, vy, z);
+			*r = internal::cordic_result<F>(vx, shift);
+			*theta = angle::from_raw(z);
 		}
 
-		constexpr auto FRAC = Fixed::FRACTION;
-		const auto x_int = x.raw_value() / FRAC;
-		x -= x_int;
-		FIXED_64_ASSERT(x >= Fixed(0) && x < Fixed(1));
-
-		constexpr auto fA = Fixed(1.8964611454333148e-3);
-		constexpr auto fB = Fixed(8.9428289841091295e-3);
-		constexpr auto fC = Fixed(5.5866246304520701e-2);
-		constexpr auto fD = Fixed(2.4013971109076949e-1);
-		constexpr auto fE = Fixed(6.9315475247516736e-1);
-		constexpr auto fF = Fixed(9.9999989311082668e-1);
-		return Fixed(typename Fixed::internal_type(1) << x_int) * (((((fA * x + fB) * x + fC) * x + fD) * x + fE) * x + fF);
+		// theta in radians, its sign follows y like atan2 so the last step
+		// can not flip pi into -pi. F is at most 60, see angle::radians.
+		template <unsigned int F>
+		constexpr inline void vector_to_polar(fixed64<F> x, fixed64<F> y, fixed64<F>* r, fixed64<F>* theta) noexcept
+		{
+			angle a{};
+			vector_to_polar(x, y, r, &a);
+			const fixed64<F> rad = a.template radians<F>();
+			*theta = (y.raw_value() < 0) != (rad.raw_value() < 0) ? -rad : rad;
+		}
 	}
 
-	template < unsigned int F>
-	constexpr inline fixed64<F> log2(fixed64<F> x) noexcept
+	namespace internal
 	{
-		using Fixed = fixed64<F>;
-		FIXED_64_ASSERT(x > Fixed(0));
+		// cos(pi * m / n) in Q1.62 by Taylor series after folding onto [0, pi/2]
+		constexpr inline int64_t cos_pi_q62(uint64_t m, uint64_t n) noexcept
+		{
+			constexpr uint64_t HALF_PI = 7244019458077122842ull; // Q2.62
 
-		// Normalize input to the [1:2] domain
-		auto value = x.raw_value();
-		const long highest = sizeof(decltype(value)) * 8 - Fixed::clz(value) - 1;
-		if (highest >= F) {
-			value >>= (highest - F);
-		}
-		else {
-			value <<= (F - highest);
-		}
-		x = Fixed::from_raw(value);
-		FIXED_64_ASSERT(x >= Fixed(1) && x < Fixed(2));
+			m %= 2 * n;
+			if (m > n)
+				m = 2 * n - m;
+			const bool negative = 2 * m > n;
+			if (negative)
+				m = n - m;
 
-		constexpr auto fA = Fixed(4.4873610194131727e-2);
-		constexpr auto fB = Fixed(-4.1656368651734915e-1);
-		constexpr auto fC = Fixed(1.6311487636297217);
-		constexpr auto fD = Fixed(-3.5507929249026341);
-		constexpr auto fE = Fixed(5.0917108110420042);
-		constexpr auto fF = Fixed(-2.8003640347009253);
-		return Fixed(highest - F) + (((((fA * x + fB) * x + fC) * x + fD) * x + fE) * x + fF);
-	}
+			const uint64_t x = (uint128::mul(HALF_PI, div_q62(2 * m, n)) >> 62).lo;
+			const uint64_t xx = (uint128::mul(x, x) >> 62).lo;
 
-	template <unsigned int F>
-	constexpr fixed64<F> log(fixed64<F> x) noexcept
-	{
-		using Fixed = fixed64<F>;
-#if FIXED_64_ENABLE_CPP20
-		constexpr Fixed log2_e = log2(Fixed::e());
-#else
-		static const Fixed log2_e = log2(Fixed::e());
-#endif
-		return log2(x) / log2_e;
+			uint64_t term = uint64_t(1) << 62;
+			int64_t sum = int64_t(term);
+			for (uint64_t i = 1; term != 0; ++i)
+			{
+				term = (uint128::mul(term, xx) >> 62).lo / ((2 * i - 1) * (2 * i));
+				sum += (i & 1) ? -int64_t(term) : int64_t(term);
+			}
+			return negative ? -sum : sum;
+		}
 	}
 
-	template <unsigned int F>
-	constexpr fixed64<F> log10(fixed64<F> x) noexcept
+	// Chebyshev interpolant of a function over [lo, hi], fitted in compile time at
+	// DEGREE + 1 Chebyshev nodes. For smooth functions it is within a small factor
+	// of the minimax polynomial of the same degree. It is evaluated by Clenshaw's
+	// recurrence on the raw values, inputs are clamped to [lo, hi].
+	//
+	//   constexpr auto falloff = chebyshev<32, 6>::fit([](fixed64<32> x) { return exp(-(x * x)); }, 0, 2);
+	//   static_assert(falloff.max_error() < 0.0001, "");
+	template <unsigned int F, int DEGREE>
+	class chebyshev
 	{
-		using Fixed = fixed64<F>;
-#if FIXED_64_ENABLE_CPP20
-		constexpr Fixed log2_10 = log2(Fixed(10));
-#else
-		static const Fixed log2_10 = log2(Fixed(10));
-#endif
-		return log2(x) / log2_10;
-	}
+		static_assert(DEGREE >= 0 && DEGREE < 64, "DEGREE should be in [0, 63]");
 
+	public:
+		using fixed = fixed64<F>;
+		static constexpr int NODES = DEGREE + 1;
 
-	template<unsigned int F>
-	constexpr inline fixed64<F> sqrt(fixed64<F> v) noexcept
-	{
-		/*
-			from https://en.wikipedia.org/wiki/Methods_of_computing_square_roots#Binary_numeral_system_.28base_2.29
-		*/
-		FIXED_64_ASSERT(v >= 0 && "sqrt input should be non-negative");
-
-		if (v.raw_value() == 0)
+	public:
+		// func is called on fixed64<F> in compile time, hi - lo should be at least 2 ulp
+		template <typename Func>
+		static constexpr chebyshev fit(Func func, fixed lo, fixed hi) noexcept
 		{
-			return v;
-		}
-
-		using Fixed = fixed64<F>;
+			FIXED_64_ASSERT(hi.raw_value() - lo.raw_value() >= 2);
+
+			chebyshev ret{};
+			const uint64_t span = uint64_t(hi.raw_value()) - uint64_t(lo.raw_value());
+			ret.low = lo.raw_value();
+			ret.high = hi.raw_value();
+			ret.middle = int64_t(uint64_t(ret.low) + (span >> 1));
+
+			// t = 2 * (x - middle) / span in Q1.62
+			const int bits = internal::bit_length(span);
+			ret.scale = int64_t(internal::recip_q62(span << (64 - bits)));
+			ret.scale_shift = unsigned(bits - 2);
+
+			// nodes t_k = cos(pi * (2k + 1) / 2N)
+			int64_t t[NODES] = {};
+			int64_t y[NODES] = {};
+			uint64_t y_max = 0;
+			for (int k = 0; k < NODES; ++k)
+			{
+				t[k] = internal::cos_pi_q62(2 * k + 1, 2 * NODES);
+				const uint64_t dx = ((uint128::mul(uint64_t(t[k] < 0 ? -t[k] : t[k]), span) + uint128{ 0, uint64_t(1) << 62 }) >> 63).lo;
+				const int64_t x = t[k] < 0 ? int64_t(uint64_t(ret.middle) - dx) : int64_t(uint64_t(ret.middle) + dx);
+				y[k] = func(fixed::from_raw(x)).raw_value();
+				const uint64_t a = y[k] < 0 ? uint64_t(0) - uint64_t(y[k]) : uint64_t(y[k]);
+				y_max = a > y_max ? a : y_max;
+			}
 
-		uint64_t n = v.raw_value();
-		n <<= (F & 1);
+			// samples to Q(F + shift) below 2^57 so the sums over 64 nodes fit
+			int shift = y_max == 0 ? 0 : 57 - internal::bit_length(y_max);
+			for (int k = 0; k < NODES; ++k)
+				y[k] = shift >= 0 ? int64_t(uint64_t(y[k]) << shift) : internal::mul_shift(y[k], int64_t(1) << (63 + shift), 63);
 
-		uint64_t x = n;
-		uint64_t c = 0;
+			// c_j = 2 / N * sum y_k T_j(t_k), c_0 is halved
+			uint128 bound{};
+			for (int j = 0; j < NODES; ++j)
+			{
+				int64_t sum = 0;
+				for (int k = 0; k < NODES; ++k)
+					sum += internal::mul_shift(y[k], internal::cos_pi_q62(uint64_t(j) * (2 * k + 1), 2 * NODES), 62);
+
+				const int64_t num = j == 0 ? sum : 2 * sum;
+				ret.coeff[j] = (num + (num < 0 ? -NODES / 2 : NODES / 2)) / NODES;
+				const uint64_t a = ret.coeff[j] < 0 ? uint64_t(0) - uint64_t(ret.coeff[j]) : uint64_t(ret.coeff[j]);
+				bound = bound + uint128::mul(a, uint64_t(j + 1));
+			}
 
-		uint64_t d = uint64_t(1) << ( (64 - Fixed::clz(n) - 1) & ~(1) );
+			// every Clenshaw term is within sum (j + 1) * |c_j|, 2 t b within twice of it
+			const int top = bound.hi != 0 ? 64 + internal::bit_length(bound.hi) : internal::bit_length(bound.lo);
+			const int down = top + 2 > 62 ? top + 2 - 62 : 0;
+			for (int j = 0; j < NODES && down > 0; ++j)
+				ret.coeff[j] = (ret.coeff[j] + (int64_t(1) << (down - 1))) >> down;
+			ret.shift = shift - down;
+
+			// sampled on 8 points per node
+			constexpr int GRID_BITS = internal::bit_length(8 * NODES - 1);
+			const uint64_t step = span >> GRID_BITS;
+			const uint64_t rest = span & ((uint64_t(1) << GRID_BITS) - 1);
+			for (uint64_t i = 0; i <= (uint64_t(1) << GRID_BITS); ++i)
+			{
+				const fixed x = fixed::from_raw(int64_t(uint64_t(ret.low) + step * i + ((rest * i) >> GRID_BITS)));
+				const int64_t d = ret(x).raw_value() - func(x).raw_value();
+				ret.error = (d < 0 ? -d : d) > ret.error ? (d < 0 ? -d : d) : ret.error;
+			}
+			return ret;
+		}
 
-		while (d != 0)
+		constexpr FIXED_64_FORCEINLINE fixed operator()(fixed x) const noexcept
 		{
-			auto a = c + d;
-			if (x >= a)
+			const int64_t v = x.raw_value() < low ? low : x.raw_value() > high ? high : x.raw_value();
+			const int64_t t = internal::mul_shift(v - middle, scale, scale_shift);
+
+			int64_t b1 = 0, b2 = 0;
+			for (int j = DEGREE; j > 0; --j)
 			{
-				x -= a;
-				c = (c >> 1) + d;
+				const int64_t b0 = coeff[j] + internal::mul_shift(b1, t, 61) - b2;
+				b2 = b1;
+				b1 = b0;
 			}
-			else
+			const int64_t r = coeff[0] + internal::mul_shift(b1, t, 62) - b2;
+
+			if (shift > 0)
+				return fixed::from_raw((r + (int64_t(1) << (shift - 1))) >> shift);
+			if (r > (fixed::MAXIMUM >> -shift) || r < (fixed::MINIMUM >> -shift))
 			{
-				c >>= 1;
+				FIXED_64_OVERFLOW_ALERT();
+				return fixed::from_raw(r > 0 ? fixed::MAXIMUM : fixed::MINIMUM);
 			}
-			d >>= 2;
+			return fixed::from_raw(int64_t(uint64_t(r) << -shift));
 		}
 
-		return Fixed::from_raw(int64_t(c << (F / 2)));
-	}
+		// max |p(x) - func(x)| over a grid of 8 points per node, taken while fitting
+		constexpr FIXED_64_FORCEINLINE fixed max_error() const noexcept
+		{
+			return fixed::from_raw(error);
+		}
 
-	template <unsigned int F>
-	constexpr FIXED_64_FORCEINLINE fixed64<F> copysign(fixed64<F> x, fixed64<F> y) noexcept
+	private:
+		int64_t coeff[NODES] = {}; // Q(F + shift)
+		int64_t low = 0;
+		int64_t high = 0;
+		int64_t middle = 0;
+		int64_t scale = 0; // (x - middle) * scale >> scale_shift is t in Q1.62
+		unsigned int scale_shift = 0;
+		int shift = 0;
+		int64_t error = 0;
+	};
+
+	// Table of a function over [lo, hi] in N equal segments, generated in compile
+	// time. Each segment is interpolated by the polynomial of ORDER through equally
+	// spaced samples of it: 0 nearest, 1 linear, 2 quadratic, 3 cubic. Neighbouring
+	// segments share their end samples, so the curve is continuous from order 1 on.
+	// The segment and the position in it come from one multiply-shift, inputs are
+	// clamped to [lo, hi]. Large tables may need a higher constexpr step limit.
+	// max_error() is an estimate measured on 8 points per sample interval, not a
+	// bound. The function and the range are arguments of generate() rather than
+	// template parameters, since C++17 takes neither a lambda nor a fixed64 there.
+	//
+	//   constexpr auto drag = lut<32, 64, 3>::generate([](fixed64<32> v) { return v * sqrt(v); }, 0, 16);
+	//   static_assert(lut<32, 64, 3>::BYTES == 2048, "");
+	//   static_assert(drag.max_error() < 0.001, "");
+	template <unsigned int F, size_t N, int ORDER = 1>
+	class lut
 	{
-		x = abs(x);
-		return (y >= fixed64<F>{0}) ? x : -x;
-	}
+		static_assert(N >= 1 && N <= (size_t(1) << 24), "N should be in [1, 2^24]");
+		static_assert(ORDER >= 0 && ORDER <= 3, "ORDER should be in [0, 3]");
 
+	public:
+		using fixed = fixed64<F>;
+		static constexpr int TERMS = ORDER + 1;
+		static constexpr size_t COUNT = ORDER == 0 ? N + 1 : N;
+		static constexpr size_t BYTES = COUNT * TERMS * sizeof(int64_t);
 
-#if FIXED_64_ENABLE_TRIG_LUT
-	template <unsigned int F>
-	constexpr inline fixed64<F> sin(fixed64<F> x) noexcept
-	{
-		using Fixed = fixed64<F>;
-		x = fmod(x, Fixed::two_pi());
-		int sign = 1;
-		if (x > Fixed(0))
+	public:
+		// func is called on fixed64<F> in compile time, hi - lo should be at least
+		// 2 ulp and 1 ulp per sample
+		template <typename Func>
+		static constexpr lut generate(Func func, fixed lo, fixed hi) noexcept
 		{
-			if (x > Fixed::pi())
+			FIXED_64_ASSERT(hi.raw_value() - lo.raw_value() >= 2 && uint64_t(hi.raw_value() - lo.raw_value()) >= SAMPLES);
+
+			lut ret{};
+			const uint64_t span = uint64_t(hi.raw_value()) - uint64_t(lo.raw_value());
+			ret.low = lo.raw_value();
+			ret.high = hi.raw_value();
+
+			// (x - lo) * scale >> scale_shift is N (x - lo) / span in Q(POSITION)
+			const int bits = internal::bit_length(span);
+			ret.scale = (uint128::mul(internal::recip_q62(span << (64 - bits)), N) >> internal::bit_length(N)).lo;
+			ret.scale_shift = unsigned(bits - 2);
+
+			// samples at lo + span * k / SAMPLES, kept in the table until their segment is converted
+			const uint64_t step = span / SAMPLES;
+			const uint64_t rest = span % SAMPLES;
+			uint64_t y_max = 0;
+			for (uint64_t k = 0; k <= SAMPLES; ++k)
 			{
-				sign = -1;
-				x = abs(Fixed::pi() - x);
+				const int64_t y = func(fixed::from_raw(int64_t(uint64_t(ret.low) + step * k + rest * k / SAMPLES))).raw_value();
+				ret.data[k] = y;
+				const uint64_t a = y < 0 ? uint64_t(0) - uint64_t(y) : uint64_t(y);
+				y_max = a > y_max ? a : y_max;
 			}
-			else
-				sign = 1;
 
+			// samples to Q(F + shift) below 2^55, the coefficients of a cubic sum to 111 times of it
+			const int shift = y_max == 0 ? 0 : 55 - internal::bit_length(y_max);
+			for (uint64_t k = 0; k <= SAMPLES; ++k)
+				ret.data[k] = shift >= 0 ? int64_t(uint64_t(ret.data[k]) << shift) : internal::mul_shift(ret.data[k], int64_t(1) << (63 + shift), 63);
+			ret.shift = shift;
+
+			// power basis in the position t in [0, 1] from forward differences, last segment
+			// first so no sample is overwritten before it is read
+			for (size_t i = COUNT; ORDER > 0 && i-- > 0;)
+			{
+				int64_t y[TERMS] = {};
+				for (int j = 0; j < TERMS; ++j)
+					y[j] = ret.data[i * ORDER + j];
+
+				int64_t* c = ret.data + i * TERMS;
+				c[0] = y[0];
+				if (ORDER == 1)
+				{
+					c[1] = y[1] - y[0];
+				}
+				else if (ORDER == 2)
+				{
+					c[1] = 4 * y[1] - 3 * y[0] - y[2];
+					c[2] = 2 * (y[0] + y[2]) - 4 * y[1];
+				}
+				else
+				{
+					const int64_t d1 = y[1] - y[0];
+					const int64_t d2 = y[2] - 2 * y[1] + y[0];
+					const int64_t d3 = y[3] - 3 * (y[2] - y[1]) - y[0];
+					c[1] = (6 * d1 - 3 * d2 + 2 * d3 + 1) >> 1;
+					c[2] = (9 * (d2 - d3) + 1) >> 1;
+					c[3] = (9 * d3 + 1) >> 1;
+				}
+			}
+
+			// measured on CHECKS points per interval between samples, the largest error of
+			// a cubic is off the middle of its interval
+			constexpr uint64_t POINTS = CHECKS * SAMPLES;
+			const uint64_t check_step = span / POINTS;
+			const uint64_t check_rest = span % POINTS;
+			for (uint64_t k = 1; k < POINTS; ++k)
+			{
+				const fixed x = fixed::from_raw(int64_t(uint64_t(ret.low) + check_step * k + check_rest * k / POINTS));
+				const int64_t d = ret(x).raw_value() - func(x).raw_value();
+				ret.error = (d < 0 ? -d : d) > ret.error ? (d < 0 ? -d : d) : ret.error;
+			}
+			return ret;
 		}
-		else
+
+		constexpr FIXED_64_FORCEINLINE fixed operator()(fixed x) const noexcept
 		{
-			if (x < -Fixed::pi())
+			const int64_t v = x.raw_value() < low ? low : x.raw_value() > high ? high : x.raw_value();
+			const uint64_t pos = (uint128::mul(uint64_t(v) - uint64_t(low), scale) >> scale_shift).lo;
+
+			int64_t r = 0;
+			if (ORDER == 0)
 			{
-				sign = 1;
-				x = -abs(Fixed::pi() + x);
+				const uint64_t i = (pos + (uint64_t(1) << (POSITION - 1))) >> POSITION;
+				r = data[i < N ? i : N];
 			}
 			else
-				sign = -1;
+			{
+				const uint64_t i = (pos >> POSITION) < N ? pos >> POSITION : N - 1;
+				const int64_t t = int64_t(pos - (i << POSITION));
+				r = internal::estrin_eval<POSITION, TERMS>(data + i * TERMS, t);
+			}
+
+			if (shift > 0)
+				return fixed::from_raw((r + (int64_t(1) << (shift - 1))) >> shift);
+			if (r > (fixed::MAXIMUM >> -shift) || r < (fixed::MINIMUM >> -shift))
+			{
+				FIXED_64_OVERFLOW_ALERT();
+				return fixed::from_raw(r > 0 ? fixed::MAXIMUM : fixed::MINIMUM);
+			}
+			return fixed::from_raw(int64_t(uint64_t(r) << -shift));
+		}
 
+		// max |lut(x) - func(x)| on 8 points per interval between samples, taken while
+		// generating. An estimate rather than a bound: between the points the error
+		// may run a few percent higher, plus the rounding of the table, so compare it
+		// with some margin.
+		constexpr FIXED_64_FORCEINLINE fixed max_error() const noexcept
+		{
+			return fixed::from_raw(error);
 		}
 
+	private:
+		static constexpr uint64_t SAMPLES = uint64_t(N) * (ORDER == 0 ? 1 : ORDER);
+		static constexpr uint64_t CHECKS = 8;
+		static constexpr unsigned int POSITION = unsigned(63 - internal::bit_length(N));
+
+		int64_t data[COUNT * TERMS] = {}; // Q(F + shift), TERMS coefficients per segment
+		int64_t low = 0;
+		int64_t high = 0;
+		uint64_t scale = 0; // (x - low) * scale >> scale_shift is the position in Q(POSITION)
+		unsigned int scale_shift = 0;
+		int shift = 0;
+		int64_t error = 0;
+	};
+
+	namespace internal
+	{
+		// gradient directions of the noise, every component is -1, 0 or 1 so a dot
+		// product only takes integer multiplies
+		template <int D>
+		struct noise_gradients;
+
+		template <>
+		struct noise_gradients<2>
+		{
+			static constexpr unsigned int MASK = 7;
+			static constexpr int8_t data[8][2] = {
+				{ 1, 1 }, { -1, 1 }, { 1, -1 }, { -1, -1 },
+				{ 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 },
+			};
+		};
 
-		auto index = abs(x).raw_value() / (Fixed::pi().raw_value() / FIXED_64_TRIG_LUT_COUNT);
-		//auto val = Fixed(fixed64<62>::from_raw(sin_lut[index]));
-		auto val = Fixed::from_raw(sin_lut<F>::lut_dst[index]);
+		// the 12 edges of a cube, 4 of them twice to fill 16 entries
+		template <>
+		struct noise_gradients<3>
+		{
+			static constexpr unsigned int MASK = 15;
+			static constexpr int8_t data[16][3] = {
+				{ 1, 1, 0 }, { -1, 1, 0 }, { 1, -1, 0 }, { -1, -1, 0 },
+				{ 1, 0, 1 }, { -1, 0, 1 }, { 1, 0, -1 }, { -1, 0, -1 },
+				{ 0, 1, 1 }, { 0, -1, 1 }, { 0, 1, -1 }, { 0, -1, -1 },
+				{ 1, 1, 0 }, { -1, 1, 0 }, { 0, -1, 1 }, { 0, -1, -1 },
+			};
+		};
 
+		// the 32 edges of a tesseract
+		template <>
+		struct noise_gradients<4>
+		{
+			static constexpr unsigned int MASK = 31;
+			static constexpr int8_t data[32][4] = {
+				{ 0, 1, 1, 1 }, { 0, 1, 1, -1 }, { 0, 1, -1, 1 }, { 0, 1, -1, -1 },
+				{ 0, -1, 1, 1 }, { 0, -1, 1, -1 }, { 0, -1, -1, 1 }, { 0, -1, -1, -1 },
+				{ 1, 0, 1, 1 }, { 1, 0, 1, -1 }, { 1, 0, -1, 1 }, { 1, 0, -1, -1 },
+				{ -1, 0, 1, 1 }, { -1, 0, 1, -1 }, { -1, 0, -1, 1 }, { -1, 0, -1, -1 },
+				{ 1, 1, 0, 1 }, { 1, 1, 0, -1 }, { 1, -1, 0, 1 }, { 1, -1, 0, -1 },
+				{ -1, 1, 0, 1 }, { -1, 1, 0, -1 }, { -1, -1, 0, 1 }, { -1, -1, 0, -1 },
+				{ 1, 1, 1, 0 }, { 1, 1, -1, 0 }, { 1, -1, 1, 0 }, { 1, -1, -1, 0 },
+				{ -1, 1, 1, 0 }, { -1, 1, -1, 0 }, { -1, -1, 1, 0 }, { -1, -1, -1, 0 },
+			};
+		};
 
-		return sign * val;
+		// splitmix64, the next value of the sequence started by state
+		constexpr FIXED_64_FORCEINLINE uint64_t mix64(uint64_t& state) noexcept
+		{
+			state += 0x9E3779B97F4A7C15ull;
+			uint64_t z = state;
+			z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+			z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+			return z ^ (z >> 31);
+		}
 	}
-#else
+
+	// Perlin and simplex gradient noise in 2, 3 and 4 dimensions, bit identical on
+	// every platform. Lattice points are hashed through a permutation of 0 .. 255
+	// shuffled from the seed by an integer generator, gradients come from small
+	// tables and fades, falloffs and interpolation run on fixed64<F> multiplies.
+	// Results are about in [-1, 1], the pattern repeats every 256 units.
+	//
+	//   gradient_noise<32> noise(seed);
+	//   noise.simplex_grid(x0, y0, fixed64<32>(0.05), 256, 256, height);
 	template <unsigned int F>
-	constexpr inline fixed64<F> sin(fixed64<F> x) noexcept
+	class gradient_noise
 	{
-		using Fixed = fixed64<F>;
+		static_assert(F >= 8 && F <= 58, "F should be in [8, 58]");
+
+	public:
+		using fixed = fixed64<F>;
+		static constexpr size_t PERIOD = 256;
 
-		x = fmod(x, Fixed::two_pi());
-		x = x / Fixed::half_pi();
+	public:
+		constexpr explicit gradient_noise(uint64_t seed = 0) noexcept
+		{
+			for (size_t i = 0; i < PERIOD; ++i)
+				perm[i] = uint8_t(i);
 
-		if (x < Fixed(0)) {
-			x += Fixed(4);
-		}
+			// Fisher-Yates, an index in [0, i] is the high half of next * (i + 1)
+			uint64_t state = seed;
+			for (size_t i = PERIOD - 1; i > 0; --i)
+			{
+				const size_t j = size_t(uint128::mul(internal::mix64(state), i + 1).hi);
+				const uint8_t t = perm[i];
+				perm[i] = perm[j];
+				perm[j] = t;
+			}
 
-		int sign = +1;
-		if (x > Fixed(2)) {
-			sign = -1;
-			x -= Fixed(2);
+			// doubled so a lattice index plus one never needs a mask
+			for (size_t i = 0; i < PERIOD; ++i)
+				perm[i + PERIOD] = perm[i];
 		}
 
-		if (x > Fixed(1)) {
-			x = Fixed(2) - x;
+		// Perlin's improved noise, fade 6t^5 - 15t^4 + 10t^3, 0 on every lattice point
+		FIXED_64_FORCEINLINE fixed perlin(fixed x, fixed y) const noexcept
+		{
+			const fixed p[2] = { x, y };
+			return perlin_n<2>(p);
 		}
 
-		const Fixed x2 = x * x;
-		return sign * x * (Fixed::pi() - x2 * (Fixed::two_pi() - 5 - x2 * (Fixed::pi() - 3))) / 2;
-	}
-#endif
+		FIXED_64_FORCEINLINE fixed perlin(fixed x, fixed y, fixed z) const noexcept
+		{
+			const fixed p[3] = { x, y, z };
+			return perlin_n<3>(p);
+		}
 
-	template <unsigned int F>
-	constexpr inline fixed64<F> cos(fixed64<F> x) noexcept
-	{
-		using Fixed = fixed64<F>;
-		if (x > Fixed(0)) {
-			return sin(x - (Fixed::two_pi() - Fixed::half_pi()));
+		FIXED_64_FORCEINLINE fixed perlin(fixed x, fixed y, fixed z, fixed w) const noexcept
+		{
+			const fixed p[4] = { x, y, z, w };
+			return perlin_n<4>(p);
 		}
-		else {
-			return sin(Fixed::half_pi() + x);
+
+		// simplex noise after Gustavson, falloff (r^2 - d^2)^4 around the D + 1 corners
+		inline fixed simplex(fixed x, fixed y) const noexcept
+		{
+			const fixed SKEW = internal::from_q62<F>(1687994237021934823ll); // (sqrt(3) - 1) / 2
+			const fixed UNSKEW = internal::from_q62<F>(974563927135151027ll); // (3 - sqrt(3)) / 6
+
+			const fixed s = (x + y) * SKEW;
+			const int64_t i = floor_index(x + s), j = floor_index(y + s);
+			const fixed t = UNSKEW * (i + j);
+
+			fixed d[3][2] = {};
+			d[0][0] = x - fixed(i) + t;
+			d[0][1] = y - fixed(j) + t;
+
+			// the second corner steps along the larger offset
+			const int i1 = d[0][0] > d[0][1] ? 1 : 0, j1 = 1 - i1;
+			d[1][0] = d[0][0] - i1 + UNSKEW;
+			d[1][1] = d[0][1] - j1 + UNSKEW;
+			d[2][0] = d[0][0] - 1 + UNSKEW * 2;
+			d[2][1] = d[0][1] - 1 + UNSKEW * 2;
+
+			const unsigned int ii = unsigned(i) & 255, jj = unsigned(j) & 255;
+			const unsigned int h[3] = {
+				perm[ii + perm[jj]],
+				perm[ii + i1 + perm[jj + j1]],
+				perm[ii + 1 + perm[jj + 1]],
+			};
+
+			const fixed r = fixed(1) / 2;
+			return (corner<2>(r, h[0], d[0]) + corner<2>(r, h[1], d[1]) + corner<2>(r, h[2], d[2])) * 70;
 		}
-	}
 
-	template <unsigned int F>
-	constexpr inline fixed64<F> tan(fixed64<F> x) noexcept
-	{
-		auto cx = cos(x);
+		inline fixed simplex(fixed x, fixed y, fixed z) const noexcept
+		{
+			const fixed SKEW = internal::from_q62<F>(1537228672809129301ll); // 1 / 3
+			const fixed UNSKEW = internal::from_q62<F>(768614336404564651ll); // 1 / 6
 
-		FIXED_64_ASSERT(abs(cx).raw_value() > 1);
+			const fixed s = (x + y + z) * SKEW;
+			const int64_t i = floor_index(x + s), j = floor_index(y + s), k = floor_index(z + s);
+			const fixed t = UNSKEW * (i + j + k);
 
-		return sin(x) / cx;
-	}
+			fixed d[4][3] = {};
+			d[0][0] = x - fixed(i) + t;
+			d[0][1] = y - fixed(j) + t;
+			d[0][2] = z - fixed(k) + t;
 
+			// the middle corners step along the offsets from the largest to the smallest
+			int o[2][3] = {};
+			if (d[0][0] >= d[0][1])
+			{
+				if (d[0][1] >= d[0][2])
+					o[0][0] = 1, o[1][0] = 1, o[1][1] = 1;
+				else if (d[0][0] >= d[0][2])
+					o[0][0] = 1, o[1][0] = 1, o[1][2] = 1;
+				else
+					o[0][2] = 1, o[1][0] = 1, o[1][2] = 1;
+			}
+			else
+			{
+				if (d[0][1] < d[0][2])
+					o[0][2] = 1, o[1][1] = 1, o[1][2] = 1;
+				else if (d[0][0] < d[0][2])
+					o[0][1] = 1, o[1][1] = 1, o[1][2] = 1;
+				else
+					o[0][1] = 1, o[1][0] = 1, o[1][1] = 1;
+			}
 
-	namespace internal
-	{
-		template <unsigned int F>
-		constexpr inline fixed64<F> atan_sanitized(fixed64<F> x) noexcept
-		{
-			using Fixed = fixed64<F>;
-			FIXED_64_ASSERT(x >= Fixed(0) && x <= Fixed(1));
+			for (int a = 0; a < 3; ++a)
+			{
+				d[1][a] = d[0][a] - o[0][a] + UNSKEW;
+				d[2][a] = d[0][a] - o[1][a] + UNSKEW * 2;
+				d[3][a] = d[0][a] - 1 + UNSKEW * 3;
+			}
 
-			constexpr auto fA = Fixed(0.0776509570923569);
-			constexpr auto fB = Fixed(-0.287434475393028);
-			constexpr auto fC = Fixed(0.995181681698119); //    (PI/4 - A - B)
+			const unsigned int ii = unsigned(i) & 255, jj = unsigned(j) & 255, kk = unsigned(k) & 255;
+			const unsigned int h[4] = {
+				perm[ii + perm[jj + perm[kk]]],
+				perm[ii + o[0][0] + perm[jj + o[0][1] + perm[kk + o[0][2]]]],
+				perm[ii + o[1][0] + perm[jj + o[1][1] + perm[kk + o[1][2]]]],
+				perm[ii + 1 + perm[jj + 1 + perm[kk + 1]]],
+			};
+
+			const fixed r = fixed(3) / 5;
+			fixed n = 0;
+			for (int c = 0; c < 4; ++c)
+				n += corner<3>(r, h[c], d[c]);
+			return n * 32;
+		}
 
-			const auto xx = x * x;
-			return ((fA * xx + fB) * xx + fC) * x;
-		};
-		template <unsigned int F>
-		constexpr inline fixed64<F> atan_div(fixed64<F> y, fixed64<F> x) noexcept
+		inline fixed simplex(fixed x, fixed y, fixed z, fixed w) const noexcept
 		{
-			using Fixed = fixed64<F>;
-			FIXED_64_ASSERT(x != Fixed(0));
-
-			if (y < Fixed(0)) {
-				if (x < Fixed(0)) {
-					return atan_div(-y, -x);
+			const fixed SKEW = internal::from_q62<F>(1425089352415399811ll); // (sqrt(5) - 1) / 4
+			const fixed UNSKEW = internal::from_q62<F>(637319333202397619ll); // (5 - sqrt(5)) / 20
+
+			const fixed p[4] = { x, y, z, w };
+			const fixed s = (x + y + z + w) * SKEW;
+			int64_t cell[4] = {};
+			for (int a = 0; a < 4; ++a)
+				cell[a] = floor_index(p[a] + s);
+			const fixed t = UNSKEW * (cell[0] + cell[1] + cell[2] + cell[3]);
+
+			fixed d[5][4] = {};
+			for (int a = 0; a < 4; ++a)
+				d[0][a] = p[a] - fixed(cell[a]) + t;
+
+			// the rank of every offset orders the steps of the middle corners
+			int rank[4] = {};
+			for (int a = 0; a < 4; ++a)
+				for (int b = a + 1; b < 4; ++b)
+					++rank[d[0][a] > d[0][b] ? a : b];
+
+			unsigned int lattice[4] = {};
+			int o[3][4] = {};
+			for (int a = 0; a < 4; ++a)
+			{
+				lattice[a] = unsigned(cell[a]) & 255;
+				for (int c = 0; c < 3; ++c)
+				{
+					o[c][a] = rank[a] >= 3 - c ? 1 : 0;
+					d[c + 1][a] = d[0][a] - o[c][a] + UNSKEW * (c + 1);
 				}
-				return -atan_div(-y, x);
-			}
-			if (x < Fixed(0)) {
-				return -atan_div(y, -x);
+				d[4][a] = d[0][a] - 1 + UNSKEW * 4;
 			}
-			FIXED_64_ASSERT(y >= Fixed(0));
-			FIXED_64_ASSERT(x > Fixed(0));
 
-			if (y > x) {
-				return Fixed::half_pi() - internal::atan_sanitized(x / y);
+			unsigned int h[5] = {};
+			for (int c = 0; c < 5; ++c)
+			{
+				unsigned int v = 0;
+				for (int a = 3; a >= 0; --a)
+					v = perm[lattice[a] + (c == 0 ? 0 : c == 4 ? 1 : o[c - 1][a]) + v];
+				h[c] = v;
 			}
-			return internal::atan_sanitized(y / x);
-		}
-	}
 
-	template <unsigned int F>
-	constexpr inline fixed64<F> atan(fixed64<F> x) noexcept
-	{
-		using Fixed = fixed64<F>;
+			const fixed r = fixed(3) / 5;
+			fixed n = 0;
+			for (int c = 0; c < 5; ++c)
+				n += corner<4>(r, h[c], d[c]);
+			return n * 27;
+		}
 
-		if (x < Fixed(0))
+		// the shuffled permutation, PERIOD entries then the same again
+		constexpr FIXED_64_FORCEINLINE const uint8_t* permutation() const noexcept
 		{
-			return -atan(-x);
+			return perm;
 		}
 
-		if (x > Fixed(1))
+		// out[j * nx + i] at (x0 + i * step, y0 + j * step)
+		inline void perlin_grid(fixed x0, fixed y0, fixed step, size_t nx, size_t ny, fixed* out) const noexcept
 		{
-			return Fixed::half_pi() - internal::atan_sanitized(Fixed(1) / x);
+			grid(x0, y0, step, nx, ny, out, [this](fixed x, fixed y) { return perlin(x, y); });
 		}
 
-		return internal::atan_sanitized(x);
-	}
-
-	template <unsigned int F>
-	constexpr inline fixed64<F> atan2(fixed64<F> y, fixed64<F> x) noexcept
-	{
-		using Fixed = fixed64<F>;
-		if (x == Fixed(0))
+		// out[(k * ny + j) * nx + i] at (x0 + i * step, y0 + j * step, z0 + k * step)
+		inline void perlin_grid(fixed x0, fixed y0, fixed z0, fixed step, size_t nx, size_t ny, size_t nz, fixed* out) const noexcept
 		{
-			FIXED_64_ASSERT(y != Fixed(0));
-			return (y > Fixed(0)) ? Fixed::half_pi() : -Fixed::half_pi();
+			for (size_t k = 0; k < nz; ++k)
+			{
+				const fixed z = z0 + step * int64_t(k);
+				grid(x0, y0, step, nx, ny, out + k * ny * nx, [this, z](fixed x, fixed y) { return perlin(x, y, z); });
+			}
 		}
 
-		auto ret = internal::atan_div(y, x);
+		inline void simplex_grid(fixed x0, fixed y0, fixed step, size_t nx, size_t ny, fixed* out) const noexcept
+		{
+			grid(x0, y0, step, nx, ny, out, [this](fixed x, fixed y) { return simplex(x, y); });
+		}
 
-		if (x < Fixed(0))
+		inline void simplex_grid(fixed x0, fixed y0, fixed z0, fixed step, size_t nx, size_t ny, size_t nz, fixed* out) const noexcept
 		{
-			return (y >= Fixed(0)) ? ret + Fixed::pi() : ret - Fixed::pi();
+			for (size_t k = 0; k < nz; ++k)
+			{
+				const fixed z = z0 + step * int64_t(k);
+				grid(x0, y0, step, nx, ny, out + k * ny * nx, [this, z](fixed x, fixed y) { return simplex(x, y, z); });
+			}
 		}
-		return ret;
-	}
 
+	private:
+		static FIXED_64_FORCEINLINE int64_t floor_index(fixed v) noexcept
+		{
+			return v.raw_value() >> F;
+		}
 
-	template <unsigned int F>
-	constexpr inline fixed64<F> asin(fixed64<F> x) noexcept
-	{
-		using Fixed = fixed64<F>;
-		FIXED_64_ASSERT(x >= Fixed(-1) && x <= Fixed(+1));
+		template <int D>
+		static FIXED_64_FORCEINLINE fixed dot(unsigned int h, const fixed* d) noexcept
+		{
+			const int8_t* g = internal::noise_gradients<D>::data[h & internal::noise_gradients<D>::MASK];
+			fixed r = d[0] * g[0];
+			for (int a = 1; a < D; ++a)
+				r += d[a] * g[a];
+			return r;
+		}
 
-		const auto yy = Fixed(1) - x * x;
-		if (yy == Fixed(0))
+		template <int D>
+		static FIXED_64_FORCEINLINE fixed corner(fixed r, unsigned int h, const fixed* d) noexcept
 		{
-			return copysign(Fixed::half_pi(), x);
+			fixed t = r;
+			for (int a = 0; a < D; ++a)
+				t -= d[a] * d[a];
+			if (t.raw_value() <= 0)
+				return fixed(0);
+			t *= t;
+			return t * t * dot<D>(h, d);
 		}
-		return internal::atan_div(x, sqrt(yy));
-	}
 
-	template <unsigned int F>
-	constexpr inline fixed64<F> acos(fixed64<F> x) noexcept
-	{
-		using Fixed = fixed64<F>;
-		FIXED_64_ASSERT(x >= Fixed(-1) && x <= Fixed(+1));
+		// the 2^D corners of the cell, then D rounds of interpolation along one axis each
+		template <int D>
+		FIXED_64_FORCEINLINE fixed perlin_n(const fixed* p) const noexcept
+		{
+			unsigned int lattice[D] = {};
+			fixed frac[D] = {};
+			fixed fade[D] = {};
+			for (int a = 0; a < D; ++a)
+			{
+				lattice[a] = unsigned(floor_index(p[a])) & 255;
+				frac[a] = fixed::from_raw(p[a].raw_value() & ((int64_t(1) << F) - 1));
+				const fixed t = frac[a];
+				fade[a] = t * t * t * (t * (t * 6 - 15) + 10);
+			}
+
+			fixed v[1 << D] = {};
+			for (int c = 0; c < (1 << D); ++c)
+			{
+				unsigned int h = 0;
+				fixed d[D] = {};
+				for (int a = D - 1; a >= 0; --a)
+				{
+					const int o = (c >> a) & 1;
+					h = perm[lattice[a] + o + h];
+					d[a] = frac[a] - o;
+				}
+				v[c] = dot<D>(h, d);
+			}
 
-		if (x == Fixed(-1))
+			for (int a = 0; a < D; ++a)
+				for (int c = 0; c < (1 << (D - 1 - a)); ++c)
+					v[c] = v[2 * c] + fade[a] * (v[2 * c + 1] - v[2 * c]);
+			return v[0];
+		}
+
+		template <typename Func>
+		static FIXED_64_FORCEINLINE void grid(fixed x0, fixed y0, fixed step, size_t nx, size_t ny, fixed* out, Func func) noexcept
 		{
-			return Fixed::pi();
+			for (size_t j = 0; j < ny; ++j)
+			{
+				const fixed y = y0 + step * int64_t(j);
+				for (size_t i = 0; i < nx; ++i)
+					out[j * nx + i] = func(x0 + step * int64_t(i), y);
+			}
 		}
-		const auto yy = Fixed(1) - x * x;
-		return Fixed(2) * internal::atan_div(sqrt(yy), Fixed(1) + x);
-	}
+
+	private:
+		uint8_t perm[2 * PERIOD] = {};
+	};
 
 	template<class Char, unsigned int F>
 	std::basic_ostream<Char>& operator<< (std::basic_ostream<Char>& os, fixed64<F> x) noexcept
@@ -0,0 +1,242 @@
+#ifndef FIXED_64_PIECEWISE_CHEBYSHEV_H
+#define FIXED_64_PIECEWISE_CHEBYSHEV_H
+
+#include "fixed64.hpp"
+#include <vector>
+
+namespace f64
+{
+	// Piecewise Chebyshev approximation built at run time, for curves that only exist
+	// as data. Every one of the uniform segments interpolates the curve at DEGREE + 1
+	// Chebyshev nodes and keeps the polynomial in the power basis of u in [-1, 1].
+	// Building runs on integers only, so every platform builds the same table.
+	// Evaluation clamps to [lo, hi], picks the segment by one multiply-shift and runs
+	// Estrin's scheme, with no data dependent branch. max_error() is measured on 4
+	// points per node of every segment, an estimate rather than a bound: between
+	// those points the error can be slightly larger.
+	//
+	//   piecewise_chebyshev<32> damping;
+	//   damping.fit(xs, ys, count, fixed64<32>(0.0001)); // measured error at most 0.0001
+	//   damping.evaluate(speed, out, n);
+	template <unsigned int F, int DEGREE = 3>
+	class piecewise_chebyshev
+	{
+		static_assert(DEGREE >= 0 && DEGREE <= 6, "DEGREE should be in [0, 6]");
+
+	public:
+		using fixed = fixed64<F>;
+		static constexpr int NODES = DEGREE + 1;
+		static constexpr size_t MAX_SEGMENTS = size_t(1) << 24;
+
+	public:
+		// func over [lo, hi] in the given number of segments, each at least 2 ulp wide
+		template <typename Func>
+		void fit(Func func, fixed lo, fixed hi, size_t segments)
+		{
+			const uint64_t span = uint64_t(hi.raw_value()) - uint64_t(lo.raw_value());
+			FIXED_64_ASSERT(hi > lo && segments >= 1 && segments <= MAX_SEGMENTS && span / segments >= 2);
+
+			count = segments;
+			low = lo.raw_value();
+			high = hi.raw_value();
+			coeff.assign(count * NODES, 0);
+
+			// (x - low) * scale >> scale_shift is count (x - low) / span in Q(position)
+			const int bits = internal::bit_length(span);
+			const int count_bits = internal::bit_length(count);
+			scale = (uint128::mul(internal::recip_q62(span << (64 - bits)), count) >> count_bits).lo;
+			scale_shift = unsigned(bits - 2);
+			position = unsigned(63 - count_bits);
+
+			// nodes t_k and T_j(t_k) in Q1.62, T_j in the power basis of u
+			int64_t t[NODES] = {};
+			int64_t cheb[NODES][NODES] = {};
+			int64_t basis[NODES][NODES] = {};
+			for (int k = 0; k < NODES; ++k)
+			{
+				t[k] = internal::cos_pi_q62(2 * k + 1, 2 * NODES);
+				for (int j = 0; j < NODES; ++j)
+					cheb[j][k] = internal::cos_pi_q62(uint64_t(j) * (2 * k + 1), 2 * NODES);
+			}
+			basis[0][0] = 1;
+			if (NODES > 1)
+				basis[1][1] = 1;
+			for (int j = 2; j < NODES; ++j)
+				for (int i = 0; i <= j; ++i)
+					basis[j][i] = (i > 0 ? 2 * basis[j - 1][i - 1] : 0) - basis[j - 2][i];
+
+			// samples of every segment, kept in its coefficients until the scale is known
+			const uint64_t step = span / count;
+			const uint64_t rest = span % count;
+			uint64_t y_max = 0;
+			for (size_t i = 0; i < count; ++i)
+			{
+				const uint64_t from = step * i + rest * i / count;
+				const uint64_t width = step * (i + 1) + rest * (i + 1) / count - from;
+				const uint64_t middle = uint64_t(low) + from + (width >> 1);
+				for (int k = 0; k < NODES; ++k)
+				{
+					const uint64_t dx = ((uint128::mul(uint64_t(t[k] < 0 ? -t[k] : t[k]), width) + uint128{ 0, uint64_t(1) << 62 }) >> 63).lo;
+					const int64_t x = t[k] < 0 ? int64_t(middle - dx) : int64_t(middle + dx);
+					const int64_t y = func(fixed::from_raw(x)).raw_value();
+					coeff[i * NODES + k] = y;
+					const uint64_t a = y < 0 ? uint64_t(0) - uint64_t(y) : uint64_t(y);
+					y_max = a > y_max ? a : y_max;
+				}
+			}
+
+			// samples to Q(F + shift) below 2^53, |c_j| <= 2 y_max and the power basis
+			// of T_0 .. T_6 sums to 169, so no partial sum reaches 2^62
+			shift = y_max == 0 ? 0 : 53 - internal::bit_length(y_max);
+			for (size_t i = 0; i < count; ++i)
+			{
+				int64_t y[NODES] = {};
+				for (int k = 0; k < NODES; ++k)
+				{
+					const int64_t v = coeff[i * NODES + k];
+					y[k] = shift >= 0 ? int64_t(uint64_t(v) << shift) : internal::mul_shift(v, int64_t(1) << (63 + shift), 63);
+				}
+
+				// c_j = 2 / N * sum y_k T_j(t_k), c_0 is halved, then a_i = sum c_j T_j[i]
+				int64_t* a = &coeff[i * NODES];
+				for (int k = 0; k < NODES; ++k)
+					a[k] = 0;
+				for (int j = 0; j < NODES; ++j)
+				{
+					int64_t sum = 0;
+					for (int k = 0; k < NODES; ++k)
+						sum += internal::mul_shift(y[k], cheb[j][k], 62);
+					const int64_t num = j == 0 ? sum : 2 * sum;
+					const int64_t c = (num + (num < 0 ? -NODES / 2 : NODES / 2)) / NODES;
+					for (int k = 0; k <= j; ++k)
+						a[k] += c * basis[j][k];
+				}
+			}
+
+			// measured on 4 points per node and both ends of every segment
+			constexpr uint64_t GRID = 4 * NODES;
+			error = 0;
+			for (size_t i = 0; i < count; ++i)
+			{
+				const uint64_t from = step * i + rest * i / count;
+				const uint64_t width = step * (i + 1) + rest * (i + 1) / count - from;
+				for (uint64_t m = 0; m <= GRID; ++m)
+					check(func, fixed::from_raw(int64_t(uint64_t(low) + from + (width / GRID) * m + (width % GRID) * m / GRID)));
+			}
+		}
+
+		// func over [lo, hi], doubling the segments until the measured max_error() is at
+		// most tolerance, false when max_segments is not enough
+		template <typename Func>
+		bool fit(Func func, fixed lo, fixed hi, fixed tolerance, size_t max_segments = 4096)
+		{
+			const uint64_t span = uint64_t(hi.raw_value()) - uint64_t(lo.raw_value());
+			size_t segments = 1;
+			fit(func, lo, hi, segments);
+			while (error > tolerance.raw_value() && segments * 2 <= max_segments && span / (segments * 2) >= 2)
+			{
+				segments *= 2;
+				fit(func, lo, hi, segments);
+			}
+			return error <= tolerance.raw_value();
+		}
+
+		// the polyline through size samples with increasing x, also checked on every sample
+		bool fit(const fixed* x, const fixed* y, size_t size, fixed tolerance, size_t max_segments = 4096)
+		{
+			FIXED_64_ASSERT(size >= 2);
+			const auto polyline = [x, y, size](fixed v) {
+				size_t first = 0, last = size - 1;
+				while (last - first > 1)
+				{
+					const size_t mid = first + (last - first) / 2;
+					(x[mid] <= v ? first : last) = mid;
+				}
+				if (v <= x[first])
+					return y[first];
+				if (v >= x[last])
+					return y[last];
+				return y[first] + (y[last] - y[first]) * ((v - x[first]) / (x[last] - x[first]));
+			};
+
+			const fixed lo = x[0], hi = x[size - 1];
+			const uint64_t span = uint64_t(hi.raw_value()) - uint64_t(lo.raw_value());
+			size_t segments = 1;
+			while (true)
+			{
+				fit(polyline, lo, hi, segments);
+				for (size_t k = 0; k < size; ++k)
+					check(polyline, x[k]);
+				if (error <= tolerance.raw_value() || segments * 2 > max_segments || span / (segments * 2) < 2)
+					break;
+				segments *= 2;
+			}
+			return error <= tolerance.raw_value();
+		}
+
+		FIXED_64_FORCEINLINE fixed operator()(fixed x) const noexcept
+		{
+			FIXED_64_ASSERT(!coeff.empty());
+			const int64_t v = x.raw_value() < low ? low : x.raw_value() > high ? high : x.raw_value();
+			const uint64_t pos = (uint128::mul(uint64_t(v) - uint64_t(low), scale) >> scale_shift).lo;
+			const uint64_t i = (pos >> position) < count ? pos >> position : count - 1;
+
+			// u = 2 t - 1 in Q1.62 for the position t in the segment
+			const int64_t u = int64_t(((pos - (i << position)) << (63 - position)) - (uint64_t(1) << 62));
+			const int64_t r = internal::estrin_eval<62, NODES>(coeff.data() + i * NODES, u);
+
+			if (shift > 0)
+				return fixed::from_raw((r + (int64_t(1) << (shift - 1))) >> shift);
+			if (r > (fixed::MAXIMUM >> -shift) || r < (fixed::MINIMUM >> -shift))
+			{
+				FIXED_64_OVERFLOW_ALERT();
+				return fixed::from_raw(r > 0 ? fixed::MAXIMUM : fixed::MINIMUM);
+			}
+			return fixed::from_raw(int64_t(uint64_t(r) << -shift));
+		}
+
+		// y[k] for x[k], k in [0, n)
+		inline void evaluate(const fixed* x, fixed* y, size_t n) const noexcept
+		{
+			for (size_t k = 0; k < n; ++k)
+				y[k] = (*this)(x[k]);
+		}
+
+		// max |p(x) - func(x)| on the points checked while fitting, an estimate
+		FIXED_64_FORCEINLINE fixed max_error() const noexcept
+		{
+			return fixed::from_raw(error);
+		}
+
+		FIXED_64_FORCEINLINE size_t segments() const noexcept
+		{
+			return count;
+		}
+
+		FIXED_64_FORCEINLINE size_t bytes() const noexcept
+		{
+			return coeff.size() * sizeof(int64_t);
+		}
+
+	private:
+		template <typename Func>
+		void check(Func func, fixed x)
+		{
+			const int64_t d = (*this)(x).raw_value() - func(x).raw_value();
+			error = (d < 0 ? -d : d) > error ? (d < 0 ? -d : d) : error;
+		}
+
+	private:
+		std::vector<int64_t> coeff; // Q(F + shift), NODES per segment in the power basis of u
+		size_t count = 0;
+		int64_t low = 0;
+		int64_t high = 0;
+		uint64_t scale = 0; // (x - low) * scale >> scale_shift is the position in Q(position)
+		unsigned int scale_shift = 0;
+		unsigned int position = 0;
+		int shift = 0;
+		int64_t error = 0;
+	};
+}
+
+#endif
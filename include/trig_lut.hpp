@@ -1,20037 +1,6238 @@
+// Generated by tools/trig_lut.py --bits 10, do not edit.
+
 #ifndef FIXED_64_TRIG_LUT_H
 #define FIXED_64_TRIG_LUT_H
 
-#include <array>
+#include <stdint.h>
+#include <stddef.h>
+
+// log2 of the segment count over a quarter wave, fixed when the header is generated
+#ifndef FIXED_64_TRIG_LUT_BITS
+#define FIXED_64_TRIG_LUT_BITS 10
+#endif
+
+#if FIXED_64_TRIG_LUT_BITS != 10
+#error "trig_lut.hpp holds 2^10 segments, regenerate it with tools/trig_lut.py --bits N"
+#endif
+
+// 1: linear, 2: quadratic
+#ifndef FIXED_64_TRIG_LUT_INTERPOLATION
+#define FIXED_64_TRIG_LUT_INTERPOLATION 2
+#endif
 
 namespace f64
 {
+	namespace internal
+	{
+		struct trig_lut_entry
+		{
+			int64_t value;
+			int64_t slope;
+#if FIXED_64_TRIG_LUT_INTERPOLATION >= 2
+			int64_t curve;
+#endif
+		};
+	}
 
-	template<unsigned int F>
+	// Quarter-wave sine table in Q1.62, shared by every fraction precision.
+	// Each entry keeps the interpolation coefficients of one segment together.
+	//
+	// max error over the quarter wave with FIXED_64_TRIG_LUT_BITS 10:
+	//   linear     2.9e-7, 16 KB
+	//   quadratic  2.9e-11, 24 KB
 	struct sin_lut
 	{
-		constexpr inline static int64_t get(size_t index)
+		static constexpr unsigned int BITS = 10;
+		static constexpr size_t COUNT = size_t(1) << BITS;
+
+		static constexpr internal::trig_lut_entry data[COUNT] =
 		{
-			return lut_dst[index];
-		}
-		constexpr static std::array<int64_t, 10001> lut_src = 
-        {
-			0x0,
-			0x525adefe37184,
-			0xa4b5bd741039f,
-			0xf7109ad92d6f5,
-			0x1496b76a530c4a,
-			0x19bc6504fbc486,
-			0x1ee212750720ce,
-			0x2407bfb1ef428e,
-			0x292d6cb32e4b84,
-			0x2e5319703e5dd4,
-			0x3378c5e0999c10,
-			0x389e71fbba2944,
-			0x3dc41db91a291a,
-			0x42e9c91033bfc8,
-			0x480f73f881122c,
-			0x4d351e697c45e8,
-			0x525ac85a9f8158,
-			0x578071c364ebb8,
-			0x5ca61a9b46ad10,
-			0x61cbc2d9beee74,
-			0x66f16a7647d9e4,
-			0x6c1711685b9a70,
-			0x713cb7a7745c3c,
-			0x76625d2b0c4ca8,
-			0x7b8801ea9d9a30,
-			0x80ada5dda274b0,
-			0x85d348fb950d40,
-			0x8af8eb3bef9658,
-			0x901e8c962c43f8,
-			0x95442d01c54b88,
-			0x9a69cc7634e400,
-			0x9f8f6aeaf545f8,
-			0xa4b5085780aba0,
-			0xa9daa4b35150e8,
-			0xaf003ff5e17390,
-			0xb425da16ab5300,
-			0xb94b730d2930b0,
-			0xbe710ad0d55000,
-			0xc396a15929f610,
-			0xc8bc369da16a68,
-			0xcde1ca95b5f660,
-			0xd3075d38e1e590,
-			0xd82cee7e9f85d0,
-			0xdd527e5e692718,
-			0xe2780ccfb91bd0,
-			0xe79d99ca09b8c0,
-			0xecc32544d55508,
-			0xf1e8af37964a58,
-			0xf70e3799c6f4c0,
-			0xfc33be62e1b328,
-			0x10159438a60e6f0,
-			0x1067ec707bef430,
-			0x10ba448d27641d0,
-			0x110c9c8e2013980,
-			0x115ef472dda47c0,
-			0x11b14c3ad7bdc20,
-			0x1203a3e58606900,
-			0x1255fb7260263e0,
-			0x12a852e0ddc4550,
-			0x12faaa307688920,
-			0x134d0160a21ae10,
-			0x139f5870d823670,
-			0x13f1af60904a7a0,
-			0x1444062f4238a70,
-			0x14965cdc6596b40,
-			0x14e8b367720d9b0,
-			0x153b09cfdf46900,
-			0x158d601524eb000,
-			0x15dfb636baa4950,
-			0x16320c34181d2e0,
-			0x1684620cb4feec0,
-			0x16d6b7c008f42c0,
-			0x17290d4d8ba7820,
-			0x177b62b4b4c3cb0,
-			0x17cdb7f4fbf41d0,
-			0x18200d0dd8e3cc0,
-			0x187261fec33e760,
-			0x18c4b6c732aff50,
-			0x19170b669ee4650,
-			0x19695fdc7f882b0,
-			0x19bbb4284c47eb0,
-			0x1a0e08497cd0920,
-			0x1a605c3f88cf550,
-			0x1ab2b009e7f1ae0,
-			0x1b0503a811e55f0,
-			0x1b5757197e58740,
-			0x1ba9aa5da4f9430,
-			0x1bfbfd73fd766d0,
-			0x1c4e505bff7ee00,
-			0x1ca0a31522c1d70,
-			0x1cf2f59edeeed60,
-			0x1d4547f8abb5b40,
-			0x1d979a2200c6970,
-			0x1de9ec1a55d1f30,
-			0x1e3c3de12288920,
-			0x1e8e8f75de9b860,
-			0x1ee0e0d801bc400,
-			0x1f333207039c7e0,
-			0x1f8583025bee530,
-			0x1fd7d3c982642a0,
-			0x202a245beeb0c00,
-			0x207c74b91887300,
-			0x20cec4e0779ae60,
-			0x212114d1839faa0,
-			0x2173648bb449a40,
-			0x21c5b40e814d4c0,
-			0x22180359625f7c0,
-			0x226a526bcf356a0,
-			0x22bca1453f84a80,
-			0x230eefe52b03280,
-			0x23613e4b09673e0,
-			0x23b38c765267960,
-			0x2405da667dbb420,
-			0x2458281b0319b80,
-			0x24aa75935a3ace0,
-			0x24fcc2cefad6be0,
-			0x254f0fcd5ca6240,
-			0x25a15c8df762080,
-			0x25f3a91042c3d20,
-			0x2645f553b685540,
-			0x26984157ca60c80,
-			0x26ea8d1bf610ce0,
-			0x273cd89fb150760,
-			0x278f23e273db340,
-			0x27e16ee3b56cec0,
-			0x2833b9a2edc1ee0,
-			0x2886041f9496f40,
-			0x28d84e5921a92a0,
-			0x292a984f0cb6280,
-			0x297ce200cd7bfc0,
-			0x29cf2b6ddbb91c0,
-			0x2a217495af2c760,
-			0x2a73bd77bf956a0,
-			0x2ac6061384b3ca0,
-			0x2b184e687647da0,
-			0x2b6a96760c125a0,
-			0x2bbcde3bbdd47e0,
-			0x2c0f25b9034fe80,
-			0x2c616ced5446be0,
-			0x2cb3b3d8287b9a0,
-			0x2d05fa78f7b1900,
-			0x2d5840cf39ac2c0,
-			0x2daa86da662f7e0,
-			0x2dfccc99f500020,
-			0x2e4f120d5de2c20,
-			0x2ea15734189d400,
-			0x2ef39c0d9cf57a0,
-			0x2f45e09962b1f20,
-			0x2f9824d6e199a60,
-			0x2fea68c591741a0,
-			0x303cac64ea09540,
-			0x308eefb46321dc0,
-			0x30e132b37486be0,
-			0x3133756196018e0,
-			0x3185b7be3f5c600,
-			0x31d7f9c8e861d40,
-			0x322a3b8108dd140,
-			0x327c7ce61899cc0,
-			0x32cebdf78f64360,
-			0x3320feb4e509140,
-			0x33733f1d9155b40,
-			0x33c57f310c17f00,
-			0x3417beeecd1e340,
-			0x3469fe564c37740,
-			0x34bc3d670133320,
-			0x350e7c2063e1840,
-			0x3560ba81ec13100,
-			0x35b2f88b11990a0,
-			0x3605363b4c453a0,
-			0x3657739213e9fe0,
-			0x36a9b08ee05a460,
-			0x36fbed312969940,
-			0x374e297866ec080,
-			0x37a0656410b64c0,
-			0x37f2a0f39e9db20,
-			0x3844dc268878160,
-			0x389716fc461bf60,
-			0x38e951744f60680,
-			0x393b8b8e1c1d180,
-			0x398dc549242a560,
-			0x39dffea4df610c0,
-			0x3a3237a0c59abe0,
-			0x3a84703c4eb1960,
-			0x3ad6a876f280580,
-			0x3b28e05028e26a0,
-			0x3b7b17c769b3d20,
-			0x3bcd4edc2cd13c0,
-			0x3c1f858dea17f80,
-			0x3c71bbdc1965ee0,
-			0x3cc3f1c63299b60,
-			0x3d16274bad92900,
-			0x3d685c6c02305a0,
-			0x3dba9126a8539e0,
-			0x3e0cc57b17dd8c0,
-			0x3e5ef968c8b0040,
-			0x3eb12cef32ad860,
-			0x3f03600dcdb9420,
-			0x3f5592c411b7160,
-			0x3fa7c511768b900,
-			0x3ff9f6f5741bde0,
-			0x404c286f824de40,
-			0x409e597f1908400,
-			0x40f08a23b0322c0,
-			0x4142ba5cbfb3a40,
-			0x4194ea29bf754c0,
-			0x41e7198a2760800,
-			0x4239487d6f5f500,
-			0x428b77030f5c840,
-			0x42dda51a7f43900,
-			0x432fd2c33700a00,
-			0x4381fffcae809c0,
-			0x43d42cc65db1280,
-			0x4426591fbc80980,
-			0x4478850842ddfc0,
-			0x44cab07f68b9240,
-			0x451cdb84a602980,
-			0x456f061772ab9c0,
-			0x45c1303746a6300,
-			0x461359e399e51c0,
-			0x4665831be45be00,
-			0x46b7abdf9dfeb40,
-			0x4709d42e3ec2a00,
-			0x475bfc073e9d680,
-			0x47ae236a15858c0,
-			0x48004a563b725c0,
-			0x485270cb285be00,
-			0x48a496c8543af40,
-			0x48f6bc4d37092c0,
-			0x4948e15948c0e80,
-			0x499b05ec015d540,
-			0x49ed2a04d8da640,
-			0x4a3f4da34734d40,
-			0x4a9170c6c46a240,
-			0x4ae3936ec878ac0,
-			0x4b35b59acb5f880,
-			0x4b87d74a451ea80,
-			0x4bd9f87cadb6c00,
-			0x4c2c19317d29600,
-			0x4c7e39682b78dc0,
-			0x4cd0592030a8600,
-			0x4d22785904bbe80,
-			0x4d7497121fb8440,
-			0x4dc6b54af9a3100,
-			0x4e18d3030a82cc0,
-			0x4e6af039ca5eb80,
-			0x4ebd0ceeb13f000,
-			0x4f0f2921372c980,
-			0x4f6144d0d431540,
-			0x4fb35ffd0057d80,
-			0x50057aa533aba80,
-			0x505794c8e639240,
-			0x50a9ae67900d840,
-			0x50fbc780a936dc0,
-			0x514de013a9c4200,
-			0x519ff82009c5200,
-			0x51f20fa5414a8c0,
-			0x524426a2c865f40,
-			0x52963d181729c40,
-			0x52e85304a5a9500,
-			0x533a6867ebf8cc0,
-			0x538c7d41622d4c0,
-			0x53de9190805cd00,
-			0x5430a554be9e380,
-			0x5482b88d9509480,
-			0x54d4cb3a7bb6ac0,
-			0x5526dd5aeabff80,
-			0x5578eeee5a3fb00,
-			0x55cafff44251380,
-			0x561d106c1b10e00,
-			0x566f20555c9be40,
-			0x56c12faf7f106c0,
-			0x57133e79fa8d900,
-			0x57654cb44733580,
-			0x57b75a5ddd22b00,
-			0x58096776347d740,
-			0x585b73fcc566800,
-			0x58ad7ff10801980,
-			0x58ff8b5274736c0,
-			0x5951962082e1ac0,
-			0x59a3a05aab72ec0,
-			0x59f5aa00664ec80,
-			0x5a47b3112b9dc40,
-			0x5a99bb8c73895c0,
-			0x5aebc371b63c0c0,
-			0x5b3dcac06be13c0,
-			0x5b8fd1780ca5540,
-			0x5be1d79810b5b40,
-			0x5c33dd1ff040c40,
-			0x5c85e20f2375d40,
-			0x5cd7e6652285380,
-			0x5d29ea2165a04c0,
-			0x5d7bed4364f9580,
-			0x5dcdefca98c3b80,
-			0x5e1ff1b67933b40,
-			0x5e71f3067e7ea80,
-			0x5ec3f3ba20dadc0,
-			0x5f15f3d0d87fb40,
-			0x5f67f34a1da5880,
-			0x5fb9f2256885b00,
-			0x600bf062315aa00,
-			0x605dedfff05fbc0,
-			0x60afeafe1dd17c0,
-			0x6101e75c31ed580,
-			0x6153e319a4f1d80,
-			0x61a5de35ef1e8c0,
-			0x61f7d8b088b40c0,
-			0x6249d288e9f3fc0,
-			0x629bcbbe8b21140,
-			0x62edc450e47f0c0,
-			0x633fbc3f6e52b40,
-			0x6391b389a0e1ec0,
-			0x63e3aa2ef473a40,
-			0x6435a02ee14fd80,
-			0x64879588dfbf980,
-			0x64d98a3c680d080,
-			0x652b7e48f283640,
-			0x657d71adf76ee80,
-			0x65cf646aef1d040,
-			0x6621567f51dc240,
-			0x667347ea97fbe00,
-			0x66c538ac39ccd80,
-			0x671728c3afa0c80,
-			0x6769183071ca900,
-			0x67bb06f1f89e240,
-			0x680cf507bc708c0,
-			0x685ee2713597f80,
-			0x68b0cf2ddc6bb40,
-			0x6902bb3d2944240,
-			0x6954a69e947ac40,
-			0x69a69151966a4c0,
-			0x69f87b55a76e700,
-			0x6a4a64aa3fe42c0,
-			0x6a9c4d4ed8297c0,
-			0x6aee3542e89d8c0,
-			0x6b401c85e9a0c00,
-			0x6b92031753947c0,
-			0x6be3e8f69edb700,
-			0x6c35ce2343d9500,
-			0x6c87b29cbaf3180,
-			0x6cd996627c8ecc0,
-			0x6d2b79740113c00,
-			0x6d7d5bd0c0ea480,
-			0x6dcf3d78347c0c0,
-			0x6e211e69d433c00,
-			0x6e72fea5187d540,
-			0x6ec4de2979c5e40,
-			0x6f16bcf6707bbc0,
-			0x6f689b0b750e5c0,
-			0x6fba7867ffee600,
-			0x700c550b898db80,
-			0x705e30f58a5f600,
-			0x70b00c257ad7a80,
-			0x7101e69ad36bfc0,
-			0x7153c0550c93140,
-			0x71a599539ec4c40,
-			0x71f77196027a2c0,
-			0x7249491bb02d940,
-			0x729b1fe4205a840,
-			0x72ecf5eecb7dc80,
-			0x733ecb3b2a154c0,
-			0x73909fc8b4a0580,
-			0x73e27396e39f4c0,
-			0x743446a52f93e80,
-			0x748618f31101140,
-			0x74d7ea80006aec0,
-			0x7529bb4b7656f00,
-			0x757b8b54eb4bc00,
-			0x75cd5a9bd7d14c0,
-			0x761f291fb470c40,
-			0x7670f6dff9b4980,
-			0x76c2c3dc2028780,
-			0x77149013a059700,
-			0x77665b85f2d5a80,
-			0x77b82632902cc00,
-			0x7809f018f0ef780,
-			0x785bb9388dafe00,
-			0x78ad8190df01640,
-			0x78ff49215d78a00,
-			0x79510fe981ab980,
-			0x79a2d5e8c431800,
-			0x79f49b1e9da2e80,
-			0x7a465f8a8699a80,
-			0x7a98232bf7b0f40,
-			0x7ae9e6026985300,
-			0x7b3ba80d54b4380,
-			0x7b8d694c31dd1c0,
-			0x7bdf29be79a0400,
-			0x7c30e963a49f6c0,
-			0x7c82a83b2b7da40,
-			0x7cd4664486df600,
-			0x7d26237f2f6a480,
-			0x7d77dfea9dc57c0,
-			0x7dc99b864a995c0,
-			0x7e1b5651ae8fb00,
-			0x7e6d104c4253840,
-			0x7ebec9757e915c0,
-			0x7f1081ccdbf7000,
-			0x7f623951d3338c0,
-			0x7fb3f003dcf79c0,
-			0x8005a5e271f4f80,
-			0x80575aed0adf000,
-			0x80a90f23206a380,
-			0x80fac2842b4cb00,
-			0x814c750fa43dc00,
-			0x819e26c503f6380,
-			0x81efd7a3c330280,
-			0x824187ab5aa7300,
-			0x829336db4318280,
-			0x82e4e532f541700,
-			0x833692b1e9e2b00,
-			0x83883f5799bd180,
-			0x83d9eb237d93280,
-			0x842b96150e28c00,
-			0x847d402bc443580,
-			0x84cee96718a9900,
-			0x852091c68423b80,
-			0x857239497f7b500,
-			0x85c3dfef837b600,
-			0x861585b808f0700,
-			0x86672aa288a8500,
-			0x86b8ceae7b72680,
-			0x870a71db5a1f680,
-			0x875c14289d81900,
-			0x87adb595be6c800,
-			0x87ff562235b5600,
-			0x8850f5cd7c32b00,
-			0x88a294970abc880,
-			0x88f4327e5a2c500,
-			0x8945cf82e35cf00,
-			0x89976ba41f2ae80,
-			0x89e906e18674000,
-			0x8a3aa13a9217a00,
-			0x8a8c3aaebaf6a00,
-			0x8addd33d79f3400,
-			0x8b2f6ae647f1500,
-			0x8b8101a89dd6200,
-			0x8bd29783f488600,
-			0x8c242c77c4f0680,
-			0x8c75c08387f7f80,
-			0x8cc753a6b68a400,
-			0x8d18e5e0c994180,
-			0x8d6a77313a03b00,
-			0x8dbc079780c8f00,
-			0x8e0d971316d5080,
-			0x8e5f25a3751ad80,
-			0x8eb0b348148eb00,
-			0x8f0240006e26700,
-			0x8f53cbcbfad9780,
-			0x8fa556aa33a0c00,
-			0x8ff6e09a9176b00,
-			0x9048699c8d57480,
-			0x9099f1afa040180,
-			0x90eb78d34330300,
-			0x913cff06ef28380,
-			0x918e844a1d2a580,
-			0x91e0089c463a500,
-			0x92318bfce35d700,
-			0x92830e6b6d9a880,
-			0x92d48fe75dfa180,
-			0x932610702d86180,
-			0x93779005554a180,
-			0x93c90ea64e53300,
-			0x941a8c5291b0380,
-			0x946c09099871580,
-			0x94bd84cadba8980,
-			0x950eff95d469580,
-			0x95607969fbc8c00,
-			0x95b1f246cadd700,
-			0x96036a2bbabfb80,
-			0x9654e1184489680,
-			0x96a6570be156080,
-			0x96f7cc060a42b00,
-			0x97494006386e080,
-			0x979ab30be4f8700,
-			0x97ec25168903d00,
-			0x983d96259db3c80,
-			0x988f06389c2d780,
-			0x98e0754efd97b80,
-			0x9931e3683b1b000,
-			0x99835083cde1600,
-			0x99d4bca12f16b00,
-			0x9a2627bfd7e8280,
-			0x9a7791df4184f80,
-			0x9ac8fafee51da80,
-			0x9b1a631e3be4b00,
-			0x9b6bca3cbf0df00,
-			0x9bbd3059e7cf200,
-			0x9c0e95752f5f900,
-			0x9c5ff98e0ef8380,
-			0x9cb15ca3ffd3c00,
-			0x9d02beb67b2e800,
-			0x9d541fc4fa46780,
-			0x9da57fcef65b580,
-			0x9df6ded3e8ae800,
-			0x9e483cd34a83000,
-			0x9e9999cc951da80,
-			0x9eeaf5bf41c4d00,
-			0x9f3c50aac9c0b80,
-			0x9f8daa8ea65b200,
-			0x9fdf036a50dfb80,
-			0xa0305b3d429ba80,
-			0xa081b206f4ddf80,
-			0xa0d307c6e0f7500,
-			0xa1245c7c803a280,
-			0xa175b0274bfa980,
-			0xa1c702c6bd8e800,
-			0xa218545a4e4d780,
-			0xa269a4e17790d00,
-			0xa2baf45bb2b3a00,
-			0xa30c42c87912a00,
-			0xa35d9027440c780,
-			0xa3aedc778d01580,
-			0xa40027b8cd53580,
-			0xa45171ea7e66400,
-			0xa4a2bb0c199f980,
-			0xa4f4031d1866b00,
-			0xa5454a1cf424a00,
-			0xa596900b2644380,
-			0xa5e7d4e72832100,
-			0xa63918b0735c980,
-			0xa68a5b668133e00,
-			0xa6db9d08cb29f80,
-			0xa72cdd96cab2800,
-			0xa77e1d0ff943080,
-			0xa7cf5b73d052d00,
-			0xa82098c1c95b000,
-			0xa871d4f95dd6680,
-			0xa8c3101a0741c80,
-			0xa9144a233f1ba00,
-			0xa96583147ee4300,
-			0xa9b6baed401da80,
-			0xaa07f1acfc4be00,
-			0xaa5927532cf4b00,
-			0xaaaa5bdf4b9f900,
-			0xaafb8f50d1d5f80,
-			0xab4cc1a73923100,
-			0xab9df2e1fb13f00,
-			0xabef23009137780,
-			0xac405202751e580,
-			0xac917fe7205b300,
-			0xace2acae0c82600,
-			0xad33d856b32a300,
-			0xad8502e08deaa80,
-			0xadd62c4b165de00,
-			0xae275495c61f900,
-			0xae787bc016cd700,
-			0xaec9a1c98207100,
-			0xaf1ac6b1816dd80,
-			0xaf6bea778ea5080,
-			0xafbd0d1b2351e00,
-			0xb00e2e9bb91b580,
-			0xb05f4ef8c9aa680,
-			0xb0b06e31cea9e80,
-			0xb1018c4641c6700,
-			0xb152a9359caeb80,
-			0xb1a3c4ff5913300,
-			0xb1f4dfa2f0a6300,
-			0xb245f91fdd1c100,
-			0xb2971175982b000,
-			0xb2e828a39b8b180,
-			0xb3393ea960f6600,
-			0xb38a53866228c80,
-			0xb3db673a18e0280,
-			0xb42c79c3fedc500,
-			0xb47d8b238ddee80,
-			0xb4ce9b583fab980,
-			0xb51faa618e07f80,
-			0xb570b83ef2bb700,
-			0xb5c1c4efe78f980,
-			0xb612d073e64fb00,
-			0xb663daca68c9200,
-			0xb6b4e3f2e8cb280,
-			0xb705ebece027080,
-			0xb756f2b7c8aff80,
-			0xb7a7f8531c3b200,
-			0xb7f8fcbe549f880,
-			0xb849fff8ebb6680,
-			0xb89b02025b5ab80,
-			0xb8ec02da1d69780,
-			0xb93d027fabc1c00,
-			0xb98e00f28044780,
-			0xb9defe3214d4b00,
-			0xba2ffa3de357400,
-			0xba80f51565b3300,
-			0xbad1eeb815d1680,
-			0xbb22e7256d9ce00,
-			0xbb73de5ce702800,
-			0xbbc4d45dfbf1400,
-			0xbc15c928265a180,
-			0xbc66bcbae02ff00,
-			0xbcb7af15a367d80,
-			0xbd08a037e9f8b80,
-			0xbd5990212ddba80,
-			0xbdaa7ed0e90ba00,
-			0xbdfb6c469585c80,
-			0xbe4c5881ad49200,
-			0xbe9d4381aa56d80,
-			0xbeee2d4606b2280,
-			0xbf3f15ce3c60380,
-			0xbf8ffd19c568580,
-			0xbfe0e3281bd3c00,
-			0xc031c7f8b9ade80,
-			0xc082ab8b1904280,
-			0xc0d38ddeb3e6000,
-			0xc1246ef30464f80,
-			0xc1754ec78494a80,
-			0xc1c62d5bae8ac00,
-			0xc2170aaefc5ef80,
-			0xc267e6c0e82b280,
-			0xc2b8c190ec0b300,
-			0xc3099b1e821d100,
-			0xc35a73692480d00,
-			0xc3ab4a704d58a00,
-			0xc3fc203376c8b80,
-			0xc44cf4b21af7700,
-			0xc49dc7ebb40d380,
-			0xc4ee99dfbc34a80,
-			0xc53f6a8dad9a480,
-			0xc59039f5026cf80,
-			0xc5e1081534dd900,
-			0xc631d4edbf1ef80,
-			0xc682a07e1b66680,
-			0xc6d36ac5c3eb080,
-			0xc72433c432e6380,
-			0xc774fb78e293700,
-			0xc7c5c1e34d30500,
-			0xc8168702ecfc980,
-			0xc8674ad73c3a380,
-			0xc8b80d5fb52d200,
-			0xc908ce9bd21b980,
-			0xc9598e8b0d4de80,
-			0xc9aa4d2ce10e800,
-			0xc9fb0a80c7aa200,
-			0xca4bc6863b6f780,
-			0xca9c813cb6af980,
-			0xcaed3aa3b3bd900,
-			0xcb3df2baaceeb80,
-			0xcb8ea9811c9a800,
-			0xcbdf5ef67d1a980,
-			0xcc30131a48cac80,
-			0xcc80c5ebfa09200,
-			0xccd1776b0b35c80,
-			0xcd222796f6b3280,
-			0xcd72d66f36e5e80,
-			0xcdc383f34634b00,
-			0xce1430229f08980,
-			0xce64dafcbbccc00,
-			0xceb5848116ee900,
-			0xcf062caf2adda00,
-			0xcf56d386720bd00,
-			0xcfa7790666ed100,
-			0xcff81d2e83f7b80,
-			0xd048bffe43a4300,
-			0xd0996175206d480,
-			0xd0ea019294cfd00,
-			0xd13aa0561b4b000,
-			0xd18b3dbf2e60480,
-			0xd1dbd9cd4893580,
-			0xd22c747fe469f80,
-			0xd27d0dd67c6c580,
-			0xd2cda5d08b24e80,
-			0xd31e3c6d8b20500,
-			0xd36ed1acf6ed600,
-			0xd3bf658e491d500,
-			0xd40ff810fc43980,
-			0xd46089348af5e00,
-			0xd4b118f86fcc180,
-			0xd501a75c2560980,
-			0xd552345f264fd80,
-			0xd5a2c000ed38980,
-			0xd5f34a40f4bc000,
-			0xd643d31eb77d680,
-			0xd6945a99b022980,
-			0xd6e4e0b15953580,
-			0xd73565652dba000,
-			0xd785e8b4a803300,
-			0xd7d66a9f42dda80,
-			0xd826eb2478faa80,
-			0xd8776a43c50da80,
-			0xd8c7e7fca1cc880,
-			0xd918644e89ef400,
-			0xd968df38f830600,
-			0xd9b958bb674ca00,
-			0xda09d0d55203300,
-			0xda5a47863315580,
-			0xdaaabccd8546f00,
-			0xdafb30aac35e180,
-			0xdb4ba31d6823300,
-			0xdb9c1424ee61180,
-			0xdbec83c0d0e4e00,
-			0xdc3cf1f08a7e100,
-			0xdc8d5eb395fe800,
-			0xdcddca096e3a600,
-			0xdd2e33f18e08400,
-			0xdd7e9c6b7041280,
-			0xddcf03768fc0380,
-			0xde1f69126763400,
-			0xde6fcd3e720a480,
-			0xdec02ffa2a97a80,
-			0xdf1091450bf0400,
-			0xdf60f11e90fb400,
-			0xdfb14f8634a2500,
-			0xe001ac7b71d1500,
-			0xe05207fdc376a00,
-			0xe0a2620ca483100,
-			0xe0f2baa78fe9d80,
-			0xe14311ce00a0780,
-			0xe193677f719ef00,
-			0xe1e3bbbb5ddfb80,
-			0xe2340e81405f980,
-			0xe2845fd0941dc00,
-			0xe2d4afa8d41be80,
-			0xe324fe097b5e300,
-			0xe3754af204eb000,
-			0xe3c59661ebcb600,
-			0xe415e058ab0ac00,
-			0xe46628d5bdb6c80,
-			0xe4b66fd89edfe00,
-			0xe506b560c998a80,
-			0xe556f96db8f6700,
-			0xe5a73bfee810a80,
-			0xe5f77d13d201780,
-			0xe647bcabf1e5680,
-			0xe697fac6c2db880,
-			0xe6e83763c005280,
-			0xe73872826486500,
-			0xe788ac222b85700,
-			0xe7d8e442902b480,
-			0xe8291ae30da3480,
-			0xe87950031f1b500,
-			0xe8c983a23fc3b80,
-			0xe919b5bfeacf380,
-			0xe969e65b9b73300,
-			0xe9ba1574cce7700,
-			0xea0a430afa66480,
-			0xea5a6f1d9f2c880,
-			0xeaaa99ac3679800,
-			0xeafac2b63b8f080,
-			0xeb4aea3b29b1700,
-			0xeb9b103a7c27900,
-			0xebeb34b3ae3ad80,
-			0xec3b57a63b37400,
-			0xec8b79119e6b080,
-			0xecdb98f55327400,
-			0xed2bb750d4bf600,
-			0xed7bd4239e89880,
-			0xedcbef6d2bde200,
-			0xee1c092cf818600,
-			0xee6c21627e95f80,
-			0xeebc380d3ab7080,
-			0xef0c4d2ca7de580,
-			0xef5c60c04171480,
-			0xefac72c782d7c00,
-			0xeffc8341e77c100,
-			0xf04c922eeacb500,
-			0xf09c9f8e0835180,
-			0xf0ecab5ebb2b980,
-			0xf13cb5a07f23780,
-			0xf18cbe52cf94100,
-			0xf1dcc57527f7500,
-			0xf22ccb0703c9a00,
-			0xf27ccf07de8a200,
-			0xf2ccd17733ba780,
-			0xf31cd2547edef80,
-			0xf36cd19f3b7e680,
-			0xf3bccf56e522500,
-			0xf40ccb7af756b80,
-			0xf45cc60aedaa700,
-			0xf4acbf0643ae980,
-			0xf4fcb66c74f7300,
-			0xf54cac3cfd1ad00,
-			0xf59ca07757b2880,
-			0xf5ec931b005a300,
-			0xf63c842772b0280,
-			0xf68c739c2a55a00,
-			0xf6dc6178a2ee200,
-			0xf72c4dbc5820100,
-			0xf77c3866c594680,
-			0xf7cc217766f6d80,
-			0xf81c08edb7f5880,
-			0xf86beec93441700,
-			0xf8bbd309578e380,
-			0xf90bb5ad9d92080,
-			0xf95b96b58205d00,
-			0xf9ab762080a5300,
-			0xf9fb53ee152e600,
-			0xfa4b301dbb62400,
-			0xfa9b0aaeef04700,
-			0xfaeae3a12bdb480,
-			0xfb3abaf3edafb80,
-			0xfb8a90a6b04d580,
-			0xfbda64b8ef82800,
-			0xfc2a372a2720580,
-			0xfc7a07f9d2fa800,
-			0xfcc9d7276ee7600,
-			0xfd19a4b276c0380,
-			0xfd69709a6660d80,
-			0xfdb93adeb9a7b80,
-			0xfe09037eec76380,
-			0xfe58ca7a7ab0400,
-			0xfea88fd0e03cb00,
-			0xfef853819904b80,
-			0xff48158c20f4b80,
-			0xff97d5eff3fb780,
-			0xffe794ac8e0aa80,
-			0x1003751c16b16800,
-			0x100870d2e0716500,
-			0x100d6c6f1de03d00,
-			0x101267f0c6bdba00,
-			0x10176357d2c9d100,
-			0x101c5ea439c4a500,
-			0x102159d5f36e8300,
-			0x102654ecf787e500,
-			0x102b4fe93dd17000,
-			0x10304acabe0bf800,
-			0x103545916ff87b00,
-			0x103a403d4b582500,
-			0x103f3ace47ec4b00,
-			0x104435445d767400,
-			0x10492f9f83b85000,
-			0x104e29dfb273ba00,
-			0x10532404e16ac000,
-			0x10581e0f085f9500,
-			0x105d17fe1f149e00,
-			0x106211d21d4c6900,
-			0x10670b8afac9b700,
-			0x106c0528af4f6e00,
-			0x1070feab32a0a700,
-			0x1075f8127c80a400,
-			0x107af15e84b2da00,
-			0x107fea8f42fae300,
-			0x1084e3a4af1c8c00,
-			0x1089dc9ec0dbce00,
-			0x108ed57d6ffcce00,
-			0x1093ce40b443df00,
-			0x1098c6e885758300,
-			0x109dbf74db566700,
-			0x10a2b7e5adab6700,
-			0x10a7b03af4398a00,
-			0x10aca874a6c60b00,
-			0x10b1a092bd164b00,
-			0x10b698952eefdc00,
-			0x10bb907bf4188100,
-			0x10c0884704562500,
-			0x10c57ff6576ee400,
-			0x10ca7789e5290700,
-			0x10cf6f01a54b0800,
-			0x10d4665d8f9b8a00,
-			0x10d95d9d9be16200,
-			0x10de54c1c1e39000,
-			0x10e34bc9f9694600,
-			0x10e842b63a39e200,
-			0x10ed39867c1cf000,
-			0x10f2303ab6da2a00,
-			0x10f726d2e2397b00,
-			0x10fc1d4ef602f900,
-			0x110113aee9feec00,
-			0x110609f2b5f5c700,
-			0x110b001a51b03100,
-			0x110ff625b4f6f700,
-			0x1114ec14d7931e00,
-			0x1119e1e7b14dd300,
-			0x111ed79e39f07700,
-			0x1123cd3869449500,
-			0x1128c2b63713ec00,
-			0x112db8179b286400,
-			0x1132ad5c8d4c1900,
-			0x1137a28505495600,
-			0x113c9790faea9000,
-			0x11418c8065fa7300,
-			0x114681533e43d300,
-			0x114b76097b91b800,
-			0x11506aa315af5600,
-			0x11555f2004681500,
-			0x115a53803f878600,
-			0x115f47c3bed97100,
-			0x11643bea7a29c700,
-			0x11692ff46944ad00,
-			0x116e23e183f67400,
-			0x117317b1c20ba100,
-			0x11780b651b50e600,
-			0x117cfefb87932600,
-			0x1181f274fe9f7100,
-			0x1186e5d178430b00,
-			0x118bd910ec4b6700,
-			0x1190cc3352862700,
-			0x1195bf38a2c11b00,
-			0x119ab220d4ca4900,
-			0x119fa4ebe06fe200,
-			0x11a49799bd804900,
-			0x11a98a2a63ca1300,
-			0x11ae7c9dcb1c0300,
-			0x11b36ef3eb450c00,
-			0x11b8612cbc145300,
-			0x11bd534835592f00,
-			0x11c245464ee32500,
-			0x11c737270081eb00,
-			0x11cc28ea42056700,
-			0x11d11a900b3db500,
-			0x11d60c1853fb1800,
-			0x11dafd83140e0e00,
-			0x11dfeed043473e00,
-			0x11e4dfffd9778800,
-			0x11e9d111ce6ff400,
-			0x11eec2061a01c200,
-			0x11f3b2dcb3fe5e00,
-			0x11f8a39594376c00,
-			0x11fd9430b27eb900,
-			0x120284ae06a64900,
-			0x1207750d88805000,
-			0x120c654f2fdf3100,
-			0x12115572f4958500,
-			0x12164578ce761200,
-			0x121b3560b553d200,
-			0x1220252aa101f000,
-			0x122514d68953c900,
-			0x122a0464661ce900,
-			0x122ef3d42f311500,
-			0x1233e325dc643a00,
-			0x1238d259658a7f00,
-			0x123dc16ec2783800,
-			0x1242b065eb01ee00,
-			0x12479f3ed6fc5800,
-			0x124c8df97e3c6400,
-			0x12517c95d8972f00,
-			0x12566b13dde20a00,
-			0x125b597385f27500,
-			0x126047b4c89e2700,
-			0x126535d79dbb0600,
-			0x126a23dbfd1f2b00,
-			0x126f11c1dea0e100,
-			0x1273ff893a16a800,
-			0x1278ed3207572f00,
-			0x127ddabc3e395900,
-			0x1282c827d6943d00,
-			0x1287b574c83f2400,
-			0x128ca2a30b118800,
-			0x12918fb296e31800,
-			0x12967ca3638bb500,
-			0x129b697568e37400,
-			0x12a056289ec29a00,
-			0x12a542bcfd01a100,
-			0x12aa2f327b793900,
-			0x12af1b8912023e00,
-			0x12b407c0b875c700,
-			0x12b8f3d966ad1700,
-			0x12bddfd31481ac00,
-			0x12c2cbadb9cd2e00,
-			0x12c7b7694e698200,
-			0x12cca305ca30ba00,
-			0x12d18e8324fd1f00,
-			0x12d679e156a92900,
-			0x12db6520570f8900,
-			0x12e050401e0b2100,
-			0x12e53b40a3770700,
-			0x12ea2621df2e8300,
-			0x12ef10e3c90d1500,
-			0x12f3fb8658ee6e00,
-			0x12f8e60986ae7100,
-			0x12fdd06d4a293a00,
-			0x1302bab19b3b1500,
-			0x1307a4d671c08300,
-			0x130c8edbc5963a00,
-			0x131178c18e992500,
-			0x13166287c4a66000,
-			0x131b4c2e5f9b3d00,
-			0x132035b557554400,
-			0x13251f1ca3b22f00,
-			0x132a08643c8fed00,
-			0x132ef18c19cca300,
-			0x1333da943346a800,
-			0x1338c37c80dc8c00,
-			0x133dac44fa6d0b00,
-			0x134294ed97d72000,
-			0x13477d7650f9f400,
-			0x134c65df1db4ea00,
-			0x13514e27f5e79200,
-			0x13563650d171b800,
-			0x135b1e59a8335b00,
-			0x13600642720cae00,
-			0x1364ee0b26de1a00,
-			0x1369d5b3be883e00,
-			0x136ebd3c30ebea00,
-			0x1373a4a475ea2800,
-			0x13788bec85643700,
-			0x137d7314573b8700,
-			0x13825a1be351c300,
-			0x138741032188c600,
-			0x138c27ca09c2a500,
-			0x13910e7093e1a700,
-			0x1395f4f6b7c84e00,
-			0x139adb5c6d594900,
-			0x139fc1a1ac778500,
-			0x13a4a7c66d062000,
-			0x13a98dcaa6e87100,
-			0x13ae73ae52020000,
-			0x13b3597166369100,
-			0x13b83f13db6a1900,
-			0x13bd2495a980c600,
-			0x13c209f6c85efa00,
-			0x13c6ef372fe94f00,
-			0x13cbd456d8049500,
-			0x13d0b955b895d000,
-			0x13d59e33c9823c00,
-			0x13da82f102af4c00,
-			0x13df678d5c02a900,
-			0x13e44c08cd623000,
-			0x13e930634eb3f800,
-			0x13ee149cd7de4d00,
-			0x13f2f8b560c7b100,
-			0x13f7dcace156dd00,
-			0x13fcc0835172c200,
-			0x1401a438a9028600,
-			0x140687ccdfed8700,
-			0x140b6b3fee1b5700,
-			0x14104e91cb73c500,
-			0x141531c26fded000,
-			0x141a14d1d344b400,
-			0x141ef7bfed8dde00,
-			0x1423da8cb6a2f900,
-			0x1428bd38266ce000,
-			0x142d9fc234d4ac00,
-			0x1432822ad9c3a700,
-			0x143764720d235900,
-			0x143c4697c6dd7a00,
-			0x1441289bfedc0000,
-			0x14460a7ead091400,
-			0x144aec3fc94f1800,
-			0x144fcddf4b98a700,
-			0x1454af5d2bd09300,
-			0x145990b961e1e400,
-			0x145e71f3e5b7d900,
-			0x1463530caf3def00,
-			0x14683403b65fd200,
-			0x146d14d8f3096f00,
-			0x1471f58c5d26e200,
-			0x1476d61deca48600,
-			0x147bb68d996eea00,
-			0x148096db5b72d800,
-			0x148577072a9d4f00,
-			0x148a5710fedb8a00,
-			0x148f36f8d01af800,
-			0x149416be96494400,
-			0x1498f66249544f00,
-			0x149dd5e3e12a3400,
-			0x14a2b54355b94500,
-			0x14a794809ef00e00,
-			0x14ac739bb4bd5100,
-			0x14b152948f100d00,
-			0x14b6316b25d77700,
-			0x14bb101f7102fb00,
-			0x14bfeeb168824100,
-			0x14c4cd2104452800,
-			0x14c9ab6e3c3bca00,
-			0x14ce899908567500,
-			0x14d367a16085b700,
-			0x14d845873cba5200,
-			0x14dd234a94e54300,
-			0x14e200eb60f7bd00,
-			0x14e6de6998e33300,
-			0x14ebbbc534994a00,
-			0x14f098fe2c0be500,
-			0x14f57614772d1e00,
-			0x14fa53080def4b00,
-			0x14ff2fd8e844f600,
-			0x15040c86fe20ea00,
-			0x1508e91247762500,
-			0x150dc57abc37e500,
-			0x1512a1c054599900,
-			0x15177de307cef300,
-			0x151c59e2ce8bd900,
-			0x152135bfa0846c00,
-			0x1526117975ad0800,
-			0x152aed1045fa4200,
-			0x152fc8840960e900,
-			0x1534a3d4b7d60600,
-			0x15397f02494ede00,
-			0x153e5a0cb5c0ec00,
-			0x154334f3f521ea00,
-			0x15480fb7ff67c800,
-			0x154cea58cc88b300,
-			0x1551c4d6547b1200,
-			0x15569f308f358600,
-			0x155b796774aee800,
-			0x1560537afcde5200,
-			0x15652d6b1fbb1100,
-			0x156a0737d53cb300,
-			0x156ee0e1155afa00,
-			0x1573ba66d80deb00,
-			0x157893c9154dbd00,
-			0x157d6d07c512e900,
-			0x15824622df561e00,
-			0x15871f1a5c104a00,
-			0x158bf7ee333a9200,
-			0x1590d09e5cce5800,
-			0x1595a92ad0c53900,
-			0x159a819387190e00,
-			0x159f59d877c3e900,
-			0x15a431f99ac01a00,
-			0x15a909f6e8082900,
-			0x15ade1d05796dc00,
-			0x15b2b985e1673300,
-			0x15b791177d746a00,
-			0x15bc688523b9fb00,
-			0x15c13fcecc339400,
-			0x15c616f46edd2700,
-			0x15caedf603b2dd00,
-			0x15cfc4d382b11d00,
-			0x15d49b8ce3d48700,
-			0x15d972221f19fa00,
-			0x15de48932c7e8e00,
-			0x15e31ee003ff9a00,
-			0x15e7f5089d9aac00,
-			0x15eccb0cf14d9500,
-			0x15f1a0ecf7165c00,
-			0x15f676a8a6f34700,
-			0x15fb4c3ff8e2d600,
-			0x160021b2e4e3c900,
-			0x1604f70162f51900,
-			0x1609cc2b6b15fd00,
-			0x160ea130f545e600,
-			0x16137611f9848500,
-			0x16184ace6fd1c400,
-			0x161d1f66502dcc00,
-			0x1621f3d992990300,
-			0x1626c8282f140800,
-			0x162b9c521d9fbb00,
-			0x16307057563d3400,
-			0x16354437d0edce00,
-			0x163a17f385b31b00,
-			0x163eeb8a6c8eee00,
-			0x1643befc7d835300,
-			0x16489249b0929900,
-			0x164d6571fdbf4300,
-			0x165238755d0c1b00,
-			0x16570b53c67c2000,
-			0x165bde0d32129500,
-			0x1660b0a197d2f400,
-			0x16658310efc0fa00,
-			0x166a555b31e09b00,
-			0x166f278056361100,
-			0x1673f98054c5ca00,
-			0x1678cb5b25947900,
-			0x167d9d10c0a70a00,
-			0x16826ea11e02a700,
-			0x1687400c35acbc00,
-			0x168c1151ffaaed00,
-			0x1690e27274032000,
-			0x1695b36d8abb7600,
-			0x169a84433bda5000,
-			0x169f54f37f664a00,
-			0x16a4257e4d664300,
-			0x16a8f5e39de15200,
-			0x16adc62368ded100,
-			0x16b2963da6665500,
-			0x16b766324e7fb300,
-			0x16bc36015932fc00,
-			0x16c105aabe888400,
-			0x16c5d52e7688d800,
-			0x16caa48c793cc600,
-			0x16cf73c4bead5900,
-			0x16d442d73ee3dd00,
-			0x16d911c3f1e9db00,
-			0x16dde08acfc91a00,
-			0x16e2af2bd08b9f00,
-			0x16e77da6ec3bb200,
-			0x16ec4bfc1ae3d500,
-			0x16f11a2b548eca00,
-			0x16f5e83491479300,
-			0x16fab617c9197100,
-			0x16ff83d4f40fe200,
-			0x1704516c0a36a500,
-			0x17091edd0399b700,
-			0x170dec27d8455500,
-			0x1712b94c8045fa00,
-			0x1717864af3a86000,
-			0x171c53232a798400,
-			0x17211fd51cc69b00,
-			0x1725ec60c29d2100,
-			0x172ab8c6140acd00,
-			0x172f8505091d9700,
-			0x1734511d99e3b500,
-			0x17391d0fbe6b9f00,
-			0x173de8db6ec40b00,
-			0x1742b480a2fbf000,
-			0x17477fff53228000,
-			0x174c4b5777473500,
-			0x175116890779c200,
-			0x1755e193fbca1c00,
-			0x175aac784c487900,
-			0x175f7735f1054e00,
-			0x176441cce2115000,
-			0x17690c3d177d7300,
-			0x176dd686895aee00,
-			0x1772a0a92fbb3600,
-			0x17776aa502b00300,
-			0x177c3479fa4b4700,
-			0x1780fe280e9f3a00,
-			0x1785c7af37be5500,
-			0x178a910f6dbb4c00,
-			0x178f5a48a8a91800,
-			0x1794235ae09af200,
-			0x1798ec460da45300,
-			0x179db50a27d8f400,
-			0x17a27da7274ccd00,
-			0x17a7461d04141d00,
-			0x17ac0e6bb6435e00,
-			0x17b0d69335ef4d00,
-			0x17b59e937b2ce500,
-			0x17ba666c7e116900,
-			0x17bf2e1e36b25500,
-			0x17c3f5a89d256b00,
-			0x17c8bd0ba980ac00,
-			0x17cd844753da5b00,
-			0x17d24b5b9448fe00,
-			0x17d7124862e35600,
-			0x17dbd90db7c06e00,
-			0x17e09fab8af78d00,
-			0x17e56621d4a03b00,
-			0x17ea2c708cd24300,
-			0x17eef297aba5b300,
-			0x17f3b8972932d700,
-			0x17f87e6efd924000,
-			0x17fd441f20dcbe00,
-			0x180209a78b2b6600,
-			0x1806cf0834978b00,
-			0x180b9441153ac400,
-			0x18105952252eea00,
-			0x18151e3b5c8e1700,
-			0x1819e2fcb372a600,
-			0x181ea79621f73800,
-			0x18236c07a036ac00,
-			0x18283051264c2600,
-			0x182cf472ac530800,
-			0x1831b86c2a66fb00,
-			0x18367c3d98a3e900,
-			0x183b3fe6ef25fb00,
-			0x184003682609a200,
-			0x1844c6c1356b8d00,
-			0x184989f21568af00,
-			0x184e4cfabe1e3d00,
-			0x18530fdb27a9b100,
-			0x1857d2934a28c400,
-			0x185c95231db97400,
-			0x1861578a9a7a0000,
-			0x186619c9b888ee00,
-			0x186adbe070050100,
-			0x186f9dceb90d4300,
-			0x18745f948bc0fe00,
-			0x18792131e03fc400,
-			0x187de2a6aea96300,
-			0x1882a3f2ef1df200,
-			0x1887651699bdc800,
-			0x188c2611a6a98200,
-			0x1890e6e40e01fb00,
-			0x1895a78dc7e85800,
-			0x189a680ecc7dfc00,
-			0x189f286713e49300,
-			0x18a3e896963e0400,
-			0x18a8a89d4bac8100,
-			0x18ad687b2c527d00,
-			0x18b228303052ae00,
-			0x18b6e7bc4fd01000,
-			0x18bba71f82edde00,
-			0x18c06659c1cf9d00,
-			0x18c5256b04991000,
-			0x18c9e453436e4200,
-			0x18cea31276737f00,
-			0x18d361a895cd5b00,
-			0x18d8201599a0a800,
-			0x18dcde597a128100,
-			0x18e19c742f484400,
-			0x18e65a65b1679300,
-			0x18eb182df8965100,
-			0x18efd5ccfcfaab00,
-			0x18f49342b6bb0f00,
-			0x18f9508f1dfe3000,
-			0x18fe0db22aeb0400,
-			0x1902caabd5a8c800,
-			0x1907877c165efd00,
-			0x190c4422e5356600,
-			0x191100a03a540d00,
-			0x1915bcf40de34100,
-			0x191a791e580b9500,
-			0x191f351f10f5df00,
-			0x1923f0f630cb3d00,
-			0x1928aca3afb51100,
-			0x192d682785dd0000,
-			0x19322381ab6cf500,
-			0x1936deb2188f2100,
-			0x193b99b8c56dfa00,
-			0x19405495aa343b00,
-			0x19450f48bf0ce100,
-			0x1949c9d1fc233400,
-			0x194e843159a2bc00,
-			0x19533e66cfb74a00,
-			0x1957f872568cf200,
-			0x195cb253e6501100,
-			0x19616c0b772d4300,
-			0x1966259901517000,
-			0x196adefc7ce9c100,
-			0x196f9835e223aa00,
-			0x19745145292cde00,
-			0x19790a2a4a335b00,
-			0x197dc2e53d656200,
-			0x19827b75faf17c00,
-			0x198733dc7b067600,
-			0x198bec18b5d36200,
-			0x1990a42aa3879c00,
-			0x19955c123c52c100,
-			0x199a13cf7864ba00,
-			0x199ecb624fedb000,
-			0x19a382cabb1e1600,
-			0x19a83a08b226a500,
-			0x19acf11c2d385c00,
-			0x19b1a80524847c00,
-			0x19b65ec3903c9600,
-			0x19bb155768927800,
-			0x19bfcbc0a5b83b00,
-			0x19c481ff3fe03e00,
-			0x19c938132f3d2700,
-			0x19cdedfc6c01e100,
-			0x19d2a3baee61a200,
-			0x19d7594eae8fdd00,
-			0x19dc0eb7a4c05900,
-			0x19e0c3f5c9271a00,
-			0x19e5790913f86e00,
-			0x19ea2df17d68eb00,
-			0x19eee2aefdad6d00,
-			0x19f397418cfb1600,
-			0x19f84ba923875100,
-			0x19fcffe5b987cf00,
-			0x1a01b3f747328a00,
-			0x1a0667ddc4bdc100,
-			0x1a0b1b992a5ff900,
-			0x1a0fcf2970500400,
-			0x1a14828e8ec4f500,
-			0x1a1935c87df62b00,
-			0x1a1de8d7361b4a00,
-			0x1a229bbaaf6c4000,
-			0x1a274e72e2213d00,
-			0x1a2c00ffc672c300,
-			0x1a30b36154998e00,
-			0x1a35659784ceb000,
-			0x1a3a17a24f4b7800,
-			0x1a3ec981ac498100,
-			0x1a437b359402af00,
-			0x1a482cbdfeb12e00,
-			0x1a4cde1ae48f6b00,
-			0x1a518f4c3dd82800,
-			0x1a56405202c66300,
-			0x1a5af12c2b956700,
-			0x1a5fa1dab080ca00,
-			0x1a64525d89c46600,
-			0x1a6902b4af9c5f00,
-			0x1a6db2e01a452100,
-			0x1a7262dfc1fb6000,
-			0x1a7712b39efc1b00,
-			0x1a7bc25ba9849600,
-			0x1a8071d7d9d25e00,
-			0x1a85212828234d00,
-			0x1a89d04c8cb58000,
-			0x1a8e7f44ffc75e00,
-			0x1a932e1179979b00,
-			0x1a97dcb1f2652e00,
-			0x1a9c8b26626f5c00,
-			0x1aa1396ec1f5af00,
-			0x1aa5e78b0937fa00,
-			0x1aaa957b30765e00,
-			0x1aaf433f2ff13f00,
-			0x1ab3f0d6ffe94b00,
-			0x1ab89e42989f7f00,
-			0x1abd4b81f2551b00,
-			0x1ac1f895054ba900,
-			0x1ac6a57bc9c4ff00,
-			0x1acb523638033a00,
-			0x1acffec44848c400,
-			0x1ad4ab25f2d84b00,
-			0x1ad9575b2ff4c900,
-			0x1ade0363f7e18400,
-			0x1ae2af4042e20800,
-			0x1ae75af0093a2c00,
-			0x1aec0673432e1300,
-			0x1af0b1c9e9022700,
-			0x1af55cf3f2fb1900,
-			0x1afa07f1595ded00,
-			0x1afeb2c2146fe500,
-			0x1b035d661c769a00,
-			0x1b0807dd69b7e300,
-			0x1b0cb227f479e800,
-			0x1b115c45b5031a00,
-			0x1b160636a39a3400,
-			0x1b1aaffab8863700,
-			0x1b1f5991ec0e7800,
-			0x1b2402fc367a8c00,
-			0x1b28ac3990125800,
-			0x1b2d5549f11e0a00,
-			0x1b31fe2d51e61b00,
-			0x1b36a6e3aab34e00,
-			0x1b3b4f6cf3ceb100,
-			0x1b3ff7c925819b00,
-			0x1b449ff83815b100,
-			0x1b4947fa23d4e000,
-			0x1b4defcee1095f00,
-			0x1b52977667fdb200,
-			0x1b573ef0b0fca900,
-			0x1b5be63db4515a00,
-			0x1b608d5d6a472b00,
-			0x1b65344fcb29ca00,
-			0x1b69db14cf453300,
-			0x1b6e81ac6ee5ab00,
-			0x1b732816a257be00,
-			0x1b77ce5361e84d00,
-			0x1b7c7462a5e47c00,
-			0x1b811a446699bd00,
-			0x1b85bff89c55d000,
-			0x1b8a657f3f66bb00,
-			0x1b8f0ad8481ad400,
-			0x1b93b003aec0bb00,
-			0x1b9855016ba75b00,
-			0x1b9cf9d1771dea00,
-			0x1ba19e73c973ed00,
-			0x1ba642e85af93000,
-			0x1baae72f23fdcf00,
-			0x1baf8b481cd23000,
-			0x1bb42f333dc70300,
-			0x1bb8d2f07f2d4800,
-			0x1bbd767fd9564900,
-			0x1bc219e144939700,
-			0x1bc6bd14b9371b00,
-			0x1bcb601a2f92ff00,
-			0x1bd002f19ff9bb00,
-			0x1bd4a59b02be1a00,
-			0x1bd9481650332a00,
-			0x1bddea6380ac4e00,
-			0x1be28c828c7d3000,
-			0x1be72e736bf9c400,
-			0x1bebd03617765300,
-			0x1bf071ca87476b00,
-			0x1bf51330b3c1e900,
-			0x1bf9b468953af800,
-			0x1bfe557224080e00,
-			0x1c02f64d587eed00,
-			0x1c0796fa2af5a600,
-			0x1c0c377893c29500,
-			0x1c10d7c88b3c6500,
-			0x1c1577ea09ba0a00,
-			0x1c1a17dd0792c800,
-			0x1c1eb7a17d1e3100,
-			0x1c23573762b42100,
-			0x1c27f69eb0acc200,
-			0x1c2c95d75f608e00,
-			0x1c3134e167284800,
-			0x1c35d3bcc05d0000,
-			0x1c3a726963581b00,
-			0x1c3f10e748733f00,
-			0x1c43af3668086d00,
-			0x1c484d56ba71e800,
-			0x1c4ceb48380a4500,
-			0x1c51890ad92c6900,
-			0x1c56269e96338400,
-			0x1c5ac403677b1100,
-			0x1c5f6139455edf00,
-			0x1c63fe40283b0600,
-			0x1c689b18086bec00,
-			0x1c6d37c0de4e4700,
-			0x1c71d43aa23f1900,
-			0x1c7670854c9bb500,
-			0x1c7b0ca0d5c1b800,
-			0x1c7fa88d360f0e00,
-			0x1c84444a65e1f400,
-			0x1c88dfd85d98f200,
-			0x1c8d7b371592de00,
-			0x1c921666862ee000,
-			0x1c96b166a7cc6900,
-			0x1c9b4c3772cb3d00,
-			0x1c9fe6d8df8b6c00,
-			0x1ca4814ae66d5400,
-			0x1ca91b8d7fd1a400,
-			0x1cadb5a0a4195800,
-			0x1cb24f844ba5b600,
-			0x1cb6e9386ed85e00,
-			0x1cbb82bd06133400,
-			0x1cc01c1209b86e00,
-			0x1cc4b537722a9200,
-			0x1cc94e2d37cc7600,
-			0x1ccde6f353013900,
-			0x1cd27f89bc2c5200,
-			0x1cd717f06bb17d00,
-			0x1cdbb02759f4cf00,
-			0x1ce0482e7f5aa300,
-			0x1ce4e005d447a700,
-			0x1ce977ad5120db00,
-			0x1cee0f24ee4b8a00,
-			0x1cf2a66ca42d5000,
-			0x1cf73d846b2c1900,
-			0x1cfbd46c3bae1f00,
-			0x1d006b240e19e900,
-			0x1d0501abdad65600,
-			0x1d0998039a4a8a00,
-			0x1d0e2e2b44de0000,
-			0x1d12c422d2f88000,
-			0x1d1759ea3d022100,
-			0x1d1bef817b634a00,
-			0x1d2084e88684b500,
-			0x1d251a1f56cf6400,
-			0x1d29af25e4acb400,
-			0x1d2e43fc28864700,
-			0x1d32d8a21ac61500,
-			0x1d376d17b3d66600,
-			0x1d3c015cec21d000,
-			0x1d409571bc133a00,
-			0x1d4529561c15db00,
-			0x1d49bd0a04953a00,
-			0x1d4e508d6dfd3100,
-			0x1d52e3e050b9e500,
-			0x1d577702a537ce00,
-			0x1d5c09f463e3b600,
-			0x1d609cb5852ab700,
-			0x1d652f46017a3700,
-			0x1d69c1a5d13ff400,
-			0x1d6e53d4ece9f700,
-			0x1d72e5d34ce69b00,
-			0x1d7777a0e9a48f00,
-			0x1d7c093dbb92c900,
-			0x1d809aa9bb209f00,
-			0x1d852be4e0bda900,
-			0x1d89bcef24d9d900,
-			0x1d8e4dc87fe56f00,
-			0x1d92de70ea50fe00,
-			0x1d976ee85c8d6300,
-			0x1d9bff2ecf0bd700,
-			0x1da08f443a3dda00,
-			0x1da51f2896954700,
-			0x1da9aedbdc844100,
-			0x1dae3e5e047d4000,
-			0x1db2cdaf06f30f00,
-			0x1db75ccedc58c900,
-			0x1dbbebbd7d21d900,
-			0x1dc07a7ae1c1fe00,
-			0x1dc5090702ad4800,
-			0x1dc99761d8581500,
-			0x1dce258b5b371b00,
-			0x1dd2b38383bf5b00,
-			0x1dd7414a4a662e00,
-			0x1ddbcedfa7a13a00,
-			0x1de05c4393e67800,
-			0x1de4e97607ac3500,
-			0x1de97676fb690e00,
-			0x1dee03466793ef00,
-			0x1df28fe444a41f00,
-			0x1df71c508b112d00,
-			0x1dfba88b3352ff00,
-			0x1e00349435e1ce00,
-			0x1e04c06b8b362300,
-			0x1e094c112bc8da00,
-			0x1e0dd78510132300,
-			0x1e1262c7308e7b00,
-			0x1e16edd785b4ba00,
-			0x1e1b78b608000200,
-			0x1e200362afeacb00,
-			0x1e248ddd75efe200,
-			0x1e291826528a6300,
-			0x1e2da23d3e35bd00,
-			0x1e322c22316db400,
-			0x1e36b5d524ae5d00,
-			0x1e3b3f5610741f00,
-			0x1e3fc8a4ed3bb800,
-			0x1e4451c1b3823200,
-			0x1e48daac5bc4ef00,
-			0x1e4d6364de81a400,
-			0x1e51ebeb34365700,
-			0x1e56743f55616100,
-			0x1e5afc613a817200,
-			0x1e5f8450dc158500,
-			0x1e640c0e329cf300,
-			0x1e68939936975e00,
-			0x1e6d1af1e084c500,
-			0x1e71a21828e57100,
-			0x1e76290c083a0400,
-			0x1e7aafcd77037300,
-			0x1e7f365c6dc30700,
-			0x1e83bcb8e4fa5800,
-			0x1e8842e2d52b5900,
-			0x1e8cc8da36d84900,
-			0x1e914e9f0283c000,
-			0x1e95d43130b0a900,
-			0x1e9a5990b9e24000,
-			0x1e9edebd969c1800,
-			0x1ea363b7bf621800,
-			0x1ea7e87f2cb87600,
-			0x1eac6d13d723c400,
-			0x1eb0f175b728e200,
-			0x1eb575a4c54d0400,
-			0x1eb9f9a0fa15b600,
-			0x1ebe7d6a4e08d700,
-			0x1ec30100b9ac9600,
-			0x1ec7846435877f00,
-			0x1ecc0794ba206500,
-			0x1ed08a923ffe8100,
-			0x1ed50d5cbfa95200,
-			0x1ed98ff431a8ae00,
-			0x1ede12588e84c600,
-			0x1ee29489cec61b00,
-			0x1ee71687eaf58100,
-			0x1eeb9852db9c2600,
-			0x1ef019ea99438500,
-			0x1ef49b4f1c757600,
-			0x1ef91c805dbc2200,
-			0x1efd9d7e55a20500,
-			0x1f021e48fcb1f300,
-			0x1f069ee04b771600,
-			0x1f0b1f443a7ce800,
-			0x1f0f9f74c24f3b00,
-			0x1f141f71db7a3900,
-			0x1f189f3b7e8a5b00,
-			0x1f1d1ed1a40c7500,
-			0x1f219e34448dac00,
-			0x1f261d63589b7c00,
-			0x1f2a9c5ed8c3ba00,
-			0x1f2f1b26bd948700,
-			0x1f3399baff9c6300,
-			0x1f38181b976a2100,
-			0x1f3c96487d8ce500,
-			0x1f411441aa942e00,
-			0x1f459207170fcd00,
-			0x1f4a0f98bb8fec00,
-			0x1f4e8cf690a50900,
-			0x1f530a208edff600,
-			0x1f578716aed1dd00,
-			0x1f5c03d8e90c4000,
-			0x1f6080673620f200,
-			0x1f64fcc18ea22000,
-			0x1f6978e7eb224900,
-			0x1f6df4da44344600,
-			0x1f727098926b4700,
-			0x1f76ec22ce5acc00,
-			0x1f7b6778f096b100,
-			0x1f7fe29af1b32700,
-			0x1f845d88ca44b500,
-			0x1f88d84272e03300,
-			0x1f8d52c7e41adb00,
-			0x1f91cd19168a3300,
-			0x1f96473602c41e00,
-			0x1f9ac11ea15ed000,
-			0x1f9f3ad2eaf0d900,
-			0x1fa3b452d8111d00,
-			0x1fa82d9e6156d700,
-			0x1faca6b57f599400,
-			0x1fb11f982ab14400,
-			0x1fb598465bf62400,
-			0x1fba10c00bc0c600,
-			0x1fbe890532aa1b00,
-			0x1fc30115c94b6500,
-			0x1fc778f1c83e4400,
-			0x1fcbf099281ca400,
-			0x1fd0680be180d200,
-			0x1fd4df49ed056f00,
-			0x1fd9565343457100,
-			0x1fddcd27dcdc2700,
-			0x1fe243c7b2653800,
-			0x1fe6ba32bc7ca400,
-			0x1feb3068f3bebc00,
-			0x1fefa66a50c82f00,
-			0x1ff41c36cc360200,
-			0x1ff891ce5ea58f00,
-			0x1ffd073100b48c00,
-			0x20017c5eab00fe00,
-			0x2005f15756295000,
-			0x200a661afacc3800,
-			0x200edaa99188c600,
-			0x20134f0312fe6800,
-			0x2017c32777cce200,
-			0x201c3716b8944600,
-			0x2020aad0cdf50e00,
-			0x20251e55b0900000,
-			0x202991a559063e00,
-			0x202e04bfbff94400,
-			0x203277a4de0ae400,
-			0x2036ea54abdd4600,
-			0x203b5ccf2212f200,
-			0x203fcf14394ec000,
-			0x20444123ea33e200,
-			0x2048b2fe2d65e800,
-			0x204d24a2fb88b400,
-			0x205196124d408600,
-			0x2056074c1b31ee00,
-			0x205a78505e01de00,
-			0x205ee91f0e559e00,
-			0x206359b824d2ca00,
-			0x2067ca1b9a1f5e00,
-			0x206c3a4966e1aa00,
-			0x2070aa4183c05400,
-			0x20751a03e9626600,
-			0x20798990906f3600,
-			0x207df8e7718e7c00,
-			0x2082680885684400,
-			0x2086d6f3c4a4f600,
-			0x208b45a927ed5200,
-			0x208fb428a7ea7200,
-			0x209422723d45c600,
-			0x20989085e0a91e00,
-			0x209cfe638abe9a00,
-			0x20a16c0b3430bc00,
-			0x20a5d97cd5aa5c00,
-			0x20aa46b867d6a800,
-			0x20aeb3bde3612e00,
-			0x20b3208d40f5d400,
-			0x20b78d267940d400,
-			0x20bbf98984eec600,
-			0x20c065b65cac9e00,
-			0x20c4d1acf927a400,
-			0x20c93d6d530d8200,
-			0x20cda8f7630c3200,
-			0x20d2144b21d20e00,
-			0x20d67f68880dca00,
-			0x20daea4f8e6e7400,
-			0x20df55002da36a00,
-			0x20e3bf7a5e5c7800,
-			0x20e829be1949b400,
-			0x20ec93cb571b9000,
-			0x20f0fda21082e000,
-			0x20f567423e30ca00,
-			0x20f9d0abd8d6d800,
-			0x20fe39ded926e000,
-			0x2102a2db37d32000,
-			0x21070ba0ed8e2a00,
-			0x210b742ff30aec00,
-			0x210fdc8840fcac00,
-			0x211444a9d0170e00,
-			0x2118ac94990e1200,
-			0x211d144894960c00,
-			0x21217bc5bb63b000,
-			0x2125e30c062c0c00,
-			0x212a4a1b6da48c00,
-			0x212eb0f3ea82f000,
-			0x21331795757d5200,
-			0x21377e00074a3400,
-			0x213be43398a06800,
-			0x21404a3022371800,
-			0x2144aff59cc5d200,
-			0x2149158401047e00,
-			0x214d7adb47ab5800,
-			0x2151dffb69730200,
-			0x215644e45f146e00,
-			0x215aa9962148f200,
-			0x215f0e10a8ca3e00,
-			0x21637253ee525600,
-			0x2167d65fea9ba200,
-			0x216c3a349660e600,
-			0x21709dd1ea5d3800,
-			0x21750137df4c1600,
-			0x217964666de95000,
-			0x217dc75d8ef11600,
-			0x21822a1d3b1ff600,
-			0x21868ca56b32d200,
-			0x218aeef617e6f000,
-			0x218f510f39f9f000,
-			0x2193b2f0ca29ca00,
-			0x2198149ac134d400,
-			0x219c760d17d9c600,
-			0x21a0d747c6d7aa00,
-			0x21a5384ac6edec00,
-			0x21a9991610dc5400,
-			0x21adf9a99d630600,
-			0x21b25a0565428200,
-			0x21b6ba29613ba400,
-			0x21bb1a158a0fa200,
-			0x21bf79c9d8801600,
-			0x21c3d946454eec00,
-			0x21c8388ac93e7800,
-			0x21cc97975d115e00,
-			0x21d0f66bf98aaa00,
-			0x21d55508976dc000,
-			0x21d9b36d2f7e5c00,
-			0x21de1199ba80a000,
-			0x21e26f8e31390600,
-			0x21e6cd4a8c6c6200,
-			0x21eb2acec4dfea00,
-			0x21ef881ad3593000,
-			0x21f3e52eb09e2000,
-			0x21f8420a55750600,
-			0x21fc9eadbaa48800,
-			0x2200fb18d8f3ae00,
-			0x2205574ba929da00,
-			0x2209b346240eca00,
-			0x220e0f08426a9a00,
-			0x22126a91fd05c800,
-			0x2216c5e34ca92a00,
-			0x221b20fc2a1df400,
-			0x221f7bdc8e2db800,
-			0x2223d68471a26800,
-			0x222830f3cd465000,
-			0x222c8b2a99e41c00,
-			0x2230e528d046d400,
-			0x22353eee6939e000,
-			0x2239987b5d890400,
-			0x223df1cfa6006000,
-			0x22424aeb3b6c7600,
-			0x2246a3ce169a2200,
-			0x224afc783056a200,
-			0x224f54e9816f8c00,
-			0x2253ad2202b2dc00,
-			0x22580521aceee600,
-			0x225c5ce878f25e00,
-			0x2260b4765f8c5200,
-			0x22650bcb598c3a00,
-			0x226962e75fc1e200,
-			0x226db9ca6afd7200,
-			0x22721074740f7800,
-			0x227666e573c8e000,
-			0x227abd1d62faf200,
-			0x227f131c3a775000,
-			0x228368e1f3100200,
-			0x2287be6e85976c00,
-			0x228c13c1eae05000,
-			0x229068dc1bbdce00,
-			0x2294bdbd11036600,
-			0x22991264c384f800,
-			0x229d66d32c16c000,
-			0x22a1bb08438d5800,
-			0x22a60f0402bdbe00,
-			0x22aa62c6627d4c00,
-			0x22aeb64f5ba1ba00,
-			0x22b3099ee7011e00,
-			0x22b75cb4fd71f200,
-			0x22bbaf9197cb0e00,
-			0x22c00234aee3a200,
-			0x22c4549e3b934400,
-			0x22c8a6ce36b1ee00,
-			0x22ccf8c49917ea00,
-			0x22d14a815b9df400,
-			0x22d59c04771d1400,
-			0x22d9ed4de46ec400,
-			0x22de3e5d9c6cd200,
-			0x22e28f3397f16e00,
-			0x22e6dfcfcfd72800,
-			0x22eb30323cf8f200,
-			0x22ef805ad8321a00,
-			0x22f3d0499a5e4e00,
-			0x22f81ffe7c59a000,
-			0x22fc6f7977007a00,
-			0x2300beba832fb200,
-			0x23050dc199c47000,
-			0x23095c8eb39c4600,
-			0x230dab21c9952400,
-			0x2311f97ad48d5400,
-			0x23164799cd638a00,
-			0x231a957eacf6d200,
-			0x231ee3296c269c00,
-			0x2323309a03d2b800,
-			0x23277dd06cdb5200,
-			0x232bcacca0210000,
-			0x2330178e9684b000,
-			0x2334641648e7b200,
-			0x2338b063b02bb800,
-			0x233cfc76c532d400,
-			0x2341484f80df7800,
-			0x234593eddc147a00,
-			0x2349df51cfb50a00,
-			0x234e2a7b54a4bc00,
-			0x2352756a63c78a00,
-			0x2356c01ef601c600,
-			0x235b0a9904382600,
-			0x235f54d8874fc800,
-			0x23639edd782e1e00,
-			0x2367e8a7cfb90400,
-			0x236c323786d6b600,
-			0x23707b8c966dce00,
-			0x2374c4a6f7654c00,
-			0x23790d86a2a48800,
-			0x237d562b91134800,
-			0x23819e95bb99aa00,
-			0x2385e6c51b202e00,
-			0x238a2eb9a88fb800,
-			0x238e76735cd19000,
-			0x2392bdf230cf5800,
-			0x239705361d731c00,
-			0x239b4c3f1ba73e00,
-			0x239f930d24569000,
-			0x23a3d9a0306c3a00,
-			0x23a81ff838d3ce00,
-			0x23ac661536793400,
-			0x23b0abf72248c600,
-			0x23b4f19df52f3400,
-			0x23b93709a8199000,
-			0x23bd7c3a33f55400,
-			0x23c1c12f91b05a00,
-			0x23c605e9ba38de00,
-			0x23ca4a68a67d7800,
-			0x23ce8eac4f6d2a00,
-			0x23d2d2b4adf75600,
-			0x23d71681bb0bc000,
-			0x23db5a136f9a8a00,
-			0x23df9d69c4943e00,
-			0x23e3e084b2e9ca00,
-			0x23e82364338c7200,
-			0x23ec66083f6dec00,
-			0x23f0a870cf804600,
-			0x23f4ea9ddcb5f800,
-			0x23f92c8f6001d400,
-			0x23fd6e4552571400,
-			0x2401afbfaca95600,
-			0x2405f0fe67ec9600,
-			0x240a32017d153600,
-			0x240e72c8e517f800,
-			0x2412b35498ea0600,
-			0x2416f3a49180e800,
-			0x241b33b8c7d28a00,
-			0x241f739134d53a00,
-			0x2423b32dd17fae00,
-			0x2427f28e96c8fa00,
-			0x242c31b37da89400,
-			0x2430709c7f165a00,
-			0x2434af49940a8c00,
-			0x2438edbab57dc800,
-			0x243d2befdc691600,
-			0x244169e901c5e200,
-			0x2445a7a61e8df000,
-			0x2449e5272bbb7800,
-			0x244e226c22490600,
-			0x24525f74fb319200,
-			0x24569c41af707a00,
-			0x245ad8d238017600,
-			0x245f15268de0aa00,
-			0x2463513eaa0a9a00,
-			0x24678d1a857c3000,
-			0x246bc8ba1932b600,
-			0x2470041d5e2bde00,
-			0x24743f444d65ba00,
-			0x24787a2edfdec400,
-			0x247cb4dd0e95d600,
-			0x2480ef4ed28a3000,
-			0x2485298424bb7800,
-			0x2489637cfe29b400,
-			0x248d9d3957d55000,
-			0x2491d6b92abf1e00,
-			0x24960ffc6fe84e00,
-			0x249a490320528000,
-			0x249e81cd34ffaa00,
-			0x24a2ba5aa6f23000,
-			0x24a6f2ab6f2cdc00,
-			0x24ab2abf86b2d200,
-			0x24af6296e687a000,
-			0x24b39a3187af4200,
-			0x24b7d18f632e0600,
-			0x24bc08b07208b000,
-			0x24c03f94ad445c00,
-			0x24c4763c0de69200,
-			0x24c8aca68cf53e00,
-			0x24cce2d42376ae00,
-			0x24d118c4ca719400,
-			0x24d54e787aed0e00,
-			0x24d983ef2df09800,
-			0x24ddb928dc841400,
-			0x24e1ee257fafca00,
-			0x24e622e5107c6800,
-			0x24ea576787f30400,
-			0x24ee8bacdf1d1000,
-			0x24f2bfb50f046c00,
-			0x24f6f38010b35800,
-			0x24fb270ddd348000,
-			0x24ff5a5e6d92ea00,
-			0x25038d71bada0c00,
-			0x2507c047be15be00,
-			0x250bf2e070523a00,
-			0x2510253bca9c2400,
-			0x25145759c6008600,
-			0x2518893a5b8cce00,
-			0x251cbadd844ecc00,
-			0x2520ec433954ba00,
-			0x25251d6b73ad3a00,
-			0x25294e562c674e00,
-			0x252d7f035c926000,
-			0x2531af72fd3e4200,
-			0x2535dfa5077b2a00,
-			0x253a0f997459b400,
-			0x253e3f503ceae200,
-			0x25426ec95a401c00,
-			0x25469e04c56b3400,
-			0x254acd02777e5c00,
-			0x254efbc2698c2c00,
-			0x25532a4494a7aa00,
-			0x25575888f1e43c00,
-			0x255b868f7a55b000,
-			0x255fb45827103800,
-			0x2563e1e2f1287000,
-			0x25680f2fd1b35a00,
-			0x256c3c3ec1c65e00,
-			0x2570690fba774800,
-			0x257495a2b4dc4c00,
-			0x2578c1f7aa0c0a00,
-			0x257cee0e931d8000,
-			0x258119e769281600,
-			0x258545822543a200,
-			0x258970dec0885200,
-			0x258d9bfd340eca00,
-			0x2591c6dd78f00c00,
-			0x2595f17f88458000,
-			0x259a1be35b28fe00,
-			0x259e4608eab4bc00,
-			0x25a26ff030035a00,
-			0x25a69999242fe000,
-			0x25aac303c055be00,
-			0x25aeec2ffd90ca00,
-			0x25b3151dd4fd3e00,
-			0x25b73dcd3fb7c000,
-			0x25bb663e36dd6000,
-			0x25bf8e70b38b8a00,
-			0x25c3b664aee01e00,
-			0x25c7de1a21f95e00,
-			0x25cc059105f5f200,
-			0x25d02cc953f4ec00,
-			0x25d453c30515c600,
-			0x25d87a7e12786000,
-			0x25dca0fa753d0200,
-			0x25e0c73826845c00,
-			0x25e4ed371f6f8600,
-			0x25e912f759200000,
-			0x25ed3878ccb7b400,
-			0x25f15dbb7358ee00,
-			0x25f582bf46266800,
-			0x25f9a7843e434000,
-			0x25fdcc0a54d30200,
-			0x2601f05182f99800,
-			0x26061459c1db5e00,
-			0x260a38230a9d1400,
-			0x260e5bad5663e000,
-			0x26127ef89e555600,
-			0x2616a204db976e00,
-			0x261ac4d207508a00,
-			0x261ee7601aa77200,
-			0x262309af0ec35a00,
-			0x26272bbedccbdc00,
-			0x262b4d8f7de90000,
-			0x262f6f20eb432a00,
-			0x263390731e033600,
-			0x2637b1860f526000,
-			0x263bd259b85a4c00,
-			0x263ff2ee12450800,
-			0x26441343163d1200,
-			0x26483358bd6d4800,
-			0x264c532f0100ee00,
-			0x265072c5da23be00,
-			0x2654921d4201d000,
-			0x2658b13531c7aa00,
-			0x265cd00da2a23a00,
-			0x2660eea68dbed400,
-			0x26650cffec4b3e00,
-			0x26692b19b7759c00,
-			0x266d48f3e86c8200,
-			0x2671668e785eec00,
-			0x267583e9607c4200,
-			0x2679a10499f44e00,
-			0x267dbde01df74c00,
-			0x2681da7be5b5da00,
-			0x2685f6d7ea610800,
-			0x268a12f4252a4600,
-			0x268e2ed08f437600,
-			0x26924a6d21dedc00,
-			0x269665c9d62f2e00,
-			0x269a80e6a5678600,
-			0x269e9bc388bb6800,
-			0x26a2b660795ec400,
-			0x26a6d0bd7085f400,
-			0x26aaeada6765ba00,
-			0x26af04b757334000,
-			0x26b31e5439242400,
-			0x26b737b1066e6400,
-			0x26bb50cdb8486800,
-			0x26bf69aa47e90600,
-			0x26c38246ae878200,
-			0x26c79aa2e55b8200,
-			0x26cbb2bee59d1a00,
-			0x26cfca9aa884ca00,
-			0x26d3e236274b7800,
-			0x26d7f9915b2a7c00,
-			0x26dc10ac3d5b8e00,
-			0x26e02786c718d800,
-			0x26e43e20f19cf000,
-			0x26e8547ab622ce00,
-			0x26ec6a940de5dc00,
-			0x26f0806cf221f000,
-			0x26f496055c134000,
-			0x26f8ab5d44f67c00,
-			0x26fcc074a608b000,
-			0x2700d54b78875c00,
-			0x2704e9e1b5b06c00,
-			0x2708fe3756c23000,
-			0x270d124c54fb6600,
-			0x27112620a99b3a00,
-			0x271539b44de13e00,
-			0x27194d073b0d7400,
-			0x271d60196a604400,
-			0x272172ead51a8600,
-			0x2725857b747d7e00,
-			0x272997cb41cad400,
-			0x272da9da3644a200,
-			0x2731bba84b2d6c00,
-			0x2735cd3579c81e00,
-			0x2739de81bb581600,
-			0x273def8d09211600,
-			0x274200575c675200,
-			0x274610e0ae6f6600,
-			0x274a2128f87e5a00,
-			0x274e313033d9a200,
-			0x275240f659c72000,
-			0x2756507b638d1e00,
-			0x275a5fbf4a725000,
-			0x275e6ec207bde200,
-			0x27627d8394b75a00,
-			0x27668c03eaa6ba00,
-			0x276a9a4302d46600,
-			0x276ea840d6893000,
-			0x2772b5fd5f0e5a00,
-			0x2776c37895ad9000,
-			0x277ad0b273b0e400,
-			0x277eddaaf262e000,
-			0x2782ea620b0e7200,
-			0x2786f6d7b6fef400,
-			0x278b030bef803200,
-			0x278f0efeadde5e00,
-			0x27931aafeb661c00,
-			0x2797261fa1647800,
-			0x279b314dc926ee00,
-			0x279f3c3a5bfb6400,
-			0x27a346e553302e00,
-			0x27a7514ea8140a00,
-			0x27ab5b7653f62600,
-			0x27af655c50261e00,
-			0x27b36f0095f3f600,
-			0x27b778631eb02000,
-			0x27bb8183e3ab7e00,
-			0x27bf8a62de375e00,
-			0x27c3930007a57a00,
-			0x27c79b5b5947f200,
-			0x27cba374cc716200,
-			0x27cfab4c5a74c800,
-			0x27d3b2e1fca59000,
-			0x27d7ba35ac579800,
-			0x27dbc14762df2800,
-			0x27dfc8171990f200,
-			0x27e3cea4c9c22000,
-			0x27e7d4f06cc83800,
-			0x27ebdaf9fbf94400,
-			0x27efe0c170aba600,
-			0x27f3e646c4363a00,
-			0x27f7eb89eff04200,
-			0x27fbf08aed317800,
-			0x27fff549b551f800,
-			0x2803f9c641aa5200,
-			0x2807fe008b938600,
-			0x280c01f88c66f800,
-			0x281005ae3d7e8400,
-			0x2814092198346c00,
-			0x28180c5295e36800,
-			0x281c0f412fe69800,
-			0x282011ed5f998800,
-			0x282414571e583800,
-			0x2828167e657f1600,
-			0x282c18632e6af800,
-			0x28301a0572792600,
-			0x28341b652b075600,
-			0x28381c825173aa00,
-			0x283c1d5cdf1cb600,
-			0x28401df4cd617c00,
-			0x28441e4a15a16600,
-			0x28481e5cb13c5600,
-			0x284c1e2c99929200,
-			0x28501db9c804da00,
-			0x28541d0435f45200,
-			0x28581c0bdcc29000,
-			0x285c1ad0b5d1a000,
-			0x28601952ba83ee00,
-			0x28641791e43c6000,
-			0x2868158e2c5e4a00,
-			0x286c13478c4d6a00,
-			0x287010bdfd6dea00,
-			0x28740df179247200,
-			0x28780ae1f8d60600,
-			0x287c078f75e82600,
-			0x288003f9e9c0bc00,
-			0x288400214dc61e00,
-			0x2887fc059b5f1c00,
-			0x288bf7a6cbf2e600,
-			0x288ff304d8e92400,
-			0x2893ee1fbba9f200,
-			0x2897e8f76d9dd000,
-			0x289be38be82db200,
-			0x289fdddd24c2fc00,
-			0x28a3d7eb1cc78400,
-			0x28a7d1b5c9a58c00,
-			0x28abcb3d24c7c200,
-			0x28afc48127994a00,
-			0x28b3bd81cb85b800,
-			0x28b7b63f09f90800,
-			0x28bbaeb8dc5faa00,
-			0x28bfa6ef3c267e00,
-			0x28c39ee222bad600,
-			0x28c79691898a6e00,
-			0x28cb8dfd6a037600,
-			0x28cf8525bd948e00,
-			0x28d37c0a7dacc400,
-			0x28d772aba3bb9600,
-			0x28db69092930ee00,
-			0x28df5f23077d3200,
-			0x28e354f938112c00,
-			0x28e74a8bb45e1c00,
-			0x28eb3fda75d5ae00,
-			0x28ef34e575ea0400,
-			0x28f329acae0da800,
-			0x28f71e3017b3a000,
-			0x28fb126fac4f5400,
-			0x28ff066b6554aa00,
-			0x2902fa233c37f000,
-			0x2906ed972a6de400,
-			0x290ae0c7296bb800,
-			0x290ed3b332a71000,
-			0x2912c65b3f95fa00,
-			0x2916b8bf49aefc00,
-			0x291aaadf4a690800,
-			0x291e9cbb3b3b8000,
-			0x29228e53159e3a00,
-			0x29267fa6d3097a00,
-			0x292a70b66cf5fa00,
-			0x292e6181dcdcdc00,
-			0x293252091c37ba00,
-			0x2936424c24809c00,
-			0x293a324aef31fc00,
-			0x293e220575c6c400,
-			0x2942117bb1ba5000,
-			0x294600ad9c886c00,
-			0x2949ef9b2fad5800,
-			0x294dde4464a5c000,
-			0x2951cca934eec600,
-			0x2955bac99a05fa00,
-			0x2959a8a58d696000,
-			0x295d963d08976c00,
-			0x29618390050f0200,
-			0x2965709e7c4f7a00,
-			0x29695d6867d89c00,
-			0x296d49edc12aa400,
-			0x2971362e81c63a00,
-			0x2975222aa32c7c00,
-			0x29790de21edef800,
-			0x297cf954ee5fb000,
-			0x2980e4830b311400,
-			0x2984cf6c6ed60a00,
-			0x2988ba1112d1e400,
-			0x298ca470f0a86e00,
-			0x29908e8c01dddc00,
-			0x299478623ff6dc00,
-			0x299861f3a4788c00,
-			0x299c4b4028e87a00,
-			0x29a03447c6cca400,
-			0x29a41d0a77ab8200,
-			0x29a80588350bf600,
-			0x29abedc0f8755c00,
-			0x29afd5b4bb6f7800,
-			0x29b3bd6377828a00,
-			0x29b7a4cd26374000,
-			0x29bb8bf1c116b800,
-			0x29bf72d141aa8600,
-			0x29c3596ba17cb200,
-			0x29c73fc0da17b000,
-			0x29cb25d0e5066e00,
-			0x29cf0b9bbbd44600,
-			0x29d2f121580d0800,
-			0x29d6d661b33cfa00,
-			0x29dabb5cc6f0ca00,
-			0x29dea0128cb5a600,
-			0x29e28482fe192600,
-			0x29e668ae14a95800,
-			0x29ea4c93c9f4b600,
-			0x29ee3034178a3c00,
-			0x29f2138ef6f94a00,
-			0x29f5f6a461d1ba00,
-			0x29f9d97451a3d800,
-			0x29fdbbfec0006200,
-			0x2a019e43a6788c00,
-			0x2a058042fe9dfa00,
-			0x2a0961fcc202c000,
-			0x2a0d4370ea397000,
-			0x2a11249f70d50600,
-			0x2a1505884f68f400,
-			0x2a18e62b7f891c00,
-			0x2a1cc688fac9de00,
-			0x2a20a6a0bac00000,
-			0x2a248672b900c200,
-			0x2a2865feef21da00,
-			0x2a2c454556b96e00,
-			0x2a302445e95e1600,
-			0x2a340300a0a6e000,
-			0x2a37e175762b5000,
-			0x2a3bbfa463835c00,
-			0x2a3f9d8d62476800,
-			0x2a437b306c105400,
-			0x2a47588d7a777000,
-			0x2a4b35a487168200,
-			0x2a4f12758b87c000,
-			0x2a52ef008165d800,
-			0x2a56cb45624bea00,
-			0x2a5aa74427d58c00,
-			0x2a5e82fccb9ec200,
-			0x2a625e6f47440c00,
-			0x2a66399b94625c00,
-			0x2a6a1481ac971400,
-			0x2a6def2189801000,
-			0x2a71c97b24bb9c00,
-			0x2a75a38e77e87800,
-			0x2a797d5b7ca5de00,
-			0x2a7d56e22c937600,
-			0x2a81302281516000,
-			0x2a85091c74803200,
-			0x2a88e1cfffc0f000,
-			0x2a8cba3d1cb51a00,
-			0x2a909263c4fea000,
-			0x2a946a43f23fe600,
-			0x2a9841dd9e1bcc00,
-			0x2a9c1930c2359c00,
-			0x2a9ff03d58311e00,
-			0x2aa3c70359b28a00,
-			0x2aa79d82c05e8e00,
-			0x2aab73bb85da4c00,
-			0x2aaf49ada3cb5e00,
-			0x2ab31f5913d7ce00,
-			0x2ab6f4bdcfa62000,
-			0x2abac9dbd0dd4a00,
-			0x2abe9eb31124b800,
-			0x2ac273438a244c00,
-			0x2ac6478d35845c00,
-			0x2aca1b900cedb200,
-			0x2acdef4c0a099400,
-			0x2ad1c2c12681b200,
-			0x2ad595ef5c003c00,
-			0x2ad968d6a42fd000,
-			0x2add3b76f8bb8800,
-			0x2ae10dd0534eee00,
-			0x2ae4dfe2ad960000,
-			0x2ae8b1ae013d3c00,
-			0x2aec833247f18a00,
-			0x2af0546f7b604e00,
-			0x2af4256595375e00,
-			0x2af7f6148f250a00,
-			0x2afbc67c62d81400,
-			0x2aff969d09ffb800,
-			0x2b0366767e4ba200,
-			0x2b073608b96bf800,
-			0x2b0b0553b5115600,
-			0x2b0ed4576aeccc00,
-			0x2b12a313d4afde00,
-			0x2b167188ec0c9000,
-			0x2b1a3fb6aab55200,
-			0x2b1e0d9d0a5d0a00,
-			0x2b21db3c04b71a00,
-			0x2b25a89393775800,
-			0x2b2975a3b0521200,
-			0x2b2d426c54fc0600,
-			0x2b310eed7b2a6e00,
-			0x2b34db271c92fc00,
-			0x2b38a71932ebd200,
-			0x2b3c72c3b7eb8a00,
-			0x2b403e26a5493c00,
-			0x2b440941f4bc6e00,
-			0x2b47d4159ffd1e00,
-			0x2b4b9ea1a0c3c400,
-			0x2b4f68e5f0c94c00,
-			0x2b5332e289c71a00,
-			0x2b56fc9765770a00,
-			0x2b5ac6047d936800,
-			0x2b5e8f29cbd70200,
-			0x2b62580749fd1400,
-			0x2b66209cf1c15200,
-			0x2b69e8eabcdfe800,
-			0x2b6db0f0a5158000,
-			0x2b7178aea41f2c00,
-			0x2b754024b3ba8600,
-			0x2b790752cda58e00,
-			0x2b7cce38eb9ecc00,
-			0x2b8094d707653400,
-			0x2b845b2d1ab83200,
-			0x2b88213b1f57b000,
-			0x2b8be7010f040a00,
-			0x2b8fac7ee37e1000,
-			0x2b9371b496871200,
-			0x2b9736a221e0d400,
-			0x2b9afb477f4d8c00,
-			0x2b9ebfa4a88ff200,
-			0x2ba283b9976b2800,
-			0x2ba6478645a2d800,
-			0x2baa0b0aacfb1800,
-			0x2badce46c7387400,
-			0x2bb1913a8e1ffa00,
-			0x2bb553e5fb772800,
-			0x2bb916490903f600,
-			0x2bbcd863b08cd400,
-			0x2bc09a35ebd8a800,
-			0x2bc45bbfb4aed400,
-			0x2bc81d0104d73000,
-			0x2bcbddf9d61a0800,
-			0x2bcf9eaa22402600,
-			0x2bd35f11e312ca00,
-			0x2bd71f31125baa00,
-			0x2bdadf07a9e4f800,
-			0x2bde9e95a3795c00,
-			0x2be25ddaf8e3f400,
-			0x2be61cd7a3f05c00,
-			0x2be9db8b9e6aa000,
-			0x2bed99f6e21f4e00,
-			0x2bf1581968db6800,
-			0x2bf515f32c6c6400,
-			0x2bf8d38426a03800,
-			0x2bfc90cc51455000,
-			0x2c004dcba62a8c00,
-			0x2c040a821f1f4c00,
-			0x2c07c6efb5f36400,
-			0x2c0b831464771e00,
-			0x2c0f3ef0247b4600,
-			0x2c12fa82efd11a00,
-			0x2c16b5ccc04a4e00,
-			0x2c1a70cd8fb91800,
-			0x2c1e2b8557f01c00,
-			0x2c21e5f412c28400,
-			0x2c25a019ba03e600,
-			0x2c2959f647885600,
-			0x2c2d1389b5246800,
-			0x2c30ccd3fcad1a00,
-			0x2c3485d517f7f400,
-			0x2c383e8d00daea00,
-			0x2c3bf6fbb12c7000,
-			0x2c3faf2122c37000,
-			0x2c4366fd4f775000,
-			0x2c471e90311fee00,
-			0x2c4ad5d9c195a400,
-			0x2c4e8cd9fab13e00,
-			0x2c524390d64c0800,
-			0x2c55f9fe4e3fc600,
-			0x2c59b0225c66b800,
-			0x2c5d65fcfa9b8e00,
-			0x2c611b8e22b98000,
-			0x2c64d0d5ce9c3400,
-			0x2c6885d3f81fce00,
-			0x2c6c3a889920ec00,
-			0x2c6feef3ab7ca800,
-			0x2c73a31529108c00,
-			0x2c7756ed0bbaaa00,
-			0x2c7b0a7b4d598200,
-			0x2c7ebdbfe7cc1600,
-			0x2c8270bad4f1de00,
-			0x2c86236c0eaaca00,
-			0x2c89d5d38ed74a00,
-			0x2c8d87f14f584400,
-			0x2c9139c54a0f1400,
-			0x2c94eb4f78dd9c00,
-			0x2c989c8fd5a63000,
-			0x2c9c4d865a4b9a00,
-			0x2c9ffe3300b12a00,
-			0x2ca3ae95c2baa000,
-			0x2ca75eae9a4c3e00,
-			0x2cab0e7d814aba00,
-			0x2caebe02719b4600,
-			0x2cb26d3d65239400,
-			0x2cb61c2e55c9c800,
-			0x2cb9cad53d748800,
-			0x2cbd7932160af000,
-			0x2cc12744d9749600,
-			0x2cc4d50d81998e00,
-			0x2cc8828c08626800,
-			0x2ccc2fc067b82a00,
-			0x2ccfdcaa99845400,
-			0x2cd3894a97b0ea00,
-			0x2cd735a05c286000,
-			0x2cdae1abe0d5a800,
-			0x2cde8d6d1fa43600,
-			0x2ce238e4127ff000,
-			0x2ce5e410b3553a00,
-			0x2ce98ef2fc10f400,
-			0x2ced398ae6a07a00,
-			0x2cf0e3d86cf1a000,
-			0x2cf48ddb88f2b800,
-			0x2cf8379434928e00,
-			0x2cfbe10269c06800,
-			0x2cff8a26226c0a00,
-			0x2d0332ff5885b400,
-			0x2d06db8e05fe1a00,
-			0x2d0a83d224c67600,
-			0x2d0e2bcbaed07800,
-			0x2d11d37a9e0e4800,
-			0x2d157adeec728e00,
-			0x2d1921f893f07200,
-			0x2d1cc8c78e7b8c00,
-			0x2d206f4bd607fc00,
-			0x2d241585648a5200,
-			0x2d27bb7433f7a400,
-			0x2d2b61183e457e00,
-			0x2d2f06717d69e800,
-			0x2d32ab7feb5b6600,
-			0x2d3650438210fe00,
-			0x2d39f4bc3b822a00,
-			0x2d3d98ea11a6e000,
-			0x2d413cccfe779a00,
-			0x2d44e064fbed4200,
-			0x2d4883b204014c00,
-			0x2d4c26b410ad9e00,
-			0x2d4fc96b1bec9a00,
-			0x2d536bd71fb92800,
-			0x2d570df8160ea200,
-			0x2d5aafcdf8e8de00,
-			0x2d5e5158c2443a00,
-			0x2d61f2986c1d8400,
-			0x2d65938cf0720a00,
-			0x2d693436493f9a00,
-			0x2d6cd49470847a00,
-			0x2d7074a7603f7000,
-			0x2d74146f126fbc00,
-			0x2d77b3eb81151a00,
-			0x2d7b531ca62fc800,
-			0x2d7ef2027bc07a00,
-			0x2d82909cfbc86400,
-			0x2d862eec20493400,
-			0x2d89ccefe3451c00,
-			0x2d8d6aa83ebec200,
-			0x2d9108152cb94c00,
-			0x2d94a536a7386000,
-			0x2d98420ca8402000,
-			0x2d9bde9729d52600,
-			0x2d9f7ad625fc8a00,
-			0x2da316c996bbec00,
-			0x2da6b27176195a00,
-			0x2daa4dcdbe1b6800,
-			0x2dade8de68c92400,
-			0x2db183a3702a1c00,
-			0x2db51e1cce465600,
-			0x2db8b84a7d265c00,
-			0x2dbc522c76d33000,
-			0x2dbfebc2b5565600,
-			0x2dc3850d32b9c800,
-			0x2dc71e0be9080600,
-			0x2dcab6bed24c0a00,
-			0x2dce4f25e8914a00,
-			0x2dd1e74125e3b800,
-			0x2dd57f10844fca00,
-			0x2dd91693fde27200,
-			0x2ddcadcb8ca91600,
-			0x2de044b72ab1a800,
-			0x2de3db56d20a8e00,
-			0x2de771aa7cc2b000,
-			0x2deb07b224e97400,
-			0x2dee9d6dc48eb800,
-			0x2df232dd55c2e000,
-			0x2df5c800d296cc00,
-			0x2df95cd8351bd400,
-			0x2dfcf1637763d600,
-			0x2e0085a293812800,
-			0x2e0419958386a000,
-			0x2e07ad3c41879600,
-			0x2e0b4096c797da00,
-			0x2e0ed3a50fcbbe00,
-			0x2e12666714381400,
-			0x2e15f8dccef22200,
-			0x2e198b063a0fbc00,
-			0x2e1d1ce34fa72600,
-			0x2e20ae7409cf2c00,
-			0x2e243fb8629f1600,
-			0x2e27d0b0542ea600,
-			0x2e2b615bd8962200,
-			0x2e2ef1bae9ee5000,
-			0x2e3281cd82506a00,
-			0x2e3611939bd63400,
-			0x2e39a10d3099ec00,
-			0x2e3d303a3ab65000,
-			0x2e40bf1ab4469c00,
-			0x2e444dae97668800,
-			0x2e47dbf5de325000,
-			0x2e4b69f082c6ac00,
-			0x2e4ef79e7f40d400,
-			0x2e5284ffcdbe7800,
-			0x2e561214685dd800,
-			0x2e599edc493d9e00,
-			0x2e5d2b576a7d0600,
-			0x2e60b785c63bba00,
-			0x2e6443675699f200,
-			0x2e67cefc15b85c00,
-			0x2e6b5a43fdb82600,
-			0x2e6ee53f08bb0000,
-			0x2e726fed30e31c00,
-			0x2e75fa4e70532400,
-			0x2e798462c12e4400,
-			0x2e7d0e2a1d982a00,
-			0x2e8097a47fb50200,
-			0x2e8420d1e1a97600,
-			0x2e87a9b23d9ab400,
-			0x2e8b32458dae6000,
-			0x2e8eba8bcc0aac00,
-			0x2e924284f2d63c00,
-			0x2e95ca30fc383800,
-			0x2e99518fe2584c00,
-			0x2e9cd8a19f5ea200,
-			0x2ea05f662d73dc00,
-			0x2ea3e5dd86c12800,
-			0x2ea76c07a5702a00,
-			0x2eaaf1e483ab0e00,
-			0x2eae77741b9c7a00,
-			0x2eb1fcb6676f9200,
-			0x2eb581ab61500200,
-			0x2eb906530369f200,
-			0x2ebc8aad47ea0800,
-			0x2ec00eba28fd6a00,
-			0x2ec39279a0d1c200,
-			0x2ec715eba9953c00,
-			0x2eca99103d767a00,
-			0x2ece1be756a4a800,
-			0x2ed19e70ef4f7000,
-			0x2ed520ad01a6f600,
-			0x2ed8a29b87dbea00,
-			0x2edc243c7c1f7400,
-			0x2edfa58fd8a33e00,
-			0x2ee3269597997200,
-			0x2ee6a74db334ba00,
-			0x2eea27b825a84800,
-			0x2eeda7d4e927c600,
-			0x2ef127a3f7e75e00,
-			0x2ef4a7254c1bc200,
-			0x2ef82658dffa2000,
-			0x2efba53eadb82400,
-			0x2eff23d6af8c0400,
-			0x2f02a220dfac6c00,
-			0x2f06201d38509000,
-			0x2f099dcbb3b02400,
-			0x2f0d1b2c4c035800,
-			0x2f10983efb82e400,
-			0x2f141503bc67fe00,
-			0x2f17917a88ec5a00,
-			0x2f1b0da35b4a3200,
-			0x2f1e897e2dbc3e00,
-			0x2f22050afa7db600,
-			0x2f258049bbca5a00,
-			0x2f28fb3a6bde6200,
-			0x2f2c75dd04f69000,
-			0x2f2ff03181502000,
-			0x2f336a37db28d200,
-			0x2f36e3f00cbeec00,
-			0x2f3a5d5a10512a00,
-			0x2f3dd675e01eda00,
-			0x2f414f437667ba00,
-			0x2f44c7c2cd6c1400,
-			0x2f483ff3df6cb200,
-			0x2f4bb7d6a6aae200,
-			0x2f4f2f6b1d686c00,
-			0x2f52a6b13de79e00,
-			0x2f561da9026b4a00,
-			0x2f5994526536c000,
-			0x2f5d0aad608dd600,
-			0x2f6080b9eeb4e000,
-			0x2f63f67809f0b400,
-			0x2f676be7ac86ae00,
-			0x2f6ae108d0bca400,
-			0x2f6e55db70d8f400,
-			0x2f71ca5f87228400,
-			0x2f753e950de0ae00,
-			0x2f78b27bff5b5400,
-			0x2f7c261455dae000,
-			0x2f7f995e0ba83400,
-			0x2f830c591b0cc000,
-			0x2f867f057e526c00,
-			0x2f89f1632fc3a600,
-			0x2f8d637229ab6000,
-			0x2f90d53266550c00,
-			0x2f9446a3e00c9a00,
-			0x2f97b7c6911e8800,
-			0x2f9b289a73d7d200,
-			0x2f9e991f8285ee00,
-			0x2fa20955b776dc00,
-			0x2fa5793d0cf91e00,
-			0x2fa8e8d57d5bbc00,
-			0x2fac581f02ee3800,
-			0x2fafc71998009e00,
-			0x2fb335c536e37a00,
-			0x2fb6a421d9e7da00,
-			0x2fba122f7b5f4e00,
-			0x2fbd7fee159bee00,
-			0x2fc0ed5da2f05000,
-			0x2fc45a7e1daf8e00,
-			0x2fc7c74f802d4400,
-			0x2fcb33d1c4bd9400,
-			0x2fcea004e5b52000,
-			0x2fd20be8dd691000,
-			0x2fd5777da62f0c00,
-			0x2fd8e2c33a5d4000,
-			0x2fdc4db9944a5c00,
-			0x2fdfb860ae4d9000,
-			0x2fe322b882be9800,
-			0x2fe68cc10bf5a800,
-			0x2fe9f67a444b8200,
-			0x2fed5fe426196000,
-			0x2ff0c8feabb90400,
-			0x2ff431c9cf84ba00,
-			0x2ff79a458bd74c00,
-			0x2ffb0271db0c0600,
-			0x2ffe6a4eb77eb800,
-			0x3001d1dc1b8bb800,
-			0x3005391a018fda00,
-			0x3008a00863e88200,
-			0x300c06a73cf38800,
-			0x300f6cf6870f5400,
-			0x3012d2f63c9acc00,
-			0x301638a657f55800,
-			0x30199e06d37ee800,
-			0x301d0317a997f000,
-			0x302067d8d4a16400,
-			0x3023cc4a4efcc000,
-			0x3027306c130c0200,
-			0x302a943e1b31aa00,
-			0x302df7c061d0c000,
-			0x30315af2e14cce00,
-			0x3034bdd59409e200,
-			0x30382068746c9000,
-			0x303b82ab7cd9ec00,
-			0x303ee49ea7b79000,
-			0x30424641ef6ba000,
-			0x3045a7954e5cbc00,
-			0x30490898bef20c00,
-			0x304c694c3b933c00,
-			0x304fc9afbea87c00,
-			0x305329c3429a8200,
-			0x30568986c1d28800,
-			0x3059e8fa36ba4800,
-			0x305d481d9bbc0800,
-			0x3060a6f0eb428c00,
-			0x306405741fb92400,
-			0x306763a7338b9c00,
-			0x306ac18a21264c00,
-			0x306e1f1ce2f60a00,
-			0x30717c5f73683600,
-			0x3074d951cceab200,
-			0x307835f3e9ebea00,
-			0x307b9245c4dac600,
-			0x307eee475826ba00,
-			0x308249f89e3fbc00,
-			0x3085a55991964600,
-			0x3089006a2c9b5e00,
-			0x308c5b2a69c08200,
-			0x308fb59a4377c200,
-			0x30930fb9b433ae00,
-			0x30966988b6675800,
-			0x3099c30744865800,
-			0x309d1c355904d400,
-			0x30a07512ee576e00,
-			0x30a3cd9ffef34e00,
-			0x30a725dc854e2400,
-			0x30aa7dc87bde2400,
-			0x30add563dd1a0c00,
-			0x30b12caea3791600,
-			0x30b483a8c9730a00,
-			0x30b7da5249803200,
-			0x30bb30ab1e195c00,
-			0x30be86b341b7de00,
-			0x30c1dc6aaed59400,
-			0x30c531d15fece200,
-			0x30c886e74f78aa00,
-			0x30cbdbac77f45800,
-			0x30cf3020d3dbde00,
-			0x30d284445dabb800,
-			0x30d5d8170fe0e000,
-			0x30d92b98e4f8d800,
-			0x30dc7ec9d771ac00,
-			0x30dfd1a9e1c9ec00,
-			0x30e32438fe80a800,
-			0x30e6767728158200,
-			0x30e9c86459089600,
-			0x30ed1a008bda9000,
-			0x30f06b4bbb0c9800,
-			0x30f3bc45e1206400,
-			0x30f70ceef8982e00,
-			0x30fa5d46fbf6b800,
-			0x30fdad4de5bf4600,
-			0x3100fd03b075a400,
-			0x31044c68569e2600,
-			0x31079b7bd2bda400,
-			0x310aea3e1f597e00,
-			0x310e38af36f79c00,
-			0x311186cf141e6800,
-			0x3114d49db154d600,
-			0x3118221b09225e00,
-			0x311b6f47160f0200,
-			0x311ebc21d2a34800,
-			0x312208ab39684000,
-			0x312554e344e77a00,
-			0x3128a0c9efab1200,
-			0x312bec5f343da800,
-			0x312f37a30d2a6800,
-			0x3132829574fcfe00,
-			0x3135cd366641a200,
-			0x31391785db851200,
-			0x313c6183cf548c00,
-			0x313fab303c3dde00,
-			0x3142f48b1ccf5c00,
-			0x31463d946b97de00,
-			0x3149864c2326c200,
-			0x314cceb23e0bf000,
-			0x315016c6b6d7d200,
-			0x31535e89881b6400,
-			0x3156a5faac682000,
-			0x3159ed1a1e500800,
-			0x315d33e7d865a800,
-			0x31607a63d53c1000,
-			0x3163c08e0f66e000,
-			0x31670666817a3200,
-			0x316a4bed260ab200,
-			0x316d9121f7ad9000,
-			0x3170d604f0f88200,
-			0x31741a960c81c600,
-			0x31775ed544e02400,
-			0x317aa2c294aaec00,
-			0x317de65df679f000,
-			0x318129a764e58e00,
-			0x31846c9eda86ac00,
-			0x3187af4451f6b800,
-			0x318af197c5cfa400,
-			0x318e339930abee00,
-			0x319175488d269a00,
-			0x3194b6a5d5db3200,
-			0x3197f7b10565cc00,
-			0x319b386a16630400,
-			0x319e78d1036ffe00,
-			0x31a1b8e5c72a6400,
-			0x31a4f8a85c306c00,
-			0x31a83818bd20d000,
-			0x31ab7736e49ad400,
-			0x31aeb602cd3e4600,
-			0x31b1f47c71ab7c00,
-			0x31b532a3cc835000,
-			0x31b87078d8672600,
-			0x31bbadfb8ff8ec00,
-			0x31beeb2beddb1a00,
-			0x31c22809ecb0ac00,
-			0x31c56495871d2800,
-			0x31c8a0ceb7c49e00,
-			0x31cbdcb5794ba400,
-			0x31cf1849c6575800,
-			0x31d2538b998d6600,
-			0x31d58e7aed93fc00,
-			0x31d8c917bd11d600,
-			0x31dc036202ae3200,
-			0x31df3d59b910de00,
-			0x31e276fedae22c00,
-			0x31e5b05162cafa00,
-			0x31e8e9514b74ac00,
-			0x31ec21fe8f892e00,
-			0x31ef5a5929b2f800,
-			0x31f29261149d0800,
-			0x31f5ca164af2ea00,
-			0x31f90178c760aa00,
-			0x31fc38888492e800,
-			0x31ff6f457d36c400,
-			0x3202a5afabf9e800,
-			0x3205dbc70b8a9000,
-			0x3209118b96977600,
-			0x320c46fd47cfe200,
-			0x320f7c1c19e3a600,
-			0x3212b0e807831a00,
-			0x3215e5610b5f2200,
-			0x3219198720293000,
-			0x321c4d5a40933400,
-			0x321f80da674fac00,
-			0x3222b4078f11a800,
-			0x3225e6e1b28cb200,
-			0x32291968cc74ec00,
-			0x322c4b9cd77ef800,
-			0x322f7d7dce600600,
-			0x3232af0babcdce00,
-			0x3235e0466a7e9000,
-			0x3239112e05291600,
-			0x323c41c27684be00,
-			0x323f7203b9495e00,
-			0x3242a1f1c82f6200,
-			0x3245d18c9defbc00,
-			0x324900d43543e600,
-			0x324c2fc888e5ea00,
-			0x324f5e6993905400,
-			0x32528cb74ffe4200,
-			0x3255bab1b8eb5400,
-			0x3258e858c913b800,
-			0x325c15ac7b342600,
-			0x325f42acca09e400,
-			0x32626f59b052b800,
-			0x32659bb328ccfa00,
-			0x3268c7b92e378c00,
-			0x326bf36bbb51d200,
-			0x326f1ecacadbca00,
-			0x327249d65795ec00,
-			0x3275748e5c414200,
-			0x32789ef2d39f6000,
-			0x327bc903b8726400,
-			0x327ef2c1057cf400,
-			0x32821c2ab5824600,
-			0x32854540c3461400,
-			0x32886e03298ca800,
-			0x328b9671e31ad200,
-			0x328ebe8ceab5ec00,
-			0x3291e6543b23e200,
-			0x32950dc7cf2b2400,
-			0x329834e7a192ae00,
-			0x329b5bb3ad220600,
-			0x329e822beca14000,
-			0x32a1a8505ad8f400,
-			0x32a4ce20f2924e00,
-			0x32a7f39dae96fe00,
-			0x32ab18c689b14200,
-			0x32ae3d9b7eabe200,
-			0x32b1621c88522e00,
-			0x32b48649a1700600,
-			0x32b7aa22c4d1d400,
-			0x32bacda7ed448a00,
-			0x32bdf0d91595a600,
-			0x32c113b638933600,
-			0x32c4363f510bc600,
-			0x32c7587459ce8000,
-			0x32ca7a554dab0a00,
-			0x32cd9be227719e00,
-			0x32d0bd1ae1f2fc00,
-			0x32d3ddff78006e00,
-			0x32d6fe8fe46bd000,
-			0x32da1ecc22078800,
-			0x32dd3eb42ba68200,
-			0x32e05e47fc1c3800,
-			0x32e37d878e3cb200,
-			0x32e69c72dcdc8000,
-			0x32e9bb09e2d0c200,
-			0x32ecd94c9aef1c00,
-			0x32eff73b000dc800,
-			0x32f314d50d038200,
-			0x32f6321abca79600,
-			0x32f94f0c09d1dc00,
-			0x32fc6ba8ef5ab800,
-			0x32ff87f1681b1800,
-			0x3302a3e56eec7400,
-			0x3305bf84fea8d600,
-			0x3308dad0122ace00,
-			0x330bf5c6a44d7c00,
-			0x330f1068afec8800,
-			0x33122ab62fe42a00,
-			0x331544af1f112400,
-			0x33185e537850c000,
-			0x331b77a33680de00,
-			0x331e909e547fe000,
-			0x3321a944cd2cbc00,
-			0x3324c1969b66ee00,
-			0x3327d993ba0e7e00,
-			0x332af13c24040600,
-			0x332e088fd428ac00,
-			0x33311f8ec55e1e00,
-			0x33343638f2869200,
-			0x33374c8e5684d800,
-			0x333a628eec3c3e00,
-			0x333d783aae90aa00,
-			0x33408d9198668800,
-			0x3343a293a4a2d000,
-			0x3346b740ce2b0c00,
-			0x3349cb990fe54c00,
-			0x334cdf9c64b82e00,
-			0x334ff34ac78ae200,
-			0x335306a433452200,
-			0x335619a8a2cf2e00,
-			0x33592c581111de00,
-			0x335c3eb278f68c00,
-			0x335f50b7d5672800,
-			0x33626268214e2800,
-			0x336573c357969200,
-			0x336884c9732bfa00,
-			0x336b957a6efa7e00,
-			0x336ea5d645eeca00,
-			0x3371b5dcf2f61600,
-			0x3374c58e70fe2c00,
-			0x3377d4eabaf55e00,
-			0x337ae3f1cbca8a00,
-			0x337df2a39e6d1e00,
-			0x338101002dcd1800,
-			0x33840f0774dafe00,
-			0x33871cb96e87e200,
-			0x338a2a1615c56c00,
-			0x338d371d6585c800,
-			0x339043cf58bbb000,
-			0x3393502bea5a7400,
-			0x33965c331555ea00,
-			0x339967e4d4a27800,
-			0x339c734123350c00,
-			0x339f7e47fc032800,
-			0x33a288f95a02dc00,
-			0x33a59355382ac200,
-			0x33a89d5b91720000,
-			0x33aba70c60d05000,
-			0x33aeb067a13df400,
-			0x33b1b96d4db3ba00,
-			0x33b4c21d612b0800,
-			0x33b7ca77d69dc600,
-			0x33bad27ca9067200,
-			0x33bdda2bd3601000,
-			0x33c0e18550a63a00,
-			0x33c3e8891bd51400,
-			0x33c6ef372fe95000,
-			0x33c9f58f87e02c00,
-			0x33ccfb921eb77800,
-			0x33d0013eef6d9000,
-			0x33d30695f5015a00,
-			0x33d60b972a725400,
-			0x33d910428ac08200,
-			0x33dc149810ec7800,
-			0x33df1897b7f75800,
-			0x33e21c417ae2d200,
-			0x33e51f9554b12600,
-			0x33e8229340652200,
-			0x33eb253b39022200,
-			0x33ee278d398c0c00,
-			0x33f129893d075a00,
-			0x33f42b2f3e791200,
-			0x33f72c7f38e6cc00,
-			0x33fa2d792756a800,
-			0x33fd2e1d04cf5a00,
-			0x34002e6acc582000,
-			0x34032e6278f8ca00,
-			0x34062e0405b9b400,
-			0x34092d4f6da3ce00,
-			0x340c2c44abc09000,
-			0x340f2ae3bb1a0200,
-			0x3412292c96babe00,
-			0x3415271f39ade800,
-			0x341824bb9eff3c00,
-			0x341b2201c1bafa00,
-			0x341e1ef19cedf400,
-			0x34211b8b2ba58e00,
-			0x342417ce68efb800,
-			0x342713bb4fdaf400,
-			0x342a0f51db764e00,
-			0x342d0a9206d16600,
-			0x3430057bccfc6a00,
-			0x3433000f29081200,
-			0x3435fa4c1605a800,
-			0x3438f4328f070e00,
-			0x343bedc28f1ea800,
-			0x343ee6fc115f6e00,
-			0x3441dfdf10dcea00,
-			0x3444d86b88ab2e00,
-			0x3447d0a173dee800,
-			0x344ac880cd8d4800,
-			0x344dc00990cc1600,
-			0x3450b73bb8b1a400,
-			0x3453ae174054d400,
-			0x3456a49c22cd1c00,
-			0x34599aca5b328000,
-			0x345c90a1e49d9000,
-			0x345f8622ba276e00,
-			0x34627b4cd6e9ca00,
-			0x3465702035fee400,
-			0x3468649cd2819200,
-			0x346b58c2a78d2e00,
-			0x346e4c91b03daa00,
-			0x34714009e7af8600,
-			0x3474332b48ffd000,
-			0x347725f5cf4c2800,
-			0x347a186975b2bc00,
-			0x347d0a8637524e00,
-			0x347ffc4c0f4a2800,
-			0x3482edbaf8ba2a00,
-			0x3485ded2eec2c200,
-			0x3488cf93ec84f200,
-			0x348bbffded224600,
-			0x348eb010ebbcda00,
-			0x34919fcce3776000,
-			0x34948f31cf751600,
-			0x34977e3faad9c600,
-			0x349a6cf670c9d800,
-			0x349d5b561c6a3400,
-			0x34a0495ea8e05e00,
-			0x34a3371011526000,
-			0x34a6246a50e6de00,
-			0x34a9116d62c50a00,
-			0x34abfe194214a000,
-			0x34aeea6de9fdf400,
-			0x34b1d66b55a9e800,
-			0x34b4c2118041ea00,
-			0x34b7ad6064effe00,
-			0x34ba9857fedeba00,
-			0x34bd82f849393c00,
-			0x34c06d413f2b3e00,
-			0x34c35732dbe10000,
-			0x34c640cd1a875800,
-			0x34c92a0ff64bac00,
-			0x34cc12fb6a5bf600,
-			0x34cefb8f71e6ba00,
-			0x34d1e3cc081b0e00,
-			0x34d4cbb12828a000,
-			0x34d7b33ecd3fa200,
-			0x34da9a74f290e800,
-			0x34dd8153934dc800,
-			0x34e067daaaa83000,
-			0x34e34e0a33d29c00,
-			0x34e633e22a001800,
-			0x34e9196288644800,
-			0x34ebfe8b4a335c00,
-			0x34eee35c6aa21200,
-			0x34f1c7d5e4e5be00,
-			0x34f4abf7b4344400,
-			0x34f78fc1d3c41800,
-			0x34fa73343ecc4200,
-			0x34fd564ef0845600,
-			0x35003911e4248000,
-			0x35031b7d14e57600,
-			0x3505fd907e008400,
-			0x3508df4c1aaf8a00,
-			0x350bc0afe62cf200,
-			0x350ea1bbdbb3bc00,
-			0x3511826ff67f7a00,
-			0x351462cc31cc4c00,
-			0x351742d088d6e600,
-			0x351a227cf6dc9000,
-			0x351d01d1771b1e00,
-			0x351fe0ce04d0f800,
-			0x3522bf729b3d1a00,
-			0x35259dbf359f0c00,
-			0x35287bb3cf36ee00,
-			0x352b595063457000,
-			0x352e3694ed0bd200,
-			0x3531138167cbe600,
-			0x3533f015cec81000,
-			0x3536cc521d434400,
-			0x3539a8364e811000,
-			0x353c83c25dc58a00,
-			0x353f5ef646555e00,
-			0x354239d20375ca00,
-			0x35451455906c9e00,
-			0x3547ee80e8803e00,
-			0x354ac85406f79a00,
-			0x354da1cee71a3a00,
-			0x35507af184303800,
-			0x355353bbd9823c00,
-			0x35562c2de2598200,
-			0x3559044799ffda00,
-			0x355bdc08fbbfa600,
-			0x355eb37202e3d800,
-			0x35618a82aab7f200,
-			0x3564613aee881000,
-			0x3567379ac9a0de00,
-			0x356a0da2374f9600,
-			0x356ce35132e20400,
-			0x356fb8a7b7a68e00,
-			0x35728da5c0ec2800,
-			0x3575624b4a025200,
-			0x357836984e392e00,
-			0x357b0a8cc8e16200,
-			0x357dde28b54c2e00,
-			0x3580b16c0ecb6200,
-			0x35838456d0b16000,
-			0x358656e8f6512200,
-			0x358929227afe2e00,
-			0x358bfb035a0ca000,
-			0x358ecc8b8ed12a00,
-			0x35919dbb14a10800,
-			0x35946e91e6d20e00,
-			0x35973f1000baa800,
-			0x359a0f355db1cc00,
-			0x359cdf01f90f0a00,
-			0x359fae75ce2a7e00,
-			0x35a27d90d85cdc00,
-			0x35a54c5312ff6a00,
-			0x35a81abc796c0200,
-			0x35aae8cd06fd1000,
-			0x35adb684b70d9000,
-			0x35b083e384f91800,
-			0x35b350e96c1bca00,
-			0x35b61d9667d26200,
-			0x35b8e9ea737a2a00,
-			0x35bbb5e58a710000,
-			0x35be8187a8155a00,
-			0x35c14cd0c7c63800,
-			0x35c417c0e4e33800,
-			0x35c6e257facc8600,
-			0x35c9ac9604e2e200,
-			0x35cc767afe879c00,
-			0x35cf4006e31c9c00,
-			0x35d20939ae045e00,
-			0x35d4d2135aa1f000,
-			0x35d79a93e458f200,
-			0x35da62bb468d9a00,
-			0x35dd2a897ca4b000,
-			0x35dff1fe82038e00,
-			0x35e2b91a52102a00,
-			0x35e57fdce8310400,
-			0x35e846463fcd3000,
-			0x35eb0c56544c6000,
-			0x35edd20d2116d000,
-			0x35f0976aa1955000,
-			0x35f35c6ed1314c00,
-			0x35f62119ab54ba00,
-			0x35f8e56b2b6a2c00,
-			0x35fba9634cdcc200,
-			0x35fe6d020b183200,
-			0x360130476188ca00,
-			0x3603f3334b9b6800,
-			0x3606b5c5c4bd7a00,
-			0x360977fec85d0c00,
-			0x360c39de51e8b600,
-			0x360efb645ccfa600,
-			0x3611bc90e481a000,
-			0x36147d63e46efe00,
-			0x36173ddd5808aa00,
-			0x3619fdfd3ac02400,
-			0x361cbdc388077e00,
-			0x361f7d303b516400,
-			0x36223c4350111200,
-			0x3624fafcc1ba5800,
-			0x3627b95c8bc19a00,
-			0x362a7762a99bd800,
-			0x362d350f16be9a00,
-			0x362ff261cea00a00,
-			0x3632af5accb6da00,
-			0x36356bfa0c7a5a00,
-			0x3638283f89626a00,
-			0x363ae42b3ee77c00,
-			0x363d9fbd28829e00,
-			0x36405af541ad6e00,
-			0x364315d385e22200,
-			0x3645d057f09b8000,
-			0x36488a827d54e400,
-			0x364b4453278a4000,
-			0x364dfdc9eab81e00,
-			0x3650b6e6c25b9400,
-			0x36536fa9a9f25a00,
-			0x365628129cfab200,
-			0x3658e02196f37200,
-			0x365b97d6935c1000,
-			0x365e4f318db48e00,
-			0x36610632817d8600,
-			0x3663bcd96a382600,
-			0x3666732643662e00,
-			0x366929190889fa00,
-			0x366bdeb1b5267a00,
-			0x366e93f044bf3000,
-			0x367148d4b2d83200,
-			0x3673fd5efaf63000,
-			0x3676b18f189e6a00,
-			0x367965650756bc00,
-			0x367c18e0c2a58c00,
-			0x367ecc024611e800,
-			0x36817ec98d236000,
-			0x3684313693622400,
-			0x3686e3495456f600,
-			0x36899501cb8b3000,
-			0x368c465ff488c000,
-			0x368ef763cada2600,
-			0x3691a80d4a0a8000,
-			0x3694585c6da57a00,
-			0x3697085131375a00,
-			0x3699b7eb904cfa00,
-			0x369c672b8673c800,
-			0x369f16110f39ca00,
-			0x36a1c49c262d9800,
-			0x36a472ccc6de6600,
-			0x36a720a2ecdbfe00,
-			0x36a9ce1e93b6b800,
-			0x36ac7b3fb6ff8800,
-			0x36af28065247f600,
-			0x36b1d47261221c00,
-			0x36b48083df20b400,
-			0x36b72c3ac7d70600,
-			0x36b9d79716d8f000,
-			0x36bc8298c7baea00,
-			0x36bf2d3fd6120000,
-			0x36c1d78c3d73d200,
-			0x36c4817df9769c00,
-			0x36c72b1505b12a00,
-			0x36c9d4515dbae200,
-			0x36cc7d32fd2bba00,
-			0x36cf25b9df9c4600,
-			0x36d1cde600a5b200,
-			0x36d475b75be1b400,
-			0x36d71d2deceaa600,
-			0x36d9c449af5b6c00,
-			0x36dc6b0a9ecf8c00,
-			0x36df1170b6e31600,
-			0x36e1b77bf332be00,
-			0x36e45d2c4f5bc600,
-			0x36e70281c6fc0600,
-			0x36e9a77c55b1f200,
-			0x36ec4c1bf71c8c00,
-			0x36eef060a6db7800,
-			0x36f1944a608ee800,
-			0x36f437d91fd7a400,
-			0x36f6db0ce0571200,
-			0x36f97de59daf2a00,
-			0x36fc206353827600,
-			0x36fec285fd742200,
-			0x3701644d9727e600,
-			0x370405ba1c421a00,
-			0x3706a6cb8867a200,
-			0x37094781d73e0200,
-			0x370be7dd046b5200,
-			0x370e87dd0b964400,
-			0x37112781e8661800,
-			0x3713c6cb9682ae00,
-			0x371665ba11947800,
-			0x3719044d55448000,
-			0x371ba2855d3c6c00,
-			0x371e406225266e00,
-			0x3720dde3a8ad5a00,
-			0x37237b09e37c9800,
-			0x372617d4d1402200,
-			0x3728b4446da49200,
-			0x372b5058b4571200,
-			0x372dec11a1056600,
-			0x3730876f2f5de600,
-			0x373322715b0f8a00,
-			0x3735bd181fc9d600,
-			0x37385763793cf000,
-			0x373af15363198e00,
-			0x373d8ae7d9110000,
-			0x37402420d6d52c00,
-			0x3742bcfe58189000,
-			0x37455580588e4600,
-			0x3747eda6d3e9f600,
-			0x374a8571c5dfea00,
-			0x374d1ce12a24fe00,
-			0x374fb3f4fc6ea400,
-			0x37524aad3872e800,
-			0x3754e109d9e87200,
-			0x3757770adc867800,
-			0x375a0cb03c04ce00,
-			0x375ca1f9f41be200,
-			0x375f36e80084b400,
-			0x3761cb7a5cf8de00,
-			0x37645fb105329400,
-			0x3766f38bf4ec9e00,
-			0x3769870b27e25e00,
-			0x376c1a2e99cfce00,
-			0x376eacf646717e00,
-			0x37713f6229849c00,
-			0x3773d1723ec6e800,
-			0x3776632681f6ba00,
-			0x3778f47eeed30400,
-			0x377b857b811b5200,
-			0x377e161c348fc000,
-			0x3780a66104f10e00,
-			0x37833649ee008c00,
-			0x3785c5d6eb802400,
-			0x37885507f9325a00,
-			0x378ae3dd12da4600,
-			0x378d7256343b9c00,
-			0x37900073591aaa00,
-			0x37928e347d3c5000,
-			0x37951b999c660a00,
-			0x3797a8a2b25df000,
-			0x379a354fbaeaa800,
-			0x379cc1a0b1d37e00,
-			0x379f4d9592e04e00,
-			0x37a1d92e59d98c00,
-			0x37a4646b02884800,
-			0x37a6ef4b88b62600,
-			0x37a979cfe82d6800,
-			0x37ac03f81cb8ea00,
-			0x37ae8dc422241800,
-			0x37b11733f43afc00,
-			0x37b3a0478eca3a00,
-			0x37b628feed9f0800,
-			0x37b8b15a0c874000,
-			0x37bb3958e7514c00,
-			0x37bdc0fb79cc3000,
-			0x37c04841bfc78c00,
-			0x37c2cf2bb5139200,
-			0x37c555b955811800,
-			0x37c7dbea9ce18400,
-			0x37ca61bf8706d600,
-			0x37cce7380fc3aa00,
-			0x37cf6c5432eb3000,
-			0x37d1f113ec513800,
-			0x37d4757737ca2600,
-			0x37d6f97e112afa00,
-			0x37d97d2874494a00,
-			0x37dc00765cfb4600,
-			0x37de8367c717b800,
-			0x37e105fcae760400,
-			0x37e388350eee2200,
-			0x37e60a10e458ae00,
-			0x37e88b902a8ed200,
-			0x37eb0cb2dd6a5800,
-			0x37ed8d78f8c59c00,
-			0x37f00de2787ba000,
-			0x37f28def5867f200,
-			0x37f50d9f9466be00,
-			0x37f78cf32854d000,
-			0x37fa0bea100f8400,
-			0x37fc8a844774d600,
-			0x37ff08c1ca635800,
-			0x380186a294ba3400,
-			0x38040426a2593200,
-			0x3806814def20b000,
-			0x3808fe1876f1a600,
-			0x380b7a8635adac00,
-			0x380df6972736ea00,
-			0x3810724b47702600,
-			0x3812eda2923cc000,
-			0x3815689d0380b200,
-			0x3817e33a97208e00,
-			0x381a5d7b49018200,
-			0x381cd75f15095400,
-			0x381f50e5f71e6400,
-			0x3821ca0feb27ae00,
-			0x382442dced0cc200,
-			0x3826bb4cf8b5d400,
-			0x382933600a0baa00,
-			0x382bab161cf7a400,
-			0x382e226f2d63be00,
-			0x3830996b373a8e00,
-			0x3833100a36674600,
-			0x3835864c26d5b200,
-			0x3837fc3104723200,
-			0x383a71b8cb29c400,
-			0x383ce6e376ea0400,
-			0x383f5bb103a12000,
-			0x3841d0216d3de800,
-			0x38444434afafc400,
-			0x3846b7eac6e6b200,
-			0x38492b43aed35000,
-			0x384b9e3f6366d200,
-			0x384e10dde0930a00,
-			0x3850831f224a6200,
-			0x3852f503247fdc00,
-			0x38556689e3271c00,
-			0x3857d7b35a345a00,
-			0x385a487f859c6800,
-			0x385cb8ee6154b800,
-			0x385f28ffe9535000,
-			0x386198b4198ed600,
-			0x3864080aedfe8800,
-			0x38667704629a3c00,
-			0x3868e5a0735a6600,
-			0x386b53df1c381a00,
-			0x386dc1c0592cfa00,
-			0x38702f4426334e00,
-			0x38729c6a7f45f200,
-			0x3875093360605c00,
-			0x3877759ec57ea600,
-			0x3879e1acaa9d7800,
-			0x387c4d5d0bba2200,
-			0x387eb8afe4d28400,
-			0x388123a531e51c00,
-			0x38838e3ceef10600,
-			0x3885f87717f5f800,
-			0x38886253a8f44000,
-			0x388acbd29decc600,
-			0x388d34f3f2e11600,
-			0x388f9db7a3d34c00,
-			0x3892061dacc62600,
-			0x38946e2609bcfc00,
-			0x3896d5d0b6bbbc00,
-			0x38993d1dafc6f800,
-			0x389ba40cf0e3d400,
-			0x389e0a9e76181600,
-			0x38a070d23b6a1a00,
-			0x38a2d6a83ce0e000,
-			0x38a53c207683f800,
-			0x38a7a13ae45b9400,
-			0x38aa05f782707e00,
-			0x38ac6a564ccc2000,
-			0x38aece573f787c00,
-			0x38b131fa56802e00,
-			0x38b3953f8dee7200,
-			0x38b5f826e1cf1a00,
-			0x38b85ab04e2e9800,
-			0x38babcdbcf19f800,
-			0x38bd1ea9609ee200,
-			0x38bf8018fecb9600,
-			0x38c1e12aa5aef200,
-			0x38c441de51587200,
-			0x38c6a233fdd82c00,
-			0x38c9022ba73ed200,
-			0x38cb61c5499dae00,
-			0x38cdc100e106aa00,
-			0x38d01fde698c4800,
-			0x38d27e5ddf41ac00,
-			0x38d4dc7f3e3a8e00,
-			0x38d73a42828b4a00,
-			0x38d997a7a848d000,
-			0x38dbf4aeab88b200,
-			0x38de515788611600,
-			0x38e0ada23ae8c800,
-			0x38e3098ebf372a00,
-			0x38e5651d11643a00,
-			0x38e7c04d2d889200,
-			0x38ea1b1f0fbd6a00,
-			0x38ec7592b41c9600,
-			0x38eecfa816c08400,
-			0x38f1295f33c44000,
-			0x38f382b807436e00,
-			0x38f5dbb28d5a5600,
-			0x38f8344ec225d000,
-			0x38fa8c8ca1c35e00,
-			0x38fce46c28511800,
-			0x38ff3bed51edb000,
-			0x390193101ab87600,
-			0x3903e9d47ed15400,
-			0x3906403a7a58d800,
-			0x3908964209702600,
-			0x390aebeb2838fc00,
-			0x390d4135d2d5bc00,
-			0x390f962205695e00,
-			0x3911eaafbc177800,
-			0x39143edef3044000,
-			0x391692afa6548400,
-			0x3918e621d22db200,
-			0x391b393572b5ce00,
-			0x391d8bea84138000,
-			0x391fde41026e0a00,
-			0x39223038e9ed4a00,
-			0x392481d236b9be00,
-			0x3926d30ce4fc7a00,
-			0x392923e8f0df3200,
-			0x392b7466568c3800,
-			0x392dc485122e7a00,
-			0x393014451ff18200,
-			0x393263a67c017a00,
-			0x3934b2a9228b2400,
-			0x3937014d0fbbde00,
-			0x39394f923fc1ac00,
-			0x393b9d78aecb2400,
-			0x393deb0059078000,
-			0x394038293aa69000,
-			0x394284f34fd8cc00,
-			0x3944d15e94cf3c00,
-			0x39471d6b05bb9000,
-			0x394969189ed01000,
-			0x394bb4675c3fa000,
-			0x394dff573a3dc200,
-			0x395049e834fe9600,
-			0x3952941a48b6d600,
-			0x3954dded719be400,
-			0x39572761abe3b000,
-			0x39597076f3c4d000,
-			0x395bb92d45767600,
-			0x395e01849d307000,
-			0x3960497cf72b2a00,
-			0x396291164f9fae00,
-			0x3964d850a2c7a000,
-			0x39671f2becdd4800,
-			0x396965a82a1b8400,
-			0x396babc556bdd600,
-			0x396df1836f005600,
-			0x397036e26f1fc000,
-			0x39727be253596a00,
-			0x3974c08317eb4800,
-			0x397704c4b913ec00,
-			0x397948a733128800,
-			0x397b8c2a8226e800,
-			0x397dcf4ea2917600,
-			0x3980121390933800,
-			0x39825479486dd600,
-			0x3984967fc6639600,
-			0x3986d82706b75200,
-			0x3989196f05ac9200,
-			0x398b5a57bf876e00,
-			0x398d9ae1308ca000,
-			0x398fdb0b55017e00,
-			0x39921ad6292c0400,
-			0x39945a41a952c200,
-			0x3996994dd1bce800,
-			0x3998d7fa9eb24a00,
-			0x399b16480c7b5200,
-			0x399d543617610c00,
-			0x399f91c4bbad2400,
-			0x39a1cef3f5a9de00,
-			0x39a40bc3c1a22000,
-			0x39a648341be16e00,
-			0x39a8844500b3e600,
-			0x39aabff66c664a00,
-			0x39acfb485b45fa00,
-			0x39af363ac9a0ee00,
-			0x39b170cdb3c5c200,
-			0x39b3ab011603aa00,
-			0x39b5e4d4ecaa8200,
-			0x39b81e49340aba00,
-			0x39ba575de8756200,
-			0x39bc9013063c3200,
-			0x39bec86889b17400,
-			0x39c1005e6f281400,
-			0x39c337f4b2f3a400,
-			0x39c56f2b51684800,
-			0x39c7a60246daca00,
-			0x39c9dc798fa09200,
-			0x39cc1291280fa200,
-			0x39ce48490c7ea400,
-			0x39d07da13944d400,
-			0x39d2b299aaba1600,
-			0x39d4e7325d36e800,
-			0x39d71b6b4d146600,
-			0x39d94f4476ac4e00,
-			0x39db82bdd658fa00,
-			0x39ddb5d768756400,
-			0x39dfe891295d2600,
-			0x39e21aeb156c7400,
-			0x39e44ce529002200,
-			0x39e67e7f6075a800,
-			0x39e8afb9b82b1800,
-			0x39eae0942c7f2200,
-			0x39ed110eb9d11400,
-			0x39ef41295c80e400,
-			0x39f170e410ef1800,
-			0x39f3a03ed37ce400,
-			0x39f5cf39a08c1200,
-			0x39f7fdd4747f0a00,
-			0x39fa2c0f4bb8d600,
-			0x39fc59ea229d1e00,
-			0x39fe8764f5902c00,
-			0x3a00b47fc0f6e400,
-			0x3a02e13a8136ce00,
-			0x3a050d9532b60e00,
-			0x3a07398fd1db6400,
-			0x3a09652a5b0e3400,
-			0x3a0b9064cab68400,
-			0x3a0dbb3f1d3cee00,
-			0x3a0fe5b94f0ab800,
-			0x3a120fd35c89bc00,
-			0x3a14398d42247c00,
-			0x3a1662e6fc461400,
-			0x3a188be0875a4200,
-			0x3a1ab479dfcd6200,
-			0x3a1cdcb3020c6e00,
-			0x3a1f048bea84fe00,
-			0x3a212c0495a55000,
-			0x3a23531cffdc4000,
-			0x3a2579d525994000,
-			0x3a27a02d034c6e00,
-			0x3a29c62495667e00,
-			0x3a2bebbbd858c600,
-			0x3a2e10f2c8954000,
-			0x3a3035c9628e8000,
-			0x3a325a3fa2b7bc00,
-			0x3a347e558584c800,
-			0x3a36a20b076a1c00,
-			0x3a38c56024dcc600,
-			0x3a3ae854da528000,
-			0x3a3d0ae924419a00,
-			0x3a3f2d1cff210800,
-			0x3a414ef067685c00,
-			0x3a437063598fca00,
-			0x3a459175d2102400,
-			0x3a47b227cd62dc00,
-			0x3a49d27948020200,
-			0x3a4bf26a3e684a00,
-			0x3a4e11faad110000,
-			0x3a50312a90781c00,
-			0x3a524ff9e51a2c00,
-			0x3a546e68a7746000,
-			0x3a568c76d4048c00,
-			0x3a58aa2467491e00,
-			0x3a5ac7715dc12400,
-			0x3a5ce45db3ec5600,
-			0x3a5f00e9664afe00,
-			0x3a611d14715e1000,
-			0x3a6338ded1a71c00,
-			0x3a65544883a85400,
-			0x3a676f5183e48600,
-			0x3a6989f9cedf2600,
-			0x3a6ba441611c4400,
-			0x3a6dbe2837209200,
-			0x3a6fd7ae4d715e00,
-			0x3a71f0d3a0949c00,
-			0x3a7409982d10e200,
-			0x3a7621fbef6d5c00,
-			0x3a7839fee431e000,
-			0x3a7a51a107e6de00,
-			0x3a7c68e257156c00,
-			0x3a7e7fc2ce473a00,
-			0x3a8096426a069c00,
-			0x3a82ac6126de8c00,
-			0x3a84c21f015a9800,
-			0x3a86d77bf606f800,
-			0x3a88ec7801707e00,
-			0x3a8b01132024a400,
-			0x3a8d154d4eb18000,
-			0x3a8f292689a5c600,
-			0x3a913c9ecd90cc00,
-			0x3a934fb617029000,
-			0x3a95626c628ba600,
-			0x3a9774c1acbd4800,
-			0x3a9986b5f2295200,
-			0x3a9b98492f623c00,
-			0x3a9da97b60fb2200,
-			0x3a9fba4c8387bc00,
-			0x3aa1cabc939c6c00,
-			0x3aa3dacb8dce2c00,
-			0x3aa5ea796eb29e00,
-			0x3aa7f9c632dffc00,
-			0x3aaa08b1d6ed2600,
-			0x3aac173c57719e00,
-			0x3aae2565b1058600,
-			0x3ab0332de0419c00,
-			0x3ab24094e1bf4a00,
-			0x3ab44d9ab2188e00,
-			0x3ab65a3f4de80c00,
-			0x3ab86682b1c91000,
-			0x3aba7264da577c00,
-			0x3abc7de5c42fda00,
-			0x3abe89056bef5000,
-			0x3ac093c3ce33aa00,
-			0x3ac29e20e79b5200,
-			0x3ac4a81cb4c55600,
-			0x3ac6b1b732516200,
-			0x3ac8baf05cdfc200,
-			0x3acac3c831116800,
-			0x3acccc3eab87e200,
-			0x3aced453c8e56600,
-			0x3ad0dc0785ccc200,
-			0x3ad2e359dee16e00,
-			0x3ad4ea4ad0c77e00,
-			0x3ad6f0da5823aa00,
-			0x3ad8f708719b4600,
-			0x3adafcd519d45000,
-			0x3add02404d756200,
-			0x3adf074a0925b400,
-			0x3ae10bf2498d2a00,
-			0x3ae310390b543e00,
-			0x3ae5141e4b241200,
-			0x3ae717a205a66a00,
-			0x3ae91ac43785a400,
-			0x3aeb1d84dd6cca00,
-			0x3aed1fe3f4078000,
-			0x3aef21e178020c00,
-			0x3af1237d66095a00,
-			0x3af324b7bacaf800,
-			0x3af5259072f50c00,
-			0x3af726078b366800,
-			0x3af9261d003e7a00,
-			0x3afb25d0cebd5800,
-			0x3afd2522f363b000,
-			0x3aff24136ae2d800,
-			0x3b0122a231ecca00,
-			0x3b0320cf45341c00,
-			0x3b051e9aa16c0800,
-			0x3b071c0443486a00,
-			0x3b09190c277dc200,
-			0x3b0b15b24ac12e00,
-			0x3b0d11f6a9c86e00,
-			0x3b0f0dd94149e800,
-			0x3b11095a0dfca200,
-			0x3b1304790c984200,
-			0x3b14ff3639d51200,
-			0x3b16f991926bfa00,
-			0x3b18f38b13168c00,
-			0x3b1aed22b88ef400,
-			0x3b1ce6587f900200,
-			0x3b1edf2c64d52e00,
-			0x3b20d79e651a8c00,
-			0x3b22cfae7d1cd200,
-			0x3b24c75ca9995800,
-			0x3b26bea8e74e1e00,
-			0x3b28b59332f9c000,
-			0x3b2aac1b895b7c00,
-			0x3b2ca241e7333800,
-			0x3b2e980649417600,
-			0x3b308d68ac475e00,
-			0x3b3282690d06b800,
-			0x3b3477076841f200,
-			0x3b366b43babc1600,
-			0x3b385f1e0138d600,
-			0x3b3a5296387c8400,
-			0x3b3c45ac5d4c1200,
-			0x3b3e38606c6d1e00,
-			0x3b402ab262a5dc00,
-			0x3b421ca23cbd2800,
-			0x3b440e2ff77a8200,
-			0x3b45ff5b8fa60a00,
-			0x3b47f02502088400,
-			0x3b49e08c4b6b5600,
-			0x3b4bd09168988800,
-			0x3b4dc034565ac600,
-			0x3b4faf75117d5a00,
-			0x3b519e5396cc3a00,
-			0x3b538ccfe313f400,
-			0x3b557ae9f321c000,
-			0x3b5768a1c3c37400,
-			0x3b5955f751c78c00,
-			0x3b5b42ea99fd2400,
-			0x3b5d2f7b9933fe00,
-			0x3b5f1baa4c3c7e00,
-			0x3b610776afe7a800,
-			0x3b62f2e0c1072600,
-			0x3b64dde87c6d3e00,
-			0x3b66c88ddeece400,
-			0x3b68b2d0e559a600,
-			0x3b6a9cb18c87ba00,
-			0x3b6c862fd14bf600,
-			0x3b6e6f4bb07bd400,
-			0x3b70580526ed6e00,
-			0x3b72405c31778600,
-			0x3b742850ccf17e00,
-			0x3b760fe2f6335a00,
-			0x3b77f712aa15c600,
-			0x3b79dddfe5720800,
-			0x3b7bc44aa5221600,
-			0x3b7daa52e6007a00,
-			0x3b7f8ff8a4e87000,
-			0x3b81753bdeb5ca00,
-			0x3b835a1c90450400,
-			0x3b853e9ab6733e00,
-			0x3b8722b64e1e3800,
-			0x3b89066f54245800,
-			0x3b8ae9c5c564a600,
-			0x3b8cccb99ebecc00,
-			0x3b8eaf4add131600,
-			0x3b9091797d427800,
-			0x3b9273457c2e8600,
-			0x3b9454aed6b97800,
-			0x3b9635b589c62c00,
-			0x3b98165992381e00,
-			0x3b99f69aecf36e00,
-			0x3b9bd67996dce800,
-			0x3b9db5f58cd9f000,
-			0x3b9f950ecbd09400,
-			0x3ba173c550a78200,
-			0x3ba3521918461000,
-			0x3ba5300a1f943400,
-			0x3ba70d98637a8a00,
-			0x3ba8eac3e0e24c00,
-			0x3baac78c94b56000,
-			0x3baca3f27bde4800,
-			0x3bae7ff593482a00,
-			0x3bb05b95d7ded800,
-			0x3bb236d3468ebe00,
-			0x3bb411addc44f400,
-			0x3bb5ec2595ef2c00,
-			0x3bb7c63a707bc200,
-			0x3bb99fec68d9b800,
-			0x3bbb793b7bf8ae00,
-			0x3bbd5227a6c8ea00,
-			0x3bbf2ab0e63b5600,
-			0x3bc102d737418000,
-			0x3bc2da9a96cd9800,
-			0x3bc4b1fb01d27600,
-			0x3bc688f875439200,
-			0x3bc85f92ee150800,
-			0x3bca35ca693b9a00,
-			0x3bcc0b9ee3acae00,
-			0x3bcde1105a5e4a00,
-			0x3bcfb61eca471e00,
-			0x3bd18aca305e7a00,
-			0x3bd35f12899c5000,
-			0x3bd532f7d2f93c00,
-			0x3bd7067a096e7600,
-			0x3bd8d99929f5e600,
-			0x3bdaac55318a0c00,
-			0x3bdc7eae1d261200,
-			0x3bde50a3e9c5c400,
-			0x3be0223694659600,
-			0x3be1f3661a029c00,
-			0x3be3c432779a8e00,
-			0x3be5949baa2bcc00,
-			0x3be764a1aeb55600,
-			0x3be934448236d400,
-			0x3beb038421b09000,
-			0x3becd2608a237800,
-			0x3beea0d9b8912000,
-			0x3bf06eefa9fbbe00,
-			0x3bf23ca25b662e00,
-			0x3bf409f1c9d3ee00,
-			0x3bf5d6ddf2492400,
-			0x3bf7a366d1ca9c00,
-			0x3bf96f8c655dc000,
-			0x3bfb3b4eaa08a000,
-			0x3bfd06ad9cd1f400,
-			0x3bfed1a93ac11400,
-			0x3c009c4180de0400,
-			0x3c0266766c316200,
-			0x3c043047f9c47800,
-			0x3c05f9b626a13200,
-			0x3c07c2c0efd22400,
-			0x3c098b6852627c00,
-			0x3c0b53ac4b5e1e00,
-			0x3c0d1b8cd7d18200,
-			0x3c0ee309f4c9cc00,
-			0x3c10aa239f54c600,
-			0x3c1270d9d480da00,
-			0x3c14372c915d1e00,
-			0x3c15fd1bd2f94400,
-			0x3c17c2a79665a800,
-			0x3c1987cfd8b34c00,
-			0x3c1b4c9496f3d000,
-			0x3c1d10f5ce397e00,
-			0x3c1ed4f37b974600,
-			0x3c20988d9c20ba00,
-			0x3c225bc42cea1200,
-			0x3c241e972b082800,
-			0x3c25e10693908000,
-			0x3c27a31263994000,
-			0x3c2964ba98393200,
-			0x3c2b25ff2e87c400,
-			0x3c2ce6e0239d1000,
-			0x3c2ea75d7491ce00,
-			0x3c3067771e7f5a00,
-			0x3c32272d1e7fbc00,
-			0x3c33e67f71ad9c00,
-			0x3c35a56e15244600,
-			0x3c3763f905ffb000,
-			0x3c392220415c6e00,
-			0x3c3adfe3c457c000,
-			0x3c3c9d438c0f8a00,
-			0x3c3e5a3f95a25200,
-			0x3c4016d7de2f4600,
-			0x3c41d30c62d63400,
-			0x3c438edd20b79600,
-			0x3c454a4a14f48a00,
-			0x3c4705533caecc00,
-			0x3c48bff89508ca00,
-			0x3c4a7a3a1b258a00,
-			0x3c4c3417cc28c000,
-			0x3c4ded91a536c400,
-			0x3c4fa6a7a3748e00,
-			0x3c515f59c407c400,
-			0x3c5317a80416a800,
-			0x3c54cf9260c82a00,
-			0x3c568718d743d800,
-			0x3c583e3b64b1ee00,
-			0x3c59f4fa063b4200,
-			0x3c5bab54b9095c00,
-			0x3c5d614b7a465e00,
-			0x3c5f16de471d1600,
-			0x3c60cc0d1cb8f800,
-			0x3c6280d7f8461a00,
-			0x3c64353ed6f13c00,
-			0x3c65e941b5e7c000,
-			0x3c679ce09257ac00,
-			0x3c69501b696fae00,
-			0x3c6b02f2385f1e00,
-			0x3c6cb564fc55f200,
-			0x3c6e6773b284c800,
-			0x3c70191e581ce600,
-			0x3c71ca64ea503800,
-			0x3c737b4766514c00,
-			0x3c752bc5c9535a00,
-			0x3c76dbe0108a3c00,
-			0x3c788b96392a7200,
-			0x3c7a3ae840692400,
-			0x3c7be9d6237c2000,
-			0x3c7d985fdf99d800,
-			0x3c7f468571f96400,
-			0x3c80f446d7d28400,
-			0x3c82a1a40e5d9a00,
-			0x3c844e9d12d3b200,
-			0x3c85fb31e26e7a00,
-			0x3c87a7627a684a00,
-			0x3c89532ed7fc1e00,
-			0x3c8afe96f8659600,
-			0x3c8ca99ad8e0fc00,
-			0x3c8e543a76ab3c00,
-			0x3c8ffe75cf01ec00,
-			0x3c91a84cdf234400,
-			0x3c9351bfa44e2600,
-			0x3c94face1bc21400,
-			0x3c96a37842bf3c00,
-			0x3c984bbe16867400,
-			0x3c99f39f94593200,
-			0x3c9b9b1cb9799200,
-			0x3c9d4235832a5c00,
-			0x3c9ee8e9eeaef800,
-			0x3ca08f39f94b7800,
-			0x3ca23525a0449400,
-			0x3ca3daace0dfaa00,
-			0x3ca57fcfb862bc00,
-			0x3ca7248e24147600,
-			0x3ca8c8e8213c2400,
-			0x3caa6cddad21c400,
-			0x3cac106ec50dec00,
-			0x3cadb39b6649e000,
-			0x3caf56638e1f8e00,
-			0x3cb0f8c739d98400,
-			0x3cb29ac666c2f400,
-			0x3cb43c611227c000,
-			0x3cb5dd9739546a00,
-			0x3cb77e68d9961c00,
-			0x3cb91ed5f03aa200,
-			0x3cbabede7a907800,
-			0x3cbc5e8275e6b600,
-			0x3cbdfdc1df8d2400,
-			0x3cbf9c9cb4d42a00,
-			0x3cc13b12f30cd800,
-			0x3cc2d9249788e600,
-			0x3cc476d19f9ab000,
-			0x3cc6141a08953e00,
-			0x3cc7b0fdcfcc3600,
-			0x3cc94d7cf293f000,
-			0x3ccae9976e415e00,
-			0x3ccc854d402a2200,
-			0x3cce209e65a48200,
-			0x3ccfbb8adc076a00,
-			0x3cd15612a0aa6a00,
-			0x3cd2f035b0e5be00,
-			0x3cd489f40a124800,
-			0x3cd6234da9898c00,
-			0x3cd7bc428ca5bc00,
-			0x3cd954d2b0c1aa00,
-			0x3cdaecfe1338d000,
-			0x3cdc84c4b1675600,
-			0x3cde1c2688a9fe00,
-			0x3cdfb323965e3e00,
-			0x3ce149bbd7e22c00,
-			0x3ce2dfef4a948400,
-			0x3ce475bdebd4ae00,
-			0x3ce60b27b902b400,
-			0x3ce7a02caf7f4600,
-			0x3ce934ccccabc400,
-			0x3ceac9080dea2a00,
-			0x3cec5cde709d2000,
-			0x3cedf04ff227f800,
-			0x3cef835c8feea400,
-			0x3cf116044755c400,
-			0x3cf2a84715c29c00,
-			0x3cf43a24f89b1400,
-			0x3cf5cb9ded45c200,
-			0x3cf75cb1f129da00,
-			0x3cf8ed6101af4200,
-			0x3cfa7dab1c3e8000,
-			0x3cfc0d903e40c200,
-			0x3cfd9d10651fde00,
-			0x3cff2c2b8e465000,
-			0x3d00bae1b71f3e00,
-			0x3d024932dd167600,
-			0x3d03d71efd986400,
-			0x3d0564a616122a00,
-			0x3d06f1c823f18600,
-			0x3d087e8524a4e000,
-			0x3d0a0add159b4800,
-			0x3d0b96cff4447800,
-			0x3d0d225dbe10cc00,
-			0x3d0ead8670714a00,
-			0x3d10384a08d7a400,
-			0x3d11c2a884b62a00,
-			0x3d134ca1e17fda00,
-			0x3d14d6361ca85a00,
-			0x3d165f6533a3f400,
-			0x3d17e82f23e79a00,
-			0x3d197093eae8e600,
-			0x3d1af893861e1800,
-			0x3d1c802df2fe1e00,
-			0x3d1e07632f008600,
-			0x3d1f8e33379d8a00,
-			0x3d21149e0a4e0800,
-			0x3d229aa3a48b8800,
-			0x3d24204403d03a00,
-			0x3d25a57f2596f600,
-			0x3d272a55075b3800,
-			0x3d28aec5a6992600,
-			0x3d2a32d100cd9000,
-			0x3d2bb6771375ea00,
-			0x3d2d39b7dc105000,
-			0x3d2ebc93581b8a00,
-			0x3d303f0985170400,
-			0x3d31c11a6082ce00,
-			0x3d3342c5e7dfa800,
-			0x3d34c40c18aef600,
-			0x3d3644ecf072c400,
-			0x3d37c5686cadc400,
-			0x3d39457e8ae35000,
-			0x3d3ac52f48977000,
-			0x3d3c447aa34ec800,
-			0x3d3dc360988eb200,
-			0x3d3f41e125dd2600,
-			0x3d40bffc48c0c600,
-			0x3d423db1fec0de00,
-			0x3d43bb0245655e00,
-			0x3d4537ed1a36e400,
-			0x3d46b4727abeb000,
-			0x3d4830926486b000,
-			0x3d49ac4cd5197200,
-			0x3d4b27a1ca023400,
-			0x3d4ca29140ccd600,
-			0x3d4e1d1b3705e600,
-			0x3d4f973faa3a9400,
-			0x3d5110fe97f8be00,
-			0x3d528a57fdcee200,
-			0x3d54034bd94c2e00,
-			0x3d557bda28007600,
-			0x3d56f402e77c3400,
-			0x3d586bc615508c00,
-			0x3d59e323af0f4a00,
-			0x3d5b5a1bb24ae200,
-			0x3d5cd0ae1c966e00,
-			0x3d5e46daeb85b600,
-			0x3d5fbca21cad2200,
-			0x3d613203ada1cc00,
-			0x3d62a6ff9bf96e00,
-			0x3d641b95e54a6e00,
-			0x3d658fc6872bda00,
-			0x3d6703917f356800,
-			0x3d6876f6caff7600,
-			0x3d69e9f668230a00,
-			0x3d6b5c905439d400,
-			0x3d6ccec48cde2c00,
-			0x3d6e40930fab1200,
-			0x3d6fb1fbda3c2e00,
-			0x3d7122feea2dd000,
-			0x3d72939c3d1cf200,
-			0x3d7403d3d0a73400,
-			0x3d7573a5a26ae400,
-			0x3d76e311b006f000,
-			0x3d785217f71af800,
-			0x3d79c0b875473c00,
-			0x3d7b2ef3282ca800,
-			0x3d7c9cc80d6cd400,
-			0x3d7e0a3722a9fa00,
-			0x3d7f774065870200,
-			0x3d80e3e3d3a77800,
-			0x3d8250216aaf9800,
-			0x3d83bbf928443c00,
-			0x3d85276b0a0af000,
-			0x3d8692770da9e400,
-			0x3d87fd1d30c7f400,
-			0x3d89675d710c9e00,
-			0x3d8ad137cc201000,
-			0x3d8c3aac3fab1e00,
-			0x3d8da3bac9574400,
-			0x3d8f0c6366cea800,
-			0x3d9074a615bc1800,
-			0x3d91dc82d3cb0a00,
-			0x3d9343f99ea79c00,
-			0x3d94ab0a73fe9c00,
-			0x3d9611b5517d7600,
-			0x3d9777fa34d24800,
-			0x3d98ddd91babd200,
-			0x3d9a435203b98200,
-			0x3d9ba864eaab6c00,
-			0x3d9d0d11ce324e00,
-			0x3d9e7158abff8e00,
-			0x3d9fd53981c53e00,
-			0x3da138b44d361200,
-			0x3da29bc90c056e00,
-			0x3da3fe77bbe76000,
-			0x3da560c05a909600,
-			0x3da6c2a2e5b66e00,
-			0x3da8241f5b0ef000,
-			0x3da98535b850c800,
-			0x3daae5e5fb334c00,
-			0x3dac4630216e8000,
-			0x3dada61428bb0e00,
-			0x3daf05920ed24600,
-			0x3db064a9d16e2600,
-			0x3db1c35b6e495200,
-			0x3db321a6e31f1800,
-			0x3db47f8c2dab7000,
-			0x3db5dd0b4baafc00,
-			0x3db73a243adb0200,
-			0x3db896d6f8f97800,
-			0x3db9f32383c4fa00,
-			0x3dbb4f09d8fccc00,
-			0x3dbcaa89f660de00,
-			0x3dbe05a3d9b1c600,
-			0x3dbf605780b0c600,
-			0x3dc0baa4e91fc800,
-			0x3dc2148c10c16000,
-			0x3dc36e0cf558ce00,
-			0x3dc4c72794a9f400,
-			0x3dc61fdbec796400,
-			0x3dc77829fa8c5600,
-			0x3dc8d011bca8ac00,
-			0x3dca27933094f400,
-			0x3dcb7eae54186000,
-			0x3dccd56324fad200,
-			0x3dce2bb1a104d000,
-			0x3dcf8199c5ff8c00,
-			0x3dd0d71b91b4e200,
-			0x3dd22c3701ef5600,
-			0x3dd380ec147a1400,
-			0x3dd4d53ac720f600,
-			0x3dd6292317b07a00,
-			0x3dd77ca503f5ce00,
-			0x3dd8cfc089bec400,
-			0x3dda2275a6d9da00,
-			0x3ddb74c459163800,
-			0x3ddcc6ac9e43ae00,
-			0x3dde182e7432b400,
-			0x3ddf6949d8b47200,
-			0x3de0b9fec99ab200,
-			0x3de20a4d44b7ee00,
-			0x3de35a3547df4600,
-			0x3de4a9b6d0e48600,
-			0x3de5f8d1dd9c1e00,
-			0x3de747866bdb3200,
-			0x3de895d479778400,
-			0x3de9e3bc04478800,
-			0x3deb313d0a225a00,
-			0x3dec7e5788dfbc00,
-			0x3dedcb0b7e582000,
-			0x3def1758e8649c00,
-			0x3df0633fc4def400,
-			0x3df1aec011a19400,
-			0x3df2f9d9cc878e00,
-			0x3df4448cf36ca800,
-			0x3df58ed9842d4600,
-			0x3df6d8bf7ca68000,
-			0x3df8223edab61200,
-			0x3df96b579c3a6000,
-			0x3dfab409bf127e00,
-			0x3dfbfc55411e2800,
-			0x3dfd443a203dc000,
-			0x3dfe8bb85a525800,
-			0x3dffd2cfed3da600,
-			0x3e011980d6e21000,
-			0x3e025fcb1522a000,
-			0x3e03a5aea5e30e00,
-			0x3e04eb2b8707bc00,
-			0x3e063041b675b400,
-			0x3e0774f13212aa00,
-			0x3e08b939f7c4fe00,
-			0x3e09fd1c0573ba00,
-			0x3e0b409759069000,
-			0x3e0c83abf065de00,
-			0x3e0dc659c97aaa00,
-			0x3e0f08a0e22ea600,
-			0x3e104a81386c2e00,
-			0x3e118bfaca1e4800,
-			0x3e12cd0d9530a600,
-			0x3e140db9978f9e00,
-			0x3e154dfecf283800,
-			0x3e168ddd39e82000,
-			0x3e17cd54d5bdb000,
-			0x3e190c65a097ec00,
-			0x3e1a4b0f98668000,
-			0x3e1b8952bb19c200,
-			0x3e1cc72f06a2b800,
-			0x3e1e04a478f30a00,
-			0x3e1f41b30ffd1000,
-			0x3e207e5ac9b3cc00,
-			0x3e21ba9ba40ae800,
-			0x3e22f6759cf6b800,
-			0x3e2431e8b26c3e00,
-			0x3e256cf4e2612200,
-			0x3e26a79a2acbba00,
-			0x3e27e1d889a30400,
-			0x3e291baffcdeac00,
-			0x3e2a552082770200,
-			0x3e2b8e2a18650400,
-			0x3e2cc6ccbca25e00,
-			0x3e2dff086d296000,
-			0x3e2f36dd27f50a00,
-			0x3e306e4aeb010400,
-			0x3e31a551b4499e00,
-			0x3e32dbf181cbd600,
-			0x3e34122a51855400,
-			0x3e3547fc21746a00,
-			0x3e367d66ef981400,
-			0x3e37b26ab9effc00,
-			0x3e38e7077e7c7000,
-			0x3e3a1b3d3b3e6e00,
-			0x3e3b4f0bee379c00,
-			0x3e3c8273956a4e00,
-			0x3e3db5742ed97e00,
-			0x3e3ee80db888d400,
-			0x3e401a40307ca000,
-			0x3e414c0b94b9e000,
-			0x3e427d6fe3463a00,
-			0x3e43ae6d1a280000,
-			0x3e44df0337662e00,
-			0x3e460f3239086a00,
-			0x3e473efa1d170600,
-			0x3e486e5ae19b0000,
-			0x3e499d54849dfe00,
-			0x3e4acbe7042a5200,
-			0x3e4bfa125e4af800,
-			0x3e4d27d6910b9a00,
-			0x3e4e55339a788800,
-			0x3e4f8229789ec000,
-			0x3e50aeb8298bea00,
-			0x3e51dadfab4e5a00,
-			0x3e53069ffbf50a00,
-			0x3e5431f9198fa600,
-			0x3e555ceb022e8000,
-			0x3e568775b3e29800,
-			0x3e57b1992cbd9600,
-			0x3e58db556ad1ce00,
-			0x3e5a04aa6c323e00,
-			0x3e5b2d982ef29200,
-			0x3e5c561eb1272000,
-			0x3e5d7e3df0e4e600,
-			0x3e5ea5f5ec418e00,
-			0x3e5fcd46a1537000,
-			0x3e60f4300e318c00,
-			0x3e621ab230f39000,
-			0x3e6340cd07b1d000,
-			0x3e64668090854e00,
-			0x3e658bccc987b800,
-			0x3e66b0b1b0d36800,
-			0x3e67d52f44836000,
-			0x3e68f94582b34e00,
-			0x3e6a1cf4697f8c00,
-			0x3e6b403bf7052000,
-			0x3e6c631c2961b400,
-			0x3e6d8594feb3a800,
-			0x3e6ea7a6751a0200,
-			0x3e6fc9508ab47200,
-			0x3e70ea933da35400,
-			0x3e720b6e8c07ae00,
-			0x3e732be274033600,
-			0x3e744beef3b84a00,
-			0x3e756b940949ee00,
-			0x3e768ad1b2dbde00,
-			0x3e77a9a7ee927400,
-			0x3e78c816ba92bc00,
-			0x3e79e61e15026e00,
-			0x3e7b03bdfc07ea00,
-			0x3e7c20f66dca3c00,
-			0x3e7d3dc768711e00,
-			0x3e7e5a30ea24f400,
-			0x3e7f7632f10eca00,
-			0x3e8091cd7b585c00,
-			0x3e81ad00872c0e00,
-			0x3e82c7cc12b4f400,
-			0x3e83e2301c1ec600,
-			0x3e84fc2ca195ee00,
-			0x3e8615c1a1478000,
-			0x3e872eef19613800,
-			0x3e8847b508118000,
-			0x3e8960136b877000,
-			0x3e8a780a41f2c600,
-			0x3e8b8f998983f000,
-			0x3e8ca6c1406c0400,
-			0x3e8dbd8164dcc600,
-			0x3e8ed3d9f508a400,
-			0x3e8fe9caef22bc00,
-			0x3e90ff54515ecc00,
-			0x3e92147619f14e00,
-			0x3e932930470f5a00,
-			0x3e943d82d6eeb800,
-			0x3e95516dc7c5dc00,
-			0x3e9664f117cbe800,
-			0x3e97780cc538a400,
-			0x3e988ac0ce448a00,
-			0x3e999d0d3128ba00,
-			0x3e9aaef1ec1f0200,
-			0x3e9bc06efd61dc00,
-			0x3e9cd184632c6e00,
-			0x3e9de2321bba8600,
-			0x3e9ef2782548a600,
-			0x3ea002567e13f000,
-			0x3ea111cd245a3c00,
-			0x3ea220dc165a0800,
-			0x3ea32f8352528200,
-			0x3ea43dc2d6837c00,
-			0x3ea54b9aa12d7e00,
-			0x3ea6590ab091b400,
-			0x3ea7661302f1f800,
-			0x3ea872b39690d000,
-			0x3ea97eec69b17200,
-			0x3eaa8abd7a97b600,
-			0x3eab9626c7882800,
-			0x3eaca1284ec7fe00,
-			0x3eadabc20e9d1a00,
-			0x3eaeb5f4054e0400,
-			0x3eafbfbe3121fa00,
-			0x3eb0c9209060e000,
-			0x3eb1d21b21534400,
-			0x3eb2daade2426600,
-			0x3eb3e2d8d1782a00,
-			0x3eb4ea9bed3f2800,
-			0x3eb5f1f733e2a000,
-			0x3eb6f8eaa3ae7c00,
-			0x3eb7ff763aef5600,
-			0x3eb90599f7f27200,
-			0x3eba0b55d905bc00,
-			0x3ebb10a9dc77d600,
-			0x3ebc159600980600,
-			0x3ebd1a1a43b63e00,
-			0x3ebe1e36a4231e00,
-			0x3ebf21eb202ff400,
-			0x3ec02537b62eb800,
-			0x3ec1281c64720c00,
-			0x3ec22a99294d4200,
-			0x3ec32cae03145600,
-			0x3ec42e5af01bee00,
-			0x3ec52f9feeb96000,
-			0x3ec6307cfd42ae00,
-			0x3ec730f21a0e8200,
-			0x3ec830ff43743400,
-			0x3ec930a477cbcc00,
-			0x3eca2fe1b56dfa00,
-			0x3ecb2eb6fab41800,
-			0x3ecc2d2445f83400,
-			0x3ecd2b2995950000,
-			0x3ece28c6e7e5de00,
-			0x3ecf25fc3b46dc00,
-			0x3ed022c98e14b400,
-			0x3ed11f2edeaccc00,
-			0x3ed21b2c2b6d3600,
-			0x3ed316c172b4b400,
-			0x3ed411eeb2e2ac00,
-			0x3ed50cb3ea573600,
-			0x3ed6071117731800,
-			0x3ed701063897c000,
-			0x3ed7fa934c274a00,
-			0x3ed8f3b850847e00,
-			0x3ed9ec754412d200,
-			0x3edae4ca25366400,
-			0x3edbdcb6f2540400,
-			0x3edcd43ba9d12a00,
-			0x3eddcb584a13fc00,
-			0x3edec20cd1834e00,
-			0x3edfb8593e869c00,
-			0x3ee0ae3d8f861200,
-			0x3ee1a3b9c2ea8800,
-			0x3ee298cdd71d8000,
-			0x3ee38d79ca892c00,
-			0x3ee481bd9b986800,
-			0x3ee5759948b6bc00,
-			0x3ee6690cd0505e00,
-			0x3ee75c1830d23200,
-			0x3ee84ebb68a9c400,
-			0x3ee940f676455000,
-			0x3eea32c95813bc00,
-			0x3eeb24340c849c00,
-			0x3eec153692083200,
-			0x3eed05d0e70f6a00,
-			0x3eedf6030a0bdc00,
-			0x3eeee5ccf96fd000,
-			0x3eefd52eb3ae3600,
-			0x3ef0c428373ab000,
-			0x3ef1b2b982898600,
-			0x3ef2a0e2940fb400,
-			0x3ef38ea36a42da00,
-			0x3ef47bfc03994e00,
-			0x3ef568ec5e8a0a00,
-			0x3ef65574798cbc00,
-			0x3ef741945319ba00,
-			0x3ef82d4be9aa0600,
-			0x3ef9189b3bb75200,
-			0x3efa038247bbf800,
-			0x3efaee010c330600,
-			0x3efbd81787983200,
-			0x3efcc1c5b867dc00,
-			0x3efdab0b9d1f1600,
-			0x3efe93e9343b9c00,
-			0x3eff7c5e7c3bd600,
-			0x3f00646b739edc00,
-			0x3f014c1018e46e00,
-			0x3f02334c6a8cfe00,
-			0x3f031a206719a600,
-			0x3f04008c0d0c3000,
-			0x3f04e68f5ae71200,
-			0x3f05cc2a4f2d6e00,
-			0x3f06b15ce8631200,
-			0x3f079627250c7a00,
-			0x3f087a8903aed000,
-			0x3f095e8282cfe800,
-			0x3f0a4213a0f64800,
-			0x3f0b253c5ca91c00,
-			0x3f0c07fcb4704200,
-			0x3f0cea54a6d44000,
-			0x3f0dcc44325e4e00,
-			0x3f0eadcb55984e00,
-			0x3f0f8eea0f0cd000,
-			0x3f106fa05d471200,
-			0x3f114fee3ed2fc00,
-			0x3f122fd3b23d2200,
-			0x3f130f50b612ca00,
-			0x3f13ee6548e1e400,
-			0x3f14cd1169390c00,
-			0x3f15ab5515a78c00,
-			0x3f1689304cbd5c00,
-			0x3f1766a30d0b1e00,
-			0x3f1843ad55222600,
-			0x3f19204f23947000,
-			0x3f19fc8876f4a800,
-			0x3f1ad8594dd62400,
-			0x3f1bb3c1a6cce800,
-			0x3f1c8ec1806daa00,
-			0x3f1d6958d94dc600,
-			0x3f1e4387b0034800,
-			0x3f1f1d4e0324ec00,
-			0x3f1ff6abd14a1400,
-			0x3f20cfa1190ad600,
-			0x3f21a82dd8fff000,
-			0x3f2280520fc2d200,
-			0x3f23580dbbed9600,
-			0x3f242f60dc1b0200,
-			0x3f25064b6ee68a00,
-			0x3f25dccd72ec5200,
-			0x3f26b2e6e6c92800,
-			0x3f278897c91a8a00,
-			0x3f285de0187e9e00,
-			0x3f2932bfd3943a00,
-			0x3f2a0736f8fae400,
-			0x3f2adb458752cc00,
-			0x3f2baeeb7d3cd000,
-			0x3f2c8228d95a7c00,
-			0x3f2d54fd9a4e0600,
-			0x3f2e2769beba5400,
-			0x3f2ef96d4542fa00,
-			0x3f2fcb082c8c3800,
-			0x3f309c3a733afa00,
-			0x3f316d0417f4da00,
-			0x3f323d6519602200,
-			0x3f330d5d7623c400,
-			0x3f33dced2ce76600,
-			0x3f34ac143c535400,
-			0x3f357ad2a3108a00,
-			0x3f3649285fc8b800,
-			0x3f37171571262e00,
-			0x3f37e499d5d3f600,
-			0x3f38b1b58c7dc000,
-			0x3f397e6893cfec00,
-			0x3f3a4ab2ea778600,
-			0x3f3b16948f224a00,
-			0x3f3be20d807e9c00,
-			0x3f3cad1dbd3b9200,
-			0x3f3d77c54408f000,
-			0x3f3e420413972600,
-			0x3f3f0bda2a974c00,
-			0x3f3fd54787bb3200,
-			0x3f409e4c29b54c00,
-			0x3f4166e80f38c200,
-			0x3f422f1b36f96400,
-			0x3f42f6e59fabb400,
-			0x3f43be474804e000,
-			0x3f4485402ebac000,
-			0x3f454bd05283de00,
-			0x3f4611f7b2177200,
-			0x3f46d7b64c2d5a00,
-			0x3f479d0c1f7e2c00,
-			0x3f4861f92ac32400,
-			0x3f49267d6cb62e00,
-			0x3f49ea98e411e400,
-			0x3f4aae4b8f918e00,
-			0x3f4b71956df11e00,
-			0x3f4c34767ded3600,
-			0x3f4cf6eebe432400,
-			0x3f4db8fe2db0ea00,
-			0x3f4e7aa4caf53000,
-			0x3f4f3be294cf4c00,
-			0x3f4ffcb789ff4800,
-			0x3f50bd23a945d200,
-			0x3f517d26f1645000,
-			0x3f523cc1611ccc00,
-			0x3f52fbf2f7320600,
-			0x3f53babbb2676600,
-			0x3f54791b91810400,
-			0x3f5537129343a200,
-			0x3f55f4a0b674b600,
-			0x3f56b1c5f9da6000,
-			0x3f576e825c3b6c00,
-			0x3f582ad5dc5f5800,
-			0x3f58e6c0790e4a00,
-			0x3f59a24231111c00,
-			0x3f5a5d5b03315200,
-			0x3f5b180aee391c00,
-			0x3f5bd251f0f35c00,
-			0x3f5c8c300a2ba000,
-			0x3f5d45a538ae2200,
-			0x3f5dfeb17b47ce00,
-			0x3f5eb754d0c63600,
-			0x3f5f6f8f37f7a400,
-			0x3f602760afab0600,
-			0x3f60dec936affe00,
-			0x3f6195c8cbd6dc00,
-			0x3f624c5f6df09800,
-			0x3f63028d1bcede00,
-			0x3f63b851d4440200,
-			0x3f646dad96230e00,
-			0x3f6522a0603fb000,
-			0x3f65d72a316e4c00,
-			0x3f668b4b0883ee00,
-			0x3f673f02e4565400,
-			0x3f67f251c3bbea00,
-			0x3f68a537a58bc200,
-			0x3f6957b4889da800,
-			0x3f6a09c86bca0c00,
-			0x3f6abb734dea1000,
-			0x3f6b6cb52dd78600,
-			0x3f6c1d8e0a6ce800,
-			0x3f6ccdfde2856200,
-			0x3f6d7e04b4fcce00,
-			0x3f6e2da280afb400,
-			0x3f6edcd7447b4400,
-			0x3f6f8ba2ff3d6800,
-			0x3f703a05afd4aa00,
-			0x3f70e7ff55204c00,
-			0x3f71958fee003c00,
-			0x3f7242b779551000,
-			0x3f72ef75f6001600,
-			0x3f739bcb62e33e00,
-			0x3f7447b7bee13200,
-			0x3f74f33b08dd4200,
-			0x3f759e553fbb6e00,
-			0x3f76490662606600,
-			0x3f76f34e6fb18400,
-			0x3f779d2d6694d400,
-			0x3f7846a345f10e00,
-			0x3f78efb00cad9800,
-			0x3f799853b9b28600,
-			0x3f7a408e4be89c00,
-			0x3f7ae85fc2394800,
-			0x3f7b8fc81b8eaa00,
-			0x3f7c36c756d39000,
-			0x3f7cdd5d72f37200,
-			0x3f7d838a6eda7c00,
-			0x3f7e294e49758000,
-			0x3f7ecea901b20400,
-			0x3f7f739a967e3e00,
-			0x3f80182306c90e00,
-			0x3f80bc4251820200,
-			0x3f815ff875995600,
-			0x3f82034571fff800,
-			0x3f82a62945a78000,
-			0x3f8348a3ef823400,
-			0x3f83eab56e830c00,
-			0x3f848c5dc19dac00,
-			0x3f852d9ce7c66600,
-			0x3f85ce72dff23800,
-			0x3f866edfa916d200,
-			0x3f870ee3422a9200,
-			0x3f87ae7daa247e00,
-			0x3f884daedffc5200,
-			0x3f88ec76e2aa7600,
-			0x3f898ad5b127fc00,
-			0x3f8a28cb4a6eaa00,
-			0x3f8ac657ad78f200,
-			0x3f8b637ad941f200,
-			0x3f8c0034ccc57800,
-			0x3f8c9c8587000000,
-			0x3f8d386d06eeb600,
-			0x3f8dd3eb4b8f7400,
-			0x3f8e6f0053e0be00,
-			0x3f8f09ac1ee1ca00,
-			0x3f8fa3eeab927c00,
-			0x3f903dc7f8f36600,
-			0x3f90d7380605c800,
-			0x3f91703ed1cb9000,
-			0x3f9208dc5b475c00,
-			0x3f92a110a17c7400,
-			0x3f9338dba36ed200,
-			0x3f93d03d60232000,
-			0x3f946735d69eb200,
-			0x3f94fdc505e78c00,
-			0x3f9593eaed046200,
-			0x3f9629a78afc9200,
-			0x3f96befaded82c00,
-			0x3f9753e4e79ff000,
-			0x3f97e865a45d4800,
-			0x3f987c7d141a4e00,
-			0x3f99102b35e1ca00,
-			0x3f99a37008bf3400,
-			0x3f9a364b8bbeb000,
-			0x3f9ac8bdbded1400,
-			0x3f9b5ac69e57e000,
-			0x3f9bec662c0d4600,
-			0x3f9c7d9c661c2400,
-			0x3f9d0e694b940600,
-			0x3f9d9eccdb852800,
-			0x3f9e2ec715007800,
-			0x3f9ebe57f7178800,
-			0x3f9f4d7f80dca600,
-			0x3f9fdc3db162c000,
-			0x3fa06a9287bd8000,
-			0x3fa0f87e03013600,
-			0x3fa186002242e200,
-			0x3fa21318e4983400,
-			0x3fa29fc849178800,
-			0x3fa32c0e4ed7ec00,
-			0x3fa3b7eaf4f11a00,
-			0x3fa4435e3a7b7a00,
-			0x3fa4ce681e902600,
-			0x3fa55908a048e200,
-			0x3fa5e33fbec02400,
-			0x3fa66d0d79110c00,
-			0x3fa6f671ce577000,
-			0x3fa77f6cbdafcc00,
-			0x3fa807fe46375200,
-			0x3fa89026670bde00,
-			0x3fa917e51f4bfa00,
-			0x3fa99f3a6e16e000,
-			0x3faa2626528c7c00,
-			0x3faaaca8cbcd6400,
-			0x3fab32c1d8fadc00,
-			0x3fabb8717936da00,
-			0x3fac3db7aba40000,
-			0x3facc2946f65a200,
-			0x3fad4707c39fbe00,
-			0x3fadcb11a7770200,
-			0x3fae4eb21a10ce00,
-			0x3faed1e91a932a00,
-			0x3faf54b6a824d400,
-			0x3fafd71ac1ed3400,
-			0x3fb0591567146200,
-			0x3fb0daa696c32600,
-			0x3fb15bce5022f000,
-			0x3fb1dc8c925de800,
-			0x3fb25ce15c9ede00,
-			0x3fb2dcccae115400,
-			0x3fb35c4e85e17a00,
-			0x3fb3db66e33c2e00,
-			0x3fb45a15c54efa00,
-			0x3fb4d85b2b481e00,
-			0x3fb5563714568000,
-			0x3fb5d3a97fa9bc00,
-			0x3fb650b26c721800,
-			0x3fb6cd51d9e08a00,
-			0x3fb74987c726b800,
-			0x3fb7c5543376f400,
-			0x3fb840b71e044200,
-			0x3fb8bbb086025200,
-			0x3fb936406aa58400,
-			0x3fb9b066cb22e600,
-			0x3fba2a23a6b03600,
-			0x3fbaa376fc83de00,
-			0x3fbb1c60cbd4fa00,
-			0x3fbb94e113db5200,
-			0x3fbc0cf7d3cf6000,
-			0x3fbc84a50aea4a00,
-			0x3fbcfbe8b865e600,
-			0x3fbd72c2db7cb600,
-			0x3fbde9337369f000,
-			0x3fbe5f3a7f697400,
-			0x3fbed4d7feb7d200,
-			0x3fbf4a0bf0924a00,
-			0x3fbfbed65436cc00,
-			0x3fc0333728e3f400,
-			0x3fc0a72e6dd90c00,
-			0x3fc11abc22560e00,
-			0x3fc18de0459ba600,
-			0x3fc2009ad6eb2c00,
-			0x3fc272ebd586a600,
-			0x3fc2e4d340b0c800,
-			0x3fc3565117acfa00,
-			0x3fc3c76559bf4c00,
-			0x3fc43810062c8200,
-			0x3fc4a8511c3a0c00,
-			0x3fc518289b2e0a00,
-			0x3fc58796824f4c00,
-			0x3fc5f69ad0e54e00,
-			0x3fc6653586383e00,
-			0x3fc6d366a190f600,
-			0x3fc7412e22390000,
-			0x3fc7ae8c077a9600,
-			0x3fc81b8050a0a000,
-			0x3fc8880afcf6b200,
-			0x3fc8f42c0bc91400,
-			0x3fc95fe37c64ba00,
-			0x3fc9cb314e174800,
-			0x3fca3615802f0e00,
-			0x3fcaa09011fb1000,
-			0x3fcb0aa102cafc00,
-			0x3fcb744851ef3200,
-			0x3fcbdd85feb8c000,
-			0x3fcc465a08796000,
-			0x3fccaec46e838200,
-			0x3fcd16c5302a3e00,
-			0x3fcd7e5c4cc15e00,
-			0x3fcde589c39d5a00,
-			0x3fce4c4d94135c00,
-			0x3fceb2a7bd793600,
-			0x3fcf18983f257000,
-			0x3fcf7e1f186f3e00,
-			0x3fcfe33c48ae8400,
-			0x3fd047efcf3bd200,
-			0x3fd0ac39ab706a00,
-			0x3fd11019dca63e00,
-			0x3fd173906237ea00,
-			0x3fd1d69d3b80be00,
-			0x3fd2394067dcb600,
-			0x3fd29b79e6a87e00,
-			0x3fd2fd49b7417200,
-			0x3fd35eafd9059a00,
-			0x3fd3bfac4b53b200,
-			0x3fd4203f0d8b1e00,
-			0x3fd480681f0bf800,
-			0x3fd4e0277f370600,
-			0x3fd53f7d2d6dbc00,
-			0x3fd59e6929123c00,
-			0x3fd5fceb71875c00,
-			0x3fd65b0406309e00,
-			0x3fd6b8b2e6723200,
-			0x3fd715f811b0f600,
-			0x3fd772d387527e00,
-			0x3fd7cf4546bd0400,
-			0x3fd82b4d4f577600,
-			0x3fd886eba0897200,
-			0x3fd8e22039bb4200,
-			0x3fd93ceb1a55e000,
-			0x3fd9974c41c2f600,
-			0x3fd9f143af6cdc00,
-			0x3fda4ad162be9a00,
-			0x3fdaa3f55b23e600,
-			0x3fdafcaf98092800,
-			0x3fdb550018db7200,
-			0x3fdbace6dd088800,
-			0x3fdc0463e3fede00,
-			0x3fdc5b772d2d9600,
-			0x3fdcb220b8048000,
-			0x3fdd086083f41c00,
-			0x3fdd5e36906d9c00,
-			0x3fddb3a2dce2dc00,
-			0x3fde08a568c66a00,
-			0x3fde5d3e338b8200,
-			0x3fdeb16d3ca61200,
-			0x3fdf0532838ab200,
-			0x3fdf588e07aeac00,
-			0x3fdfab7fc887fc00,
-			0x3fdffe07c58d4800,
-			0x3fe05025fe35e800,
-			0x3fe0a1da71f9e200,
-			0x3fe0f3252051ea00,
-			0x3fe1440608b76800,
-			0x3fe1947d2aa47000,
-			0x3fe1e48a8593c200,
-			0x3fe2342e1900d000,
-			0x3fe28367e467c000,
-			0x3fe2d237e7455e00,
-			0x3fe3209e21172a00,
-			0x3fe36e9a915b5600,
-			0x3fe3bc2d3790be00,
-			0x3fe409561336ee00,
-			0x3fe4561523ce2200,
-			0x3fe4a26a68d74a00,
-			0x3fe4ee55e1d3fc00,
-			0x3fe539d78e468400,
-			0x3fe584ef6db1da00,
-			0x3fe5cf9d7f99a600,
-			0x3fe619e1c3824200,
-			0x3fe663bc38f0b200,
-			0x3fe6ad2cdf6aac00,
-			0x3fe6f633b6769800,
-			0x3fe73ed0bd9b8600,
-			0x3fe78703f4613c00,
-			0x3fe7cecd5a502c00,
-			0x3fe8162ceef17800,
-			0x3fe85d22b1cef200,
-			0x3fe8a3aea2731800,
-			0x3fe8e9d0c0691c00,
-			0x3fe92f890b3cdc00,
-			0x3fe974d7827ae600,
-			0x3fe9b9bc25b07600,
-			0x3fe9fe36f46b7a00,
-			0x3fea4247ee3a8c00,
-			0x3fea85ef12acfa00,
-			0x3feac92c6152ba00,
-			0x3feb0bffd9bc7a00,
-			0x3feb4e697b7b8e00,
-			0x3feb906946220200,
-			0x3febd1ff39428c00,
-			0x3fec132b54709000,
-			0x3fec53ed97402600,
-			0x3fec944601461400,
-			0x3fecd4349217cc00,
-			0x3fed13b9494b7400,
-			0x3fed52d42677da00,
-			0x3fed918529348600,
-			0x3fedcfcc5119a600,
-			0x3fee0da99dc01a00,
-			0x3fee4b1d0ec17400,
-			0x3fee8826a3b7f200,
-			0x3feec4c65c3e8200,
-			0x3fef00fc37f0c400,
-			0x3fef3cc8366b0200,
-			0x3fef782a574a3a00,
-			0x3fefb3229a2c1800,
-			0x3fefedb0feaef600,
-			0x3ff027d58471de00,
-			0x3ff061902b148c00,
-			0x3ff09ae0f2376600,
-			0x3ff0d3c7d97b8400,
-			0x3ff10c44e082b000,
-			0x3ff1445806ef5e00,
-			0x3ff17c014c64b800,
-			0x3ff1b340b0868e00,
-			0x3ff1ea1632f96a00,
-			0x3ff22081d3627c00,
-			0x3ff256839167aa00,
-			0x3ff28c1b6caf8600,
-			0x3ff2c14964e15200,
-			0x3ff2f60d79a4fe00,
-			0x3ff32a67aaa32e00,
-			0x3ff35e57f7852e00,
-			0x3ff391de5ff50000,
-			0x3ff3c4fae39d5400,
-			0x3ff3f7ad82298400,
-			0x3ff429f63b45a000,
-			0x3ff45bd50e9e6400,
-			0x3ff48d49fbe13e00,
-			0x3ff4be5502bc4800,
-			0x3ff4eef622de4a00,
-			0x3ff51f2d5bf6c400,
-			0x3ff54efaadb5dc00,
-			0x3ff57e5e17cc6a00,
-			0x3ff5ad5799ebf800,
-			0x3ff5dbe733c6be00,
-			0x3ff60a0ce50fa200,
-			0x3ff637c8ad7a3c00,
-			0x3ff6651a8cbad000,
-			0x3ff6920282865200,
-			0x3ff6be808e926800,
-			0x3ff6ea94b0956600,
-			0x3ff7163ee8465000,
-			0x3ff7417f355cd800,
-			0x3ff76c5597915e00,
-			0x3ff796c20e9cf600,
-			0x3ff7c0c49a396000,
-			0x3ff7ea5d3a210c00,
-			0x3ff8138bee0f1800,
-			0x3ff83c50b5bf5600,
-			0x3ff864ab90ee4200,
-			0x3ff88c9c7f590a00,
-			0x3ff8b42380bd8c00,
-			0x3ff8db4094da5200,
-			0x3ff901f3bb6e9c00,
-			0x3ff9283cf43a5400,
-			0x3ff94e1c3efe1200,
-			0x3ff973919b7b2200,
-			0x3ff9989d09737e00,
-			0x3ff9bd3e88a9ce00,
-			0x3ff9e17618e16c00,
-			0x3ffa0543b9de5c00,
-			0x3ffa28a76b655a00,
-			0x3ffa4ba12d3bc800,
-			0x3ffa6e30ff27c000,
-			0x3ffa9056e0f00400,
-			0x3ffab212d25c0c00,
-			0x3ffad364d333f800,
-			0x3ffaf44ce340a000,
-			0x3ffb14cb024b8400,
-			0x3ffb34df301eda00,
-			0x3ffb54896c858000,
-			0x3ffb73c9b74b0800,
-			0x3ffb92a0103bb400,
-			0x3ffbb10c77247400,
-			0x3ffbcf0eebd2e800,
-			0x3ffbeca76e155e00,
-			0x3ffc09d5fdbad600,
-			0x3ffc269a9a92fc00,
-			0x3ffc42f5446e2e00,
-			0x3ffc5ee5fb1d7a00,
-			0x3ffc7a6cbe729a00,
-			0x3ffc95898e3ffc00,
-			0x3ffcb03c6a58ba00,
-			0x3ffcca8552909c00,
-			0x3ffce46446bc2200,
-			0x3ffcfdd946b07000,
-			0x3ffd16e452436000,
-			0x3ffd2f85694b7c00,
-			0x3ffd47bc8b9ffc00,
-			0x3ffd5f89b918c400,
-			0x3ffd76ecf18e6e00,
-			0x3ffd8de634da3e00,
-			0x3ffda47582d62c00,
-			0x3ffdba9adb5cda00,
-			0x3ffdd0563e499c00,
-			0x3ffde5a7ab787a00,
-			0x3ffdfa8f22c62400,
-			0x3ffe0f0ca40ffe00,
-			0x3ffe23202f341a00,
-			0x3ffe36c9c4113a00,
-			0x3ffe4a096286ce00,
-			0x3ffe5cdf0a74f800,
-			0x3ffe6f4abbbc8800,
-			0x3ffe814c763efe00,
-			0x3ffe92e439de8600,
-			0x3ffea412067e0200,
-			0x3ffeb4d5dc00fe00,
-			0x3ffec52fba4bb800,
-			0x3ffed51fa1431e00,
-			0x3ffee4a590ccca00,
-			0x3ffef3c188cf0800,
-			0x3fff02738930d600,
-			0x3fff10bb91d9dc00,
-			0x3fff1e99a2b27400,
-			0x3fff2c0dbba3aa00,
-			0x3fff3917dc973600,
-			0x3fff45b805778000,
-			0x3fff51ee362fa000,
-			0x3fff5dba6eab5e00,
-			0x3fff691caed73000,
-			0x3fff7414f6a04000,
-			0x3fff7ea345f45e00,
-			0x3fff88c79cc21600,
-			0x3fff9281faf89600,
-			0x3fff9bd26087c800,
-			0x3fffa4b8cd603e00,
-			0x3fffad3541733a00,
-			0x3fffb547bcb2b000,
-			0x3fffbcf03f114200,
-			0x3fffc42ec8824200,
-			0x3fffcb0358f9b000,
-			0x3fffd16df06c3e00,
-			0x3fffd76e8ecf4c00,
-			0x3fffdd053418e800,
-			0x3fffe231e03fd200,
-			0x3fffe6f4933b7a00,
-			0x3fffeb4d4d03fe00,
-			0x3fffef3c0d922800,
-			0x3ffff2c0d4df7800,
-			0x3ffff5dba2e61a00,
-			0x3ffff88c77a0ea00,
-			0x3ffffad3530b7200,
-			0x3ffffcb03521ee00,
-			0x3ffffe231de14a00,
-			0x3fffff2c0d471c00,
-			0x3fffffcb0351b200,
-			0x4000000000000000,
-			0x3fffffcb0351b200,
-			0x3fffff2c0d471c00,
-			0x3ffffe231de14a00,
-			0x3ffffcb03521ee00,
-			0x3ffffad3530b7200,
-			0x3ffff88c77a0ea00,
-			0x3ffff5dba2e61a00,
-			0x3ffff2c0d4df7800,
-			0x3fffef3c0d922800,
-			0x3fffeb4d4d03fe00,
-			0x3fffe6f4933b7a00,
-			0x3fffe231e03fd200,
-			0x3fffdd053418e800,
-			0x3fffd76e8ecf4c00,
-			0x3fffd16df06c3e00,
-			0x3fffcb0358f9b000,
-			0x3fffc42ec8824200,
-			0x3fffbcf03f114200,
-			0x3fffb547bcb2b000,
-			0x3fffad3541733a00,
-			0x3fffa4b8cd603e00,
-			0x3fff9bd26087c800,
-			0x3fff9281faf89600,
-			0x3fff88c79cc21600,
-			0x3fff7ea345f45e00,
-			0x3fff7414f6a04000,
-			0x3fff691caed73000,
-			0x3fff5dba6eab5e00,
-			0x3fff51ee362fa000,
-			0x3fff45b805778000,
-			0x3fff3917dc973600,
-			0x3fff2c0dbba3aa00,
-			0x3fff1e99a2b27400,
-			0x3fff10bb91d9dc00,
-			0x3fff02738930d600,
-			0x3ffef3c188cf0800,
-			0x3ffee4a590ccca00,
-			0x3ffed51fa1431e00,
-			0x3ffec52fba4bb800,
-			0x3ffeb4d5dc00fe00,
-			0x3ffea412067e0200,
-			0x3ffe92e439de8600,
-			0x3ffe814c763efe00,
-			0x3ffe6f4abbbc8800,
-			0x3ffe5cdf0a74f800,
-			0x3ffe4a096286ce00,
-			0x3ffe36c9c4113a00,
-			0x3ffe23202f341a00,
-			0x3ffe0f0ca40ffe00,
-			0x3ffdfa8f22c62400,
-			0x3ffde5a7ab787a00,
-			0x3ffdd0563e499c00,
-			0x3ffdba9adb5cda00,
-			0x3ffda47582d62c00,
-			0x3ffd8de634da3e00,
-			0x3ffd76ecf18e6e00,
-			0x3ffd5f89b918c400,
-			0x3ffd47bc8b9ffc00,
-			0x3ffd2f85694b7c00,
-			0x3ffd16e452436000,
-			0x3ffcfdd946b07000,
-			0x3ffce46446bc2200,
-			0x3ffcca8552909e00,
-			0x3ffcb03c6a58ba00,
-			0x3ffc95898e3ffc00,
-			0x3ffc7a6cbe729a00,
-			0x3ffc5ee5fb1d7a00,
-			0x3ffc42f5446e2e00,
-			0x3ffc269a9a92fc00,
-			0x3ffc09d5fdbad600,
-			0x3ffbeca76e155e00,
-			0x3ffbcf0eebd2e800,
-			0x3ffbb10c77247400,
-			0x3ffb92a0103bb400,
-			0x3ffb73c9b74b0800,
-			0x3ffb54896c858000,
-			0x3ffb34df301eda00,
-			0x3ffb14cb024b8400,
-			0x3ffaf44ce340a000,
-			0x3ffad364d333f800,
-			0x3ffab212d25c0c00,
-			0x3ffa9056e0f00400,
-			0x3ffa6e30ff27c000,
-			0x3ffa4ba12d3bc800,
-			0x3ffa28a76b655a00,
-			0x3ffa0543b9de5c00,
-			0x3ff9e17618e16c00,
-			0x3ff9bd3e88a9ce00,
-			0x3ff9989d09737e00,
-			0x3ff973919b7b2200,
-			0x3ff94e1c3efe1200,
-			0x3ff9283cf43a5400,
-			0x3ff901f3bb6e9c00,
-			0x3ff8db4094da5200,
-			0x3ff8b42380bd8c00,
-			0x3ff88c9c7f590a00,
-			0x3ff864ab90ee4200,
-			0x3ff83c50b5bf5600,
-			0x3ff8138bee0f1800,
-			0x3ff7ea5d3a210c00,
-			0x3ff7c0c49a396000,
-			0x3ff796c20e9cf600,
-			0x3ff76c5597915e00,
-			0x3ff7417f355cd800,
-			0x3ff7163ee8465000,
-			0x3ff6ea94b0956600,
-			0x3ff6be808e926800,
-			0x3ff6920282865200,
-			0x3ff6651a8cbad000,
-			0x3ff637c8ad7a3c00,
-			0x3ff60a0ce50fa200,
-			0x3ff5dbe733c6be00,
-			0x3ff5ad5799ebf800,
-			0x3ff57e5e17cc6a00,
-			0x3ff54efaadb5dc00,
-			0x3ff51f2d5bf6c400,
-			0x3ff4eef622de4a00,
-			0x3ff4be5502bc4800,
-			0x3ff48d49fbe13e00,
-			0x3ff45bd50e9e6400,
-			0x3ff429f63b45a000,
-			0x3ff3f7ad82298400,
-			0x3ff3c4fae39d5400,
-			0x3ff391de5ff50000,
-			0x3ff35e57f7852e00,
-			0x3ff32a67aaa32e00,
-			0x3ff2f60d79a4fe00,
-			0x3ff2c14964e15200,
-			0x3ff28c1b6caf8600,
-			0x3ff256839167aa00,
-			0x3ff22081d3627c00,
-			0x3ff1ea1632f96a00,
-			0x3ff1b340b0868e00,
-			0x3ff17c014c64b800,
-			0x3ff1445806ef5e00,
-			0x3ff10c44e082b000,
-			0x3ff0d3c7d97b8400,
-			0x3ff09ae0f2376600,
-			0x3ff061902b148c00,
-			0x3ff027d58471de00,
-			0x3fefedb0feaef600,
-			0x3fefb3229a2c1800,
-			0x3fef782a574a3a00,
-			0x3fef3cc8366b0200,
-			0x3fef00fc37f0c400,
-			0x3feec4c65c3e8200,
-			0x3fee8826a3b7f200,
-			0x3fee4b1d0ec17400,
-			0x3fee0da99dc01a00,
-			0x3fedcfcc5119a600,
-			0x3fed918529348600,
-			0x3fed52d42677da00,
-			0x3fed13b9494b7400,
-			0x3fecd4349217cc00,
-			0x3fec944601461400,
-			0x3fec53ed97402800,
-			0x3fec132b54709000,
-			0x3febd1ff39428c00,
-			0x3feb906946220200,
-			0x3feb4e697b7b8e00,
-			0x3feb0bffd9bc7a00,
-			0x3feac92c6152ba00,
-			0x3fea85ef12acfa00,
-			0x3fea4247ee3a8c00,
-			0x3fe9fe36f46b7a00,
-			0x3fe9b9bc25b07600,
-			0x3fe974d7827ae600,
-			0x3fe92f890b3cdc00,
-			0x3fe8e9d0c0691c00,
-			0x3fe8a3aea2731a00,
-			0x3fe85d22b1cef200,
-			0x3fe8162ceef17800,
-			0x3fe7cecd5a502c00,
-			0x3fe78703f4613c00,
-			0x3fe73ed0bd9b8600,
-			0x3fe6f633b6769800,
-			0x3fe6ad2cdf6aac00,
-			0x3fe663bc38f0b200,
-			0x3fe619e1c3824200,
-			0x3fe5cf9d7f99a600,
-			0x3fe584ef6db1da00,
-			0x3fe539d78e468400,
-			0x3fe4ee55e1d3fc00,
-			0x3fe4a26a68d74a00,
-			0x3fe4561523ce2200,
-			0x3fe409561336ee00,
-			0x3fe3bc2d3790bc00,
-			0x3fe36e9a915b5600,
-			0x3fe3209e21172a00,
-			0x3fe2d237e7455e00,
-			0x3fe28367e467c000,
-			0x3fe2342e1900d200,
-			0x3fe1e48a8593c200,
-			0x3fe1947d2aa47000,
-			0x3fe1440608b76800,
-			0x3fe0f3252051ea00,
-			0x3fe0a1da71f9e200,
-			0x3fe05025fe35e800,
-			0x3fdffe07c58d4800,
-			0x3fdfab7fc887fc00,
-			0x3fdf588e07aeac00,
-			0x3fdf0532838ab200,
-			0x3fdeb16d3ca61200,
-			0x3fde5d3e338b8200,
-			0x3fde08a568c66a00,
-			0x3fddb3a2dce2dc00,
-			0x3fdd5e36906d9c00,
-			0x3fdd086083f41c00,
-			0x3fdcb220b8048000,
-			0x3fdc5b772d2d9600,
-			0x3fdc0463e3fede00,
-			0x3fdbace6dd088800,
-			0x3fdb550018db7200,
-			0x3fdafcaf98092800,
-			0x3fdaa3f55b23e800,
-			0x3fda4ad162be9a00,
-			0x3fd9f143af6cdc00,
-			0x3fd9974c41c2f600,
-			0x3fd93ceb1a55e000,
-			0x3fd8e22039bb4200,
-			0x3fd886eba0897200,
-			0x3fd82b4d4f577600,
-			0x3fd7cf4546bd0400,
-			0x3fd772d387527e00,
-			0x3fd715f811b0f600,
-			0x3fd6b8b2e6723200,
-			0x3fd65b0406309e00,
-			0x3fd5fceb71875c00,
-			0x3fd59e6929123c00,
-			0x3fd53f7d2d6dbc00,
-			0x3fd4e0277f370600,
-			0x3fd480681f0bf800,
-			0x3fd4203f0d8b1e00,
-			0x3fd3bfac4b53b200,
-			0x3fd35eafd9059a00,
-			0x3fd2fd49b7417200,
-			0x3fd29b79e6a87e00,
-			0x3fd2394067dcb600,
-			0x3fd1d69d3b80be00,
-			0x3fd173906237ea00,
-			0x3fd11019dca63e00,
-			0x3fd0ac39ab706a00,
-			0x3fd047efcf3bd200,
-			0x3fcfe33c48ae8400,
-			0x3fcf7e1f186f4000,
-			0x3fcf18983f257000,
-			0x3fceb2a7bd793600,
-			0x3fce4c4d94135c00,
-			0x3fcde589c39d5a00,
-			0x3fcd7e5c4cc15e00,
-			0x3fcd16c5302a3e00,
-			0x3fccaec46e838200,
-			0x3fcc465a08796200,
-			0x3fcbdd85feb8c000,
-			0x3fcb744851ef3200,
-			0x3fcb0aa102cafc00,
-			0x3fcaa09011fb1000,
-			0x3fca3615802f0e00,
-			0x3fc9cb314e174800,
-			0x3fc95fe37c64ba00,
-			0x3fc8f42c0bc91400,
-			0x3fc8880afcf6b200,
-			0x3fc81b8050a0a000,
-			0x3fc7ae8c077a9600,
-			0x3fc7412e22390200,
-			0x3fc6d366a190f600,
-			0x3fc6653586383e00,
-			0x3fc5f69ad0e54e00,
-			0x3fc58796824f4c00,
-			0x3fc518289b2e0a00,
-			0x3fc4a8511c3a0c00,
-			0x3fc43810062c8200,
-			0x3fc3c76559bf4c00,
-			0x3fc3565117acfa00,
-			0x3fc2e4d340b0c800,
-			0x3fc272ebd586a600,
-			0x3fc2009ad6eb2c00,
-			0x3fc18de0459ba800,
-			0x3fc11abc22560e00,
-			0x3fc0a72e6dd90c00,
-			0x3fc0333728e3f400,
-			0x3fbfbed65436cc00,
-			0x3fbf4a0bf0924a00,
-			0x3fbed4d7feb7d200,
-			0x3fbe5f3a7f697200,
-			0x3fbde9337369f000,
-			0x3fbd72c2db7cb600,
-			0x3fbcfbe8b865e600,
-			0x3fbc84a50aea4a00,
-			0x3fbc0cf7d3cf6000,
-			0x3fbb94e113db5200,
-			0x3fbb1c60cbd4fa00,
-			0x3fbaa376fc83de00,
-			0x3fba2a23a6b03600,
-			0x3fb9b066cb22e600,
-			0x3fb936406aa58400,
-			0x3fb8bbb086025200,
-			0x3fb840b71e044200,
-			0x3fb7c5543376f600,
-			0x3fb74987c726b800,
-			0x3fb6cd51d9e08a00,
-			0x3fb650b26c721800,
-			0x3fb5d3a97fa9bc00,
-			0x3fb5563714568000,
-			0x3fb4d85b2b481e00,
-			0x3fb45a15c54efa00,
-			0x3fb3db66e33c2c00,
-			0x3fb35c4e85e17a00,
-			0x3fb2dcccae115400,
-			0x3fb25ce15c9ede00,
-			0x3fb1dc8c925de800,
-			0x3fb15bce5022f000,
-			0x3fb0daa696c32600,
-			0x3fb0591567146400,
-			0x3fafd71ac1ed3600,
-			0x3faf54b6a824d600,
-			0x3faed1e91a932a00,
-			0x3fae4eb21a10ce00,
-			0x3fadcb11a7770200,
-			0x3fad4707c39fbe00,
-			0x3facc2946f65a200,
-			0x3fac3db7aba40200,
-			0x3fabb8717936da00,
-			0x3fab32c1d8fadc00,
-			0x3faaaca8cbcd6400,
-			0x3faa2626528c7c00,
-			0x3fa99f3a6e16e200,
-			0x3fa917e51f4bfa00,
-			0x3fa89026670bde00,
-			0x3fa807fe46375200,
-			0x3fa77f6cbdafce00,
-			0x3fa6f671ce577000,
-			0x3fa66d0d79110c00,
-			0x3fa5e33fbec02200,
-			0x3fa55908a048e200,
-			0x3fa4ce681e902600,
-			0x3fa4435e3a7b7a00,
-			0x3fa3b7eaf4f11a00,
-			0x3fa32c0e4ed7ec00,
-			0x3fa29fc849178800,
-			0x3fa21318e4983400,
-			0x3fa186002242e200,
-			0x3fa0f87e03013600,
-			0x3fa06a9287bd8000,
-			0x3f9fdc3db162c200,
-			0x3f9f4d7f80dca600,
-			0x3f9ebe57f7178a00,
-			0x3f9e2ec715007800,
-			0x3f9d9eccdb852800,
-			0x3f9d0e694b940600,
-			0x3f9c7d9c661c2400,
-			0x3f9bec662c0d4600,
-			0x3f9b5ac69e57e000,
-			0x3f9ac8bdbded1400,
-			0x3f9a364b8bbeb000,
-			0x3f99a37008bf3400,
-			0x3f99102b35e1ca00,
-			0x3f987c7d141a4e00,
-			0x3f97e865a45d4800,
-			0x3f9753e4e79ff000,
-			0x3f96befaded82c00,
-			0x3f9629a78afc9200,
-			0x3f9593eaed046200,
-			0x3f94fdc505e78c00,
-			0x3f946735d69eb200,
-			0x3f93d03d60232000,
-			0x3f9338dba36ed400,
-			0x3f92a110a17c7400,
-			0x3f9208dc5b475c00,
-			0x3f91703ed1cb9200,
-			0x3f90d7380605c800,
-			0x3f903dc7f8f36800,
-			0x3f8fa3eeab927c00,
-			0x3f8f09ac1ee1ca00,
-			0x3f8e6f0053e0be00,
-			0x3f8dd3eb4b8f7400,
-			0x3f8d386d06eeb800,
-			0x3f8c9c8587000000,
-			0x3f8c0034ccc57800,
-			0x3f8b637ad941f200,
-			0x3f8ac657ad78f200,
-			0x3f8a28cb4a6eac00,
-			0x3f898ad5b127fc00,
-			0x3f88ec76e2aa7600,
-			0x3f884daedffc5400,
-			0x3f87ae7daa247e00,
-			0x3f870ee3422a9200,
-			0x3f866edfa916d200,
-			0x3f85ce72dff23800,
-			0x3f852d9ce7c66600,
-			0x3f848c5dc19dae00,
-			0x3f83eab56e830e00,
-			0x3f8348a3ef823400,
-			0x3f82a62945a78000,
-			0x3f82034571fff800,
-			0x3f815ff875995600,
-			0x3f80bc4251820200,
-			0x3f80182306c90e00,
-			0x3f7f739a967e4000,
-			0x3f7ecea901b20400,
-			0x3f7e294e49758000,
-			0x3f7d838a6eda7c00,
-			0x3f7cdd5d72f37200,
-			0x3f7c36c756d39000,
-			0x3f7b8fc81b8eac00,
-			0x3f7ae85fc2394800,
-			0x3f7a408e4be89c00,
-			0x3f799853b9b28600,
-			0x3f78efb00cad9800,
-			0x3f7846a345f10c00,
-			0x3f779d2d6694d400,
-			0x3f76f34e6fb18400,
-			0x3f76490662606600,
-			0x3f759e553fbb6e00,
-			0x3f74f33b08dd4200,
-			0x3f7447b7bee13200,
-			0x3f739bcb62e33e00,
-			0x3f72ef75f6001400,
-			0x3f7242b779551200,
-			0x3f71958fee003c00,
-			0x3f70e7ff55204e00,
-			0x3f703a05afd4aa00,
-			0x3f6f8ba2ff3d6800,
-			0x3f6edcd7447b4600,
-			0x3f6e2da280afb200,
-			0x3f6d7e04b4fcce00,
-			0x3f6ccdfde2856200,
-			0x3f6c1d8e0a6ce800,
-			0x3f6b6cb52dd78600,
-			0x3f6abb734dea1000,
-			0x3f6a09c86bca0c00,
-			0x3f6957b4889da800,
-			0x3f68a537a58bc200,
-			0x3f67f251c3bbea00,
-			0x3f673f02e4565600,
-			0x3f668b4b0883f000,
-			0x3f65d72a316e4c00,
-			0x3f6522a0603fb000,
-			0x3f646dad96230c00,
-			0x3f63b851d4440200,
-			0x3f63028d1bcede00,
-			0x3f624c5f6df09800,
-			0x3f6195c8cbd6dc00,
-			0x3f60dec936b00000,
-			0x3f602760afab0600,
-			0x3f5f6f8f37f7a400,
-			0x3f5eb754d0c63600,
-			0x3f5dfeb17b47ce00,
-			0x3f5d45a538ae2200,
-			0x3f5c8c300a2ba000,
-			0x3f5bd251f0f35e00,
-			0x3f5b180aee391c00,
-			0x3f5a5d5b03315200,
-			0x3f59a24231111c00,
-			0x3f58e6c0790e4c00,
-			0x3f582ad5dc5f5800,
-			0x3f576e825c3b6c00,
-			0x3f56b1c5f9da6000,
-			0x3f55f4a0b674b800,
-			0x3f5537129343a400,
-			0x3f54791b91810400,
-			0x3f53babbb2676600,
-			0x3f52fbf2f7320800,
-			0x3f523cc1611ccc00,
-			0x3f517d26f1645000,
-			0x3f50bd23a945d200,
-			0x3f4ffcb789ff4800,
-			0x3f4f3be294cf4e00,
-			0x3f4e7aa4caf53000,
-			0x3f4db8fe2db0ea00,
-			0x3f4cf6eebe432400,
-			0x3f4c34767ded3400,
-			0x3f4b71956df11e00,
-			0x3f4aae4b8f918e00,
-			0x3f49ea98e411e600,
-			0x3f49267d6cb63000,
-			0x3f4861f92ac32400,
-			0x3f479d0c1f7e2e00,
-			0x3f46d7b64c2d5a00,
-			0x3f4611f7b2177200,
-			0x3f454bd05283de00,
-			0x3f4485402ebac000,
-			0x3f43be474804e000,
-			0x3f42f6e59fabb600,
-			0x3f422f1b36f96600,
-			0x3f4166e80f38c200,
-			0x3f409e4c29b54e00,
-			0x3f3fd54787bb3200,
-			0x3f3f0bda2a974e00,
-			0x3f3e420413972600,
-			0x3f3d77c54408f000,
-			0x3f3cad1dbd3b9400,
-			0x3f3be20d807e9c00,
-			0x3f3b16948f224a00,
-			0x3f3a4ab2ea778800,
-			0x3f397e6893cfec00,
-			0x3f38b1b58c7dc000,
-			0x3f37e499d5d3f600,
-			0x3f37171571263000,
-			0x3f3649285fc8b800,
-			0x3f357ad2a3108c00,
-			0x3f34ac143c535400,
-			0x3f33dced2ce76600,
-			0x3f330d5d7623c400,
-			0x3f323d6519602200,
-			0x3f316d0417f4dc00,
-			0x3f309c3a733afa00,
-			0x3f2fcb082c8c3800,
-			0x3f2ef96d4542fc00,
-			0x3f2e2769beba5400,
-			0x3f2d54fd9a4e0600,
-			0x3f2c8228d95a7c00,
-			0x3f2baeeb7d3cd200,
-			0x3f2adb458752ce00,
-			0x3f2a0736f8fae400,
-			0x3f2932bfd3943a00,
-			0x3f285de0187e9e00,
-			0x3f278897c91a8800,
-			0x3f26b2e6e6c92a00,
-			0x3f25dccd72ec5200,
-			0x3f25064b6ee68a00,
-			0x3f242f60dc1b0200,
-			0x3f23580dbbed9600,
-			0x3f2280520fc2d400,
-			0x3f21a82dd8fff000,
-			0x3f20cfa1190ad600,
-			0x3f1ff6abd14a1400,
-			0x3f1f1d4e0324ec00,
-			0x3f1e4387b0034a00,
-			0x3f1d6958d94dc600,
-			0x3f1c8ec1806daa00,
-			0x3f1bb3c1a6cce800,
-			0x3f1ad8594dd62200,
-			0x3f19fc8876f4a800,
-			0x3f19204f23947000,
-			0x3f1843ad55222800,
-			0x3f1766a30d0b2000,
-			0x3f1689304cbd5c00,
-			0x3f15ab5515a78c00,
-			0x3f14cd1169390c00,
-			0x3f13ee6548e1e400,
-			0x3f130f50b612ca00,
-			0x3f122fd3b23d2200,
-			0x3f114fee3ed2fc00,
-			0x3f106fa05d471200,
-			0x3f0f8eea0f0cd200,
-			0x3f0eadcb55984e00,
-			0x3f0dcc44325e4e00,
-			0x3f0cea54a6d44000,
-			0x3f0c07fcb4704200,
-			0x3f0b253c5ca91c00,
-			0x3f0a4213a0f64800,
-			0x3f095e8282cfea00,
-			0x3f087a8903aed000,
-			0x3f079627250c7a00,
-			0x3f06b15ce8631200,
-			0x3f05cc2a4f2d6e00,
-			0x3f04e68f5ae71200,
-			0x3f04008c0d0c3000,
-			0x3f031a206719a800,
-			0x3f02334c6a8d0000,
-			0x3f014c1018e46e00,
-			0x3f00646b739edc00,
-			0x3eff7c5e7c3bd600,
-			0x3efe93e9343b9c00,
-			0x3efdab0b9d1f1600,
-			0x3efcc1c5b867dc00,
-			0x3efbd81787983200,
-			0x3efaee010c330600,
-			0x3efa038247bbfa00,
-			0x3ef9189b3bb75000,
-			0x3ef82d4be9aa0600,
-			0x3ef741945319ba00,
-			0x3ef65574798cbc00,
-			0x3ef568ec5e8a0c00,
-			0x3ef47bfc03994e00,
-			0x3ef38ea36a42da00,
-			0x3ef2a0e2940fb400,
-			0x3ef1b2b982898600,
-			0x3ef0c428373ab000,
-			0x3eefd52eb3ae3600,
-			0x3eeee5ccf96fd000,
-			0x3eedf6030a0bde00,
-			0x3eed05d0e70f6a00,
-			0x3eec153692083400,
-			0x3eeb24340c849c00,
-			0x3eea32c95813bc00,
-			0x3ee940f676455000,
-			0x3ee84ebb68a9c400,
-			0x3ee75c1830d23400,
-			0x3ee6690cd0506000,
-			0x3ee5759948b6bc00,
-			0x3ee481bd9b986800,
-			0x3ee38d79ca892c00,
-			0x3ee298cdd71d8000,
-			0x3ee1a3b9c2ea8800,
-			0x3ee0ae3d8f861400,
-			0x3edfb8593e869c00,
-			0x3edec20cd1834e00,
-			0x3eddcb584a13fe00,
-			0x3edcd43ba9d12a00,
-			0x3edbdcb6f2540400,
-			0x3edae4ca25366400,
-			0x3ed9ec754412d200,
-			0x3ed8f3b850848000,
-			0x3ed7fa934c274a00,
-			0x3ed701063897c000,
-			0x3ed6071117731800,
-			0x3ed50cb3ea573600,
-			0x3ed411eeb2e2ac00,
-			0x3ed316c172b4b200,
-			0x3ed21b2c2b6d3800,
-			0x3ed11f2edeaccc00,
-			0x3ed022c98e14b400,
-			0x3ecf25fc3b46dc00,
-			0x3ece28c6e7e5de00,
-			0x3ecd2b2995950000,
-			0x3ecc2d2445f83400,
-			0x3ecb2eb6fab41a00,
-			0x3eca2fe1b56dfa00,
-			0x3ec930a477cbce00,
-			0x3ec830ff43743600,
-			0x3ec730f21a0e8200,
-			0x3ec6307cfd42ae00,
-			0x3ec52f9feeb96000,
-			0x3ec42e5af01bee00,
-			0x3ec32cae03145600,
-			0x3ec22a99294d4200,
-			0x3ec1281c64720e00,
-			0x3ec02537b62eb800,
-			0x3ebf21eb202ff400,
-			0x3ebe1e36a4232000,
-			0x3ebd1a1a43b63e00,
-			0x3ebc159600980600,
-			0x3ebb10a9dc77d800,
-			0x3eba0b55d905be00,
-			0x3eb90599f7f27000,
-			0x3eb7ff763aef5600,
-			0x3eb6f8eaa3ae7e00,
-			0x3eb5f1f733e2a000,
-			0x3eb4ea9bed3f2a00,
-			0x3eb3e2d8d1782a00,
-			0x3eb2daade2426600,
-			0x3eb1d21b21534600,
-			0x3eb0c9209060e000,
-			0x3eafbfbe3121fa00,
-			0x3eaeb5f4054e0400,
-			0x3eadabc20e9d1800,
-			0x3eaca1284ec7fe00,
-			0x3eab9626c7882a00,
-			0x3eaa8abd7a97b800,
-			0x3ea97eec69b17200,
-			0x3ea872b39690d200,
-			0x3ea7661302f1f800,
-			0x3ea6590ab091b400,
-			0x3ea54b9aa12d7e00,
-			0x3ea43dc2d6837e00,
-			0x3ea32f8352528200,
-			0x3ea220dc165a0800,
-			0x3ea111cd245a3c00,
-			0x3ea002567e13f200,
-			0x3e9ef2782548a600,
-			0x3e9de2321bba8800,
-			0x3e9cd184632c6e00,
-			0x3e9bc06efd61dc00,
-			0x3e9aaef1ec1f0200,
-			0x3e999d0d3128ba00,
-			0x3e988ac0ce448a00,
-			0x3e97780cc538a400,
-			0x3e9664f117cbe800,
-			0x3e95516dc7c5de00,
-			0x3e943d82d6eeb800,
-			0x3e932930470f5a00,
-			0x3e92147619f14e00,
-			0x3e90ff54515ece00,
-			0x3e8fe9caef22ba00,
-			0x3e8ed3d9f508a600,
-			0x3e8dbd8164dcc600,
-			0x3e8ca6c1406c0400,
-			0x3e8b8f998983f000,
-			0x3e8a780a41f2c600,
-			0x3e8960136b877000,
-			0x3e8847b508118200,
-			0x3e872eef19613800,
-			0x3e8615c1a1478000,
-			0x3e84fc2ca195ee00,
-			0x3e83e2301c1ec600,
-			0x3e82c7cc12b4f400,
-			0x3e81ad00872c1000,
-			0x3e8091cd7b585c00,
-			0x3e7f7632f10eca00,
-			0x3e7e5a30ea24f400,
-			0x3e7d3dc768712000,
-			0x3e7c20f66dca3c00,
-			0x3e7b03bdfc07ea00,
-			0x3e79e61e15026e00,
-			0x3e78c816ba92bc00,
-			0x3e77a9a7ee927400,
-			0x3e768ad1b2dbde00,
-			0x3e756b940949f000,
-			0x3e744beef3b84800,
-			0x3e732be274033800,
-			0x3e720b6e8c07ae00,
-			0x3e70ea933da35400,
-			0x3e6fc9508ab47400,
-			0x3e6ea7a6751a0200,
-			0x3e6d8594feb3aa00,
-			0x3e6c631c2961b400,
-			0x3e6b403bf7051e00,
-			0x3e6a1cf4697f8e00,
-			0x3e68f94582b35000,
-			0x3e67d52f44836200,
-			0x3e66b0b1b0d36a00,
-			0x3e658bccc987ba00,
-			0x3e64668090854e00,
-			0x3e6340cd07b1ce00,
-			0x3e621ab230f39000,
-			0x3e60f4300e318c00,
-			0x3e5fcd46a1537000,
-			0x3e5ea5f5ec418e00,
-			0x3e5d7e3df0e4e600,
-			0x3e5c561eb1272200,
-			0x3e5b2d982ef29400,
-			0x3e5a04aa6c324000,
-			0x3e58db556ad1ce00,
-			0x3e57b1992cbd9600,
-			0x3e568775b3e29a00,
-			0x3e555ceb022e8200,
-			0x3e5431f9198fa800,
-			0x3e53069ffbf50a00,
-			0x3e51dadfab4e5a00,
-			0x3e50aeb8298bec00,
-			0x3e4f8229789ec000,
-			0x3e4e55339a788a00,
-			0x3e4d27d6910b9a00,
-			0x3e4bfa125e4afa00,
-			0x3e4acbe7042a5400,
-			0x3e499d54849dfe00,
-			0x3e486e5ae19b0200,
-			0x3e473efa1d170600,
-			0x3e460f3239086a00,
-			0x3e44df0337662e00,
-			0x3e43ae6d1a280000,
-			0x3e427d6fe3463c00,
-			0x3e414c0b94b9e000,
-			0x3e401a40307ca200,
-			0x3e3ee80db888d400,
-			0x3e3db5742ed97e00,
-			0x3e3c8273956a4e00,
-			0x3e3b4f0bee379e00,
-			0x3e3a1b3d3b3e6e00,
-			0x3e38e7077e7c7000,
-			0x3e37b26ab9effc00,
-			0x3e367d66ef981600,
-			0x3e3547fc21746a00,
-			0x3e34122a51855400,
-			0x3e32dbf181cbd600,
-			0x3e31a551b4499e00,
-			0x3e306e4aeb010600,
-			0x3e2f36dd27f50c00,
-			0x3e2dff086d296200,
-			0x3e2cc6ccbca25e00,
-			0x3e2b8e2a18650400,
-			0x3e2a552082770200,
-			0x3e291baffcdeac00,
-			0x3e27e1d889a30600,
-			0x3e26a79a2acbba00,
-			0x3e256cf4e2612200,
-			0x3e2431e8b26c3c00,
-			0x3e22f6759cf6b800,
-			0x3e21ba9ba40ae800,
-			0x3e207e5ac9b3cc00,
-			0x3e1f41b30ffd1200,
-			0x3e1e04a478f30a00,
-			0x3e1cc72f06a2b800,
-			0x3e1b8952bb19c400,
-			0x3e1a4b0f98668000,
-			0x3e190c65a097ec00,
-			0x3e17cd54d5bdb000,
-			0x3e168ddd39e82000,
-			0x3e154dfecf283800,
-			0x3e140db9978fa000,
-			0x3e12cd0d9530a800,
-			0x3e118bfaca1e4a00,
-			0x3e104a81386c3000,
-			0x3e0f08a0e22ea600,
-			0x3e0dc659c97aaa00,
-			0x3e0c83abf065de00,
-			0x3e0b409759069000,
-			0x3e09fd1c0573bc00,
-			0x3e08b939f7c4fe00,
-			0x3e0774f13212aa00,
-			0x3e063041b675b600,
-			0x3e04eb2b8707bc00,
-			0x3e03a5aea5e31000,
-			0x3e025fcb1522a000,
-			0x3e011980d6e21000,
-			0x3dffd2cfed3da800,
-			0x3dfe8bb85a525800,
-			0x3dfd443a203dc200,
-			0x3dfbfc55411e2800,
-			0x3dfab409bf127e00,
-			0x3df96b579c3a6200,
-			0x3df8223edab61200,
-			0x3df6d8bf7ca68200,
-			0x3df58ed9842d4800,
-			0x3df4448cf36ca800,
-			0x3df2f9d9cc878e00,
-			0x3df1aec011a19200,
-			0x3df0633fc4def400,
-			0x3def1758e8649c00,
-			0x3dedcb0b7e582000,
-			0x3dec7e5788dfbc00,
-			0x3deb313d0a225a00,
-			0x3de9e3bc04478a00,
-			0x3de895d479778400,
-			0x3de747866bdb3200,
-			0x3de5f8d1dd9c2000,
-			0x3de4a9b6d0e48600,
-			0x3de35a3547df4800,
-			0x3de20a4d44b7ee00,
-			0x3de0b9fec99ab400,
-			0x3ddf6949d8b47000,
-			0x3dde182e7432b400,
-			0x3ddcc6ac9e43ae00,
-			0x3ddb74c459163800,
-			0x3dda2275a6d9dc00,
-			0x3dd8cfc089bec400,
-			0x3dd77ca503f5d000,
-			0x3dd6292317b07a00,
-			0x3dd4d53ac720f600,
-			0x3dd380ec147a1400,
-			0x3dd22c3701ef5600,
-			0x3dd0d71b91b4e200,
-			0x3dcf8199c5ff8c00,
-			0x3dce2bb1a104d200,
-			0x3dccd56324fad400,
-			0x3dcb7eae54186000,
-			0x3dca27933094f400,
-			0x3dc8d011bca8ac00,
-			0x3dc77829fa8c5600,
-			0x3dc61fdbec796400,
-			0x3dc4c72794a9f400,
-			0x3dc36e0cf558d000,
-			0x3dc2148c10c16200,
-			0x3dc0baa4e91fca00,
-			0x3dbf605780b0c600,
-			0x3dbe05a3d9b1c600,
-			0x3dbcaa89f660de00,
-			0x3dbb4f09d8fccc00,
-			0x3db9f32383c4fc00,
-			0x3db896d6f8f97800,
-			0x3db73a243adb0200,
-			0x3db5dd0b4baafc00,
-			0x3db47f8c2dab7000,
-			0x3db321a6e31f1800,
-			0x3db1c35b6e495200,
-			0x3db064a9d16e2600,
-			0x3daf05920ed24800,
-			0x3dada61428bb0e00,
-			0x3dac4630216e8200,
-			0x3daae5e5fb334c00,
-			0x3da98535b850c800,
-			0x3da8241f5b0ef000,
-			0x3da6c2a2e5b67000,
-			0x3da560c05a909800,
-			0x3da3fe77bbe76000,
-			0x3da29bc90c057000,
-			0x3da138b44d361400,
-			0x3d9fd53981c53e00,
-			0x3d9e7158abff9000,
-			0x3d9d0d11ce324e00,
-			0x3d9ba864eaab6e00,
-			0x3d9a435203b98200,
-			0x3d98ddd91babd200,
-			0x3d9777fa34d24800,
-			0x3d9611b5517d7600,
-			0x3d94ab0a73fe9c00,
-			0x3d9343f99ea79e00,
-			0x3d91dc82d3cb0a00,
-			0x3d9074a615bc1a00,
-			0x3d8f0c6366cea800,
-			0x3d8da3bac9574600,
-			0x3d8c3aac3fab1e00,
-			0x3d8ad137cc201200,
-			0x3d89675d710ca000,
-			0x3d87fd1d30c7f400,
-			0x3d8692770da9e600,
-			0x3d85276b0a0af000,
-			0x3d83bbf928443e00,
-			0x3d8250216aaf9800,
-			0x3d80e3e3d3a77800,
-			0x3d7f774065870200,
-			0x3d7e0a3722a9fa00,
-			0x3d7c9cc80d6cd400,
-			0x3d7b2ef3282ca800,
-			0x3d79c0b875473c00,
-			0x3d785217f71afa00,
-			0x3d76e311b006f200,
-			0x3d7573a5a26ae400,
-			0x3d7403d3d0a73400,
-			0x3d72939c3d1cf200,
-			0x3d7122feea2dd000,
-			0x3d6fb1fbda3c2e00,
-			0x3d6e40930fab1400,
-			0x3d6ccec48cde2c00,
-			0x3d6b5c905439d400,
-			0x3d69e9f668230a00,
-			0x3d6876f6caff7400,
-			0x3d6703917f356800,
-			0x3d658fc6872bda00,
-			0x3d641b95e54a7000,
-			0x3d62a6ff9bf97000,
-			0x3d613203ada1cc00,
-			0x3d5fbca21cad2400,
-			0x3d5e46daeb85b600,
-			0x3d5cd0ae1c967000,
-			0x3d5b5a1bb24ae200,
-			0x3d59e323af0f4c00,
-			0x3d586bc615508e00,
-			0x3d56f402e77c3400,
-			0x3d557bda28007800,
-			0x3d54034bd94c2e00,
-			0x3d528a57fdcee200,
-			0x3d5110fe97f8be00,
-			0x3d4f973faa3a9600,
-			0x3d4e1d1b3705e800,
-			0x3d4ca29140ccd600,
-			0x3d4b27a1ca023400,
-			0x3d49ac4cd5197400,
-			0x3d4830926486b000,
-			0x3d46b4727abeb200,
-			0x3d4537ed1a36e400,
-			0x3d43bb0245656000,
-			0x3d423db1fec0de00,
-			0x3d40bffc48c0c600,
-			0x3d3f41e125dd2600,
-			0x3d3dc360988eb200,
-			0x3d3c447aa34eca00,
-			0x3d3ac52f48976e00,
-			0x3d39457e8ae35000,
-			0x3d37c5686cadc400,
-			0x3d3644ecf072c400,
-			0x3d34c40c18aef800,
-			0x3d3342c5e7dfa800,
-			0x3d31c11a6082ce00,
-			0x3d303f0985170400,
-			0x3d2ebc93581b8a00,
-			0x3d2d39b7dc105200,
-			0x3d2bb6771375ea00,
-			0x3d2a32d100cd9200,
-			0x3d28aec5a6992800,
-			0x3d272a55075b3800,
-			0x3d25a57f2596f600,
-			0x3d24204403d03a00,
-			0x3d229aa3a48b8800,
-			0x3d21149e0a4e0800,
-			0x3d1f8e33379d8a00,
-			0x3d1e07632f008800,
-			0x3d1c802df2fe1e00,
-			0x3d1af893861e1800,
-			0x3d197093eae8e400,
-			0x3d17e82f23e79800,
-			0x3d165f6533a3f400,
-			0x3d14d6361ca85c00,
-			0x3d134ca1e17fdc00,
-			0x3d11c2a884b62a00,
-			0x3d10384a08d7a400,
-			0x3d0ead8670714c00,
-			0x3d0d225dbe10cc00,
-			0x3d0b96cff4447800,
-			0x3d0a0add159b4800,
-			0x3d087e8524a4e000,
-			0x3d06f1c823f18800,
-			0x3d0564a616122a00,
-			0x3d03d71efd986600,
-			0x3d024932dd167400,
-			0x3d00bae1b71f4000,
-			0x3cff2c2b8e465200,
-			0x3cfd9d10651fde00,
-			0x3cfc0d903e40c400,
-			0x3cfa7dab1c3e8000,
-			0x3cf8ed6101af4400,
-			0x3cf75cb1f129da00,
-			0x3cf5cb9ded45c200,
-			0x3cf43a24f89b1600,
-			0x3cf2a84715c29c00,
-			0x3cf116044755c600,
-			0x3cef835c8feea400,
-			0x3cedf04ff227f800,
-			0x3cec5cde709d2200,
-			0x3ceac9080dea2a00,
-			0x3ce934ccccabc400,
-			0x3ce7a02caf7f4800,
-			0x3ce60b27b902b200,
-			0x3ce475bdebd4ae00,
-			0x3ce2dfef4a948600,
-			0x3ce149bbd7e22e00,
-			0x3cdfb323965e3e00,
-			0x3cde1c2688aa0000,
-			0x3cdc84c4b1675600,
-			0x3cdaecfe1338d000,
-			0x3cd954d2b0c1aa00,
-			0x3cd7bc428ca5bc00,
-			0x3cd6234da9898e00,
-			0x3cd489f40a124800,
-			0x3cd2f035b0e5c000,
-			0x3cd15612a0aa6c00,
-			0x3ccfbb8adc076800,
-			0x3cce209e65a48200,
-			0x3ccc854d402a2400,
-			0x3ccae9976e416000,
-			0x3cc94d7cf293f200,
-			0x3cc7b0fdcfcc3800,
-			0x3cc6141a08953e00,
-			0x3cc476d19f9ab000,
-			0x3cc2d9249788e600,
-			0x3cc13b12f30cd800,
-			0x3cbf9c9cb4d42a00,
-			0x3cbdfdc1df8d2600,
-			0x3cbc5e8275e6b600,
-			0x3cbabede7a907800,
-			0x3cb91ed5f03aa400,
-			0x3cb77e68d9961a00,
-			0x3cb5dd9739546c00,
-			0x3cb43c611227c200,
-			0x3cb29ac666c2f600,
-			0x3cb0f8c739d98200,
-			0x3caf56638e1f9000,
-			0x3cadb39b6649e200,
-			0x3cac106ec50dec00,
-			0x3caa6cddad21c400,
-			0x3ca8c8e8213c2600,
-			0x3ca7248e24147600,
-			0x3ca57fcfb862be00,
-			0x3ca3daace0dfaa00,
-			0x3ca23525a0449600,
-			0x3ca08f39f94b7800,
-			0x3c9ee8e9eeaef800,
-			0x3c9d4235832a5c00,
-			0x3c9b9b1cb9799200,
-			0x3c99f39f94593400,
-			0x3c984bbe16867400,
-			0x3c96a37842bf3e00,
-			0x3c94face1bc21600,
-			0x3c9351bfa44e2400,
-			0x3c91a84cdf234400,
-			0x3c8ffe75cf01ec00,
-			0x3c8e543a76ab3c00,
-			0x3c8ca99ad8e0fc00,
-			0x3c8afe96f8659800,
-			0x3c89532ed7fc2000,
-			0x3c87a7627a684a00,
-			0x3c85fb31e26e7c00,
-			0x3c844e9d12d3b000,
-			0x3c82a1a40e5d9a00,
-			0x3c80f446d7d28400,
-			0x3c7f468571f96400,
-			0x3c7d985fdf99da00,
-			0x3c7be9d6237c2000,
-			0x3c7a3ae840692400,
-			0x3c788b96392a7400,
-			0x3c76dbe0108a3c00,
-			0x3c752bc5c9535a00,
-			0x3c737b4766514e00,
-			0x3c71ca64ea503a00,
-			0x3c70191e581ce800,
-			0x3c6e6773b284c800,
-			0x3c6cb564fc55f200,
-			0x3c6b02f2385f1c00,
-			0x3c69501b696fae00,
-			0x3c679ce09257aa00,
-			0x3c65e941b5e7c000,
-			0x3c64353ed6f13e00,
-			0x3c6280d7f8461c00,
-			0x3c60cc0d1cb8fa00,
-			0x3c5f16de471d1600,
-			0x3c5d614b7a465e00,
-			0x3c5bab54b9095c00,
-			0x3c59f4fa063b4400,
-			0x3c583e3b64b1f000,
-			0x3c568718d743da00,
-			0x3c54cf9260c82a00,
-			0x3c5317a80416aa00,
-			0x3c515f59c407c400,
-			0x3c4fa6a7a3749000,
-			0x3c4ded91a536c400,
-			0x3c4c3417cc28c200,
-			0x3c4a7a3a1b258c00,
-			0x3c48bff89508ca00,
-			0x3c4705533caece00,
-			0x3c454a4a14f48800,
-			0x3c438edd20b79800,
-			0x3c41d30c62d63400,
-			0x3c4016d7de2f4600,
-			0x3c3e5a3f95a25400,
-			0x3c3c9d438c0f8c00,
-			0x3c3adfe3c457c200,
-			0x3c392220415c6c00,
-			0x3c3763f905ffae00,
-			0x3c35a56e15244600,
-			0x3c33e67f71ad9c00,
-			0x3c32272d1e7fbe00,
-			0x3c3067771e7f5a00,
-			0x3c2ea75d7491ce00,
-			0x3c2ce6e0239d1200,
-			0x3c2b25ff2e87c600,
-			0x3c2964ba98393200,
-			0x3c27a31263993e00,
-			0x3c25e10693908000,
-			0x3c241e972b082a00,
-			0x3c225bc42cea1200,
-			0x3c20988d9c20bc00,
-			0x3c1ed4f37b974600,
-			0x3c1d10f5ce397e00,
-			0x3c1b4c9496f3ce00,
-			0x3c1987cfd8b34a00,
-			0x3c17c2a79665aa00,
-			0x3c15fd1bd2f94400,
-			0x3c14372c915d2000,
-			0x3c1270d9d480da00,
-			0x3c10aa239f54c600,
-			0x3c0ee309f4c9ce00,
-			0x3c0d1b8cd7d18000,
-			0x3c0b53ac4b5e1e00,
-			0x3c098b6852627e00,
-			0x3c07c2c0efd22400,
-			0x3c05f9b626a13400,
-			0x3c043047f9c47800,
-			0x3c0266766c316200,
-			0x3c009c4180de0200,
-			0x3bfed1a93ac11600,
-			0x3bfd06ad9cd1f400,
-			0x3bfb3b4eaa08a000,
-			0x3bf96f8c655dc200,
-			0x3bf7a366d1ca9c00,
-			0x3bf5d6ddf2492600,
-			0x3bf409f1c9d3ee00,
-			0x3bf23ca25b662c00,
-			0x3bf06eefa9fbbe00,
-			0x3beea0d9b8912000,
-			0x3becd2608a237a00,
-			0x3beb038421b09000,
-			0x3be934448236d600,
-			0x3be764a1aeb55800,
-			0x3be5949baa2bcc00,
-			0x3be3c432779a9000,
-			0x3be1f3661a029c00,
-			0x3be0223694659800,
-			0x3bde50a3e9c5c800,
-			0x3bdc7eae1d261200,
-			0x3bdaac55318a0e00,
-			0x3bd8d99929f5e600,
-			0x3bd7067a096e7800,
-			0x3bd532f7d2f93a00,
-			0x3bd35f12899c5000,
-			0x3bd18aca305e7c00,
-			0x3bcfb61eca472000,
-			0x3bcde1105a5e4c00,
-			0x3bcc0b9ee3acae00,
-			0x3bca35ca693b9c00,
-			0x3bc85f92ee150a00,
-			0x3bc688f875439200,
-			0x3bc4b1fb01d27600,
-			0x3bc2da9a96cd9800,
-			0x3bc102d737418000,
-			0x3bbf2ab0e63b5800,
-			0x3bbd5227a6c8ea00,
-			0x3bbb793b7bf8b000,
-			0x3bb99fec68d9b800,
-			0x3bb7c63a707bc400,
-			0x3bb5ec2595ef2e00,
-			0x3bb411addc44f400,
-			0x3bb236d3468ec200,
-			0x3bb05b95d7ded800,
-			0x3bae7ff593482c00,
-			0x3baca3f27bde4600,
-			0x3baac78c94b55e00,
-			0x3ba8eac3e0e24e00,
-			0x3ba70d98637a8a00,
-			0x3ba5300a1f943800,
-			0x3ba3521918461000,
-			0x3ba173c550a78400,
-			0x3b9f950ecbd09600,
-			0x3b9db5f58cd9f000,
-			0x3b9bd67996dce800,
-			0x3b99f69aecf37000,
-			0x3b98165992381e00,
-			0x3b9635b589c62e00,
-			0x3b9454aed6b97a00,
-			0x3b9273457c2e8800,
-			0x3b9091797d427800,
-			0x3b8eaf4add131600,
-			0x3b8cccb99ebecc00,
-			0x3b8ae9c5c564a600,
-			0x3b89066f54245c00,
-			0x3b8722b64e1e3a00,
-			0x3b853e9ab6734000,
-			0x3b835a1c90450400,
-			0x3b81753bdeb5ca00,
-			0x3b7f8ff8a4e87000,
-			0x3b7daa52e6007c00,
-			0x3b7bc44aa5221800,
-			0x3b79dddfe5720a00,
-			0x3b77f712aa15c600,
-			0x3b760fe2f6335c00,
-			0x3b742850ccf17e00,
-			0x3b72405c31778600,
-			0x3b70580526ed6e00,
-			0x3b6e6f4bb07bd400,
-			0x3b6c862fd14bfa00,
-			0x3b6a9cb18c87bc00,
-			0x3b68b2d0e559a800,
-			0x3b66c88ddeece400,
-			0x3b64dde87c6d3e00,
-			0x3b62f2e0c1072600,
-			0x3b610776afe7a800,
-			0x3b5f1baa4c3c8000,
-			0x3b5d2f7b99340000,
-			0x3b5b42ea99fd2600,
-			0x3b5955f751c78a00,
-			0x3b5768a1c3c37400,
-			0x3b557ae9f321c000,
-			0x3b538ccfe313f400,
-			0x3b519e5396cc3a00,
-			0x3b4faf75117d5c00,
-			0x3b4dc034565ac600,
-			0x3b4bd09168988a00,
-			0x3b49e08c4b6b5600,
-			0x3b47f02502088600,
-			0x3b45ff5b8fa60a00,
-			0x3b440e2ff77a8200,
-			0x3b421ca23cbd2a00,
-			0x3b402ab262a5dc00,
-			0x3b3e38606c6d2000,
-			0x3b3c45ac5d4c1400,
-			0x3b3a5296387c8400,
-			0x3b385f1e0138d800,
-			0x3b366b43babc1600,
-			0x3b3477076841f200,
-			0x3b3282690d06ba00,
-			0x3b308d68ac476000,
-			0x3b2e980649417600,
-			0x3b2ca241e7333800,
-			0x3b2aac1b895b7e00,
-			0x3b28b59332f9c000,
-			0x3b26bea8e74e2000,
-			0x3b24c75ca9995a00,
-			0x3b22cfae7d1cd200,
-			0x3b20d79e651a8e00,
-			0x3b1edf2c64d53000,
-			0x3b1ce6587f900400,
-			0x3b1aed22b88ef200,
-			0x3b18f38b13168c00,
-			0x3b16f991926bfc00,
-			0x3b14ff3639d51200,
-			0x3b1304790c984400,
-			0x3b11095a0dfca400,
-			0x3b0f0dd94149ea00,
-			0x3b0d11f6a9c87000,
-			0x3b0b15b24ac12e00,
-			0x3b09190c277dc400,
-			0x3b071c0443486c00,
-			0x3b051e9aa16c0a00,
-			0x3b0320cf45341c00,
-			0x3b0122a231eccc00,
-			0x3aff24136ae2da00,
-			0x3afd2522f363b000,
-			0x3afb25d0cebd5800,
-			0x3af9261d003e7c00,
-			0x3af726078b366800,
-			0x3af5259072f50e00,
-			0x3af324b7bacaf800,
-			0x3af1237d66095e00,
-			0x3aef21e178020c00,
-			0x3aed1fe3f4078000,
-			0x3aeb1d84dd6ccc00,
-			0x3ae91ac43785a400,
-			0x3ae717a205a66a00,
-			0x3ae5141e4b241400,
-			0x3ae310390b544000,
-			0x3ae10bf2498d2c00,
-			0x3adf074a0925b600,
-			0x3add02404d756200,
-			0x3adafcd519d45000,
-			0x3ad8f708719b4600,
-			0x3ad6f0da5823a800,
-			0x3ad4ea4ad0c77e00,
-			0x3ad2e359dee17000,
-			0x3ad0dc0785ccc200,
-			0x3aced453c8e56600,
-			0x3acccc3eab87e200,
-			0x3acac3c831116800,
-			0x3ac8baf05cdfc200,
-			0x3ac6b1b732516200,
-			0x3ac4a81cb4c55800,
-			0x3ac29e20e79b5400,
-			0x3ac093c3ce33ac00,
-			0x3abe89056bef5200,
-			0x3abc7de5c42fda00,
-			0x3aba7264da577e00,
-			0x3ab86682b1c91200,
-			0x3ab65a3f4de81000,
-			0x3ab44d9ab2189000,
-			0x3ab24094e1bf4a00,
-			0x3ab0332de041a000,
-			0x3aae2565b1058400,
-			0x3aac173c57719e00,
-			0x3aaa08b1d6ed2600,
-			0x3aa7f9c632dffc00,
-			0x3aa5ea796eb2a000,
-			0x3aa3dacb8dce2e00,
-			0x3aa1cabc939c6e00,
-			0x3a9fba4c8387bc00,
-			0x3a9da97b60fb2000,
-			0x3a9b98492f623e00,
-			0x3a9986b5f2295400,
-			0x3a9774c1acbd4c00,
-			0x3a95626c628ba600,
-			0x3a934fb617029200,
-			0x3a913c9ecd90d000,
-			0x3a8f292689a5c400,
-			0x3a8d154d4eb18000,
-			0x3a8b01132024a600,
-			0x3a88ec7801708000,
-			0x3a86d77bf606f800,
-			0x3a84c21f015a9a00,
-			0x3a82ac6126de8e00,
-			0x3a8096426a069e00,
-			0x3a7e7fc2ce473a00,
-			0x3a7c68e257156a00,
-			0x3a7a51a107e6de00,
-			0x3a7839fee431e000,
-			0x3a7621fbef6d5c00,
-			0x3a7409982d10e400,
-			0x3a71f0d3a0949e00,
-			0x3a6fd7ae4d716000,
-			0x3a6dbe2837209200,
-			0x3a6ba441611c4400,
-			0x3a6989f9cedf2800,
-			0x3a676f5183e48800,
-			0x3a65544883a85600,
-			0x3a6338ded1a72000,
-			0x3a611d14715e1000,
-			0x3a5f00e9664b0000,
-			0x3a5ce45db3ec5400,
-			0x3a5ac7715dc12600,
-			0x3a58aa2467491e00,
-			0x3a568c76d4048c00,
-			0x3a546e68a7746400,
-			0x3a524ff9e51a2c00,
-			0x3a50312a90781e00,
-			0x3a4e11faad110000,
-			0x3a4bf26a3e684800,
-			0x3a49d27948020400,
-			0x3a47b227cd62dc00,
-			0x3a459175d2102600,
-			0x3a437063598fca00,
-			0x3a414ef067685e00,
-			0x3a3f2d1cff210a00,
-			0x3a3d0ae924419a00,
-			0x3a3ae854da528000,
-			0x3a38c56024dcc600,
-			0x3a36a20b076a1c00,
-			0x3a347e558584cc00,
-			0x3a325a3fa2b7bc00,
-			0x3a3035c9628e8000,
-			0x3a2e10f2c8954000,
-			0x3a2bebbbd858c800,
-			0x3a29c62495667e00,
-			0x3a27a02d034c6e00,
-			0x3a2579d525994200,
-			0x3a23531cffdc4000,
-			0x3a212c0495a55200,
-			0x3a1f048bea84fe00,
-			0x3a1cdcb3020c6e00,
-			0x3a1ab479dfcd6200,
-			0x3a188be0875a4400,
-			0x3a1662e6fc461600,
-			0x3a14398d42247c00,
-			0x3a120fd35c89bc00,
-			0x3a0fe5b94f0aba00,
-			0x3a0dbb3f1d3cf000,
-			0x3a0b9064cab68400,
-			0x3a09652a5b0e3600,
-			0x3a07398fd1db6400,
-			0x3a050d9532b61000,
-			0x3a02e13a8136ce00,
-			0x3a00b47fc0f6e800,
-			0x39fe8764f5902e00,
-			0x39fc59ea229d2000,
-			0x39fa2c0f4bb8da00,
-			0x39f7fdd4747f0800,
-			0x39f5cf39a08c1400,
-			0x39f3a03ed37ce400,
-			0x39f170e410ef1c00,
-			0x39ef41295c80e400,
-			0x39ed110eb9d11600,
-			0x39eae0942c7f2400,
-			0x39e8afb9b82b1600,
-			0x39e67e7f6075aa00,
-			0x39e44ce529002000,
-			0x39e21aeb156c7400,
-			0x39dfe891295d2600,
-			0x39ddb5d768756600,
-			0x39db82bdd658fe00,
-			0x39d94f4476ac4c00,
-			0x39d71b6b4d146800,
-			0x39d4e7325d36e800,
-			0x39d2b299aaba1600,
-			0x39d07da13944d600,
-			0x39ce48490c7ea400,
-			0x39cc1291280fa400,
-			0x39c9dc798fa09400,
-			0x39c7a60246dacc00,
-			0x39c56f2b51684800,
-			0x39c337f4b2f3a400,
-			0x39c1005e6f281600,
-			0x39bec86889b17200,
-			0x39bc9013063c3000,
-			0x39ba575de8756400,
-			0x39b81e49340aba00,
-			0x39b5e4d4ecaa8200,
-			0x39b3ab011603ac00,
-			0x39b170cdb3c5c200,
-			0x39af363ac9a0f200,
-			0x39acfb485b45fa00,
-			0x39aabff66c664e00,
-			0x39a8844500b3e600,
-			0x39a648341be16c00,
-			0x39a40bc3c1a22200,
-			0x39a1cef3f5a9de00,
-			0x399f91c4bbad2600,
-			0x399d543617610c00,
-			0x399b16480c7b5400,
-			0x3998d7fa9eb24c00,
-			0x3996994dd1bcea00,
-			0x39945a41a952c400,
-			0x39921ad6292c0400,
-			0x398fdb0b55018200,
-			0x398d9ae1308c9c00,
-			0x398b5a57bf876e00,
-			0x3989196f05ac9200,
-			0x3986d82706b75400,
-			0x3984967fc6639800,
-			0x39825479486dd600,
-			0x3980121390933a00,
-			0x397dcf4ea2917600,
-			0x397b8c2a8226ea00,
-			0x397948a733128a00,
-			0x397704c4b913ee00,
-			0x3974c08317eb4a00,
-			0x39727be253596c00,
-			0x397036e26f1fc200,
-			0x396df1836f005600,
-			0x396babc556bdd600,
-			0x396965a82a1b8600,
-			0x39671f2becdd4c00,
-			0x3964d850a2c7a400,
-			0x396291164f9fb000,
-			0x3960497cf72b2c00,
-			0x395e01849d307000,
-			0x395bb92d45767600,
-			0x39597076f3c4d000,
-			0x39572761abe3b200,
-			0x3954dded719be200,
-			0x3952941a48b6da00,
-			0x395049e834fe9600,
-			0x394dff573a3dc200,
-			0x394bb4675c3fa200,
-			0x394969189ed01000,
-			0x39471d6b05bb9400,
-			0x3944d15e94cf3c00,
-			0x394284f34fd8cc00,
-			0x394038293aa69200,
-			0x393deb0059078000,
-			0x393b9d78aecb2800,
-			0x39394f923fc1ac00,
-			0x3937014d0fbbe200,
-			0x3934b2a9228b2600,
-			0x393263a67c017c00,
-			0x393014451ff18400,
-			0x392dc485122e7a00,
-			0x392b7466568c3a00,
-			0x392923e8f0df3000,
-			0x3926d30ce4fc7a00,
-			0x392481d236b9be00,
-			0x39223038e9ed4c00,
-			0x391fde41026e0a00,
-			0x391d8bea84138000,
-			0x391b393572b5d000,
-			0x3918e621d22db200,
-			0x391692afa6548600,
-			0x39143edef3044200,
-			0x3911eaafbc177a00,
-			0x390f962205695e00,
-			0x390d4135d2d5c000,
-			0x390aebeb28390000,
-			0x3908964209702800,
-			0x3906403a7a58da00,
-			0x3903e9d47ed15600,
-			0x390193101ab87800,
-			0x38ff3bed51edae00,
-			0x38fce46c28511a00,
-			0x38fa8c8ca1c36200,
-			0x38f8344ec225d200,
-			0x38f5dbb28d5a5400,
-			0x38f382b807436e00,
-			0x38f1295f33c44200,
-			0x38eecfa816c08400,
-			0x38ec7592b41c9a00,
-			0x38ea1b1f0fbd6c00,
-			0x38e7c04d2d889400,
-			0x38e5651d11643e00,
-			0x38e3098ebf372a00,
-			0x38e0ada23ae8cc00,
-			0x38de515788611600,
-			0x38dbf4aeab88b200,
-			0x38d997a7a848d200,
-			0x38d73a42828b4c00,
-			0x38d4dc7f3e3a9000,
-			0x38d27e5ddf41ac00,
-			0x38d01fde698c4a00,
-			0x38cdc100e106aa00,
-			0x38cb61c5499dae00,
-			0x38c9022ba73ed200,
-			0x38c6a233fdd82e00,
-			0x38c441de51587200,
-			0x38c1e12aa5aef200,
-			0x38bf8018fecb9600,
-			0x38bd1ea9609ee200,
-			0x38babcdbcf19fa00,
-			0x38b85ab04e2e9a00,
-			0x38b5f826e1cf1a00,
-			0x38b3953f8dee7200,
-			0x38b131fa56803200,
-			0x38aece573f787e00,
-			0x38ac6a564ccc2200,
-			0x38aa05f782707e00,
-			0x38a7a13ae45b9400,
-			0x38a53c207683fa00,
-			0x38a2d6a83ce0de00,
-			0x38a070d23b6a1e00,
-			0x389e0a9e76181600,
-			0x389ba40cf0e3d400,
-			0x38993d1dafc6fc00,
-			0x3896d5d0b6bbbc00,
-			0x38946e2609bcfe00,
-			0x3892061dacc62600,
-			0x388f9db7a3d34e00,
-			0x388d34f3f2e11800,
-			0x388acbd29decc800,
-			0x38886253a8f44200,
-			0x3885f87717f5f800,
-			0x38838e3ceef10a00,
-			0x388123a531e51a00,
-			0x387eb8afe4d28400,
-			0x387c4d5d0bba2400,
-			0x3879e1acaa9d7a00,
-			0x3877759ec57eaa00,
-			0x3875093360605c00,
-			0x38729c6a7f45f200,
-			0x38702f4426335000,
-			0x386dc1c0592cfc00,
-			0x386b53df1c381a00,
-			0x3868e5a0735a6800,
-			0x38667704629a3e00,
-			0x3864080aedfe8800,
-			0x386198b4198ed800,
-			0x385f28ffe9535200,
-			0x385cb8ee6154b800,
-			0x385a487f859c6800,
-			0x3857d7b35a345a00,
-			0x38556689e3272000,
-			0x3852f503247fe000,
-			0x3850831f224a6400,
-			0x384e10dde0930c00,
-			0x384b9e3f6366d200,
-			0x38492b43aed35000,
-			0x3846b7eac6e6b600,
-			0x38444434afafc200,
-			0x3841d0216d3dea00,
-			0x383f5bb103a12200,
-			0x383ce6e376ea0400,
-			0x383a71b8cb29c800,
-			0x3837fc3104723000,
-			0x3835864c26d5b400,
-			0x3833100a36674600,
-			0x3830996b373a9000,
-			0x382e226f2d63be00,
-			0x382bab161cf7a200,
-			0x382933600a0bac00,
-			0x3826bb4cf8b5d400,
-			0x382442dced0cc600,
-			0x3821ca0feb27ac00,
-			0x381f50e5f71e6400,
-			0x381cd75f15095400,
-			0x381a5d7b49018200,
-			0x3817e33a97209200,
-			0x3815689d0380b000,
-			0x3812eda2923cc200,
-			0x3810724b47702800,
-			0x380df6972736ea00,
-			0x380b7a8635adac00,
-			0x3808fe1876f1a800,
-			0x3806814def20b200,
-			0x38040426a2593400,
-			0x380186a294ba3600,
-			0x37ff08c1ca635800,
-			0x37fc8a844774d800,
-			0x37fa0bea100f8600,
-			0x37f78cf32854d400,
-			0x37f50d9f9466c200,
-			0x37f28def5867f200,
-			0x37f00de2787ba000,
-			0x37ed8d78f8c59e00,
-			0x37eb0cb2dd6a5800,
-			0x37e88b902a8ed200,
-			0x37e60a10e458b200,
-			0x37e388350eee2600,
-			0x37e105fcae760400,
-			0x37de8367c717b800,
-			0x37dc00765cfb4600,
-			0x37d97d2874494e00,
-			0x37d6f97e112afa00,
-			0x37d4757737ca2a00,
-			0x37d1f113ec513a00,
-			0x37cf6c5432eb3200,
-			0x37cce7380fc3aa00,
-			0x37ca61bf8706d600,
-			0x37c7dbea9ce18800,
-			0x37c555b955811800,
-			0x37c2cf2bb5139600,
-			0x37c04841bfc78c00,
-			0x37bdc0fb79cc3200,
-			0x37bb3958e7514c00,
-			0x37b8b15a0c874000,
-			0x37b628feed9f0c00,
-			0x37b3a0478eca3600,
-			0x37b11733f43afc00,
-			0x37ae8dc422241800,
-			0x37ac03f81cb8ea00,
-			0x37a979cfe82d6a00,
-			0x37a6ef4b88b62600,
-			0x37a4646b02884a00,
-			0x37a1d92e59d98e00,
-			0x379f4d9592e04e00,
-			0x379cc1a0b1d38000,
-			0x379a354fbaeaaa00,
-			0x3797a8a2b25dee00,
-			0x37951b999c660c00,
-			0x37928e347d3c5200,
-			0x37900073591aaa00,
-			0x378d7256343b9e00,
-			0x378ae3dd12da4600,
-			0x37885507f9325a00,
-			0x3785c5d6eb802400,
-			0x37833649ee008e00,
-			0x3780a66104f11000,
-			0x377e161c348fc200,
-			0x377b857b811b5000,
-			0x3778f47eeed30400,
-			0x3776632681f6be00,
-			0x3773d1723ec6e600,
-			0x37713f622984a000,
-			0x376eacf646718200,
-			0x376c1a2e99cfce00,
-			0x3769870b27e26200,
-			0x3766f38bf4ec9c00,
-			0x37645fb105329600,
-			0x3761cb7a5cf8dc00,
-			0x375f36e80084b600,
-			0x375ca1f9f41be400,
-			0x375a0cb03c04d000,
-			0x3757770adc867c00,
-			0x3754e109d9e87000,
-			0x37524aad3872ec00,
-			0x374fb3f4fc6ea200,
-			0x374d1ce12a24fe00,
-			0x374a8571c5dfec00,
-			0x3747eda6d3e9f600,
-			0x37455580588e4800,
-			0x3742bcfe58189000,
-			0x37402420d6d52e00,
-			0x373d8ae7d9110200,
-			0x373af15363199000,
-			0x37385763793cf200,
-			0x3735bd181fc9d800,
-			0x373322715b0f8a00,
-			0x3730876f2f5dea00,
-			0x372dec11a1056800,
-			0x372b5058b4571400,
-			0x3728b4446da49400,
-			0x372617d4d1402400,
-			0x37237b09e37c9c00,
-			0x3720dde3a8ad5a00,
-			0x371e406225267000,
-			0x371ba2855d3c6c00,
-			0x3719044d55448200,
-			0x371665ba11947800,
-			0x3713c6cb9682ae00,
-			0x37112781e8661c00,
-			0x370e87dd0b964200,
-			0x370be7dd046b5600,
-			0x37094781d73e0400,
-			0x3706a6cb8867a200,
-			0x370405ba1c421c00,
-			0x3701644d9727e600,
-			0x36fec285fd742400,
-			0x36fc206353827400,
-			0x36f97de59daf2a00,
-			0x36f6db0ce0571400,
-			0x36f437d91fd7a600,
-			0x36f1944a608eec00,
-			0x36eef060a6db7800,
-			0x36ec4c1bf71c9000,
-			0x36e9a77c55b1f400,
-			0x36e70281c6fc0800,
-			0x36e45d2c4f5bc600,
-			0x36e1b77bf332be00,
-			0x36df1170b6e31a00,
-			0x36dc6b0a9ecf8800,
-			0x36d9c449af5b6e00,
-			0x36d71d2deceaa600,
-			0x36d475b75be1b600,
-			0x36d1cde600a5b200,
-			0x36cf25b9df9c4800,
-			0x36cc7d32fd2bbe00,
-			0x36c9d4515dbae200,
-			0x36c72b1505b12c00,
-			0x36c4817df9769e00,
-			0x36c1d78c3d73d400,
-			0x36bf2d3fd6120000,
-			0x36bc8298c7baee00,
-			0x36b9d79716d8f200,
-			0x36b72c3ac7d70600,
-			0x36b48083df20b600,
-			0x36b1d47261221e00,
-			0x36af28065247f800,
-			0x36ac7b3fb6ff8800,
-			0x36a9ce1e93b6bc00,
-			0x36a720a2ecdbfe00,
-			0x36a472ccc6de6a00,
-			0x36a1c49c262d9a00,
-			0x369f16110f39c800,
-			0x369c672b8673ca00,
-			0x3699b7eb904cf800,
-			0x3697085131375c00,
-			0x3694585c6da57800,
-			0x3691a80d4a0a8200,
-			0x368ef763cada2800,
-			0x368c465ff488be00,
-			0x36899501cb8b3200,
-			0x3686e3495456f400,
-			0x3684313693622600,
-			0x36817ec98d236000,
-			0x367ecc024611e800,
-			0x367c18e0c2a58e00,
-			0x367965650756ba00,
-			0x3676b18f189e6c00,
-			0x3673fd5efaf63200,
-			0x367148d4b2d83400,
-			0x366e93f044bf3200,
-			0x366bdeb1b5267c00,
-			0x366929190889fa00,
-			0x3666732643662c00,
-			0x3663bcd96a382600,
-			0x36610632817d8800,
-			0x365e4f318db49000,
-			0x365b97d6935c1200,
-			0x3658e02196f37400,
-			0x365628129cfab000,
-			0x36536fa9a9f25e00,
-			0x3650b6e6c25b9800,
-			0x364dfdc9eab81e00,
-			0x364b4453278a4200,
-			0x36488a827d54e400,
-			0x3645d057f09b8200,
-			0x364315d385e22200,
-			0x36405af541ad7200,
-			0x363d9fbd2882a000,
-			0x363ae42b3ee77c00,
-			0x3638283f89626c00,
-			0x36356bfa0c7a5a00,
-			0x3632af5accb6de00,
-			0x362ff261cea00800,
-			0x362d350f16be9e00,
-			0x362a7762a99bda00,
-			0x3627b95c8bc19c00,
-			0x3624fafcc1ba5c00,
-			0x36223c4350111200,
-			0x361f7d303b516800,
-			0x361cbdc388077e00,
-			0x3619fdfd3ac02600,
-			0x36173ddd5808ac00,
-			0x36147d63e46f0000,
-			0x3611bc90e481a200,
-			0x360efb645ccfa600,
-			0x360c39de51e8b800,
-			0x360977fec85d0e00,
-			0x3606b5c5c4bd7c00,
-			0x3603f3334b9b6800,
-			0x360130476188cc00,
-			0x35fe6d020b183200,
-			0x35fba9634cdcc400,
-			0x35f8e56b2b6a2e00,
-			0x35f62119ab54bc00,
-			0x35f35c6ed1314c00,
-			0x35f0976aa1955000,
-			0x35edd20d2116ce00,
-			0x35eb0c56544c5e00,
-			0x35e846463fcd3400,
-			0x35e57fdce8310400,
-			0x35e2b91a52102a00,
-			0x35dff1fe82039000,
-			0x35dd2a897ca4b000,
-			0x35da62bb468d9e00,
-			0x35d79a93e458f000,
-			0x35d4d2135aa1f200,
-			0x35d20939ae046000,
-			0x35cf4006e31c9c00,
-			0x35cc767afe87a000,
-			0x35c9ac9604e2e000,
-			0x35c6e257facc8a00,
-			0x35c417c0e4e33800,
-			0x35c14cd0c7c63a00,
-			0x35be8187a8155a00,
-			0x35bbb5e58a710000,
-			0x35b8e9ea737a2e00,
-			0x35b61d9667d26200,
-			0x35b350e96c1bce00,
-			0x35b083e384f91600,
-			0x35adb684b70d9200,
-			0x35aae8cd06fd1000,
-			0x35a81abc796c0200,
-			0x35a54c5312ff6e00,
-			0x35a27d90d85cda00,
-			0x359fae75ce2a8000,
-			0x359cdf01f90f0a00,
-			0x359a0f355db1ce00,
-			0x35973f1000baa800,
-			0x35946e91e6d20e00,
-			0x35919dbb14a10a00,
-			0x358ecc8b8ed12c00,
-			0x358bfb035a0ca400,
-			0x358929227afe3000,
-			0x358656e8f6512200,
-			0x35838456d0b16000,
-			0x3580b16c0ecb6400,
-			0x357dde28b54c3000,
-			0x357b0a8cc8e16400,
-			0x357836984e393000,
-			0x3575624b4a025400,
-			0x35728da5c0ec2600,
-			0x356fb8a7b7a68e00,
-			0x356ce35132e20800,
-			0x356a0da2374f9200,
-			0x3567379ac9a0e000,
-			0x3564613aee881200,
-			0x35618a82aab7f200,
-			0x355eb37202e3da00,
-			0x355bdc08fbbfa400,
-			0x3559044799ffde00,
-			0x35562c2de2598000,
-			0x355353bbd9823c00,
-			0x35507af184303800,
-			0x354da1cee71a3c00,
-			0x354ac85406f79e00,
-			0x3547ee80e8803c00,
-			0x35451455906ca200,
-			0x354239d20375cc00,
-			0x353f5ef646555e00,
-			0x353c83c25dc58a00,
-			0x3539a8364e811000,
-			0x3536cc521d434800,
-			0x3533f015cec80e00,
-			0x3531138167cbe800,
-			0x352e3694ed0bd400,
-			0x352b595063457200,
-			0x35287bb3cf36f000,
-			0x35259dbf359f0c00,
-			0x3522bf729b3d1c00,
-			0x351fe0ce04d0fa00,
-			0x351d01d1771b1e00,
-			0x351a227cf6dc9000,
-			0x351742d088d6e800,
-			0x351462cc31cc4c00,
-			0x3511826ff67f7c00,
-			0x350ea1bbdbb3be00,
-			0x350bc0afe62cf400,
-			0x3508df4c1aaf8c00,
-			0x3505fd907e008600,
-			0x35031b7d14e57a00,
-			0x35003911e4247e00,
-			0x34fd564ef0845800,
-			0x34fa73343ecc4400,
-			0x34f78fc1d3c41a00,
-			0x34f4abf7b4344400,
-			0x34f1c7d5e4e5be00,
-			0x34eee35c6aa21600,
-			0x34ebfe8b4a335a00,
-			0x34e9196288644c00,
-			0x34e633e22a001a00,
-			0x34e34e0a33d29c00,
-			0x34e067daaaa83000,
-			0x34dd8153934dc800,
-			0x34da9a74f290ec00,
-			0x34d7b33ecd3fa200,
-			0x34d4cbb12828a000,
-			0x34d1e3cc081b1000,
-			0x34cefb8f71e6ba00,
-			0x34cc12fb6a5bf600,
-			0x34c92a0ff64bac00,
-			0x34c640cd1a875c00,
-			0x34c35732dbe10200,
-			0x34c06d413f2b4000,
-			0x34bd82f849393e00,
-			0x34ba9857fedeba00,
-			0x34b7ad6064effe00,
-			0x34b4c2118041e800,
-			0x34b1d66b55a9ea00,
-			0x34aeea6de9fdf600,
-			0x34abfe194214a200,
-			0x34a9116d62c50a00,
-			0x34a6246a50e6e000,
-			0x34a3371011526000,
-			0x34a0495ea8e06000,
-			0x349d5b561c6a3800,
-			0x349a6cf670c9da00,
-			0x34977e3faad9c800,
-			0x34948f31cf751400,
-			0x34919fcce3776400,
-			0x348eb010ebbcd800,
-			0x348bbffded224800,
-			0x3488cf93ec84f400,
-			0x3485ded2eec2c400,
-			0x3482edbaf8ba2e00,
-			0x347ffc4c0f4a2800,
-			0x347d0a8637525000,
-			0x347a186975b2ba00,
-			0x347725f5cf4c2a00,
-			0x3474332b48ffd200,
-			0x34714009e7af8600,
-			0x346e4c91b03dae00,
-			0x346b58c2a78d2c00,
-			0x3468649cd2819400,
-			0x3465702035fee400,
-			0x34627b4cd6e9ca00,
-			0x345f8622ba276e00,
-			0x345c90a1e49d9000,
-			0x34599aca5b328400,
-			0x3456a49c22cd1c00,
-			0x3453ae174054d600,
-			0x3450b73bb8b1a400,
-			0x344dc00990cc1600,
-			0x344ac880cd8d4a00,
-			0x3447d0a173dee800,
-			0x3444d86b88ab3400,
-			0x3441dfdf10dcec00,
-			0x343ee6fc115f7000,
-			0x343bedc28f1eaa00,
-			0x3438f4328f071000,
-			0x3435fa4c1605aa00,
-			0x3433000f29081000,
-			0x3430057bccfc6800,
-			0x342d0a9206d16800,
-			0x342a0f51db765000,
-			0x342713bb4fdaf600,
-			0x342417ce68efb800,
-			0x34211b8b2ba58e00,
-			0x341e1ef19cedf800,
-			0x341b2201c1baf800,
-			0x341824bb9eff3e00,
-			0x3415271f39adec00,
-			0x3412292c96babe00,
-			0x340f2ae3bb1a0600,
-			0x340c2c44abc08e00,
-			0x34092d4f6da3d000,
-			0x34062e0405b9b400,
-			0x34032e6278f8cc00,
-			0x34002e6acc582000,
-			0x33fd2e1d04cf5a00,
-			0x33fa2d792756ae00,
-			0x33f72c7f38e6cc00,
-			0x33f42b2f3e791600,
-			0x33f129893d075800,
-			0x33ee278d398c0c00,
-			0x33eb253b39022200,
-			0x33e8229340652200,
-			0x33e51f9554b12a00,
-			0x33e21c417ae2d000,
-			0x33df1897b7f75a00,
-			0x33dc149810ec7800,
-			0x33d910428ac08200,
-			0x33d60b972a725400,
-			0x33d30695f5015a00,
-			0x33d0013eef6d9200,
-			0x33ccfb921eb77a00,
-			0x33c9f58f87e02e00,
-			0x33c6ef372fe95000,
-			0x33c3e8891bd51400,
-			0x33c0e18550a63a00,
-			0x33bdda2bd3601400,
-			0x33bad27ca9067400,
-			0x33b7ca77d69dc800,
-			0x33b4c21d612b0a00,
-			0x33b1b96d4db3bc00,
-			0x33aeb067a13df200,
-			0x33aba70c60d05000,
-			0x33a89d5b91720400,
-			0x33a59355382ac400,
-			0x33a288f95a02de00,
-			0x339f7e47fc032a00,
-			0x339c734123350c00,
-			0x339967e4d4a27a00,
-			0x33965c331555ea00,
-			0x3393502bea5a7800,
-			0x339043cf58bbae00,
-			0x338d371d6585c800,
-			0x338a2a1615c56c00,
-			0x33871cb96e87e200,
-			0x33840f0774db0200,
-			0x338101002dcd1600,
-			0x337df2a39e6d2200,
-			0x337ae3f1cbca8c00,
-			0x3377d4eabaf55e00,
-			0x3374c58e70fe2c00,
-			0x3371b5dcf2f61600,
-			0x336ea5d645eecc00,
-			0x336b957a6efa7c00,
-			0x336884c9732bfc00,
-			0x336573c357969400,
-			0x33626268214e2800,
-			0x335f50b7d5672800,
-			0x335c3eb278f68c00,
-			0x33592c581111e000,
-			0x335619a8a2cf3000,
-			0x335306a433452200,
-			0x334ff34ac78ae400,
-			0x334cdf9c64b82e00,
-			0x3349cb990fe54a00,
-			0x3346b740ce2b0e00,
-			0x3343a293a4a2d400,
-			0x33408d9198668a00,
-			0x333d783aae90ac00,
-			0x333a628eec3c4000,
-			0x33374c8e5684dc00,
-			0x33343638f2869200,
-			0x33311f8ec55e2000,
-			0x332e088fd428ae00,
-			0x332af13c24040a00,
-			0x3327d993ba0e7e00,
-			0x3324c1969b66ec00,
-			0x3321a944cd2cbe00,
-			0x331e909e547fde00,
-			0x331b77a33680e000,
-			0x33185e537850c200,
-			0x331544af1f112400,
-			0x33122ab62fe42e00,
-			0x330f1068afec8800,
-			0x330bf5c6a44d7e00,
-			0x3308dad0122acc00,
-			0x3305bf84fea8d800,
-			0x3302a3e56eec7400,
-			0x32ff87f1681b1800,
-			0x32fc6ba8ef5abc00,
-			0x32f94f0c09d1dc00,
-			0x32f6321abca79a00,
-			0x32f314d50d038400,
-			0x32eff73b000dca00,
-			0x32ecd94c9aef1e00,
-			0x32e9bb09e2d0c200,
-			0x32e69c72dcdc8000,
-			0x32e37d878e3cb000,
-			0x32e05e47fc1c3c00,
-			0x32dd3eb42ba68400,
-			0x32da1ecc22078a00,
-			0x32d6fe8fe46bd200,
-			0x32d3ddff78006e00,
-			0x32d0bd1ae1f2fa00,
-			0x32cd9be22771a200,
-			0x32ca7a554dab0e00,
-			0x32c7587459ce8200,
-			0x32c4363f510bc800,
-			0x32c113b638933400,
-			0x32bdf0d91595aa00,
-			0x32bacda7ed448800,
-			0x32b7aa22c4d1d800,
-			0x32b48649a1700800,
-			0x32b1621c88523000,
-			0x32ae3d9b7eabe600,
-			0x32ab18c689b14200,
-			0x32a7f39dae970200,
-			0x32a4ce20f2924c00,
-			0x32a1a8505ad8f600,
-			0x329e822beca14000,
-			0x329b5bb3ad220600,
-			0x329834e7a192b200,
-			0x32950dc7cf2b2400,
-			0x3291e6543b23e600,
-			0x328ebe8ceab5ea00,
-			0x328b9671e31ad200,
-			0x32886e03298ca800,
-			0x32854540c3461400,
-			0x32821c2ab5824a00,
-			0x327ef2c1057cf400,
-			0x327bc903b8726600,
-			0x32789ef2d39f6200,
-			0x3275748e5c414200,
-			0x327249d65795ec00,
-			0x326f1ecacadbca00,
-			0x326bf36bbb51d800,
-			0x3268c7b92e378e00,
-			0x32659bb328ccfc00,
-			0x32626f59b052ba00,
-			0x325f42acca09e400,
-			0x325c15ac7b342800,
-			0x3258e858c913b800,
-			0x3255bab1b8eb5600,
-			0x32528cb74ffe4400,
-			0x324f5e6993905600,
-			0x324c2fc888e5ea00,
-			0x324900d43543e600,
-			0x3245d18c9defba00,
-			0x3242a1f1c82f6600,
-			0x323f7203b9496000,
-			0x323c41c27684c000,
-			0x3239112e05291a00,
-			0x3235e0466a7e9000,
-			0x3232af0babcdd200,
-			0x322f7d7dce600400,
-			0x322c4b9cd77efc00,
-			0x32291968cc74ea00,
-			0x3225e6e1b28cb400,
-			0x3222b4078f11a800,
-			0x321f80da674fac00,
-			0x321c4d5a40933800,
-			0x3219198720292e00,
-			0x3215e5610b5f2600,
-			0x3212b0e807831600,
-			0x320f7c1c19e3a600,
-			0x320c46fd47cfe200,
-			0x3209118b96977600,
-			0x3205dbc70b8a9400,
-			0x3202a5afabf9e800,
-			0x31ff6f457d36c600,
-			0x31fc38888492ea00,
-			0x31f90178c760ac00,
-			0x31f5ca164af2ea00,
-			0x31f29261149d0800,
-			0x31ef5a5929b2fa00,
-			0x31ec21fe8f893000,
-			0x31e8e9514b74ae00,
-			0x31e5b05162cafc00,
-			0x31e276fedae22e00,
-			0x31df3d59b910de00,
-			0x31dc036202ae3600,
-			0x31d8c917bd11d800,
-			0x31d58e7aed93fe00,
-			0x31d2538b998d6600,
-			0x31cf1849c6575800,
-			0x31cbdcb5794ba200,
-			0x31c8a0ceb7c49c00,
-			0x31c56495871d2c00,
-			0x31c22809ecb0ae00,
-			0x31beeb2beddb1c00,
-			0x31bbadfb8ff8ee00,
-			0x31b87078d8672600,
-			0x31b532a3cc835400,
-			0x31b1f47c71ab7a00,
-			0x31aeb602cd3e4a00,
-			0x31ab7736e49ad600,
-			0x31a83818bd20d000,
-			0x31a4f8a85c307000,
-			0x31a1b8e5c72a6400,
-			0x319e78d103700200,
-			0x319b386a16630200,
-			0x3197f7b10565d000,
-			0x3194b6a5d5db3400,
-			0x319175488d269a00,
-			0x318e339930abee00,
-			0x318af197c5cfa400,
-			0x3187af4451f6bc00,
-			0x31846c9eda86aa00,
-			0x318129a764e59000,
-			0x317de65df679f000,
-			0x317aa2c294aaec00,
-			0x31775ed544e02400,
-			0x31741a960c81c400,
-			0x3170d604f0f88400,
-			0x316d9121f7ad9200,
-			0x316a4bed260ab400,
-			0x31670666817a3400,
-			0x3163c08e0f66e000,
-			0x31607a63d53c1000,
-			0x315d33e7d865aa00,
-			0x3159ed1a1e500a00,
-			0x3156a5faac682200,
-			0x31535e89881b6600,
-			0x315016c6b6d7d400,
-			0x314cceb23e0bee00,
-			0x3149864c2326c000,
-			0x31463d946b97e200,
-			0x3142f48b1ccf6000,
-			0x313fab303c3de000,
-			0x313c6183cf548c00,
-			0x31391785db851000,
-			0x3135cd366641a600,
-			0x3132829574fcfc00,
-			0x312f37a30d2a6a00,
-			0x312bec5f343daa00,
-			0x3128a0c9efab1200,
-			0x312554e344e77e00,
-			0x312208ab39683e00,
-			0x311ebc21d2a34c00,
-			0x311b6f47160f0000,
-			0x3118221b09226000,
-			0x3114d49db154d600,
-			0x311186cf141e6800,
-			0x310e38af36f7a000,
-			0x310aea3e1f597e00,
-			0x31079b7bd2bda800,
-			0x31044c68569e2200,
-			0x3100fd03b075a600,
-			0x30fdad4de5bf4600,
-			0x30fa5d46fbf6b800,
-			0x30f70ceef8983400,
-			0x30f3bc45e1206200,
-			0x30f06b4bbb0c9a00,
-			0x30ed1a008bda9000,
-			0x30e9c86459089800,
-			0x30e6767728158200,
-			0x30e32438fe80a800,
-			0x30dfd1a9e1c9ee00,
-			0x30dc7ec9d771b000,
-			0x30d92b98e4f8da00,
-			0x30d5d8170fe0e000,
-			0x30d284445dabb800,
-			0x30cf3020d3dbde00,
-			0x30cbdbac77f45c00,
-			0x30c886e74f78a600,
-			0x30c531d15fece400,
-			0x30c1dc6aaed59800,
-			0x30be86b341b7e000,
-			0x30bb30ab1e195c00,
-			0x30b7da5249803000,
-			0x30b483a8c9730e00,
-			0x30b12caea3791400,
-			0x30add563dd1a0e00,
-			0x30aa7dc87bde2600,
-			0x30a725dc854e2600,
-			0x30a3cd9ffef35400,
-			0x30a07512ee576e00,
-			0x309d1c355904d800,
-			0x3099c30744865600,
-			0x30966988b6675800,
-			0x30930fb9b433ae00,
-			0x308fb59a4377c400,
-			0x308c5b2a69c08800,
-			0x3089006a2c9b5c00,
-			0x3085a55991964a00,
-			0x308249f89e3fbe00,
-			0x307eee475826bc00,
-			0x307b9245c4dac600,
-			0x307835f3e9ebe800,
-			0x3074d951cceab800,
-			0x30717c5f73683200,
-			0x306e1f1ce2f60c00,
-			0x306ac18a21264c00,
-			0x306763a7338b9e00,
-			0x306405741fb92400,
-			0x3060a6f0eb428c00,
-			0x305d481d9bbc0c00,
-			0x3059e8fa36ba4a00,
-			0x30568986c1d28800,
-			0x305329c3429a8400,
-			0x304fc9afbea87c00,
-			0x304c694c3b933c00,
-			0x30490898bef21000,
-			0x3045a7954e5cc000,
-			0x30424641ef6ba200,
-			0x303ee49ea7b79400,
-			0x303b82ab7cd9ec00,
-			0x30382068746c9400,
-			0x3034bdd59409e200,
-			0x30315af2e14cd200,
-			0x302df7c061d0c200,
-			0x302a943e1b31ac00,
-			0x3027306c130c0200,
-			0x3023cc4a4efcc000,
-			0x302067d8d4a16800,
-			0x301d0317a997ee00,
-			0x30199e06d37eec00,
-			0x301638a657f55a00,
-			0x3012d2f63c9acc00,
-			0x300f6cf6870f5400,
-			0x300c06a73cf38800,
-			0x3008a00863e88600,
-			0x3005391a018fda00,
-			0x3001d1dc1b8bb800,
-			0x2ffe6a4eb77eba00,
-			0x2ffb0271db0c0600,
-			0x2ff79a458bd74e00,
-			0x2ff431c9cf84bc00,
-			0x2ff0c8feabb90a00,
-			0x2fed5fe426196000,
-			0x2fe9f67a444b8200,
-			0x2fe68cc10bf5aa00,
-			0x2fe322b882be9a00,
-			0x2fdfb860ae4d9200,
-			0x2fdc4db9944a5a00,
-			0x2fd8e2c33a5d4200,
-			0x2fd5777da62f0e00,
-			0x2fd20be8dd691200,
-			0x2fcea004e5b52200,
-			0x2fcb33d1c4bd9400,
-			0x2fc7c74f802d4400,
-			0x2fc45a7e1daf9000,
-			0x2fc0ed5da2f05200,
-			0x2fbd7fee159bf000,
-			0x2fba122f7b5f5000,
-			0x2fb6a421d9e7da00,
-			0x2fb335c536e37e00,
-			0x2fafc71998009c00,
-			0x2fac581f02ee3c00,
-			0x2fa8e8d57d5bbe00,
-			0x2fa5793d0cf92000,
-			0x2fa20955b776e200,
-			0x2f9e991f8285ec00,
-			0x2f9b289a73d7d400,
-			0x2f97b7c6911e8800,
-			0x2f9446a3e00c9e00,
-			0x2f90d53266550c00,
-			0x2f8d637229ab6000,
-			0x2f89f1632fc3ac00,
-			0x2f867f057e526c00,
-			0x2f830c591b0cc400,
-			0x2f7f995e0ba83200,
-			0x2f7c261455dae200,
-			0x2f78b27bff5b5600,
-			0x2f753e950de0ac00,
-			0x2f71ca5f87228800,
-			0x2f6e55db70d8f600,
-			0x2f6ae108d0bca800,
-			0x2f676be7ac86ae00,
-			0x2f63f67809f0b600,
-			0x2f6080b9eeb4e200,
-			0x2f5d0aad608dd800,
-			0x2f5994526536c000,
-			0x2f561da9026b4e00,
-			0x2f52a6b13de7a000,
-			0x2f4f2f6b1d686c00,
-			0x2f4bb7d6a6aae200,
-			0x2f483ff3df6cb400,
-			0x2f44c7c2cd6c1400,
-			0x2f414f437667b800,
-			0x2f3dd675e01edc00,
-			0x2f3a5d5a10512e00,
-			0x2f36e3f00cbeec00,
-			0x2f336a37db28d400,
-			0x2f2ff03181502000,
-			0x2f2c75dd04f69400,
-			0x2f28fb3a6bde6200,
-			0x2f258049bbca5c00,
-			0x2f22050afa7db800,
-			0x2f1e897e2dbc3e00,
-			0x2f1b0da35b4a3800,
-			0x2f17917a88ec5a00,
-			0x2f141503bc680200,
-			0x2f10983efb82e200,
-			0x2f0d1b2c4c035a00,
-			0x2f099dcbb3b02400,
-			0x2f06201d38509000,
-			0x2f02a220dfac7000,
-			0x2eff23d6af8c0200,
-			0x2efba53eadb82800,
-			0x2ef82658dffa1c00,
-			0x2ef4a7254c1bc400,
-			0x2ef127a3f7e75e00,
-			0x2eeda7d4e927c400,
-			0x2eea27b825a84e00,
-			0x2ee6a74db334ba00,
-			0x2ee3269597997400,
-			0x2edfa58fd8a33e00,
-			0x2edc243c7c1f7400,
-			0x2ed8a29b87dbea00,
-			0x2ed520ad01a6f600,
-			0x2ed19e70ef4f7200,
-			0x2ece1be756a4ac00,
-			0x2eca99103d767c00,
-			0x2ec715eba9953c00,
-			0x2ec39279a0d1c400,
-			0x2ec00eba28fd6a00,
-			0x2ebc8aad47ea0c00,
-			0x2eb906530369f600,
-			0x2eb581ab61500600,
-			0x2eb1fcb6676f9400,
-			0x2eae77741b9c7a00,
-			0x2eaaf1e483ab0e00,
-			0x2ea76c07a5702a00,
-			0x2ea3e5dd86c12c00,
-			0x2ea05f662d73e000,
-			0x2e9cd8a19f5ea200,
-			0x2e99518fe2584e00,
-			0x2e95ca30fc383800,
-			0x2e924284f2d64000,
-			0x2e8eba8bcc0aaa00,
-			0x2e8b32458dae6400,
-			0x2e87a9b23d9ab000,
-			0x2e8420d1e1a97800,
-			0x2e8097a47fb50200,
-			0x2e7d0e2a1d982a00,
-			0x2e798462c12e4800,
-			0x2e75fa4e70532000,
-			0x2e726fed30e31e00,
-			0x2e6ee53f08bb0400,
-			0x2e6b5a43fdb82600,
-			0x2e67cefc15b85a00,
-			0x2e6443675699f200,
-			0x2e60b785c63bbe00,
-			0x2e5d2b576a7d0200,
-			0x2e599edc493da200,
-			0x2e561214685dd800,
-			0x2e5284ffcdbe7a00,
-			0x2e4ef79e7f40d200,
-			0x2e4b69f082c6aa00,
-			0x2e47dbf5de325400,
-			0x2e444dae97668a00,
-			0x2e40bf1ab4469c00,
-			0x2e3d303a3ab65200,
-			0x2e39a10d3099ec00,
-			0x2e3611939bd63400,
-			0x2e3281cd82506e00,
-			0x2e2ef1bae9ee5200,
-			0x2e2b615bd8962600,
-			0x2e27d0b0542ea800,
-			0x2e243fb8629f1600,
-			0x2e20ae7409cf3200,
-			0x2e1d1ce34fa72400,
-			0x2e198b063a0fbe00,
-			0x2e15f8dccef22600,
-			0x2e12666714381400,
-			0x2e0ed3a50fcbc000,
-			0x2e0b4096c797dc00,
-			0x2e07ad3c41879c00,
-			0x2e0419958386a000,
-			0x2e0085a293812c00,
-			0x2dfcf1637763d800,
-			0x2df95cd8351bd600,
-			0x2df5c800d296d200,
-			0x2df232dd55c2e200,
-			0x2dee9d6dc48ebc00,
-			0x2deb07b224e97000,
-			0x2de771aa7cc2b200,
-			0x2de3db56d20a9000,
-			0x2de044b72ab1a800,
-			0x2ddcadcb8ca91600,
-			0x2dd91693fde27000,
-			0x2dd57f10844fce00,
-			0x2dd1e74125e3bc00,
-			0x2dce4f25e8914c00,
-			0x2dcab6bed24c0a00,
-			0x2dc71e0be9080800,
-			0x2dc3850d32b9c800,
-			0x2dbfebc2b5565400,
-			0x2dbc522c76d33400,
-			0x2db8b84a7d265e00,
-			0x2db51e1cce465800,
-			0x2db183a3702a1c00,
-			0x2dade8de68c92400,
-			0x2daa4dcdbe1b6600,
-			0x2da6b27176195e00,
-			0x2da316c996bbee00,
-			0x2d9f7ad625fc8e00,
-			0x2d9bde9729d52600,
-			0x2d98420ca8402000,
-			0x2d94a536a7386600,
-			0x2d9108152cb94a00,
-			0x2d8d6aa83ebec400,
-			0x2d89ccefe3451e00,
-			0x2d862eec20493600,
-			0x2d82909cfbc86800,
-			0x2d7ef2027bc07a00,
-			0x2d7b531ca62fcc00,
-			0x2d77b3eb81151800,
-			0x2d74146f126fbe00,
-			0x2d7074a7603f7200,
-			0x2d6cd49470847a00,
-			0x2d693436493f9e00,
-			0x2d65938cf0720800,
-			0x2d61f2986c1d8600,
-			0x2d5e5158c2443600,
-			0x2d5aafcdf8e8e000,
-			0x2d570df8160ea200,
-			0x2d536bd71fb92800,
-			0x2d4fc96b1beca000,
-			0x2d4c26b410ad9c00,
-			0x2d4883b204015000,
-			0x2d44e064fbed4600,
-			0x2d413cccfe779a00,
-			0x2d3d98ea11a6e000,
-			0x2d39f4bc3b822800,
-			0x2d36504382110400,
-			0x2d32ab7feb5b6c00,
-			0x2d2f06717d69ea00,
-			0x2d2b61183e457e00,
-			0x2d27bb7433f7a400,
-			0x2d241585648a5200,
-			0x2d206f4bd607fa00,
-			0x2d1cc8c78e7b9000,
-			0x2d1921f893f07400,
-			0x2d157adeec729200,
-			0x2d11d37a9e0e4800,
-			0x2d0e2bcbaed07800,
-			0x2d0a83d224c67600,
-			0x2d06db8e05fe2000,
-			0x2d0332ff5885b000,
-			0x2cff8a26226c0e00,
-			0x2cfbe10269c06a00,
-			0x2cf8379434928e00,
-			0x2cf48ddb88f2be00,
-			0x2cf0e3d86cf1a000,
-			0x2ced398ae6a07e00,
-			0x2ce98ef2fc10f200,
-			0x2ce5e410b3553c00,
-			0x2ce238e4127ff000,
-			0x2cde8d6d1fa43600,
-			0x2cdae1abe0d5ae00,
-			0x2cd735a05c285e00,
-			0x2cd3894a97b0ee00,
-			0x2ccfdcaa99845200,
-			0x2ccc2fc067b82c00,
-			0x2cc8828c08626800,
-			0x2cc4d50d81998e00,
-			0x2cc12744d9749a00,
-			0x2cbd7932160aec00,
-			0x2cb9cad53d748a00,
-			0x2cb61c2e55c9ca00,
-			0x2cb26d3d65239400,
-			0x2caebe02719b4600,
-			0x2cab0e7d814ab800,
-			0x2ca75eae9a4c4200,
-			0x2ca3ae95c2baa400,
-			0x2c9ffe3300b12c00,
-			0x2c9c4d865a4b9c00,
-			0x2c989c8fd5a63000,
-			0x2c94eb4f78dd9c00,
-			0x2c9139c54a0f1a00,
-			0x2c8d87f14f584600,
-			0x2c89d5d38ed74c00,
-			0x2c86236c0eaacc00,
-			0x2c8270bad4f1de00,
-			0x2c7ebdbfe7cc1600,
-			0x2c7b0a7b4d598200,
-			0x2c7756ed0bbaae00,
-			0x2c73a31529109000,
-			0x2c6feef3ab7ca800,
-			0x2c6c3a889920ee00,
-			0x2c6885d3f81fd000,
-			0x2c64d0d5ce9c3a00,
-			0x2c611b8e22b97e00,
-			0x2c5d65fcfa9b9200,
-			0x2c59b0225c66ba00,
-			0x2c55f9fe4e3fc800,
-			0x2c524390d64c0e00,
-			0x2c4e8cd9fab13e00,
-			0x2c4ad5d9c195a800,
-			0x2c471e90311fee00,
-			0x2c4366fd4f775400,
-			0x2c3faf2122c37200,
-			0x2c3bf6fbb12c7000,
-			0x2c383e8d00daea00,
-			0x2c3485d517f7f400,
-			0x2c30ccd3fcad2000,
-			0x2c2d1389b5246400,
-			0x2c2959f647885a00,
-			0x2c25a019ba03e600,
-			0x2c21e5f412c28400,
-			0x2c1e2b8557f01c00,
-			0x2c1a70cd8fb91600,
-			0x2c16b5ccc04a5200,
-			0x2c12fa82efd11c00,
-			0x2c0f3ef0247b4800,
-			0x2c0b831464772000,
-			0x2c07c6efb5f36400,
-			0x2c040a821f1f4c00,
-			0x2c004dcba62a9000,
-			0x2bfc90cc51455400,
-			0x2bf8d38426a03c00,
-			0x2bf515f32c6c6600,
-			0x2bf1581968db6800,
-			0x2bed99f6e21f5400,
-			0x2be9db8b9e6aa000,
-			0x2be61cd7a3f05e00,
-			0x2be25ddaf8e3f800,
-			0x2bde9e95a3795e00,
-			0x2bdadf07a9e4fa00,
-			0x2bd71f31125bac00,
-			0x2bd35f11e312d000,
-			0x2bcf9eaa22402400,
-			0x2bcbddf9d61a0c00,
-			0x2bc81d0104d73200,
-			0x2bc45bbfb4aed600,
-			0x2bc09a35ebd8ae00,
-			0x2bbcd863b08cd200,
-			0x2bb916490903fa00,
-			0x2bb553e5fb772600,
-			0x2bb1913a8e1ffc00,
-			0x2badce46c7387600,
-			0x2baa0b0aacfb1800,
-			0x2ba6478645a2de00,
-			0x2ba283b9976b2800,
-			0x2b9ebfa4a88ff400,
-			0x2b9afb477f4d9000,
-			0x2b9736a221e0d400,
-			0x2b9371b496871400,
-			0x2b8fac7ee37e1000,
-			0x2b8be7010f040e00,
-			0x2b88213b1f57ae00,
-			0x2b845b2d1ab83600,
-			0x2b8094d707653600,
-			0x2b7cce38eb9ece00,
-			0x2b790752cda59000,
-			0x2b754024b3ba8400,
-			0x2b7178aea41f2c00,
-			0x2b6db0f0a5158200,
-			0x2b69e8eabcdfec00,
-			0x2b66209cf1c15200,
-			0x2b62580749fd1400,
-			0x2b5e8f29cbd70200,
-			0x2b5ac6047d936e00,
-			0x2b56fc9765770800,
-			0x2b5332e289c71e00,
-			0x2b4f68e5f0c94e00,
-			0x2b4b9ea1a0c3c400,
-			0x2b47d4159ffd2400,
-			0x2b440941f4bc6c00,
-			0x2b403e26a5494000,
-			0x2b3c72c3b7eb8800,
-			0x2b38a71932ebd400,
-			0x2b34db271c92fe00,
-			0x2b310eed7b2a7000,
-			0x2b2d426c54fc0c00,
-			0x2b2975a3b0521000,
-			0x2b25a89393775e00,
-			0x2b21db3c04b71800,
-			0x2b1e0d9d0a5d0c00,
-			0x2b1a3fb6aab55200,
-			0x2b167188ec0c9000,
-			0x2b12a313d4afe600,
-			0x2b0ed4576aecca00,
-			0x2b0b0553b5115a00,
-			0x2b073608b96bfa00,
-			0x2b0366767e4ba400,
-			0x2aff969d09ffb800,
-			0x2afbc67c62d81600,
-			0x2af7f6148f251000,
-			0x2af4256595376200,
-			0x2af0546f7b605000,
-			0x2aec833247f18c00,
-			0x2ae8b1ae013d3c00,
-			0x2ae4dfe2ad960000,
-			0x2ae10dd0534eec00,
-			0x2add3b76f8bb8c00,
-			0x2ad968d6a42fd400,
-			0x2ad595ef5c003e00,
-			0x2ad1c2c12681b400,
-			0x2acdef4c0a099400,
-			0x2aca1b900cedb200,
-			0x2ac6478d35846000,
-			0x2ac273438a245000,
-			0x2abe9eb31124ba00,
-			0x2abac9dbd0dd4c00,
-			0x2ab6f4bdcfa62000,
-			0x2ab31f5913d7d400,
-			0x2aaf49ada3cb5c00,
-			0x2aab73bb85da5000,
-			0x2aa79d82c05e9000,
-			0x2aa3c70359b28c00,
-			0x2a9ff03d58312000,
-			0x2a9c1930c2359c00,
-			0x2a9841dd9e1bd000,
-			0x2a946a43f23fe600,
-			0x2a909263c4fea200,
-			0x2a8cba3d1cb51600,
-			0x2a88e1cfffc0f200,
-			0x2a85091c74803200,
-			0x2a81302281516000,
-			0x2a7d56e22c937c00,
-			0x2a797d5b7ca5dc00,
-			0x2a75a38e77e87c00,
-			0x2a71c97b24bb9c00,
-			0x2a6def2189801000,
-			0x2a6a1481ac971400,
-			0x2a66399b94625c00,
-			0x2a625e6f47441200,
-			0x2a5e82fccb9ec600,
-			0x2a5aa74427d58e00,
-			0x2a56cb45624bec00,
-			0x2a52ef008165d800,
-			0x2a4f12758b87c000,
-			0x2a4b35a487168000,
-			0x2a47588d7a777400,
-			0x2a437b306c105600,
-			0x2a3f9d8d62476800,
-			0x2a3bbfa463835c00,
-			0x2a37e175762b5000,
-			0x2a340300a0a6e000,
-			0x2a302445e95e1a00,
-			0x2a2c454556b97000,
-			0x2a2865feef21dc00,
-			0x2a248672b900c400,
-			0x2a20a6a0bac00000,
-			0x2a1cc688fac9e200,
-			0x2a18e62b7f891c00,
-			0x2a1505884f68f600,
-			0x2a11249f70d50800,
-			0x2a0d4370ea397200,
-			0x2a0961fcc202c800,
-			0x2a058042fe9df800,
-			0x2a019e43a6789000,
-			0x29fdbbfec0006000,
-			0x29f9d97451a3da00,
-			0x29f5f6a461d1bc00,
-			0x29f2138ef6f94a00,
-			0x29ee3034178a4200,
-			0x29ea4c93c9f4b600,
-			0x29e668ae14a95a00,
-			0x29e28482fe192400,
-			0x29dea0128cb5aa00,
-			0x29dabb5cc6f0cc00,
-			0x29d6d661b33cfa00,
-			0x29d2f121580d0e00,
-			0x29cf0b9bbbd44400,
-			0x29cb25d0e5067000,
-			0x29c73fc0da17b200,
-			0x29c3596ba17cb400,
-			0x29bf72d141aa8800,
-			0x29bb8bf1c116b800,
-			0x29b7a4cd26373e00,
-			0x29b3bd6377828e00,
-			0x29afd5b4bb6f7c00,
-			0x29abedc0f8755e00,
-			0x29a80588350bf800,
-			0x29a41d0a77ab8200,
-			0x29a03447c6cca400,
-			0x299c4b4028e87600,
-			0x299861f3a4788e00,
-			0x299478623ff6de00,
-			0x29908e8c01ddde00,
-			0x298ca470f0a86e00,
-			0x2988ba1112d1e400,
-			0x2984cf6c6ed60e00,
-			0x2980e4830b311200,
-			0x297cf954ee5fb200,
-			0x29790de21edefa00,
-			0x2975222aa32c7c00,
-			0x2971362e81c64000,
-			0x296d49edc12aa400,
-			0x29695d6867d8a200,
-			0x2965709e7c4f7800,
-			0x29618390050f0400,
-			0x295d963d08976c00,
-			0x2959a8a58d696000,
-			0x2955bac99a060000,
-			0x2951cca934eec400,
-			0x294dde4464a5c400,
-			0x2949ef9b2fad5400,
-			0x294600ad9c886e00,
-			0x2942117bb1ba5200,
-			0x293e220575c6c400,
-			0x293a324aef320200,
-			0x2936424c24809a00,
-			0x293252091c37be00,
-			0x292e6181dcdcde00,
-			0x292a70b66cf5fc00,
-			0x29267fa6d3097c00,
-			0x29228e53159e3a00,
-			0x291e9cbb3b3b8400,
-			0x291aaadf4a690a00,
-			0x2916b8bf49aefe00,
-			0x2912c65b3f95fc00,
-			0x290ed3b332a71000,
-			0x290ae0c7296bb800,
-			0x2906ed972a6de800,
-			0x2902fa233c37f200,
-			0x28ff066b6554ae00,
-			0x28fb126fac4f5800,
-			0x28f71e3017b3a000,
-			0x28f329acae0da800,
-			0x28ef34e575ea0200,
-			0x28eb3fda75d5b200,
-			0x28e74a8bb45e1800,
-			0x28e354f938112e00,
-			0x28df5f23077d3400,
-			0x28db69092930f000,
-			0x28d772aba3bb9a00,
-			0x28d37c0a7dacc200,
-			0x28cf8525bd949200,
-			0x28cb8dfd6a037400,
-			0x28c79691898a7000,
-			0x28c39ee222bad600,
-			0x28bfa6ef3c267e00,
-			0x28bbaeb8dc5fae00,
-			0x28b7b63f09f90400,
-			0x28b3bd81cb85ba00,
-			0x28afc48127994e00,
-			0x28abcb3d24c7c400,
-			0x28a7d1b5c9a58c00,
-			0x28a3d7eb1cc78400,
-			0x289fdddd24c30200,
-			0x289be38be82db000,
-			0x2897e8f76d9dd200,
-			0x2893ee1fbba9f400,
-			0x288ff304d8e92600,
-			0x288bf7a6cbf2e600,
-			0x2887fc059b5f1a00,
-			0x288400214dc62400,
-			0x288003f9e9c0be00,
-			0x287c078f75e82800,
-			0x28780ae1f8d60800,
-			0x28740df179247200,
-			0x287010bdfd6dea00,
-			0x286c13478c4d6c00,
-			0x2868158e2c5e4c00,
-			0x28641791e43c6400,
-			0x28601952ba83f000,
-			0x285c1ad0b5d1a000,
-			0x28581c0bdcc29800,
-			0x28541d0435f45000,
-			0x28501db9c804de00,
-			0x284c1e2c99929600,
-			0x28481e5cb13c5800,
-			0x28441e4a15a16800,
-			0x28401df4cd617c00,
-			0x283c1d5cdf1cbc00,
-			0x28381c825173a800,
-			0x28341b652b075800,
-			0x28301a0572792800,
-			0x282c18632e6afa00,
-			0x2828167e657f1e00,
-			0x282414571e583a00,
-			0x282011ed5f998c00,
-			0x281c0f412fe69400,
-			0x28180c5295e36a00,
-			0x2814092198346e00,
-			0x281005ae3d7e8400,
-			0x280c01f88c66f800,
-			0x2807fe008b938400,
-			0x2803f9c641aa5800,
-			0x27fff549b551fc00,
-			0x27fbf08aed317a00,
-			0x27f7eb89eff04400,
-			0x27f3e646c4363a00,
-			0x27efe0c170aba600,
-			0x27ebdaf9fbf94200,
-			0x27e7d4f06cc83e00,
-			0x27e3cea4c9c22000,
-			0x27dfc8171990f400,
-			0x27dbc14762df2800,
-			0x27d7ba35ac579800,
-			0x27d3b2e1fca58e00,
-			0x27cfab4c5a74cc00,
-			0x27cba374cc716600,
-			0x27c79b5b5947f400,
-			0x27c3930007a57a00,
-			0x27bf8a62de376000,
-			0x27bb8183e3ab8600,
-			0x27b778631eb02000,
-			0x27b36f0095f3fa00,
-			0x27af655c50262000,
-			0x27ab5b7653f62800,
-			0x27a7514ea8141000,
-			0x27a346e553302c00,
-			0x279f3c3a5bfb6800,
-			0x279b314dc926ec00,
-			0x2797261fa1647c00,
-			0x27931aafeb661e00,
-			0x278f0efeadde6000,
-			0x278b030bef803800,
-			0x2786f6d7b6fef400,
-			0x2782ea620b0e7600,
-			0x277eddaaf262de00,
-			0x277ad0b273b0e800,
-			0x2776c37895ad9000,
-			0x2772b5fd5f0e5a00,
-			0x276ea840d6893600,
-			0x276a9a4302d46400,
-			0x27668c03eaa6be00,
-			0x27627d8394b75e00,
-			0x275e6ec207bde400,
-			0x275a5fbf4a725200,
-			0x2756507b638d1c00,
-			0x275240f659c72600,
-			0x274e313033d9a800,
-			0x274a2128f87e5e00,
-			0x274610e0ae6f6800,
-			0x274200575c675400,
-			0x273def8d09211600,
-			0x2739de81bb581400,
-			0x2735cd3579c81c00,
-			0x2731bba84b2d7000,
-			0x272da9da3644a400,
-			0x272997cb41cad600,
-			0x2725857b747d7e00,
-			0x272172ead51a8800,
-			0x271d60196a604a00,
-			0x27194d073b0d7000,
-			0x271539b44de14000,
-			0x27112620a99b3a00,
-			0x270d124c54fb6600,
-			0x2708fe3756c23600,
-			0x2704e9e1b5b06c00,
-			0x2700d54b78876200,
-			0x26fcc074a608ac00,
-			0x26f8ab5d44f67e00,
-			0x26f496055c134200,
-			0x26f0806cf221f000,
-			0x26ec6a940de5e200,
-			0x26e8547ab622cc00,
-			0x26e43e20f19cf200,
-			0x26e02786c718d600,
-			0x26dc10ac3d5b9000,
-			0x26d7f9915b2a7c00,
-			0x26d3e236274b7800,
-			0x26cfca9aa884ce00,
-			0x26cbb2bee59d1800,
-			0x26c79aa2e55b8400,
-			0x26c38246ae878400,
-			0x26bf69aa47e90800,
-			0x26bb50cdb8486800,
-			0x26b737b1066e6200,
-			0x26b31e5439242a00,
-			0x26af04b757334600,
-			0x26aaeada6765bc00,
-			0x26a6d0bd7085f600,
-			0x26a2b660795ec400,
-			0x269e9bc388bb6800,
-			0x269a80e6a5678a00,
-			0x269665c9d62f3200,
-			0x26924a6d21dee000,
-			0x268e2ed08f437800,
-			0x268a12f4252a4800,
-			0x2685f6d7ea610800,
-			0x2681da7be5b5da00,
-			0x267dbde01df75000,
-			0x2679a10499f45200,
-			0x267583e9607c4400,
-			0x2671668e785eee00,
-			0x266d48f3e86c8200,
-			0x26692b19b775a200,
-			0x26650cffec4b3c00,
-			0x2660eea68dbeda00,
-			0x265cd00da2a23c00,
-			0x2658b13531c7ac00,
-			0x2654921d4201d200,
-			0x265072c5da23be00,
-			0x264c532f0100f400,
-			0x26483358bd6d4400,
-			0x26441343163d1600,
-			0x263ff2ee12450c00,
-			0x263bd259b85a4c00,
-			0x2637b1860f526000,
-			0x263390731e033600,
-			0x262f6f20eb433000,
-			0x262b4d8f7de8fc00,
-			0x26272bbedccbe000,
-			0x262309af0ec35c00,
-			0x261ee7601aa77200,
-			0x261ac4d207508800,
-			0x2616a204db976c00,
-			0x26127ef89e555a00,
-			0x260e5bad5663e400,
-			0x260a38230a9d1600,
-			0x26061459c1db6000,
-			0x2601f05182f99800,
-			0x25fdcc0a54d30000,
-			0x25f9a7843e434600,
-			0x25f582bf46266c00,
-			0x25f15dbb7358f000,
-			0x25ed3878ccb7b400,
-			0x25e912f759200000,
-			0x25e4ed371f6f8c00,
-			0x25e0c73826845a00,
-			0x25dca0fa753d0600,
-			0x25d87a7e12786200,
-			0x25d453c30515c800,
-			0x25d02cc953f4ee00,
-			0x25cc059105f5f200,
-			0x25c7de1a21f96400,
-			0x25c3b664aee01c00,
-			0x25bf8e70b38b8e00,
-			0x25bb663e36dd6000,
-			0x25b73dcd3fb7c200,
-			0x25b3151dd4fd4400,
-			0x25aeec2ffd90c800,
-			0x25aac303c055c200,
-			0x25a69999242fde00,
-			0x25a26ff030035c00,
-			0x259e4608eab4be00,
-			0x259a1be35b28fe00,
-			0x2595f17f88458800,
-			0x2591c6dd78f00a00,
-			0x258d9bfd340ece00,
-			0x258970dec0885600,
-			0x258545822543a400,
-			0x258119e769281800,
-			0x257cee0e931d8000,
-			0x2578c1f7aa0c1000,
-			0x257495a2b4dc4c00,
-			0x2570690fba774c00,
-			0x256c3c3ec1c66000,
-			0x25680f2fd1b35c00,
-			0x2563e1e2f1287200,
-			0x255fb45827103800,
-			0x255b868f7a55ae00,
-			0x25575888f1e44000,
-			0x25532a4494a7ae00,
-			0x254efbc2698c2e00,
-			0x254acd02777e5c00,
-			0x25469e04c56b3400,
-			0x25426ec95a402200,
-			0x253e3f503ceae000,
-			0x253a0f997459b800,
-			0x2535dfa5077b2c00,
-			0x2531af72fd3e4400,
-			0x252d7f035c926800,
-			0x25294e562c674c00,
-			0x25251d6b73ad3e00,
-			0x2520ec433954b800,
-			0x251cbadd844ece00,
-			0x2518893a5b8cd000,
-			0x25145759c6008800,
-			0x2510253bca9c2c00,
-			0x250bf2e070523800,
-			0x2507c047be15c000,
-			0x25038d71bada0800,
-			0x24ff5a5e6d92ec00,
-			0x24fb270ddd348000,
-			0x24f6f38010b35a00,
-			0x24f2bfb50f047200,
-			0x24ee8bacdf1d0e00,
-			0x24ea576787f30800,
-			0x24e622e5107c6c00,
-			0x24e1ee257fafcc00,
-			0x24ddb928dc841400,
-			0x24d983ef2df09600,
-			0x24d54e787aed1400,
-			0x24d118c4ca719a00,
-			0x24cce2d42376b000,
-			0x24c8aca68cf54000,
-			0x24c4763c0de69400,
-			0x24c03f94ad445c00,
-			0x24bc08b07208ae00,
-			0x24b7d18f632e0c00,
-			0x24b39a3187af4400,
-			0x24af6296e687a400,
-			0x24ab2abf86b2d200,
-			0x24a6f2ab6f2cdc00,
-			0x24a2ba5aa6f23000,
-			0x249e81cd34ffb000,
-			0x249a490320528400,
-			0x24960ffc6fe85200,
-			0x2491d6b92abf2000,
-			0x248d9d3957d55000,
-			0x2489637cfe29ba00,
-			0x2485298424bb7800,
-			0x2480ef4ed28a3600,
-			0x247cb4dd0e95d200,
-			0x24787a2edfdec600,
-			0x24743f444d65bc00,
-			0x2470041d5e2bde00,
-			0x246bc8ba1932bc00,
-			0x24678d1a857c2e00,
-			0x2463513eaa0a9e00,
-			0x245f15268de0a600,
-			0x245ad8d238017800,
-			0x24569c41af707a00,
-			0x24525f74fb319200,
-			0x244e226c22490a00,
-			0x2449e5272bbb7400,
-			0x2445a7a61e8df400,
-			0x244169e901c5e400,
-			0x243d2befdc691800,
-			0x2438edbab57dc800,
-			0x2434af49940a8a00,
-			0x2430709c7f165e00,
-			0x242c31b37da89800,
-			0x2427f28e96c8fc00,
-			0x2423b32dd17fb000,
-			0x241f739134d53c00,
-			0x241b33b8c7d28800,
-			0x2416f3a49180ec00,
-			0x2412b35498ea0a00,
-			0x240e72c8e517fc00,
-			0x240a32017d153800,
-			0x2405f0fe67ec9600,
-			0x2401afbfaca95600,
-			0x23fd6e4552571400,
-			0x23f92c8f6001d800,
-			0x23f4ea9ddcb5fc00,
-			0x23f0a870cf804a00,
-			0x23ec66083f6dee00,
-			0x23e82364338c7200,
-			0x23e3e084b2e9ce00,
-			0x23df9d69c4943e00,
-			0x23db5a136f9a8e00,
-			0x23d71681bb0bc200,
-			0x23d2d2b4adf75800,
-			0x23ce8eac4f6d3200,
-			0x23ca4a68a67d7800,
-			0x23c605e9ba38e200,
-			0x23c1c12f91b05800,
-			0x23bd7c3a33f55800,
-			0x23b93709a8199200,
-			0x23b4f19df52f3400,
-			0x23b0abf72248cc00,
-			0x23ac661536793400,
-			0x23a81ff838d3d000,
-			0x23a3d9a0306c3800,
-			0x239f930d24569200,
-			0x239b4c3f1ba74000,
-			0x239705361d731c00,
-			0x2392bdf230cf5800,
-			0x238e76735cd19000,
-			0x238a2eb9a88fbe00,
-			0x2385e6c51b203000,
-			0x23819e95bb99ac00,
-			0x237d562b91134800,
-			0x23790d86a2a48800,
-			0x2374c4a6f7654a00,
-			0x23707b8c966dd200,
-			0x236c323786d6ba00,
-			0x2367e8a7cfb90600,
-			0x23639edd782e1e00,
-			0x235f54d8874fc800,
-			0x235b0a9904382e00,
-			0x2356c01ef601c400,
-			0x2352756a63c78e00,
-			0x234e2a7b54a4c000,
-			0x2349df51cfb50a00,
-			0x234593eddc147a00,
-			0x2341484f80df7800,
-			0x233cfc76c532da00,
-			0x2338b063b02bb600,
-			0x2334641648e7b600,
-			0x2330178e9684b200,
-			0x232bcacca0210200,
-			0x23277dd06cdb5a00,
-			0x2323309a03d2b600,
-			0x231ee3296c26a000,
-			0x231a957eacf6ce00,
-			0x23164799cd638c00,
-			0x2311f97ad48d5600,
-			0x230dab21c9952400,
-			0x23095c8eb39c4e00,
-			0x23050dc199c47000,
-			0x2300beba832fb600,
-			0x22fc6f7977007e00,
-			0x22f81ffe7c59a200,
-			0x22f3d0499a5e5000,
-			0x22ef805ad8321a00,
-			0x22eb30323cf8f800,
-			0x22e6dfcfcfd72600,
-			0x22e28f3397f17200,
-			0x22de3e5d9c6cd400,
-			0x22d9ed4de46ec600,
-			0x22d59c04771d1600,
-			0x22d14a815b9df200,
-			0x22ccf8c49917f000,
-			0x22c8a6ce36b1f000,
-			0x22c4549e3b934800,
-			0x22c00234aee3a400,
-			0x22bbaf9197cb0e00,
-			0x22b75cb4fd71f400,
-			0x22b3099ee7012400,
-			0x22aeb64f5ba1b800,
-			0x22aa62c6627d5000,
-			0x22a60f0402bdc200,
-			0x22a1bb08438d5a00,
-			0x229d66d32c16c600,
-			0x22991264c384f800,
-			0x2294bdbd11036c00,
-			0x229068dc1bbdcc00,
-			0x228c13c1eae05200,
-			0x2287be6e85976e00,
-			0x228368e1f3100400,
-			0x227f131c3a775600,
-			0x227abd1d62faf000,
-			0x227666e573c8e600,
-			0x22721074740f7600,
-			0x226db9ca6afd7400,
-			0x226962e75fc1e200,
-			0x22650bcb598c3a00,
-			0x2260b4765f8c5a00,
-			0x225c5ce878f25a00,
-			0x22580521aceeea00,
-			0x2253ad2202b2de00,
-			0x224f54e9816f8e00,
-			0x224afc783056a200,
-			0x2246a3ce169a2200,
-			0x22424aeb3b6c7a00,
-			0x223df1cfa6005e00,
-			0x2239987b5d890600,
-			0x22353eee6939e200,
-			0x2230e528d046d600,
-			0x222c8b2a99e41c00,
-			0x222830f3cd465000,
-			0x2223d68471a26c00,
-			0x221f7bdc8e2dbc00,
-			0x221b20fc2a1df600,
-			0x2216c5e34ca92a00,
-			0x22126a91fd05c800,
-			0x220e0f08426a9a00,
-			0x2209b346240ece00,
-			0x2205574ba929de00,
-			0x2200fb18d8f3b000,
-			0x21fc9eadbaa48a00,
-			0x21f8420a55750600,
-			0x21f3e52eb09e2600,
-			0x21ef881ad3592e00,
-			0x21eb2acec4dfee00,
-			0x21e6cd4a8c6c6600,
-			0x21e26f8e31390800,
-			0x21de1199ba80a200,
-			0x21d9b36d2f7e5c00,
-			0x21d55508976dc400,
-			0x21d0f66bf98aa800,
-			0x21cc97975d116200,
-			0x21c8388ac93e7a00,
-			0x21c3d946454eee00,
-			0x21bf79c9d8801600,
-			0x21bb1a158a0fa200,
-			0x21b6ba29613ba800,
-			0x21b25a0565428000,
-			0x21adf9a99d630a00,
-			0x21a9991610dc5600,
-			0x21a5384ac6edec00,
-			0x21a0d747c6d7aa00,
-			0x219c760d17d9c400,
-			0x2198149ac134da00,
-			0x2193b2f0ca29ce00,
-			0x218f510f39f9f200,
-			0x218aeef617e6f200,
-			0x21868ca56b32d200,
-			0x21822a1d3b1ff400,
-			0x217dc75d8ef11600,
-			0x217964666de95400,
-			0x21750137df4c1800,
-			0x21709dd1ea5d3a00,
-			0x216c3a349660e600,
-			0x2167d65fea9ba200,
-			0x21637253ee525400,
-			0x215f0e10a8ca4000,
-			0x215aa9962148f600,
-			0x215644e45f147000,
-			0x2151dffb69730200,
-			0x214d7adb47ab5a00,
-			0x2149158401048400,
-			0x2144aff59cc5d000,
-			0x21404a3022371c00,
-			0x213be43398a06a00,
-			0x21377e00074a3600,
-			0x21331795757d5c00,
-			0x212eb0f3ea82ee00,
-			0x212a4a1b6da49200,
-			0x2125e30c062c0c00,
-			0x21217bc5bb63b400,
-			0x211d144894960e00,
-			0x2118ac94990e1200,
-			0x211444a9d0171600,
-			0x210fdc8840fcaa00,
-			0x210b742ff30af000,
-			0x21070ba0ed8e2800,
-			0x2102a2db37d32400,
-			0x20fe39ded926e200,
-			0x20f9d0abd8d6d800,
-			0x20f567423e30d200,
-			0x20f0fda21082de00,
-			0x20ec93cb571b9400,
-			0x20e829be1949b600,
-			0x20e3bf7a5e5c7a00,
-			0x20df55002da36c00,
-			0x20daea4f8e6e7200,
-			0x20d67f68880dd000,
-			0x20d2144b21d21400,
-			0x20cda8f7630c3600,
-			0x20c93d6d530d8400,
-			0x20c4d1acf927a600,
-			0x20c065b65cac9e00,
-			0x20bbf98984eec600,
-			0x20b78d267940d200,
-			0x20b3208d40f5d800,
-			0x20aeb3bde3613200,
-			0x20aa46b867d6aa00,
-			0x20a5d97cd5aa5c00,
-			0x20a16c0b3430bc00,
-			0x209cfe638abea000,
-			0x20989085e0a91c00,
-			0x209422723d45ca00,
-			0x208fb428a7ea7400,
-			0x208b45a927ed5400,
-			0x2086d6f3c4a4fe00,
-			0x2082680885684400,
-			0x207df8e7718e8000,
-			0x20798990906f3200,
-			0x20751a03e9626800,
-			0x2070aa4183c05600,
-			0x206c3a4966e1aa00,
-			0x2067ca1b9a1f6400,
-			0x206359b824d2c800,
-			0x205ee91f0e55a200,
-			0x205a78505e01da00,
-			0x2056074c1b31f000,
-			0x205196124d408600,
-			0x204d24a2fb88b400,
-			0x2048b2fe2d65ee00,
-			0x20444123ea33e000,
-			0x203fcf14394ec400,
-			0x203b5ccf2212f400,
-			0x2036ea54abdd4800,
-			0x203277a4de0ae400,
-			0x202e04bfbff94400,
-			0x202991a559064400,
-			0x20251e55b0900400,
-			0x2020aad0cdf51000,
-			0x201c3716b8944800,
-			0x2017c32777cce200,
-			0x20134f0312fe6800,
-			0x200edaa99188cc00,
-			0x200a661afacc3c00,
-			0x2005f15756295400,
-			0x20017c5eab010200,
-			0x1ffd073100b48c00,
-			0x1ff891ce5ea58f00,
-			0x1ff41c36cc360100,
-			0x1fefa66a50c83400,
-			0x1feb3068f3bec000,
-			0x1fe6ba32bc7ca600,
-			0x1fe243c7b2653a00,
-			0x1fddcd27dcdc2800,
-			0x1fd9565343457700,
-			0x1fd4df49ed056d00,
-			0x1fd0680be180d700,
-			0x1fcbf099281ca100,
-			0x1fc778f1c83e4600,
-			0x1fc30115c94b6700,
-			0x1fbe890532aa1b00,
-			0x1fba10c00bc0cb00,
-			0x1fb598465bf62000,
-			0x1fb11f982ab14800,
-			0x1faca6b57f599800,
-			0x1fa82d9e6156d700,
-			0x1fa3b452d8111d00,
-			0x1f9f3ad2eaf0d900,
-			0x1f9ac11ea15ed600,
-			0x1f96473602c41b00,
-			0x1f91cd19168a3700,
-			0x1f8d52c7e41add00,
-			0x1f88d84272e03400,
-			0x1f845d88ca44b300,
-			0x1f7fe29af1b32600,
-			0x1f7b6778f096b600,
-			0x1f76ec22ce5ad000,
-			0x1f727098926b4900,
-			0x1f6df4da44344800,
-			0x1f6978e7eb224900,
-			0x1f64fcc18ea21e00,
-			0x1f6080673620f700,
-			0x1f5c03d8e90c4400,
-			0x1f578716aed1e100,
-			0x1f530a208edff700,
-			0x1f4e8cf690a50900,
-			0x1f4a0f98bb8ff300,
-			0x1f459207170fcc00,
-			0x1f411441aa943200,
-			0x1f3c96487d8ce800,
-			0x1f38181b976a2300,
-			0x1f3399baff9c6500,
-			0x1f2f1b26bd948700,
-			0x1f2a9c5ed8c3bf00,
-			0x1f261d63589b7b00,
-			0x1f219e34448db000,
-			0x1f1d1ed1a40c7700,
-			0x1f189f3b7e8a5d00,
-			0x1f141f71db7a4000,
-			0x1f0f9f74c24f3b00,
-			0x1f0b1f443a7ced00,
-			0x1f069ee04b771300,
-			0x1f021e48fcb1f700,
-			0x1efd9d7e55a20700,
-			0x1ef91c805dbc2200,
-			0x1ef49b4f1c757d00,
-			0x1ef019ea99438400,
-			0x1eeb9852db9c2900,
-			0x1ee71687eaf58400,
-			0x1ee29489cec61d00,
-			0x1ede12588e84c800,
-			0x1ed98ff431a8ae00,
-			0x1ed50d5cbfa95000,
-			0x1ed08a923ffe7f00,
-			0x1ecc0794ba206b00,
-			0x1ec7846435878000,
-			0x1ec30100b9ac9800,
-			0x1ebe7d6a4e08d700,
-			0x1eb9f9a0fa15b600,
-			0x1eb575a4c54d0300,
-			0x1eb0f175b728e600,
-			0x1eac6d13d723c800,
-			0x1ea7e87f2cb87900,
-			0x1ea363b7bf621900,
-			0x1e9edebd969c1800,
-			0x1e9a5990b9e24600,
-			0x1e95d43130b0a600,
-			0x1e914e9f0283c400,
-			0x1e8cc8da36d84b00,
-			0x1e8842e2d52b5a00,
-			0x1e83bcb8e4fa6000,
-			0x1e7f365c6dc30600,
-			0x1e7aafcd77037900,
-			0x1e76290c083a0100,
-			0x1e71a21828e57400,
-			0x1e6d1af1e084c700,
-			0x1e68939936976000,
-			0x1e640c0e329cfa00,
-			0x1e5f8450dc158400,
-			0x1e5afc613a817600,
-			0x1e56743f55615e00,
-			0x1e51ebeb34365900,
-			0x1e4d6364de81a600,
-			0x1e48daac5bc4f000,
-			0x1e4451c1b3823800,
-			0x1e3fc8a4ed3bb600,
-			0x1e3b3f5610742400,
-			0x1e36b5d524ae6000,
-			0x1e322c22316db600,
-			0x1e2da23d3e35be00,
-			0x1e291826528a6300,
-			0x1e248ddd75efe800,
-			0x1e200362afead000,
-			0x1e1b78b608000500,
-			0x1e16edd785b4bc00,
-			0x1e1262c7308e7d00,
-			0x1e0dd78510132300,
-			0x1e094c112bc8da00,
-			0x1e04c06b8b362800,
-			0x1e00349435e1d200,
-			0x1dfba88b33530200,
-			0x1df71c508b112e00,
-			0x1df28fe444a41f00,
-			0x1dee03466793ef00,
-			0x1de97676fb691200,
-			0x1de4e97607ac3900,
-			0x1de05c4393e67c00,
-			0x1ddbcedfa7a13c00,
-			0x1dd7414a4a662f00,
-			0x1dd2b38383bf6200,
-			0x1dce258b5b371900,
-			0x1dc99761d8581a00,
-			0x1dc5090702ad4400,
-			0x1dc07a7ae1c20100,
-			0x1dbbebbd7d21db00,
-			0x1db75ccedc58c900,
-			0x1db2cdaf06f31500,
-			0x1dae3e5e047d3e00,
-			0x1da9aedbdc844400,
-			0x1da51f2896954300,
-			0x1da08f443a3ddd00,
-			0x1d9bff2ecf0bd700,
-			0x1d976ee85c8d6300,
-			0x1d92de70ea510200,
-			0x1d8e4dc87fe56d00,
-			0x1d89bcef24d9dd00,
-			0x1d852be4e0bdab00,
-			0x1d809aa9bb20a000,
-			0x1d7c093dbb92ca00,
-			0x1d7777a0e9a48d00,
-			0x1d72e5d34ce6a100,
-			0x1d6e53d4ece9fb00,
-			0x1d69c1a5d13ff700,
-			0x1d652f46017a3900,
-			0x1d609cb5852ab700,
-			0x1d5c09f463e3b600,
-			0x1d577702a537d300,
-			0x1d52e3e050b9e900,
-			0x1d4e508d6dfd3400,
-			0x1d49bd0a04953d00,
-			0x1d4529561c15dc00,
-			0x1d409571bc133a00,
-			0x1d3c015cec21cf00,
-			0x1d376d17b3d66b00,
-			0x1d32d8a21ac61900,
-			0x1d2e43fc28864900,
-			0x1d29af25e4acb500,
-			0x1d251a1f56cf6500,
-			0x1d2084e88684bb00,
-			0x1d1bef817b634900,
-			0x1d1759ea3d022500,
-			0x1d12c422d2f88300,
-			0x1d0e2e2b44de0200,
-			0x1d0998039a4a9200,
-			0x1d0501abdad65500,
-			0x1d006b240e19f000,
-			0x1cfbd46c3bae1b00,
-			0x1cf73d846b2c1c00,
-			0x1cf2a66ca42d5300,
-			0x1cee0f24ee4b8c00,
-			0x1ce977ad5120db00,
-			0x1ce4e005d447a600,
-			0x1ce0482e7f5aa700,
-			0x1cdbb02759f4cb00,
-			0x1cd717f06bb18100,
-			0x1cd27f89bc2c5400,
-			0x1ccde6f353013a00,
-			0x1cc94e2d37cc7500,
-			0x1cc4b537722a9100,
-			0x1cc01c1209b87200,
-			0x1cbb82bd06133700,
-			0x1cb6e9386ed86000,
-			0x1cb24f844ba5b800,
-			0x1cadb5a0a4195700,
-			0x1ca91b8d7fd1a300,
-			0x1ca4814ae66d5900,
-			0x1c9fe6d8df8b7000,
-			0x1c9b4c3772cb4000,
-			0x1c96b166a7cc6b00,
-			0x1c921666862ee000,
-			0x1c8d7b371592e500,
-			0x1c88dfd85d98f000,
-			0x1c84444a65e1f800,
-			0x1c7fa88d360f1200,
-			0x1c7b0ca0d5c1ba00,
-			0x1c7670854c9bb600,
-			0x1c71d43aa23f1a00,
-			0x1c6d37c0de4e4d00,
-			0x1c689b18086be900,
-			0x1c63fe40283b0900,
-			0x1c5f6139455ee100,
-			0x1c5ac403677b1300,
-			0x1c56269e96338b00,
-			0x1c51890ad92c6800,
-			0x1c4ceb48380a4b00,
-			0x1c484d56ba71e400,
-			0x1c43af3668087000,
-			0x1c3f10e748734200,
-			0x1c3a726963581b00,
-			0x1c35d3bcc05d0800,
-			0x1c3134e167284600,
-			0x1c2c95d75f609200,
-			0x1c27f69eb0acc600,
-			0x1c23573762b42300,
-			0x1c1eb7a17d1e3200,
-			0x1c1a17dd0792c900,
-			0x1c1577ea09ba1000,
-			0x1c10d7c88b3c6200,
-			0x1c0c377893c29900,
-			0x1c0796fa2af5a900,
-			0x1c02f64d587eef00,
-			0x1bfe557224080e00,
-			0x1bf9b468953af800,
-			0x1bf51330b3c1ef00,
-			0x1bf071ca87476f00,
-			0x1bebd03617765600,
-			0x1be72e736bf9c700,
-			0x1be28c828c7d3000,
-			0x1bddea6380ac4e00,
-			0x1bd9481650333100,
-			0x1bd4a59b02be1700,
-			0x1bd002f19ff9bf00,
-			0x1bcb601a2f930100,
-			0x1bc6bd14b9371c00,
-			0x1bc219e14493a000,
-			0x1bbd767fd9564700,
-			0x1bb8d2f07f2d4d00,
-			0x1bb42f333dc70000,
-			0x1baf8b481cd23200,
-			0x1baae72f23fdd100,
-			0x1ba642e85af93100,
-			0x1ba19e73c973f300,
-			0x1b9cf9d1771de800,
-			0x1b9855016ba75f00,
-			0x1b93b003aec0b700,
-			0x1b8f0ad8481ad700,
-			0x1b8a657f3f66bc00,
-			0x1b85bff89c55d000,
-			0x1b811a446699c400,
-			0x1b7c7462a5e47a00,
-			0x1b77ce5361e85100,
-			0x1b732816a257c100,
-			0x1b6e81ac6ee5ac00,
-			0x1b69db14cf453400,
-			0x1b65344fcb29cb00,
-			0x1b608d5d6a473100,
-			0x1b5be63db4515f00,
-			0x1b573ef0b0fcac00,
-			0x1b52977667fdb400,
-			0x1b4defcee1096000,
-			0x1b4947fa23d4df00,
-			0x1b449ff83815b000,
-			0x1b3ff7c92581a000,
-			0x1b3b4f6cf3ceb500,
-			0x1b36a6e3aab35100,
-			0x1b31fe2d51e61d00,
-			0x1b2d5549f11e0a00,
-			0x1b28ac3990125700,
-			0x1b2402fc367a9100,
-			0x1b1f5991ec0e7c00,
-			0x1b1aaffab8863b00,
-			0x1b160636a39a3500,
-			0x1b115c45b5031b00,
-			0x1b0cb227f479ef00,
-			0x1b0807dd69b7e200,
-			0x1b035d661c769e00,
-			0x1afeb2c2146fea00,
-			0x1afa07f1595def00,
-			0x1af55cf3f2fb1b00,
-			0x1af0b1c9e9022600,
-			0x1aec0673432e1a00,
-			0x1ae75af0093a2b00,
-			0x1ae2af4042e20c00,
-			0x1ade0363f7e17f00,
-			0x1ad9575b2ff4cb00,
-			0x1ad4ab25f2d84b00,
-			0x1acffec44848c300,
-			0x1acb523638034100,
-			0x1ac6a57bc9c4fc00,
-			0x1ac1f895054bac00,
-			0x1abd4b81f2551d00,
-			0x1ab89e42989f8000,
-			0x1ab3f0d6ffe94c00,
-			0x1aaf433f2ff13d00,
-			0x1aaa957b30766300,
-			0x1aa5e78b0937fe00,
-			0x1aa1396ec1f5b100,
-			0x1a9c8b26626f5e00,
-			0x1a97dcb1f2652f00,
-			0x1a932e1179979a00,
-			0x1a8e7f44ffc76400,
-			0x1a89d04c8cb58300,
-			0x1a85212828235000,
-			0x1a8071d7d9d26100,
-			0x1a7bc25ba9849600,
-			0x1a7712b39efc1b00,
-			0x1a7262dfc1fb5f00,
-			0x1a6db2e01a452600,
-			0x1a6902b4af9c6300,
-			0x1a64525d89c46800,
-			0x1a5fa1dab080cb00,
-			0x1a5af12c2b956700,
-			0x1a56405202c66800,
-			0x1a518f4c3dd82500,
-			0x1a4cde1ae48f7000,
-			0x1a482cbdfeb13000,
-			0x1a437b359402b100,
-			0x1a3ec981ac498a00,
-			0x1a3a17a24f4b7800,
-			0x1a35659784ceb600,
-			0x1a30b36154998c00,
-			0x1a2c00ffc672c600,
-			0x1a274e72e2214000,
-			0x1a229bbaaf6c4000,
-			0x1a1de8d7361b5100,
-			0x1a1935c87df62a00,
-			0x1a14828e8ec4fa00,
-			0x1a0fcf2970500000,
-			0x1a0b1b992a5ffc00,
-			0x1a0667ddc4bdc200,
-			0x1a01b3f747328b00,
-			0x19fcffe5b987d700,
-			0x19f84ba923875000,
-			0x19f397418cfb1a00,
-			0x19eee2aefdad7000,
-			0x19ea2df17d68ed00,
-			0x19e5790913f86f00,
-			0x19e0c3f5c9271a00,
-			0x19dc0eb7a4c05800,
-			0x19d7594eae8fe300,
-			0x19d2a3baee61a400,
-			0x19cdedfc6c01e400,
-			0x19c938132f3d2900,
-			0x19c481ff3fe03e00,
-			0x19bfcbc0a5b84100,
-			0x19bb155768927600,
-			0x19b65ec3903c9a00,
-			0x19b1a80524848000,
-			0x19acf11c2d385d00,
-			0x19a83a08b226a600,
-			0x19a382cabb1e1600,
-			0x199ecb624fedb600,
-			0x199a13cf7864b700,
-			0x19955c123c52c500,
-			0x1990a42aa3879e00,
-			0x198bec18b5d36300,
-			0x198733dc7b067d00,
-			0x19827b75faf17b00,
-			0x197dc2e53d656800,
-			0x19790a2a4a335800,
-			0x19745145292ce100,
-			0x196f9835e223ab00,
-			0x196adefc7ce9c200,
-			0x1966259901517600,
-			0x19616c0b772d4100,
-			0x195cb253e6501500,
-			0x1957f872568cef00,
-			0x19533e66cfb74c00,
-			0x194e843159a2bd00,
-			0x1949c9d1fc233400,
-			0x19450f48bf0ce700,
-			0x19405495aa343800,
-			0x193b99b8c56dfe00,
-			0x1936deb2188f2400,
-			0x19322381ab6cf700,
-			0x192d682785dd0000,
-			0x1928aca3afb51000,
-			0x1923f0f630cb4300,
-			0x191f351f10f5e300,
-			0x191a791e580b9800,
-			0x1915bcf40de34300,
-			0x191100a03a540e00,
-			0x190c4422e5356500,
-			0x1907877c165f0200,
-			0x1902caabd5a8cd00,
-			0x18fe0db22aeb0800,
-			0x18f9508f1dfe3200,
-			0x18f49342b6bb1000,
-			0x18efd5ccfcfaab00,
-			0x18eb182df8965000,
-			0x18e65a65b1679700,
-			0x18e19c742f484800,
-			0x18dcde597a128400,
-			0x18d8201599a0aa00,
-			0x18d361a895cd5b00,
-			0x18cea31276738700,
-			0x18c9e453436e4000,
-			0x18c5256b04991500,
-			0x18c06659c1cf9900,
-			0x18bba71f82ede100,
-			0x18b6e7bc4fd01100,
-			0x18b228303052ae00,
-			0x18ad687b2c528300,
-			0x18a8a89d4bac7e00,
-			0x18a3e896963e0800,
-			0x189f286713e49500,
-			0x189a680ecc7dff00,
-			0x1895a78dc7e85900,
-			0x1890e6e40e01fa00,
-			0x188c2611a6a98700,
-			0x1887651699bdc500,
-			0x1882a3f2ef1df500,
-			0x187de2a6aea96500,
-			0x18792131e03fc400,
-			0x18745f948bc0fe00,
-			0x186f9dceb90d4100,
-			0x186adbe070050600,
-			0x186619c9b888f200,
-			0x1861578a9a7a0300,
-			0x185c95231db97500,
-			0x1857d2934a28c400,
-			0x18530fdb27a9b000,
-			0x184e4cfabe1e4300,
-			0x184989f21568b300,
-			0x1844c6c1356b9000,
-			0x184003682609a400,
-			0x183b3fe6ef25fc00,
-			0x18367c3d98a3ef00,
-			0x1831b86c2a66f900,
-			0x182cf472ac530c00,
-			0x18283051264c2900,
-			0x18236c07a036af00,
-			0x181ea79621f73900,
-			0x1819e2fcb372a600,
-			0x18151e3b5c8e1c00,
-			0x18105952252ee700,
-			0x180b9441153ac800,
-			0x1806cf0834978d00,
-			0x180209a78b2b6700,
-			0x17fd441f20dcc600,
-			0x17f87e6efd923f00,
-			0x17f3b8972932dc00,
-			0x17eef297aba5b000,
-			0x17ea2c708cd24600,
-			0x17e56621d4a03d00,
-			0x17e09fab8af78e00,
-			0x17dbd90db7c06f00,
-			0x17d7124862e35600,
-			0x17d24b5b94490200,
-			0x17cd844753da5f00,
-			0x17c8bd0ba980af00,
-			0x17c3f5a89d256c00,
-			0x17bf2e1e36b25500,
-			0x17ba666c7e116800,
-			0x17b59e937b2ce400,
-			0x17b0d69335ef5000,
-			0x17ac0e6bb6436100,
-			0x17a7461d04141f00,
-			0x17a27da7274ccf00,
-			0x179db50a27d8f300,
-			0x1798ec460da45100,
-			0x1794235ae09af700,
-			0x178f5a48a8a91c00,
-			0x178a910f6dbb4e00,
-			0x1785c7af37be5600,
-			0x1780fe280e9f3b00,
-			0x177c3479fa4b4d00,
-			0x17776aa502b00000,
-			0x1772a0a92fbb3b00,
-			0x176dd686895af100,
-			0x17690c3d177d7500,
-			0x176441cce2115700,
-			0x175f7735f1054d00,
-			0x175aac784c487e00,
-			0x1755e193fbca1900,
-			0x175116890779c500,
-			0x174c4b5777473700,
-			0x17477fff53228100,
-			0x1742b480a2fbf600,
-			0x173de8db6ec40a00,
-			0x17391d0fbe6ba400,
-			0x1734511d99e3b200,
-			0x172f8505091d9900,
-			0x172ab8c6140acf00,
-			0x1725ec60c29d2100,
-			0x17211fd51cc6a200,
-			0x171c53232a798100,
-			0x1717864af3a86500,
-			0x1712b94c8045fd00,
-			0x170dec27d8455700,
-			0x17091edd0399b800,
-			0x1704516c0a36a500,
-			0x16ff83d4f40fe800,
-			0x16fab617c9197600,
-			0x16f5e83491479700,
-			0x16f11a2b548ecc00,
-			0x16ec4bfc1ae3d600,
-			0x16e77da6ec3bb200,
-			0x16e2af2bd08b9e00,
-			0x16dde08acfc91e00,
-			0x16d911c3f1e9df00,
-			0x16d442d73ee3e000,
-			0x16cf73c4bead5b00,
-			0x16caa48c793cc600,
-			0x16c5d52e7688d700,
-			0x16c105aabe888a00,
-			0x16bc36015932fa00,
-			0x16b766324e7fb600,
-			0x16b2963da6665700,
-			0x16adc62368ded200,
-			0x16a8f5e39de15900,
-			0x16a4257e4d664100,
-			0x169f54f37f665000,
-			0x169a84433bda4c00,
-			0x1695b36d8abb7900,
-			0x1690e27274032200,
-			0x168c1151ffaaee00,
-			0x1687400c35acc300,
-			0x16826ea11e02a500,
-			0x167d9d10c0a70d00,
-			0x1678cb5b25947400,
-			0x1673f98054c5cc00,
-			0x166f278056361100,
-			0x166a555b31e09c00,
-			0x16658310efc0ff00,
-			0x1660b0a197d2f100,
-			0x165bde0d32129800,
-			0x16570b53c67c2300,
-			0x165238755d0c1c00,
-			0x164d6571fdbf4300,
-			0x16489249b0929700,
-			0x1643befc7d835900,
-			0x163eeb8a6c8ef200,
-			0x163a17f385b31f00,
-			0x16354437d0edd000,
-			0x16307057563d3500,
-			0x162b9c521d9fba00,
-			0x1626c8282f140e00,
-			0x1621f3d992990700,
-			0x161d1f66502dd000,
-			0x16184ace6fd1c600,
-			0x16137611f9848600,
-			0x160ea130f545e600,
-			0x1609cc2b6b15fb00,
-			0x1604f70162f51e00,
-			0x160021b2e4e3cd00,
-			0x15fb4c3ff8e2d900,
-			0x15f676a8a6f34800,
-			0x15f1a0ecf7165c00,
-			0x15eccb0cf14d9c00,
-			0x15e7f5089d9aab00,
-			0x15e31ee003ff9e00,
-			0x15de48932c7e9100,
-			0x15d972221f19fc00,
-			0x15d49b8ce3d49000,
-			0x15cfc4d382b11d00,
-			0x15caedf603b2e300,
-			0x15c616f46edd2400,
-			0x15c13fcecc339800,
-			0x15bc688523b9fd00,
-			0x15b791177d746c00,
-			0x15b2b985e1673400,
-			0x15ade1d05796db00,
-			0x15a909f6e8082e00,
-			0x15a431f99ac01700,
-			0x159f59d877c3ec00,
-			0x159a819387191000,
-			0x1595a92ad0c53a00,
-			0x1590d09e5cce5700,
-			0x158bf7ee333a9000,
-			0x15871f1a5c104e00,
-			0x15824622df562200,
-			0x157d6d07c512eb00,
-			0x157893c9154dbe00,
-			0x1573ba66d80dea00,
-			0x156ee0e1155af900,
-			0x156a0737d53cb800,
-			0x15652d6b1fbb1500,
-			0x1560537afcde5500,
-			0x155b796774aeea00,
-			0x15569f308f358600,
-			0x1551c4d6547b1900,
-			0x154cea58cc88b100,
-			0x15480fb7ff67cc00,
-			0x154334f3f521ed00,
-			0x153e5a0cb5c0ee00,
-			0x15397f02494edf00,
-			0x1534a3d4b7d60600,
-			0x152fc8840960ef00,
-			0x152aed1045fa3f00,
-			0x1526117975ad0c00,
-			0x152135bfa0846e00,
-			0x151c59e2ce8bda00,
-			0x15177de307cefb00,
-			0x1512a1c054599800,
-			0x150dc57abc37e900,
-			0x1508e91247762200,
-			0x15040c86fe20ed00,
-			0x14ff2fd8e844f800,
-			0x14fa53080def4b00,
-			0x14f57614772d2500,
-			0x14f098fe2c0be300,
-			0x14ebbbc534994f00,
-			0x14e6de6998e33600,
-			0x14e200eb60f7c000,
-			0x14dd234a94e54400,
-			0x14d845873cba5200,
-			0x14d367a16085be00,
-			0x14ce899908567400,
-			0x14c9ab6e3c3bce00,
-			0x14c4cd2104452c00,
-			0x14bfeeb168824300,
-			0x14bb101f7102fc00,
-			0x14b6316b25d77600,
-			0x14b152948f100c00,
-			0x14ac739bb4bd5600,
-			0x14a794809ef01100,
-			0x14a2b54355b94700,
-			0x149dd5e3e12a3500,
-			0x1498f66249544f00,
-			0x149416be96494a00,
-			0x148f36f8d01af600,
-			0x148a5710fedb8e00,
-			0x148577072a9d5200,
-			0x148096db5b72da00,
-			0x147bb68d996ef200,
-			0x1476d61deca48500,
-			0x1471f58c5d26e800,
-			0x146d14d8f3096b00,
-			0x14683403b65fd600,
-			0x1463530caf3df100,
-			0x145e71f3e5b7db00,
-			0x145990b961e1eb00,
-			0x1454af5d2bd09100,
-			0x144fcddf4b98ac00,
-			0x144aec3fc94f1400,
-			0x14460a7ead091600,
-			0x1441289bfedc0100,
-			0x143c4697c6dd7a00,
-			0x143764720d235f00,
-			0x1432822ad9c3a500,
-			0x142d9fc234d4b000,
-			0x1428bd38266ce300,
-			0x1423da8cb6a2fa00,
-			0x141ef7bfed8ddf00,
-			0x141a14d1d344b300,
-			0x141531c26fded600,
-			0x14104e91cb73c900,
-			0x140b6b3fee1b5b00,
-			0x140687ccdfed8900,
-			0x1401a438a9028700,
-			0x13fcc0835172c200,
-			0x13f7dcace156dc00,
-			0x13f2f8b560c7b600,
-			0x13ee149cd7de5100,
-			0x13e930634eb3fb00,
-			0x13e44c08cd623200,
-			0x13df678d5c02a900,
-			0x13da82f102af4c00,
-			0x13d59e33c9824200,
-			0x13d0b955b895d400,
-			0x13cbd456d8049800,
-			0x13c6ef372fe95100,
-			0x13c209f6c85efb00,
-			0x13bd2495a980cd00,
-			0x13b83f13db6a1700,
-			0x13b3597166369600,
-			0x13ae73ae52020400,
-			0x13a98dcaa6e87300,
-			0x13a4a7c66d062200,
-			0x139fc1a1ac778500,
-			0x139adb5c6d595000,
-			0x1395f4f6b7c84b00,
-			0x13910e7093e1ac00,
-			0x138c27ca09c2a000,
-			0x138741032188c800,
-			0x13825a1be351c300,
-			0x137d7314573b8700,
-			0x13788bec85643d00,
-			0x1373a4a475ea2600,
-			0x136ebd3c30ebed00,
-			0x1369d5b3be884000,
-			0x1364ee0b26de1c00,
-			0x13600642720cae00,
-			0x135b1e59a8335a00,
-			0x13563650d171bd00,
-			0x13514e27f5e79600,
-			0x134c65df1db4ec00,
-			0x13477d7650f9f700,
-			0x134294ed97d72100,
-			0x133dac44fa6d0a00,
-			0x1338c37c80dc9100,
-			0x1333da943346ad00,
-			0x132ef18c19cca700,
-			0x132a08643c8ff000,
-			0x13251f1ca3b23000,
-			0x132035b557554400,
-			0x131b4c2e5f9b3c00,
-			0x13166287c4a66500,
-			0x131178c18e992900,
-			0x130c8edbc5963d00,
-			0x1307a4d671c08500,
-			0x1302bab19b3b1500,
-			0x12fdd06d4a294000,
-			0x12f8e60986ae6f00,
-			0x12f3fb8658ee7200,
-			0x12ef10e3c90d1800,
-			0x12ea2621df2e8500,
-			0x12e53b40a3770f00,
-			0x12e050401e0b2000,
-			0x12db6520570f8f00,
-			0x12d679e156a92600,
-			0x12d18e8324fd2200,
-			0x12cca305ca30bd00,
-			0x12c7b7694e698300,
-			0x12c2cbadb9cd3600,
-			0x12bddfd31481aa00,
-			0x12b8f3d966ad1d00,
-			0x12b407c0b875c300,
-			0x12af1b8912024200,
-			0x12aa2f327b793b00,
-			0x12a542bcfd01a300,
-			0x12a056289ec29900,
-			0x129b697568e37200,
-			0x12967ca3638bba00,
-			0x12918fb296e31c00,
-			0x128ca2a30b118a00,
-			0x1287b574c83f2500,
-			0x1282c827d6943d00,
-			0x127ddabc3e395800,
-			0x1278ed3207573400,
-			0x1273ff893a16ac00,
-			0x126f11c1dea0e400,
-			0x126a23dbfd1f2d00,
-			0x126535d79dbb0700,
-			0x126047b4c89e2e00,
-			0x125b597385f27400,
-			0x12566b13dde20e00,
-			0x12517c95d8973200,
-			0x124c8df97e3c6600,
-			0x12479f3ed6fc5900,
-			0x1242b065eb01ed00,
-			0x123dc16ec2783e00,
-			0x1238d259658a7d00,
-			0x1233e325dc643e00,
-			0x122ef3d42f311800,
-			0x122a0464661cec00,
-			0x122514d68953d000,
-			0x1220252aa101ef00,
-			0x121b3560b553d700,
-			0x12164578ce760e00,
-			0x12115572f4958800,
-			0x120c654f2fdf3300,
-			0x1207750d88805000,
-			0x120284ae06a65000,
-			0x11fd9430b27eb700,
-			0x11f8a39594377000,
-			0x11f3b2dcb3fe6200,
-			0x11eec2061a01c400,
-			0x11e9d111ce6ff500,
-			0x11e4dfffd9778700,
-			0x11dfeed043474500,
-			0x11dafd83140e0b00,
-			0x11d60c1853fb1c00,
-			0x11d11a900b3db700,
-			0x11cc28ea42056900,
-			0x11c737270081eb00,
-			0x11c245464ee32400,
-			0x11bd534835593500,
-			0x11b8612cbc145800,
-			0x11b36ef3eb450f00,
-			0x11ae7c9dcb1c0500,
-			0x11a98a2a63ca1400,
-			0x11a49799bd804a00,
-			0x119fa4ebe06fe800,
-			0x119ab220d4ca4e00,
-			0x1195bf38a2c11f00,
-			0x1190cc3352862900,
-			0x118bd910ec4b6800,
-			0x1186e5d178431300,
-			0x1181f274fe9f7000,
-			0x117cfefb87932b00,
-			0x11780b651b50e300,
-			0x117317b1c20ba400,
-			0x116e23e183f67600,
-			0x11692ff46944ad00,
-			0x11643bea7a29ce00,
-			0x115f47c3bed96f00,
-			0x115a53803f878b00,
-			0x11555f2004681000,
-			0x11506aa315af5900,
-			0x114b76097b91b900,
-			0x114681533e43d300,
-			0x11418c8065fa7900,
-			0x113c9790faea8e00,
-			0x1137a28505495a00,
-			0x1132ad5c8d4c1c00,
-			0x112db8179b286600,
-			0x1128c2b63713ec00,
-			0x1123cd3869449500,
-			0x111ed79e39f07d00,
-			0x1119e1e7b14dd800,
-			0x1114ec14d7932100,
-			0x110ff625b4f6f900,
-			0x110b001a51b03100,
-			0x110609f2b5f5c800,
-			0x110113aee9feeb00,
-			0x10fc1d4ef602fe00,
-			0x10f726d2e2397e00,
-			0x10f2303ab6da2d00,
-			0x10ed39867c1cf100,
-			0x10e842b63a39e200,
-			0x10e34bc9f9694500,
-			0x10de54c1c1e39600,
-			0x10d95d9d9be16600,
-			0x10d4665d8f9b8d00,
-			0x10cf6f01a54b0a00,
-			0x10ca7789e5290800,
-			0x10c57ff6576eeb00,
-			0x10c0884704562300,
-			0x10bb907bf4188600,
-			0x10b698952eefe000,
-			0x10b1a092bd164d00,
-			0x10aca874a6c61400,
-			0x10a7b03af4398b00,
-			0x10a2b7e5adab6d00,
-			0x109dbf74db566400,
-			0x1098c6e885758700,
-			0x1093ce40b443e200,
-			0x108ed57d6ffcd000,
-			0x1089dc9ec0dbd600,
-			0x1084e3a4af1c8c00,
-			0x107fea8f42fae900,
-			0x107af15e84b2d700,
-			0x1075f8127c80a800,
-			0x1070feab32a0a900,
-			0x106c0528af4f6f00,
-			0x10670b8afac9b600,
-			0x106211d21d4c6800,
-			0x105d17fe1f14a300,
-			0x10581e0f085f9900,
-			0x10532404e16ac300,
-			0x104e29dfb273bd00,
-			0x10492f9f83b85000,
-			0x104435445d767300,
-			0x103f3ace47ec5100,
-			0x103a403d4b582900,
-			0x103545916ff87e00,
-			0x10304acabe0bfa00,
-			0x102b4fe93dd17100,
-			0x102654ecf787e400,
-			0x102159d5f36e8100,
-			0x101c5ea439c4aa00,
-			0x10176357d2c9d500,
-			0x101267f0c6bdbc00,
-			0x100d6c6f1de03e00,
-			0x100870d2e0716500,
-			0x1003751c16b16f00,
-			0xffe794ac8e0a780,
-			0xff97d5eff3fbc00,
-			0xff48158c20f4e80,
-			0xfef853819904e00,
-			0xfea88fd0e03d300,
-			0xfe58ca7a7ab0400,
-			0xfe09037eec76980,
-			0xfdb93adeb9a7880,
-			0xfd69709a6661080,
-			0xfd19a4b276c0600,
-			0xfcc9d7276ee7780,
-			0xfc7a07f9d2faf00,
-			0xfc2a372a2720400,
-			0xfbda64b8ef82d80,
-			0xfb8a90a6b04d180,
-			0xfb3abaf3edafe00,
-			0xfaeae3a12bdb680,
-			0xfa9b0aaeef04800,
-			0xfa4b301dbb62b00,
-			0xf9fb53ee152e380,
-			0xf9ab762080a5780,
-			0xf95b96b58206080,
-			0xf90bb5ad9d92280,
-			0xf8bbd309578e400,
-			0xf86beec93441700,
-			0xf81c08edb7f5e80,
-			0xf7cc217766f7200,
-			0xf77c3866c594a80,
-			0xf72c4dbc5820380,
-			0xf6dc6178a2ee380,
-			0xf68c739c2a55a00,
-			0xf63c842772b0200,
-			0xf5ec931b005a080,
-			0xf59ca07757b2c80,
-			0xf54cac3cfd1af80,
-			0xf4fcb66c74f7500,
-			0xf4acbf0643aea00,
-			0xf45cc60aedaa600,
-			0xf40ccb7af757200,
-			0xf3bccf56e522200,
-			0xf36cd19f3b7ea80,
-			0xf31cd2547edf200,
-			0xf2ccd17733ba900,
-			0xf27ccf07de8aa00,
-			0xf22ccb0703c9880,
-			0xf1dcc57527f7a00,
-			0xf18cbe52cf93d80,
-			0xf13cb5a07f23a80,
-			0xf0ecab5ebb2bb00,
-			0xf09c9f8e0835280,
-			0xf04c922eeacbc00,
-			0xeffc8341e77bf00,
-			0xefac72c782d8000,
-			0xef5c60c04171080,
-			0xef0c4d2ca7de800,
-			0xeebc380d3ab7100,
-			0xee6c21627e95f00,
-			0xee1c092cf818c80,
-			0xedcbef6d2bddf80,
-			0xed7bd4239e89c00,
-			0xed2bb750d4bf900,
-			0xecdb98f55327580,
-			0xec8b79119e6b080,
-			0xec3b57a63b37280,
-			0xebeb34b3ae3b380,
-			0xeb9b103a7c27e00,
-			0xeb4aea3b29b1a00,
-			0xeafac2b63b8f200,
-			0xeaaa99ac3679880,
-			0xea5a6f1d9f2c800,
-			0xea0a430afa66a80,
-			0xe9ba1574cce7c00,
-			0xe969e65b9b73680,
-			0xe919b5bfeacf580,
-			0xe8c983a23fc3c00,
-			0xe87950031f1b500,
-			0xe8291ae30da3380,
-			0xe7d8e442902b980,
-			0xe788ac222b85a80,
-			0xe73872826486800,
-			0xe6e83763c005480,
-			0xe697fac6c2db880,
-			0xe647bcabf1e5e00,
-			0xe5f77d13d201600,
-			0xe5a73bfee810f00,
-			0xe556f96db8f6a00,
-			0xe506b560c998d80,
-			0xe4b66fd89edff00,
-			0xe46628d5bdb6c80,
-			0xe415e058ab0b200,
-			0xe3c59661ebcb400,
-			0xe3754af204eb400,
-			0xe324fe097b5e580,
-			0xe2d4afa8d41c080,
-			0xe2845fd0941dc80,
-			0xe2340e81405f880,
-			0xe1e3bbbb5de0100,
-			0xe193677f719ec00,
-			0xe14311ce00a0a80,
-			0xe0f2baa78fe9f80,
-			0xe0a2620ca483200,
-			0xe05207fdc376980,
-			0xe001ac7b71d1300,
-			0xdfb14f8634a2a00,
-			0xdf60f11e90fb880,
-			0xdf1091450bf0700,
-			0xdec02ffa2a97c00,
-			0xde6fcd3e720a400,
-			0xde1f69126763300,
-			0xddcf03768fc0900,
-			0xdd7e9c6b7041680,
-			0xdd2e33f18e08780,
-			0xdcddca096e3a800,
-			0xdc8d5eb395fe880,
-			0xdc3cf1f08a7e800,
-			0xdbec83c0d0e4c00,
-			0xdb9c1424ee61600,
-			0xdb4ba31d6823680,
-			0xdafb30aac35e380,
-			0xdaaabccd8547000,
-			0xda5a47863315500,
-			0xda09d0d55203900,
-			0xd9b958bb674c800,
-			0xd968df38f830a00,
-			0xd918644e89ef700,
-			0xd8c7e7fca1cc980,
-			0xd8776a43c50e300,
-			0xd826eb2478faa00,
-			0xd7d66a9f42de000,
-			0xd785e8b4a802f80,
-			0xd73565652dba380,
-			0xd6e4e0b15953780,
-			0xd6945a99b022a00,
-			0xd643d31eb77df00,
-			0xd5f34a40f4bbf00,
-			0xd5a2c000ed38e80,
-			0xd552345f2650100,
-			0xd501a75c2560c80,
-			0xd4b118f86fcc380,
-			0xd46089348af5e00,
-			0xd40ff810fc43880,
-			0xd3bf658e491d300,
-			0xd36ed1acf6eda00,
-			0xd31e3c6d8b20780,
-			0xd2cda5d08b25080,
-			0xd27d0dd67c6c680,
-			0xd22c747fe469e80,
-			0xd1dbd9cd4893380,
-			0xd18b3dbf2e60980,
-			0xd13aa0561b4b400,
-			0xd0ea019294cff00,
-			0xd0996175206d500,
-			0xd048bffe43a4300,
-			0xcff81d2e83f8200,
-			0xcfa7790666ece80,
-			0xcf56d386720c100,
-			0xcf062caf2addd00,
-			0xceb5848116eeb00,
-			0xce64dafcbbcd480,
-			0xce1430229f08900,
-			0xcdc383f34635100,
-			0xcd72d66f36e5b00,
-			0xcd222796f6b3680,
-			0xccd1776b0b35e80,
-			0xcc80c5ebfa09280,
-			0xcc30131a48cb400,
-			0xcbdf5ef67d1a780,
-			0xcb8ea9811c9ad00,
-			0xcb3df2baacee780,
-			0xcaed3aa3b3bdb80,
-			0xca9c813cb6afb00,
-			0xca4bc6863b6f800,
-			0xc9fb0a80c7aa880,
-			0xc9aa4d2ce10e600,
-			0xc9598e8b0d4e280,
-			0xc908ce9bd21bc80,
-			0xc8b80d5fb52d400,
-			0xc8674ad73c3a400,
-			0xc8168702ecfc980,
-			0xc7c5c1e34d30b80,
-			0xc774fb78e293c00,
-			0xc72433c432e6700,
-			0xc6d36ac5c3eb300,
-			0xc682a07e1b66800,
-			0xc631d4edbf1f000,
-			0xc5e1081534dd780,
-			0xc59039f5026d500,
-			0xc53f6a8dad9a900,
-			0xc4ee99dfbc34d00,
-			0xc49dc7ebb40d500,
-			0xc44cf4b21af7780,
-			0xc3fc203376c8a80,
-			0xc3ab4a704d58f80,
-			0xc35a73692481180,
-			0xc3099b1e821d480,
-			0xc2b8c190ec0b500,
-			0xc267e6c0e82b380,
-			0xc2170aaefc5f700,
-			0xc1c62d5bae8aa80,
-			0xc1754ec78494f80,
-			0xc1246ef30464b80,
-			0xc0d38ddeb3e6300,
-			0xc082ab8b1904400,
-			0xc031c7f8b9adf00,
-			0xbfe0e3281bd4380,
-			0xbf8ffd19c568300,
-			0xbf3f15ce3c60800,
-			0xbeee2d4606b1e00,
-			0xbe9d4381aa57000,
-			0xbe4c5881ad49280,
-			0xbdfb6c469585b80,
-			0xbdaa7ed0e90c000,
-			0xbd5990212ddb700,
-			0xbd08a037e9f8f00,
-			0xbcb7af15a367f80,
-			0xbc66bcbae030080,
-			0xbc15c928265a180,
-			0xbbc4d45dfbf1300,
-			0xbb73de5ce702d80,
-			0xbb22e7256d9d200,
-			0xbad1eeb815d1980,
-			0xba80f51565b3480,
-			0xba2ffa3de357480,
-			0xb9defe3214d4a00,
-			0xb98e00f28044d80,
-			0xb93d027fabc2080,
-			0xb8ec02da1d69b80,
-			0xb89b02025b5ad80,
-			0xb849fff8ebb6780,
-			0xb7f8fcbe549f900,
-			0xb7a7f8531c3b080,
-			0xb756f2b7c8b0500,
-			0xb705ebece027500,
-			0xb6b4e3f2e8cb580,
-			0xb663daca68c9380,
-			0xb612d073e64fb00,
-			0xb5c1c4efe790000,
-			0xb570b83ef2bb500,
-			0xb51faa618e08380,
-			0xb4ce9b583fabc80,
-			0xb47d8b238ddf080,
-			0xb42c79c3fedcd80,
-			0xb3db673a18e0280,
-			0xb38a53866229300,
-			0xb3393ea960f6300,
-			0xb2e828a39b8b580,
-			0xb2971175982b280,
-			0xb245f91fdd1c280,
-			0xb1f4dfa2f0a6b00,
-			0xb1a3c4ff5913180,
-			0xb152a9359caf100,
-			0xb1018c4641c6400,
-			0xb0b06e31ceaa180,
-			0xb05f4ef8c9aa900,
-			0xb00e2e9bb91b680,
-			0xafbd0d1b2351d80,
-			0xaf6bea778ea4f00,
-			0xaf1ac6b1816e200,
-			0xaec9a1c98207480,
-			0xae787bc016cd900,
-			0xae275495c61fa00,
-			0xadd62c4b165dd80,
-			0xad8502e08dea980,
-			0xad33d856b32a800,
-			0xace2acae0c82a00,
-			0xac917fe7205b600,
-			0xac405202751e700,
-			0xabef23009137780,
-			0xab9df2e1fb14600,
-			0xab4cc1a73922f00,
-			0xaafb8f50d1d6400,
-			0xaaaa5bdf4b9fc80,
-			0xaa5927532cf4d00,
-			0xaa07f1acfc4bf80,
-			0xa9b6baed401da00,
-			0xa96583147ee4980,
-			0xa9144a233f1b700,
-			0xa8c3101a0742080,
-			0xa871d4f95dd6900,
-			0xa82098c1c95b100,
-			0xa7cf5b73d053500,
-			0xa77e1d0ff942f00,
-			0xa72cdd96cab2d80,
-			0xa6db9d08cb29c00,
-			0xa68a5b668134180,
-			0xa63918b0735cb00,
-			0xa5e7d4e72832180,
-			0xa596900b2644a80,
-			0xa5454a1cf424800,
-			0xa4f4031d1867000,
-			0xa4a2bb0c199fd00,
-			0xa45171ea7e66680,
-			0xa40027b8cd53700,
-			0xa3aedc778d01580,
-			0xa35d9027440ce00,
-			0xa30c42c87912800,
-			0xa2baf45bb2b3e00,
-			0xa269a4e17791000,
-			0xa218545a4e4d980,
-			0xa1c702c6bd8e880,
-			0xa175b0274bfa900,
-			0xa1245c7c803a880,
-			0xa0d307c6e0f7a00,
-			0xa081b206f4de300,
-			0xa0305b3d429bc80,
-			0x9fdf036a50dfc00,
-			0x9f8daa8ea65b200,
-			0x9f3c50aac9c1180,
-			0x9eeaf5bf41c4a00,
-			0x9e9999cc951de00,
-			0x9e483cd34a83300,
-			0x9df6ded3e8ae980,
-			0x9da57fcef65bd80,
-			0x9d541fc4fa46680,
-			0x9d02beb67b2ed80,
-			0x9cb15ca3ffd3880,
-			0x9c5ff98e0ef8680,
-			0x9c0e95752f5fb00,
-			0x9bbd3059e7cf300,
-			0x9b6bca3cbf0e680,
-			0x9b1a631e3be4900,
-			0x9ac8fafee51df80,
-			0x9a7791df4184b00,
-			0x9a2627bfd7e8580,
-			0x99d4bca12f16c00,
-			0x99835083cde1680,
-			0x9931e3683b1b680,
-			0x98e0754efd97900,
-			0x988f06389c2db80,
-			0x983d96259db3f00,
-			0x97ec25168903f00,
-			0x979ab30be4f8780,
-			0x97494006386e000,
-			0x96f7cc060a43080,
-			0x96a6570be156500,
-			0x9654e1184489a00,
-			0x96036a2bbabfd80,
-			0x95b1f246cadd800,
-			0x95607969fbc8c00,
-			0x950eff95d469480,
-			0x94bd84cadba8e80,
-			0x946c09099871a00,
-			0x941a8c5291b0600,
-			0x93c90ea64e53500,
-			0x93779005554a180,
-			0x932610702d86080,
-			0x92d48fe75dfa780,
-			0x92830e6b6d9ad80,
-			0x92318bfce35da00,
-			0x91e0089c463a700,
-			0x918e844a1d2a600,
-			0x913cff06ef28a80,
-			0x90eb78d34330100,
-			0x9099f1afa040680,
-			0x9048699c8d57800,
-			0x8ff6e09a9176d00,
-			0x8fa556aa33a1500,
-			0x8f53cbcbfad9780,
-			0x8f0240006e26d80,
-			0x8eb0b348148e880,
-			0x8e5f25a3751b180,
-			0x8e0d971316d5380,
-			0x8dbc079780c9080,
-			0x8d6a77313a03c00,
-			0x8d18e5e0c994080,
-			0x8cc753a6b68aa00,
-			0x8c75c08387f7c00,
-			0x8c242c77c4f0a80,
-			0x8bd29783f488880,
-			0x8b8101a89dd6300,
-			0x8b2f6ae647f1500,
-			0x8addd33d79f3280,
-			0x8a8c3aaebaf6f00,
-			0x8a3aa13a9217e80,
-			0x89e906e18674300,
-			0x89976ba41f2af80,
-			0x8945cf82e35cf00,
-			0x88f4327e5a2c380,
-			0x88a294970abce00,
-			0x8850f5cd7c33000,
-			0x87ff562235b5980,
-			0x87adb595be6ca80,
-			0x875c14289d81a00,
-			0x870a71db5a1f600,
-			0x86b8ceae7b72480,
-			0x86672aa288a8a80,
-			0x861585b808f0b00,
-			0x85c3dfef837b900,
-			0x857239497f7b600,
-			0x852091c68423b80,
-			0x84cee96718aa080,
-			0x847d402bc443300,
-			0x842b96150e29100,
-			0x83d9eb237d93580,
-			0x83883f5799bd380,
-			0x833692b1e9e3400,
-			0x82e4e532f541680,
-			0x829336db4318880,
-			0x824187ab5aa7000,
-			0x81efd7a3c330680,
-			0x819e26c503f6580,
-			0x814c750fa43dd80,
-			0x80fac2842b4d280,
-			0x80a90f23206a200,
-			0x80575aed0adf500,
-			0x8005a5e271f4c00,
-			0x7fb3f003dcf7c40,
-			0x7f623951d333a80,
-			0x7f1081ccdbf7040,
-			0x7ebec9757e91d00,
-			0x7e6d104c4253680,
-			0x7e1b5651ae8ff80,
-			0x7dc99b864a99940,
-			0x7d77dfea9dc5a00,
-			0x7d26237f2f6a580,
-			0x7cd4664486df580,
-			0x7c82a83b2b7e0c0,
-			0x7c30e963a49fb80,
-			0x7bdf29be79a07c0,
-			0x7b8d694c31dd440,
-			0x7b3ba80d54b4500,
-			0x7ae9e6026985380,
-			0x7a98232bf7b1640,
-			0x7a465f8a8699880,
-			0x79f49b1e9da3300,
-			0x79a2d5e8c431b40,
-			0x79510fe981abb40,
-			0x78ff49215d78ac0,
-			0x78ad8190df01580,
-			0x785bb9388db0400,
-			0x7809f018f0ef440,
-			0x77b82632902cfc0,
-			0x77665b85f2d5d40,
-			0x77149013a059800,
-			0x76c2c3dc2028fc0,
-			0x7670f6dff9b4800,
-			0x761f291fb471180,
-			0x75cd5a9bd7d1100,
-			0x757b8b54eb4bec0,
-			0x7529bb4b7657080,
-			0x74d7ea80006af40,
-			0x748618f31101800,
-			0x743446a52f93c80,
-			0x73e27396e39f9c0,
-			0x73909fc8b4a0900,
-			0x733ecb3b2a15740,
-			0x72ecf5eecb7dd80,
-			0x729b1fe4205a840,
-			0x7249491bb02dfc0,
-			0x71f77196027a000,
-			0x71a599539ec5040,
-			0x7153c0550c93400,
-			0x7101e69ad36c180,
-			0x70b00c257ad7ac0,
-			0x705e30f58a5f540,
-			0x700c550b898e100,
-			0x6fba7867ffeeac0,
-			0x6f689b0b750e8c0,
-			0x6f16bcf6707bdc0,
-			0x6ec4de2979c5f00,
-			0x6e72fea5187d4c0,
-			0x6e211e69d434200,
-			0x6dcf3d78347c5c0,
-			0x6d7d5bd0c0ea880,
-			0x6d2b79740113e80,
-			0x6cd996627c8ee40,
-			0x6c87b29cbaf3980,
-			0x6c35ce2343d9400,
-			0x6be3e8f69edbc80,
-			0x6b9203175394c40,
-			0x6b401c85e9a0f00,
-			0x6aee3542e89dac0,
-			0x6a9c4d4ed829800,
-			0x6a4a64aa3fe49c0,
-			0x69f87b55a76e540,
-			0x69a69151966a980,
-			0x6954a69e947a800,
-			0x6902bb3d2944440,
-			0x68b0cf2ddc6bc40,
-			0x685ee2713597f80,
-			0x680cf507bc70f80,
-			0x67bb06f1f89df80,
-			0x6769183071cad40,
-			0x671728c3afa0f40,
-			0x66c538ac39ccf00,
-			0x667347ea97fbe40,
-			0x6621567f51dc140,
-			0x65cf646aef1d5c0,
-			0x657d71adf76f300,
-			0x652b7e48f283940,
-			0x64d98a3c680d2c0,
-			0x64879588dfbfa80,
-			0x6435a02ee14fd40,
-			0x63e3aa2ef4738c0,
-			0x6391b389a0e2400,
-			0x633fbc3f6e52f00,
-			0x62edc450e47f340,
-			0x629bcbbe8b21240,
-			0x6249d288e9f3fc0,
-			0x61f7d8b088b3f80,
-			0x61a5de35ef1ee40,
-			0x6153e319a4f2200,
-			0x6101e75c31ed8c0,
-			0x60afeafe1dd1980,
-			0x605dedfff05fc80,
-			0x600bf062315b140,
-			0x5fb9f2256885940,
-			0x5f67f34a1da5d00,
-			0x5f15f3d0d87fec0,
-			0x5ec3f3ba20db000,
-			0x5e71f3067e7f340,
-			0x5e1ff1b67933b40,
-			0x5dcdefca98c4200,
-			0x5d7bed4364f9300,
-			0x5d29ea2165a0900,
-			0x5cd7e6652285680,
-			0x5c85e20f2375ec0,
-			0x5c33dd1ff041480,
-			0x5be1d79810b5a80,
-			0x5b8fd1780ca5b00,
-			0x5b3dcac06be1040,
-			0x5aebc371b63c400,
-			0x5a99bb8c7389800,
-			0x5a47b3112b9dd40,
-			0x59f5aa00664f440,
-			0x59a3a05aab72d40,
-			0x5951962082e1fc0,
-			0x58ff8b527473ac0,
-			0x58ad7ff10801c00,
-			0x585b73fcc566980,
-			0x58096776347d740,
-			0x57b75a5ddd22980,
-			0x57654cb44733b00,
-			0x57133e79fa8dd80,
-			0x56c12faf7f10a00,
-			0x566f20555c9c000,
-			0x561d106c1b10e80,
-			0x55cafff44251300,
-			0x5578eeee5a3f940,
-			0x5526dd5aeac0480,
-			0x54d4cb3a7bb6e40,
-			0x5482b88d95096c0,
-			0x5430a554be9e4c0,
-			0x53de9190805cd00,
-			0x538c7d41622db80,
-			0x533a6867ebf8a40,
-			0x52e85304a5a9940,
-			0x52963d181729f40,
-			0x524426a2c866100,
-			0x51f20fa5414b140,
-			0x519ff82009c5140,
-			0x514de013a9c4800,
-			0x50fbc780a936a80,
-			0x50a9ae67900dbc0,
-			0x505794c8e639480,
-			0x50057aa533abb80,
-			0x4fb35ffd0058500,
-			0x4f6144d0d4313c0,
-			0x4f0f2921372cec0,
-			0x4ebd0ceeb13ec00,
-			0x4e6af039ca5ee40,
-			0x4e18d3030a82e00,
-			0x4dc6b54af9a3140,
-			0x4d7497121fb8b00,
-			0x4d22785904bbc40,
-			0x4cd0592030a8a80,
-			0x4c7e39682b79100,
-			0x4c2c19317d29800,
-			0x4bd9f87cadb6cc0,
-			0x4b87d74a451ea00,
-			0x4b35b59acb5fec0,
-			0x4ae3936ec878fc0,
-			0x4a9170c6c46a600,
-			0x4a3f4da34734f80,
-			0x49ed2a04d8da780,
-			0x499b05ec015d540,
-			0x4948e15948c0d40,
-			0x48f6bc4d3709840,
-			0x48a496c8543b380,
-			0x485270cb285c100,
-			0x48004a563b72780,
-			0x47ae236a1585940,
-			0x475bfc073e9d5c0,
-			0x4709d42e3ec3000,
-			0x46b7abdf9dfe800,
-			0x4665831be45c180,
-			0x461359e399e5440,
-			0x45c1303746a6440,
-			0x456f061772ac180,
-			0x451cdb84a602800,
-			0x44cab07f68b9780,
-			0x4478850842ddbc0,
-			0x4426591fbc80c00,
-			0x43d42cc65db1400,
-			0x4381fffcae80a00,
-			0x432fd2c33701100,
-			0x42dda51a7f436c0,
-			0x428b77030f5cd00,
-			0x4239487d6f5f080,
-			0x41e7198a2760a40,
-			0x4194ea29bf75580,
-			0x4142ba5cbfb39c0,
-			0x40f08a23b032900,
-			0x409e597f19080c0,
-			0x404c286f824e200,
-			0x3ff9f6f5741c040,
-			0x3fa7c511768ba40,
-			0x3f5592c411b71a0,
-			0x3f03600dcdb9300,
-			0x3eb12cef32adde0,
-			0x3e5ef968c8b0480,
-			0x3e0cc57b17ddbe0,
-			0x3dba9126a853ba0,
-			0x3d685c6c0230620,
-			0x3d16274bad92840,
-			0x3cc3f1c6329a180,
-			0x3c71bbdc19663a0,
-			0x3c1f858dea18300,
-			0x3bcd4edc2cd1640,
-			0x3b7b17c769b3e60,
-			0x3b28e05028e2680,
-			0x3ad6a876f280420,
-			0x3a84703c4eb1ec0,
-			0x3a3237a0c59b000,
-			0x39dffea4df61380,
-			0x398dc549242a700,
-			0x393b8b8e1c1d1e0,
-			0x38e951744f60d80,
-			0x389716fc461bd60,
-			0x3844dc268878620,
-			0x37f2a0f39e9de80,
-			0x37a0656410b6700,
-			0x374e297866ec940,
-			0x36fbed3129698e0,
-			0x36a9b08ee05aaa0,
-			0x3657739213e9d00,
-			0x3605363b4c45760,
-			0x35b2f88b1199320,
-			0x3560ba81ec13260,
-			0x350e7c2063e1860,
-			0x34bc3d670133200,
-			0x3469fe564c37ce0,
-			0x3417beeecd1dfc0,
-			0x33c57f310c18240,
-			0x33733f1d9155d20,
-			0x3320feb4e5091e0,
-			0x32cebdf78f642c0,
-			0x327c7ce61899ae0,
-			0x322a3b8108dd620,
-			0x31d7f9c8e862100,
-			0x3185b7be3f5c860,
-			0x313375619601a00,
-			0x30e132b37486bc0,
-			0x308eefb46321c60,
-			0x303cac64ea09aa0,
-			0x2fea68c591745c0,
-			0x2f9824d6e199d40,
-			0x2f45e09962b20c0,
-			0x2ef39c0d9cf5820,
-			0x2ea15734189db40,
-			0x2e4f120d5de2a20,
-			0x2dfccc99f5004e0,
-			0x2daa86da662fb20,
-			0x2d5840cf39ac500,
-			0x2d05fa78f7b19e0,
-			0x2cb3b3d8287b960,
-			0x2c616ced5447260,
-			0x2c0f25b9034fba0,
-			0x2bbcde3bbdd4bc0,
-			0x2b6a96760c12860,
-			0x2b184e687647f20,
-			0x2ac6061384b44c0,
-			0x2a73bd77bf955a0,
-			0x2a217495af2cd20,
-			0x29cf2b6ddbb8e40,
-			0x297ce200cd7c2e0,
-			0x292a984f0cb6480,
-			0x28d84e5921a9340,
-			0x2886041f94976a0,
-			0x2833b9a2edc1d00,
-			0x27e16ee3b56d3c0,
-			0x278f23e273db700,
-			0x273cd89fb1509c0,
-			0x26ea8d1bf610e20,
-			0x26984157ca60c60,
-			0x2645f553b685c00,
-			0x25f3a91042c3aa0,
-			0x25a15c8df7624c0,
-			0x254f0fcd5ca6540,
-			0x24fcc2cefad6d80,
-			0x24aa75935a3ad60,
-			0x2458281b0319ac0,
-			0x2405da667dbba20,
-			0x23b38c765267e00,
-			0x23613e4b0967740,
-			0x230eefe52b034c0,
-			0x22bca1453f84b80,
-			0x226a526bcf35640,
-			0x22180359625fe20,
-			0x21c5b40e814d200,
-			0x2173648bb449e40,
-			0x212114d1839fd80,
-			0x20cec4e0779afe0,
-			0x207c74b91887b40,
-			0x202a245beeb0b00,
-			0x1fd7d3c98264850,
-			0x1f8583025bee1b0,
-			0x1f333207039cb20,
-			0x1ee0e0d801bc610,
-			0x1e8e8f75de9b930,
-			0x1e3c3de12289090,
-			0x1de9ec1a55d1d80,
-			0x1d979a2200c6e70,
-			0x1d4547f8abb5710,
-			0x1cf2f59edeeefe0,
-			0x1ca0a31522c1eb0,
-			0x1c4e505bff7ee20,
-			0x1bfbfd73fd76da0,
-			0x1ba9aa5da4f91b0,
-			0x1b5757197e58b80,
-			0x1b0503a811e58f0,
-			0x1ab2b009e7f1ca0,
-			0x1a605c3f88cf5e0,
-			0x1a0e08497cd0870,
-			0x19bbb4284c484b0,
-			0x19695fdc7f88770,
-			0x19170b669ee49e0,
-			0x18c4b6c732b01a0,
-			0x187261fec33e880,
-			0x18200d0dd8e3ca0,
-			0x17cdb7f4fbf4050,
-			0x177b62b4b4c4200,
-			0x17290d4d8ba7c40,
-			0x16d6b7c008f4580,
-			0x1684620cb4ff060,
-			0x16320c34181d330,
-			0x15dfb636baa4860,
-			0x158d601524eb5e0,
-			0x153b09cfdf46d90,
-			0x14e8b367720dd00,
-			0x14965cdc6596d50,
-			0x1444062f4238b50,
-			0x13f1af60904af30,
-			0x139f5870d8234c0,
-			0x134d0160a21b330,
-			0x12faaa307688cf0,
-			0x12a852e0ddc47f0,
-			0x1255fb726026530,
-			0x1203a3e58606910,
-			0x11b14c3ad7be2f0,
-			0x115ef472dda4550,
-			0x110c9c8e2013dd0,
-			0x10ba448d2763cf0,
-			0x1067ec707bef610,
-			0x10159438a60e790,
-			0xfc33be62e1b288,
-			0xf70e3799c6fae0,
-			0xf1e8af37964730,
-			0xecc32544d558a8,
-			0xe79d99ca09bb20,
-			0xe2780ccfb91cf0,
-			0xdd527e5e6926f8,
-			0xd82cee7e9f8468,
-			0xd3075d38e1eaf0,
-			0xcde1ca95b5fa80,
-			0xc8bc369da16d48,
-			0xc396a15929f7b8,
-			0xbe710ad0d55058,
-			0xb94b730d292fd8,
-			0xb425da16ab58e0,
-			0xaf003ff5e17828,
-			0xa9daa4b3515450,
-			0xa4b5085780adc0,
-			0x9f8f6aeaf546e0,
-			0x9a69cc7634e3a8,
-			0x95442d01c549f0,
-			0x901e8c962c4920,
-			0x8af8eb3bef9a40,
-			0x85d348fb950fe0,
-			0x80ada5dda27618,
-			0x7b8801ea9d9a5c,
-			0x76625d2b0c5390,
-			0x713cb7a77459e8,
-			0x6c1711685b9ed8,
-			0x66f16a7647dd10,
-			0x61cbc2d9bef060,
-			0x5ca61a9b46b5bc,
-			0x578071c364eb20,
-			0x525ac85a9f8784,
-			0x4d351e697c42d4,
-			0x480f73f88115d8,
-			0x42e9c91033c234,
-			0x3dc41db91a2a4a,
-			0x389e71fbba3136,
-			0x3378c5e0999abe,
-			0x2e5319703e6344,
-			0x292d6cb32e47b6,
-			0x2407bfb1ef4580,
-			0x1ee21275072280,
-			0x19bc6504fbc4f8,
-			0x1496b76a53137c,
-			0xf7109ad92d4e9,
-			0xa4b5bd7410853,
-			0x525adefe374f8,
-			0x235,
+#if FIXED_64_TRIG_LUT_INTERPOLATION >= 2
+			{ 0, 7074239139225491, -4161591398ll },
+			{ 7074234977634093, 7074230816040244, -12484764396ll },
+			{ 14148453308909941, 7074205846506551, -20807908026ll },
+			{ 21222638347508466, 7074164230683153, -29131002686ll },
+			{ 28296773447188933, 7074105968667987, -37454028802ll },
+			{ 35370841961828118, 7074031060598146, -45776966784ll },
+			{ 42444827245459480, 7073939506649896, -54099797052ll },
+			{ 49518712652312324, 7073831307038664, -62422500008ll },
+			{ 56592481536850980, 7073706462019063, -70745056082ll },
+			{ 63666117253813961, 7073564971884868, -79067445688ll },
+			{ 70739603158253141, 7073406836969011, -87389649238ll },
+			{ 77812922605572914, 7073232057643603, -95711647154ll },
+			{ 84886058951569363, 7073040634319918, -104033419848ll },
+			{ 91958995552469433, 7072832567448390, -112354947744ll },
+			{ 99031715764970079, 7072607857518627, -120676211262ll },
+			{ 106104202946277444, 7072366505059385, -128997190814ll },
+			{ 113176440454146015, 7072108510638595, -137317866822ll },
+			{ 120248411646917788, 7071833874863335, -145638219706ll },
+			{ 127320099883561417, 7071542598379861, -153958229894ll },
+			{ 134391488523711384, 7071234681873567, -162277877798ll },
+			{ 141462560927707153, 7070910126069012, -170597143852ll },
+			{ 148533300456632313, 7070568931729907, -178916008470ll },
+			{ 155603690472353750, 7070211099659113, -187234452078ll },
+			{ 162673714337560785, 7069836630698650, -195552455112ll },
+			{ 169743355415804323, 7069445525729679, -203869997994ll },
+			{ 176812597071536008, 7069037785672498, -212187061144ll },
+			{ 183881422670147362, 7068613411486572, -220503625004ll },
+			{ 190949815578008930, 7068172404170485, -228819669994ll },
+			{ 198017759162509421, 7067714764761970, -237135176548ll },
+			{ 205085236792094843, 7067240494337901, -245450125102ll },
+			{ 212152231836307642, 7066749594014282, -253764496088ll },
+			{ 219218727665825836, 7066242064946247, -262078269942ll },
+			{ 226284707652502141, 7065717908328057, -270391427098ll },
+			{ 233350155169403100, 7065177125393104, -278703947992ll },
+			{ 240415053590848212, 7064619717413921, -287015813082ll },
+			{ 247479386292449051, 7064045685702113, -295327002786ll },
+			{ 254543136651148378, 7063455031608455, -303637497562ll },
+			{ 261606288045259271, 7062847756522798, -311947277844ll },
+			{ 268668823854504225, 7062223861874133, -320256324090ll },
+			{ 275730727460054268, 7061583349130530, -328564616736ll },
+			{ 282791982244568062, 7060926219799190, -336872136244ll },
+			{ 289852571592231008, 7060252475426398, -345178863056ll },
+			{ 296912478888794350, 7059562117597531, -353484777630ll },
+			{ 303971687521614251, 7058855147937084, -361789860424ll },
+			{ 311030180879690911, 7058131568108608, -370094091884ll },
+			{ 318087942353707635, 7057391379814762, -378397452476ll },
+			{ 325144955336069921, 7056634584797287, -386699922670ll },
+			{ 332201203220944538, 7055861184836991, -395001482918ll },
+			{ 339256669404298611, 7055071181753751, -403302113686ll },
+			{ 346311337283938676, 7054264577406534, -411601795448ll },
+			{ 353365190259549762, 7053441373693345, -419900508670ll },
+			{ 360418211732734437, 7052601572551278, -428198233832ll },
+			{ 367470385107051883, 7051745175956445, -436494951390ll },
+			{ 374521693788056938, 7050872185924051, -444790641846ll },
+			{ 381572121183339143, 7049982604508313, -453085285662ll },
+			{ 388621650702561794, 7049076433802506, -461378863324ll },
+			{ 395670265757500976, 7048153675938933, -469671355314ll },
+			{ 402717949762084595, 7047214333088936, -477962742124ll },
+			{ 409764686132431407, 7046258407462882, -486253004244ll },
+			{ 416810458286890045, 7045285901310154, -494542122160ll },
+			{ 423855249646078039, 7044296816919151, -502830076374ll },
+			{ 430899043632920816, 7043291156617282, -511116847376ll },
+			{ 437941823672690722, 7042268922770975, -519402415678ll },
+			{ 444983573193046019, 7041230117785629, -527686761766ll },
+			{ 452024275624069882, 7040174744105662, -535969866164ll },
+			{ 459063914398309380, 7039102804214468, -544251709368ll },
+			{ 466102472950814480, 7038014300634424, -552532271896ll },
+			{ 473139934719177008, 7036909235926889, -560811534266ll },
+			{ 480176283143569631, 7035787612692181, -569089476990ll },
+			{ 487211501666784822, 7034649433569592, -577366080592ll },
+			{ 494245573734273822, 7033494701237365, -585641325594ll },
+			{ 501278482794185593, 7032323418412690, -593915192524ll },
+			{ 508310212297405759, 7031135587851727, -602187661922ll },
+			{ 515340745697595564, 7029931212349543, -610458714310ll },
+			{ 522370066451230797, 7028710294740152, -618728330232ll },
+			{ 529398158017640717, 7027472837896488, -626996490224ll },
+			{ 536425003859046981, 7026218844730405, -635263174826ll },
+			{ 543450587440602560, 7024948318192679, -643528364602ll },
+			{ 550474892230430637, 7023661261272982, -651792040092ll },
+			{ 557497901699663527, 7022357676999869, -660054181846ll },
+			{ 564519599322481550, 7021037568440808, -668314770428ll },
+			{ 571539968576151930, 7019700938702147, -676573786406ll },
+			{ 578558992941067671, 7018347790929109, -684831210346ll },
+			{ 585576655900786434, 7016978128305768, -693087022808ll },
+			{ 592592940942069394, 7015591954055074, -701341204364ll },
+			{ 599607831554920104, 7014189271438839, -709593735606ll },
+			{ 606621311232623337, 7012770083757706, -717844597104ll },
+			{ 613633363471783939, 7011334394351153, -726093769438ll },
+			{ 620643971772365654, 7009882206597498, -734341233200ll },
+			{ 627653119637729952, 7008413523913889, -742586968994ll },
+			{ 634660790574674847, 7006928349756267, -750830957402ll },
+			{ 641666968093473712, 7005426687619401, -759073179038ll },
+			{ 648671635707914075, 7003908541036839, -767313614498ll },
+			{ 655674776935336416, 7002373913580930, -775552244396ll },
+			{ 662676375296672950, 7000822808862800, -783789049348ll },
+			{ 669676414316486402, 6999255230532352, -792024009968ll },
+			{ 676674877523008786, 6997671182278238, -800257106876ll },
+			{ 683671748448180148, 6996070667827891, -808488320706ll },
+			{ 690667010627687333, 6994453690947464, -816717632080ll },
+			{ 697660647601002717, 6992820255441859, -824945021634ll },
+			{ 704652642911422942, 6991170365154729, -833170470030ll },
+			{ 711642980106107641, 6989504023968399, -841393957882ll },
+			{ 718631642736118158, 6987821235803941, -849615465854ll },
+			{ 725618614356456245, 6986122004621126, -857834974604ll },
+			{ 732603878526102767, 6984406334418393, -866052464782ll },
+			{ 739587418808056378, 6982674229232887, -874267917050ll },
+			{ 746569218769372215, 6980925693140427, -882481312090ll },
+			{ 753549261981200552, 6979160730255482, -890692630564ll },
+			{ 760527532018825470, 6977379344731159, -898901853138ll },
+			{ 767504012461703491, 6975581540759270, -907108960528ll },
+			{ 774478686893502233, 6973767322570195, -915313933394ll },
+			{ 781451538902139034, 6971936694432966, -923516752436ll },
+			{ 788422552079819564, 6970089660655239, -931717398362ll },
+			{ 795391710023076441, 6968226225583262, -939915851868ll },
+			{ 802358996332807835, 6966346393601863, -948112093654ll },
+			{ 809324394614316044, 6964450169134482, -956306104448ll },
+			{ 816287888477346078, 6962537556643111, -964497864954ll },
+			{ 823249461536124235, 6960608560628315, -972687355906ll },
+			{ 830209097409396644, 6958663185629202, -980874558024ll },
+			{ 837166779720467822, 6956701436223438, -989059452056ll },
+			{ 844122492097239204, 6954723317027203, -997242018734ll },
+			{ 851076218172247673, 6952728832695199, -1005422238802ll },
+			{ 858027941582704070, 6950717987920663, -1013600093030ll },
+			{ 864977645970531703, 6948690787435262, -1021775562136ll },
+			{ 871925314982404829, 6946647236009239, -1029948626922ll },
+			{ 878870932269787146, 6944587338451254, -1038119268140ll },
+			{ 885814481488970260, 6942511099608426, -1046287466552ll },
+			{ 892755946301112134, 6940418524366371, -1054453202958ll },
+			{ 899695310372275547, 6938309617649097, -1062616458118ll },
+			{ 906632557373466526, 6936184384419094, -1070777212860ll },
+			{ 913567670980672760, 6934042829677222, -1078935447952ll },
+			{ 920500634874902030, 6931884958462764, -1087091144200ll },
+			{ 927431432742220594, 6929710775853415, -1095244282426ll },
+			{ 934360048273791583, 6927520286965215, -1103394843426ll },
+			{ 941286465165913372, 6925313496952613, -1111542808038ll },
+			{ 948210667120057947, 6923090411008401, -1119688157086ll },
+			{ 955132637842909262, 6920851034363700, -1127830871392ll },
+			{ 962052361046401570, 6918595372287984, -1135970931804ll },
+			{ 968969820447757750, 6916323430089046, -1144108319164ll },
+			{ 975884999769527632, 6914035213113000, -1152243014336ll },
+			{ 982797882739626296, 6911730726744214, -1160374998160ll },
+			{ 989708453091372350, 6909409976405389, -1168504251514ll },
+			{ 996616694563526225, 6907072967557462, -1176630755260ll },
+			{ 1003522590900328427, 6904719705699648, -1184754490284ll },
+			{ 1010426125851537791, 6902350196369401, -1192875437470ll },
+			{ 1017327283172469722, 6899964445142392, -1200993577696ll },
+			{ 1024226046624034418, 6897562457632542, -1209108891876ll },
+			{ 1031122399972775084, 6895144239491957, -1217221360910ll },
+			{ 1038016326990906131, 6892709796410918, -1225330965696ll },
+			{ 1044907811456351353, 6890259134117924, -1233437687160ll },
+			{ 1051796837152782117, 6887792258379616, -1241541506228ll },
+			{ 1058683387869655505, 6885309175000782, -1249642403824ll },
+			{ 1065567447402252463, 6882809889824368, -1257740360892ll },
+			{ 1072448999551715939, 6880294408731439, -1265835358386ll },
+			{ 1079328028125088992, 6877762737641146, -1273927377236ll },
+			{ 1086204516935352902, 6875214882510773, -1282016398418ll },
+			{ 1093078449801465257, 6872650849335660, -1290102402892ll },
+			{ 1099949810548398025, 6870070644149222, -1298185371624ll },
+			{ 1106818583007175623, 6867474273022939, -1306265285602ll },
+			{ 1113684751014912960, 6864861742066320, -1314342125816ll },
+			{ 1120548298414853464, 6862233057426904, -1322415873256ll },
+			{ 1127409209056407112, 6859588225290235, -1330486508918ll },
+			{ 1134267466795188429, 6856927251879861, -1338554013818ll },
+			{ 1141123055493054472, 6854250143457319, -1346618368982ll },
+			{ 1147975959018142809, 6851556906322091, -1354679555414ll },
+			{ 1154826161244909486, 6848847546811626, -1362737554152ll },
+			{ 1161673646054166960, 6846122071301304, -1370792346236ll },
+			{ 1168518397333122028, 6843380486204446, -1378843912716ll },
+			{ 1175360398975413758, 6840622797972266, -1386892234648ll },
+			{ 1182199634881151376, 6837849013093858, -1394937293084ll },
+			{ 1189036088956952150, 6835059138096201, -1402979069090ll },
+			{ 1195869745115979261, 6832253179544170, -1411017543764ll },
+			{ 1202700587277979667, 6829431144040433, -1419052698174ll },
+			{ 1209528599369321926, 6826593038225506, -1427084513408ll },
+			{ 1216353765323034024, 6823738868777752, -1435112970584ll },
+			{ 1223176069078841192, 6820868642413277, -1443138050790ll },
+			{ 1229995494583203679, 6817982365886043, -1451159735174ll },
+			{ 1236812025789354548, 6815080045987691, -1459178004822ll },
+			{ 1243625646657337417, 6812161689547672, -1467192840876ll },
+			{ 1250436341154044213, 6809227303433180, -1475204224492ll },
+			{ 1257244093253252901, 6806276894549095, -1483212136810ll },
+			{ 1264048886935665186, 6803310469838025, -1491216558994ll },
+			{ 1270850706188944217, 6800328036280244, -1499217472200ll },
+			{ 1277649535007752261, 6797329600893707, -1507214857598ll },
+			{ 1284445357393788370, 6794315170734010, -1515208696364ll },
+			{ 1291238157355826016, 6791284752894417, -1523198969706ll },
+			{ 1298027918909750727, 6788238354505793, -1531185658814ll },
+			{ 1304814626078597706, 6785175982736604, -1539168744896ll },
+			{ 1311598262892589414, 6782097644792911, -1547148209170ll },
+			{ 1318378813389173155, 6779003347918319, -1555124032842ll },
+			{ 1325156261613058632, 6775893099394031, -1563096197162ll },
+			{ 1331930591616255501, 6772766906538766, -1571064683380ll },
+			{ 1338701787458110887, 6769624776708743, -1579029472722ll },
+			{ 1345469833205346908, 6766466717297693, -1586990546450ll },
+			{ 1352234712932098151, 6763292735736834, -1594947885828ll },
+			{ 1358996410719949157, 6760102839494870, -1602901472152ll },
+			{ 1365754910657971875, 6756897036077920, -1610851286688ll },
+			{ 1372510196842763107, 6753675333029563, -1618797310742ll },
+			{ 1379262253378481928, 6750437737930761, -1626739525606ll },
+			{ 1386011064376887083, 6747184258399898, -1634677912596ll },
+			{ 1392756613957374385, 6743914902092721, -1642612453030ll },
+			{ 1399498886247014076, 6740629676702342, -1650543128236ll },
+			{ 1406237865380588182, 6737328589959222, -1658469919564ll },
+			{ 1412973535500627840, 6734011649631122, -1666392808340ll },
+			{ 1419705880757450622, 6730678863523121, -1674311775930ll },
+			{ 1426434885309197813, 6727330239477612, -1682226803712ll },
+			{ 1433160533321871713, 6723965785374212, -1690137873052ll },
+			{ 1439882808969372873, 6720585509129806, -1698044965332ll },
+			{ 1446601696433537347, 6717189418698519, -1705948061950ll },
+			{ 1453317179904173916, 6713777522071673, -1713847144306ll },
+			{ 1460029243579101283, 6710349827277788, -1721742193812ll },
+			{ 1466737871664185259, 6706906342382577, -1729633191902ll },
+			{ 1473443048373375934, 6703447075488879, -1737520119994ll },
+			{ 1480144757928744819, 6699972034736671, -1745402959526ll },
+			{ 1486842984560521964, 6696481228303080, -1753281691956ll },
+			{ 1493537712507133088, 6692974664402309, -1761156298754ll },
+			{ 1500228926015236643, 6689452351285635, -1769026761374ll },
+			{ 1506916609339760904, 6685914297241395, -1776893061302ll },
+			{ 1513600746743940997, 6682360510594985, -1784755180030ll },
+			{ 1520281322499355952, 6678790999708803, -1792613099058ll },
+			{ 1526958320885965697, 6675205772982256, -1800466799896ll },
+			{ 1533631726192148057, 6671604838851729, -1808316264066ll },
+			{ 1540301522714735720, 6667988205790552, -1816161473080ll },
+			{ 1546967694759053192, 6664355882309037, -1824002408502ll },
+			{ 1553630226638953727, 6660707876954374, -1831839051868ll },
+			{ 1560289102676856233, 6657044198310675, -1839671384734ll },
+			{ 1566944307203782174, 6653364854998943, -1847499388686ll },
+			{ 1573595824559392431, 6649669855677010, -1855323045288ll },
+			{ 1580243639092024153, 6645959209039569, -1863142336130ll },
+			{ 1586887735158727592, 6642232923818142, -1870957242824ll },
+			{ 1593528097125302910, 6638491008781021, -1878767746966ll },
+			{ 1600164709366336965, 6634733472733315, -1886573830198ll },
+			{ 1606797556265240082, 6630960324516850, -1894375474132ll },
+			{ 1613426622214282800, 6627171573010221, -1902172660422ll },
+			{ 1620051891614632599, 6623367227128736, -1909965370728ll },
+			{ 1626673348876390607, 6619547295824345, -1917753586678ll },
+			{ 1633290978418628274, 6615711788085764, -1925537289984ll },
+			{ 1639904764669424054, 6611860712938278, -1933316462300ll },
+			{ 1646514692065900032, 6607994079443866, -1941091085352ll },
+			{ 1653120745054258546, 6604111896701070, -1948861140816ll },
+			{ 1659722908089818800, 6600214173845052, -1956626610428ll },
+			{ 1666321165637053424, 6596300920047535, -1964387475914ll },
+			{ 1672915502169625045, 6592372144516774, -1972143719004ll },
+			{ 1679505902170422815, 6588427856497549, -1979895321442ll },
+			{ 1686092350131598922, 6584468065271171, -1987642265002ll },
+			{ 1692674830554605091, 6580492780155390, -1995384531440ll },
+			{ 1699253327950229041, 6576502010504450, -2003122102548ll },
+			{ 1705827826838630943, 6572495765709018, -2010854960120ll },
+			{ 1712398311749379841, 6568474055196178, -2018583085960ll },
+			{ 1718964767221490059, 6564436888429386, -2026306461872ll },
+			{ 1725527177803457573, 6560384274908500, -2034025069692ll },
+			{ 1732085528053296381, 6556316224169709, -2041738891254ll },
+			{ 1738639802538574836, 6552232745785520, -2049447908404ll },
+			{ 1745189985836451952, 6548133849364770, -2057152103012ll },
+			{ 1751736062533713710, 6544019544552532, -2064851456928ll },
+			{ 1758278017226809314, 6539889841030187, -2072545952058ll },
+			{ 1764815834521887443, 6535744748515323, -2080235570294ll },
+			{ 1771349499034832472, 6531584276761738, -2087920293532ll },
+			{ 1777878995391300678, 6527408435559413, -2095600103682ll },
+			{ 1784404308226756409, 6523217234734518, -2103274982684ll },
+			{ 1790925422186508243, 6519010684149364, -2110944912492ll },
+			{ 1797442321925745115, 6514788793702356, -2118609875036ll },
+			{ 1803954992109572435, 6510551573328004, -2126269852280ll },
+			{ 1810463417413048159, 6506299032996909, -2133924826206ll },
+			{ 1816967582521218862, 6502031182715703, -2141574778802ll },
+			{ 1823467472129155763, 6497748032527056, -2149219692068ll },
+			{ 1829963070941990751, 6493449592509627, -2156859548006ll },
+			{ 1836454363674952372, 6489135872778073, -2164494328658ll },
+			{ 1842941335053401787, 6484806883482978, -2172124016036ll },
+			{ 1849423969812868729, 6480462634810879, -2179748592198ll },
+			{ 1855902252699087410, 6476103136984214, -2187368039200ll },
+			{ 1862376168468032424, 6471728400261298, -2194982339116ll },
+			{ 1868845701885954606, 6467338434936320, -2202591474032ll },
+			{ 1875310837729416894, 6462933251339282, -2210195426032ll },
+			{ 1881771560785330144, 6458512859836004, -2217794177228ll },
+			{ 1888227855850988920, 6454077270828103, -2225387709742ll },
+			{ 1894679707734107281, 6449626494752935, -2232976005694ll },
+			{ 1901127101252854522, 6445160542083616, -2240559047240ll },
+			{ 1907570021235890898, 6440679423328980, -2248136816552ll },
+			{ 1914008452522403326, 6436183149033507, -2255709295766ll },
+			{ 1920442379962141067, 6431671729777374, -2263276467084ll },
+			{ 1926871788415451357, 6427145176176383, -2270838312686ll },
+			{ 1933296662753315054, 6422603498881953, -2278394814790ll },
+			{ 1939716987857382217, 6418046708581097, -2285945955614ll },
+			{ 1946132748620007700, 6413474815996376, -2293491717384ll },
+			{ 1952543929944286692, 6408887831885897, -2301032082350ll },
+			{ 1958950516744090239, 6404285767043269, -2308567032758ll },
+			{ 1965352493944100750, 6399668632297606, -2316096550888ll },
+			{ 1971749846479847468, 6395036438513465, -2323620619018ll },
+			{ 1978142559297741915, 6390389196590851, -2331139219446ll },
+			{ 1984530617355113320, 6385726917465167, -2338652334478ll },
+			{ 1990914005620244009, 6381049612107222, -2346159946444ll },
+			{ 1997292709072404787, 6376357291523142, -2353662037656ll },
+			{ 2003666712701890273, 6371649966754425, -2361158590478ll },
+			{ 2010036001510054220, 6366927648877853, -2368649587262ll },
+			{ 2016400560509344811, 6362190349005522, -2376135010396ll },
+			{ 2022760374723339937, 6357438078284716, -2383614842244ll },
+			{ 2029115429186782409, 6352670847898023, -2391089065226ll },
+			{ 2035465708945615206, 6347888669063178, -2398557661740ll },
+			{ 2041811199057016644, 6343091553033097, -2406020614206ll },
+			{ 2048151884589435535, 6338279511095897, -2413477905090ll },
+			{ 2054487750622626342, 6333452554574730, -2420929516808ll },
+			{ 2060818782247684264, 6328610694827927, -2428375431858ll },
+			{ 2067144964567080333, 6323753943248850, -2435815632712ll },
+			{ 2073466282694696471, 6318882311265874, -2443250101840ll },
+			{ 2079782721755860505, 6313995810342446, -2450678821772ll },
+			{ 2086094266887381179, 6309094451976970, -2458101775016ll },
+			{ 2092400903237583133, 6304178247702818, -2465518944120ll },
+			{ 2098702615966341831, 6299247209088285, -2472930311610ll },
+			{ 2104999390245118506, 6294301347736584, -2480335860056ll },
+			{ 2111291211256995034, 6289340675285816, -2487735572044ll },
+			{ 2117578064196708806, 6284365203408912, -2495129430144ll },
+			{ 2123859934270687574, 6279374943813626, -2502517416956ll },
+			{ 2130136806697084244, 6274369908242542, -2509899515108ll },
+			{ 2136408666705811678, 6269350108472989, -2517275707230ll },
+			{ 2142675499538577437, 6264315556317023, -2524645975946ll },
+			{ 2148937290448918514, 6259266263621445, -2532010303930ll },
+			{ 2155194024702236029, 6254202242267738, -2539368673856ll },
+			{ 2161445687575829911, 6249123504172021, -2546721068402ll },
+			{ 2167692264358933530, 6244030061285047, -2554067470258ll },
+			{ 2173933740352748319, 6238921925592205, -2561407862162ll },
+			{ 2180170100870478362, 6233799109113406, -2568742226812ll },
+			{ 2186401331237364956, 6228661623903138, -2576070546964ll },
+			{ 2192627416790721130, 6223509482050401, -2583392805370ll },
+			{ 2198848342879966161, 6218342695678703, -2590708984818ll },
+			{ 2205064094866660046, 6213161276945968, -2598019068072ll },
+			{ 2211274658124537942, 6207965238044577, -2605323037934ll },
+			{ 2217480018039544585, 6202754591201308, -2612620877212ll },
+			{ 2223680160009868681, 6197529348677334, -2619912568748ll },
+			{ 2229875069445977267, 6192289522768133, -2627198095370ll },
+			{ 2236064731770650030, 6187035125803553, -2634477439958ll },
+			{ 2242249132419013625, 6181766170147671, -2641750585358ll },
+			{ 2248428256838575938, 6176482668198849, -2649017514458ll },
+			{ 2254602090489260329, 6171184632389693, -2656278210174ll },
+			{ 2260770618843439848, 6165872075186976, -2663532655400ll },
+			{ 2266933827385971424, 6160545009091664, -2670780833076ll },
+			{ 2273091701614230012, 6155203446638863, -2678022726150ll },
+			{ 2279244227038142725, 6149847400397789, -2685258317582ll },
+			{ 2285391389180222932, 6144476882971731, -2692487590342ll },
+			{ 2291533173575604321, 6139091906998023, -2699710527410ll },
+			{ 2297669565772074934, 6133692485148056, -2706927111808ll },
+			{ 2303800551330111182, 6128278630127173, -2714137326538ll },
+			{ 2309926115822911817, 6122850354674707, -2721341154642ll },
+			{ 2316046244836431882, 6117407671563918, -2728538579172ll },
+			{ 2322160923969416628, 6111950593601949, -2735729583182ll },
+			{ 2328270138833435395, 6106479133629854, -2742914149760ll },
+			{ 2334373875052915489, 6100993304522483, -2750092261990ll },
+			{ 2340472118265175982, 6095493119188549, -2757263902998ll },
+			{ 2346564854120461533, 6089978590570489, -2764429055886ll },
+			{ 2352652068281976136, 6084449731644533, -2771587703802ll },
+			{ 2358733746425916867, 6078906555420646, -2778739829924ll },
+			{ 2364809874241507589, 6073349074942424, -2785885417392ll },
+			{ 2370880437431032621, 6067777303287158, -2793024449396ll },
+			{ 2376945421709870383, 6062191253565777, -2800156909146ll },
+			{ 2383004812806527014, 6056590938922805, -2807282779870ll },
+			{ 2389058596462669949, 6050976372536297, -2814402044774ll },
+			{ 2395106758433161472, 6045347567617881, -2821514687114ll },
+			{ 2401149284486092239, 6039704537412685, -2828620690162ll },
+			{ 2407186160402814762, 6034047295199303, -2835720037198ll },
+			{ 2413217371977976867, 6028375854289773, -2842812711510ll },
+			{ 2419242905019555130, 6022690228029534, -2849898696408ll },
+			{ 2425262745348888256, 6016990429797422, -2856977975216ll },
+			{ 2431276878800710462, 6011276473005598, -2864050531272ll },
+			{ 2437285291223184788, 6005548371099580, -2871116347948ll },
+			{ 2443287968477936420, 5999806137558126, -2878175408612ll },
+			{ 2449284896440085934, 5994049785893287, -2885227696658ll },
+			{ 2455276060998282563, 5988279329650286, -2892273195476ll },
+			{ 2461261448054737373, 5982494782407582, -2899311888500ll },
+			{ 2467241043525256455, 5976696157776766, -2906343759156ll },
+			{ 2473214833339274065, 5970883469402550, -2913368790896ll },
+			{ 2479182803439885719, 5965056730962796, -2920386967224ll },
+			{ 2485144939783881291, 5959215956168327, -2927398271574ll },
+			{ 2491101228341778044, 5953361158763087, -2934402687486ll },
+			{ 2497051655097853645, 5947492352523974, -2941400198468ll },
+			{ 2502996206050179151, 5941609551260839, -2948390788042ll },
+			{ 2508934867210651948, 5935712768816494, -2955374439768ll },
+			{ 2514867624605028674, 5929802019066638, -2962351137216ll },
+			{ 2520794464272958096, 5923877315919844, -2969320863972ll },
+			{ 2526715372268013968, 5917938673317497, -2976283603622ll },
+			{ 2532630334657727843, 5911986105233793, -2983239339786ll },
+			{ 2538539337523621850, 5906019625675717, -2990188056106ll },
+			{ 2544442366961241461, 5900039248682958, -2997129736220ll },
+			{ 2550339409080188199, 5894044988327921, -3004064363794ll },
+			{ 2556230450004152326, 5888036858715694, -3010991922524ll },
+			{ 2562115475870945496, 5882014873983982, -3017912396104ll },
+			{ 2567994472832533374, 5875979048303080, -3024825768232ll },
+			{ 2573867427055068222, 5869929395875876, -3031732022652ll },
+			{ 2579734324718921446, 5863865930937808, -3038631143128ll },
+			{ 2585595152018716126, 5857788667756755, -3045523113390ll },
+			{ 2591449895163359491, 5851697620633151, -3052407917270ll },
+			{ 2597298540376075372, 5845592803899785, -3059285538522ll },
+			{ 2603141073894436635, 5839474231921883, -3066155960978ll },
+			{ 2608977481970397540, 5833341919097045, -3073019168478ll },
+			{ 2614807750870326107, 5827195879855194, -3079875144864ll },
+			{ 2620631866875036437, 5821036128658555, -3086723874010ll },
+			{ 2626449816279820982, 5814862680001605, -3093565339786ll },
+			{ 2632261585394482801, 5808675548411092, -3100399526120ll },
+			{ 2638067160543367773, 5802474748445902, -3107226416900ll },
+			{ 2643866528065396775, 5796260294697143, -3114045996086ll },
+			{ 2649659674314097832, 5790032201788007, -3120858247614ll },
+			{ 2655446585657638225, 5783790484373808, -3127663155464ll },
+			{ 2661227248478856569, 5777535157141913, -3134460703626ll },
+			{ 2667001649175294856, 5771266234811695, -3141250876090ll },
+			{ 2672769774159230461, 5764983732134543, -3148033656886ll },
+			{ 2678531609857708118, 5758687663893807, -3154809030066ll },
+			{ 2684287142712571859, 5752378044904728, -3161576979676ll },
+			{ 2690036359180496911, 5746054890014446, -3168337489780ll },
+			{ 2695779245733021577, 5739718214101958, -3175090544480ll },
+			{ 2701515788856579055, 5733368032078084, -3181836127892ll },
+			{ 2707245975052529247, 5727004358885411, -3188574224138ll },
+			{ 2712969790837190520, 5720627209498269, -3195304817354ll },
+			{ 2718687222741871435, 5714236598922716, -3202027891712ll },
+			{ 2724398257312902439, 5707832542196471, -3208743431390ll },
+			{ 2730102881111667520, 5701415054388897, -3215451420582ll },
+			{ 2735801080714635835, 5694984150600968, -3222151843508ll },
+			{ 2741492842713393295, 5688539845965212, -3228844684392ll },
+			{ 2747178153714674115, 5682082155645713, -3235529927502ll },
+			{ 2752857000340392326, 5675611094838044, -3242207557104ll },
+			{ 2758529369227673266, 5669126678769211, -3248877557462ll },
+			{ 2764195247028885015, 5662628922697689, -3255539912902ll },
+			{ 2769854620411669802, 5656117841913331, -3262194607750ll },
+			{ 2775507476058975383, 5649593451737332, -3268841626336ll },
+			{ 2781153800669086379, 5643055767522208, -3275480953020ll },
+			{ 2786793580955655567, 5636504804651763, -3282112572178ll },
+			{ 2792426803647735152, 5629940578541040, -3288736468200ll },
+			{ 2798053455489807992, 5623363104636318, -3295352625524ll },
+			{ 2803673523241818786, 5616772398415009, -3301961028554ll },
+			{ 2809286993679205241, 5610168475385696, -3308561661760ll },
+			{ 2814893853592929177, 5603551351088033, -3315154509598ll },
+			{ 2820494089789507612, 5596921041092769, -3321739556562ll },
+			{ 2826087689091043819, 5590277561001642, -3328316787140ll },
+			{ 2831674638335258321, 5583620926447413, -3334886185870ll },
+			{ 2837254924375519864, 5576951153093796, -3341447737296ll },
+			{ 2842828534080876364, 5570268256635400, -3348001425968ll },
+			{ 2848395454336085796, 5563572252797732, -3354547236472ll },
+			{ 2853955672041647056, 5556863157337125, -3361085153398ll },
+			{ 2859509174113830783, 5550140986040741, -3367615161366ll },
+			{ 2865055947484710158, 5543405754726494, -3374137245012ll },
+			{ 2870595979102191640, 5536657479243043, -3380651388994ll },
+			{ 2876129255930045689, 5529896175469722, -3387157577976ll },
+			{ 2881655764947937435, 5523121859316524, -3393655796640ll },
+			{ 2887175493151457319, 5516334546724093, -3400146029718ll },
+			{ 2892688427552151694, 5509534253663600, -3406628261908ll },
+			{ 2898194555177553386, 5502720996136813, -3413102477978ll },
+			{ 2903693863071212221, 5495894790175986, -3419568662692ll },
+			{ 2909186338292725515, 5489055651843833, -3426026800830ll },
+			{ 2914671967917768518, 5482203597233505, -3432476877190ll },
+			{ 2920150739038124833, 5475338642468556, -3438918876604ll },
+			{ 2925622638761716785, 5468460803702885, -3445352783914ll },
+			{ 2931087654212635756, 5461570097120720, -3451778583980ll },
+			{ 2936545772531172496, 5454666538936534, -3458196261664ll },
+			{ 2941996980873847366, 5447750145395085, -3464605801882ll },
+			{ 2947441266413440569, 5440820932771320, -3471007189556ll },
+			{ 2952878616339022333, 5433878917370328, -3477400409604ll },
+			{ 2958309017855983057, 5426924115527349, -3483785446990ll },
+			{ 2963732458186063416, 5419956543607716, -3490162286704ll },
+			{ 2969148924567384428, 5412976218006784, -3496530913724ll },
+			{ 2974558404254477488, 5405983155149945, -3502891313074ll },
+			{ 2979960884518314359, 5398977371492533, -3509243469774ll },
+			{ 2985356352646337118, 5391958883519855, -3515587368890ll },
+			{ 2990744795942488083, 5384927707747077, -3521922995490ll },
+			{ 2996126201727239670, 5377883860719239, -3528250334662ll },
+			{ 3001500557337624247, 5370827359011190, -3534569371516ll },
+			{ 3006867850127263921, 5363758219227569, -3540880091194ll },
+			{ 3012228067466400296, 5356676458002740, -3547182478840ll },
+			{ 3017581196741924196, 5349582092000780, -3553476519628ll },
+			{ 3022927225357405348, 5342475137915389, -3559762198726ll },
+			{ 3028266140733122011, 5335355612469947, -3566039501370ll },
+			{ 3033597930306090588, 5328223532417368, -3572308412776ll },
+			{ 3038922581530095180, 5321078914540134, -3578568918196ll },
+			{ 3044240081875717118, 5313921775650232, -3584821002908ll },
+			{ 3049550418830364442, 5306752132589070, -3591064652176ll },
+			{ 3054853579898301336, 5299570002227530, -3597299851324ll },
+			{ 3060149552600677542, 5292375401465864, -3603526585684ll },
+			{ 3065438324475557722, 5285168347233650, -3609744840596ll },
+			{ 3070719883077950776, 5277948856489788, -3615954601424ll },
+			{ 3075994215979839140, 5270716946222428, -3622155853560ll },
+			{ 3081261310770208008, 5263472633448984, -3628348582428ll },
+			{ 3086521155055074564, 5256215935215988, -3634532773432ll },
+			{ 3091773736457517120, 5248946868599179, -3640708412038ll },
+			{ 3097019042617704261, 5241665450703336, -3646875483684ll },
+			{ 3102257061192923913, 5234371698662377, -3653033973894ll },
+			{ 3107487779857612396, 5227065629639185, -3659183868158ll },
+			{ 3112711186303383423, 5219747260825660, -3665325152016ll },
+			{ 3117927268239057067, 5212416609442626, -3671457811012ll },
+			{ 3123136013390688681, 5205073692739800, -3677581830700ll },
+			{ 3128337409501597781, 5197718527995784, -3683697196688ll },
+			{ 3133531444332396877, 5190351132517998, -3689803894584ll },
+			{ 3138718105661020291, 5182971523642633, -3695901910018ll },
+			{ 3143897381282752906, 5175579718734605, -3701991228626ll },
+			{ 3149069259010258885, 5168175735187563, -3708071836098ll },
+			{ 3154233726673610350, 5160759590423791, -3714143718118ll },
+			{ 3159390772120316023, 5153331301894197, -3720206860402ll },
+			{ 3164540383215349818, 5145890887078252, -3726261248676ll },
+			{ 3169682547841179394, 5138438363483978, -3732306868700ll },
+			{ 3174817253897794672, 5130973748647881, -3738343706242ll },
+			{ 3179944489302736311, 5123497060134918, -3744371747100ll },
+			{ 3185064241991124129, 5116008315538471, -3750390977098ll },
+			{ 3190176499915685502, 5108507532480261, -3756401382054ll },
+			{ 3195281251046783709, 5100994728610379, -3762402947846ll },
+			{ 3200378483372446242, 5093469921607152, -3768395660332ll },
+			{ 3205468184898393062, 5085933129177192, -3774379505420ll },
+			{ 3210550343648064834, 5078384369055292, -3780354469024ll },
+			{ 3215624947662651102, 5070823659004423, -3786320537090ll },
+			{ 3220691985001118435, 5063251016815669, -3792277695590ll },
+			{ 3225751443740238514, 5055666460308176, -3798225930484ll },
+			{ 3230803311974616206, 5048070007329138, -3804165227780ll },
+			{ 3235847577816717564, 5040461675753756, -3810095573516ll },
+			{ 3240884229396897804, 5032841483485155, -3816016953722ll },
+			{ 3245913254863429237, 5025209448454394, -3821929354480ll },
+			{ 3250934642382529151, 5017565588620394, -3827832761872ll },
+			{ 3255948380138387673, 5009909921969872, -3833727161992ll },
+			{ 3260954456333195553, 5002242466517376, -3839612540992ll },
+			{ 3265952859187171937, 4994563240305155, -3845488885010ll },
+			{ 3270943576938592082, 4986872261403172, -3851356180216ll },
+			{ 3275926597843815038, 4979169547909037, -3857214412806ll },
+			{ 3280901910177311269, 4971455117948008, -3863063569016ll },
+			{ 3285869502231690261, 4963728989672852, -3868903635052ll },
+			{ 3290829362317728061, 4955991181263902, -3874734597184ll },
+			{ 3295781478764394779, 4948241710928985, -3880556441698ll },
+			{ 3300725839918882066, 4940480596903326, -3886369154876ll },
+			{ 3305662434146630516, 4932707857449591, -3892172723054ll },
+			{ 3310591249831357053, 4924923510857792, -3897967132576ll },
+			{ 3315512275375082269, 4917127575445251, -3903752369814ll },
+			{ 3320425499198157706, 4909320069556543, -3909528421138ll },
+			{ 3325330909739293111, 4901501011563480, -3915295272956ll },
+			{ 3330228495455583635, 4893670419865080, -3921052911716ll },
+			{ 3335118244822536999, 4885828312887480, -3926801323864ll },
+			{ 3340000146334100615, 4877974709083901, -3932540495866ll },
+			{ 3344874188502688650, 4870109626934628, -3938270414208ll },
+			{ 3349740359859209070, 4862233084946974, -3943991065428ll },
+			{ 3354598648953090616, 4854345101655199, -3949702436054ll },
+			{ 3359449044352309761, 4846445695620498, -3955404512660ll },
+			{ 3364291534643417599, 4838534885430920, -3961097281808ll },
+			{ 3369126108431566711, 4830612689701368, -3966780730108ll },
+			{ 3373952754340537971, 4822679127073539, -3972454844190ll },
+			{ 3378771461012767320, 4814734216215876, -3978119610708ll },
+			{ 3383582217109372488, 4806777975823518, -3983775016324ll },
+			{ 3388385011310179682, 4798810424618259, -3989421047730ll },
+			{ 3393179832313750211, 4790831581348537, -3995057691650ll },
+			{ 3397966668837407098, 4782841464789320, -4000684934808ll },
+			{ 3402745509617261610, 4774840093742130, -4006302763968ll },
+			{ 3407516343408239772, 4766827487034972, -4011911165908ll },
+			{ 3412279158984108836, 4758803663522280, -4017510127440ll },
+			{ 3417033945137503676, 4750768642084887, -4023099635382ll },
+			{ 3421780690679953181, 4742722441629961, -4028679676570ll },
+			{ 3426519384441906572, 4734665081091009, -4034250237894ll },
+			{ 3431250015272759687, 4726596579427785, -4039811306250ll },
+			{ 3435972572040881222, 4718516955626217, -4045362868522ll },
+			{ 3440687043633638917, 4710426228698467, -4050904911666ll },
+			{ 3445393418957425718, 4702324417682803, -4056437422650ll },
+			{ 3450091686937685871, 4694211541643541, -4061960388434ll },
+			{ 3454781836518940978, 4686087619671089, -4067473796038ll },
+			{ 3459463856664816029, 4677952670881813, -4072977632490ll },
+			{ 3464137736358065352, 4669806714418025, -4078471884822ll },
+			{ 3468803464600598555, 4661649769447946, -4083956540116ll },
+			{ 3473461030413506385, 4653481855165663, -4089431585462ll },
+			{ 3478110422837086586, 4645302990791082, -4094897007996ll },
+			{ 3482751630930869672, 4637113195569819, -4100352794818ll },
+			{ 3487384643773644673, 4628912488773297, -4105798933134ll },
+			{ 3492009450463484836, 4620700889698562, -4111235410112ll },
+			{ 3496626040117773286, 4612478417668283, -4116662212946ll },
+			{ 3501234401873228623, 4604245092030734, -4122079328876ll },
+			{ 3505834524885930481, 4596000932159734, -4127486745156ll },
+			{ 3510426398331345059, 4587745957454583, -4132884449058ll },
+			{ 3515010011404350584, 4579480187340039, -4138272427890ll },
+			{ 3519585353319262733, 4571203641266249, -4143650668962ll },
+			{ 3524152413309860020, 4562916338708734, -4149019159624ll },
+			{ 3528711180629409130, 4554618299168312, -4154377887244ll },
+			{ 3533261644550690198, 4546309542171075, -4159726839214ll },
+			{ 3537803794366022059, 4537990087268321, -4165066002938ll },
+			{ 3542337619387287442, 4529659954036556, -4170395365872ll },
+			{ 3546863108945958126, 4521319162077358, -4175714915452ll },
+			{ 3551380252393120032, 4512967731017438, -4181024639180ll },
+			{ 3555889039099498290, 4504605680508509, -4186324524550ll },
+			{ 3560389458455482249, 4496233030227283, -4191614559090ll },
+			{ 3564881499871150442, 4487849799875428, -4196894730368ll },
+			{ 3569365152776295502, 4479456009179464, -4202165025928ll },
+			{ 3573840406620449038, 4471051677890826, -4207425433396ll },
+			{ 3578307250872906468, 4462636825785701, -4212675940390ll },
+			{ 3582765675022751779, 4454211472665050, -4217916534544ll },
+			{ 3587215668578882285, 4445775638354549, -4223147203542ll },
+			{ 3591657221070033292, 4437329342704523, -4228367935058ll },
+			{ 3596090322044802757, 4428872605589914, -4233578716812ll },
+			{ 3600514961071675859, 4420405446910268, -4238779536560ll },
+			{ 3604931127739049567, 4411927886589606, -4243970382044ll },
+			{ 3609338811655257129, 4403439944576451, -4249151241054ll },
+			{ 3613738002448592526, 4394941640843742, -4254322101396ll },
+			{ 3618128689767334872, 4386432995388833, -4259482950918ll },
+			{ 3622510863279772787, 4377914028233362, -4264633777456ll },
+			{ 3626884512674228693, 4369384759423297, -4269774568906ll },
+			{ 3631249627659083084, 4360845209028827, -4274905313162ll },
+			{ 3635606197962798749, 4352295397144348, -4280025998156ll },
+			{ 3639954213333944941, 4343735343888363, -4285136611822ll },
+			{ 3644293663541221482, 4335165069403554, -4290237142172ll },
+			{ 3648624538373482864, 4326584593856553, -4295327577154ll },
+			{ 3652946827639762263, 4317993937438068, -4300407904820ll },
+			{ 3657260521169295511, 4309393120362769, -4305478113226ll },
+			{ 3661565608811545054, 4300782162869175, -4310538190418ll },
+			{ 3665862080436223811, 4292161085219714, -4315588124496ll },
+			{ 3670149925933319029, 4283529907700618, -4320627903584ll },
+			{ 3674429135213116063, 4274888650621862, -4325657515804ll },
+			{ 3678699698206222121, 4266237334317185, -4330676949346ll },
+			{ 3682961604863589960, 4257575979143953, -4335686192378ll },
+			{ 3687214845156541535, 4248904605483171, -4340685233122ll },
+			{ 3691459409076791584, 4240223233739433, -4345674059818ll },
+			{ 3695695286636471199, 4231531884340839, -4350652660726ll },
+			{ 3699922467868151312, 4222830577738969, -4355621024130ll },
+			{ 3704140942824866151, 4214119334408836, -4360579138328ll },
+			{ 3708350701580136659, 4205398174848845, -4365526991666ll },
+			{ 3712551734227993838, 4196667119580718, -4370464572496ll },
+			{ 3716744030883002060, 4187926189149476, -4375391869196ll },
+			{ 3720927581680282340, 4179175404123381, -4380308870186ll },
+			{ 3725102376775535535, 4170414785093870, -4385215563892ll },
+			{ 3729268406345065513, 4161644352675522, -4390111938752ll },
+			{ 3733425660585802283, 4152864127506011, -4394997983258ll },
+			{ 3737574129715325036, 4144074130246060, -4399873685912ll },
+			{ 3741713803971885184, 4135274381579368, -4404739035224ll },
+			{ 3745844673614429328, 4126464902212608, -4409594019768ll },
+			{ 3749966728922622168, 4117645712875328, -4414438628104ll },
+			{ 3754079960196869392, 4108816834319946, -4419272848848ll },
+			{ 3758184357758340490, 4099978287321657, -4424096670622ll },
+			{ 3762279911948991525, 4091130092678412, -4428910082056ll },
+			{ 3766366613131587881, 4082272271210869, -4433713071842ll },
+			{ 3770444451689726908, 4073404843762350, -4438505628680ll },
+			{ 3774513418027860578, 4064527831198752, -4443287741280ll },
+			{ 3778573502571318050, 4055641254408553, -4448059398398ll },
+			{ 3782624695766328205, 4046745134302715, -4452820588794ll },
+			{ 3786666988080042126, 4037839491814692, -4457571301292ll },
+			{ 3790700370000555526, 4028924347900284, -4462311524668ll },
+			{ 3794724832036931142, 4019999723537716, -4467041247808ll },
+			{ 3798740364719221050, 4011065639727490, -4471760459576ll },
+			{ 3802746958598488964, 4002122117492346, -4476469148840ll },
+			{ 3806744604246832470, 3993169177877270, -4481167304548ll },
+			{ 3810733292257405192, 3984206841949403, -4485854915642ll },
+			{ 3814713013244438953, 3975235130797973, -4490531971082ll },
+			{ 3818683757843265844, 3966254065534294, -4495198459872ll },
+			{ 3822645516710340266, 3957263667291668, -4499854371020ll },
+			{ 3826598280523260914, 3948263957225371, -4504499693570ll },
+			{ 3830542039980792715, 3939254956512604, -4509134416608ll },
+			{ 3834476785802888711, 3930236686352400, -4513758529208ll },
+			{ 3838402508730711903, 3921209167965638, -4518372020512ll },
+			{ 3842319199526657029, 3912172422594928, -4522974879644ll },
+			{ 3846226848974372313, 3903126471504599, -4527567095770ll },
+			{ 3850125447878781142, 3894071335980650, -4532148658096ll },
+			{ 3854014987066103696, 3885007037330711, -4536719555846ll },
+			{ 3857895457383878561, 3875933596883927, -4541279778254ll },
+			{ 3861766849700984234, 3866851035990990, -4545829314588ll },
+			{ 3865629154907660636, 3857759376024048, -4550368154152ll },
+			{ 3869482363915530532, 3848658638376638, -4554896286256ll },
+			{ 3873326467657620914, 3839548844463699, -4559413700250ll },
+			{ 3877161457088384363, 3830430015721432, -4563920385504ll },
+			{ 3880987323183720291, 3821302173607345, -4568416331418ll },
+			{ 3884804056940996218, 3812165339600118, -4572901527404ll },
+			{ 3888611649379068932, 3803019535199602, -4577375962908ll },
+			{ 3892410091538305626, 3793864781926754, -4581839627396ll },
+			{ 3896199374480604984, 3784701101323609, -4586292510382ll },
+			{ 3899979489289418211, 3775528514953196, -4590734601388ll },
+			{ 3903750427069770019, 3766347044399471, -4595165889938ll },
+			{ 3907512178948279552, 3757156711267333, -4599586365614ll },
+			{ 3911264736073181271, 3747957537182537, -4603996018034ll },
+			{ 3915008089614345774, 3738749543791619, -4608394836802ll },
+			{ 3918742230763300591, 3729532752761864, -4612782811564ll },
+			{ 3922467150733250891, 3720307185781291, -4617159932010ll },
+			{ 3926182840759100172, 3711072864558544, -4621526187836ll },
+			{ 3929889292097470880, 3701829810822868, -4625881568760ll },
+			{ 3933586496026724988, 3692578046324070, -4630226064540ll },
+			{ 3937274443846984518, 3683317592832438, -4634559664952ll },
+			{ 3940953126880152004, 3674048472138701, -4638882359782ll },
+			{ 3944622536469930923, 3664770706054028, -4643194138892ll },
+			{ 3948282663981846059, 3655484316409878, -4647494992116ll },
+			{ 3951933500803263821, 3646189325058018, -4651784909324ll },
+			{ 3955575038343412515, 3636885753870469, -4656063880438ll },
+			{ 3959207268033402546, 3627573624739434, -4660331895384ll },
+			{ 3962830181326246596, 3618252959577256, -4664588944124ll },
+			{ 3966443769696879728, 3608923780316355, -4668835016638ll },
+			{ 3970048024642179445, 3599586108909182, -4673070102920ll },
+			{ 3973642937680985707, 3590239967328192, -4677294193024ll },
+			{ 3977228500354120875, 3580885377565759, -4681507277006ll },
+			{ 3980804704224409628, 3571522361634138, -4685709344952ll },
+			{ 3984371540876698814, 3562150941565393, -4689900386958ll },
+			{ 3987929001917877249, 3552771139411386, -4694080393176ll },
+			{ 3991477078976895459, 3543382977243719, -4698249353782ll },
+			{ 3995015763704785396, 3533986477153625, -4702407258942ll },
+			{ 3998545047774680079, 3524581661251976, -4706554098888ll },
+			{ 4002064922881833167, 3515168551669217, -4710689863854ll },
+			{ 4005575380743638530, 3505747170555307, -4714814544114ll },
+			{ 4009076413099649723, 3496317540079659, -4718928129958ll },
+			{ 4012568011711599424, 3486879682431111, -4723030611710ll },
+			{ 4016050168363418825, 3477433619817860, -4727121979724ll },
+			{ 4019522874861256961, 3467979374467384, -4731202224352ll },
+			{ 4022986123033499993, 3458516968626452, -4735271336008ll },
+			{ 4026439904730790437, 3449046424561016, -4739329305120ll },
+			{ 4029884211826046333, 3439567764556178, -4743376122132ll },
+			{ 4033319036214480379, 3430081010916129, -4747411777502ll },
+			{ 4036744369813619006, 3420586185964137, -4751436261770ll },
+			{ 4040160204563321373, 3411083312042424, -4755449565440ll },
+			{ 4043566532425798357, 3401572411512195, -4759451679090ll },
+			{ 4046963345385631462, 3392053506753501, -4763442593286ll },
+			{ 4050350635449791677, 3382526620165243, -4767422298642ll },
+			{ 4053728394647658278, 3372991774165103, -4771390785786ll },
+			{ 4057096615031037595, 3363448991189499, -4775348045386ll },
+			{ 4060455288674181708, 3353898293693537, -4779294068146ll },
+			{ 4063804407673807099, 3344339704150911, -4783228844758ll },
+			{ 4067143964149113252, 3334773245053905, -4787152365966ll },
+			{ 4070473950241801191, 3325198938913324, -4791064622540ll },
+			{ 4073794358116091975, 3315616808258450, -4794965605284ll },
+			{ 4077105179958745141, 3306026875636941, -4798855305006ll },
+			{ 4080406407979077076, 3296429163614847, -4802733712558ll },
+			{ 4083698034408979365, 3286823694776501, -4806600818810ll },
+			{ 4086980051502937056, 3277210491724515, -4810456614670ll },
+			{ 4090252451538046901, 3267589577079682, -4814301091068ll },
+			{ 4093515226814035515, 3257960973480927, -4818134238942ll },
+			{ 4096768369653277500, 3248324703585292, -4821956049276ll },
+			{ 4100011872400813516, 3238680790067861, -4825766513090ll },
+			{ 4103245727424368287, 3229029255621686, -4829565621408ll },
+			{ 4106469927114368565, 3219370122957761, -4833353365290ll },
+			{ 4109684463883961036, 3209703414804954, -4837129735824ll },
+			{ 4112889330169030166, 3200029153909970, -4840894724128ll },
+			{ 4116084518428216008, 3190347363037283, -4844648321342ll },
+			{ 4119270021142931949, 3180658064969058, -4848390518616ll },
+			{ 4122445830817382391, 3170961282505184, -4852121307176ll },
+			{ 4125611939978580399, 3161257038463096, -4855840678212ll },
+			{ 4128768341176365283, 3151545355677841, -4859548622994ll },
+			{ 4131915026983420130, 3141826257001935, -4863245132790ll },
+			{ 4135051989995289275, 3132099765305357, -4866930198898ll },
+			{ 4138179222830395734, 3122365903475476, -4870603812640ll },
+			{ 4141296718130058570, 3112624694417026, -4874265965396ll },
+			{ 4144404468558510200, 3102876161052004, -4877916648532ll },
+			{ 4147502466802913672, 3093120326319638, -4881555853448ll },
+			{ 4150590705573379862, 3083357213176361, -4885183571594ll },
+			{ 4153669177602984629, 3073586844595731, -4888799794438ll },
+			{ 4156737875647785922, 3063809243568344, -4892404513452ll },
+			{ 4159796792486840814, 3054024433101868, -4895997720180ll },
+			{ 4162845920922222502, 3044232436220894, -4899579406148ll },
+			{ 4165885253779037248, 3034433275966926, -4903149562924ll },
+			{ 4168914783905441250, 3024626975398346, -4906708182120ll },
+			{ 4171934504172657476, 3014813557590338, -4910255255364ll },
+			{ 4174944407474992450, 3004993045634797, -4913790774294ll },
+			{ 4177944486729852953, 2995165462640351, -4917314730602ll },
+			{ 4180934734877762702, 2985330831732260, -4920827116004ll },
+			{ 4183915144882378958, 2975489176052338, -4924327922212ll },
+			{ 4186885709730509084, 2965640518758972, -4927817141008ll },
+			{ 4189846422432127048, 2955784883026988, -4931294764164ll },
+			{ 4192797276020389872, 2945922292047672, -4934760783528ll },
+			{ 4195738263551654016, 2936052769028617, -4938215190898ll },
+			{ 4198669378105491735, 2926176337193800, -4941657978188ll },
+			{ 4201590612784707347, 2916293019783402, -4945089137272ll },
+			{ 4204501960715353477, 2906402840053818, -4948508660084ll },
+			{ 4207403415046747211, 2896505821277608, -4951916538576ll },
+			{ 4210294968951486243, 2886601986743406, -4955312764728ll },
+			{ 4213176615625464921, 2876691359755905, -4958697330562ll },
+			{ 4216048348287890264, 2866773963635752, -4962070228096ll },
+			{ 4218910160181297920, 2856849821719540, -4965431449396ll },
+			{ 4221762044571568064, 2846918957359742, -4968780986564ll },
+			{ 4224603994747941242, 2836981393924638, -4972118831704ll },
+			{ 4227436004023034176, 2827037154798257, -4975444976962ll },
+			{ 4230258065732855471, 2817086263380376, -4978759414524ll },
+			{ 4233070173236821323, 2807128743086404, -4982062136584ll },
+			{ 4235872319917771143, 2797164617347337, -4985353135370ll },
+			{ 4238664499181983110, 2787193909609728, -4988632403136ll },
+			{ 4241446704459189702, 2777216643335626, -4991899932176ll },
+			{ 4244218929202593152, 2767232842002489, -4995155714790ll },
+			{ 4246981166888880851, 2757242529103172, -4998399743320ll },
+			{ 4249733411018240703, 2747245728145848, -5001632010136ll },
+			{ 4252475655114376415, 2737242462653935, -5004852507610ll },
+			{ 4255207892724522740, 2727232756166118, -5008061228204ll },
+			{ 4257930117419460654, 2717216632236181, -5011258164338ll },
+			{ 4260642322793532497, 2707194114433036, -5014443308500ll },
+			{ 4263344502464657033, 2697165226340638, -5017616653196ll },
+			{ 4266036650074344475, 2687129991557921, -5020778190946ll },
+			{ 4268718759287711450, 2677088433698762, -5023927914320ll },
+			{ 4271390823793495892, 2667040576391933, -5027065815914ll },
+			{ 4274052837304071911, 2656986443280995, -5030191888330ll },
+			{ 4276704793555464576, 2646926058024313, -5033306124230ll },
+			{ 4279346686307364659, 2636859444294923, -5036408516266ll },
+			{ 4281978509343143316, 2626786625780546, -5039499057140ll },
+			{ 4284600256469866722, 2616707626183506, -5042577739592ll },
+			{ 4287211921518310636, 2606622469220662, -5045644556376ll },
+			{ 4289813498342974922, 2596531178623356, -5048699500268ll },
+			{ 4292404980822098010, 2586433778137370, -5051742564080ll },
+			{ 4294986362857671300, 2576330291522856, -5054773740648ll },
+			{ 4297557638375453508, 2566220742554317, -5057793022858ll },
+			{ 4300118801324984967, 2556105155020480, -5060800403588ll },
+			{ 4302669845679601859, 2545983552724293, -5063795875758ll },
+			{ 4305210765436450394, 2535855959482881, -5066779432334ll },
+			{ 4307741554616500941, 2525722399127454, -5069751066296ll },
+			{ 4310262207264562099, 2515582895503232, -5072710770636ll },
+			{ 4312772717449294695, 2505437472469472, -5075658538400ll },
+			{ 4315273079263225767, 2495286153899303, -5078594362634ll },
+			{ 4317763286822762436, 2485128963679790, -5081518236456ll },
+			{ 4320243334268205770, 2474965925711783, -5084430152986ll },
+			{ 4322713215763764567, 2464797063909867, -5087330105346ll },
+			{ 4325172925497569088, 2454622402202379, -5090218086738ll },
+			{ 4327622457681684729, 2444441964531260, -5093094090340ll },
+			{ 4330061806552125649, 2434255774852077, -5095958109406ll },
+			{ 4332490966368868320, 2424063857133929, -5098810137202ll },
+			{ 4334909931415865047, 2413866235359363, -5101650166998ll },
+			{ 4337318696001057412, 2403662933524362, -5104478192104ll },
+			{ 4339717254456389670, 2393453975638304, -5107294205896ll },
+			{ 4342105601137822078, 2383239385723855, -5110098201734ll },
+			{ 4344483730425344199, 2373019187816905, -5112890173010ll },
+			{ 4346851636722988094, 2362793405966591, -5115670113170ll },
+			{ 4349209314458841515, 2352562064235143, -5118438015650ll },
+			{ 4351556758085061008, 2342325186697910, -5121193873948ll },
+			{ 4353893962077884970, 2332082797443258, -5123937681596ll },
+			{ 4356220920937646632, 2321834920572528, -5126669432132ll },
+			{ 4358537629188787028, 2311581580199935, -5129389119102ll },
+			{ 4360844081379867861, 2301322800452586, -5132096736124ll },
+			{ 4363140272083584323, 2291058605470398, -5134792276832ll },
+			{ 4365426195896777889, 2280789019406005, -5137475734878ll },
+			{ 4367701847440449016, 2270514066424725, -5140147103942ll },
+			{ 4369967221359769799, 2260233770704542, -5142806377756ll },
+			{ 4372222312324096585, 2249948156435951, -5145453550042ll },
+			{ 4374467115026982494, 2239657247822017, -5148088614578ll },
+			{ 4376701624186189933, 2229361069078234, -5150711565160ll },
+			{ 4378925834543703007, 2219059644432502, -5153322395624ll },
+			{ 4381139740865739885, 2208752998125087, -5155921099826ll },
+			{ 4383343337942765146, 2198441154408498, -5158507671640ll },
+			{ 4385536620589502004, 2188124137547522, -5161082104996ll },
+			{ 4387719583644944530, 2177801971819080, -5163644393824ll },
+			{ 4389892221972369786, 2167474681512237, -5166194532102ll },
+			{ 4392054530459349921, 2157142290928102, -5168732513824ll },
+			{ 4394206504017764199, 2146804824379760, -5171258333004ll },
+			{ 4396348137583810955, 2136462306192316, -5173771983728ll },
+			{ 4398479426118019543, 2126114760702684, -5176273460064ll },
+			{ 4400600364605262163, 2115762212259649, -5178762756130ll },
+			{ 4402710948054765682, 2105404685223743, -5181239866058ll },
+			{ 4404811171500123367, 2095042203967251, -5183704784038ll },
+			{ 4406901029999306580, 2084674792874084, -5186157504268ll },
+			{ 4408980518634676396, 2074302476339764, -5188598020968ll },
+			{ 4411049632512995192, 2063925278771316, -5191026328368ll },
+			{ 4413108366765438140, 2053543224587340, -5193442420804ll },
+			{ 4415156716547604676, 2043156338217794, -5195846292568ll },
+			{ 4417194677039529902, 2032764644104024, -5198237938004ll },
+			{ 4419222243445695922, 2022368166698677, -5200617351474ll },
+			{ 4421239410995043125, 2011966930465687, -5202984527390ll },
+			{ 4423246174940981422, 2001560959880159, -5205339460186ll },
+			{ 4425242530561401395, 1991150279428357, -5207682144318ll },
+			{ 4427228473158685434, 1980734913607600, -5210012574264ll },
+			{ 4429203998059718770, 1970314886926270, -5212330744556ll },
+			{ 4431169100615900484, 1959890223903682, -5214636649724ll },
+			{ 4433123776203154442, 1949460949070077, -5216930284350ll },
+			{ 4435068020221940169, 1939027086966559, -5219211643042ll },
+			{ 4437001828097263686, 1928588662144988, -5221480720412ll },
+			{ 4438925195278688262, 1918145699168002, -5223737511136ll },
+			{ 4440838117240345128, 1907698222608904, -5225982009900ll },
+			{ 4442740589480944132, 1897246257051614, -5228214211432ll },
+			{ 4444632607523784314, 1886789827090621, -5230434110474ll },
+			{ 4446514166916764461, 1876328957330891, -5232641701782ll },
+			{ 4448385263232393570, 1865863672387891, -5234836980190ll },
+			{ 4450245892067801271, 1855393996887416, -5237019940508ll },
+			{ 4452096049044748179, 1844919955465665, -5239190577630ll },
+			{ 4453935729809636214, 1834441572769045, -5241348886430ll },
+			{ 4455764930033518829, 1823958873454194, -5243494861820ll },
+			{ 4457583645412111203, 1813471882187931, -5245628498766ll },
+			{ 4459391871665800368, 1802980623647161, -5247749792242ll },
+			{ 4461189604539655287, 1792485122518806, -5249858737248ll },
+			{ 4462976839803436845, 1781985403499823, -5251955328834ll },
+			{ 4464753573251607834, 1771481491297046, -5254039562060ll },
+			{ 4466519800703342820, 1760973410627208, -5256111432028ll },
+			{ 4468275518002538000, 1750461186216827, -5258170933854ll },
+			{ 4470020721017820973, 1739944842802196, -5260218062704ll },
+			{ 4471755405642560465, 1729424405129268, -5262252813744ll },
+			{ 4473479567794875989, 1718899897953660, -5264275182196ll },
+			{ 4475193203417647453, 1708371346040554, -5266285163300ll },
+			{ 4476896308478524707, 1697838774164647, -5268282752326ll },
+			{ 4478588878969937028, 1687302207110101, -5270267944574ll },
+			{ 4480270910909102555, 1676761669670479, -5272240735378ll },
+			{ 4481942400338037656, 1666217186648679, -5274201120086ll },
+			{ 4483603343323566249, 1655668782856881, -5276149094086ll },
+			{ 4485253735957329044, 1645116483116505, -5278084652798ll },
+			{ 4486893574355792751, 1634560312258151, -5280007791682ll },
+			{ 4488522854660259220, 1624000295121480, -5281918506188ll },
+			{ 4490141573036874512, 1613436456555234, -5283816791820ll },
+			{ 4491749725676637926, 1602868821417151, -5285702644122ll },
+			{ 4493347308795410955, 1592297414573910, -5287576058664ll },
+			{ 4494934318633926201, 1581722260901049, -5289437031030ll },
+			{ 4496510751457796220, 1571143385282904, -5291285556832ll },
+			{ 4498076603557522292, 1560560812612614, -5293121631728ll },
+			{ 4499631871248503178, 1549974567791984, -5294945251396ll },
+			{ 4501176550871043766, 1539384675731475, -5296756411550ll },
+			{ 4502710638790363691, 1528791161350140, -5298555107936ll },
+			{ 4504234131396605895, 1518194049575511, -5300341336294ll },
+			{ 4505747025104845112, 1507593365343630, -5302115092436ll },
+			{ 4507249316355096306, 1496989133598941, -5303876372198ll },
+			{ 4508741001612323049, 1486381379294221, -5305625171430ll },
+			{ 4510222077366445840, 1475770127390531, -5307361486006ll },
+			{ 4511692540132350365, 1465155402857173, -5309085311846ll },
+			{ 4513152386449895692, 1454537230671622, -5310796644892ll },
+			{ 4514601612883922422, 1443915635819471, -5312495481130ll },
+			{ 4516040216024260763, 1433290643294363, -5314181816558ll },
+			{ 4517468192485738568, 1422662278097912, -5315855647200ll },
+			{ 4518885538908189280, 1412030565239685, -5317516969102ll },
+			{ 4520292251956459863, 1401395529737154, -5319165778392ll },
+			{ 4521688328320418625, 1390757196615572, -5320802071168ll },
+			{ 4523073764714963029, 1380115590907956, -5322425843572ll },
+			{ 4524448557880027413, 1369470737655046, -5324037091804ll },
+			{ 4525812704580590655, 1358822661905207, -5325635812062ll },
+			{ 4527166201606683800, 1348171388714380, -5327222000580ll },
+			{ 4528509045773397600, 1337516943146060, -5328795653636ll },
+			{ 4529841233920890024, 1326859350271162, -5330356767516ll },
+			{ 4531162762914393670, 1316198635168051, -5331905338558ll },
+			{ 4532473629644223163, 1305534822922417, -5333441363114ll },
+			{ 4533773831025782466, 1294867938627210, -5334964837544ll },
+			{ 4535063363999572132, 1284198007382684, -5336475758308ll },
+			{ 4536342225531196508, 1273525054296193, -5337974121822ll },
+			{ 4537610412611370879, 1262849104482229, -5339459924566ll },
+			{ 4538867922255928542, 1252170183062342, -5340933163052ll },
+			{ 4540114751505827832, 1241488315165055, -5342393833798ll },
+			{ 4541350897427159089, 1230803525925844, -5343841933384ll },
+			{ 4542576357111151549, 1220115840487038, -5345277458384ll },
+			{ 4543791127674180203, 1209425283997806, -5346700405436ll },
+			{ 4544995206257772573, 1198731881614052, -5348110771180ll },
+			{ 4546188590028615445, 1188035658498390, -5349508552312ll },
+			{ 4547371276178561523, 1177336639820073, -5350893745534ll },
+			{ 4548543261924636062, 1166634850754908, -5352266347584ll },
+			{ 4549704544509043386, 1155930316485241, -5353626355226ll },
+			{ 4550855121199173401, 1145223062199888, -5354973765276ll },
+			{ 4551994989287608013, 1134513113094042, -5356308574552ll },
+			{ 4553124146092127503, 1123800494369248, -5357630779912ll },
+			{ 4554242588955716839, 1113085231233347, -5358940378262ll },
+			{ 4555350315246571924, 1102367348900372, -5360237366504ll },
+			{ 4556447322358105792, 1091646872590547, -5361521741590ll },
+			{ 4557533607708954749, 1080923827530161, -5362793500482ll },
+			{ 4558609168742984428, 1070198238951608, -5364052640212ll },
+			{ 4559674002929295824, 1059470132093217, -5365299157810ll },
+			{ 4560728107762231231, 1048739532199280, -5366533050348ll },
+			{ 4561771480761380163, 1038006464519912, -5367754314912ll },
+			{ 4562804119471585163, 1027270954311065, -5368962948630ll },
+			{ 4563826021462947598, 1016533026834424, -5370158948652ll },
+			{ 4564837184330833370, 1005792707357383, -5371342312174ll },
+			{ 4565837605695878579, 995050021152949, -5372513036418ll },
+			{ 4566827283203995110, 984304993499693, -5373671118610ll },
+			{ 4567806214526376193, 973557649681709, -5374816556038ll },
+			{ 4568774397359501864, 962808014988533, -5375949346006ll },
+			{ 4569731829425144391, 952056114715096, -5377069485844ll },
+			{ 4570678508470373643, 941301974161650, -5378176972912ll },
+			{ 4571614432267562381, 930545618633739, -5379271804618ll },
+			{ 4572539598614391502, 919787073442093, -5380353978374ll },
+			{ 4573454005333855221, 909026363902631, -5381423491646ll },
+			{ 4574357650274266206, 898263515336312, -5382480341900ll },
+			{ 4575250531309260618, 887498553069173, -5383524526654ll },
+			{ 4576132646337803137, 876731502432222, -5384556043472ll },
+			{ 4577003993284191887, 865962388761344, -5385574889892ll },
+			{ 4577864570098063339, 855191237397331, -5386581063550ll },
+			{ 4578714374754397120, 844418073685709, -5387574562046ll },
+			{ 4579553405253520783, 833642922976801, -5388555383062ll },
+			{ 4580381659621114522, 822865810625559, -5389523524282ll },
+			{ 4581199135908215799, 812086761991585, -5390478983438ll },
+			{ 4582005832191223946, 801305802439027, -5391421758286ll },
+			{ 4582801746571904687, 790522957336499, -5392351846586ll },
+			{ 4583586877177394600, 779738252057100, -5393269246168ll },
+			{ 4584361222160205532, 768951711978281, -5394173954874ll },
+			{ 4585124779698228939, 758163362481788, -5395065970548ll },
+			{ 4585877547994740179, 747373228953665, -5395945291114ll },
+			{ 4586619525278402730, 736581336784161, -5396811914514ll },
+			{ 4587350709803272377, 725787711367602, -5397665838680ll },
+			{ 4588071099848801299, 714992378102458, -5398507061620ll },
+			{ 4588780693719842137, 704195362391188, -5399335581360ll },
+			{ 4589479489746651965, 693396689640208, -5400151395944ll },
+			{ 4590167486284896229, 682596385259821, -5400954503426ll },
+			{ 4590844681715652624, 671794474664217, -5401744901962ll },
+			{ 4591511074445414879, 660990983271327, -5402522589674ll },
+			{ 4592166662906096532, 650185936502792, -5403287564712ll },
+			{ 4592811445555034612, 639379359783940, -5404039825292ll },
+			{ 4593445420874993260, 628571278543700, -5404779369656ll },
+			{ 4594068587374167304, 617761718214531, -5405506196054ll },
+			{ 4594680943586185781, 606950704232354, -5406220302764ll },
+			{ 4595282488070115371, 596138262036552, -5406921688124ll },
+			{ 4595873219410463799, 585324417069821, -5407610350466ll },
+			{ 4596453136217183154, 574509194778209, -5408286288186ll },
+			{ 4597022237125673177, 563692620610963, -5408949499686ll },
+			{ 4597580520796784454, 552874720020529, -5409599983402ll },
+			{ 4598127985916821581, 542055518462476, -5410237737812ll },
+			{ 4598664631197546245, 531235041395422, -5410862761400ll },
+			{ 4599190455376180267, 520413314280998, -5411475052708ll },
+			{ 4599705457215408557, 509590362583780, -5412074610296ll },
+			{ 4600209635503382041, 498766211771212, -5412661432744ll },
+			{ 4600702989053720509, 487940887313574, -5413235518684ll },
+			{ 4601185516705515399, 477114414683884, -5413796866748ll },
+			{ 4601657217323332535, 466286819357896, -5414345475632ll },
+			{ 4602118089797214799, 455458126813985, -5414881344042ll },
+			{ 4602568133042684742, 444628362533108, -5415404470712ll },
+			{ 4603007346000747138, 433797551998733, -5415914854406ll },
+			{ 4603435727637891465, 422965720696825, -5416412493938ll },
+			{ 4603853276946094352, 412132894115713, -5416897388118ll },
+			{ 4604259992942821947, 401299097746099, -5417369535826ll },
+			{ 4604655874671032220, 390464357080933, -5417828935930ll },
+			{ 4605040921199177223, 379628697615415, -5418275587358ll },
+			{ 4605415131621205280, 368792144846915, -5418709489070ll },
+			{ 4605778505056563125, 357954724274865, -5419130640030ll },
+			{ 4606131040650197960, 347116461400782, -5419539039260ll },
+			{ 4606472737572559482, 336277381728124, -5419934685780ll },
+			{ 4606803595019601826, 325437510762303, -5420317578670ll },
+			{ 4607123612212785459, 314596874010589, -5420687717038ll },
+			{ 4607432788399079010, 303755496982041, -5421045099998ll },
+			{ 4607731122850961053, 292913405187472, -5421389726724ll },
+			{ 4608018614866421801, 282070624139356, -5421721596384ll },
+			{ 4608295263768964773, 271227179351826, -5422040708220ll },
+			{ 4608561068907608379, 260383096340532, -5422347061464ll },
+			{ 4608816029656887447, 249538400622652, -5422640655388ll },
+			{ 4609060145416854711, 238693117716827, -5422921489334ll },
+			{ 4609293415613082204, 227847273143038, -5423189562620ll },
+			{ 4609515839696662622, 217000892422600, -5423444874608ll },
+			{ 4609727417144210614, 206154001078098, -5423687424708ll },
+			{ 4609928147457864004, 195306624633329, -5423917212358ll },
+			{ 4610118030165284975, 184458788613209, -5424134237010ll },
+			{ 4610297064819661174, 173610518543723, -5424338498130ll },
+			{ 4610465250999706767, 162761839951934, -5424529995272ll },
+			{ 4610622588309663429, 151912778365806, -5424708727968ll },
+			{ 4610769076379301267, 141063359314238, -5424874695804ll },
+			{ 4610904714863919701, 130213608326959, -5425027898378ll },
+			{ 4611029503444348282, 119363550934477, -5425168335338ll },
+			{ 4611143441826947421, 108513212668040, -5425296006364ll },
+			{ 4611246529743609097, 97662619059522, -5425410911132ll },
+			{ 4611338766951757487, 86811795641433, -5425513049390ll },
+			{ 4611420153234349530, 75960767946792, -5425602420884ll },
+			{ 4611490688399875438, 65109561509144, -5425679025424ll },
+			{ 4611550372282359158, 54258201862395, -5425742862806ll },
+			{ 4611599204741358747, 43406714540862, -5425793932896ll },
+			{ 4611637185661966713, 32555125079131, -5425832235566ll },
+			{ 4611664314954810278, 21703459012059, -5425857770738ll },
+			{ 4611680592556051599, 10851741874633, -5425870538326ll },
+#else
+			{ 0, 7074234977634093 },
+			{ 7074234977634093, 7074218331275848 },
+			{ 14148453308909941, 7074185038598525 },
+			{ 21222638347508466, 7074135099680467 },
+			{ 28296773447188933, 7074068514639185 },
+			{ 35370841961828118, 7073985283631362 },
+			{ 42444827245459480, 7073885406852844 },
+			{ 49518712652312324, 7073768884538656 },
+			{ 56592481536850980, 7073635716962981 },
+			{ 63666117253813961, 7073485904439180 },
+			{ 70739603158253141, 7073319447319773 },
+			{ 77812922605572914, 7073136345996449 },
+			{ 84886058951569363, 7072936600900070 },
+			{ 91958995552469433, 7072720212500646 },
+			{ 99031715764970079, 7072487181307365 },
+			{ 106104202946277444, 7072237507868571 },
+			{ 113176440454146015, 7071971192771773 },
+			{ 120248411646917788, 7071688236643629 },
+			{ 127320099883561417, 7071388640149967 },
+			{ 134391488523711384, 7071072403995769 },
+			{ 141462560927707153, 7070739528925160 },
+			{ 148533300456632313, 7070390015721437 },
+			{ 155603690472353750, 7070023865207035 },
+			{ 162673714337560785, 7069641078243538 },
+			{ 169743355415804323, 7069241655731685 },
+			{ 176812597071536008, 7068825598611354 },
+			{ 183881422670147362, 7068392907861568 },
+			{ 190949815578008930, 7067943584500491 },
+			{ 198017759162509421, 7067477629585422 },
+			{ 205085236792094843, 7066995044212799 },
+			{ 212152231836307642, 7066495829518194 },
+			{ 219218727665825836, 7065979986676305 },
+			{ 226284707652502141, 7065447516900959 },
+			{ 233350155169403100, 7064898421445112 },
+			{ 240415053590848212, 7064332701600839 },
+			{ 247479386292449051, 7063750358699327 },
+			{ 254543136651148378, 7063151394110893 },
+			{ 261606288045259271, 7062535809244954 },
+			{ 268668823854504225, 7061903605550043 },
+			{ 275730727460054268, 7061254784513794 },
+			{ 282791982244568062, 7060589347662946 },
+			{ 289852571592231008, 7059907296563342 },
+			{ 296912478888794350, 7059208632819901 },
+			{ 303971687521614251, 7058493358076660 },
+			{ 311030180879690911, 7057761474016724 },
+			{ 318087942353707635, 7057012982362286 },
+			{ 325144955336069921, 7056247884874617 },
+			{ 332201203220944538, 7055466183354073 },
+			{ 339256669404298611, 7054667879640065 },
+			{ 346311337283938676, 7053852975611086 },
+			{ 353365190259549762, 7053021473184675 },
+			{ 360418211732734437, 7052173374317446 },
+			{ 367470385107051883, 7051308681005055 },
+			{ 374521693788056938, 7050427395282205 },
+			{ 381572121183339143, 7049529519222651 },
+			{ 388621650702561794, 7048615054939182 },
+			{ 395670265757500976, 7047684004583619 },
+			{ 402717949762084595, 7046736370346812 },
+			{ 409764686132431407, 7045772154458638 },
+			{ 416810458286890045, 7044791359187994 },
+			{ 423855249646078039, 7043793986842777 },
+			{ 430899043632920816, 7042780039769906 },
+			{ 437941823672690722, 7041749520355297 },
+			{ 444983573193046019, 7040702431023863 },
+			{ 452024275624069882, 7039638774239498 },
+			{ 459063914398309380, 7038558552505100 },
+			{ 466102472950814480, 7037461768362528 },
+			{ 473139934719177008, 7036348424392623 },
+			{ 480176283143569631, 7035218523215191 },
+			{ 487211501666784822, 7034072067489000 },
+			{ 494245573734273822, 7032909059911771 },
+			{ 501278482794185593, 7031729503220166 },
+			{ 508310212297405759, 7030533400189805 },
+			{ 515340745697595564, 7029320753635233 },
+			{ 522370066451230797, 7028091566409920 },
+			{ 529398158017640717, 7026845841406264 },
+			{ 536425003859046981, 7025583581555579 },
+			{ 543450587440602560, 7024304789828077 },
+			{ 550474892230430637, 7023009469232890 },
+			{ 557497901699663527, 7021697622818023 },
+			{ 564519599322481550, 7020369253670380 },
+			{ 571539968576151930, 7019024364915741 },
+			{ 578558992941067671, 7017662959718763 },
+			{ 585576655900786434, 7016285041282960 },
+			{ 592592940942069394, 7014890612850710 },
+			{ 599607831554920104, 7013479677703233 },
+			{ 606621311232623337, 7012052239160602 },
+			{ 613633363471783939, 7010608300581715 },
+			{ 620643971772365654, 7009147865364298 },
+			{ 627653119637729952, 7007670936944895 },
+			{ 634660790574674847, 7006177518798865 },
+			{ 641666968093473712, 7004667614440363 },
+			{ 648671635707914075, 7003141227422341 },
+			{ 655674776935336416, 7001598361336534 },
+			{ 662676375296672950, 7000039019813452 },
+			{ 669676414316486402, 6998463206522384 },
+			{ 676674877523008786, 6996870925171362 },
+			{ 683671748448180148, 6995262179507185 },
+			{ 690667010627687333, 6993636973315384 },
+			{ 697660647601002717, 6991995310420225 },
+			{ 704652642911422942, 6990337194684699 },
+			{ 711642980106107641, 6988662630010517 },
+			{ 718631642736118158, 6986971620338087 },
+			{ 725618614356456245, 6985264169646522 },
+			{ 732603878526102767, 6983540281953611 },
+			{ 739587418808056378, 6981799961315837 },
+			{ 746569218769372215, 6980043211828337 },
+			{ 753549261981200552, 6978270037624918 },
+			{ 760527532018825470, 6976480442878021 },
+			{ 767504012461703491, 6974674431798742 },
+			{ 774478686893502233, 6972852008636801 },
+			{ 781451538902139034, 6971013177680530 },
+			{ 788422552079819564, 6969157943256877 },
+			{ 795391710023076441, 6967286309731394 },
+			{ 802358996332807835, 6965398281508209 },
+			{ 809324394614316044, 6963493863030034 },
+			{ 816287888477346078, 6961573058778157 },
+			{ 823249461536124235, 6959635873272409 },
+			{ 830209097409396644, 6957682311071178 },
+			{ 837166779720467822, 6955712376771382 },
+			{ 844122492097239204, 6953726075008469 },
+			{ 851076218172247673, 6951723410456397 },
+			{ 858027941582704070, 6949704387827633 },
+			{ 864977645970531703, 6947669011873126 },
+			{ 871925314982404829, 6945617287382317 },
+			{ 878870932269787146, 6943549219183114 },
+			{ 885814481488970260, 6941464812141874 },
+			{ 892755946301112134, 6939364071163413 },
+			{ 899695310372275547, 6937247001190979 },
+			{ 906632557373466526, 6935113607206234 },
+			{ 913567670980672760, 6932963894229270 },
+			{ 920500634874902030, 6930797867318564 },
+			{ 927431432742220594, 6928615531570989 },
+			{ 934360048273791583, 6926416892121789 },
+			{ 941286465165913372, 6924201954144575 },
+			{ 948210667120057947, 6921970722851315 },
+			{ 955132637842909262, 6919723203492308 },
+			{ 962052361046401570, 6917459401356180 },
+			{ 968969820447757750, 6915179321769882 },
+			{ 975884999769527632, 6912882970098664 },
+			{ 982797882739626296, 6910570351746054 },
+			{ 989708453091372350, 6908241472153875 },
+			{ 996616694563526225, 6905896336802202 },
+			{ 1003522590900328427, 6903534951209364 },
+			{ 1010426125851537791, 6901157320931931 },
+			{ 1017327283172469722, 6898763451564696 },
+			{ 1024226046624034418, 6896353348740666 },
+			{ 1031122399972775084, 6893927018131047 },
+			{ 1038016326990906131, 6891484465445222 },
+			{ 1044907811456351353, 6889025696430764 },
+			{ 1051796837152782117, 6886550716873388 },
+			{ 1058683387869655505, 6884059532596958 },
+			{ 1065567447402252463, 6881552149463476 },
+			{ 1072448999551715939, 6879028573373053 },
+			{ 1079328028125088992, 6876488810263910 },
+			{ 1086204516935352902, 6873932866112355 },
+			{ 1093078449801465257, 6871360746932768 },
+			{ 1099949810548398025, 6868772458777598 },
+			{ 1106818583007175623, 6866168007737337 },
+			{ 1113684751014912960, 6863547399940504 },
+			{ 1120548298414853464, 6860910641553648 },
+			{ 1127409209056407112, 6858257738781317 },
+			{ 1134267466795188429, 6855588697866043 },
+			{ 1141123055493054472, 6852903525088337 },
+			{ 1147975959018142809, 6850202226766677 },
+			{ 1154826161244909486, 6847484809257474 },
+			{ 1161673646054166960, 6844751278955068 },
+			{ 1168518397333122028, 6842001642291730 },
+			{ 1175360398975413758, 6839235905737618 },
+			{ 1182199634881151376, 6836454075800774 },
+			{ 1189036088956952150, 6833656159027111 },
+			{ 1195869745115979261, 6830842162000406 },
+			{ 1202700587277979667, 6828012091342259 },
+			{ 1209528599369321926, 6825165953712098 },
+			{ 1216353765323034024, 6822303755807168 },
+			{ 1223176069078841192, 6819425504362487 },
+			{ 1229995494583203679, 6816531206150869 },
+			{ 1236812025789354548, 6813620867982869 },
+			{ 1243625646657337417, 6810694496706796 },
+			{ 1250436341154044213, 6807752099208688 },
+			{ 1257244093253252901, 6804793682412285 },
+			{ 1264048886935665186, 6801819253279031 },
+			{ 1270850706188944217, 6798828818808044 },
+			{ 1277649535007752261, 6795822386036109 },
+			{ 1284445357393788370, 6792799962037646 },
+			{ 1291238157355826016, 6789761553924711 },
+			{ 1298027918909750727, 6786707168846979 },
+			{ 1304814626078597706, 6783636813991708 },
+			{ 1311598262892589414, 6780550496583741 },
+			{ 1318378813389173155, 6777448223885477 },
+			{ 1325156261613058632, 6774330003196869 },
+			{ 1331930591616255501, 6771195841855386 },
+			{ 1338701787458110887, 6768045747236021 },
+			{ 1345469833205346908, 6764879726751243 },
+			{ 1352234712932098151, 6761697787851006 },
+			{ 1358996410719949157, 6758499938022718 },
+			{ 1365754910657971875, 6755286184791232 },
+			{ 1372510196842763107, 6752056535718821 },
+			{ 1379262253378481928, 6748810998405155 },
+			{ 1386011064376887083, 6745549580487302 },
+			{ 1392756613957374385, 6742272289639691 },
+			{ 1399498886247014076, 6738979133574106 },
+			{ 1406237865380588182, 6735670120039658 },
+			{ 1412973535500627840, 6732345256822782 },
+			{ 1419705880757450622, 6729004551747191 },
+			{ 1426434885309197813, 6725648012673900 },
+			{ 1433160533321871713, 6722275647501160 },
+			{ 1439882808969372873, 6718887464164474 },
+			{ 1446601696433537347, 6715483470636569 },
+			{ 1453317179904173916, 6712063674927367 },
+			{ 1460029243579101283, 6708628085083976 },
+			{ 1466737871664185259, 6705176709190675 },
+			{ 1473443048373375934, 6701709555368885 },
+			{ 1480144757928744819, 6698226631777145 },
+			{ 1486842984560521964, 6694727946611124 },
+			{ 1493537712507133088, 6691213508103555 },
+			{ 1500228926015236643, 6687683324524261 },
+			{ 1506916609339760904, 6684137404180093 },
+			{ 1513600746743940997, 6680575755414955 },
+			{ 1520281322499355952, 6676998386609745 },
+			{ 1526958320885965697, 6673405306182360 },
+			{ 1533631726192148057, 6669796522587663 },
+			{ 1540301522714735720, 6666172044317472 },
+			{ 1546967694759053192, 6662531879900535 },
+			{ 1553630226638953727, 6658876037902506 },
+			{ 1560289102676856233, 6655204526925941 },
+			{ 1566944307203782174, 6651517355610257 },
+			{ 1573595824559392431, 6647814532631722 },
+			{ 1580243639092024153, 6644096066703439 },
+			{ 1586887735158727592, 6640361966575318 },
+			{ 1593528097125302910, 6636612241034055 },
+			{ 1600164709366336965, 6632846898903117 },
+			{ 1606797556265240082, 6629065949042718 },
+			{ 1613426622214282800, 6625269400349799 },
+			{ 1620051891614632599, 6621457261758008 },
+			{ 1626673348876390607, 6617629542237667 },
+			{ 1633290978418628274, 6613786250795780 },
+			{ 1639904764669424054, 6609927396475978 },
+			{ 1646514692065900032, 6606052988358514 },
+			{ 1653120745054258546, 6602163035560254 },
+			{ 1659722908089818800, 6598257547234624 },
+			{ 1666321165637053424, 6594336532571621 },
+			{ 1672915502169625045, 6590400000797770 },
+			{ 1679505902170422815, 6586447961176107 },
+			{ 1686092350131598922, 6582480423006169 },
+			{ 1692674830554605091, 6578497395623950 },
+			{ 1699253327950229041, 6574498888401902 },
+			{ 1705827826838630943, 6570484910748898 },
+			{ 1712398311749379841, 6566455472110218 },
+			{ 1718964767221490059, 6562410581967514 },
+			{ 1725527177803457573, 6558350249838808 },
+			{ 1732085528053296381, 6554274485278455 },
+			{ 1738639802538574836, 6550183297877116 },
+			{ 1745189985836451952, 6546076697261758 },
+			{ 1751736062533713710, 6541954693095604 },
+			{ 1758278017226809314, 6537817295078129 },
+			{ 1764815834521887443, 6533664512945029 },
+			{ 1771349499034832472, 6529496356468206 },
+			{ 1777878995391300678, 6525312835455731 },
+			{ 1784404308226756409, 6521113959751834 },
+			{ 1790925422186508243, 6516899739236872 },
+			{ 1797442321925745115, 6512670183827320 },
+			{ 1803954992109572435, 6508425303475724 },
+			{ 1810463417413048159, 6504165108170703 },
+			{ 1816967582521218862, 6499889607936901 },
+			{ 1823467472129155763, 6495598812834988 },
+			{ 1829963070941990751, 6491292732961621 },
+			{ 1836454363674952372, 6486971378449415 },
+			{ 1842941335053401787, 6482634759466942 },
+			{ 1849423969812868729, 6478282886218681 },
+			{ 1855902252699087410, 6473915768945014 },
+			{ 1862376168468032424, 6469533417922182 },
+			{ 1868845701885954606, 6465135843462288 },
+			{ 1875310837729416894, 6460723055913250 },
+			{ 1881771560785330144, 6456295065658776 },
+			{ 1888227855850988920, 6451851883118361 },
+			{ 1894679707734107281, 6447393518747241 },
+			{ 1901127101252854522, 6442919983036376 },
+			{ 1907570021235890898, 6438431286512428 },
+			{ 1914008452522403326, 6433927439737741 },
+			{ 1920442379962141067, 6429408453310290 },
+			{ 1926871788415451357, 6424874337863697 },
+			{ 1933296662753315054, 6420325104067163 },
+			{ 1939716987857382217, 6415760762625483 },
+			{ 1946132748620007700, 6411181324278992 },
+			{ 1952543929944286692, 6406586799803547 },
+			{ 1958950516744090239, 6401977200010511 },
+			{ 1965352493944100750, 6397352535746718 },
+			{ 1971749846479847468, 6392712817894447 },
+			{ 1978142559297741915, 6388058057371405 },
+			{ 1984530617355113320, 6383388265130689 },
+			{ 1990914005620244009, 6378703452160778 },
+			{ 1997292709072404787, 6374003629485486 },
+			{ 2003666712701890273, 6369288808163947 },
+			{ 2010036001510054220, 6364558999290591 },
+			{ 2016400560509344811, 6359814213995126 },
+			{ 2022760374723339937, 6355054463442472 },
+			{ 2029115429186782409, 6350279758832797 },
+			{ 2035465708945615206, 6345490111401438 },
+			{ 2041811199057016644, 6340685532418891 },
+			{ 2048151884589435535, 6335866033190807 },
+			{ 2054487750622626342, 6331031625057922 },
+			{ 2060818782247684264, 6326182319396069 },
+			{ 2067144964567080333, 6321318127616138 },
+			{ 2073466282694696471, 6316439061164034 },
+			{ 2079782721755860505, 6311545131520674 },
+			{ 2086094266887381179, 6306636350201954 },
+			{ 2092400903237583133, 6301712728758698 },
+			{ 2098702615966341831, 6296774278776675 },
+			{ 2104999390245118506, 6291821011876528 },
+			{ 2111291211256995034, 6286852939713772 },
+			{ 2117578064196708806, 6281870073978768 },
+			{ 2123859934270687574, 6276872426396670 },
+			{ 2130136806697084244, 6271860008727434 },
+			{ 2136408666705811678, 6266832832765759 },
+			{ 2142675499538577437, 6261790910341077 },
+			{ 2148937290448918514, 6256734253317515 },
+			{ 2155194024702236029, 6251662873593882 },
+			{ 2161445687575829911, 6246576783103619 },
+			{ 2167692264358933530, 6241475993814789 },
+			{ 2173933740352748319, 6236360517730043 },
+			{ 2180170100870478362, 6231230366886594 },
+			{ 2186401331237364956, 6226085553356174 },
+			{ 2192627416790721130, 6220926089245031 },
+			{ 2198848342879966161, 6215751986693885 },
+			{ 2205064094866660046, 6210563257877896 },
+			{ 2211274658124537942, 6205359915006643 },
+			{ 2217480018039544585, 6200141970324096 },
+			{ 2223680160009868681, 6194909436108586 },
+			{ 2229875069445977267, 6189662324672763 },
+			{ 2236064731770650030, 6184400648363595 },
+			{ 2242249132419013625, 6179124419562313 },
+			{ 2248428256838575938, 6173833650684391 },
+			{ 2254602090489260329, 6168528354179519 },
+			{ 2260770618843439848, 6163208542531576 },
+			{ 2266933827385971424, 6157874228258588 },
+			{ 2273091701614230012, 6152525423912713 },
+			{ 2279244227038142725, 6147162142080207 },
+			{ 2285391389180222932, 6141784395381389 },
+			{ 2291533173575604321, 6136392196470613 },
+			{ 2297669565772074934, 6130985558036248 },
+			{ 2303800551330111182, 6125564492800635 },
+			{ 2309926115822911817, 6120129013520065 },
+			{ 2316046244836431882, 6114679132984746 },
+			{ 2322160923969416628, 6109214864018767 },
+			{ 2328270138833435395, 6103736219480094 },
+			{ 2334373875052915489, 6098243212260493 },
+			{ 2340472118265175982, 6092735855285551 },
+			{ 2346564854120461533, 6087214161514603 },
+			{ 2352652068281976136, 6081678143940731 },
+			{ 2358733746425916867, 6076127815590722 },
+			{ 2364809874241507589, 6070563189525032 },
+			{ 2370880437431032621, 6064984278837762 },
+			{ 2376945421709870383, 6059391096656631 },
+			{ 2383004812806527014, 6053783656142935 },
+			{ 2389058596462669949, 6048161970491523 },
+			{ 2395106758433161472, 6042526052930767 },
+			{ 2401149284486092239, 6036875916722523 },
+			{ 2407186160402814762, 6031211575162105 },
+			{ 2413217371977976867, 6025533041578263 },
+			{ 2419242905019555130, 6019840329333126 },
+			{ 2425262745348888256, 6014133451822206 },
+			{ 2431276878800710462, 6008412422474326 },
+			{ 2437285291223184788, 6002677254751632 },
+			{ 2443287968477936420, 5996927962149514 },
+			{ 2449284896440085934, 5991164558196629 },
+			{ 2455276060998282563, 5985387056454810 },
+			{ 2461261448054737373, 5979595470519082 },
+			{ 2467241043525256455, 5973789814017610 },
+			{ 2473214833339274065, 5967970100611654 },
+			{ 2479182803439885719, 5962136343995572 },
+			{ 2485144939783881291, 5956288557896753 },
+			{ 2491101228341778044, 5950426756075601 },
+			{ 2497051655097853645, 5944550952325506 },
+			{ 2502996206050179151, 5938661160472797 },
+			{ 2508934867210651948, 5932757394376726 },
+			{ 2514867624605028674, 5926839667929422 },
+			{ 2520794464272958096, 5920907995055872 },
+			{ 2526715372268013968, 5914962389713875 },
+			{ 2532630334657727843, 5909002865894007 },
+			{ 2538539337523621850, 5903029437619611 },
+			{ 2544442366961241461, 5897042118946738 },
+			{ 2550339409080188199, 5891040923964127 },
+			{ 2556230450004152326, 5885025866793170 },
+			{ 2562115475870945496, 5878996961587878 },
+			{ 2567994472832533374, 5872954222534848 },
+			{ 2573867427055068222, 5866897663853224 },
+			{ 2579734324718921446, 5860827299794680 },
+			{ 2585595152018716126, 5854743144643365 },
+			{ 2591449895163359491, 5848645212715881 },
+			{ 2597298540376075372, 5842533518361263 },
+			{ 2603141073894436635, 5836408075960905 },
+			{ 2608977481970397540, 5830268899928567 },
+			{ 2614807750870326107, 5824116004710330 },
+			{ 2620631866875036437, 5817949404784545 },
+			{ 2626449816279820982, 5811769114661819 },
+			{ 2632261585394482801, 5805575148884972 },
+			{ 2638067160543367773, 5799367522029002 },
+			{ 2643866528065396775, 5793146248701057 },
+			{ 2649659674314097832, 5786911343540393 },
+			{ 2655446585657638225, 5780662821218344 },
+			{ 2661227248478856569, 5774400696438287 },
+			{ 2667001649175294856, 5768124983935605 },
+			{ 2672769774159230461, 5761835698477657 },
+			{ 2678531609857708118, 5755532854863741 },
+			{ 2684287142712571859, 5749216467925052 },
+			{ 2690036359180496911, 5742886552524666 },
+			{ 2695779245733021577, 5736543123557478 },
+			{ 2701515788856579055, 5730186195950192 },
+			{ 2707245975052529247, 5723815784661273 },
+			{ 2712969790837190520, 5717431904680915 },
+			{ 2718687222741871435, 5711034571031004 },
+			{ 2724398257312902439, 5704623798765081 },
+			{ 2730102881111667520, 5698199602968315 },
+			{ 2735801080714635835, 5691761998757460 },
+			{ 2741492842713393295, 5685311001280820 },
+			{ 2747178153714674115, 5678846625718211 },
+			{ 2752857000340392326, 5672368887280940 },
+			{ 2758529369227673266, 5665877801211749 },
+			{ 2764195247028885015, 5659373382784787 },
+			{ 2769854620411669802, 5652855647305581 },
+			{ 2775507476058975383, 5646324610110996 },
+			{ 2781153800669086379, 5639780286569188 },
+			{ 2786793580955655567, 5633222692079585 },
+			{ 2792426803647735152, 5626651842072840 },
+			{ 2798053455489807992, 5620067752010794 },
+			{ 2803673523241818786, 5613470437386455 },
+			{ 2809286993679205241, 5606859913723936 },
+			{ 2814893853592929177, 5600236196578435 },
+			{ 2820494089789507612, 5593599301536207 },
+			{ 2826087689091043819, 5586949244214502 },
+			{ 2831674638335258321, 5580286040261543 },
+			{ 2837254924375519864, 5573609705356500 },
+			{ 2842828534080876364, 5566920255209432 },
+			{ 2848395454336085796, 5560217705561260 },
+			{ 2853955672041647056, 5553502072183727 },
+			{ 2859509174113830783, 5546773370879375 },
+			{ 2865055947484710158, 5540031617481482 },
+			{ 2870595979102191640, 5533276827854049 },
+			{ 2876129255930045689, 5526509017891746 },
+			{ 2881655764947937435, 5519728203519884 },
+			{ 2887175493151457319, 5512934400694375 },
+			{ 2892688427552151694, 5506127625401692 },
+			{ 2898194555177553386, 5499307893658835 },
+			{ 2903693863071212221, 5492475221513294 },
+			{ 2909186338292725515, 5485629625043003 },
+			{ 2914671967917768518, 5478771120356315 },
+			{ 2920150739038124833, 5471899723591952 },
+			{ 2925622638761716785, 5465015450918971 },
+			{ 2931087654212635756, 5458118318536740 },
+			{ 2936545772531172496, 5451208342674870 },
+			{ 2941996980873847366, 5444285539593203 },
+			{ 2947441266413440569, 5437349925581764 },
+			{ 2952878616339022333, 5430401516960724 },
+			{ 2958309017855983057, 5423440330080359 },
+			{ 2963732458186063416, 5416466381321012 },
+			{ 2969148924567384428, 5409479687093060 },
+			{ 2974558404254477488, 5402480263836871 },
+			{ 2979960884518314359, 5395468128022759 },
+			{ 2985356352646337118, 5388443296150965 },
+			{ 2990744795942488083, 5381405784751587 },
+			{ 2996126201727239670, 5374355610384577 },
+			{ 3001500557337624247, 5367292789639674 },
+			{ 3006867850127263921, 5360217339136375 },
+			{ 3012228067466400296, 5353129275523900 },
+			{ 3017581196741924196, 5346028615481152 },
+			{ 3022927225357405348, 5338915375716663 },
+			{ 3028266140733122011, 5331789572968577 },
+			{ 3033597930306090588, 5324651224004592 },
+			{ 3038922581530095180, 5317500345621938 },
+			{ 3044240081875717118, 5310336954647324 },
+			{ 3049550418830364442, 5303161067936894 },
+			{ 3054853579898301336, 5295972702376206 },
+			{ 3060149552600677542, 5288771874880180 },
+			{ 3065438324475557722, 5281558602393054 },
+			{ 3070719883077950776, 5274332901888364 },
+			{ 3075994215979839140, 5267094790368868 },
+			{ 3081261310770208008, 5259844284866556 },
+			{ 3086521155055074564, 5252581402442556 },
+			{ 3091773736457517120, 5245306160187141 },
+			{ 3097019042617704261, 5238018575219652 },
+			{ 3102257061192923913, 5230718664688483 },
+			{ 3107487779857612396, 5223406445771027 },
+			{ 3112711186303383423, 5216081935673644 },
+			{ 3117927268239057067, 5208745151631614 },
+			{ 3123136013390688681, 5201396110909100 },
+			{ 3128337409501597781, 5194034830799096 },
+			{ 3133531444332396877, 5186661328623414 },
+			{ 3138718105661020291, 5179275621732615 },
+			{ 3143897381282752906, 5171877727505979 },
+			{ 3149069259010258885, 5164467663351465 },
+			{ 3154233726673610350, 5157045446705673 },
+			{ 3159390772120316023, 5149611095033795 },
+			{ 3164540383215349818, 5142164625829576 },
+			{ 3169682547841179394, 5134706056615278 },
+			{ 3174817253897794672, 5127235404941639 },
+			{ 3179944489302736311, 5119752688387818 },
+			{ 3185064241991124129, 5112257924561373 },
+			{ 3190176499915685502, 5104751131098207 },
+			{ 3195281251046783709, 5097232325662533 },
+			{ 3200378483372446242, 5089701525946820 },
+			{ 3205468184898393062, 5082158749671772 },
+			{ 3210550343648064834, 5074604014586268 },
+			{ 3215624947662651102, 5067037338467333 },
+			{ 3220691985001118435, 5059458739120079 },
+			{ 3225751443740238514, 5051868234377692 },
+			{ 3230803311974616206, 5044265842101358 },
+			{ 3235847577816717564, 5036651580180240 },
+			{ 3240884229396897804, 5029025466531433 },
+			{ 3245913254863429237, 5021387519099914 },
+			{ 3250934642382529151, 5013737755858522 },
+			{ 3255948380138387673, 5006076194807880 },
+			{ 3260954456333195553, 4998402853976384 },
+			{ 3265952859187171937, 4990717751420145 },
+			{ 3270943576938592082, 4983020905222956 },
+			{ 3275926597843815038, 4975312333496231 },
+			{ 3280901910177311269, 4967592054378992 },
+			{ 3285869502231690261, 4959860086037800 },
+			{ 3290829362317728061, 4952116446666718 },
+			{ 3295781478764394779, 4944361154487287 },
+			{ 3300725839918882066, 4936594227748450 },
+			{ 3305662434146630516, 4928815684726537 },
+			{ 3310591249831357053, 4921025543725216 },
+			{ 3315512275375082269, 4913223823075437 },
+			{ 3320425499198157706, 4905410541135405 },
+			{ 3325330909739293111, 4897585716290524 },
+			{ 3330228495455583635, 4889749366953364 },
+			{ 3335118244822536999, 4881901511563616 },
+			{ 3340000146334100615, 4874042168588035 },
+			{ 3344874188502688650, 4866171356520420 },
+			{ 3349740359859209070, 4858289093881546 },
+			{ 3354598648953090616, 4850395399219145 },
+			{ 3359449044352309761, 4842490291107838 },
+			{ 3364291534643417599, 4834573788149112 },
+			{ 3369126108431566711, 4826645908971260 },
+			{ 3373952754340537971, 4818706672229349 },
+			{ 3378771461012767320, 4810756096605168 },
+			{ 3383582217109372488, 4802794200807194 },
+			{ 3388385011310179682, 4794821003570529 },
+			{ 3393179832313750211, 4786836523656887 },
+			{ 3397966668837407098, 4778840779854512 },
+			{ 3402745509617261610, 4770833790978162 },
+			{ 3407516343408239772, 4762815575869064 },
+			{ 3412279158984108836, 4754786153394840 },
+			{ 3417033945137503676, 4746745542449505 },
+			{ 3421780690679953181, 4738693761953391 },
+			{ 3426519384441906572, 4730630830853115 },
+			{ 3431250015272759687, 4722556768121535 },
+			{ 3435972572040881222, 4714471592757695 },
+			{ 3440687043633638917, 4706375323786801 },
+			{ 3445393418957425718, 4698267980260153 },
+			{ 3450091686937685871, 4690149581255107 },
+			{ 3454781836518940978, 4682020145875051 },
+			{ 3459463856664816029, 4673879693249323 },
+			{ 3464137736358065352, 4665728242533203 },
+			{ 3468803464600598555, 4657565812907830 },
+			{ 3473461030413506385, 4649392423580201 },
+			{ 3478110422837086586, 4641208093783086 },
+			{ 3482751630930869672, 4633012842775001 },
+			{ 3487384643773644673, 4624806689840163 },
+			{ 3492009450463484836, 4616589654288450 },
+			{ 3496626040117773286, 4608361755455337 },
+			{ 3501234401873228623, 4600123012701858 },
+			{ 3505834524885930481, 4591873445414578 },
+			{ 3510426398331345059, 4583613073005525 },
+			{ 3515010011404350584, 4575341914912149 },
+			{ 3519585353319262733, 4567059990597287 },
+			{ 3524152413309860020, 4558767319549110 },
+			{ 3528711180629409130, 4550463921281068 },
+			{ 3533261644550690198, 4542149815331861 },
+			{ 3537803794366022059, 4533825021265383 },
+			{ 3542337619387287442, 4525489558670684 },
+			{ 3546863108945958126, 4517143447161906 },
+			{ 3551380252393120032, 4508786706378258 },
+			{ 3555889039099498290, 4500419355983959 },
+			{ 3560389458455482249, 4492041415668193 },
+			{ 3564881499871150442, 4483652905145060 },
+			{ 3569365152776295502, 4475253844153536 },
+			{ 3573840406620449038, 4466844252457430 },
+			{ 3578307250872906468, 4458424149845311 },
+			{ 3582765675022751779, 4449993556130506 },
+			{ 3587215668578882285, 4441552491151007 },
+			{ 3591657221070033292, 4433100974769465 },
+			{ 3596090322044802757, 4424639026873102 },
+			{ 3600514961071675859, 4416166667373708 },
+			{ 3604931127739049567, 4407683916207562 },
+			{ 3609338811655257129, 4399190793335397 },
+			{ 3613738002448592526, 4390687318742346 },
+			{ 3618128689767334872, 4382173512437915 },
+			{ 3622510863279772787, 4373649394455906 },
+			{ 3626884512674228693, 4365114984854391 },
+			{ 3631249627659083084, 4356570303715665 },
+			{ 3635606197962798749, 4348015371146192 },
+			{ 3639954213333944941, 4339450207276541 },
+			{ 3644293663541221482, 4330874832261382 },
+			{ 3648624538373482864, 4322289266279399 },
+			{ 3652946827639762263, 4313693529533248 },
+			{ 3657260521169295511, 4305087642249543 },
+			{ 3661565608811545054, 4296471624678757 },
+			{ 3665862080436223811, 4287845497095218 },
+			{ 3670149925933319029, 4279209279797034 },
+			{ 3674429135213116063, 4270562993106058 },
+			{ 3678699698206222121, 4261906657367839 },
+			{ 3682961604863589960, 4253240292951575 },
+			{ 3687214845156541535, 4244563920250049 },
+			{ 3691459409076791584, 4235877559679615 },
+			{ 3695695286636471199, 4227181231680113 },
+			{ 3699922467868151312, 4218474956714839 },
+			{ 3704140942824866151, 4209758755270508 },
+			{ 3708350701580136659, 4201032647857179 },
+			{ 3712551734227993838, 4192296655008222 },
+			{ 3716744030883002060, 4183550797280280 },
+			{ 3720927581680282340, 4174795095253195 },
+			{ 3725102376775535535, 4166029569529978 },
+			{ 3729268406345065513, 4157254240736770 },
+			{ 3733425660585802283, 4148469129522753 },
+			{ 3737574129715325036, 4139674256560148 },
+			{ 3741713803971885184, 4130869642544144 },
+			{ 3745844673614429328, 4122055308192840 },
+			{ 3749966728922622168, 4113231274247224 },
+			{ 3754079960196869392, 4104397561471098 },
+			{ 3758184357758340490, 4095554190651035 },
+			{ 3762279911948991525, 4086701182596356 },
+			{ 3766366613131587881, 4077838558139027 },
+			{ 3770444451689726908, 4068966338133670 },
+			{ 3774513418027860578, 4060084543457472 },
+			{ 3778573502571318050, 4051193195010155 },
+			{ 3782624695766328205, 4042292313713921 },
+			{ 3786666988080042126, 4033381920513400 },
+			{ 3790700370000555526, 4024462036375616 },
+			{ 3794724832036931142, 4015532682289908 },
+			{ 3798740364719221050, 4006593879267914 },
+			{ 3802746958598488964, 3997645648343506 },
+			{ 3806744604246832470, 3988688010572722 },
+			{ 3810733292257405192, 3979720987033761 },
+			{ 3814713013244438953, 3970744598826891 },
+			{ 3818683757843265844, 3961758867074422 },
+			{ 3822645516710340266, 3952763812920648 },
+			{ 3826598280523260914, 3943759457531801 },
+			{ 3830542039980792715, 3934745822095996 },
+			{ 3834476785802888711, 3925722927823192 },
+			{ 3838402508730711903, 3916690795945126 },
+			{ 3842319199526657029, 3907649447715284 },
+			{ 3846226848974372313, 3898598904408829 },
+			{ 3850125447878781142, 3889539187322554 },
+			{ 3854014987066103696, 3880470317774865 },
+			{ 3857895457383878561, 3871392317105673 },
+			{ 3861766849700984234, 3862305206676402 },
+			{ 3865629154907660636, 3853209007869896 },
+			{ 3869482363915530532, 3844103742090382 },
+			{ 3873326467657620914, 3834989430763449 },
+			{ 3877161457088384363, 3825866095335928 },
+			{ 3880987323183720291, 3816733757275927 },
+			{ 3884804056940996218, 3807592438072714 },
+			{ 3888611649379068932, 3798442159236694 },
+			{ 3892410091538305626, 3789282942299358 },
+			{ 3896199374480604984, 3780114808813227 },
+			{ 3899979489289418211, 3770937780351808 },
+			{ 3903750427069770019, 3761751878509533 },
+			{ 3907512178948279552, 3752557124901719 },
+			{ 3911264736073181271, 3743353541164503 },
+			{ 3915008089614345774, 3734141148954817 },
+			{ 3918742230763300591, 3724919969950300 },
+			{ 3922467150733250891, 3715690025849281 },
+			{ 3926182840759100172, 3706451338370708 },
+			{ 3929889292097470880, 3697203929254108 },
+			{ 3933586496026724988, 3687947820259530 },
+			{ 3937274443846984518, 3678683033167486 },
+			{ 3940953126880152004, 3669409589778919 },
+			{ 3944622536469930923, 3660127511915136 },
+			{ 3948282663981846059, 3650836821417762 },
+			{ 3951933500803263821, 3641537540148694 },
+			{ 3955575038343412515, 3632229689990031 },
+			{ 3959207268033402546, 3622913292844050 },
+			{ 3962830181326246596, 3613588370633132 },
+			{ 3966443769696879728, 3604254945299717 },
+			{ 3970048024642179445, 3594913038806262 },
+			{ 3973642937680985707, 3585562673135168 },
+			{ 3977228500354120875, 3576203870288753 },
+			{ 3980804704224409628, 3566836652289186 },
+			{ 3984371540876698814, 3557461041178435 },
+			{ 3987929001917877249, 3548077059018210 },
+			{ 3991477078976895459, 3538684727889937 },
+			{ 3995015763704785396, 3529284069894683 },
+			{ 3998545047774680079, 3519875107153088 },
+			{ 4002064922881833167, 3510457861805363 },
+			{ 4005575380743638530, 3501032356011193 },
+			{ 4009076413099649723, 3491598611949701 },
+			{ 4012568011711599424, 3482156651819401 },
+			{ 4016050168363418825, 3472706497838136 },
+			{ 4019522874861256961, 3463248172243032 },
+			{ 4022986123033499993, 3453781697290444 },
+			{ 4026439904730790437, 3444307095255896 },
+			{ 4029884211826046333, 3434824388434046 },
+			{ 4033319036214480379, 3425333599138627 },
+			{ 4036744369813619006, 3415834749702367 },
+			{ 4040160204563321373, 3406327862476984 },
+			{ 4043566532425798357, 3396812959833105 },
+			{ 4046963345385631462, 3387290064160215 },
+			{ 4050350635449791677, 3377759197866601 },
+			{ 4053728394647658278, 3368220383379317 },
+			{ 4057096615031037595, 3358673643144113 },
+			{ 4060455288674181708, 3349118999625391 },
+			{ 4063804407673807099, 3339556475306153 },
+			{ 4067143964149113252, 3329986092687939 },
+			{ 4070473950241801191, 3320407874290784 },
+			{ 4073794358116091975, 3310821842653166 },
+			{ 4077105179958745141, 3301228020331935 },
+			{ 4080406407979077076, 3291626429902289 },
+			{ 4083698034408979365, 3282017093957691 },
+			{ 4086980051502937056, 3272400035109845 },
+			{ 4090252451538046901, 3262775275988614 },
+			{ 4093515226814035515, 3253142839241985 },
+			{ 4096768369653277500, 3243502747536016 },
+			{ 4100011872400813516, 3233855023554771 },
+			{ 4103245727424368287, 3224199690000278 },
+			{ 4106469927114368565, 3214536769592471 },
+			{ 4109684463883961036, 3204866285069130 },
+			{ 4112889330169030166, 3195188259185842 },
+			{ 4116084518428216008, 3185502714715941 },
+			{ 4119270021142931949, 3175809674450442 },
+			{ 4122445830817382391, 3166109161198008 },
+			{ 4125611939978580399, 3156401197784884 },
+			{ 4128768341176365283, 3146685807054847 },
+			{ 4131915026983420130, 3136963011869145 },
+			{ 4135051989995289275, 3127232835106459 },
+			{ 4138179222830395734, 3117495299662836 },
+			{ 4141296718130058570, 3107750428451630 },
+			{ 4144404468558510200, 3097998244403472 },
+			{ 4147502466802913672, 3088238770466190 },
+			{ 4150590705573379862, 3078472029604767 },
+			{ 4153669177602984629, 3068698044801293 },
+			{ 4156737875647785922, 3058916839054892 },
+			{ 4159796792486840814, 3049128435381688 },
+			{ 4162845920922222502, 3039332856814746 },
+			{ 4165885253779037248, 3029530126404002 },
+			{ 4168914783905441250, 3019720267216226 },
+			{ 4171934504172657476, 3009903302334974 },
+			{ 4174944407474992450, 3000079254860503 },
+			{ 4177944486729852953, 2990248147909749 },
+			{ 4180934734877762702, 2980410004616256 },
+			{ 4183915144882378958, 2970564848130126 },
+			{ 4186885709730509084, 2960712701617964 },
+			{ 4189846422432127048, 2950853588262824 },
+			{ 4192797276020389872, 2940987531264144 },
+			{ 4195738263551654016, 2931114553837719 },
+			{ 4198669378105491735, 2921234679215612 },
+			{ 4201590612784707347, 2911347930646130 },
+			{ 4204501960715353477, 2901454331393734 },
+			{ 4207403415046747211, 2891553904739032 },
+			{ 4210294968951486243, 2881646673978678 },
+			{ 4213176615625464921, 2871732662425343 },
+			{ 4216048348287890264, 2861811893407656 },
+			{ 4218910160181297920, 2851884390270144 },
+			{ 4221762044571568064, 2841950176373178 },
+			{ 4224603994747941242, 2832009275092934 },
+			{ 4227436004023034176, 2822061709821295 },
+			{ 4230258065732855471, 2812107503965852 },
+			{ 4233070173236821323, 2802146680949820 },
+			{ 4235872319917771143, 2792179264211967 },
+			{ 4238664499181983110, 2782205277206592 },
+			{ 4241446704459189702, 2772224743403450 },
+			{ 4244218929202593152, 2762237686287699 },
+			{ 4246981166888880851, 2752244129359852 },
+			{ 4249733411018240703, 2742244096135712 },
+			{ 4252475655114376415, 2732237610146325 },
+			{ 4255207892724522740, 2722224694937914 },
+			{ 4257930117419460654, 2712205374071843 },
+			{ 4260642322793532497, 2702179671124536 },
+			{ 4263344502464657033, 2692147609687442 },
+			{ 4266036650074344475, 2682109213366975 },
+			{ 4268718759287711450, 2672064505784442 },
+			{ 4271390823793495892, 2662013510576019 },
+			{ 4274052837304071911, 2651956251392665 },
+			{ 4276704793555464576, 2641892751900083 },
+			{ 4279346686307364659, 2631823035778657 },
+			{ 4281978509343143316, 2621747126723406 },
+			{ 4284600256469866722, 2611665048443914 },
+			{ 4287211921518310636, 2601576824664286 },
+			{ 4289813498342974922, 2591482479123088 },
+			{ 4292404980822098010, 2581382035573290 },
+			{ 4294986362857671300, 2571275517782208 },
+			{ 4297557638375453508, 2561162949531459 },
+			{ 4300118801324984967, 2551044354616892 },
+			{ 4302669845679601859, 2540919756848535 },
+			{ 4305210765436450394, 2530789180050547 },
+			{ 4307741554616500941, 2520652648061158 },
+			{ 4310262207264562099, 2510510184732596 },
+			{ 4312772717449294695, 2500361813931072 },
+			{ 4315273079263225767, 2490207559536669 },
+			{ 4317763286822762436, 2480047445443334 },
+			{ 4320243334268205770, 2469881495558797 },
+			{ 4322713215763764567, 2459709733804521 },
+			{ 4325172925497569088, 2449532184115641 },
+			{ 4327622457681684729, 2439348870440920 },
+			{ 4330061806552125649, 2429159816742671 },
+			{ 4332490966368868320, 2418965046996727 },
+			{ 4334909931415865047, 2408764585192365 },
+			{ 4337318696001057412, 2398558455332258 },
+			{ 4339717254456389670, 2388346681432408 },
+			{ 4342105601137822078, 2378129287522121 },
+			{ 4344483730425344199, 2367906297643895 },
+			{ 4346851636722988094, 2357677735853421 },
+			{ 4349209314458841515, 2347443626219493 },
+			{ 4351556758085061008, 2337203992823962 },
+			{ 4353893962077884970, 2326958859761662 },
+			{ 4356220920937646632, 2316708251140396 },
+			{ 4358537629188787028, 2306452191080833 },
+			{ 4360844081379867861, 2296190703716462 },
+			{ 4363140272083584323, 2285923813193566 },
+			{ 4365426195896777889, 2275651543671127 },
+			{ 4367701847440449016, 2265373919320783 },
+			{ 4369967221359769799, 2255090964326786 },
+			{ 4372222312324096585, 2244802702885909 },
+			{ 4374467115026982494, 2234509159207439 },
+			{ 4376701624186189933, 2224210357513074 },
+			{ 4378925834543703007, 2213906322036878 },
+			{ 4381139740865739885, 2203597077025261 },
+			{ 4383343337942765146, 2193282646736858 },
+			{ 4385536620589502004, 2182963055442526 },
+			{ 4387719583644944530, 2172638327425256 },
+			{ 4389892221972369786, 2162308486980135 },
+			{ 4392054530459349921, 2151973558414278 },
+			{ 4394206504017764199, 2141633566046756 },
+			{ 4396348137583810955, 2131288534208588 },
+			{ 4398479426118019543, 2120938487242620 },
+			{ 4400600364605262163, 2110583449503519 },
+			{ 4402710948054765682, 2100223445357685 },
+			{ 4404811171500123367, 2089858499183213 },
+			{ 4406901029999306580, 2079488635369816 },
+			{ 4408980518634676396, 2069113878318796 },
+			{ 4411049632512995192, 2058734252442948 },
+			{ 4413108366765438140, 2048349782166536 },
+			{ 4415156716547604676, 2037960491925226 },
+			{ 4417194677039529902, 2027566406166020 },
+			{ 4419222243445695922, 2017167549347203 },
+			{ 4421239410995043125, 2006763945938297 },
+			{ 4423246174940981422, 1996355620419973 },
+			{ 4425242530561401395, 1985942597284039 },
+			{ 4427228473158685434, 1975524901033336 },
+			{ 4429203998059718770, 1965102556181714 },
+			{ 4431169100615900484, 1954675587253958 },
+			{ 4433123776203154442, 1944244018785727 },
+			{ 4435068020221940169, 1933807875323517 },
+			{ 4437001828097263686, 1923367181424576 },
+			{ 4438925195278688262, 1912921961656866 },
+			{ 4440838117240345128, 1902472240599004 },
+			{ 4442740589480944132, 1892018042840182 },
+			{ 4444632607523784314, 1881559392980147 },
+			{ 4446514166916764461, 1871096315629109 },
+			{ 4448385263232393570, 1860628835407701 },
+			{ 4450245892067801271, 1850156976946908 },
+			{ 4452096049044748179, 1839680764888035 },
+			{ 4453935729809636214, 1829200223882615 },
+			{ 4455764930033518829, 1818715378592374 },
+			{ 4457583645412111203, 1808226253689165 },
+			{ 4459391871665800368, 1797732873854919 },
+			{ 4461189604539655287, 1787235263781558 },
+			{ 4462976839803436845, 1776733448170989 },
+			{ 4464753573251607834, 1766227451734986 },
+			{ 4466519800703342820, 1755717299195180 },
+			{ 4468275518002538000, 1745203015282973 },
+			{ 4470020721017820973, 1734684624739492 },
+			{ 4471755405642560465, 1724162152315524 },
+			{ 4473479567794875989, 1713635622771464 },
+			{ 4475193203417647453, 1703105060877254 },
+			{ 4476896308478524707, 1692570491412321 },
+			{ 4478588878969937028, 1682031939165527 },
+			{ 4480270910909102555, 1671489428935101 },
+			{ 4481942400338037656, 1660942985528593 },
+			{ 4483603343323566249, 1650392633762795 },
+			{ 4485253735957329044, 1639838398463707 },
+			{ 4486893574355792751, 1629280304466469 },
+			{ 4488522854660259220, 1618718376615292 },
+			{ 4490141573036874512, 1608152639763414 },
+			{ 4491749725676637926, 1597583118773029 },
+			{ 4493347308795410955, 1587009838515246 },
+			{ 4494934318633926201, 1576432823870019 },
+			{ 4496510751457796220, 1565852099726072 },
+			{ 4498076603557522292, 1555267690980886 },
+			{ 4499631871248503178, 1544679622540588 },
+			{ 4501176550871043766, 1534087919319925 },
+			{ 4502710638790363691, 1523492606242204 },
+			{ 4504234131396605895, 1512893708239217 },
+			{ 4505747025104845112, 1502291250251194 },
+			{ 4507249316355096306, 1491685257226743 },
+			{ 4508741001612323049, 1481075754122791 },
+			{ 4510222077366445840, 1470462765904525 },
+			{ 4511692540132350365, 1459846317545327 },
+			{ 4513152386449895692, 1449226434026730 },
+			{ 4514601612883922422, 1438603140338341 },
+			{ 4516040216024260763, 1427976461477805 },
+			{ 4517468192485738568, 1417346422450712 },
+			{ 4518885538908189280, 1406713048270583 },
+			{ 4520292251956459863, 1396076363958762 },
+			{ 4521688328320418625, 1385436394544404 },
+			{ 4523073764714963029, 1374793165064384 },
+			{ 4524448557880027413, 1364146700563242 },
+			{ 4525812704580590655, 1353497026093145 },
+			{ 4527166201606683800, 1342844166713800 },
+			{ 4528509045773397600, 1332188147492424 },
+			{ 4529841233920890024, 1321528993503646 },
+			{ 4531162762914393670, 1310866729829493 },
+			{ 4532473629644223163, 1300201381559303 },
+			{ 4533773831025782466, 1289532973789666 },
+			{ 4535063363999572132, 1278861531624376 },
+			{ 4536342225531196508, 1268187080174371 },
+			{ 4537610412611370879, 1257509644557663 },
+			{ 4538867922255928542, 1246829249899290 },
+			{ 4540114751505827832, 1236145921331257 },
+			{ 4541350897427159089, 1225459683992460 },
+			{ 4542576357111151549, 1214770563028654 },
+			{ 4543791127674180203, 1204078583592370 },
+			{ 4544995206257772573, 1193383770842872 },
+			{ 4546188590028615445, 1182686149946078 },
+			{ 4547371276178561523, 1171985746074539 },
+			{ 4548543261924636062, 1161282584407324 },
+			{ 4549704544509043386, 1150576690130015 },
+			{ 4550855121199173401, 1139868088434612 },
+			{ 4551994989287608013, 1129156804519490 },
+			{ 4553124146092127503, 1118442863589336 },
+			{ 4554242588955716839, 1107726290855085 },
+			{ 4555350315246571924, 1097007111533868 },
+			{ 4556447322358105792, 1086285350848957 },
+			{ 4557533607708954749, 1075561034029679 },
+			{ 4558609168742984428, 1064834186311396 },
+			{ 4559674002929295824, 1054104832935407 },
+			{ 4560728107762231231, 1043372999148932 },
+			{ 4561771480761380163, 1032638710205000 },
+			{ 4562804119471585163, 1021901991362435 },
+			{ 4563826021462947598, 1011162867885772 },
+			{ 4564837184330833370, 1000421365045209 },
+			{ 4565837605695878579, 989677508116531 },
+			{ 4566827283203995110, 978931322381083 },
+			{ 4567806214526376193, 968182833125671 },
+			{ 4568774397359501864, 957432065642527 },
+			{ 4569731829425144391, 946679045229252 },
+			{ 4570678508470373643, 935923797188738 },
+			{ 4571614432267562381, 925166346829121 },
+			{ 4572539598614391502, 914406719463719 },
+			{ 4573454005333855221, 903644940410985 },
+			{ 4574357650274266206, 892881034994412 },
+			{ 4575250531309260618, 882115028542519 },
+			{ 4576132646337803137, 871346946388750 },
+			{ 4577003993284191887, 860576813871452 },
+			{ 4577864570098063339, 849804656333781 },
+			{ 4578714374754397120, 839030499123663 },
+			{ 4579553405253520783, 828254367593739 },
+			{ 4580381659621114522, 817476287101277 },
+			{ 4581199135908215799, 806696283008147 },
+			{ 4582005832191223946, 795914380680741 },
+			{ 4582801746571904687, 785130605489913 },
+			{ 4583586877177394600, 774344982810932 },
+			{ 4584361222160205532, 763557538023407 },
+			{ 4585124779698228939, 752768296511240 },
+			{ 4585877547994740179, 741977283662551 },
+			{ 4586619525278402730, 731184524869647 },
+			{ 4587350709803272377, 720390045528922 },
+			{ 4588071099848801299, 709593871040838 },
+			{ 4588780693719842137, 698796026809828 },
+			{ 4589479489746651965, 687996538244264 },
+			{ 4590167486284896229, 677195430756395 },
+			{ 4590844681715652624, 666392729762255 },
+			{ 4591511074445414879, 655588460681653 },
+			{ 4592166662906096532, 644782648938080 },
+			{ 4592811445555034612, 633975319958648 },
+			{ 4593445420874993260, 623166499174044 },
+			{ 4594068587374167304, 612356212018477 },
+			{ 4594680943586185781, 601544483929590 },
+			{ 4595282488070115371, 590731340348428 },
+			{ 4595873219410463799, 579916806719355 },
+			{ 4596453136217183154, 569100908490023 },
+			{ 4597022237125673177, 558283671111277 },
+			{ 4597580520796784454, 547465120037127 },
+			{ 4598127985916821581, 536645280724664 },
+			{ 4598664631197546245, 525824178634022 },
+			{ 4599190455376180267, 515001839228290 },
+			{ 4599705457215408557, 504178287973484 },
+			{ 4600209635503382041, 493353550338468 },
+			{ 4600702989053720509, 482527651794890 },
+			{ 4601185516705515399, 471700617817136 },
+			{ 4601657217323332535, 460872473882264 },
+			{ 4602118089797214799, 450043245469943 },
+			{ 4602568133042684742, 439212958062396 },
+			{ 4603007346000747138, 428381637144327 },
+			{ 4603435727637891465, 417549308202887 },
+			{ 4603853276946094352, 406715996727595 },
+			{ 4604259992942821947, 395881728210273 },
+			{ 4604655874671032220, 385046528145003 },
+			{ 4605040921199177223, 374210422028057 },
+			{ 4605415131621205280, 363373435357845 },
+			{ 4605778505056563125, 352535593634835 },
+			{ 4606131040650197960, 341696922361522 },
+			{ 4606472737572559482, 330857447042344 },
+			{ 4606803595019601826, 320017193183633 },
+			{ 4607123612212785459, 309176186293551 },
+			{ 4607432788399079010, 298334451882043 },
+			{ 4607731122850961053, 287492015460748 },
+			{ 4608018614866421801, 276648902542972 },
+			{ 4608295263768964773, 265805138643606 },
+			{ 4608561068907608379, 254960749279068 },
+			{ 4608816029656887447, 244115759967264 },
+			{ 4609060145416854711, 233270196227493 },
+			{ 4609293415613082204, 222424083580418 },
+			{ 4609515839696662622, 211577447547992 },
+			{ 4609727417144210614, 200730313653390 },
+			{ 4609928147457864004, 189882707420971 },
+			{ 4610118030165284975, 179034654376199 },
+			{ 4610297064819661174, 168186180045593 },
+			{ 4610465250999706767, 157337309956662 },
+			{ 4610622588309663429, 146488069637838 },
+			{ 4610769076379301267, 135638484618434 },
+			{ 4610904714863919701, 124788580428581 },
+			{ 4611029503444348282, 113938382599139 },
+			{ 4611143441826947421, 103087916661676 },
+			{ 4611246529743609097, 92237208148390 },
+			{ 4611338766951757487, 81386282592043 },
+			{ 4611420153234349530, 70535165525908 },
+			{ 4611490688399875438, 59683882483720 },
+			{ 4611550372282359158, 48832458999589 },
+			{ 4611599204741358747, 37980920607966 },
+			{ 4611637185661966713, 27129292843565 },
+			{ 4611664314954810278, 16277601241321 },
+			{ 4611680592556051599, 5425871336307 },
+#endif
 		};
+	};
 
-		constexpr static int64_t FRAC_SCALE = (int64_t(1) << (62 - F));
-		constexpr static std::array<int64_t, 10001> lut_dst = 
-        {
-			lut_src[0] / FRAC_SCALE ,
-			lut_src[1] / FRAC_SCALE ,
-			lut_src[2] / FRAC_SCALE ,
-			lut_src[3] / FRAC_SCALE ,
-			lut_src[4] / FRAC_SCALE ,
-			lut_src[5] / FRAC_SCALE ,
-			lut_src[6] / FRAC_SCALE ,
-			lut_src[7] / FRAC_SCALE ,
-			lut_src[8] / FRAC_SCALE ,
-			lut_src[9] / FRAC_SCALE ,
-			lut_src[10] / FRAC_SCALE ,
-			lut_src[11] / FRAC_SCALE ,
-			lut_src[12] / FRAC_SCALE ,
-			lut_src[13] / FRAC_SCALE ,
-			lut_src[14] / FRAC_SCALE ,
-			lut_src[15] / FRAC_SCALE ,
-			lut_src[16] / FRAC_SCALE ,
-			lut_src[17] / FRAC_SCALE ,
-			lut_src[18] / FRAC_SCALE ,
-			lut_src[19] / FRAC_SCALE ,
-			lut_src[20] / FRAC_SCALE ,
-			lut_src[21] / FRAC_SCALE ,
-			lut_src[22] / FRAC_SCALE ,
-			lut_src[23] / FRAC_SCALE ,
-			lut_src[24] / FRAC_SCALE ,
-			lut_src[25] / FRAC_SCALE ,
-			lut_src[26] / FRAC_SCALE ,
-			lut_src[27] / FRAC_SCALE ,
-			lut_src[28] / FRAC_SCALE ,
-			lut_src[29] / FRAC_SCALE ,
-			lut_src[30] / FRAC_SCALE ,
-			lut_src[31] / FRAC_SCALE ,
-			lut_src[32] / FRAC_SCALE ,
-			lut_src[33] / FRAC_SCALE ,
-			lut_src[34] / FRAC_SCALE ,
-			lut_src[35] / FRAC_SCALE ,
-			lut_src[36] / FRAC_SCALE ,
-			lut_src[37] / FRAC_SCALE ,
-			lut_src[38] / FRAC_SCALE ,
-			lut_src[39] / FRAC_SCALE ,
-			lut_src[40] / FRAC_SCALE ,
-			lut_src[41] / FRAC_SCALE ,
-			lut_src[42] / FRAC_SCALE ,
-			lut_src[43] / FRAC_SCALE ,
-			lut_src[44] / FRAC_SCALE ,
-			lut_src[45] / FRAC_SCALE ,
-			lut_src[46] / FRAC_SCALE ,
-			lut_src[47] / FRAC_SCALE ,
-			lut_src[48] / FRAC_SCALE ,
-			lut_src[49] / FRAC_SCALE ,
-			lut_src[50] / FRAC_SCALE ,
-			lut_src[51] / FRAC_SCALE ,
-			lut_src[52] / FRAC_SCALE ,
-			lut_src[53] / FRAC_SCALE ,
-			lut_src[54] / FRAC_SCALE ,
-			lut_src[55] / FRAC_SCALE ,
-			lut_src[56] / FRAC_SCALE ,
-			lut_src[57] / FRAC_SCALE ,
-			lut_src[58] / FRAC_SCALE ,
-			lut_src[59] / FRAC_SCALE ,
-			lut_src[60] / FRAC_SCALE ,
-			lut_src[61] / FRAC_SCALE ,
-			lut_src[62] / FRAC_SCALE ,
-			lut_src[63] / FRAC_SCALE ,
-			lut_src[64] / FRAC_SCALE ,
-			lut_src[65] / FRAC_SCALE ,
-			lut_src[66] / FRAC_SCALE ,
-			lut_src[67] / FRAC_SCALE ,
-			lut_src[68] / FRAC_SCALE ,
-			lut_src[69] / FRAC_SCALE ,
-			lut_src[70] / FRAC_SCALE ,
-			lut_src[71] / FRAC_SCALE ,
-			lut_src[72] / FRAC_SCALE ,
-			lut_src[73] / FRAC_SCALE ,
-			lut_src[74] / FRAC_SCALE ,
-			lut_src[75] / FRAC_SCALE ,
-			lut_src[76] / FRAC_SCALE ,
-			lut_src[77] / FRAC_SCALE ,
-			lut_src[78] / FRAC_SCALE ,
-			lut_src[79] / FRAC_SCALE ,
-			lut_src[80] / FRAC_SCALE ,
-			lut_src[81] / FRAC_SCALE ,
-			lut_src[82] / FRAC_SCALE ,
-			lut_src[83] / FRAC_SCALE ,
-			lut_src[84] / FRAC_SCALE ,
-			lut_src[85] / FRAC_SCALE ,
-			lut_src[86] / FRAC_SCALE ,
-			lut_src[87] / FRAC_SCALE ,
-			lut_src[88] / FRAC_SCALE ,
-			lut_src[89] / FRAC_SCALE ,
-			lut_src[90] / FRAC_SCALE ,
-			lut_src[91] / FRAC_SCALE ,
-			lut_src[92] / FRAC_SCALE ,
-			lut_src[93] / FRAC_SCALE ,
-			lut_src[94] / FRAC_SCALE ,
-			lut_src[95] / FRAC_SCALE ,
-			lut_src[96] / FRAC_SCALE ,
-			lut_src[97] / FRAC_SCALE ,
-			lut_src[98] / FRAC_SCALE ,
-			lut_src[99] / FRAC_SCALE ,
-			lut_src[100] / FRAC_SCALE ,
-			lut_src[101] / FRAC_SCALE ,
-			lut_src[102] / FRAC_SCALE ,
-			lut_src[103] / FRAC_SCALE ,
-			lut_src[104] / FRAC_SCALE ,
-			lut_src[105] / FRAC_SCALE ,
-			lut_src[106] / FRAC_SCALE ,
-			lut_src[107] / FRAC_SCALE ,
-			lut_src[108] / FRAC_SCALE ,
-			lut_src[109] / FRAC_SCALE ,
-			lut_src[110] / FRAC_SCALE ,
-			lut_src[111] / FRAC_SCALE ,
-			lut_src[112] / FRAC_SCALE ,
-			lut_src[113] / FRAC_SCALE ,
-			lut_src[114] / FRAC_SCALE ,
-			lut_src[115] / FRAC_SCALE ,
-			lut_src[116] / FRAC_SCALE ,
-			lut_src[117] / FRAC_SCALE ,
-			lut_src[118] / FRAC_SCALE ,
-			lut_src[119] / FRAC_SCALE ,
-			lut_src[120] / FRAC_SCALE ,
-			lut_src[121] / FRAC_SCALE ,
-			lut_src[122] / FRAC_SCALE ,
-			lut_src[123] / FRAC_SCALE ,
-			lut_src[124] / FRAC_SCALE ,
-			lut_src[125] / FRAC_SCALE ,
-			lut_src[126] / FRAC_SCALE ,
-			lut_src[127] / FRAC_SCALE ,
-			lut_src[128] / FRAC_SCALE ,
-			lut_src[129] / FRAC_SCALE ,
-			lut_src[130] / FRAC_SCALE ,
-			lut_src[131] / FRAC_SCALE ,
-			lut_src[132] / FRAC_SCALE ,
-			lut_src[133] / FRAC_SCALE ,
-			lut_src[134] / FRAC_SCALE ,
-			lut_src[135] / FRAC_SCALE ,
-			lut_src[136] / FRAC_SCALE ,
-			lut_src[137] / FRAC_SCALE ,
-			lut_src[138] / FRAC_SCALE ,
-			lut_src[139] / FRAC_SCALE ,
-			lut_src[140] / FRAC_SCALE ,
-			lut_src[141] / FRAC_SCALE ,
-			lut_src[142] / FRAC_SCALE ,
-			lut_src[143] / FRAC_SCALE ,
-			lut_src[144] / FRAC_SCALE ,
-			lut_src[145] / FRAC_SCALE ,
-			lut_src[146] / FRAC_SCALE ,
-			lut_src[147] / FRAC_SCALE ,
-			lut_src[148] / FRAC_SCALE ,
-			lut_src[149] / FRAC_SCALE ,
-			lut_src[150] / FRAC_SCALE ,
-			lut_src[151] / FRAC_SCALE ,
-			lut_src[152] / FRAC_SCALE ,
-			lut_src[153] / FRAC_SCALE ,
-			lut_src[154] / FRAC_SCALE ,
-			lut_src[155] / FRAC_SCALE ,
-			lut_src[156] / FRAC_SCALE ,
-			lut_src[157] / FRAC_SCALE ,
-			lut_src[158] / FRAC_SCALE ,
-			lut_src[159] / FRAC_SCALE ,
-			lut_src[160] / FRAC_SCALE ,
-			lut_src[161] / FRAC_SCALE ,
-			lut_src[162] / FRAC_SCALE ,
-			lut_src[163] / FRAC_SCALE ,
-			lut_src[164] / FRAC_SCALE ,
-			lut_src[165] / FRAC_SCALE ,
-			lut_src[166] / FRAC_SCALE ,
-			lut_src[167] / FRAC_SCALE ,
-			lut_src[168] / FRAC_SCALE ,
-			lut_src[169] / FRAC_SCALE ,
-			lut_src[170] / FRAC_SCALE ,
-			lut_src[171] / FRAC_SCALE ,
-			lut_src[172] / FRAC_SCALE ,
-			lut_src[173] / FRAC_SCALE ,
-			lut_src[174] / FRAC_SCALE ,
-			lut_src[175] / FRAC_SCALE ,
-			lut_src[176] / FRAC_SCALE ,
-			lut_src[177] / FRAC_SCALE ,
-			lut_src[178] / FRAC_SCALE ,
-			lut_src[179] / FRAC_SCALE ,
-			lut_src[180] / FRAC_SCALE ,
-			lut_src[181] / FRAC_SCALE ,
-			lut_src[182] / FRAC_SCALE ,
-			lut_src[183] / FRAC_SCALE ,
-			lut_src[184] / FRAC_SCALE ,
-			lut_src[185] / FRAC_SCALE ,
-			lut_src[186] / FRAC_SCALE ,
-			lut_src[187] / FRAC_SCALE ,
-			lut_src[188] / FRAC_SCALE ,
-			lut_src[189] / FRAC_SCALE ,
-			lut_src[190] / FRAC_SCALE ,
-			lut_src[191] / FRAC_SCALE ,
-			lut_src[192] / FRAC_SCALE ,
-			lut_src[193] / FRAC_SCALE ,
-			lut_src[194] / FRAC_SCALE ,
-			lut_src[195] / FRAC_SCALE ,
-			lut_src[196] / FRAC_SCALE ,
-			lut_src[197] / FRAC_SCALE ,
-			lut_src[198] / FRAC_SCALE ,
-			lut_src[199] / FRAC_SCALE ,
-			lut_src[200] / FRAC_SCALE ,
-			lut_src[201] / FRAC_SCALE ,
-			lut_src[202] / FRAC_SCALE ,
-			lut_src[203] / FRAC_SCALE ,
-			lut_src[204] / FRAC_SCALE ,
-			lut_src[205] / FRAC_SCALE ,
-			lut_src[206] / FRAC_SCALE ,
-			lut_src[207] / FRAC_SCALE ,
-			lut_src[208] / FRAC_SCALE ,
-			lut_src[209] / FRAC_SCALE ,
-			lut_src[210] / FRAC_SCALE ,
-			lut_src[211] / FRAC_SCALE ,
-			lut_src[212] / FRAC_SCALE ,
-			lut_src[213] / FRAC_SCALE ,
-			lut_src[214] / FRAC_SCALE ,
-			lut_src[215] / FRAC_SCALE ,
-			lut_src[216] / FRAC_SCALE ,
-			lut_src[217] / FRAC_SCALE ,
-			lut_src[218] / FRAC_SCALE ,
-			lut_src[219] / FRAC_SCALE ,
-			lut_src[220] / FRAC_SCALE ,
-			lut_src[221] / FRAC_SCALE ,
-			lut_src[222] / FRAC_SCALE ,
-			lut_src[223] / FRAC_SCALE ,
-			lut_src[224] / FRAC_SCALE ,
-			lut_src[225] / FRAC_SCALE ,
-			lut_src[226] / FRAC_SCALE ,
-			lut_src[227] / FRAC_SCALE ,
-			lut_src[228] / FRAC_SCALE ,
-			lut_src[229] / FRAC_SCALE ,
-			lut_src[230] / FRAC_SCALE ,
-			lut_src[231] / FRAC_SCALE ,
-			lut_src[232] / FRAC_SCALE ,
-			lut_src[233] / FRAC_SCALE ,
-			lut_src[234] / FRAC_SCALE ,
-			lut_src[235] / FRAC_SCALE ,
-			lut_src[236] / FRAC_SCALE ,
-			lut_src[237] / FRAC_SCALE ,
-			lut_src[238] / FRAC_SCALE ,
-			lut_src[239] / FRAC_SCALE ,
-			lut_src[240] / FRAC_SCALE ,
-			lut_src[241] / FRAC_SCALE ,
-			lut_src[242] / FRAC_SCALE ,
-			lut_src[243] / FRAC_SCALE ,
-			lut_src[244] / FRAC_SCALE ,
-			lut_src[245] / FRAC_SCALE ,
-			lut_src[246] / FRAC_SCALE ,
-			lut_src[247] / FRAC_SCALE ,
-			lut_src[248] / FRAC_SCALE ,
-			lut_src[249] / FRAC_SCALE ,
-			lut_src[250] / FRAC_SCALE ,
-			lut_src[251] / FRAC_SCALE ,
-			lut_src[252] / FRAC_SCALE ,
-			lut_src[253] / FRAC_SCALE ,
-			lut_src[254] / FRAC_SCALE ,
-			lut_src[255] / FRAC_SCALE ,
-			lut_src[256] / FRAC_SCALE ,
-			lut_src[257] / FRAC_SCALE ,
-			lut_src[258] / FRAC_SCALE ,
-			lut_src[259] / FRAC_SCALE ,
-			lut_src[260] / FRAC_SCALE ,
-			lut_src[261] / FRAC_SCALE ,
-			lut_src[262] / FRAC_SCALE ,
-			lut_src[263] / FRAC_SCALE ,
-			lut_src[264] / FRAC_SCALE ,
-			lut_src[265] / FRAC_SCALE ,
-			lut_src[266] / FRAC_SCALE ,
-			lut_src[267] / FRAC_SCALE ,
-			lut_src[268] / FRAC_SCALE ,
-			lut_src[269] / FRAC_SCALE ,
-			lut_src[270] / FRAC_SCALE ,
-			lut_src[271] / FRAC_SCALE ,
-			lut_src[272] / FRAC_SCALE ,
-			lut_src[273] / FRAC_SCALE ,
-			lut_src[274] / FRAC_SCALE ,
-			lut_src[275] / FRAC_SCALE ,
-			lut_src[276] / FRAC_SCALE ,
-			lut_src[277] / FRAC_SCALE ,
-			lut_src[278] / FRAC_SCALE ,
-			lut_src[279] / FRAC_SCALE ,
-			lut_src[280] / FRAC_SCALE ,
-			lut_src[281] / FRAC_SCALE ,
-			lut_src[282] / FRAC_SCALE ,
-			lut_src[283] / FRAC_SCALE ,
-			lut_src[284] / FRAC_SCALE ,
-			lut_src[285] / FRAC_SCALE ,
-			lut_src[286] / FRAC_SCALE ,
-			lut_src[287] / FRAC_SCALE ,
-			lut_src[288] / FRAC_SCALE ,
-			lut_src[289] / FRAC_SCALE ,
-			lut_src[290] / FRAC_SCALE ,
-			lut_src[291] / FRAC_SCALE ,
-			lut_src[292] / FRAC_SCALE ,
-			lut_src[293] / FRAC_SCALE ,
-			lut_src[294] / FRAC_SCALE ,
-			lut_src[295] / FRAC_SCALE ,
-			lut_src[296] / FRAC_SCALE ,
-			lut_src[297] / FRAC_SCALE ,
-			lut_src[298] / FRAC_SCALE ,
-			lut_src[299] / FRAC_SCALE ,
-			lut_src[300] / FRAC_SCALE ,
-			lut_src[301] / FRAC_SCALE ,
-			lut_src[302] / FRAC_SCALE ,
-			lut_src[303] / FRAC_SCALE ,
-			lut_src[304] / FRAC_SCALE ,
-			lut_src[305] / FRAC_SCALE ,
-			lut_src[306] / FRAC_SCALE ,
-			lut_src[307] / FRAC_SCALE ,
-			lut_src[308] / FRAC_SCALE ,
-			lut_src[309] / FRAC_SCALE ,
-			lut_src[310] / FRAC_SCALE ,
-			lut_src[311] / FRAC_SCALE ,
-			lut_src[312] / FRAC_SCALE ,
-			lut_src[313] / FRAC_SCALE ,
-			lut_src[314] / FRAC_SCALE ,
-			lut_src[315] / FRAC_SCALE ,
-			lut_src[316] / FRAC_SCALE ,
-			lut_src[317] / FRAC_SCALE ,
-			lut_src[318] / FRAC_SCALE ,
-			lut_src[319] / FRAC_SCALE ,
-			lut_src[320] / FRAC_SCALE ,
-			lut_src[321] / FRAC_SCALE ,
-			lut_src[322] / FRAC_SCALE ,
-			lut_src[323] / FRAC_SCALE ,
-			lut_src[324] / FRAC_SCALE ,
-			lut_src[325] / FRAC_SCALE ,
-			lut_src[326] / FRAC_SCALE ,
-			lut_src[327] / FRAC_SCALE ,
-			lut_src[328] / FRAC_SCALE ,
-			lut_src[329] / FRAC_SCALE ,
-			lut_src[330] / FRAC_SCALE ,
-			lut_src[331] / FRAC_SCALE ,
-			lut_src[332] / FRAC_SCALE ,
-			lut_src[333] / FRAC_SCALE ,
-			lut_src[334] / FRAC_SCALE ,
-			lut_src[335] / FRAC_SCALE ,
-			lut_src[336] / FRAC_SCALE ,
-			lut_src[337] / FRAC_SCALE ,
-			lut_src[338] / FRAC_SCALE ,
-			lut_src[339] / FRAC_SCALE ,
-			lut_src[340] / FRAC_SCALE ,
-			lut_src[341] / FRAC_SCALE ,
-			lut_src[342] / FRAC_SCALE ,
-			lut_src[343] / FRAC_SCALE ,
-			lut_src[344] / FRAC_SCALE ,
-			lut_src[345] / FRAC_SCALE ,
-			lut_src[346] / FRAC_SCALE ,
-			lut_src[347] / FRAC_SCALE ,
-			lut_src[348] / FRAC_SCALE ,
-			lut_src[349] / FRAC_SCALE ,
-			lut_src[350] / FRAC_SCALE ,
-			lut_src[351] / FRAC_SCALE ,
-			lut_src[352] / FRAC_SCALE ,
-			lut_src[353] / FRAC_SCALE ,
-			lut_src[354] / FRAC_SCALE ,
-			lut_src[355] / FRAC_SCALE ,
-			lut_src[356] / FRAC_SCALE ,
-			lut_src[357] / FRAC_SCALE ,
-			lut_src[358] / FRAC_SCALE ,
-			lut_src[359] / FRAC_SCALE ,
-			lut_src[360] / FRAC_SCALE ,
-			lut_src[361] / FRAC_SCALE ,
-			lut_src[362] / FRAC_SCALE ,
-			lut_src[363] / FRAC_SCALE ,
-			lut_src[364] / FRAC_SCALE ,
-			lut_src[365] / FRAC_SCALE ,
-			lut_src[366] / FRAC_SCALE ,
-			lut_src[367] / FRAC_SCALE ,
-			lut_src[368] / FRAC_SCALE ,
-			lut_src[369] / FRAC_SCALE ,
-			lut_src[370] / FRAC_SCALE ,
-			lut_src[371] / FRAC_SCALE ,
-			lut_src[372] / FRAC_SCALE ,
-			lut_src[373] / FRAC_SCALE ,
-			lut_src[374] / FRAC_SCALE ,
-			lut_src[375] / FRAC_SCALE ,
-			lut_src[376] / FRAC_SCALE ,
-			lut_src[377] / FRAC_SCALE ,
-			lut_src[378] / FRAC_SCALE ,
-			lut_src[379] / FRAC_SCALE ,
-			lut_src[380] / FRAC_SCALE ,
-			lut_src[381] / FRAC_SCALE ,
-			lut_src[382] / FRAC_SCALE ,
-			lut_src[383] / FRAC_SCALE ,
-			lut_src[384] / FRAC_SCALE ,
-			lut_src[385] / FRAC_SCALE ,
-			lut_src[386] / FRAC_SCALE ,
-			lut_src[387] / FRAC_SCALE ,
-			lut_src[388] / FRAC_SCALE ,
-			lut_src[389] / FRAC_SCALE ,
-			lut_src[390] / FRAC_SCALE ,
-			lut_src[391] / FRAC_SCALE ,
-			lut_src[392] / FRAC_SCALE ,
-			lut_src[393] / FRAC_SCALE ,
-			lut_src[394] / FRAC_SCALE ,
-			lut_src[395] / FRAC_SCALE ,
-			lut_src[396] / FRAC_SCALE ,
-			lut_src[397] / FRAC_SCALE ,
-			lut_src[398] / FRAC_SCALE ,
-			lut_src[399] / FRAC_SCALE ,
-			lut_src[400] / FRAC_SCALE ,
-			lut_src[401] / FRAC_SCALE ,
-			lut_src[402] / FRAC_SCALE ,
-			lut_src[403] / FRAC_SCALE ,
-			lut_src[404] / FRAC_SCALE ,
-			lut_src[405] / FRAC_SCALE ,
-			lut_src[406] / FRAC_SCALE ,
-			lut_src[407] / FRAC_SCALE ,
-			lut_src[408] / FRAC_SCALE ,
-			lut_src[409] / FRAC_SCALE ,
-			lut_src[410] / FRAC_SCALE ,
-			lut_src[411] / FRAC_SCALE ,
-			lut_src[412] / FRAC_SCALE ,
-			lut_src[413] / FRAC_SCALE ,
-			lut_src[414] / FRAC_SCALE ,
-			lut_src[415] / FRAC_SCALE ,
-			lut_src[416] / FRAC_SCALE ,
-			lut_src[417] / FRAC_SCALE ,
-			lut_src[418] / FRAC_SCALE ,
-			lut_src[419] / FRAC_SCALE ,
-			lut_src[420] / FRAC_SCALE ,
-			lut_src[421] / FRAC_SCALE ,
-			lut_src[422] / FRAC_SCALE ,
-			lut_src[423] / FRAC_SCALE ,
-			lut_src[424] / FRAC_SCALE ,
-			lut_src[425] / FRAC_SCALE ,
-			lut_src[426] / FRAC_SCALE ,
-			lut_src[427] / FRAC_SCALE ,
-			lut_src[428] / FRAC_SCALE ,
-			lut_src[429] / FRAC_SCALE ,
-			lut_src[430] / FRAC_SCALE ,
-			lut_src[431] / FRAC_SCALE ,
-			lut_src[432] / FRAC_SCALE ,
-			lut_src[433] / FRAC_SCALE ,
-			lut_src[434] / FRAC_SCALE ,
-			lut_src[435] / FRAC_SCALE ,
-			lut_src[436] / FRAC_SCALE ,
-			lut_src[437] / FRAC_SCALE ,
-			lut_src[438] / FRAC_SCALE ,
-			lut_src[439] / FRAC_SCALE ,
-			lut_src[440] / FRAC_SCALE ,
-			lut_src[441] / FRAC_SCALE ,
-			lut_src[442] / FRAC_SCALE ,
-			lut_src[443] / FRAC_SCALE ,
-			lut_src[444] / FRAC_SCALE ,
-			lut_src[445] / FRAC_SCALE ,
-			lut_src[446] / FRAC_SCALE ,
-			lut_src[447] / FRAC_SCALE ,
-			lut_src[448] / FRAC_SCALE ,
-			lut_src[449] / FRAC_SCALE ,
-			lut_src[450] / FRAC_SCALE ,
-			lut_src[451] / FRAC_SCALE ,
-			lut_src[452] / FRAC_SCALE ,
-			lut_src[453] / FRAC_SCALE ,
-			lut_src[454] / FRAC_SCALE ,
-			lut_src[455] / FRAC_SCALE ,
-			lut_src[456] / FRAC_SCALE ,
-			lut_src[457] / FRAC_SCALE ,
-			lut_src[458] / FRAC_SCALE ,
-			lut_src[459] / FRAC_SCALE ,
-			lut_src[460] / FRAC_SCALE ,
-			lut_src[461] / FRAC_SCALE ,
-			lut_src[462] / FRAC_SCALE ,
-			lut_src[463] / FRAC_SCALE ,
-			lut_src[464] / FRAC_SCALE ,
-			lut_src[465] / FRAC_SCALE ,
-			lut_src[466] / FRAC_SCALE ,
-			lut_src[467] / FRAC_SCALE ,
-			lut_src[468] / FRAC_SCALE ,
-			lut_src[469] / FRAC_SCALE ,
-			lut_src[470] / FRAC_SCALE ,
-			lut_src[471] / FRAC_SCALE ,
-			lut_src[472] / FRAC_SCALE ,
-			lut_src[473] / FRAC_SCALE ,
-			lut_src[474] / FRAC_SCALE ,
-			lut_src[475] / FRAC_SCALE ,
-			lut_src[476] / FRAC_SCALE ,
-			lut_src[477] / FRAC_SCALE ,
-			lut_src[478] / FRAC_SCALE ,
-			lut_src[479] / FRAC_SCALE ,
-			lut_src[480] / FRAC_SCALE ,
-			lut_src[481] / FRAC_SCALE ,
-			lut_src[482] / FRAC_SCALE ,
-			lut_src[483] / FRAC_SCALE ,
-			lut_src[484] / FRAC_SCALE ,
-			lut_src[485] / FRAC_SCALE ,
-			lut_src[486] / FRAC_SCALE ,
-			lut_src[487] / FRAC_SCALE ,
-			lut_src[488] / FRAC_SCALE ,
-			lut_src[489] / FRAC_SCALE ,
-			lut_src[490] / FRAC_SCALE ,
-			lut_src[491] / FRAC_SCALE ,
-			lut_src[492] / FRAC_SCALE ,
-			lut_src[493] / FRAC_SCALE ,
-			lut_src[494] / FRAC_SCALE ,
-			lut_src[495] / FRAC_SCALE ,
-			lut_src[496] / FRAC_SCALE ,
-			lut_src[497] / FRAC_SCALE ,
-			lut_src[498] / FRAC_SCALE ,
-			lut_src[499] / FRAC_SCALE ,
-			lut_src[500] / FRAC_SCALE ,
-			lut_src[501] / FRAC_SCALE ,
-			lut_src[502] / FRAC_SCALE ,
-			lut_src[503] / FRAC_SCALE ,
-			lut_src[504] / FRAC_SCALE ,
-			lut_src[505] / FRAC_SCALE ,
-			lut_src[506] / FRAC_SCALE ,
-			lut_src[507] / FRAC_SCALE ,
-			lut_src[508] / FRAC_SCALE ,
-			lut_src[509] / FRAC_SCALE ,
-			lut_src[510] / FRAC_SCALE ,
-			lut_src[511] / FRAC_SCALE ,
-			lut_src[512] / FRAC_SCALE ,
-			lut_src[513] / FRAC_SCALE ,
-			lut_src[514] / FRAC_SCALE ,
-			lut_src[515] / FRAC_SCALE ,
-			lut_src[516] / FRAC_SCALE ,
-			lut_src[517] / FRAC_SCALE ,
-			lut_src[518] / FRAC_SCALE ,
-			lut_src[519] / FRAC_SCALE ,
-			lut_src[520] / FRAC_SCALE ,
-			lut_src[521] / FRAC_SCALE ,
-			lut_src[522] / FRAC_SCALE ,
-			lut_src[523] / FRAC_SCALE ,
-			lut_src[524] / FRAC_SCALE ,
-			lut_src[525] / FRAC_SCALE ,
-			lut_src[526] / FRAC_SCALE ,
-			lut_src[527] / FRAC_SCALE ,
-			lut_src[528] / FRAC_SCALE ,
-			lut_src[529] / FRAC_SCALE ,
-			lut_src[530] / FRAC_SCALE ,
-			lut_src[531] / FRAC_SCALE ,
-			lut_src[532] / FRAC_SCALE ,
-			lut_src[533] / FRAC_SCALE ,
-			lut_src[534] / FRAC_SCALE ,
-			lut_src[535] / FRAC_SCALE ,
-			lut_src[536] / FRAC_SCALE ,
-			lut_src[537] / FRAC_SCALE ,
-			lut_src[538] / FRAC_SCALE ,
-			lut_src[539] / FRAC_SCALE ,
-			lut_src[540] / FRAC_SCALE ,
-			lut_src[541] / FRAC_SCALE ,
-			lut_src[542] / FRAC_SCALE ,
-			lut_src[543] / FRAC_SCALE ,
-			lut_src[544] / FRAC_SCALE ,
-			lut_src[545] / FRAC_SCALE ,
-			lut_src[546] / FRAC_SCALE ,
-			lut_src[547] / FRAC_SCALE ,
-			lut_src[548] / FRAC_SCALE ,
-			lut_src[549] / FRAC_SCALE ,
-			lut_src[550] / FRAC_SCALE ,
-			lut_src[551] / FRAC_SCALE ,
-			lut_src[552] / FRAC_SCALE ,
-			lut_src[553] / FRAC_SCALE ,
-			lut_src[554] / FRAC_SCALE ,
-			lut_src[555] / FRAC_SCALE ,
-			lut_src[556] / FRAC_SCALE ,
-			lut_src[557] / FRAC_SCALE ,
-			lut_src[558] / FRAC_SCALE ,
-			lut_src[559] / FRAC_SCALE ,
-			lut_src[560] / FRAC_SCALE ,
-			lut_src[561] / FRAC_SCALE ,
-			lut_src[562] / FRAC_SCALE ,
-			lut_src[563] / FRAC_SCALE ,
-			lut_src[564] / FRAC_SCALE ,
-			lut_src[565] / FRAC_SCALE ,
-			lut_src[566] / FRAC_SCALE ,
-			lut_src[567] / FRAC_SCALE ,
-			lut_src[568] / FRAC_SCALE ,
-			lut_src[569] / FRAC_SCALE ,
-			lut_src[570] / FRAC_SCALE ,
-			lut_src[571] / FRAC_SCALE ,
-			lut_src[572] / FRAC_SCALE ,
-			lut_src[573] / FRAC_SCALE ,
-			lut_src[574] / FRAC_SCALE ,
-			lut_src[575] / FRAC_SCALE ,
-			lut_src[576] / FRAC_SCALE ,
-			lut_src[577] / FRAC_SCALE ,
-			lut_src[578] / FRAC_SCALE ,
-			lut_src[579] / FRAC_SCALE ,
-			lut_src[580] / FRAC_SCALE ,
-			lut_src[581] / FRAC_SCALE ,
-			lut_src[582] / FRAC_SCALE ,
-			lut_src[583] / FRAC_SCALE ,
-			lut_src[584] / FRAC_SCALE ,
-			lut_src[585] / FRAC_SCALE ,
-			lut_src[586] / FRAC_SCALE ,
-			lut_src[587] / FRAC_SCALE ,
-			lut_src[588] / FRAC_SCALE ,
-			lut_src[589] / FRAC_SCALE ,
-			lut_src[590] / FRAC_SCALE ,
-			lut_src[591] / FRAC_SCALE ,
-			lut_src[592] / FRAC_SCALE ,
-			lut_src[593] / FRAC_SCALE ,
-			lut_src[594] / FRAC_SCALE ,
-			lut_src[595] / FRAC_SCALE ,
-			lut_src[596] / FRAC_SCALE ,
-			lut_src[597] / FRAC_SCALE ,
-			lut_src[598] / FRAC_SCALE ,
-			lut_src[599] / FRAC_SCALE ,
-			lut_src[600] / FRAC_SCALE ,
-			lut_src[601] / FRAC_SCALE ,
-			lut_src[602] / FRAC_SCALE ,
-			lut_src[603] / FRAC_SCALE ,
-			lut_src[604] / FRAC_SCALE ,
-			lut_src[605] / FRAC_SCALE ,
-			lut_src[606] / FRAC_SCALE ,
-			lut_src[607] / FRAC_SCALE ,
-			lut_src[608] / FRAC_SCALE ,
-			lut_src[609] / FRAC_SCALE ,
-			lut_src[610] / FRAC_SCALE ,
-			lut_src[611] / FRAC_SCALE ,
-			lut_src[612] / FRAC_SCALE ,
-			lut_src[613] / FRAC_SCALE ,
-			lut_src[614] / FRAC_SCALE ,
-			lut_src[615] / FRAC_SCALE ,
-			lut_src[616] / FRAC_SCALE ,
-			lut_src[617] / FRAC_SCALE ,
-			lut_src[618] / FRAC_SCALE ,
-			lut_src[619] / FRAC_SCALE ,
-			lut_src[620] / FRAC_SCALE ,
-			lut_src[621] / FRAC_SCALE ,
-			lut_src[622] / FRAC_SCALE ,
-			lut_src[623] / FRAC_SCALE ,
-			lut_src[624] / FRAC_SCALE ,
-			lut_src[625] / FRAC_SCALE ,
-			lut_src[626] / FRAC_SCALE ,
-			lut_src[627] / FRAC_SCALE ,
-			lut_src[628] / FRAC_SCALE ,
-			lut_src[629] / FRAC_SCALE ,
-			lut_src[630] / FRAC_SCALE ,
-			lut_src[631] / FRAC_SCALE ,
-			lut_src[632] / FRAC_SCALE ,
-			lut_src[633] / FRAC_SCALE ,
-			lut_src[634] / FRAC_SCALE ,
-			lut_src[635] / FRAC_SCALE ,
-			lut_src[636] / FRAC_SCALE ,
-			lut_src[637] / FRAC_SCALE ,
-			lut_src[638] / FRAC_SCALE ,
-			lut_src[639] / FRAC_SCALE ,
-			lut_src[640] / FRAC_SCALE ,
-			lut_src[641] / FRAC_SCALE ,
-			lut_src[642] / FRAC_SCALE ,
-			lut_src[643] / FRAC_SCALE ,
-			lut_src[644] / FRAC_SCALE ,
-			lut_src[645] / FRAC_SCALE ,
-			lut_src[646] / FRAC_SCALE ,
-			lut_src[647] / FRAC_SCALE ,
-			lut_src[648] / FRAC_SCALE ,
-			lut_src[649] / FRAC_SCALE ,
-			lut_src[650] / FRAC_SCALE ,
-			lut_src[651] / FRAC_SCALE ,
-			lut_src[652] / FRAC_SCALE ,
-			lut_src[653] / FRAC_SCALE ,
-			lut_src[654] / FRAC_SCALE ,
-			lut_src[655] / FRAC_SCALE ,
-			lut_src[656] / FRAC_SCALE ,
-			lut_src[657] / FRAC_SCALE ,
-			lut_src[658] / FRAC_SCALE ,
-			lut_src[659] / FRAC_SCALE ,
-			lut_src[660] / FRAC_SCALE ,
-			lut_src[661] / FRAC_SCALE ,
-			lut_src[662] / FRAC_SCALE ,
-			lut_src[663] / FRAC_SCALE ,
-			lut_src[664] / FRAC_SCALE ,
-			lut_src[665] / FRAC_SCALE ,
-			lut_src[666] / FRAC_SCALE ,
-			lut_src[667] / FRAC_SCALE ,
-			lut_src[668] / FRAC_SCALE ,
-			lut_src[669] / FRAC_SCALE ,
-			lut_src[670] / FRAC_SCALE ,
-			lut_src[671] / FRAC_SCALE ,
-			lut_src[672] / FRAC_SCALE ,
-			lut_src[673] / FRAC_SCALE ,
-			lut_src[674] / FRAC_SCALE ,
-			lut_src[675] / FRAC_SCALE ,
-			lut_src[676] / FRAC_SCALE ,
-			lut_src[677] / FRAC_SCALE ,
-			lut_src[678] / FRAC_SCALE ,
-			lut_src[679] / FRAC_SCALE ,
-			lut_src[680] / FRAC_SCALE ,
-			lut_src[681] / FRAC_SCALE ,
-			lut_src[682] / FRAC_SCALE ,
-			lut_src[683] / FRAC_SCALE ,
-			lut_src[684] / FRAC_SCALE ,
-			lut_src[685] / FRAC_SCALE ,
-			lut_src[686] / FRAC_SCALE ,
-			lut_src[687] / FRAC_SCALE ,
-			lut_src[688] / FRAC_SCALE ,
-			lut_src[689] / FRAC_SCALE ,
-			lut_src[690] / FRAC_SCALE ,
-			lut_src[691] / FRAC_SCALE ,
-			lut_src[692] / FRAC_SCALE ,
-			lut_src[693] / FRAC_SCALE ,
-			lut_src[694] / FRAC_SCALE ,
-			lut_src[695] / FRAC_SCALE ,
-			lut_src[696] / FRAC_SCALE ,
-			lut_src[697] / FRAC_SCALE ,
-			lut_src[698] / FRAC_SCALE ,
-			lut_src[699] / FRAC_SCALE ,
-			lut_src[700] / FRAC_SCALE ,
-			lut_src[701] / FRAC_SCALE ,
-			lut_src[702] / FRAC_SCALE ,
-			lut_src[703] / FRAC_SCALE ,
-			lut_src[704] / FRAC_SCALE ,
-			lut_src[705] / FRAC_SCALE ,
-			lut_src[706] / FRAC_SCALE ,
-			lut_src[707] / FRAC_SCALE ,
-			lut_src[708] / FRAC_SCALE ,
-			lut_src[709] / FRAC_SCALE ,
-			lut_src[710] / FRAC_SCALE ,
-			lut_src[711] / FRAC_SCALE ,
-			lut_src[712] / FRAC_SCALE ,
-			lut_src[713] / FRAC_SCALE ,
-			lut_src[714] / FRAC_SCALE ,
-			lut_src[715] / FRAC_SCALE ,
-			lut_src[716] / FRAC_SCALE ,
-			lut_src[717] / FRAC_SCALE ,
-			lut_src[718] / FRAC_SCALE ,
-			lut_src[719] / FRAC_SCALE ,
-			lut_src[720] / FRAC_SCALE ,
-			lut_src[721] / FRAC_SCALE ,
-			lut_src[722] / FRAC_SCALE ,
-			lut_src[723] / FRAC_SCALE ,
-			lut_src[724] / FRAC_SCALE ,
-			lut_src[725] / FRAC_SCALE ,
-			lut_src[726] / FRAC_SCALE ,
-			lut_src[727] / FRAC_SCALE ,
-			lut_src[728] / FRAC_SCALE ,
-			lut_src[729] / FRAC_SCALE ,
-			lut_src[730] / FRAC_SCALE ,
-			lut_src[731] / FRAC_SCALE ,
-			lut_src[732] / FRAC_SCALE ,
-			lut_src[733] / FRAC_SCALE ,
-			lut_src[734] / FRAC_SCALE ,
-			lut_src[735] / FRAC_SCALE ,
-			lut_src[736] / FRAC_SCALE ,
-			lut_src[737] / FRAC_SCALE ,
-			lut_src[738] / FRAC_SCALE ,
-			lut_src[739] / FRAC_SCALE ,
-			lut_src[740] / FRAC_SCALE ,
-			lut_src[741] / FRAC_SCALE ,
-			lut_src[742] / FRAC_SCALE ,
-			lut_src[743] / FRAC_SCALE ,
-			lut_src[744] / FRAC_SCALE ,
-			lut_src[745] / FRAC_SCALE ,
-			lut_src[746] / FRAC_SCALE ,
-			lut_src[747] / FRAC_SCALE ,
-			lut_src[748] / FRAC_SCALE ,
-			lut_src[749] / FRAC_SCALE ,
-			lut_src[750] / FRAC_SCALE ,
-			lut_src[751] / FRAC_SCALE ,
-			lut_src[752] / FRAC_SCALE ,
-			lut_src[753] / FRAC_SCALE ,
-			lut_src[754] / FRAC_SCALE ,
-			lut_src[755] / FRAC_SCALE ,
-			lut_src[756] / FRAC_SCALE ,
-			lut_src[757] / FRAC_SCALE ,
-			lut_src[758] / FRAC_SCALE ,
-			lut_src[759] / FRAC_SCALE ,
-			lut_src[760] / FRAC_SCALE ,
-			lut_src[761] / FRAC_SCALE ,
-			lut_src[762] / FRAC_SCALE ,
-			lut_src[763] / FRAC_SCALE ,
-			lut_src[764] / FRAC_SCALE ,
-			lut_src[765] / FRAC_SCALE ,
-			lut_src[766] / FRAC_SCALE ,
-			lut_src[767] / FRAC_SCALE ,
-			lut_src[768] / FRAC_SCALE ,
-			lut_src[769] / FRAC_SCALE ,
-			lut_src[770] / FRAC_SCALE ,
-			lut_src[771] / FRAC_SCALE ,
-			lut_src[772] / FRAC_SCALE ,
-			lut_src[773] / FRAC_SCALE ,
-			lut_src[774] / FRAC_SCALE ,
-			lut_src[775] / FRAC_SCALE ,
-			lut_src[776] / FRAC_SCALE ,
-			lut_src[777] / FRAC_SCALE ,
-			lut_src[778] / FRAC_SCALE ,
-			lut_src[779] / FRAC_SCALE ,
-			lut_src[780] / FRAC_SCALE ,
-			lut_src[781] / FRAC_SCALE ,
-			lut_src[782] / FRAC_SCALE ,
-			lut_src[783] / FRAC_SCALE ,
-			lut_src[784] / FRAC_SCALE ,
-			lut_src[785] / FRAC_SCALE ,
-			lut_src[786] / FRAC_SCALE ,
-			lut_src[787] / FRAC_SCALE ,
-			lut_src[788] / FRAC_SCALE ,
-			lut_src[789] / FRAC_SCALE ,
-			lut_src[790] / FRAC_SCALE ,
-			lut_src[791] / FRAC_SCALE ,
-			lut_src[792] / FRAC_SCALE ,
-			lut_src[793] / FRAC_SCALE ,
-			lut_src[794] / FRAC_SCALE ,
-			lut_src[795] / FRAC_SCALE ,
-			lut_src[796] / FRAC_SCALE ,
-			lut_src[797] / FRAC_SCALE ,
-			lut_src[798] / FRAC_SCALE ,
-			lut_src[799] / FRAC_SCALE ,
-			lut_src[800] / FRAC_SCALE ,
-			lut_src[801] / FRAC_SCALE ,
-			lut_src[802] / FRAC_SCALE ,
-			lut_src[803] / FRAC_SCALE ,
-			lut_src[804] / FRAC_SCALE ,
-			lut_src[805] / FRAC_SCALE ,
-			lut_src[806] / FRAC_SCALE ,
-			lut_src[807] / FRAC_SCALE ,
-			lut_src[808] / FRAC_SCALE ,
-			lut_src[809] / FRAC_SCALE ,
-			lut_src[810] / FRAC_SCALE ,
-			lut_src[811] / FRAC_SCALE ,
-			lut_src[812] / FRAC_SCALE ,
-			lut_src[813] / FRAC_SCALE ,
-			lut_src[814] / FRAC_SCALE ,
-			lut_src[815] / FRAC_SCALE ,
-			lut_src[816] / FRAC_SCALE ,
-			lut_src[817] / FRAC_SCALE ,
-			lut_src[818] / FRAC_SCALE ,
-			lut_src[819] / FRAC_SCALE ,
-			lut_src[820] / FRAC_SCALE ,
-			lut_src[821] / FRAC_SCALE ,
-			lut_src[822] / FRAC_SCALE ,
-			lut_src[823] / FRAC_SCALE ,
-			lut_src[824] / FRAC_SCALE ,
-			lut_src[825] / FRAC_SCALE ,
-			lut_src[826] / FRAC_SCALE ,
-			lut_src[827] / FRAC_SCALE ,
-			lut_src[828] / FRAC_SCALE ,
-			lut_src[829] / FRAC_SCALE ,
-			lut_src[830] / FRAC_SCALE ,
-			lut_src[831] / FRAC_SCALE ,
-			lut_src[832] / FRAC_SCALE ,
-			lut_src[833] / FRAC_SCALE ,
-			lut_src[834] / FRAC_SCALE ,
-			lut_src[835] / FRAC_SCALE ,
-			lut_src[836] / FRAC_SCALE ,
-			lut_src[837] / FRAC_SCALE ,
-			lut_src[838] / FRAC_SCALE ,
-			lut_src[839] / FRAC_SCALE ,
-			lut_src[840] / FRAC_SCALE ,
-			lut_src[841] / FRAC_SCALE ,
-			lut_src[842] / FRAC_SCALE ,
-			lut_src[843] / FRAC_SCALE ,
-			lut_src[844] / FRAC_SCALE ,
-			lut_src[845] / FRAC_SCALE ,
-			lut_src[846] / FRAC_SCALE ,
-			lut_src[847] / FRAC_SCALE ,
-			lut_src[848] / FRAC_SCALE ,
-			lut_src[849] / FRAC_SCALE ,
-			lut_src[850] / FRAC_SCALE ,
-			lut_src[851] / FRAC_SCALE ,
-			lut_src[852] / FRAC_SCALE ,
-			lut_src[853] / FRAC_SCALE ,
-			lut_src[854] / FRAC_SCALE ,
-			lut_src[855] / FRAC_SCALE ,
-			lut_src[856] / FRAC_SCALE ,
-			lut_src[857] / FRAC_SCALE ,
-			lut_src[858] / FRAC_SCALE ,
-			lut_src[859] / FRAC_SCALE ,
-			lut_src[860] / FRAC_SCALE ,
-			lut_src[861] / FRAC_SCALE ,
-			lut_src[862] / FRAC_SCALE ,
-			lut_src[863] / FRAC_SCALE ,
-			lut_src[864] / FRAC_SCALE ,
-			lut_src[865] / FRAC_SCALE ,
-			lut_src[866] / FRAC_SCALE ,
-			lut_src[867] / FRAC_SCALE ,
-			lut_src[868] / FRAC_SCALE ,
-			lut_src[869] / FRAC_SCALE ,
-			lut_src[870] / FRAC_SCALE ,
-			lut_src[871] / FRAC_SCALE ,
-			lut_src[872] / FRAC_SCALE ,
-			lut_src[873] / FRAC_SCALE ,
-			lut_src[874] / FRAC_SCALE ,
-			lut_src[875] / FRAC_SCALE ,
-			lut_src[876] / FRAC_SCALE ,
-			lut_src[877] / FRAC_SCALE ,
-			lut_src[878] / FRAC_SCALE ,
-			lut_src[879] / FRAC_SCALE ,
-			lut_src[880] / FRAC_SCALE ,
-			lut_src[881] / FRAC_SCALE ,
-			lut_src[882] / FRAC_SCALE ,
-			lut_src[883] / FRAC_SCALE ,
-			lut_src[884] / FRAC_SCALE ,
-			lut_src[885] / FRAC_SCALE ,
-			lut_src[886] / FRAC_SCALE ,
-			lut_src[887] / FRAC_SCALE ,
-			lut_src[888] / FRAC_SCALE ,
-			lut_src[889] / FRAC_SCALE ,
-			lut_src[890] / FRAC_SCALE ,
-			lut_src[891] / FRAC_SCALE ,
-			lut_src[892] / FRAC_SCALE ,
-			lut_src[893] / FRAC_SCALE ,
-			lut_src[894] / FRAC_SCALE ,
-			lut_src[895] / FRAC_SCALE ,
-			lut_src[896] / FRAC_SCALE ,
-			lut_src[897] / FRAC_SCALE ,
-			lut_src[898] / FRAC_SCALE ,
-			lut_src[899] / FRAC_SCALE ,
-			lut_src[900] / FRAC_SCALE ,
-			lut_src[901] / FRAC_SCALE ,
-			lut_src[902] / FRAC_SCALE ,
-			lut_src[903] / FRAC_SCALE ,
-			lut_src[904] / FRAC_SCALE ,
-			lut_src[905] / FRAC_SCALE ,
-			lut_src[906] / FRAC_SCALE ,
-			lut_src[907] / FRAC_SCALE ,
-			lut_src[908] / FRAC_SCALE ,
-			lut_src[909] / FRAC_SCALE ,
-			lut_src[910] / FRAC_SCALE ,
-			lut_src[911] / FRAC_SCALE ,
-			lut_src[912] / FRAC_SCALE ,
-			lut_src[913] / FRAC_SCALE ,
-			lut_src[914] / FRAC_SCALE ,
-			lut_src[915] / FRAC_SCALE ,
-			lut_src[916] / FRAC_SCALE ,
-			lut_src[917] / FRAC_SCALE ,
-			lut_src[918] / FRAC_SCALE ,
-			lut_src[919] / FRAC_SCALE ,
-			lut_src[920] / FRAC_SCALE ,
-			lut_src[921] / FRAC_SCALE ,
-			lut_src[922] / FRAC_SCALE ,
-			lut_src[923] / FRAC_SCALE ,
-			lut_src[924] / FRAC_SCALE ,
-			lut_src[925] / FRAC_SCALE ,
-			lut_src[926] / FRAC_SCALE ,
-			lut_src[927] / FRAC_SCALE ,
-			lut_src[928] / FRAC_SCALE ,
-			lut_src[929] / FRAC_SCALE ,
-			lut_src[930] / FRAC_SCALE ,
-			lut_src[931] / FRAC_SCALE ,
-			lut_src[932] / FRAC_SCALE ,
-			lut_src[933] / FRAC_SCALE ,
-			lut_src[934] / FRAC_SCALE ,
-			lut_src[935] / FRAC_SCALE ,
-			lut_src[936] / FRAC_SCALE ,
-			lut_src[937] / FRAC_SCALE ,
-			lut_src[938] / FRAC_SCALE ,
-			lut_src[939] / FRAC_SCALE ,
-			lut_src[940] / FRAC_SCALE ,
-			lut_src[941] / FRAC_SCALE ,
-			lut_src[942] / FRAC_SCALE ,
-			lut_src[943] / FRAC_SCALE ,
-			lut_src[944] / FRAC_SCALE ,
-			lut_src[945] / FRAC_SCALE ,
-			lut_src[946] / FRAC_SCALE ,
-			lut_src[947] / FRAC_SCALE ,
-			lut_src[948] / FRAC_SCALE ,
-			lut_src[949] / FRAC_SCALE ,
-			lut_src[950] / FRAC_SCALE ,
-			lut_src[951] / FRAC_SCALE ,
-			lut_src[952] / FRAC_SCALE ,
-			lut_src[953] / FRAC_SCALE ,
-			lut_src[954] / FRAC_SCALE ,
-			lut_src[955] / FRAC_SCALE ,
-			lut_src[956] / FRAC_SCALE ,
-			lut_src[957] / FRAC_SCALE ,
-			lut_src[958] / FRAC_SCALE ,
-			lut_src[959] / FRAC_SCALE ,
-			lut_src[960] / FRAC_SCALE ,
-			lut_src[961] / FRAC_SCALE ,
-			lut_src[962] / FRAC_SCALE ,
-			lut_src[963] / FRAC_SCALE ,
-			lut_src[964] / FRAC_SCALE ,
-			lut_src[965] / FRAC_SCALE ,
-			lut_src[966] / FRAC_SCALE ,
-			lut_src[967] / FRAC_SCALE ,
-			lut_src[968] / FRAC_SCALE ,
-			lut_src[969] / FRAC_SCALE ,
-			lut_src[970] / FRAC_SCALE ,
-			lut_src[971] / FRAC_SCALE ,
-			lut_src[972] / FRAC_SCALE ,
-			lut_src[973] / FRAC_SCALE ,
-			lut_src[974] / FRAC_SCALE ,
-			lut_src[975] / FRAC_SCALE ,
-			lut_src[976] / FRAC_SCALE ,
-			lut_src[977] / FRAC_SCALE ,
-			lut_src[978] / FRAC_SCALE ,
-			lut_src[979] / FRAC_SCALE ,
-			lut_src[980] / FRAC_SCALE ,
-			lut_src[981] / FRAC_SCALE ,
-			lut_src[982] / FRAC_SCALE ,
-			lut_src[983] / FRAC_SCALE ,
-			lut_src[984] / FRAC_SCALE ,
-			lut_src[985] / FRAC_SCALE ,
-			lut_src[986] / FRAC_SCALE ,
-			lut_src[987] / FRAC_SCALE ,
-			lut_src[988] / FRAC_SCALE ,
-			lut_src[989] / FRAC_SCALE ,
-			lut_src[990] / FRAC_SCALE ,
-			lut_src[991] / FRAC_SCALE ,
-			lut_src[992] / FRAC_SCALE ,
-			lut_src[993] / FRAC_SCALE ,
-			lut_src[994] / FRAC_SCALE ,
-			lut_src[995] / FRAC_SCALE ,
-			lut_src[996] / FRAC_SCALE ,
-			lut_src[997] / FRAC_SCALE ,
-			lut_src[998] / FRAC_SCALE ,
-			lut_src[999] / FRAC_SCALE ,
-			lut_src[1000] / FRAC_SCALE ,
-			lut_src[1001] / FRAC_SCALE ,
-			lut_src[1002] / FRAC_SCALE ,
-			lut_src[1003] / FRAC_SCALE ,
-			lut_src[1004] / FRAC_SCALE ,
-			lut_src[1005] / FRAC_SCALE ,
-			lut_src[1006] / FRAC_SCALE ,
-			lut_src[1007] / FRAC_SCALE ,
-			lut_src[1008] / FRAC_SCALE ,
-			lut_src[1009] / FRAC_SCALE ,
-			lut_src[1010] / FRAC_SCALE ,
-			lut_src[1011] / FRAC_SCALE ,
-			lut_src[1012] / FRAC_SCALE ,
-			lut_src[1013] / FRAC_SCALE ,
-			lut_src[1014] / FRAC_SCALE ,
-			lut_src[1015] / FRAC_SCALE ,
-			lut_src[1016] / FRAC_SCALE ,
-			lut_src[1017] / FRAC_SCALE ,
-			lut_src[1018] / FRAC_SCALE ,
-			lut_src[1019] / FRAC_SCALE ,
-			lut_src[1020] / FRAC_SCALE ,
-			lut_src[1021] / FRAC_SCALE ,
-			lut_src[1022] / FRAC_SCALE ,
-			lut_src[1023] / FRAC_SCALE ,
-			lut_src[1024] / FRAC_SCALE ,
-			lut_src[1025] / FRAC_SCALE ,
-			lut_src[1026] / FRAC_SCALE ,
-			lut_src[1027] / FRAC_SCALE ,
-			lut_src[1028] / FRAC_SCALE ,
-			lut_src[1029] / FRAC_SCALE ,
-			lut_src[1030] / FRAC_SCALE ,
-			lut_src[1031] / FRAC_SCALE ,
-			lut_src[1032] / FRAC_SCALE ,
-			lut_src[1033] / FRAC_SCALE ,
-			lut_src[1034] / FRAC_SCALE ,
-			lut_src[1035] / FRAC_SCALE ,
-			lut_src[1036] / FRAC_SCALE ,
-			lut_src[1037] / FRAC_SCALE ,
-			lut_src[1038] / FRAC_SCALE ,
-			lut_src[1039] / FRAC_SCALE ,
-			lut_src[1040] / FRAC_SCALE ,
-			lut_src[1041] / FRAC_SCALE ,
-			lut_src[1042] / FRAC_SCALE ,
-			lut_src[1043] / FRAC_SCALE ,
-			lut_src[1044] / FRAC_SCALE ,
-			lut_src[1045] / FRAC_SCALE ,
-			lut_src[1046] / FRAC_SCALE ,
-			lut_src[1047] / FRAC_SCALE ,
-			lut_src[1048] / FRAC_SCALE ,
-			lut_src[1049] / FRAC_SCALE ,
-			lut_src[1050] / FRAC_SCALE ,
-			lut_src[1051] / FRAC_SCALE ,
-			lut_src[1052] / FRAC_SCALE ,
-			lut_src[1053] / FRAC_SCALE ,
-			lut_src[1054] / FRAC_SCALE ,
-			lut_src[1055] / FRAC_SCALE ,
-			lut_src[1056] / FRAC_SCALE ,
-			lut_src[1057] / FRAC_SCALE ,
-			lut_src[1058] / FRAC_SCALE ,
-			lut_src[1059] / FRAC_SCALE ,
-			lut_src[1060] / FRAC_SCALE ,
-			lut_src[1061] / FRAC_SCALE ,
-			lut_src[1062] / FRAC_SCALE ,
-			lut_src[1063] / FRAC_SCALE ,
-			lut_src[1064] / FRAC_SCALE ,
-			lut_src[1065] / FRAC_SCALE ,
-			lut_src[1066] / FRAC_SCALE ,
-			lut_src[1067] / FRAC_SCALE ,
-			lut_src[1068] / FRAC_SCALE ,
-			lut_src[1069] / FRAC_SCALE ,
-			lut_src[1070] / FRAC_SCALE ,
-			lut_src[1071] / FRAC_SCALE ,
-			lut_src[1072] / FRAC_SCALE ,
-			lut_src[1073] / FRAC_SCALE ,
-			lut_src[1074] / FRAC_SCALE ,
-			lut_src[1075] / FRAC_SCALE ,
-			lut_src[1076] / FRAC_SCALE ,
-			lut_src[1077] / FRAC_SCALE ,
-			lut_src[1078] / FRAC_SCALE ,
-			lut_src[1079] / FRAC_SCALE ,
-			lut_src[1080] / FRAC_SCALE ,
-			lut_src[1081] / FRAC_SCALE ,
-			lut_src[1082] / FRAC_SCALE ,
-			lut_src[1083] / FRAC_SCALE ,
-			lut_src[1084] / FRAC_SCALE ,
-			lut_src[1085] / FRAC_SCALE ,
-			lut_src[1086] / FRAC_SCALE ,
-			lut_src[1087] / FRAC_SCALE ,
-			lut_src[1088] / FRAC_SCALE ,
-			lut_src[1089] / FRAC_SCALE ,
-			lut_src[1090] / FRAC_SCALE ,
-			lut_src[1091] / FRAC_SCALE ,
-			lut_src[1092] / FRAC_SCALE ,
-			lut_src[1093] / FRAC_SCALE ,
-			lut_src[1094] / FRAC_SCALE ,
-			lut_src[1095] / FRAC_SCALE ,
-			lut_src[1096] / FRAC_SCALE ,
-			lut_src[1097] / FRAC_SCALE ,
-			lut_src[1098] / FRAC_SCALE ,
-			lut_src[1099] / FRAC_SCALE ,
-			lut_src[1100] / FRAC_SCALE ,
-			lut_src[1101] / FRAC_SCALE ,
-			lut_src[1102] / FRAC_SCALE ,
-			lut_src[1103] / FRAC_SCALE ,
-			lut_src[1104] / FRAC_SCALE ,
-			lut_src[1105] / FRAC_SCALE ,
-			lut_src[1106] / FRAC_SCALE ,
-			lut_src[1107] / FRAC_SCALE ,
-			lut_src[1108] / FRAC_SCALE ,
-			lut_src[1109] / FRAC_SCALE ,
-			lut_src[1110] / FRAC_SCALE ,
-			lut_src[1111] / FRAC_SCALE ,
-			lut_src[1112] / FRAC_SCALE ,
-			lut_src[1113] / FRAC_SCALE ,
-			lut_src[1114] / FRAC_SCALE ,
-			lut_src[1115] / FRAC_SCALE ,
-			lut_src[1116] / FRAC_SCALE ,
-			lut_src[1117] / FRAC_SCALE ,
-			lut_src[1118] / FRAC_SCALE ,
-			lut_src[1119] / FRAC_SCALE ,
-			lut_src[1120] / FRAC_SCALE ,
-			lut_src[1121] / FRAC_SCALE ,
-			lut_src[1122] / FRAC_SCALE ,
-			lut_src[1123] / FRAC_SCALE ,
-			lut_src[1124] / FRAC_SCALE ,
-			lut_src[1125] / FRAC_SCALE ,
-			lut_src[1126] / FRAC_SCALE ,
-			lut_src[1127] / FRAC_SCALE ,
-			lut_src[1128] / FRAC_SCALE ,
-			lut_src[1129] / FRAC_SCALE ,
-			lut_src[1130] / FRAC_SCALE ,
-			lut_src[1131] / FRAC_SCALE ,
-			lut_src[1132] / FRAC_SCALE ,
-			lut_src[1133] / FRAC_SCALE ,
-			lut_src[1134] / FRAC_SCALE ,
-			lut_src[1135] / FRAC_SCALE ,
-			lut_src[1136] / FRAC_SCALE ,
-			lut_src[1137] / FRAC_SCALE ,
-			lut_src[1138] / FRAC_SCALE ,
-			lut_src[1139] / FRAC_SCALE ,
-			lut_src[1140] / FRAC_SCALE ,
-			lut_src[1141] / FRAC_SCALE ,
-			lut_src[1142] / FRAC_SCALE ,
-			lut_src[1143] / FRAC_SCALE ,
-			lut_src[1144] / FRAC_SCALE ,
-			lut_src[1145] / FRAC_SCALE ,
-			lut_src[1146] / FRAC_SCALE ,
-			lut_src[1147] / FRAC_SCALE ,
-			lut_src[1148] / FRAC_SCALE ,
-			lut_src[1149] / FRAC_SCALE ,
-			lut_src[1150] / FRAC_SCALE ,
-			lut_src[1151] / FRAC_SCALE ,
-			lut_src[1152] / FRAC_SCALE ,
-			lut_src[1153] / FRAC_SCALE ,
-			lut_src[1154] / FRAC_SCALE ,
-			lut_src[1155] / FRAC_SCALE ,
-			lut_src[1156] / FRAC_SCALE ,
-			lut_src[1157] / FRAC_SCALE ,
-			lut_src[1158] / FRAC_SCALE ,
-			lut_src[1159] / FRAC_SCALE ,
-			lut_src[1160] / FRAC_SCALE ,
-			lut_src[1161] / FRAC_SCALE ,
-			lut_src[1162] / FRAC_SCALE ,
-			lut_src[1163] / FRAC_SCALE ,
-			lut_src[1164] / FRAC_SCALE ,
-			lut_src[1165] / FRAC_SCALE ,
-			lut_src[1166] / FRAC_SCALE ,
-			lut_src[1167] / FRAC_SCALE ,
-			lut_src[1168] / FRAC_SCALE ,
-			lut_src[1169] / FRAC_SCALE ,
-			lut_src[1170] / FRAC_SCALE ,
-			lut_src[1171] / FRAC_SCALE ,
-			lut_src[1172] / FRAC_SCALE ,
-			lut_src[1173] / FRAC_SCALE ,
-			lut_src[1174] / FRAC_SCALE ,
-			lut_src[1175] / FRAC_SCALE ,
-			lut_src[1176] / FRAC_SCALE ,
-			lut_src[1177] / FRAC_SCALE ,
-			lut_src[1178] / FRAC_SCALE ,
-			lut_src[1179] / FRAC_SCALE ,
-			lut_src[1180] / FRAC_SCALE ,
-			lut_src[1181] / FRAC_SCALE ,
-			lut_src[1182] / FRAC_SCALE ,
-			lut_src[1183] / FRAC_SCALE ,
-			lut_src[1184] / FRAC_SCALE ,
-			lut_src[1185] / FRAC_SCALE ,
-			lut_src[1186] / FRAC_SCALE ,
-			lut_src[1187] / FRAC_SCALE ,
-			lut_src[1188] / FRAC_SCALE ,
-			lut_src[1189] / FRAC_SCALE ,
-			lut_src[1190] / FRAC_SCALE ,
-			lut_src[1191] / FRAC_SCALE ,
-			lut_src[1192] / FRAC_SCALE ,
-			lut_src[1193] / FRAC_SCALE ,
-			lut_src[1194] / FRAC_SCALE ,
-			lut_src[1195] / FRAC_SCALE ,
-			lut_src[1196] / FRAC_SCALE ,
-			lut_src[1197] / FRAC_SCALE ,
-			lut_src[1198] / FRAC_SCALE ,
-			lut_src[1199] / FRAC_SCALE ,
-			lut_src[1200] / FRAC_SCALE ,
-			lut_src[1201] / FRAC_SCALE ,
-			lut_src[1202] / FRAC_SCALE ,
-			lut_src[1203] / FRAC_SCALE ,
-			lut_src[1204] / FRAC_SCALE ,
-			lut_src[1205] / FRAC_SCALE ,
-			lut_src[1206] / FRAC_SCALE ,
-			lut_src[1207] / FRAC_SCALE ,
-			lut_src[1208] / FRAC_SCALE ,
-			lut_src[1209] / FRAC_SCALE ,
-			lut_src[1210] / FRAC_SCALE ,
-			lut_src[1211] / FRAC_SCALE ,
-			lut_src[1212] / FRAC_SCALE ,
-			lut_src[1213] / FRAC_SCALE ,
-			lut_src[1214] / FRAC_SCALE ,
-			lut_src[1215] / FRAC_SCALE ,
-			lut_src[1216] / FRAC_SCALE ,
-			lut_src[1217] / FRAC_SCALE ,
-			lut_src[1218] / FRAC_SCALE ,
-			lut_src[1219] / FRAC_SCALE ,
-			lut_src[1220] / FRAC_SCALE ,
-			lut_src[1221] / FRAC_SCALE ,
-			lut_src[1222] / FRAC_SCALE ,
-			lut_src[1223] / FRAC_SCALE ,
-			lut_src[1224] / FRAC_SCALE ,
-			lut_src[1225] / FRAC_SCALE ,
-			lut_src[1226] / FRAC_SCALE ,
-			lut_src[1227] / FRAC_SCALE ,
-			lut_src[1228] / FRAC_SCALE ,
-			lut_src[1229] / FRAC_SCALE ,
-			lut_src[1230] / FRAC_SCALE ,
-			lut_src[1231] / FRAC_SCALE ,
-			lut_src[1232] / FRAC_SCALE ,
-			lut_src[1233] / FRAC_SCALE ,
-			lut_src[1234] / FRAC_SCALE ,
-			lut_src[1235] / FRAC_SCALE ,
-			lut_src[1236] / FRAC_SCALE ,
-			lut_src[1237] / FRAC_SCALE ,
-			lut_src[1238] / FRAC_SCALE ,
-			lut_src[1239] / FRAC_SCALE ,
-			lut_src[1240] / FRAC_SCALE ,
-			lut_src[1241] / FRAC_SCALE ,
-			lut_src[1242] / FRAC_SCALE ,
-			lut_src[1243] / FRAC_SCALE ,
-			lut_src[1244] / FRAC_SCALE ,
-			lut_src[1245] / FRAC_SCALE ,
-			lut_src[1246] / FRAC_SCALE ,
-			lut_src[1247] / FRAC_SCALE ,
-			lut_src[1248] / FRAC_SCALE ,
-			lut_src[1249] / FRAC_SCALE ,
-			lut_src[1250] / FRAC_SCALE ,
-			lut_src[1251] / FRAC_SCALE ,
-			lut_src[1252] / FRAC_SCALE ,
-			lut_src[1253] / FRAC_SCALE ,
-			lut_src[1254] / FRAC_SCALE ,
-			lut_src[1255] / FRAC_SCALE ,
-			lut_src[1256] / FRAC_SCALE ,
-			lut_src[1257] / FRAC_SCALE ,
-			lut_src[1258] / FRAC_SCALE ,
-			lut_src[1259] / FRAC_SCALE ,
-			lut_src[1260] / FRAC_SCALE ,
-			lut_src[1261] / FRAC_SCALE ,
-			lut_src[1262] / FRAC_SCALE ,
-			lut_src[1263] / FRAC_SCALE ,
-			lut_src[1264] / FRAC_SCALE ,
-			lut_src[1265] / FRAC_SCALE ,
-			lut_src[1266] / FRAC_SCALE ,
-			lut_src[1267] / FRAC_SCALE ,
-			lut_src[1268] / FRAC_SCALE ,
-			lut_src[1269] / FRAC_SCALE ,
-			lut_src[1270] / FRAC_SCALE ,
-			lut_src[1271] / FRAC_SCALE ,
-			lut_src[1272] / FRAC_SCALE ,
-			lut_src[1273] / FRAC_SCALE ,
-			lut_src[1274] / FRAC_SCALE ,
-			lut_src[1275] / FRAC_SCALE ,
-			lut_src[1276] / FRAC_SCALE ,
-			lut_src[1277] / FRAC_SCALE ,
-			lut_src[1278] / FRAC_SCALE ,
-			lut_src[1279] / FRAC_SCALE ,
-			lut_src[1280] / FRAC_SCALE ,
-			lut_src[1281] / FRAC_SCALE ,
-			lut_src[1282] / FRAC_SCALE ,
-			lut_src[1283] / FRAC_SCALE ,
-			lut_src[1284] / FRAC_SCALE ,
-			lut_src[1285] / FRAC_SCALE ,
-			lut_src[1286] / FRAC_SCALE ,
-			lut_src[1287] / FRAC_SCALE ,
-			lut_src[1288] / FRAC_SCALE ,
-			lut_src[1289] / FRAC_SCALE ,
-			lut_src[1290] / FRAC_SCALE ,
-			lut_src[1291] / FRAC_SCALE ,
-			lut_src[1292] / FRAC_SCALE ,
-			lut_src[1293] / FRAC_SCALE ,
-			lut_src[1294] / FRAC_SCALE ,
-			lut_src[1295] / FRAC_SCALE ,
-			lut_src[1296] / FRAC_SCALE ,
-			lut_src[1297] / FRAC_SCALE ,
-			lut_src[1298] / FRAC_SCALE ,
-			lut_src[1299] / FRAC_SCALE ,
-			lut_src[1300] / FRAC_SCALE ,
-			lut_src[1301] / FRAC_SCALE ,
-			lut_src[1302] / FRAC_SCALE ,
-			lut_src[1303] / FRAC_SCALE ,
-			lut_src[1304] / FRAC_SCALE ,
-			lut_src[1305] / FRAC_SCALE ,
-			lut_src[1306] / FRAC_SCALE ,
-			lut_src[1307] / FRAC_SCALE ,
-			lut_src[1308] / FRAC_SCALE ,
-			lut_src[1309] / FRAC_SCALE ,
-			lut_src[1310] / FRAC_SCALE ,
-			lut_src[1311] / FRAC_SCALE ,
-			lut_src[1312] / FRAC_SCALE ,
-			lut_src[1313] / FRAC_SCALE ,
-			lut_src[1314] / FRAC_SCALE ,
-			lut_src[1315] / FRAC_SCALE ,
-			lut_src[1316] / FRAC_SCALE ,
-			lut_src[1317] / FRAC_SCALE ,
-			lut_src[1318] / FRAC_SCALE ,
-			lut_src[1319] / FRAC_SCALE ,
-			lut_src[1320] / FRAC_SCALE ,
-			lut_src[1321] / FRAC_SCALE ,
-			lut_src[1322] / FRAC_SCALE ,
-			lut_src[1323] / FRAC_SCALE ,
-			lut_src[1324] / FRAC_SCALE ,
-			lut_src[1325] / FRAC_SCALE ,
-			lut_src[1326] / FRAC_SCALE ,
-			lut_src[1327] / FRAC_SCALE ,
-			lut_src[1328] / FRAC_SCALE ,
-			lut_src[1329] / FRAC_SCALE ,
-			lut_src[1330] / FRAC_SCALE ,
-			lut_src[1331] / FRAC_SCALE ,
-			lut_src[1332] / FRAC_SCALE ,
-			lut_src[1333] / FRAC_SCALE ,
-			lut_src[1334] / FRAC_SCALE ,
-			lut_src[1335] / FRAC_SCALE ,
-			lut_src[1336] / FRAC_SCALE ,
-			lut_src[1337] / FRAC_SCALE ,
-			lut_src[1338] / FRAC_SCALE ,
-			lut_src[1339] / FRAC_SCALE ,
-			lut_src[1340] / FRAC_SCALE ,
-			lut_src[1341] / FRAC_SCALE ,
-			lut_src[1342] / FRAC_SCALE ,
-			lut_src[1343] / FRAC_SCALE ,
-			lut_src[1344] / FRAC_SCALE ,
-			lut_src[1345] / FRAC_SCALE ,
-			lut_src[1346] / FRAC_SCALE ,
-			lut_src[1347] / FRAC_SCALE ,
-			lut_src[1348] / FRAC_SCALE ,
-			lut_src[1349] / FRAC_SCALE ,
-			lut_src[1350] / FRAC_SCALE ,
-			lut_src[1351] / FRAC_SCALE ,
-			lut_src[1352] / FRAC_SCALE ,
-			lut_src[1353] / FRAC_SCALE ,
-			lut_src[1354] / FRAC_SCALE ,
-			lut_src[1355] / FRAC_SCALE ,
-			lut_src[1356] / FRAC_SCALE ,
-			lut_src[1357] / FRAC_SCALE ,
-			lut_src[1358] / FRAC_SCALE ,
-			lut_src[1359] / FRAC_SCALE ,
-			lut_src[1360] / FRAC_SCALE ,
-			lut_src[1361] / FRAC_SCALE ,
-			lut_src[1362] / FRAC_SCALE ,
-			lut_src[1363] / FRAC_SCALE ,
-			lut_src[1364] / FRAC_SCALE ,
-			lut_src[1365] / FRAC_SCALE ,
-			lut_src[1366] / FRAC_SCALE ,
-			lut_src[1367] / FRAC_SCALE ,
-			lut_src[1368] / FRAC_SCALE ,
-			lut_src[1369] / FRAC_SCALE ,
-			lut_src[1370] / FRAC_SCALE ,
-			lut_src[1371] / FRAC_SCALE ,
-			lut_src[1372] / FRAC_SCALE ,
-			lut_src[1373] / FRAC_SCALE ,
-			lut_src[1374] / FRAC_SCALE ,
-			lut_src[1375] / FRAC_SCALE ,
-			lut_src[1376] / FRAC_SCALE ,
-			lut_src[1377] / FRAC_SCALE ,
-			lut_src[1378] / FRAC_SCALE ,
-			lut_src[1379] / FRAC_SCALE ,
-			lut_src[1380] / FRAC_SCALE ,
-			lut_src[1381] / FRAC_SCALE ,
-			lut_src[1382] / FRAC_SCALE ,
-			lut_src[1383] / FRAC_SCALE ,
-			lut_src[1384] / FRAC_SCALE ,
-			lut_src[1385] / FRAC_SCALE ,
-			lut_src[1386] / FRAC_SCALE ,
-			lut_src[1387] / FRAC_SCALE ,
-			lut_src[1388] / FRAC_SCALE ,
-			lut_src[1389] / FRAC_SCALE ,
-			lut_src[1390] / FRAC_SCALE ,
-			lut_src[1391] / FRAC_SCALE ,
-			lut_src[1392] / FRAC_SCALE ,
-			lut_src[1393] / FRAC_SCALE ,
-			lut_src[1394] / FRAC_SCALE ,
-			lut_src[1395] / FRAC_SCALE ,
-			lut_src[1396] / FRAC_SCALE ,
-			lut_src[1397] / FRAC_SCALE ,
-			lut_src[1398] / FRAC_SCALE ,
-			lut_src[1399] / FRAC_SCALE ,
-			lut_src[1400] / FRAC_SCALE ,
-			lut_src[1401] / FRAC_SCALE ,
-			lut_src[1402] / FRAC_SCALE ,
-			lut_src[1403] / FRAC_SCALE ,
-			lut_src[1404] / FRAC_SCALE ,
-			lut_src[1405] / FRAC_SCALE ,
-			lut_src[1406] / FRAC_SCALE ,
-			lut_src[1407] / FRAC_SCALE ,
-			lut_src[1408] / FRAC_SCALE ,
-			lut_src[1409] / FRAC_SCALE ,
-			lut_src[1410] / FRAC_SCALE ,
-			lut_src[1411] / FRAC_SCALE ,
-			lut_src[1412] / FRAC_SCALE ,
-			lut_src[1413] / FRAC_SCALE ,
-			lut_src[1414] / FRAC_SCALE ,
-			lut_src[1415] / FRAC_SCALE ,
-			lut_src[1416] / FRAC_SCALE ,
-			lut_src[1417] / FRAC_SCALE ,
-			lut_src[1418] / FRAC_SCALE ,
-			lut_src[1419] / FRAC_SCALE ,
-			lut_src[1420] / FRAC_SCALE ,
-			lut_src[1421] / FRAC_SCALE ,
-			lut_src[1422] / FRAC_SCALE ,
-			lut_src[1423] / FRAC_SCALE ,
-			lut_src[1424] / FRAC_SCALE ,
-			lut_src[1425] / FRAC_SCALE ,
-			lut_src[1426] / FRAC_SCALE ,
-			lut_src[1427] / FRAC_SCALE ,
-			lut_src[1428] / FRAC_SCALE ,
-			lut_src[1429] / FRAC_SCALE ,
-			lut_src[1430] / FRAC_SCALE ,
-			lut_src[1431] / FRAC_SCALE ,
-			lut_src[1432] / FRAC_SCALE ,
-			lut_src[1433] / FRAC_SCALE ,
-			lut_src[1434] / FRAC_SCALE ,
-			lut_src[1435] / FRAC_SCALE ,
-			lut_src[1436] / FRAC_SCALE ,
-			lut_src[1437] / FRAC_SCALE ,
-			lut_src[1438] / FRAC_SCALE ,
-			lut_src[1439] / FRAC_SCALE ,
-			lut_src[1440] / FRAC_SCALE ,
-			lut_src[1441] / FRAC_SCALE ,
-			lut_src[1442] / FRAC_SCALE ,
-			lut_src[1443] / FRAC_SCALE ,
-			lut_src[1444] / FRAC_SCALE ,
-			lut_src[1445] / FRAC_SCALE ,
-			lut_src[1446] / FRAC_SCALE ,
-			lut_src[1447] / FRAC_SCALE ,
-			lut_src[1448] / FRAC_SCALE ,
-			lut_src[1449] / FRAC_SCALE ,
-			lut_src[1450] / FRAC_SCALE ,
-			lut_src[1451] / FRAC_SCALE ,
-			lut_src[1452] / FRAC_SCALE ,
-			lut_src[1453] / FRAC_SCALE ,
-			lut_src[1454] / FRAC_SCALE ,
-			lut_src[1455] / FRAC_SCALE ,
-			lut_src[1456] / FRAC_SCALE ,
-			lut_src[1457] / FRAC_SCALE ,
-			lut_src[1458] / FRAC_SCALE ,
-			lut_src[1459] / FRAC_SCALE ,
-			lut_src[1460] / FRAC_SCALE ,
-			lut_src[1461] / FRAC_SCALE ,
-			lut_src[1462] / FRAC_SCALE ,
-			lut_src[1463] / FRAC_SCALE ,
-			lut_src[1464] / FRAC_SCALE ,
-			lut_src[1465] / FRAC_SCALE ,
-			lut_src[1466] / FRAC_SCALE ,
-			lut_src[1467] / FRAC_SCALE ,
-			lut_src[1468] / FRAC_SCALE ,
-			lut_src[1469] / FRAC_SCALE ,
-			lut_src[1470] / FRAC_SCALE ,
-			lut_src[1471] / FRAC_SCALE ,
-			lut_src[1472] / FRAC_SCALE ,
-			lut_src[1473] / FRAC_SCALE ,
-			lut_src[1474] / FRAC_SCALE ,
-			lut_src[1475] / FRAC_SCALE ,
-			lut_src[1476] / FRAC_SCALE ,
-			lut_src[1477] / FRAC_SCALE ,
-			lut_src[1478] / FRAC_SCALE ,
-			lut_src[1479] / FRAC_SCALE ,
-			lut_src[1480] / FRAC_SCALE ,
-			lut_src[1481] / FRAC_SCALE ,
-			lut_src[1482] / FRAC_SCALE ,
-			lut_src[1483] / FRAC_SCALE ,
-			lut_src[1484] / FRAC_SCALE ,
-			lut_src[1485] / FRAC_SCALE ,
-			lut_src[1486] / FRAC_SCALE ,
-			lut_src[1487] / FRAC_SCALE ,
-			lut_src[1488] / FRAC_SCALE ,
-			lut_src[1489] / FRAC_SCALE ,
-			lut_src[1490] / FRAC_SCALE ,
-			lut_src[1491] / FRAC_SCALE ,
-			lut_src[1492] / FRAC_SCALE ,
-			lut_src[1493] / FRAC_SCALE ,
-			lut_src[1494] / FRAC_SCALE ,
-			lut_src[1495] / FRAC_SCALE ,
-			lut_src[1496] / FRAC_SCALE ,
-			lut_src[1497] / FRAC_SCALE ,
-			lut_src[1498] / FRAC_SCALE ,
-			lut_src[1499] / FRAC_SCALE ,
-			lut_src[1500] / FRAC_SCALE ,
-			lut_src[1501] / FRAC_SCALE ,
-			lut_src[1502] / FRAC_SCALE ,
-			lut_src[1503] / FRAC_SCALE ,
-			lut_src[1504] / FRAC_SCALE ,
-			lut_src[1505] / FRAC_SCALE ,
-			lut_src[1506] / FRAC_SCALE ,
-			lut_src[1507] / FRAC_SCALE ,
-			lut_src[1508] / FRAC_SCALE ,
-			lut_src[1509] / FRAC_SCALE ,
-			lut_src[1510] / FRAC_SCALE ,
-			lut_src[1511] / FRAC_SCALE ,
-			lut_src[1512] / FRAC_SCALE ,
-			lut_src[1513] / FRAC_SCALE ,
-			lut_src[1514] / FRAC_SCALE ,
-			lut_src[1515] / FRAC_SCALE ,
-			lut_src[1516] / FRAC_SCALE ,
-			lut_src[1517] / FRAC_SCALE ,
-			lut_src[1518] / FRAC_SCALE ,
-			lut_src[1519] / FRAC_SCALE ,
-			lut_src[1520] / FRAC_SCALE ,
-			lut_src[1521] / FRAC_SCALE ,
-			lut_src[1522] / FRAC_SCALE ,
-			lut_src[1523] / FRAC_SCALE ,
-			lut_src[1524] / FRAC_SCALE ,
-			lut_src[1525] / FRAC_SCALE ,
-			lut_src[1526] / FRAC_SCALE ,
-			lut_src[1527] / FRAC_SCALE ,
-			lut_src[1528] / FRAC_SCALE ,
-			lut_src[1529] / FRAC_SCALE ,
-			lut_src[1530] / FRAC_SCALE ,
-			lut_src[1531] / FRAC_SCALE ,
-			lut_src[1532] / FRAC_SCALE ,
-			lut_src[1533] / FRAC_SCALE ,
-			lut_src[1534] / FRAC_SCALE ,
-			lut_src[1535] / FRAC_SCALE ,
-			lut_src[1536] / FRAC_SCALE ,
-			lut_src[1537] / FRAC_SCALE ,
-			lut_src[1538] / FRAC_SCALE ,
-			lut_src[1539] / FRAC_SCALE ,
-			lut_src[1540] / FRAC_SCALE ,
-			lut_src[1541] / FRAC_SCALE ,
-			lut_src[1542] / FRAC_SCALE ,
-			lut_src[1543] / FRAC_SCALE ,
-			lut_src[1544] / FRAC_SCALE ,
-			lut_src[1545] / FRAC_SCALE ,
-			lut_src[1546] / FRAC_SCALE ,
-			lut_src[1547] / FRAC_SCALE ,
-			lut_src[1548] / FRAC_SCALE ,
-			lut_src[1549] / FRAC_SCALE ,
-			lut_src[1550] / FRAC_SCALE ,
-			lut_src[1551] / FRAC_SCALE ,
-			lut_src[1552] / FRAC_SCALE ,
-			lut_src[1553] / FRAC_SCALE ,
-			lut_src[1554] / FRAC_SCALE ,
-			lut_src[1555] / FRAC_SCALE ,
-			lut_src[1556] / FRAC_SCALE ,
-			lut_src[1557] / FRAC_SCALE ,
-			lut_src[1558] / FRAC_SCALE ,
-			lut_src[1559] / FRAC_SCALE ,
-			lut_src[1560] / FRAC_SCALE ,
-			lut_src[1561] / FRAC_SCALE ,
-			lut_src[1562] / FRAC_SCALE ,
-			lut_src[1563] / FRAC_SCALE ,
-			lut_src[1564] / FRAC_SCALE ,
-			lut_src[1565] / FRAC_SCALE ,
-			lut_src[1566] / FRAC_SCALE ,
-			lut_src[1567] / FRAC_SCALE ,
-			lut_src[1568] / FRAC_SCALE ,
-			lut_src[1569] / FRAC_SCALE ,
-			lut_src[1570] / FRAC_SCALE ,
-			lut_src[1571] / FRAC_SCALE ,
-			lut_src[1572] / FRAC_SCALE ,
-			lut_src[1573] / FRAC_SCALE ,
-			lut_src[1574] / FRAC_SCALE ,
-			lut_src[1575] / FRAC_SCALE ,
-			lut_src[1576] / FRAC_SCALE ,
-			lut_src[1577] / FRAC_SCALE ,
-			lut_src[1578] / FRAC_SCALE ,
-			lut_src[1579] / FRAC_SCALE ,
-			lut_src[1580] / FRAC_SCALE ,
-			lut_src[1581] / FRAC_SCALE ,
-			lut_src[1582] / FRAC_SCALE ,
-			lut_src[1583] / FRAC_SCALE ,
-			lut_src[1584] / FRAC_SCALE ,
-			lut_src[1585] / FRAC_SCALE ,
-			lut_src[1586] / FRAC_SCALE ,
-			lut_src[1587] / FRAC_SCALE ,
-			lut_src[1588] / FRAC_SCALE ,
-			lut_src[1589] / FRAC_SCALE ,
-			lut_src[1590] / FRAC_SCALE ,
-			lut_src[1591] / FRAC_SCALE ,
-			lut_src[1592] / FRAC_SCALE ,
-			lut_src[1593] / FRAC_SCALE ,
-			lut_src[1594] / FRAC_SCALE ,
-			lut_src[1595] / FRAC_SCALE ,
-			lut_src[1596] / FRAC_SCALE ,
-			lut_src[1597] / FRAC_SCALE ,
-			lut_src[1598] / FRAC_SCALE ,
-			lut_src[1599] / FRAC_SCALE ,
-			lut_src[1600] / FRAC_SCALE ,
-			lut_src[1601] / FRAC_SCALE ,
-			lut_src[1602] / FRAC_SCALE ,
-			lut_src[1603] / FRAC_SCALE ,
-			lut_src[1604] / FRAC_SCALE ,
-			lut_src[1605] / FRAC_SCALE ,
-			lut_src[1606] / FRAC_SCALE ,
-			lut_src[1607] / FRAC_SCALE ,
-			lut_src[1608] / FRAC_SCALE ,
-			lut_src[1609] / FRAC_SCALE ,
-			lut_src[1610] / FRAC_SCALE ,
-			lut_src[1611] / FRAC_SCALE ,
-			lut_src[1612] / FRAC_SCALE ,
-			lut_src[1613] / FRAC_SCALE ,
-			lut_src[1614] / FRAC_SCALE ,
-			lut_src[1615] / FRAC_SCALE ,
-			lut_src[1616] / FRAC_SCALE ,
-			lut_src[1617] / FRAC_SCALE ,
-			lut_src[1618] / FRAC_SCALE ,
-			lut_src[1619] / FRAC_SCALE ,
-			lut_src[1620] / FRAC_SCALE ,
-			lut_src[1621] / FRAC_SCALE ,
-			lut_src[1622] / FRAC_SCALE ,
-			lut_src[1623] / FRAC_SCALE ,
-			lut_src[1624] / FRAC_SCALE ,
-			lut_src[1625] / FRAC_SCALE ,
-			lut_src[1626] / FRAC_SCALE ,
-			lut_src[1627] / FRAC_SCALE ,
-			lut_src[1628] / FRAC_SCALE ,
-			lut_src[1629] / FRAC_SCALE ,
-			lut_src[1630] / FRAC_SCALE ,
-			lut_src[1631] / FRAC_SCALE ,
-			lut_src[1632] / FRAC_SCALE ,
-			lut_src[1633] / FRAC_SCALE ,
-			lut_src[1634] / FRAC_SCALE ,
-			lut_src[1635] / FRAC_SCALE ,
-			lut_src[1636] / FRAC_SCALE ,
-			lut_src[1637] / FRAC_SCALE ,
-			lut_src[1638] / FRAC_SCALE ,
-			lut_src[1639] / FRAC_SCALE ,
-			lut_src[1640] / FRAC_SCALE ,
-			lut_src[1641] / FRAC_SCALE ,
-			lut_src[1642] / FRAC_SCALE ,
-			lut_src[1643] / FRAC_SCALE ,
-			lut_src[1644] / FRAC_SCALE ,
-			lut_src[1645] / FRAC_SCALE ,
-			lut_src[1646] / FRAC_SCALE ,
-			lut_src[1647] / FRAC_SCALE ,
-			lut_src[1648] / FRAC_SCALE ,
-			lut_src[1649] / FRAC_SCALE ,
-			lut_src[1650] / FRAC_SCALE ,
-			lut_src[1651] / FRAC_SCALE ,
-			lut_src[1652] / FRAC_SCALE ,
-			lut_src[1653] / FRAC_SCALE ,
-			lut_src[1654] / FRAC_SCALE ,
-			lut_src[1655] / FRAC_SCALE ,
-			lut_src[1656] / FRAC_SCALE ,
-			lut_src[1657] / FRAC_SCALE ,
-			lut_src[1658] / FRAC_SCALE ,
-			lut_src[1659] / FRAC_SCALE ,
-			lut_src[1660] / FRAC_SCALE ,
-			lut_src[1661] / FRAC_SCALE ,
-			lut_src[1662] / FRAC_SCALE ,
-			lut_src[1663] / FRAC_SCALE ,
-			lut_src[1664] / FRAC_SCALE ,
-			lut_src[1665] / FRAC_SCALE ,
-			lut_src[1666] / FRAC_SCALE ,
-			lut_src[1667] / FRAC_SCALE ,
-			lut_src[1668] / FRAC_SCALE ,
-			lut_src[1669] / FRAC_SCALE ,
-			lut_src[1670] / FRAC_SCALE ,
-			lut_src[1671] / FRAC_SCALE ,
-			lut_src[1672] / FRAC_SCALE ,
-			lut_src[1673] / FRAC_SCALE ,
-			lut_src[1674] / FRAC_SCALE ,
-			lut_src[1675] / FRAC_SCALE ,
-			lut_src[1676] / FRAC_SCALE ,
-			lut_src[1677] / FRAC_SCALE ,
-			lut_src[1678] / FRAC_SCALE ,
-			lut_src[1679] / FRAC_SCALE ,
-			lut_src[1680] / FRAC_SCALE ,
-			lut_src[1681] / FRAC_SCALE ,
-			lut_src[1682] / FRAC_SCALE ,
-			lut_src[1683] / FRAC_SCALE ,
-			lut_src[1684] / FRAC_SCALE ,
-			lut_src[1685] / FRAC_SCALE ,
-			lut_src[1686] / FRAC_SCALE ,
-			lut_src[1687] / FRAC_SCALE ,
-			lut_src[1688] / FRAC_SCALE ,
-			lut_src[1689] / FRAC_SCALE ,
-			lut_src[1690] / FRAC_SCALE ,
-			lut_src[1691] / FRAC_SCALE ,
-			lut_src[1692] / FRAC_SCALE ,
-			lut_src[1693] / FRAC_SCALE ,
-			lut_src[1694] / FRAC_SCALE ,
-			lut_src[1695] / FRAC_SCALE ,
-			lut_src[1696] / FRAC_SCALE ,
-			lut_src[1697] / FRAC_SCALE ,
-			lut_src[1698] / FRAC_SCALE ,
-			lut_src[1699] / FRAC_SCALE ,
-			lut_src[1700] / FRAC_SCALE ,
-			lut_src[1701] / FRAC_SCALE ,
-			lut_src[1702] / FRAC_SCALE ,
-			lut_src[1703] / FRAC_SCALE ,
-			lut_src[1704] / FRAC_SCALE ,
-			lut_src[1705] / FRAC_SCALE ,
-			lut_src[1706] / FRAC_SCALE ,
-			lut_src[1707] / FRAC_SCALE ,
-			lut_src[1708] / FRAC_SCALE ,
-			lut_src[1709] / FRAC_SCALE ,
-			lut_src[1710] / FRAC_SCALE ,
-			lut_src[1711] / FRAC_SCALE ,
-			lut_src[1712] / FRAC_SCALE ,
-			lut_src[1713] / FRAC_SCALE ,
-			lut_src[1714] / FRAC_SCALE ,
-			lut_src[1715] / FRAC_SCALE ,
-			lut_src[1716] / FRAC_SCALE ,
-			lut_src[1717] / FRAC_SCALE ,
-			lut_src[1718] / FRAC_SCALE ,
-			lut_src[1719] / FRAC_SCALE ,
-			lut_src[1720] / FRAC_SCALE ,
-			lut_src[1721] / FRAC_SCALE ,
-			lut_src[1722] / FRAC_SCALE ,
-			lut_src[1723] / FRAC_SCALE ,
-			lut_src[1724] / FRAC_SCALE ,
-			lut_src[1725] / FRAC_SCALE ,
-			lut_src[1726] / FRAC_SCALE ,
-			lut_src[1727] / FRAC_SCALE ,
-			lut_src[1728] / FRAC_SCALE ,
-			lut_src[1729] / FRAC_SCALE ,
-			lut_src[1730] / FRAC_SCALE ,
-			lut_src[1731] / FRAC_SCALE ,
-			lut_src[1732] / FRAC_SCALE ,
-			lut_src[1733] / FRAC_SCALE ,
-			lut_src[1734] / FRAC_SCALE ,
-			lut_src[1735] / FRAC_SCALE ,
-			lut_src[1736] / FRAC_SCALE ,
-			lut_src[1737] / FRAC_SCALE ,
-			lut_src[1738] / FRAC_SCALE ,
-			lut_src[1739] / FRAC_SCALE ,
-			lut_src[1740] / FRAC_SCALE ,
-			lut_src[1741] / FRAC_SCALE ,
-			lut_src[1742] / FRAC_SCALE ,
-			lut_src[1743] / FRAC_SCALE ,
-			lut_src[1744] / FRAC_SCALE ,
-			lut_src[1745] / FRAC_SCALE ,
-			lut_src[1746] / FRAC_SCALE ,
-			lut_src[1747] / FRAC_SCALE ,
-			lut_src[1748] / FRAC_SCALE ,
-			lut_src[1749] / FRAC_SCALE ,
-			lut_src[1750] / FRAC_SCALE ,
-			lut_src[1751] / FRAC_SCALE ,
-			lut_src[1752] / FRAC_SCALE ,
-			lut_src[1753] / FRAC_SCALE ,
-			lut_src[1754] / FRAC_SCALE ,
-			lut_src[1755] / FRAC_SCALE ,
-			lut_src[1756] / FRAC_SCALE ,
-			lut_src[1757] / FRAC_SCALE ,
-			lut_src[1758] / FRAC_SCALE ,
-			lut_src[1759] / FRAC_SCALE ,
-			lut_src[1760] / FRAC_SCALE ,
-			lut_src[1761] / FRAC_SCALE ,
-			lut_src[1762] / FRAC_SCALE ,
-			lut_src[1763] / FRAC_SCALE ,
-			lut_src[1764] / FRAC_SCALE ,
-			lut_src[1765] / FRAC_SCALE ,
-			lut_src[1766] / FRAC_SCALE ,
-			lut_src[1767] / FRAC_SCALE ,
-			lut_src[1768] / FRAC_SCALE ,
-			lut_src[1769] / FRAC_SCALE ,
-			lut_src[1770] / FRAC_SCALE ,
-			lut_src[1771] / FRAC_SCALE ,
-			lut_src[1772] / FRAC_SCALE ,
-			lut_src[1773] / FRAC_SCALE ,
-			lut_src[1774] / FRAC_SCALE ,
-			lut_src[1775] / FRAC_SCALE ,
-			lut_src[1776] / FRAC_SCALE ,
-			lut_src[1777] / FRAC_SCALE ,
-			lut_src[1778] / FRAC_SCALE ,
-			lut_src[1779] / FRAC_SCALE ,
-			lut_src[1780] / FRAC_SCALE ,
-			lut_src[1781] / FRAC_SCALE ,
-			lut_src[1782] / FRAC_SCALE ,
-			lut_src[1783] / FRAC_SCALE ,
-			lut_src[1784] / FRAC_SCALE ,
-			lut_src[1785] / FRAC_SCALE ,
-			lut_src[1786] / FRAC_SCALE ,
-			lut_src[1787] / FRAC_SCALE ,
-			lut_src[1788] / FRAC_SCALE ,
-			lut_src[1789] / FRAC_SCALE ,
-			lut_src[1790] / FRAC_SCALE ,
-			lut_src[1791] / FRAC_SCALE ,
-			lut_src[1792] / FRAC_SCALE ,
-			lut_src[1793] / FRAC_SCALE ,
-			lut_src[1794] / FRAC_SCALE ,
-			lut_src[1795] / FRAC_SCALE ,
-			lut_src[1796] / FRAC_SCALE ,
-			lut_src[1797] / FRAC_SCALE ,
-			lut_src[1798] / FRAC_SCALE ,
-			lut_src[1799] / FRAC_SCALE ,
-			lut_src[1800] / FRAC_SCALE ,
-			lut_src[1801] / FRAC_SCALE ,
-			lut_src[1802] / FRAC_SCALE ,
-			lut_src[1803] / FRAC_SCALE ,
-			lut_src[1804] / FRAC_SCALE ,
-			lut_src[1805] / FRAC_SCALE ,
-			lut_src[1806] / FRAC_SCALE ,
-			lut_src[1807] / FRAC_SCALE ,
-			lut_src[1808] / FRAC_SCALE ,
-			lut_src[1809] / FRAC_SCALE ,
-			lut_src[1810] / FRAC_SCALE ,
-			lut_src[1811] / FRAC_SCALE ,
-			lut_src[1812] / FRAC_SCALE ,
-			lut_src[1813] / FRAC_SCALE ,
-			lut_src[1814] / FRAC_SCALE ,
-			lut_src[1815] / FRAC_SCALE ,
-			lut_src[1816] / FRAC_SCALE ,
-			lut_src[1817] / FRAC_SCALE ,
-			lut_src[1818] / FRAC_SCALE ,
-			lut_src[1819] / FRAC_SCALE ,
-			lut_src[1820] / FRAC_SCALE ,
-			lut_src[1821] / FRAC_SCALE ,
-			lut_src[1822] / FRAC_SCALE ,
-			lut_src[1823] / FRAC_SCALE ,
-			lut_src[1824] / FRAC_SCALE ,
-			lut_src[1825] / FRAC_SCALE ,
-			lut_src[1826] / FRAC_SCALE ,
-			lut_src[1827] / FRAC_SCALE ,
-			lut_src[1828] / FRAC_SCALE ,
-			lut_src[1829] / FRAC_SCALE ,
-			lut_src[1830] / FRAC_SCALE ,
-			lut_src[1831] / FRAC_SCALE ,
-			lut_src[1832] / FRAC_SCALE ,
-			lut_src[1833] / FRAC_SCALE ,
-			lut_src[1834] / FRAC_SCALE ,
-			lut_src[1835] / FRAC_SCALE ,
-			lut_src[1836] / FRAC_SCALE ,
-			lut_src[1837] / FRAC_SCALE ,
-			lut_src[1838] / FRAC_SCALE ,
-			lut_src[1839] / FRAC_SCALE ,
-			lut_src[1840] / FRAC_SCALE ,
-			lut_src[1841] / FRAC_SCALE ,
-			lut_src[1842] / FRAC_SCALE ,
-			lut_src[1843] / FRAC_SCALE ,
-			lut_src[1844] / FRAC_SCALE ,
-			lut_src[1845] / FRAC_SCALE ,
-			lut_src[1846] / FRAC_SCALE ,
-			lut_src[1847] / FRAC_SCALE ,
-			lut_src[1848] / FRAC_SCALE ,
-			lut_src[1849] / FRAC_SCALE ,
-			lut_src[1850] / FRAC_SCALE ,
-			lut_src[1851] / FRAC_SCALE ,
-			lut_src[1852] / FRAC_SCALE ,
-			lut_src[1853] / FRAC_SCALE ,
-			lut_src[1854] / FRAC_SCALE ,
-			lut_src[1855] / FRAC_SCALE ,
-			lut_src[1856] / FRAC_SCALE ,
-			lut_src[1857] / FRAC_SCALE ,
-			lut_src[1858] / FRAC_SCALE ,
-			lut_src[1859] / FRAC_SCALE ,
-			lut_src[1860] / FRAC_SCALE ,
-			lut_src[1861] / FRAC_SCALE ,
-			lut_src[1862] / FRAC_SCALE ,
-			lut_src[1863] / FRAC_SCALE ,
-			lut_src[1864] / FRAC_SCALE ,
-			lut_src[1865] / FRAC_SCALE ,
-			lut_src[1866] / FRAC_SCALE ,
-			lut_src[1867] / FRAC_SCALE ,
-			lut_src[1868] / FRAC_SCALE ,
-			lut_src[1869] / FRAC_SCALE ,
-			lut_src[1870] / FRAC_SCALE ,
-			lut_src[1871] / FRAC_SCALE ,
-			lut_src[1872] / FRAC_SCALE ,
-			lut_src[1873] / FRAC_SCALE ,
-			lut_src[1874] / FRAC_SCALE ,
-			lut_src[1875] / FRAC_SCALE ,
-			lut_src[1876] / FRAC_SCALE ,
-			lut_src[1877] / FRAC_SCALE ,
-			lut_src[1878] / FRAC_SCALE ,
-			lut_src[1879] / FRAC_SCALE ,
-			lut_src[1880] / FRAC_SCALE ,
-			lut_src[1881] / FRAC_SCALE ,
-			lut_src[1882] / FRAC_SCALE ,
-			lut_src[1883] / FRAC_SCALE ,
-			lut_src[1884] / FRAC_SCALE ,
-			lut_src[1885] / FRAC_SCALE ,
-			lut_src[1886] / FRAC_SCALE ,
-			lut_src[1887] / FRAC_SCALE ,
-			lut_src[1888] / FRAC_SCALE ,
-			lut_src[1889] / FRAC_SCALE ,
-			lut_src[1890] / FRAC_SCALE ,
-			lut_src[1891] / FRAC_SCALE ,
-			lut_src[1892] / FRAC_SCALE ,
-			lut_src[1893] / FRAC_SCALE ,
-			lut_src[1894] / FRAC_SCALE ,
-			lut_src[1895] / FRAC_SCALE ,
-			lut_src[1896] / FRAC_SCALE ,
-			lut_src[1897] / FRAC_SCALE ,
-			lut_src[1898] / FRAC_SCALE ,
-			lut_src[1899] / FRAC_SCALE ,
-			lut_src[1900] / FRAC_SCALE ,
-			lut_src[1901] / FRAC_SCALE ,
-			lut_src[1902] / FRAC_SCALE ,
-			lut_src[1903] / FRAC_SCALE ,
-			lut_src[1904] / FRAC_SCALE ,
-			lut_src[1905] / FRAC_SCALE ,
-			lut_src[1906] / FRAC_SCALE ,
-			lut_src[1907] / FRAC_SCALE ,
-			lut_src[1908] / FRAC_SCALE ,
-			lut_src[1909] / FRAC_SCALE ,
-			lut_src[1910] / FRAC_SCALE ,
-			lut_src[1911] / FRAC_SCALE ,
-			lut_src[1912] / FRAC_SCALE ,
-			lut_src[1913] / FRAC_SCALE ,
-			lut_src[1914] / FRAC_SCALE ,
-			lut_src[1915] / FRAC_SCALE ,
-			lut_src[1916] / FRAC_SCALE ,
-			lut_src[1917] / FRAC_SCALE ,
-			lut_src[1918] / FRAC_SCALE ,
-			lut_src[1919] / FRAC_SCALE ,
-			lut_src[1920] / FRAC_SCALE ,
-			lut_src[1921] / FRAC_SCALE ,
-			lut_src[1922] / FRAC_SCALE ,
-			lut_src[1923] / FRAC_SCALE ,
-			lut_src[1924] / FRAC_SCALE ,
-			lut_src[1925] / FRAC_SCALE ,
-			lut_src[1926] / FRAC_SCALE ,
-			lut_src[1927] / FRAC_SCALE ,
-			lut_src[1928] / FRAC_SCALE ,
-			lut_src[1929] / FRAC_SCALE ,
-			lut_src[1930] / FRAC_SCALE ,
-			lut_src[1931] / FRAC_SCALE ,
-			lut_src[1932] / FRAC_SCALE ,
-			lut_src[1933] / FRAC_SCALE ,
-			lut_src[1934] / FRAC_SCALE ,
-			lut_src[1935] / FRAC_SCALE ,
-			lut_src[1936] / FRAC_SCALE ,
-			lut_src[1937] / FRAC_SCALE ,
-			lut_src[1938] / FRAC_SCALE ,
-			lut_src[1939] / FRAC_SCALE ,
-			lut_src[1940] / FRAC_SCALE ,
-			lut_src[1941] / FRAC_SCALE ,
-			lut_src[1942] / FRAC_SCALE ,
-			lut_src[1943] / FRAC_SCALE ,
-			lut_src[1944] / FRAC_SCALE ,
-			lut_src[1945] / FRAC_SCALE ,
-			lut_src[1946] / FRAC_SCALE ,
-			lut_src[1947] / FRAC_SCALE ,
-			lut_src[1948] / FRAC_SCALE ,
-			lut_src[1949] / FRAC_SCALE ,
-			lut_src[1950] / FRAC_SCALE ,
-			lut_src[1951] / FRAC_SCALE ,
-			lut_src[1952] / FRAC_SCALE ,
-			lut_src[1953] / FRAC_SCALE ,
-			lut_src[1954] / FRAC_SCALE ,
-			lut_src[1955] / FRAC_SCALE ,
-			lut_src[1956] / FRAC_SCALE ,
-			lut_src[1957] / FRAC_SCALE ,
-			lut_src[1958] / FRAC_SCALE ,
-			lut_src[1959] / FRAC_SCALE ,
-			lut_src[1960] / FRAC_SCALE ,
-			lut_src[1961] / FRAC_SCALE ,
-			lut_src[1962] / FRAC_SCALE ,
-			lut_src[1963] / FRAC_SCALE ,
-			lut_src[1964] / FRAC_SCALE ,
-			lut_src[1965] / FRAC_SCALE ,
-			lut_src[1966] / FRAC_SCALE ,
-			lut_src[1967] / FRAC_SCALE ,
-			lut_src[1968] / FRAC_SCALE ,
-			lut_src[1969] / FRAC_SCALE ,
-			lut_src[1970] / FRAC_SCALE ,
-			lut_src[1971] / FRAC_SCALE ,
-			lut_src[1972] / FRAC_SCALE ,
-			lut_src[1973] / FRAC_SCALE ,
-			lut_src[1974] / FRAC_SCALE ,
-			lut_src[1975] / FRAC_SCALE ,
-			lut_src[1976] / FRAC_SCALE ,
-			lut_src[1977] / FRAC_SCALE ,
-			lut_src[1978] / FRAC_SCALE ,
-			lut_src[1979] / FRAC_SCALE ,
-			lut_src[1980] / FRAC_SCALE ,
-			lut_src[1981] / FRAC_SCALE ,
-			lut_src[1982] / FRAC_SCALE ,
-			lut_src[1983] / FRAC_SCALE ,
-			lut_src[1984] / FRAC_SCALE ,
-			lut_src[1985] / FRAC_SCALE ,
-			lut_src[1986] / FRAC_SCALE ,
-			lut_src[1987] / FRAC_SCALE ,
-			lut_src[1988] / FRAC_SCALE ,
-			lut_src[1989] / FRAC_SCALE ,
-			lut_src[1990] / FRAC_SCALE ,
-			lut_src[1991] / FRAC_SCALE ,
-			lut_src[1992] / FRAC_SCALE ,
-			lut_src[1993] / FRAC_SCALE ,
-			lut_src[1994] / FRAC_SCALE ,
-			lut_src[1995] / FRAC_SCALE ,
-			lut_src[1996] / FRAC_SCALE ,
-			lut_src[1997] / FRAC_SCALE ,
-			lut_src[1998] / FRAC_SCALE ,
-			lut_src[1999] / FRAC_SCALE ,
-			lut_src[2000] / FRAC_SCALE ,
-			lut_src[2001] / FRAC_SCALE ,
-			lut_src[2002] / FRAC_SCALE ,
-			lut_src[2003] / FRAC_SCALE ,
-			lut_src[2004] / FRAC_SCALE ,
-			lut_src[2005] / FRAC_SCALE ,
-			lut_src[2006] / FRAC_SCALE ,
-			lut_src[2007] / FRAC_SCALE ,
-			lut_src[2008] / FRAC_SCALE ,
-			lut_src[2009] / FRAC_SCALE ,
-			lut_src[2010] / FRAC_SCALE ,
-			lut_src[2011] / FRAC_SCALE ,
-			lut_src[2012] / FRAC_SCALE ,
-			lut_src[2013] / FRAC_SCALE ,
-			lut_src[2014] / FRAC_SCALE ,
-			lut_src[2015] / FRAC_SCALE ,
-			lut_src[2016] / FRAC_SCALE ,
-			lut_src[2017] / FRAC_SCALE ,
-			lut_src[2018] / FRAC_SCALE ,
-			lut_src[2019] / FRAC_SCALE ,
-			lut_src[2020] / FRAC_SCALE ,
-			lut_src[2021] / FRAC_SCALE ,
-			lut_src[2022] / FRAC_SCALE ,
-			lut_src[2023] / FRAC_SCALE ,
-			lut_src[2024] / FRAC_SCALE ,
-			lut_src[2025] / FRAC_SCALE ,
-			lut_src[2026] / FRAC_SCALE ,
-			lut_src[2027] / FRAC_SCALE ,
-			lut_src[2028] / FRAC_SCALE ,
-			lut_src[2029] / FRAC_SCALE ,
-			lut_src[2030] / FRAC_SCALE ,
-			lut_src[2031] / FRAC_SCALE ,
-			lut_src[2032] / FRAC_SCALE ,
-			lut_src[2033] / FRAC_SCALE ,
-			lut_src[2034] / FRAC_SCALE ,
-			lut_src[2035] / FRAC_SCALE ,
-			lut_src[2036] / FRAC_SCALE ,
-			lut_src[2037] / FRAC_SCALE ,
-			lut_src[2038] / FRAC_SCALE ,
-			lut_src[2039] / FRAC_SCALE ,
-			lut_src[2040] / FRAC_SCALE ,
-			lut_src[2041] / FRAC_SCALE ,
-			lut_src[2042] / FRAC_SCALE ,
-			lut_src[2043] / FRAC_SCALE ,
-			lut_src[2044] / FRAC_SCALE ,
-			lut_src[2045] / FRAC_SCALE ,
-			lut_src[2046] / FRAC_SCALE ,
-			lut_src[2047] / FRAC_SCALE ,
-			lut_src[2048] / FRAC_SCALE ,
-			lut_src[2049] / FRAC_SCALE ,
-			lut_src[2050] / FRAC_SCALE ,
-			lut_src[2051] / FRAC_SCALE ,
-			lut_src[2052] / FRAC_SCALE ,
-			lut_src[2053] / FRAC_SCALE ,
-			lut_src[2054] / FRAC_SCALE ,
-			lut_src[2055] / FRAC_SCALE ,
-			lut_src[2056] / FRAC_SCALE ,
-			lut_src[2057] / FRAC_SCALE ,
-			lut_src[2058] / FRAC_SCALE ,
-			lut_src[2059] / FRAC_SCALE ,
-			lut_src[2060] / FRAC_SCALE ,
-			lut_src[2061] / FRAC_SCALE ,
-			lut_src[2062] / FRAC_SCALE ,
-			lut_src[2063] / FRAC_SCALE ,
-			lut_src[2064] / FRAC_SCALE ,
-			lut_src[2065] / FRAC_SCALE ,
-			lut_src[2066] / FRAC_SCALE ,
-			lut_src[2067] / FRAC_SCALE ,
-			lut_src[2068] / FRAC_SCALE ,
-			lut_src[2069] / FRAC_SCALE ,
-			lut_src[2070] / FRAC_SCALE ,
-			lut_src[2071] / FRAC_SCALE ,
-			lut_src[2072] / FRAC_SCALE ,
-			lut_src[2073] / FRAC_SCALE ,
-			lut_src[2074] / FRAC_SCALE ,
-			lut_src[2075] / FRAC_SCALE ,
-			lut_src[2076] / FRAC_SCALE ,
-			lut_src[2077] / FRAC_SCALE ,
-			lut_src[2078] / FRAC_SCALE ,
-			lut_src[2079] / FRAC_SCALE ,
-			lut_src[2080] / FRAC_SCALE ,
-			lut_src[2081] / FRAC_SCALE ,
-			lut_src[2082] / FRAC_SCALE ,
-			lut_src[2083] / FRAC_SCALE ,
-			lut_src[2084] / FRAC_SCALE ,
-			lut_src[2085] / FRAC_SCALE ,
-			lut_src[2086] / FRAC_SCALE ,
-			lut_src[2087] / FRAC_SCALE ,
-			lut_src[2088] / FRAC_SCALE ,
-			lut_src[2089] / FRAC_SCALE ,
-			lut_src[2090] / FRAC_SCALE ,
-			lut_src[2091] / FRAC_SCALE ,
-			lut_src[2092] / FRAC_SCALE ,
-			lut_src[2093] / FRAC_SCALE ,
-			lut_src[2094] / FRAC_SCALE ,
-			lut_src[2095] / FRAC_SCALE ,
-			lut_src[2096] / FRAC_SCALE ,
-			lut_src[2097] / FRAC_SCALE ,
-			lut_src[2098] / FRAC_SCALE ,
-			lut_src[2099] / FRAC_SCALE ,
-			lut_src[2100] / FRAC_SCALE ,
-			lut_src[2101] / FRAC_SCALE ,
-			lut_src[2102] / FRAC_SCALE ,
-			lut_src[2103] / FRAC_SCALE ,
-			lut_src[2104] / FRAC_SCALE ,
-			lut_src[2105] / FRAC_SCALE ,
-			lut_src[2106] / FRAC_SCALE ,
-			lut_src[2107] / FRAC_SCALE ,
-			lut_src[2108] / FRAC_SCALE ,
-			lut_src[2109] / FRAC_SCALE ,
-			lut_src[2110] / FRAC_SCALE ,
-			lut_src[2111] / FRAC_SCALE ,
-			lut_src[2112] / FRAC_SCALE ,
-			lut_src[2113] / FRAC_SCALE ,
-			lut_src[2114] / FRAC_SCALE ,
-			lut_src[2115] / FRAC_SCALE ,
-			lut_src[2116] / FRAC_SCALE ,
-			lut_src[2117] / FRAC_SCALE ,
-			lut_src[2118] / FRAC_SCALE ,
-			lut_src[2119] / FRAC_SCALE ,
-			lut_src[2120] / FRAC_SCALE ,
-			lut_src[2121] / FRAC_SCALE ,
-			lut_src[2122] / FRAC_SCALE ,
-			lut_src[2123] / FRAC_SCALE ,
-			lut_src[2124] / FRAC_SCALE ,
-			lut_src[2125] / FRAC_SCALE ,
-			lut_src[2126] / FRAC_SCALE ,
-			lut_src[2127] / FRAC_SCALE ,
-			lut_src[2128] / FRAC_SCALE ,
-			lut_src[2129] / FRAC_SCALE ,
-			lut_src[2130] / FRAC_SCALE ,
-			lut_src[2131] / FRAC_SCALE ,
-			lut_src[2132] / FRAC_SCALE ,
-			lut_src[2133] / FRAC_SCALE ,
-			lut_src[2134] / FRAC_SCALE ,
-			lut_src[2135] / FRAC_SCALE ,
-			lut_src[2136] / FRAC_SCALE ,
-			lut_src[2137] / FRAC_SCALE ,
-			lut_src[2138] / FRAC_SCALE ,
-			lut_src[2139] / FRAC_SCALE ,
-			lut_src[2140] / FRAC_SCALE ,
-			lut_src[2141] / FRAC_SCALE ,
-			lut_src[2142] / FRAC_SCALE ,
-			lut_src[2143] / FRAC_SCALE ,
-			lut_src[2144] / FRAC_SCALE ,
-			lut_src[2145] / FRAC_SCALE ,
-			lut_src[2146] / FRAC_SCALE ,
-			lut_src[2147] / FRAC_SCALE ,
-			lut_src[2148] / FRAC_SCALE ,
-			lut_src[2149] / FRAC_SCALE ,
-			lut_src[2150] / FRAC_SCALE ,
-			lut_src[2151] / FRAC_SCALE ,
-			lut_src[2152] / FRAC_SCALE ,
-			lut_src[2153] / FRAC_SCALE ,
-			lut_src[2154] / FRAC_SCALE ,
-			lut_src[2155] / FRAC_SCALE ,
-			lut_src[2156] / FRAC_SCALE ,
-			lut_src[2157] / FRAC_SCALE ,
-			lut_src[2158] / FRAC_SCALE ,
-			lut_src[2159] / FRAC_SCALE ,
-			lut_src[2160] / FRAC_SCALE ,
-			lut_src[2161] / FRAC_SCALE ,
-			lut_src[2162] / FRAC_SCALE ,
-			lut_src[2163] / FRAC_SCALE ,
-			lut_src[2164] / FRAC_SCALE ,
-			lut_src[2165] / FRAC_SCALE ,
-			lut_src[2166] / FRAC_SCALE ,
-			lut_src[2167] / FRAC_SCALE ,
-			lut_src[2168] / FRAC_SCALE ,
-			lut_src[2169] / FRAC_SCALE ,
-			lut_src[2170] / FRAC_SCALE ,
-			lut_src[2171] / FRAC_SCALE ,
-			lut_src[2172] / FRAC_SCALE ,
-			lut_src[2173] / FRAC_SCALE ,
-			lut_src[2174] / FRAC_SCALE ,
-			lut_src[2175] / FRAC_SCALE ,
-			lut_src[2176] / FRAC_SCALE ,
-			lut_src[2177] / FRAC_SCALE ,
-			lut_src[2178] / FRAC_SCALE ,
-			lut_src[2179] / FRAC_SCALE ,
-			lut_src[2180] / FRAC_SCALE ,
-			lut_src[2181] / FRAC_SCALE ,
-			lut_src[2182] / FRAC_SCALE ,
-			lut_src[2183] / FRAC_SCALE ,
-			lut_src[2184] / FRAC_SCALE ,
-			lut_src[2185] / FRAC_SCALE ,
-			lut_src[2186] / FRAC_SCALE ,
-			lut_src[2187] / FRAC_SCALE ,
-			lut_src[2188] / FRAC_SCALE ,
-			lut_src[2189] / FRAC_SCALE ,
-			lut_src[2190] / FRAC_SCALE ,
-			lut_src[2191] / FRAC_SCALE ,
-			lut_src[2192] / FRAC_SCALE ,
-			lut_src[2193] / FRAC_SCALE ,
-			lut_src[2194] / FRAC_SCALE ,
-			lut_src[2195] / FRAC_SCALE ,
-			lut_src[2196] / FRAC_SCALE ,
-			lut_src[2197] / FRAC_SCALE ,
-			lut_src[2198] / FRAC_SCALE ,
-			lut_src[2199] / FRAC_SCALE ,
-			lut_src[2200] / FRAC_SCALE ,
-			lut_src[2201] / FRAC_SCALE ,
-			lut_src[2202] / FRAC_SCALE ,
-			lut_src[2203] / FRAC_SCALE ,
-			lut_src[2204] / FRAC_SCALE ,
-			lut_src[2205] / FRAC_SCALE ,
-			lut_src[2206] / FRAC_SCALE ,
-			lut_src[2207] / FRAC_SCALE ,
-			lut_src[2208] / FRAC_SCALE ,
-			lut_src[2209] / FRAC_SCALE ,
-			lut_src[2210] / FRAC_SCALE ,
-			lut_src[2211] / FRAC_SCALE ,
-			lut_src[2212] / FRAC_SCALE ,
-			lut_src[2213] / FRAC_SCALE ,
-			lut_src[2214] / FRAC_SCALE ,
-			lut_src[2215] / FRAC_SCALE ,
-			lut_src[2216] / FRAC_SCALE ,
-			lut_src[2217] / FRAC_SCALE ,
-			lut_src[2218] / FRAC_SCALE ,
-			lut_src[2219] / FRAC_SCALE ,
-			lut_src[2220] / FRAC_SCALE ,
-			lut_src[2221] / FRAC_SCALE ,
-			lut_src[2222] / FRAC_SCALE ,
-			lut_src[2223] / FRAC_SCALE ,
-			lut_src[2224] / FRAC_SCALE ,
-			lut_src[2225] / FRAC_SCALE ,
-			lut_src[2226] / FRAC_SCALE ,
-			lut_src[2227] / FRAC_SCALE ,
-			lut_src[2228] / FRAC_SCALE ,
-			lut_src[2229] / FRAC_SCALE ,
-			lut_src[2230] / FRAC_SCALE ,
-			lut_src[2231] / FRAC_SCALE ,
-			lut_src[2232] / FRAC_SCALE ,
-			lut_src[2233] / FRAC_SCALE ,
-			lut_src[2234] / FRAC_SCALE ,
-			lut_src[2235] / FRAC_SCALE ,
-			lut_src[2236] / FRAC_SCALE ,
-			lut_src[2237] / FRAC_SCALE ,
-			lut_src[2238] / FRAC_SCALE ,
-			lut_src[2239] / FRAC_SCALE ,
-			lut_src[2240] / FRAC_SCALE ,
-			lut_src[2241] / FRAC_SCALE ,
-			lut_src[2242] / FRAC_SCALE ,
-			lut_src[2243] / FRAC_SCALE ,
-			lut_src[2244] / FRAC_SCALE ,
-			lut_src[2245] / FRAC_SCALE ,
-			lut_src[2246] / FRAC_SCALE ,
-			lut_src[2247] / FRAC_SCALE ,
-			lut_src[2248] / FRAC_SCALE ,
-			lut_src[2249] / FRAC_SCALE ,
-			lut_src[2250] / FRAC_SCALE ,
-			lut_src[2251] / FRAC_SCALE ,
-			lut_src[2252] / FRAC_SCALE ,
-			lut_src[2253] / FRAC_SCALE ,
-			lut_src[2254] / FRAC_SCALE ,
-			lut_src[2255] / FRAC_SCALE ,
-			lut_src[2256] / FRAC_SCALE ,
-			lut_src[2257] / FRAC_SCALE ,
-			lut_src[2258] / FRAC_SCALE ,
-			lut_src[2259] / FRAC_SCALE ,
-			lut_src[2260] / FRAC_SCALE ,
-			lut_src[2261] / FRAC_SCALE ,
-			lut_src[2262] / FRAC_SCALE ,
-			lut_src[2263] / FRAC_SCALE ,
-			lut_src[2264] / FRAC_SCALE ,
-			lut_src[2265] / FRAC_SCALE ,
-			lut_src[2266] / FRAC_SCALE ,
-			lut_src[2267] / FRAC_SCALE ,
-			lut_src[2268] / FRAC_SCALE ,
-			lut_src[2269] / FRAC_SCALE ,
-			lut_src[2270] / FRAC_SCALE ,
-			lut_src[2271] / FRAC_SCALE ,
-			lut_src[2272] / FRAC_SCALE ,
-			lut_src[2273] / FRAC_SCALE ,
-			lut_src[2274] / FRAC_SCALE ,
-			lut_src[2275] / FRAC_SCALE ,
-			lut_src[2276] / FRAC_SCALE ,
-			lut_src[2277] / FRAC_SCALE ,
-			lut_src[2278] / FRAC_SCALE ,
-			lut_src[2279] / FRAC_SCALE ,
-			lut_src[2280] / FRAC_SCALE ,
-			lut_src[2281] / FRAC_SCALE ,
-			lut_src[2282] / FRAC_SCALE ,
-			lut_src[2283] / FRAC_SCALE ,
-			lut_src[2284] / FRAC_SCALE ,
-			lut_src[2285] / FRAC_SCALE ,
-			lut_src[2286] / FRAC_SCALE ,
-			lut_src[2287] / FRAC_SCALE ,
-			lut_src[2288] / FRAC_SCALE ,
-			lut_src[2289] / FRAC_SCALE ,
-			lut_src[2290] / FRAC_SCALE ,
-			lut_src[2291] / FRAC_SCALE ,
-			lut_src[2292] / FRAC_SCALE ,
-			lut_src[2293] / FRAC_SCALE ,
-			lut_src[2294] / FRAC_SCALE ,
-			lut_src[2295] / FRAC_SCALE ,
-			lut_src[2296] / FRAC_SCALE ,
-			lut_src[2297] / FRAC_SCALE ,
-			lut_src[2298] / FRAC_SCALE ,
-			lut_src[2299] / FRAC_SCALE ,
-			lut_src[2300] / FRAC_SCALE ,
-			lut_src[2301] / FRAC_SCALE ,
-			lut_src[2302] / FRAC_SCALE ,
-			lut_src[2303] / FRAC_SCALE ,
-			lut_src[2304] / FRAC_SCALE ,
-			lut_src[2305] / FRAC_SCALE ,
-			lut_src[2306] / FRAC_SCALE ,
-			lut_src[2307] / FRAC_SCALE ,
-			lut_src[2308] / FRAC_SCALE ,
-			lut_src[2309] / FRAC_SCALE ,
-			lut_src[2310] / FRAC_SCALE ,
-			lut_src[2311] / FRAC_SCALE ,
-			lut_src[2312] / FRAC_SCALE ,
-			lut_src[2313] / FRAC_SCALE ,
-			lut_src[2314] / FRAC_SCALE ,
-			lut_src[2315] / FRAC_SCALE ,
-			lut_src[2316] / FRAC_SCALE ,
-			lut_src[2317] / FRAC_SCALE ,
-			lut_src[2318] / FRAC_SCALE ,
-			lut_src[2319] / FRAC_SCALE ,
-			lut_src[2320] / FRAC_SCALE ,
-			lut_src[2321] / FRAC_SCALE ,
-			lut_src[2322] / FRAC_SCALE ,
-			lut_src[2323] / FRAC_SCALE ,
-			lut_src[2324] / FRAC_SCALE ,
-			lut_src[2325] / FRAC_SCALE ,
-			lut_src[2326] / FRAC_SCALE ,
-			lut_src[2327] / FRAC_SCALE ,
-			lut_src[2328] / FRAC_SCALE ,
-			lut_src[2329] / FRAC_SCALE ,
-			lut_src[2330] / FRAC_SCALE ,
-			lut_src[2331] / FRAC_SCALE ,
-			lut_src[2332] / FRAC_SCALE ,
-			lut_src[2333] / FRAC_SCALE ,
-			lut_src[2334] / FRAC_SCALE ,
-			lut_src[2335] / FRAC_SCALE ,
-			lut_src[2336] / FRAC_SCALE ,
-			lut_src[2337] / FRAC_SCALE ,
-			lut_src[2338] / FRAC_SCALE ,
-			lut_src[2339] / FRAC_SCALE ,
-			lut_src[2340] / FRAC_SCALE ,
-			lut_src[2341] / FRAC_SCALE ,
-			lut_src[2342] / FRAC_SCALE ,
-			lut_src[2343] / FRAC_SCALE ,
-			lut_src[2344] / FRAC_SCALE ,
-			lut_src[2345] / FRAC_SCALE ,
-			lut_src[2346] / FRAC_SCALE ,
-			lut_src[2347] / FRAC_SCALE ,
-			lut_src[2348] / FRAC_SCALE ,
-			lut_src[2349] / FRAC_SCALE ,
-			lut_src[2350] / FRAC_SCALE ,
-			lut_src[2351] / FRAC_SCALE ,
-			lut_src[2352] / FRAC_SCALE ,
-			lut_src[2353] / FRAC_SCALE ,
-			lut_src[2354] / FRAC_SCALE ,
-			lut_src[2355] / FRAC_SCALE ,
-			lut_src[2356] / FRAC_SCALE ,
-			lut_src[2357] / FRAC_SCALE ,
-			lut_src[2358] / FRAC_SCALE ,
-			lut_src[2359] / FRAC_SCALE ,
-			lut_src[2360] / FRAC_SCALE ,
-			lut_src[2361] / FRAC_SCALE ,
-			lut_src[2362] / FRAC_SCALE ,
-			lut_src[2363] / FRAC_SCALE ,
-			lut_src[2364] / FRAC_SCALE ,
-			lut_src[2365] / FRAC_SCALE ,
-			lut_src[2366] / FRAC_SCALE ,
-			lut_src[2367] / FRAC_SCALE ,
-			lut_src[2368] / FRAC_SCALE ,
-			lut_src[2369] / FRAC_SCALE ,
-			lut_src[2370] / FRAC_SCALE ,
-			lut_src[2371] / FRAC_SCALE ,
-			lut_src[2372] / FRAC_SCALE ,
-			lut_src[2373] / FRAC_SCALE ,
-			lut_src[2374] / FRAC_SCALE ,
-			lut_src[2375] / FRAC_SCALE ,
-			lut_src[2376] / FRAC_SCALE ,
-			lut_src[2377] / FRAC_SCALE ,
-			lut_src[2378] / FRAC_SCALE ,
-			lut_src[2379] / FRAC_SCALE ,
-			lut_src[2380] / FRAC_SCALE ,
-			lut_src[2381] / FRAC_SCALE ,
-			lut_src[2382] / FRAC_SCALE ,
-			lut_src[2383] / FRAC_SCALE ,
-			lut_src[2384] / FRAC_SCALE ,
-			lut_src[2385] / FRAC_SCALE ,
-			lut_src[2386] / FRAC_SCALE ,
-			lut_src[2387] / FRAC_SCALE ,
-			lut_src[2388] / FRAC_SCALE ,
-			lut_src[2389] / FRAC_SCALE ,
-			lut_src[2390] / FRAC_SCALE ,
-			lut_src[2391] / FRAC_SCALE ,
-			lut_src[2392] / FRAC_SCALE ,
-			lut_src[2393] / FRAC_SCALE ,
-			lut_src[2394] / FRAC_SCALE ,
-			lut_src[2395] / FRAC_SCALE ,
-			lut_src[2396] / FRAC_SCALE ,
-			lut_src[2397] / FRAC_SCALE ,
-			lut_src[2398] / FRAC_SCALE ,
-			lut_src[2399] / FRAC_SCALE ,
-			lut_src[2400] / FRAC_SCALE ,
-			lut_src[2401] / FRAC_SCALE ,
-			lut_src[2402] / FRAC_SCALE ,
-			lut_src[2403] / FRAC_SCALE ,
-			lut_src[2404] / FRAC_SCALE ,
-			lut_src[2405] / FRAC_SCALE ,
-			lut_src[2406] / FRAC_SCALE ,
-			lut_src[2407] / FRAC_SCALE ,
-			lut_src[2408] / FRAC_SCALE ,
-			lut_src[2409] / FRAC_SCALE ,
-			lut_src[2410] / FRAC_SCALE ,
-			lut_src[2411] / FRAC_SCALE ,
-			lut_src[2412] / FRAC_SCALE ,
-			lut_src[2413] / FRAC_SCALE ,
-			lut_src[2414] / FRAC_SCALE ,
-			lut_src[2415] / FRAC_SCALE ,
-			lut_src[2416] / FRAC_SCALE ,
-			lut_src[2417] / FRAC_SCALE ,
-			lut_src[2418] / FRAC_SCALE ,
-			lut_src[2419] / FRAC_SCALE ,
-			lut_src[2420] / FRAC_SCALE ,
-			lut_src[2421] / FRAC_SCALE ,
-			lut_src[2422] / FRAC_SCALE ,
-			lut_src[2423] / FRAC_SCALE ,
-			lut_src[2424] / FRAC_SCALE ,
-			lut_src[2425] / FRAC_SCALE ,
-			lut_src[2426] / FRAC_SCALE ,
-			lut_src[2427] / FRAC_SCALE ,
-			lut_src[2428] / FRAC_SCALE ,
-			lut_src[2429] / FRAC_SCALE ,
-			lut_src[2430] / FRAC_SCALE ,
-			lut_src[2431] / FRAC_SCALE ,
-			lut_src[2432] / FRAC_SCALE ,
-			lut_src[2433] / FRAC_SCALE ,
-			lut_src[2434] / FRAC_SCALE ,
-			lut_src[2435] / FRAC_SCALE ,
-			lut_src[2436] / FRAC_SCALE ,
-			lut_src[2437] / FRAC_SCALE ,
-			lut_src[2438] / FRAC_SCALE ,
-			lut_src[2439] / FRAC_SCALE ,
-			lut_src[2440] / FRAC_SCALE ,
-			lut_src[2441] / FRAC_SCALE ,
-			lut_src[2442] / FRAC_SCALE ,
-			lut_src[2443] / FRAC_SCALE ,
-			lut_src[2444] / FRAC_SCALE ,
-			lut_src[2445] / FRAC_SCALE ,
-			lut_src[2446] / FRAC_SCALE ,
-			lut_src[2447] / FRAC_SCALE ,
-			lut_src[2448] / FRAC_SCALE ,
-			lut_src[2449] / FRAC_SCALE ,
-			lut_src[2450] / FRAC_SCALE ,
-			lut_src[2451] / FRAC_SCALE ,
-			lut_src[2452] / FRAC_SCALE ,
-			lut_src[2453] / FRAC_SCALE ,
-			lut_src[2454] / FRAC_SCALE ,
-			lut_src[2455] / FRAC_SCALE ,
-			lut_src[2456] / FRAC_SCALE ,
-			lut_src[2457] / FRAC_SCALE ,
-			lut_src[2458] / FRAC_SCALE ,
-			lut_src[2459] / FRAC_SCALE ,
-			lut_src[2460] / FRAC_SCALE ,
-			lut_src[2461] / FRAC_SCALE ,
-			lut_src[2462] / FRAC_SCALE ,
-			lut_src[2463] / FRAC_SCALE ,
-			lut_src[2464] / FRAC_SCALE ,
-			lut_src[2465] / FRAC_SCALE ,
-			lut_src[2466] / FRAC_SCALE ,
-			lut_src[2467] / FRAC_SCALE ,
-			lut_src[2468] / FRAC_SCALE ,
-			lut_src[2469] / FRAC_SCALE ,
-			lut_src[2470] / FRAC_SCALE ,
-			lut_src[2471] / FRAC_SCALE ,
-			lut_src[2472] / FRAC_SCALE ,
-			lut_src[2473] / FRAC_SCALE ,
-			lut_src[2474] / FRAC_SCALE ,
-			lut_src[2475] / FRAC_SCALE ,
-			lut_src[2476] / FRAC_SCALE ,
-			lut_src[2477] / FRAC_SCALE ,
-			lut_src[2478] / FRAC_SCALE ,
-			lut_src[2479] / FRAC_SCALE ,
-			lut_src[2480] / FRAC_SCALE ,
-			lut_src[2481] / FRAC_SCALE ,
-			lut_src[2482] / FRAC_SCALE ,
-			lut_src[2483] / FRAC_SCALE ,
-			lut_src[2484] / FRAC_SCALE ,
-			lut_src[2485] / FRAC_SCALE ,
-			lut_src[2486] / FRAC_SCALE ,
-			lut_src[2487] / FRAC_SCALE ,
-			lut_src[2488] / FRAC_SCALE ,
-			lut_src[2489] / FRAC_SCALE ,
-			lut_src[2490] / FRAC_SCALE ,
-			lut_src[2491] / FRAC_SCALE ,
-			lut_src[2492] / FRAC_SCALE ,
-			lut_src[2493] / FRAC_SCALE ,
-			lut_src[2494] / FRAC_SCALE ,
-			lut_src[2495] / FRAC_SCALE ,
-			lut_src[2496] / FRAC_SCALE ,
-			lut_src[2497] / FRAC_SCALE ,
-			lut_src[2498] / FRAC_SCALE ,
-			lut_src[2499] / FRAC_SCALE ,
-			lut_src[2500] / FRAC_SCALE ,
-			lut_src[2501] / FRAC_SCALE ,
-			lut_src[2502] / FRAC_SCALE ,
-			lut_src[2503] / FRAC_SCALE ,
-			lut_src[2504] / FRAC_SCALE ,
-			lut_src[2505] / FRAC_SCALE ,
-			lut_src[2506] / FRAC_SCALE ,
-			lut_src[2507] / FRAC_SCALE ,
-			lut_src[2508] / FRAC_SCALE ,
-			lut_src[2509] / FRAC_SCALE ,
-			lut_src[2510] / FRAC_SCALE ,
-			lut_src[2511] / FRAC_SCALE ,
-			lut_src[2512] / FRAC_SCALE ,
-			lut_src[2513] / FRAC_SCALE ,
-			lut_src[2514] / FRAC_SCALE ,
-			lut_src[2515] / FRAC_SCALE ,
-			lut_src[2516] / FRAC_SCALE ,
-			lut_src[2517] / FRAC_SCALE ,
-			lut_src[2518] / FRAC_SCALE ,
-			lut_src[2519] / FRAC_SCALE ,
-			lut_src[2520] / FRAC_SCALE ,
-			lut_src[2521] / FRAC_SCALE ,
-			lut_src[2522] / FRAC_SCALE ,
-			lut_src[2523] / FRAC_SCALE ,
-			lut_src[2524] / FRAC_SCALE ,
-			lut_src[2525] / FRAC_SCALE ,
-			lut_src[2526] / FRAC_SCALE ,
-			lut_src[2527] / FRAC_SCALE ,
-			lut_src[2528] / FRAC_SCALE ,
-			lut_src[2529] / FRAC_SCALE ,
-			lut_src[2530] / FRAC_SCALE ,
-			lut_src[2531] / FRAC_SCALE ,
-			lut_src[2532] / FRAC_SCALE ,
-			lut_src[2533] / FRAC_SCALE ,
-			lut_src[2534] / FRAC_SCALE ,
-			lut_src[2535] / FRAC_SCALE ,
-			lut_src[2536] / FRAC_SCALE ,
-			lut_src[2537] / FRAC_SCALE ,
-			lut_src[2538] / FRAC_SCALE ,
-			lut_src[2539] / FRAC_SCALE ,
-			lut_src[2540] / FRAC_SCALE ,
-			lut_src[2541] / FRAC_SCALE ,
-			lut_src[2542] / FRAC_SCALE ,
-			lut_src[2543] / FRAC_SCALE ,
-			lut_src[2544] / FRAC_SCALE ,
-			lut_src[2545] / FRAC_SCALE ,
-			lut_src[2546] / FRAC_SCALE ,
-			lut_src[2547] / FRAC_SCALE ,
-			lut_src[2548] / FRAC_SCALE ,
-			lut_src[2549] / FRAC_SCALE ,
-			lut_src[2550] / FRAC_SCALE ,
-			lut_src[2551] / FRAC_SCALE ,
-			lut_src[2552] / FRAC_SCALE ,
-			lut_src[2553] / FRAC_SCALE ,
-			lut_src[2554] / FRAC_SCALE ,
-			lut_src[2555] / FRAC_SCALE ,
-			lut_src[2556] / FRAC_SCALE ,
-			lut_src[2557] / FRAC_SCALE ,
-			lut_src[2558] / FRAC_SCALE ,
-			lut_src[2559] / FRAC_SCALE ,
-			lut_src[2560] / FRAC_SCALE ,
-			lut_src[2561] / FRAC_SCALE ,
-			lut_src[2562] / FRAC_SCALE ,
-			lut_src[2563] / FRAC_SCALE ,
-			lut_src[2564] / FRAC_SCALE ,
-			lut_src[2565] / FRAC_SCALE ,
-			lut_src[2566] / FRAC_SCALE ,
-			lut_src[2567] / FRAC_SCALE ,
-			lut_src[2568] / FRAC_SCALE ,
-			lut_src[2569] / FRAC_SCALE ,
-			lut_src[2570] / FRAC_SCALE ,
-			lut_src[2571] / FRAC_SCALE ,
-			lut_src[2572] / FRAC_SCALE ,
-			lut_src[2573] / FRAC_SCALE ,
-			lut_src[2574] / FRAC_SCALE ,
-			lut_src[2575] / FRAC_SCALE ,
-			lut_src[2576] / FRAC_SCALE ,
-			lut_src[2577] / FRAC_SCALE ,
-			lut_src[2578] / FRAC_SCALE ,
-			lut_src[2579] / FRAC_SCALE ,
-			lut_src[2580] / FRAC_SCALE ,
-			lut_src[2581] / FRAC_SCALE ,
-			lut_src[2582] / FRAC_SCALE ,
-			lut_src[2583] / FRAC_SCALE ,
-			lut_src[2584] / FRAC_SCALE ,
-			lut_src[2585] / FRAC_SCALE ,
-			lut_src[2586] / FRAC_SCALE ,
-			lut_src[2587] / FRAC_SCALE ,
-			lut_src[2588] / FRAC_SCALE ,
-			lut_src[2589] / FRAC_SCALE ,
-			lut_src[2590] / FRAC_SCALE ,
-			lut_src[2591] / FRAC_SCALE ,
-			lut_src[2592] / FRAC_SCALE ,
-			lut_src[2593] / FRAC_SCALE ,
-			lut_src[2594] / FRAC_SCALE ,
-			lut_src[2595] / FRAC_SCALE ,
-			lut_src[2596] / FRAC_SCALE ,
-			lut_src[2597] / FRAC_SCALE ,
-			lut_src[2598] / FRAC_SCALE ,
-			lut_src[2599] / FRAC_SCALE ,
-			lut_src[2600] / FRAC_SCALE ,
-			lut_src[2601] / FRAC_SCALE ,
-			lut_src[2602] / FRAC_SCALE ,
-			lut_src[2603] / FRAC_SCALE ,
-			lut_src[2604] / FRAC_SCALE ,
-			lut_src[2605] / FRAC_SCALE ,
-			lut_src[2606] / FRAC_SCALE ,
-			lut_src[2607] / FRAC_SCALE ,
-			lut_src[2608] / FRAC_SCALE ,
-			lut_src[2609] / FRAC_SCALE ,
-			lut_src[2610] / FRAC_SCALE ,
-			lut_src[2611] / FRAC_SCALE ,
-			lut_src[2612] / FRAC_SCALE ,
-			lut_src[2613] / FRAC_SCALE ,
-			lut_src[2614] / FRAC_SCALE ,
-			lut_src[2615] / FRAC_SCALE ,
-			lut_src[2616] / FRAC_SCALE ,
-			lut_src[2617] / FRAC_SCALE ,
-			lut_src[2618] / FRAC_SCALE ,
-			lut_src[2619] / FRAC_SCALE ,
-			lut_src[2620] / FRAC_SCALE ,
-			lut_src[2621] / FRAC_SCALE ,
-			lut_src[2622] / FRAC_SCALE ,
-			lut_src[2623] / FRAC_SCALE ,
-			lut_src[2624] / FRAC_SCALE ,
-			lut_src[2625] / FRAC_SCALE ,
-			lut_src[2626] / FRAC_SCALE ,
-			lut_src[2627] / FRAC_SCALE ,
-			lut_src[2628] / FRAC_SCALE ,
-			lut_src[2629] / FRAC_SCALE ,
-			lut_src[2630] / FRAC_SCALE ,
-			lut_src[2631] / FRAC_SCALE ,
-			lut_src[2632] / FRAC_SCALE ,
-			lut_src[2633] / FRAC_SCALE ,
-			lut_src[2634] / FRAC_SCALE ,
-			lut_src[2635] / FRAC_SCALE ,
-			lut_src[2636] / FRAC_SCALE ,
-			lut_src[2637] / FRAC_SCALE ,
-			lut_src[2638] / FRAC_SCALE ,
-			lut_src[2639] / FRAC_SCALE ,
-			lut_src[2640] / FRAC_SCALE ,
-			lut_src[2641] / FRAC_SCALE ,
-			lut_src[2642] / FRAC_SCALE ,
-			lut_src[2643] / FRAC_SCALE ,
-			lut_src[2644] / FRAC_SCALE ,
-			lut_src[2645] / FRAC_SCALE ,
-			lut_src[2646] / FRAC_SCALE ,
-			lut_src[2647] / FRAC_SCALE ,
-			lut_src[2648] / FRAC_SCALE ,
-			lut_src[2649] / FRAC_SCALE ,
-			lut_src[2650] / FRAC_SCALE ,
-			lut_src[2651] / FRAC_SCALE ,
-			lut_src[2652] / FRAC_SCALE ,
-			lut_src[2653] / FRAC_SCALE ,
-			lut_src[2654] / FRAC_SCALE ,
-			lut_src[2655] / FRAC_SCALE ,
-			lut_src[2656] / FRAC_SCALE ,
-			lut_src[2657] / FRAC_SCALE ,
-			lut_src[2658] / FRAC_SCALE ,
-			lut_src[2659] / FRAC_SCALE ,
-			lut_src[2660] / FRAC_SCALE ,
-			lut_src[2661] / FRAC_SCALE ,
-			lut_src[2662] / FRAC_SCALE ,
-			lut_src[2663] / FRAC_SCALE ,
-			lut_src[2664] / FRAC_SCALE ,
-			lut_src[2665] / FRAC_SCALE ,
-			lut_src[2666] / FRAC_SCALE ,
-			lut_src[2667] / FRAC_SCALE ,
-			lut_src[2668] / FRAC_SCALE ,
-			lut_src[2669] / FRAC_SCALE ,
-			lut_src[2670] / FRAC_SCALE ,
-			lut_src[2671] / FRAC_SCALE ,
-			lut_src[2672] / FRAC_SCALE ,
-			lut_src[2673] / FRAC_SCALE ,
-			lut_src[2674] / FRAC_SCALE ,
-			lut_src[2675] / FRAC_SCALE ,
-			lut_src[2676] / FRAC_SCALE ,
-			lut_src[2677] / FRAC_SCALE ,
-			lut_src[2678] / FRAC_SCALE ,
-			lut_src[2679] / FRAC_SCALE ,
-			lut_src[2680] / FRAC_SCALE ,
-			lut_src[2681] / FRAC_SCALE ,
-			lut_src[2682] / FRAC_SCALE ,
-			lut_src[2683] / FRAC_SCALE ,
-			lut_src[2684] / FRAC_SCALE ,
-			lut_src[2685] / FRAC_SCALE ,
-			lut_src[2686] / FRAC_SCALE ,
-			lut_src[2687] / FRAC_SCALE ,
-			lut_src[2688] / FRAC_SCALE ,
-			lut_src[2689] / FRAC_SCALE ,
-			lut_src[2690] / FRAC_SCALE ,
-			lut_src[2691] / FRAC_SCALE ,
-			lut_src[2692] / FRAC_SCALE ,
-			lut_src[2693] / FRAC_SCALE ,
-			lut_src[2694] / FRAC_SCALE ,
-			lut_src[2695] / FRAC_SCALE ,
-			lut_src[2696] / FRAC_SCALE ,
-			lut_src[2697] / FRAC_SCALE ,
-			lut_src[2698] / FRAC_SCALE ,
-			lut_src[2699] / FRAC_SCALE ,
-			lut_src[2700] / FRAC_SCALE ,
-			lut_src[2701] / FRAC_SCALE ,
-			lut_src[2702] / FRAC_SCALE ,
-			lut_src[2703] / FRAC_SCALE ,
-			lut_src[2704] / FRAC_SCALE ,
-			lut_src[2705] / FRAC_SCALE ,
-			lut_src[2706] / FRAC_SCALE ,
-			lut_src[2707] / FRAC_SCALE ,
-			lut_src[2708] / FRAC_SCALE ,
-			lut_src[2709] / FRAC_SCALE ,
-			lut_src[2710] / FRAC_SCALE ,
-			lut_src[2711] / FRAC_SCALE ,
-			lut_src[2712] / FRAC_SCALE ,
-			lut_src[2713] / FRAC_SCALE ,
-			lut_src[2714] / FRAC_SCALE ,
-			lut_src[2715] / FRAC_SCALE ,
-			lut_src[2716] / FRAC_SCALE ,
-			lut_src[2717] / FRAC_SCALE ,
-			lut_src[2718] / FRAC_SCALE ,
-			lut_src[2719] / FRAC_SCALE ,
-			lut_src[2720] / FRAC_SCALE ,
-			lut_src[2721] / FRAC_SCALE ,
-			lut_src[2722] / FRAC_SCALE ,
-			lut_src[2723] / FRAC_SCALE ,
-			lut_src[2724] / FRAC_SCALE ,
-			lut_src[2725] / FRAC_SCALE ,
-			lut_src[2726] / FRAC_SCALE ,
-			lut_src[2727] / FRAC_SCALE ,
-			lut_src[2728] / FRAC_SCALE ,
-			lut_src[2729] / FRAC_SCALE ,
-			lut_src[2730] / FRAC_SCALE ,
-			lut_src[2731] / FRAC_SCALE ,
-			lut_src[2732] / FRAC_SCALE ,
-			lut_src[2733] / FRAC_SCALE ,
-			lut_src[2734] / FRAC_SCALE ,
-			lut_src[2735] / FRAC_SCALE ,
-			lut_src[2736] / FRAC_SCALE ,
-			lut_src[2737] / FRAC_SCALE ,
-			lut_src[2738] / FRAC_SCALE ,
-			lut_src[2739] / FRAC_SCALE ,
-			lut_src[2740] / FRAC_SCALE ,
-			lut_src[2741] / FRAC_SCALE ,
-			lut_src[2742] / FRAC_SCALE ,
-			lut_src[2743] / FRAC_SCALE ,
-			lut_src[2744] / FRAC_SCALE ,
-			lut_src[2745] / FRAC_SCALE ,
-			lut_src[2746] / FRAC_SCALE ,
-			lut_src[2747] / FRAC_SCALE ,
-			lut_src[2748] / FRAC_SCALE ,
-			lut_src[2749] / FRAC_SCALE ,
-			lut_src[2750] / FRAC_SCALE ,
-			lut_src[2751] / FRAC_SCALE ,
-			lut_src[2752] / FRAC_SCALE ,
-			lut_src[2753] / FRAC_SCALE ,
-			lut_src[2754] / FRAC_SCALE ,
-			lut_src[2755] / FRAC_SCALE ,
-			lut_src[2756] / FRAC_SCALE ,
-			lut_src[2757] / FRAC_SCALE ,
-			lut_src[2758] / FRAC_SCALE ,
-			lut_src[2759] / FRAC_SCALE ,
-			lut_src[2760] / FRAC_SCALE ,
-			lut_src[2761] / FRAC_SCALE ,
-			lut_src[2762] / FRAC_SCALE ,
-			lut_src[2763] / FRAC_SCALE ,
-			lut_src[2764] / FRAC_SCALE ,
-			lut_src[2765] / FRAC_SCALE ,
-			lut_src[2766] / FRAC_SCALE ,
-			lut_src[2767] / FRAC_SCALE ,
-			lut_src[2768] / FRAC_SCALE ,
-			lut_src[2769] / FRAC_SCALE ,
-			lut_src[2770] / FRAC_SCALE ,
-			lut_src[2771] / FRAC_SCALE ,
-			lut_src[2772] / FRAC_SCALE ,
-			lut_src[2773] / FRAC_SCALE ,
-			lut_src[2774] / FRAC_SCALE ,
-			lut_src[2775] / FRAC_SCALE ,
-			lut_src[2776] / FRAC_SCALE ,
-			lut_src[2777] / FRAC_SCALE ,
-			lut_src[2778] / FRAC_SCALE ,
-			lut_src[2779] / FRAC_SCALE ,
-			lut_src[2780] / FRAC_SCALE ,
-			lut_src[2781] / FRAC_SCALE ,
-			lut_src[2782] / FRAC_SCALE ,
-			lut_src[2783] / FRAC_SCALE ,
-			lut_src[2784] / FRAC_SCALE ,
-			lut_src[2785] / FRAC_SCALE ,
-			lut_src[2786] / FRAC_SCALE ,
-			lut_src[2787] / FRAC_SCALE ,
-			lut_src[2788] / FRAC_SCALE ,
-			lut_src[2789] / FRAC_SCALE ,
-			lut_src[2790] / FRAC_SCALE ,
-			lut_src[2791] / FRAC_SCALE ,
-			lut_src[2792] / FRAC_SCALE ,
-			lut_src[2793] / FRAC_SCALE ,
-			lut_src[2794] / FRAC_SCALE ,
-			lut_src[2795] / FRAC_SCALE ,
-			lut_src[2796] / FRAC_SCALE ,
-			lut_src[2797] / FRAC_SCALE ,
-			lut_src[2798] / FRAC_SCALE ,
-			lut_src[2799] / FRAC_SCALE ,
-			lut_src[2800] / FRAC_SCALE ,
-			lut_src[2801] / FRAC_SCALE ,
-			lut_src[2802] / FRAC_SCALE ,
-			lut_src[2803] / FRAC_SCALE ,
-			lut_src[2804] / FRAC_SCALE ,
-			lut_src[2805] / FRAC_SCALE ,
-			lut_src[2806] / FRAC_SCALE ,
-			lut_src[2807] / FRAC_SCALE ,
-			lut_src[2808] / FRAC_SCALE ,
-			lut_src[2809] / FRAC_SCALE ,
-			lut_src[2810] / FRAC_SCALE ,
-			lut_src[2811] / FRAC_SCALE ,
-			lut_src[2812] / FRAC_SCALE ,
-			lut_src[2813] / FRAC_SCALE ,
-			lut_src[2814] / FRAC_SCALE ,
-			lut_src[2815] / FRAC_SCALE ,
-			lut_src[2816] / FRAC_SCALE ,
-			lut_src[2817] / FRAC_SCALE ,
-			lut_src[2818] / FRAC_SCALE ,
-			lut_src[2819] / FRAC_SCALE ,
-			lut_src[2820] / FRAC_SCALE ,
-			lut_src[2821] / FRAC_SCALE ,
-			lut_src[2822] / FRAC_SCALE ,
-			lut_src[2823] / FRAC_SCALE ,
-			lut_src[2824] / FRAC_SCALE ,
-			lut_src[2825] / FRAC_SCALE ,
-			lut_src[2826] / FRAC_SCALE ,
-			lut_src[2827] / FRAC_SCALE ,
-			lut_src[2828] / FRAC_SCALE ,
-			lut_src[2829] / FRAC_SCALE ,
-			lut_src[2830] / FRAC_SCALE ,
-			lut_src[2831] / FRAC_SCALE ,
-			lut_src[2832] / FRAC_SCALE ,
-			lut_src[2833] / FRAC_SCALE ,
-			lut_src[2834] / FRAC_SCALE ,
-			lut_src[2835] / FRAC_SCALE ,
-			lut_src[2836] / FRAC_SCALE ,
-			lut_src[2837] / FRAC_SCALE ,
-			lut_src[2838] / FRAC_SCALE ,
-			lut_src[2839] / FRAC_SCALE ,
-			lut_src[2840] / FRAC_SCALE ,
-			lut_src[2841] / FRAC_SCALE ,
-			lut_src[2842] / FRAC_SCALE ,
-			lut_src[2843] / FRAC_SCALE ,
-			lut_src[2844] / FRAC_SCALE ,
-			lut_src[2845] / FRAC_SCALE ,
-			lut_src[2846] / FRAC_SCALE ,
-			lut_src[2847] / FRAC_SCALE ,
-			lut_src[2848] / FRAC_SCALE ,
-			lut_src[2849] / FRAC_SCALE ,
-			lut_src[2850] / FRAC_SCALE ,
-			lut_src[2851] / FRAC_SCALE ,
-			lut_src[2852] / FRAC_SCALE ,
-			lut_src[2853] / FRAC_SCALE ,
-			lut_src[2854] / FRAC_SCALE ,
-			lut_src[2855] / FRAC_SCALE ,
-			lut_src[2856] / FRAC_SCALE ,
-			lut_src[2857] / FRAC_SCALE ,
-			lut_src[2858] / FRAC_SCALE ,
-			lut_src[2859] / FRAC_SCALE ,
-			lut_src[2860] / FRAC_SCALE ,
-			lut_src[2861] / FRAC_SCALE ,
-			lut_src[2862] / FRAC_SCALE ,
-			lut_src[2863] / FRAC_SCALE ,
-			lut_src[2864] / FRAC_SCALE ,
-			lut_src[2865] / FRAC_SCALE ,
-			lut_src[2866] / FRAC_SCALE ,
-			lut_src[2867] / FRAC_SCALE ,
-			lut_src[2868] / FRAC_SCALE ,
-			lut_src[2869] / FRAC_SCALE ,
-			lut_src[2870] / FRAC_SCALE ,
-			lut_src[2871] / FRAC_SCALE ,
-			lut_src[2872] / FRAC_SCALE ,
-			lut_src[2873] / FRAC_SCALE ,
-			lut_src[2874] / FRAC_SCALE ,
-			lut_src[2875] / FRAC_SCALE ,
-			lut_src[2876] / FRAC_SCALE ,
-			lut_src[2877] / FRAC_SCALE ,
-			lut_src[2878] / FRAC_SCALE ,
-			lut_src[2879] / FRAC_SCALE ,
-			lut_src[2880] / FRAC_SCALE ,
-			lut_src[2881] / FRAC_SCALE ,
-			lut_src[2882] / FRAC_SCALE ,
-			lut_src[2883] / FRAC_SCALE ,
-			lut_src[2884] / FRAC_SCALE ,
-			lut_src[2885] / FRAC_SCALE ,
-			lut_src[2886] / FRAC_SCALE ,
-			lut_src[2887] / FRAC_SCALE ,
-			lut_src[2888] / FRAC_SCALE ,
-			lut_src[2889] / FRAC_SCALE ,
-			lut_src[2890] / FRAC_SCALE ,
-			lut_src[2891] / FRAC_SCALE ,
-			lut_src[2892] / FRAC_SCALE ,
-			lut_src[2893] / FRAC_SCALE ,
-			lut_src[2894] / FRAC_SCALE ,
-			lut_src[2895] / FRAC_SCALE ,
-			lut_src[2896] / FRAC_SCALE ,
-			lut_src[2897] / FRAC_SCALE ,
-			lut_src[2898] / FRAC_SCALE ,
-			lut_src[2899] / FRAC_SCALE ,
-			lut_src[2900] / FRAC_SCALE ,
-			lut_src[2901] / FRAC_SCALE ,
-			lut_src[2902] / FRAC_SCALE ,
-			lut_src[2903] / FRAC_SCALE ,
-			lut_src[2904] / FRAC_SCALE ,
-			lut_src[2905] / FRAC_SCALE ,
-			lut_src[2906] / FRAC_SCALE ,
-			lut_src[2907] / FRAC_SCALE ,
-			lut_src[2908] / FRAC_SCALE ,
-			lut_src[2909] / FRAC_SCALE ,
-			lut_src[2910] / FRAC_SCALE ,
-			lut_src[2911] / FRAC_SCALE ,
-			lut_src[2912] / FRAC_SCALE ,
-			lut_src[2913] / FRAC_SCALE ,
-			lut_src[2914] / FRAC_SCALE ,
-			lut_src[2915] / FRAC_SCALE ,
-			lut_src[2916] / FRAC_SCALE ,
-			lut_src[2917] / FRAC_SCALE ,
-			lut_src[2918] / FRAC_SCALE ,
-			lut_src[2919] / FRAC_SCALE ,
-			lut_src[2920] / FRAC_SCALE ,
-			lut_src[2921] / FRAC_SCALE ,
-			lut_src[2922] / FRAC_SCALE ,
-			lut_src[2923] / FRAC_SCALE ,
-			lut_src[2924] / FRAC_SCALE ,
-			lut_src[2925] / FRAC_SCALE ,
-			lut_src[2926] / FRAC_SCALE ,
-			lut_src[2927] / FRAC_SCALE ,
-			lut_src[2928] / FRAC_SCALE ,
-			lut_src[2929] / FRAC_SCALE ,
-			lut_src[2930] / FRAC_SCALE ,
-			lut_src[2931] / FRAC_SCALE ,
-			lut_src[2932] / FRAC_SCALE ,
-			lut_src[2933] / FRAC_SCALE ,
-			lut_src[2934] / FRAC_SCALE ,
-			lut_src[2935] / FRAC_SCALE ,
-			lut_src[2936] / FRAC_SCALE ,
-			lut_src[2937] / FRAC_SCALE ,
-			lut_src[2938] / FRAC_SCALE ,
-			lut_src[2939] / FRAC_SCALE ,
-			lut_src[2940] / FRAC_SCALE ,
-			lut_src[2941] / FRAC_SCALE ,
-			lut_src[2942] / FRAC_SCALE ,
-			lut_src[2943] / FRAC_SCALE ,
-			lut_src[2944] / FRAC_SCALE ,
-			lut_src[2945] / FRAC_SCALE ,
-			lut_src[2946] / FRAC_SCALE ,
-			lut_src[2947] / FRAC_SCALE ,
-			lut_src[2948] / FRAC_SCALE ,
-			lut_src[2949] / FRAC_SCALE ,
-			lut_src[2950] / FRAC_SCALE ,
-			lut_src[2951] / FRAC_SCALE ,
-			lut_src[2952] / FRAC_SCALE ,
-			lut_src[2953] / FRAC_SCALE ,
-			lut_src[2954] / FRAC_SCALE ,
-			lut_src[2955] / FRAC_SCALE ,
-			lut_src[2956] / FRAC_SCALE ,
-			lut_src[2957] / FRAC_SCALE ,
-			lut_src[2958] / FRAC_SCALE ,
-			lut_src[2959] / FRAC_SCALE ,
-			lut_src[2960] / FRAC_SCALE ,
-			lut_src[2961] / FRAC_SCALE ,
-			lut_src[2962] / FRAC_SCALE ,
-			lut_src[2963] / FRAC_SCALE ,
-			lut_src[2964] / FRAC_SCALE ,
-			lut_src[2965] / FRAC_SCALE ,
-			lut_src[2966] / FRAC_SCALE ,
-			lut_src[2967] / FRAC_SCALE ,
-			lut_src[2968] / FRAC_SCALE ,
-			lut_src[2969] / FRAC_SCALE ,
-			lut_src[2970] / FRAC_SCALE ,
-			lut_src[2971] / FRAC_SCALE ,
-			lut_src[2972] / FRAC_SCALE ,
-			lut_src[2973] / FRAC_SCALE ,
-			lut_src[2974] / FRAC_SCALE ,
-			lut_src[2975] / FRAC_SCALE ,
-			lut_src[2976] / FRAC_SCALE ,
-			lut_src[2977] / FRAC_SCALE ,
-			lut_src[2978] / FRAC_SCALE ,
-			lut_src[2979] / FRAC_SCALE ,
-			lut_src[2980] / FRAC_SCALE ,
-			lut_src[2981] / FRAC_SCALE ,
-			lut_src[2982] / FRAC_SCALE ,
-			lut_src[2983] / FRAC_SCALE ,
-			lut_src[2984] / FRAC_SCALE ,
-			lut_src[2985] / FRAC_SCALE ,
-			lut_src[2986] / FRAC_SCALE ,
-			lut_src[2987] / FRAC_SCALE ,
-			lut_src[2988] / FRAC_SCALE ,
-			lut_src[2989] / FRAC_SCALE ,
-			lut_src[2990] / FRAC_SCALE ,
-			lut_src[2991] / FRAC_SCALE ,
-			lut_src[2992] / FRAC_SCALE ,
-			lut_src[2993] / FRAC_SCALE ,
-			lut_src[2994] / FRAC_SCALE ,
-			lut_src[2995] / FRAC_SCALE ,
-			lut_src[2996] / FRAC_SCALE ,
-			lut_src[2997] / FRAC_SCALE ,
-			lut_src[2998] / FRAC_SCALE ,
-			lut_src[2999] / FRAC_SCALE ,
-			lut_src[3000] / FRAC_SCALE ,
-			lut_src[3001] / FRAC_SCALE ,
-			lut_src[3002] / FRAC_SCALE ,
-			lut_src[3003] / FRAC_SCALE ,
-			lut_src[3004] / FRAC_SCALE ,
-			lut_src[3005] / FRAC_SCALE ,
-			lut_src[3006] / FRAC_SCALE ,
-			lut_src[3007] / FRAC_SCALE ,
-			lut_src[3008] / FRAC_SCALE ,
-			lut_src[3009] / FRAC_SCALE ,
-			lut_src[3010] / FRAC_SCALE ,
-			lut_src[3011] / FRAC_SCALE ,
-			lut_src[3012] / FRAC_SCALE ,
-			lut_src[3013] / FRAC_SCALE ,
-			lut_src[3014] / FRAC_SCALE ,
-			lut_src[3015] / FRAC_SCALE ,
-			lut_src[3016] / FRAC_SCALE ,
-			lut_src[3017] / FRAC_SCALE ,
-			lut_src[3018] / FRAC_SCALE ,
-			lut_src[3019] / FRAC_SCALE ,
-			lut_src[3020] / FRAC_SCALE ,
-			lut_src[3021] / FRAC_SCALE ,
-			lut_src[3022] / FRAC_SCALE ,
-			lut_src[3023] / FRAC_SCALE ,
-			lut_src[3024] / FRAC_SCALE ,
-			lut_src[3025] / FRAC_SCALE ,
-			lut_src[3026] / FRAC_SCALE ,
-			lut_src[3027] / FRAC_SCALE ,
-			lut_src[3028] / FRAC_SCALE ,
-			lut_src[3029] / FRAC_SCALE ,
-			lut_src[3030] / FRAC_SCALE ,
-			lut_src[3031] / FRAC_SCALE ,
-			lut_src[3032] / FRAC_SCALE ,
-			lut_src[3033] / FRAC_SCALE ,
-			lut_src[3034] / FRAC_SCALE ,
-			lut_src[3035] / FRAC_SCALE ,
-			lut_src[3036] / FRAC_SCALE ,
-			lut_src[3037] / FRAC_SCALE ,
-			lut_src[3038] / FRAC_SCALE ,
-			lut_src[3039] / FRAC_SCALE ,
-			lut_src[3040] / FRAC_SCALE ,
-			lut_src[3041] / FRAC_SCALE ,
-			lut_src[3042] / FRAC_SCALE ,
-			lut_src[3043] / FRAC_SCALE ,
-			lut_src[3044] / FRAC_SCALE ,
-			lut_src[3045] / FRAC_SCALE ,
-			lut_src[3046] / FRAC_SCALE ,
-			lut_src[3047] / FRAC_SCALE ,
-			lut_src[3048] / FRAC_SCALE ,
-			lut_src[3049] / FRAC_SCALE ,
-			lut_src[3050] / FRAC_SCALE ,
-			lut_src[3051] / FRAC_SCALE ,
-			lut_src[3052] / FRAC_SCALE ,
-			lut_src[3053] / FRAC_SCALE ,
-			lut_src[3054] / FRAC_SCALE ,
-			lut_src[3055] / FRAC_SCALE ,
-			lut_src[3056] / FRAC_SCALE ,
-			lut_src[3057] / FRAC_SCALE ,
-			lut_src[3058] / FRAC_SCALE ,
-			lut_src[3059] / FRAC_SCALE ,
-			lut_src[3060] / FRAC_SCALE ,
-			lut_src[3061] / FRAC_SCALE ,
-			lut_src[3062] / FRAC_SCALE ,
-			lut_src[3063] / FRAC_SCALE ,
-			lut_src[3064] / FRAC_SCALE ,
-			lut_src[3065] / FRAC_SCALE ,
-			lut_src[3066] / FRAC_SCALE ,
-			lut_src[3067] / FRAC_SCALE ,
-			lut_src[3068] / FRAC_SCALE ,
-			lut_src[3069] / FRAC_SCALE ,
-			lut_src[3070] / FRAC_SCALE ,
-			lut_src[3071] / FRAC_SCALE ,
-			lut_src[3072] / FRAC_SCALE ,
-			lut_src[3073] / FRAC_SCALE ,
-			lut_src[3074] / FRAC_SCALE ,
-			lut_src[3075] / FRAC_SCALE ,
-			lut_src[3076] / FRAC_SCALE ,
-			lut_src[3077] / FRAC_SCALE ,
-			lut_src[3078] / FRAC_SCALE ,
-			lut_src[3079] / FRAC_SCALE ,
-			lut_src[3080] / FRAC_SCALE ,
-			lut_src[3081] / FRAC_SCALE ,
-			lut_src[3082] / FRAC_SCALE ,
-			lut_src[3083] / FRAC_SCALE ,
-			lut_src[3084] / FRAC_SCALE ,
-			lut_src[3085] / FRAC_SCALE ,
-			lut_src[3086] / FRAC_SCALE ,
-			lut_src[3087] / FRAC_SCALE ,
-			lut_src[3088] / FRAC_SCALE ,
-			lut_src[3089] / FRAC_SCALE ,
-			lut_src[3090] / FRAC_SCALE ,
-			lut_src[3091] / FRAC_SCALE ,
-			lut_src[3092] / FRAC_SCALE ,
-			lut_src[3093] / FRAC_SCALE ,
-			lut_src[3094] / FRAC_SCALE ,
-			lut_src[3095] / FRAC_SCALE ,
-			lut_src[3096] / FRAC_SCALE ,
-			lut_src[3097] / FRAC_SCALE ,
-			lut_src[3098] / FRAC_SCALE ,
-			lut_src[3099] / FRAC_SCALE ,
-			lut_src[3100] / FRAC_SCALE ,
-			lut_src[3101] / FRAC_SCALE ,
-			lut_src[3102] / FRAC_SCALE ,
-			lut_src[3103] / FRAC_SCALE ,
-			lut_src[3104] / FRAC_SCALE ,
-			lut_src[3105] / FRAC_SCALE ,
-			lut_src[3106] / FRAC_SCALE ,
-			lut_src[3107] / FRAC_SCALE ,
-			lut_src[3108] / FRAC_SCALE ,
-			lut_src[3109] / FRAC_SCALE ,
-			lut_src[3110] / FRAC_SCALE ,
-			lut_src[3111] / FRAC_SCALE ,
-			lut_src[3112] / FRAC_SCALE ,
-			lut_src[3113] / FRAC_SCALE ,
-			lut_src[3114] / FRAC_SCALE ,
-			lut_src[3115] / FRAC_SCALE ,
-			lut_src[3116] / FRAC_SCALE ,
-			lut_src[3117] / FRAC_SCALE ,
-			lut_src[3118] / FRAC_SCALE ,
-			lut_src[3119] / FRAC_SCALE ,
-			lut_src[3120] / FRAC_SCALE ,
-			lut_src[3121] / FRAC_SCALE ,
-			lut_src[3122] / FRAC_SCALE ,
-			lut_src[3123] / FRAC_SCALE ,
-			lut_src[3124] / FRAC_SCALE ,
-			lut_src[3125] / FRAC_SCALE ,
-			lut_src[3126] / FRAC_SCALE ,
-			lut_src[3127] / FRAC_SCALE ,
-			lut_src[3128] / FRAC_SCALE ,
-			lut_src[3129] / FRAC_SCALE ,
-			lut_src[3130] / FRAC_SCALE ,
-			lut_src[3131] / FRAC_SCALE ,
-			lut_src[3132] / FRAC_SCALE ,
-			lut_src[3133] / FRAC_SCALE ,
-			lut_src[3134] / FRAC_SCALE ,
-			lut_src[3135] / FRAC_SCALE ,
-			lut_src[3136] / FRAC_SCALE ,
-			lut_src[3137] / FRAC_SCALE ,
-			lut_src[3138] / FRAC_SCALE ,
-			lut_src[3139] / FRAC_SCALE ,
-			lut_src[3140] / FRAC_SCALE ,
-			lut_src[3141] / FRAC_SCALE ,
-			lut_src[3142] / FRAC_SCALE ,
-			lut_src[3143] / FRAC_SCALE ,
-			lut_src[3144] / FRAC_SCALE ,
-			lut_src[3145] / FRAC_SCALE ,
-			lut_src[3146] / FRAC_SCALE ,
-			lut_src[3147] / FRAC_SCALE ,
-			lut_src[3148] / FRAC_SCALE ,
-			lut_src[3149] / FRAC_SCALE ,
-			lut_src[3150] / FRAC_SCALE ,
-			lut_src[3151] / FRAC_SCALE ,
-			lut_src[3152] / FRAC_SCALE ,
-			lut_src[3153] / FRAC_SCALE ,
-			lut_src[3154] / FRAC_SCALE ,
-			lut_src[3155] / FRAC_SCALE ,
-			lut_src[3156] / FRAC_SCALE ,
-			lut_src[3157] / FRAC_SCALE ,
-			lut_src[3158] / FRAC_SCALE ,
-			lut_src[3159] / FRAC_SCALE ,
-			lut_src[3160] / FRAC_SCALE ,
-			lut_src[3161] / FRAC_SCALE ,
-			lut_src[3162] / FRAC_SCALE ,
-			lut_src[3163] / FRAC_SCALE ,
-			lut_src[3164] / FRAC_SCALE ,
-			lut_src[3165] / FRAC_SCALE ,
-			lut_src[3166] / FRAC_SCALE ,
-			lut_src[3167] / FRAC_SCALE ,
-			lut_src[3168] / FRAC_SCALE ,
-			lut_src[3169] / FRAC_SCALE ,
-			lut_src[3170] / FRAC_SCALE ,
-			lut_src[3171] / FRAC_SCALE ,
-			lut_src[3172] / FRAC_SCALE ,
-			lut_src[3173] / FRAC_SCALE ,
-			lut_src[3174] / FRAC_SCALE ,
-			lut_src[3175] / FRAC_SCALE ,
-			lut_src[3176] / FRAC_SCALE ,
-			lut_src[3177] / FRAC_SCALE ,
-			lut_src[3178] / FRAC_SCALE ,
-			lut_src[3179] / FRAC_SCALE ,
-			lut_src[3180] / FRAC_SCALE ,
-			lut_src[3181] / FRAC_SCALE ,
-			lut_src[3182] / FRAC_SCALE ,
-			lut_src[3183] / FRAC_SCALE ,
-			lut_src[3184] / FRAC_SCALE ,
-			lut_src[3185] / FRAC_SCALE ,
-			lut_src[3186] / FRAC_SCALE ,
-			lut_src[3187] / FRAC_SCALE ,
-			lut_src[3188] / FRAC_SCALE ,
-			lut_src[3189] / FRAC_SCALE ,
-			lut_src[3190] / FRAC_SCALE ,
-			lut_src[3191] / FRAC_SCALE ,
-			lut_src[3192] / FRAC_SCALE ,
-			lut_src[3193] / FRAC_SCALE ,
-			lut_src[3194] / FRAC_SCALE ,
-			lut_src[3195] / FRAC_SCALE ,
-			lut_src[3196] / FRAC_SCALE ,
-			lut_src[3197] / FRAC_SCALE ,
-			lut_src[3198] / FRAC_SCALE ,
-			lut_src[3199] / FRAC_SCALE ,
-			lut_src[3200] / FRAC_SCALE ,
-			lut_src[3201] / FRAC_SCALE ,
-			lut_src[3202] / FRAC_SCALE ,
-			lut_src[3203] / FRAC_SCALE ,
-			lut_src[3204] / FRAC_SCALE ,
-			lut_src[3205] / FRAC_SCALE ,
-			lut_src[3206] / FRAC_SCALE ,
-			lut_src[3207] / FRAC_SCALE ,
-			lut_src[3208] / FRAC_SCALE ,
-			lut_src[3209] / FRAC_SCALE ,
-			lut_src[3210] / FRAC_SCALE ,
-			lut_src[3211] / FRAC_SCALE ,
-			lut_src[3212] / FRAC_SCALE ,
-			lut_src[3213] / FRAC_SCALE ,
-			lut_src[3214] / FRAC_SCALE ,
-			lut_src[3215] / FRAC_SCALE ,
-			lut_src[3216] / FRAC_SCALE ,
-			lut_src[3217] / FRAC_SCALE ,
-			lut_src[3218] / FRAC_SCALE ,
-			lut_src[3219] / FRAC_SCALE ,
-			lut_src[3220] / FRAC_SCALE ,
-			lut_src[3221] / FRAC_SCALE ,
-			lut_src[3222] / FRAC_SCALE ,
-			lut_src[3223] / FRAC_SCALE ,
-			lut_src[3224] / FRAC_SCALE ,
-			lut_src[3225] / FRAC_SCALE ,
-			lut_src[3226] / FRAC_SCALE ,
-			lut_src[3227] / FRAC_SCALE ,
-			lut_src[3228] / FRAC_SCALE ,
-			lut_src[3229] / FRAC_SCALE ,
-			lut_src[3230] / FRAC_SCALE ,
-			lut_src[3231] / FRAC_SCALE ,
-			lut_src[3232] / FRAC_SCALE ,
-			lut_src[3233] / FRAC_SCALE ,
-			lut_src[3234] / FRAC_SCALE ,
-			lut_src[3235] / FRAC_SCALE ,
-			lut_src[3236] / FRAC_SCALE ,
-			lut_src[3237] / FRAC_SCALE ,
-			lut_src[3238] / FRAC_SCALE ,
-			lut_src[3239] / FRAC_SCALE ,
-			lut_src[3240] / FRAC_SCALE ,
-			lut_src[3241] / FRAC_SCALE ,
-			lut_src[3242] / FRAC_SCALE ,
-			lut_src[3243] / FRAC_SCALE ,
-			lut_src[3244] / FRAC_SCALE ,
-			lut_src[3245] / FRAC_SCALE ,
-			lut_src[3246] / FRAC_SCALE ,
-			lut_src[3247] / FRAC_SCALE ,
-			lut_src[3248] / FRAC_SCALE ,
-			lut_src[3249] / FRAC_SCALE ,
-			lut_src[3250] / FRAC_SCALE ,
-			lut_src[3251] / FRAC_SCALE ,
-			lut_src[3252] / FRAC_SCALE ,
-			lut_src[3253] / FRAC_SCALE ,
-			lut_src[3254] / FRAC_SCALE ,
-			lut_src[3255] / FRAC_SCALE ,
-			lut_src[3256] / FRAC_SCALE ,
-			lut_src[3257] / FRAC_SCALE ,
-			lut_src[3258] / FRAC_SCALE ,
-			lut_src[3259] / FRAC_SCALE ,
-			lut_src[3260] / FRAC_SCALE ,
-			lut_src[3261] / FRAC_SCALE ,
-			lut_src[3262] / FRAC_SCALE ,
-			lut_src[3263] / FRAC_SCALE ,
-			lut_src[3264] / FRAC_SCALE ,
-			lut_src[3265] / FRAC_SCALE ,
-			lut_src[3266] / FRAC_SCALE ,
-			lut_src[3267] / FRAC_SCALE ,
-			lut_src[3268] / FRAC_SCALE ,
-			lut_src[3269] / FRAC_SCALE ,
-			lut_src[3270] / FRAC_SCALE ,
-			lut_src[3271] / FRAC_SCALE ,
-			lut_src[3272] / FRAC_SCALE ,
-			lut_src[3273] / FRAC_SCALE ,
-			lut_src[3274] / FRAC_SCALE ,
-			lut_src[3275] / FRAC_SCALE ,
-			lut_src[3276] / FRAC_SCALE ,
-			lut_src[3277] / FRAC_SCALE ,
-			lut_src[3278] / FRAC_SCALE ,
-			lut_src[3279] / FRAC_SCALE ,
-			lut_src[3280] / FRAC_SCALE ,
-			lut_src[3281] / FRAC_SCALE ,
-			lut_src[3282] / FRAC_SCALE ,
-			lut_src[3283] / FRAC_SCALE ,
-			lut_src[3284] / FRAC_SCALE ,
-			lut_src[3285] / FRAC_SCALE ,
-			lut_src[3286] / FRAC_SCALE ,
-			lut_src[3287] / FRAC_SCALE ,
-			lut_src[3288] / FRAC_SCALE ,
-			lut_src[3289] / FRAC_SCALE ,
-			lut_src[3290] / FRAC_SCALE ,
-			lut_src[3291] / FRAC_SCALE ,
-			lut_src[3292] / FRAC_SCALE ,
-			lut_src[3293] / FRAC_SCALE ,
-			lut_src[3294] / FRAC_SCALE ,
-			lut_src[3295] / FRAC_SCALE ,
-			lut_src[3296] / FRAC_SCALE ,
-			lut_src[3297] / FRAC_SCALE ,
-			lut_src[3298] / FRAC_SCALE ,
-			lut_src[3299] / FRAC_SCALE ,
-			lut_src[3300] / FRAC_SCALE ,
-			lut_src[3301] / FRAC_SCALE ,
-			lut_src[3302] / FRAC_SCALE ,
-			lut_src[3303] / FRAC_SCALE ,
-			lut_src[3304] / FRAC_SCALE ,
-			lut_src[3305] / FRAC_SCALE ,
-			lut_src[3306] / FRAC_SCALE ,
-			lut_src[3307] / FRAC_SCALE ,
-			lut_src[3308] / FRAC_SCALE ,
-			lut_src[3309] / FRAC_SCALE ,
-			lut_src[3310] / FRAC_SCALE ,
-			lut_src[3311] / FRAC_SCALE ,
-			lut_src[3312] / FRAC_SCALE ,
-			lut_src[3313] / FRAC_SCALE ,
-			lut_src[3314] / FRAC_SCALE ,
-			lut_src[3315] / FRAC_SCALE ,
-			lut_src[3316] / FRAC_SCALE ,
-			lut_src[3317] / FRAC_SCALE ,
-			lut_src[3318] / FRAC_SCALE ,
-			lut_src[3319] / FRAC_SCALE ,
-			lut_src[3320] / FRAC_SCALE ,
-			lut_src[3321] / FRAC_SCALE ,
-			lut_src[3322] / FRAC_SCALE ,
-			lut_src[3323] / FRAC_SCALE ,
-			lut_src[3324] / FRAC_SCALE ,
-			lut_src[3325] / FRAC_SCALE ,
-			lut_src[3326] / FRAC_SCALE ,
-			lut_src[3327] / FRAC_SCALE ,
-			lut_src[3328] / FRAC_SCALE ,
-			lut_src[3329] / FRAC_SCALE ,
-			lut_src[3330] / FRAC_SCALE ,
-			lut_src[3331] / FRAC_SCALE ,
-			lut_src[3332] / FRAC_SCALE ,
-			lut_src[3333] / FRAC_SCALE ,
-			lut_src[3334] / FRAC_SCALE ,
-			lut_src[3335] / FRAC_SCALE ,
-			lut_src[3336] / FRAC_SCALE ,
-			lut_src[3337] / FRAC_SCALE ,
-			lut_src[3338] / FRAC_SCALE ,
-			lut_src[3339] / FRAC_SCALE ,
-			lut_src[3340] / FRAC_SCALE ,
-			lut_src[3341] / FRAC_SCALE ,
-			lut_src[3342] / FRAC_SCALE ,
-			lut_src[3343] / FRAC_SCALE ,
-			lut_src[3344] / FRAC_SCALE ,
-			lut_src[3345] / FRAC_SCALE ,
-			lut_src[3346] / FRAC_SCALE ,
-			lut_src[3347] / FRAC_SCALE ,
-			lut_src[3348] / FRAC_SCALE ,
-			lut_src[3349] / FRAC_SCALE ,
-			lut_src[3350] / FRAC_SCALE ,
-			lut_src[3351] / FRAC_SCALE ,
-			lut_src[3352] / FRAC_SCALE ,
-			lut_src[3353] / FRAC_SCALE ,
-			lut_src[3354] / FRAC_SCALE ,
-			lut_src[3355] / FRAC_SCALE ,
-			lut_src[3356] / FRAC_SCALE ,
-			lut_src[3357] / FRAC_SCALE ,
-			lut_src[3358] / FRAC_SCALE ,
-			lut_src[3359] / FRAC_SCALE ,
-			lut_src[3360] / FRAC_SCALE ,
-			lut_src[3361] / FRAC_SCALE ,
-			lut_src[3362] / FRAC_SCALE ,
-			lut_src[3363] / FRAC_SCALE ,
-			lut_src[3364] / FRAC_SCALE ,
-			lut_src[3365] / FRAC_SCALE ,
-			lut_src[3366] / FRAC_SCALE ,
-			lut_src[3367] / FRAC_SCALE ,
-			lut_src[3368] / FRAC_SCALE ,
-			lut_src[3369] / FRAC_SCALE ,
-			lut_src[3370] / FRAC_SCALE ,
-			lut_src[3371] / FRAC_SCALE ,
-			lut_src[3372] / FRAC_SCALE ,
-			lut_src[3373] / FRAC_SCALE ,
-			lut_src[3374] / FRAC_SCALE ,
-			lut_src[3375] / FRAC_SCALE ,
-			lut_src[3376] / FRAC_SCALE ,
-			lut_src[3377] / FRAC_SCALE ,
-			lut_src[3378] / FRAC_SCALE ,
-			lut_src[3379] / FRAC_SCALE ,
-			lut_src[3380] / FRAC_SCALE ,
-			lut_src[3381] / FRAC_SCALE ,
-			lut_src[3382] / FRAC_SCALE ,
-			lut_src[3383] / FRAC_SCALE ,
-			lut_src[3384] / FRAC_SCALE ,
-			lut_src[3385] / FRAC_SCALE ,
-			lut_src[3386] / FRAC_SCALE ,
-			lut_src[3387] / FRAC_SCALE ,
-			lut_src[3388] / FRAC_SCALE ,
-			lut_src[3389] / FRAC_SCALE ,
-			lut_src[3390] / FRAC_SCALE ,
-			lut_src[3391] / FRAC_SCALE ,
-			lut_src[3392] / FRAC_SCALE ,
-			lut_src[3393] / FRAC_SCALE ,
-			lut_src[3394] / FRAC_SCALE ,
-			lut_src[3395] / FRAC_SCALE ,
-			lut_src[3396] / FRAC_SCALE ,
-			lut_src[3397] / FRAC_SCALE ,
-			lut_src[3398] / FRAC_SCALE ,
-			lut_src[3399] / FRAC_SCALE ,
-			lut_src[3400] / FRAC_SCALE ,
-			lut_src[3401] / FRAC_SCALE ,
-			lut_src[3402] / FRAC_SCALE ,
-			lut_src[3403] / FRAC_SCALE ,
-			lut_src[3404] / FRAC_SCALE ,
-			lut_src[3405] / FRAC_SCALE ,
-			lut_src[3406] / FRAC_SCALE ,
-			lut_src[3407] / FRAC_SCALE ,
-			lut_src[3408] / FRAC_SCALE ,
-			lut_src[3409] / FRAC_SCALE ,
-			lut_src[3410] / FRAC_SCALE ,
-			lut_src[3411] / FRAC_SCALE ,
-			lut_src[3412] / FRAC_SCALE ,
-			lut_src[3413] / FRAC_SCALE ,
-			lut_src[3414] / FRAC_SCALE ,
-			lut_src[3415] / FRAC_SCALE ,
-			lut_src[3416] / FRAC_SCALE ,
-			lut_src[3417] / FRAC_SCALE ,
-			lut_src[3418] / FRAC_SCALE ,
-			lut_src[3419] / FRAC_SCALE ,
-			lut_src[3420] / FRAC_SCALE ,
-			lut_src[3421] / FRAC_SCALE ,
-			lut_src[3422] / FRAC_SCALE ,
-			lut_src[3423] / FRAC_SCALE ,
-			lut_src[3424] / FRAC_SCALE ,
-			lut_src[3425] / FRAC_SCALE ,
-			lut_src[3426] / FRAC_SCALE ,
-			lut_src[3427] / FRAC_SCALE ,
-			lut_src[3428] / FRAC_SCALE ,
-			lut_src[3429] / FRAC_SCALE ,
-			lut_src[3430] / FRAC_SCALE ,
-			lut_src[3431] / FRAC_SCALE ,
-			lut_src[3432] / FRAC_SCALE ,
-			lut_src[3433] / FRAC_SCALE ,
-			lut_src[3434] / FRAC_SCALE ,
-			lut_src[3435] / FRAC_SCALE ,
-			lut_src[3436] / FRAC_SCALE ,
-			lut_src[3437] / FRAC_SCALE ,
-			lut_src[3438] / FRAC_SCALE ,
-			lut_src[3439] / FRAC_SCALE ,
-			lut_src[3440] / FRAC_SCALE ,
-			lut_src[3441] / FRAC_SCALE ,
-			lut_src[3442] / FRAC_SCALE ,
-			lut_src[3443] / FRAC_SCALE ,
-			lut_src[3444] / FRAC_SCALE ,
-			lut_src[3445] / FRAC_SCALE ,
-			lut_src[3446] / FRAC_SCALE ,
-			lut_src[3447] / FRAC_SCALE ,
-			lut_src[3448] / FRAC_SCALE ,
-			lut_src[3449] / FRAC_SCALE ,
-			lut_src[3450] / FRAC_SCALE ,
-			lut_src[3451] / FRAC_SCALE ,
-			lut_src[3452] / FRAC_SCALE ,
-			lut_src[3453] / FRAC_SCALE ,
-			lut_src[3454] / FRAC_SCALE ,
-			lut_src[3455] / FRAC_SCALE ,
-			lut_src[3456] / FRAC_SCALE ,
-			lut_src[3457] / FRAC_SCALE ,
-			lut_src[3458] / FRAC_SCALE ,
-			lut_src[3459] / FRAC_SCALE ,
-			lut_src[3460] / FRAC_SCALE ,
-			lut_src[3461] / FRAC_SCALE ,
-			lut_src[3462] / FRAC_SCALE ,
-			lut_src[3463] / FRAC_SCALE ,
-			lut_src[3464] / FRAC_SCALE ,
-			lut_src[3465] / FRAC_SCALE ,
-			lut_src[3466] / FRAC_SCALE ,
-			lut_src[3467] / FRAC_SCALE ,
-			lut_src[3468] / FRAC_SCALE ,
-			lut_src[3469] / FRAC_SCALE ,
-			lut_src[3470] / FRAC_SCALE ,
-			lut_src[3471] / FRAC_SCALE ,
-			lut_src[3472] / FRAC_SCALE ,
-			lut_src[3473] / FRAC_SCALE ,
-			lut_src[3474] / FRAC_SCALE ,
-			lut_src[3475] / FRAC_SCALE ,
-			lut_src[3476] / FRAC_SCALE ,
-			lut_src[3477] / FRAC_SCALE ,
-			lut_src[3478] / FRAC_SCALE ,
-			lut_src[3479] / FRAC_SCALE ,
-			lut_src[3480] / FRAC_SCALE ,
-			lut_src[3481] / FRAC_SCALE ,
-			lut_src[3482] / FRAC_SCALE ,
-			lut_src[3483] / FRAC_SCALE ,
-			lut_src[3484] / FRAC_SCALE ,
-			lut_src[3485] / FRAC_SCALE ,
-			lut_src[3486] / FRAC_SCALE ,
-			lut_src[3487] / FRAC_SCALE ,
-			lut_src[3488] / FRAC_SCALE ,
-			lut_src[3489] / FRAC_SCALE ,
-			lut_src[3490] / FRAC_SCALE ,
-			lut_src[3491] / FRAC_SCALE ,
-			lut_src[3492] / FRAC_SCALE ,
-			lut_src[3493] / FRAC_SCALE ,
-			lut_src[3494] / FRAC_SCALE ,
-			lut_src[3495] / FRAC_SCALE ,
-			lut_src[3496] / FRAC_SCALE ,
-			lut_src[3497] / FRAC_SCALE ,
-			lut_src[3498] / FRAC_SCALE ,
-			lut_src[3499] / FRAC_SCALE ,
-			lut_src[3500] / FRAC_SCALE ,
-			lut_src[3501] / FRAC_SCALE ,
-			lut_src[3502] / FRAC_SCALE ,
-			lut_src[3503] / FRAC_SCALE ,
-			lut_src[3504] / FRAC_SCALE ,
-			lut_src[3505] / FRAC_SCALE ,
-			lut_src[3506] / FRAC_SCALE ,
-			lut_src[3507] / FRAC_SCALE ,
-			lut_src[3508] / FRAC_SCALE ,
-			lut_src[3509] / FRAC_SCALE ,
-			lut_src[3510] / FRAC_SCALE ,
-			lut_src[3511] / FRAC_SCALE ,
-			lut_src[3512] / FRAC_SCALE ,
-			lut_src[3513] / FRAC_SCALE ,
-			lut_src[3514] / FRAC_SCALE ,
-			lut_src[3515] / FRAC_SCALE ,
-			lut_src[3516] / FRAC_SCALE ,
-			lut_src[3517] / FRAC_SCALE ,
-			lut_src[3518] / FRAC_SCALE ,
-			lut_src[3519] / FRAC_SCALE ,
-			lut_src[3520] / FRAC_SCALE ,
-			lut_src[3521] / FRAC_SCALE ,
-			lut_src[3522] / FRAC_SCALE ,
-			lut_src[3523] / FRAC_SCALE ,
-			lut_src[3524] / FRAC_SCALE ,
-			lut_src[3525] / FRAC_SCALE ,
-			lut_src[3526] / FRAC_SCALE ,
-			lut_src[3527] / FRAC_SCALE ,
-			lut_src[3528] / FRAC_SCALE ,
-			lut_src[3529] / FRAC_SCALE ,
-			lut_src[3530] / FRAC_SCALE ,
-			lut_src[3531] / FRAC_SCALE ,
-			lut_src[3532] / FRAC_SCALE ,
-			lut_src[3533] / FRAC_SCALE ,
-			lut_src[3534] / FRAC_SCALE ,
-			lut_src[3535] / FRAC_SCALE ,
-			lut_src[3536] / FRAC_SCALE ,
-			lut_src[3537] / FRAC_SCALE ,
-			lut_src[3538] / FRAC_SCALE ,
-			lut_src[3539] / FRAC_SCALE ,
-			lut_src[3540] / FRAC_SCALE ,
-			lut_src[3541] / FRAC_SCALE ,
-			lut_src[3542] / FRAC_SCALE ,
-			lut_src[3543] / FRAC_SCALE ,
-			lut_src[3544] / FRAC_SCALE ,
-			lut_src[3545] / FRAC_SCALE ,
-			lut_src[3546] / FRAC_SCALE ,
-			lut_src[3547] / FRAC_SCALE ,
-			lut_src[3548] / FRAC_SCALE ,
-			lut_src[3549] / FRAC_SCALE ,
-			lut_src[3550] / FRAC_SCALE ,
-			lut_src[3551] / FRAC_SCALE ,
-			lut_src[3552] / FRAC_SCALE ,
-			lut_src[3553] / FRAC_SCALE ,
-			lut_src[3554] / FRAC_SCALE ,
-			lut_src[3555] / FRAC_SCALE ,
-			lut_src[3556] / FRAC_SCALE ,
-			lut_src[3557] / FRAC_SCALE ,
-			lut_src[3558] / FRAC_SCALE ,
-			lut_src[3559] / FRAC_SCALE ,
-			lut_src[3560] / FRAC_SCALE ,
-			lut_src[3561] / FRAC_SCALE ,
-			lut_src[3562] / FRAC_SCALE ,
-			lut_src[3563] / FRAC_SCALE ,
-			lut_src[3564] / FRAC_SCALE ,
-			lut_src[3565] / FRAC_SCALE ,
-			lut_src[3566] / FRAC_SCALE ,
-			lut_src[3567] / FRAC_SCALE ,
-			lut_src[3568] / FRAC_SCALE ,
-			lut_src[3569] / FRAC_SCALE ,
-			lut_src[3570] / FRAC_SCALE ,
-			lut_src[3571] / FRAC_SCALE ,
-			lut_src[3572] / FRAC_SCALE ,
-			lut_src[3573] / FRAC_SCALE ,
-			lut_src[3574] / FRAC_SCALE ,
-			lut_src[3575] / FRAC_SCALE ,
-			lut_src[3576] / FRAC_SCALE ,
-			lut_src[3577] / FRAC_SCALE ,
-			lut_src[3578] / FRAC_SCALE ,
-			lut_src[3579] / FRAC_SCALE ,
-			lut_src[3580] / FRAC_SCALE ,
-			lut_src[3581] / FRAC_SCALE ,
-			lut_src[3582] / FRAC_SCALE ,
-			lut_src[3583] / FRAC_SCALE ,
-			lut_src[3584] / FRAC_SCALE ,
-			lut_src[3585] / FRAC_SCALE ,
-			lut_src[3586] / FRAC_SCALE ,
-			lut_src[3587] / FRAC_SCALE ,
-			lut_src[3588] / FRAC_SCALE ,
-			lut_src[3589] / FRAC_SCALE ,
-			lut_src[3590] / FRAC_SCALE ,
-			lut_src[3591] / FRAC_SCALE ,
-			lut_src[3592] / FRAC_SCALE ,
-			lut_src[3593] / FRAC_SCALE ,
-			lut_src[3594] / FRAC_SCALE ,
-			lut_src[3595] / FRAC_SCALE ,
-			lut_src[3596] / FRAC_SCALE ,
-			lut_src[3597] / FRAC_SCALE ,
-			lut_src[3598] / FRAC_SCALE ,
-			lut_src[3599] / FRAC_SCALE ,
-			lut_src[3600] / FRAC_SCALE ,
-			lut_src[3601] / FRAC_SCALE ,
-			lut_src[3602] / FRAC_SCALE ,
-			lut_src[3603] / FRAC_SCALE ,
-			lut_src[3604] / FRAC_SCALE ,
-			lut_src[3605] / FRAC_SCALE ,
-			lut_src[3606] / FRAC_SCALE ,
-			lut_src[3607] / FRAC_SCALE ,
-			lut_src[3608] / FRAC_SCALE ,
-			lut_src[3609] / FRAC_SCALE ,
-			lut_src[3610] / FRAC_SCALE ,
-			lut_src[3611] / FRAC_SCALE ,
-			lut_src[3612] / FRAC_SCALE ,
-			lut_src[3613] / FRAC_SCALE ,
-			lut_src[3614] / FRAC_SCALE ,
-			lut_src[3615] / FRAC_SCALE ,
-			lut_src[3616] / FRAC_SCALE ,
-			lut_src[3617] / FRAC_SCALE ,
-			lut_src[3618] / FRAC_SCALE ,
-			lut_src[3619] / FRAC_SCALE ,
-			lut_src[3620] / FRAC_SCALE ,
-			lut_src[3621] / FRAC_SCALE ,
-			lut_src[3622] / FRAC_SCALE ,
-			lut_src[3623] / FRAC_SCALE ,
-			lut_src[3624] / FRAC_SCALE ,
-			lut_src[3625] / FRAC_SCALE ,
-			lut_src[3626] / FRAC_SCALE ,
-			lut_src[3627] / FRAC_SCALE ,
-			lut_src[3628] / FRAC_SCALE ,
-			lut_src[3629] / FRAC_SCALE ,
-			lut_src[3630] / FRAC_SCALE ,
-			lut_src[3631] / FRAC_SCALE ,
-			lut_src[3632] / FRAC_SCALE ,
-			lut_src[3633] / FRAC_SCALE ,
-			lut_src[3634] / FRAC_SCALE ,
-			lut_src[3635] / FRAC_SCALE ,
-			lut_src[3636] / FRAC_SCALE ,
-			lut_src[3637] / FRAC_SCALE ,
-			lut_src[3638] / FRAC_SCALE ,
-			lut_src[3639] / FRAC_SCALE ,
-			lut_src[3640] / FRAC_SCALE ,
-			lut_src[3641] / FRAC_SCALE ,
-			lut_src[3642] / FRAC_SCALE ,
-			lut_src[3643] / FRAC_SCALE ,
-			lut_src[3644] / FRAC_SCALE ,
-			lut_src[3645] / FRAC_SCALE ,
-			lut_src[3646] / FRAC_SCALE ,
-			lut_src[3647] / FRAC_SCALE ,
-			lut_src[3648] / FRAC_SCALE ,
-			lut_src[3649] / FRAC_SCALE ,
-			lut_src[3650] / FRAC_SCALE ,
-			lut_src[3651] / FRAC_SCALE ,
-			lut_src[3652] / FRAC_SCALE ,
-			lut_src[3653] / FRAC_SCALE ,
-			lut_src[3654] / FRAC_SCALE ,
-			lut_src[3655] / FRAC_SCALE ,
-			lut_src[3656] / FRAC_SCALE ,
-			lut_src[3657] / FRAC_SCALE ,
-			lut_src[3658] / FRAC_SCALE ,
-			lut_src[3659] / FRAC_SCALE ,
-			lut_src[3660] / FRAC_SCALE ,
-			lut_src[3661] / FRAC_SCALE ,
-			lut_src[3662] / FRAC_SCALE ,
-			lut_src[3663] / FRAC_SCALE ,
-			lut_src[3664] / FRAC_SCALE ,
-			lut_src[3665] / FRAC_SCALE ,
-			lut_src[3666] / FRAC_SCALE ,
-			lut_src[3667] / FRAC_SCALE ,
-			lut_src[3668] / FRAC_SCALE ,
-			lut_src[3669] / FRAC_SCALE ,
-			lut_src[3670] / FRAC_SCALE ,
-			lut_src[3671] / FRAC_SCALE ,
-			lut_src[3672] / FRAC_SCALE ,
-			lut_src[3673] / FRAC_SCALE ,
-			lut_src[3674] / FRAC_SCALE ,
-			lut_src[3675] / FRAC_SCALE ,
-			lut_src[3676] / FRAC_SCALE ,
-			lut_src[3677] / FRAC_SCALE ,
-			lut_src[3678] / FRAC_SCALE ,
-			lut_src[3679] / FRAC_SCALE ,
-			lut_src[3680] / FRAC_SCALE ,
-			lut_src[3681] / FRAC_SCALE ,
-			lut_src[3682] / FRAC_SCALE ,
-			lut_src[3683] / FRAC_SCALE ,
-			lut_src[3684] / FRAC_SCALE ,
-			lut_src[3685] / FRAC_SCALE ,
-			lut_src[3686] / FRAC_SCALE ,
-			lut_src[3687] / FRAC_SCALE ,
-			lut_src[3688] / FRAC_SCALE ,
-			lut_src[3689] / FRAC_SCALE ,
-			lut_src[3690] / FRAC_SCALE ,
-			lut_src[3691] / FRAC_SCALE ,
-			lut_src[3692] / FRAC_SCALE ,
-			lut_src[3693] / FRAC_SCALE ,
-			lut_src[3694] / FRAC_SCALE ,
-			lut_src[3695] / FRAC_SCALE ,
-			lut_src[3696] / FRAC_SCALE ,
-			lut_src[3697] / FRAC_SCALE ,
-			lut_src[3698] / FRAC_SCALE ,
-			lut_src[3699] / FRAC_SCALE ,
-			lut_src[3700] / FRAC_SCALE ,
-			lut_src[3701] / FRAC_SCALE ,
-			lut_src[3702] / FRAC_SCALE ,
-			lut_src[3703] / FRAC_SCALE ,
-			lut_src[3704] / FRAC_SCALE ,
-			lut_src[3705] / FRAC_SCALE ,
-			lut_src[3706] / FRAC_SCALE ,
-			lut_src[3707] / FRAC_SCALE ,
-			lut_src[3708] / FRAC_SCALE ,
-			lut_src[3709] / FRAC_SCALE ,
-			lut_src[3710] / FRAC_SCALE ,
-			lut_src[3711] / FRAC_SCALE ,
-			lut_src[3712] / FRAC_SCALE ,
-			lut_src[3713] / FRAC_SCALE ,
-			lut_src[3714] / FRAC_SCALE ,
-			lut_src[3715] / FRAC_SCALE ,
-			lut_src[3716] / FRAC_SCALE ,
-			lut_src[3717] / FRAC_SCALE ,
-			lut_src[3718] / FRAC_SCALE ,
-			lut_src[3719] / FRAC_SCALE ,
-			lut_src[3720] / FRAC_SCALE ,
-			lut_src[3721] / FRAC_SCALE ,
-			lut_src[3722] / FRAC_SCALE ,
-			lut_src[3723] / FRAC_SCALE ,
-			lut_src[3724] / FRAC_SCALE ,
-			lut_src[3725] / FRAC_SCALE ,
-			lut_src[3726] / FRAC_SCALE ,
-			lut_src[3727] / FRAC_SCALE ,
-			lut_src[3728] / FRAC_SCALE ,
-			lut_src[3729] / FRAC_SCALE ,
-			lut_src[3730] / FRAC_SCALE ,
-			lut_src[3731] / FRAC_SCALE ,
-			lut_src[3732] / FRAC_SCALE ,
-			lut_src[3733] / FRAC_SCALE ,
-			lut_src[3734] / FRAC_SCALE ,
-			lut_src[3735] / FRAC_SCALE ,
-			lut_src[3736] / FRAC_SCALE ,
-			lut_src[3737] / FRAC_SCALE ,
-			lut_src[3738] / FRAC_SCALE ,
-			lut_src[3739] / FRAC_SCALE ,
-			lut_src[3740] / FRAC_SCALE ,
-			lut_src[3741] / FRAC_SCALE ,
-			lut_src[3742] / FRAC_SCALE ,
-			lut_src[3743] / FRAC_SCALE ,
-			lut_src[3744] / FRAC_SCALE ,
-			lut_src[3745] / FRAC_SCALE ,
-			lut_src[3746] / FRAC_SCALE ,
-			lut_src[3747] / FRAC_SCALE ,
-			lut_src[3748] / FRAC_SCALE ,
-			lut_src[3749] / FRAC_SCALE ,
-			lut_src[3750] / FRAC_SCALE ,
-			lut_src[3751] / FRAC_SCALE ,
-			lut_src[3752] / FRAC_SCALE ,
-			lut_src[3753] / FRAC_SCALE ,
-			lut_src[3754] / FRAC_SCALE ,
-			lut_src[3755] / FRAC_SCALE ,
-			lut_src[3756] / FRAC_SCALE ,
-			lut_src[3757] / FRAC_SCALE ,
-			lut_src[3758] / FRAC_SCALE ,
-			lut_src[3759] / FRAC_SCALE ,
-			lut_src[3760] / FRAC_SCALE ,
-			lut_src[3761] / FRAC_SCALE ,
-			lut_src[3762] / FRAC_SCALE ,
-			lut_src[3763] / FRAC_SCALE ,
-			lut_src[3764] / FRAC_SCALE ,
-			lut_src[3765] / FRAC_SCALE ,
-			lut_src[3766] / FRAC_SCALE ,
-			lut_src[3767] / FRAC_SCALE ,
-			lut_src[3768] / FRAC_SCALE ,
-			lut_src[3769] / FRAC_SCALE ,
-			lut_src[3770] / FRAC_SCALE ,
-			lut_src[3771] / FRAC_SCALE ,
-			lut_src[3772] / FRAC_SCALE ,
-			lut_src[3773] / FRAC_SCALE ,
-			lut_src[3774] / FRAC_SCALE ,
-			lut_src[3775] / FRAC_SCALE ,
-			lut_src[3776] / FRAC_SCALE ,
-			lut_src[3777] / FRAC_SCALE ,
-			lut_src[3778] / FRAC_SCALE ,
-			lut_src[3779] / FRAC_SCALE ,
-			lut_src[3780] / FRAC_SCALE ,
-			lut_src[3781] / FRAC_SCALE ,
-			lut_src[3782] / FRAC_SCALE ,
-			lut_src[3783] / FRAC_SCALE ,
-			lut_src[3784] / FRAC_SCALE ,
-			lut_src[3785] / FRAC_SCALE ,
-			lut_src[3786] / FRAC_SCALE ,
-			lut_src[3787] / FRAC_SCALE ,
-			lut_src[3788] / FRAC_SCALE ,
-			lut_src[3789] / FRAC_SCALE ,
-			lut_src[3790] / FRAC_SCALE ,
-			lut_src[3791] / FRAC_SCALE ,
-			lut_src[3792] / FRAC_SCALE ,
-			lut_src[3793] / FRAC_SCALE ,
-			lut_src[3794] / FRAC_SCALE ,
-			lut_src[3795] / FRAC_SCALE ,
-			lut_src[3796] / FRAC_SCALE ,
-			lut_src[3797] / FRAC_SCALE ,
-			lut_src[3798] / FRAC_SCALE ,
-			lut_src[3799] / FRAC_SCALE ,
-			lut_src[3800] / FRAC_SCALE ,
-			lut_src[3801] / FRAC_SCALE ,
-			lut_src[3802] / FRAC_SCALE ,
-			lut_src[3803] / FRAC_SCALE ,
-			lut_src[3804] / FRAC_SCALE ,
-			lut_src[3805] / FRAC_SCALE ,
-			lut_src[3806] / FRAC_SCALE ,
-			lut_src[3807] / FRAC_SCALE ,
-			lut_src[3808] / FRAC_SCALE ,
-			lut_src[3809] / FRAC_SCALE ,
-			lut_src[3810] / FRAC_SCALE ,
-			lut_src[3811] / FRAC_SCALE ,
-			lut_src[3812] / FRAC_SCALE ,
-			lut_src[3813] / FRAC_SCALE ,
-			lut_src[3814] / FRAC_SCALE ,
-			lut_src[3815] / FRAC_SCALE ,
-			lut_src[3816] / FRAC_SCALE ,
-			lut_src[3817] / FRAC_SCALE ,
-			lut_src[3818] / FRAC_SCALE ,
-			lut_src[3819] / FRAC_SCALE ,
-			lut_src[3820] / FRAC_SCALE ,
-			lut_src[3821] / FRAC_SCALE ,
-			lut_src[3822] / FRAC_SCALE ,
-			lut_src[3823] / FRAC_SCALE ,
-			lut_src[3824] / FRAC_SCALE ,
-			lut_src[3825] / FRAC_SCALE ,
-			lut_src[3826] / FRAC_SCALE ,
-			lut_src[3827] / FRAC_SCALE ,
-			lut_src[3828] / FRAC_SCALE ,
-			lut_src[3829] / FRAC_SCALE ,
-			lut_src[3830] / FRAC_SCALE ,
-			lut_src[3831] / FRAC_SCALE ,
-			lut_src[3832] / FRAC_SCALE ,
-			lut_src[3833] / FRAC_SCALE ,
-			lut_src[3834] / FRAC_SCALE ,
-			lut_src[3835] / FRAC_SCALE ,
-			lut_src[3836] / FRAC_SCALE ,
-			lut_src[3837] / FRAC_SCALE ,
-			lut_src[3838] / FRAC_SCALE ,
-			lut_src[3839] / FRAC_SCALE ,
-			lut_src[3840] / FRAC_SCALE ,
-			lut_src[3841] / FRAC_SCALE ,
-			lut_src[3842] / FRAC_SCALE ,
-			lut_src[3843] / FRAC_SCALE ,
-			lut_src[3844] / FRAC_SCALE ,
-			lut_src[3845] / FRAC_SCALE ,
-			lut_src[3846] / FRAC_SCALE ,
-			lut_src[3847] / FRAC_SCALE ,
-			lut_src[3848] / FRAC_SCALE ,
-			lut_src[3849] / FRAC_SCALE ,
-			lut_src[3850] / FRAC_SCALE ,
-			lut_src[3851] / FRAC_SCALE ,
-			lut_src[3852] / FRAC_SCALE ,
-			lut_src[3853] / FRAC_SCALE ,
-			lut_src[3854] / FRAC_SCALE ,
-			lut_src[3855] / FRAC_SCALE ,
-			lut_src[3856] / FRAC_SCALE ,
-			lut_src[3857] / FRAC_SCALE ,
-			lut_src[3858] / FRAC_SCALE ,
-			lut_src[3859] / FRAC_SCALE ,
-			lut_src[3860] / FRAC_SCALE ,
-			lut_src[3861] / FRAC_SCALE ,
-			lut_src[3862] / FRAC_SCALE ,
-			lut_src[3863] / FRAC_SCALE ,
-			lut_src[3864] / FRAC_SCALE ,
-			lut_src[3865] / FRAC_SCALE ,
-			lut_src[3866] / FRAC_SCALE ,
-			lut_src[3867] / FRAC_SCALE ,
-			lut_src[3868] / FRAC_SCALE ,
-			lut_src[3869] / FRAC_SCALE ,
-			lut_src[3870] / FRAC_SCALE ,
-			lut_src[3871] / FRAC_SCALE ,
-			lut_src[3872] / FRAC_SCALE ,
-			lut_src[3873] / FRAC_SCALE ,
-			lut_src[3874] / FRAC_SCALE ,
-			lut_src[3875] / FRAC_SCALE ,
-			lut_src[3876] / FRAC_SCALE ,
-			lut_src[3877] / FRAC_SCALE ,
-			lut_src[3878] / FRAC_SCALE ,
-			lut_src[3879] / FRAC_SCALE ,
-			lut_src[3880] / FRAC_SCALE ,
-			lut_src[3881] / FRAC_SCALE ,
-			lut_src[3882] / FRAC_SCALE ,
-			lut_src[3883] / FRAC_SCALE ,
-			lut_src[3884] / FRAC_SCALE ,
-			lut_src[3885] / FRAC_SCALE ,
-			lut_src[3886] / FRAC_SCALE ,
-			lut_src[3887] / FRAC_SCALE ,
-			lut_src[3888] / FRAC_SCALE ,
-			lut_src[3889] / FRAC_SCALE ,
-			lut_src[3890] / FRAC_SCALE ,
-			lut_src[3891] / FRAC_SCALE ,
-			lut_src[3892] / FRAC_SCALE ,
-			lut_src[3893] / FRAC_SCALE ,
-			lut_src[3894] / FRAC_SCALE ,
-			lut_src[3895] / FRAC_SCALE ,
-			lut_src[3896] / FRAC_SCALE ,
-			lut_src[3897] / FRAC_SCALE ,
-			lut_src[3898] / FRAC_SCALE ,
-			lut_src[3899] / FRAC_SCALE ,
-			lut_src[3900] / FRAC_SCALE ,
-			lut_src[3901] / FRAC_SCALE ,
-			lut_src[3902] / FRAC_SCALE ,
-			lut_src[3903] / FRAC_SCALE ,
-			lut_src[3904] / FRAC_SCALE ,
-			lut_src[3905] / FRAC_SCALE ,
-			lut_src[3906] / FRAC_SCALE ,
-			lut_src[3907] / FRAC_SCALE ,
-			lut_src[3908] / FRAC_SCALE ,
-			lut_src[3909] / FRAC_SCALE ,
-			lut_src[3910] / FRAC_SCALE ,
-			lut_src[3911] / FRAC_SCALE ,
-			lut_src[3912] / FRAC_SCALE ,
-			lut_src[3913] / FRAC_SCALE ,
-			lut_src[3914] / FRAC_SCALE ,
-			lut_src[3915] / FRAC_SCALE ,
-			lut_src[3916] / FRAC_SCALE ,
-			lut_src[3917] / FRAC_SCALE ,
-			lut_src[3918] / FRAC_SCALE ,
-			lut_src[3919] / FRAC_SCALE ,
-			lut_src[3920] / FRAC_SCALE ,
-			lut_src[3921] / FRAC_SCALE ,
-			lut_src[3922] / FRAC_SCALE ,
-			lut_src[3923] / FRAC_SCALE ,
-			lut_src[3924] / FRAC_SCALE ,
-			lut_src[3925] / FRAC_SCALE ,
-			lut_src[3926] / FRAC_SCALE ,
-			lut_src[3927] / FRAC_SCALE ,
-			lut_src[3928] / FRAC_SCALE ,
-			lut_src[3929] / FRAC_SCALE ,
-			lut_src[3930] / FRAC_SCALE ,
-			lut_src[3931] / FRAC_SCALE ,
-			lut_src[3932] / FRAC_SCALE ,
-			lut_src[3933] / FRAC_SCALE ,
-			lut_src[3934] / FRAC_SCALE ,
-			lut_src[3935] / FRAC_SCALE ,
-			lut_src[3936] / FRAC_SCALE ,
-			lut_src[3937] / FRAC_SCALE ,
-			lut_src[3938] / FRAC_SCALE ,
-			lut_src[3939] / FRAC_SCALE ,
-			lut_src[3940] / FRAC_SCALE ,
-			lut_src[3941] / FRAC_SCALE ,
-			lut_src[3942] / FRAC_SCALE ,
-			lut_src[3943] / FRAC_SCALE ,
-			lut_src[3944] / FRAC_SCALE ,
-			lut_src[3945] / FRAC_SCALE ,
-			lut_src[3946] / FRAC_SCALE ,
-			lut_src[3947] / FRAC_SCALE ,
-			lut_src[3948] / FRAC_SCALE ,
-			lut_src[3949] / FRAC_SCALE ,
-			lut_src[3950] / FRAC_SCALE ,
-			lut_src[3951] / FRAC_SCALE ,
-			lut_src[3952] / FRAC_SCALE ,
-			lut_src[3953] / FRAC_SCALE ,
-			lut_src[3954] / FRAC_SCALE ,
-			lut_src[3955] / FRAC_SCALE ,
-			lut_src[3956] / FRAC_SCALE ,
-			lut_src[3957] / FRAC_SCALE ,
-			lut_src[3958] / FRAC_SCALE ,
-			lut_src[3959] / FRAC_SCALE ,
-			lut_src[3960] / FRAC_SCALE ,
-			lut_src[3961] / FRAC_SCALE ,
-			lut_src[3962] / FRAC_SCALE ,
-			lut_src[3963] / FRAC_SCALE ,
-			lut_src[3964] / FRAC_SCALE ,
-			lut_src[3965] / FRAC_SCALE ,
-			lut_src[3966] / FRAC_SCALE ,
-			lut_src[3967] / FRAC_SCALE ,
-			lut_src[3968] / FRAC_SCALE ,
-			lut_src[3969] / FRAC_SCALE ,
-			lut_src[3970] / FRAC_SCALE ,
-			lut_src[3971] / FRAC_SCALE ,
-			lut_src[3972] / FRAC_SCALE ,
-			lut_src[3973] / FRAC_SCALE ,
-			lut_src[3974] / FRAC_SCALE ,
-			lut_src[3975] / FRAC_SCALE ,
-			lut_src[3976] / FRAC_SCALE ,
-			lut_src[3977] / FRAC_SCALE ,
-			lut_src[3978] / FRAC_SCALE ,
-			lut_src[3979] / FRAC_SCALE ,
-			lut_src[3980] / FRAC_SCALE ,
-			lut_src[3981] / FRAC_SCALE ,
-			lut_src[3982] / FRAC_SCALE ,
-			lut_src[3983] / FRAC_SCALE ,
-			lut_src[3984] / FRAC_SCALE ,
-			lut_src[3985] / FRAC_SCALE ,
-			lut_src[3986] / FRAC_SCALE ,
-			lut_src[3987] / FRAC_SCALE ,
-			lut_src[3988] / FRAC_SCALE ,
-			lut_src[3989] / FRAC_SCALE ,
-			lut_src[3990] / FRAC_SCALE ,
-			lut_src[3991] / FRAC_SCALE ,
-			lut_src[3992] / FRAC_SCALE ,
-			lut_src[3993] / FRAC_SCALE ,
-			lut_src[3994] / FRAC_SCALE ,
-			lut_src[3995] / FRAC_SCALE ,
-			lut_src[3996] / FRAC_SCALE ,
-			lut_src[3997] / FRAC_SCALE ,
-			lut_src[3998] / FRAC_SCALE ,
-			lut_src[3999] / FRAC_SCALE ,
-			lut_src[4000] / FRAC_SCALE ,
-			lut_src[4001] / FRAC_SCALE ,
-			lut_src[4002] / FRAC_SCALE ,
-			lut_src[4003] / FRAC_SCALE ,
-			lut_src[4004] / FRAC_SCALE ,
-			lut_src[4005] / FRAC_SCALE ,
-			lut_src[4006] / FRAC_SCALE ,
-			lut_src[4007] / FRAC_SCALE ,
-			lut_src[4008] / FRAC_SCALE ,
-			lut_src[4009] / FRAC_SCALE ,
-			lut_src[4010] / FRAC_SCALE ,
-			lut_src[4011] / FRAC_SCALE ,
-			lut_src[4012] / FRAC_SCALE ,
-			lut_src[4013] / FRAC_SCALE ,
-			lut_src[4014] / FRAC_SCALE ,
-			lut_src[4015] / FRAC_SCALE ,
-			lut_src[4016] / FRAC_SCALE ,
-			lut_src[4017] / FRAC_SCALE ,
-			lut_src[4018] / FRAC_SCALE ,
-			lut_src[4019] / FRAC_SCALE ,
-			lut_src[4020] / FRAC_SCALE ,
-			lut_src[4021] / FRAC_SCALE ,
-			lut_src[4022] / FRAC_SCALE ,
-			lut_src[4023] / FRAC_SCALE ,
-			lut_src[4024] / FRAC_SCALE ,
-			lut_src[4025] / FRAC_SCALE ,
-			lut_src[4026] / FRAC_SCALE ,
-			lut_src[4027] / FRAC_SCALE ,
-			lut_src[4028] / FRAC_SCALE ,
-			lut_src[4029] / FRAC_SCALE ,
-			lut_src[4030] / FRAC_SCALE ,
-			lut_src[4031] / FRAC_SCALE ,
-			lut_src[4032] / FRAC_SCALE ,
-			lut_src[4033] / FRAC_SCALE ,
-			lut_src[4034] / FRAC_SCALE ,
-			lut_src[4035] / FRAC_SCALE ,
-			lut_src[4036] / FRAC_SCALE ,
-			lut_src[4037] / FRAC_SCALE ,
-			lut_src[4038] / FRAC_SCALE ,
-			lut_src[4039] / FRAC_SCALE ,
-			lut_src[4040] / FRAC_SCALE ,
-			lut_src[4041] / FRAC_SCALE ,
-			lut_src[4042] / FRAC_SCALE ,
-			lut_src[4043] / FRAC_SCALE ,
-			lut_src[4044] / FRAC_SCALE ,
-			lut_src[4045] / FRAC_SCALE ,
-			lut_src[4046] / FRAC_SCALE ,
-			lut_src[4047] / FRAC_SCALE ,
-			lut_src[4048] / FRAC_SCALE ,
-			lut_src[4049] / FRAC_SCALE ,
-			lut_src[4050] / FRAC_SCALE ,
-			lut_src[4051] / FRAC_SCALE ,
-			lut_src[4052] / FRAC_SCALE ,
-			lut_src[4053] / FRAC_SCALE ,
-			lut_src[4054] / FRAC_SCALE ,
-			lut_src[4055] / FRAC_SCALE ,
-			lut_src[4056] / FRAC_SCALE ,
-			lut_src[4057] / FRAC_SCALE ,
-			lut_src[4058] / FRAC_SCALE ,
-			lut_src[4059] / FRAC_SCALE ,
-			lut_src[4060] / FRAC_SCALE ,
-			lut_src[4061] / FRAC_SCALE ,
-			lut_src[4062] / FRAC_SCALE ,
-			lut_src[4063] / FRAC_SCALE ,
-			lut_src[4064] / FRAC_SCALE ,
-			lut_src[4065] / FRAC_SCALE ,
-			lut_src[4066] / FRAC_SCALE ,
-			lut_src[4067] / FRAC_SCALE ,
-			lut_src[4068] / FRAC_SCALE ,
-			lut_src[4069] / FRAC_SCALE ,
-			lut_src[4070] / FRAC_SCALE ,
-			lut_src[4071] / FRAC_SCALE ,
-			lut_src[4072] / FRAC_SCALE ,
-			lut_src[4073] / FRAC_SCALE ,
-			lut_src[4074] / FRAC_SCALE ,
-			lut_src[4075] / FRAC_SCALE ,
-			lut_src[4076] / FRAC_SCALE ,
-			lut_src[4077] / FRAC_SCALE ,
-			lut_src[4078] / FRAC_SCALE ,
-			lut_src[4079] / FRAC_SCALE ,
-			lut_src[4080] / FRAC_SCALE ,
-			lut_src[4081] / FRAC_SCALE ,
-			lut_src[4082] / FRAC_SCALE ,
-			lut_src[4083] / FRAC_SCALE ,
-			lut_src[4084] / FRAC_SCALE ,
-			lut_src[4085] / FRAC_SCALE ,
-			lut_src[4086] / FRAC_SCALE ,
-			lut_src[4087] / FRAC_SCALE ,
-			lut_src[4088] / FRAC_SCALE ,
-			lut_src[4089] / FRAC_SCALE ,
-			lut_src[4090] / FRAC_SCALE ,
-			lut_src[4091] / FRAC_SCALE ,
-			lut_src[4092] / FRAC_SCALE ,
-			lut_src[4093] / FRAC_SCALE ,
-			lut_src[4094] / FRAC_SCALE ,
-			lut_src[4095] / FRAC_SCALE ,
-			lut_src[4096] / FRAC_SCALE ,
-			lut_src[4097] / FRAC_SCALE ,
-			lut_src[4098] / FRAC_SCALE ,
-			lut_src[4099] / FRAC_SCALE ,
-			lut_src[4100] / FRAC_SCALE ,
-			lut_src[4101] / FRAC_SCALE ,
-			lut_src[4102] / FRAC_SCALE ,
-			lut_src[4103] / FRAC_SCALE ,
-			lut_src[4104] / FRAC_SCALE ,
-			lut_src[4105] / FRAC_SCALE ,
-			lut_src[4106] / FRAC_SCALE ,
-			lut_src[4107] / FRAC_SCALE ,
-			lut_src[4108] / FRAC_SCALE ,
-			lut_src[4109] / FRAC_SCALE ,
-			lut_src[4110] / FRAC_SCALE ,
-			lut_src[4111] / FRAC_SCALE ,
-			lut_src[4112] / FRAC_SCALE ,
-			lut_src[4113] / FRAC_SCALE ,
-			lut_src[4114] / FRAC_SCALE ,
-			lut_src[4115] / FRAC_SCALE ,
-			lut_src[4116] / FRAC_SCALE ,
-			lut_src[4117] / FRAC_SCALE ,
-			lut_src[4118] / FRAC_SCALE ,
-			lut_src[4119] / FRAC_SCALE ,
-			lut_src[4120] / FRAC_SCALE ,
-			lut_src[4121] / FRAC_SCALE ,
-			lut_src[4122] / FRAC_SCALE ,
-			lut_src[4123] / FRAC_SCALE ,
-			lut_src[4124] / FRAC_SCALE ,
-			lut_src[4125] / FRAC_SCALE ,
-			lut_src[4126] / FRAC_SCALE ,
-			lut_src[4127] / FRAC_SCALE ,
-			lut_src[4128] / FRAC_SCALE ,
-			lut_src[4129] / FRAC_SCALE ,
-			lut_src[4130] / FRAC_SCALE ,
-			lut_src[4131] / FRAC_SCALE ,
-			lut_src[4132] / FRAC_SCALE ,
-			lut_src[4133] / FRAC_SCALE ,
-			lut_src[4134] / FRAC_SCALE ,
-			lut_src[4135] / FRAC_SCALE ,
-			lut_src[4136] / FRAC_SCALE ,
-			lut_src[4137] / FRAC_SCALE ,
-			lut_src[4138] / FRAC_SCALE ,
-			lut_src[4139] / FRAC_SCALE ,
-			lut_src[4140] / FRAC_SCALE ,
-			lut_src[4141] / FRAC_SCALE ,
-			lut_src[4142] / FRAC_SCALE ,
-			lut_src[4143] / FRAC_SCALE ,
-			lut_src[4144] / FRAC_SCALE ,
-			lut_src[4145] / FRAC_SCALE ,
-			lut_src[4146] / FRAC_SCALE ,
-			lut_src[4147] / FRAC_SCALE ,
-			lut_src[4148] / FRAC_SCALE ,
-			lut_src[4149] / FRAC_SCALE ,
-			lut_src[4150] / FRAC_SCALE ,
-			lut_src[4151] / FRAC_SCALE ,
-			lut_src[4152] / FRAC_SCALE ,
-			lut_src[4153] / FRAC_SCALE ,
-			lut_src[4154] / FRAC_SCALE ,
-			lut_src[4155] / FRAC_SCALE ,
-			lut_src[4156] / FRAC_SCALE ,
-			lut_src[4157] / FRAC_SCALE ,
-			lut_src[4158] / FRAC_SCALE ,
-			lut_src[4159] / FRAC_SCALE ,
-			lut_src[4160] / FRAC_SCALE ,
-			lut_src[4161] / FRAC_SCALE ,
-			lut_src[4162] / FRAC_SCALE ,
-			lut_src[4163] / FRAC_SCALE ,
-			lut_src[4164] / FRAC_SCALE ,
-			lut_src[4165] / FRAC_SCALE ,
-			lut_src[4166] / FRAC_SCALE ,
-			lut_src[4167] / FRAC_SCALE ,
-			lut_src[4168] / FRAC_SCALE ,
-			lut_src[4169] / FRAC_SCALE ,
-			lut_src[4170] / FRAC_SCALE ,
-			lut_src[4171] / FRAC_SCALE ,
-			lut_src[4172] / FRAC_SCALE ,
-			lut_src[4173] / FRAC_SCALE ,
-			lut_src[4174] / FRAC_SCALE ,
-			lut_src[4175] / FRAC_SCALE ,
-			lut_src[4176] / FRAC_SCALE ,
-			lut_src[4177] / FRAC_SCALE ,
-			lut_src[4178] / FRAC_SCALE ,
-			lut_src[4179] / FRAC_SCALE ,
-			lut_src[4180] / FRAC_SCALE ,
-			lut_src[4181] / FRAC_SCALE ,
-			lut_src[4182] / FRAC_SCALE ,
-			lut_src[4183] / FRAC_SCALE ,
-			lut_src[4184] / FRAC_SCALE ,
-			lut_src[4185] / FRAC_SCALE ,
-			lut_src[4186] / FRAC_SCALE ,
-			lut_src[4187] / FRAC_SCALE ,
-			lut_src[4188] / FRAC_SCALE ,
-			lut_src[4189] / FRAC_SCALE ,
-			lut_src[4190] / FRAC_SCALE ,
-			lut_src[4191] / FRAC_SCALE ,
-			lut_src[4192] / FRAC_SCALE ,
-			lut_src[4193] / FRAC_SCALE ,
-			lut_src[4194] / FRAC_SCALE ,
-			lut_src[4195] / FRAC_SCALE ,
-			lut_src[4196] / FRAC_SCALE ,
-			lut_src[4197] / FRAC_SCALE ,
-			lut_src[4198] / FRAC_SCALE ,
-			lut_src[4199] / FRAC_SCALE ,
-			lut_src[4200] / FRAC_SCALE ,
-			lut_src[4201] / FRAC_SCALE ,
-			lut_src[4202] / FRAC_SCALE ,
-			lut_src[4203] / FRAC_SCALE ,
-			lut_src[4204] / FRAC_SCALE ,
-			lut_src[4205] / FRAC_SCALE ,
-			lut_src[4206] / FRAC_SCALE ,
-			lut_src[4207] / FRAC_SCALE ,
-			lut_src[4208] / FRAC_SCALE ,
-			lut_src[4209] / FRAC_SCALE ,
-			lut_src[4210] / FRAC_SCALE ,
-			lut_src[4211] / FRAC_SCALE ,
-			lut_src[4212] / FRAC_SCALE ,
-			lut_src[4213] / FRAC_SCALE ,
-			lut_src[4214] / FRAC_SCALE ,
-			lut_src[4215] / FRAC_SCALE ,
-			lut_src[4216] / FRAC_SCALE ,
-			lut_src[4217] / FRAC_SCALE ,
-			lut_src[4218] / FRAC_SCALE ,
-			lut_src[4219] / FRAC_SCALE ,
-			lut_src[4220] / FRAC_SCALE ,
-			lut_src[4221] / FRAC_SCALE ,
-			lut_src[4222] / FRAC_SCALE ,
-			lut_src[4223] / FRAC_SCALE ,
-			lut_src[4224] / FRAC_SCALE ,
-			lut_src[4225] / FRAC_SCALE ,
-			lut_src[4226] / FRAC_SCALE ,
-			lut_src[4227] / FRAC_SCALE ,
-			lut_src[4228] / FRAC_SCALE ,
-			lut_src[4229] / FRAC_SCALE ,
-			lut_src[4230] / FRAC_SCALE ,
-			lut_src[4231] / FRAC_SCALE ,
-			lut_src[4232] / FRAC_SCALE ,
-			lut_src[4233] / FRAC_SCALE ,
-			lut_src[4234] / FRAC_SCALE ,
-			lut_src[4235] / FRAC_SCALE ,
-			lut_src[4236] / FRAC_SCALE ,
-			lut_src[4237] / FRAC_SCALE ,
-			lut_src[4238] / FRAC_SCALE ,
-			lut_src[4239] / FRAC_SCALE ,
-			lut_src[4240] / FRAC_SCALE ,
-			lut_src[4241] / FRAC_SCALE ,
-			lut_src[4242] / FRAC_SCALE ,
-			lut_src[4243] / FRAC_SCALE ,
-			lut_src[4244] / FRAC_SCALE ,
-			lut_src[4245] / FRAC_SCALE ,
-			lut_src[4246] / FRAC_SCALE ,
-			lut_src[4247] / FRAC_SCALE ,
-			lut_src[4248] / FRAC_SCALE ,
-			lut_src[4249] / FRAC_SCALE ,
-			lut_src[4250] / FRAC_SCALE ,
-			lut_src[4251] / FRAC_SCALE ,
-			lut_src[4252] / FRAC_SCALE ,
-			lut_src[4253] / FRAC_SCALE ,
-			lut_src[4254] / FRAC_SCALE ,
-			lut_src[4255] / FRAC_SCALE ,
-			lut_src[4256] / FRAC_SCALE ,
-			lut_src[4257] / FRAC_SCALE ,
-			lut_src[4258] / FRAC_SCALE ,
-			lut_src[4259] / FRAC_SCALE ,
-			lut_src[4260] / FRAC_SCALE ,
-			lut_src[4261] / FRAC_SCALE ,
-			lut_src[4262] / FRAC_SCALE ,
-			lut_src[4263] / FRAC_SCALE ,
-			lut_src[4264] / FRAC_SCALE ,
-			lut_src[4265] / FRAC_SCALE ,
-			lut_src[4266] / FRAC_SCALE ,
-			lut_src[4267] / FRAC_SCALE ,
-			lut_src[4268] / FRAC_SCALE ,
-			lut_src[4269] / FRAC_SCALE ,
-			lut_src[4270] / FRAC_SCALE ,
-			lut_src[4271] / FRAC_SCALE ,
-			lut_src[4272] / FRAC_SCALE ,
-			lut_src[4273] / FRAC_SCALE ,
-			lut_src[4274] / FRAC_SCALE ,
-			lut_src[4275] / FRAC_SCALE ,
-			lut_src[4276] / FRAC_SCALE ,
-			lut_src[4277] / FRAC_SCALE ,
-			lut_src[4278] / FRAC_SCALE ,
-			lut_src[4279] / FRAC_SCALE ,
-			lut_src[4280] / FRAC_SCALE ,
-			lut_src[4281] / FRAC_SCALE ,
-			lut_src[4282] / FRAC_SCALE ,
-			lut_src[4283] / FRAC_SCALE ,
-			lut_src[4284] / FRAC_SCALE ,
-			lut_src[4285] / FRAC_SCALE ,
-			lut_src[4286] / FRAC_SCALE ,
-			lut_src[4287] / FRAC_SCALE ,
-			lut_src[4288] / FRAC_SCALE ,
-			lut_src[4289] / FRAC_SCALE ,
-			lut_src[4290] / FRAC_SCALE ,
-			lut_src[4291] / FRAC_SCALE ,
-			lut_src[4292] / FRAC_SCALE ,
-			lut_src[4293] / FRAC_SCALE ,
-			lut_src[4294] / FRAC_SCALE ,
-			lut_src[4295] / FRAC_SCALE ,
-			lut_src[4296] / FRAC_SCALE ,
-			lut_src[4297] / FRAC_SCALE ,
-			lut_src[4298] / FRAC_SCALE ,
-			lut_src[4299] / FRAC_SCALE ,
-			lut_src[4300] / FRAC_SCALE ,
-			lut_src[4301] / FRAC_SCALE ,
-			lut_src[4302] / FRAC_SCALE ,
-			lut_src[4303] / FRAC_SCALE ,
-			lut_src[4304] / FRAC_SCALE ,
-			lut_src[4305] / FRAC_SCALE ,
-			lut_src[4306] / FRAC_SCALE ,
-			lut_src[4307] / FRAC_SCALE ,
-			lut_src[4308] / FRAC_SCALE ,
-			lut_src[4309] / FRAC_SCALE ,
-			lut_src[4310] / FRAC_SCALE ,
-			lut_src[4311] / FRAC_SCALE ,
-			lut_src[4312] / FRAC_SCALE ,
-			lut_src[4313] / FRAC_SCALE ,
-			lut_src[4314] / FRAC_SCALE ,
-			lut_src[4315] / FRAC_SCALE ,
-			lut_src[4316] / FRAC_SCALE ,
-			lut_src[4317] / FRAC_SCALE ,
-			lut_src[4318] / FRAC_SCALE ,
-			lut_src[4319] / FRAC_SCALE ,
-			lut_src[4320] / FRAC_SCALE ,
-			lut_src[4321] / FRAC_SCALE ,
-			lut_src[4322] / FRAC_SCALE ,
-			lut_src[4323] / FRAC_SCALE ,
-			lut_src[4324] / FRAC_SCALE ,
-			lut_src[4325] / FRAC_SCALE ,
-			lut_src[4326] / FRAC_SCALE ,
-			lut_src[4327] / FRAC_SCALE ,
-			lut_src[4328] / FRAC_SCALE ,
-			lut_src[4329] / FRAC_SCALE ,
-			lut_src[4330] / FRAC_SCALE ,
-			lut_src[4331] / FRAC_SCALE ,
-			lut_src[4332] / FRAC_SCALE ,
-			lut_src[4333] / FRAC_SCALE ,
-			lut_src[4334] / FRAC_SCALE ,
-			lut_src[4335] / FRAC_SCALE ,
-			lut_src[4336] / FRAC_SCALE ,
-			lut_src[4337] / FRAC_SCALE ,
-			lut_src[4338] / FRAC_SCALE ,
-			lut_src[4339] / FRAC_SCALE ,
-			lut_src[4340] / FRAC_SCALE ,
-			lut_src[4341] / FRAC_SCALE ,
-			lut_src[4342] / FRAC_SCALE ,
-			lut_src[4343] / FRAC_SCALE ,
-			lut_src[4344] / FRAC_SCALE ,
-			lut_src[4345] / FRAC_SCALE ,
-			lut_src[4346] / FRAC_SCALE ,
-			lut_src[4347] / FRAC_SCALE ,
-			lut_src[4348] / FRAC_SCALE ,
-			lut_src[4349] / FRAC_SCALE ,
-			lut_src[4350] / FRAC_SCALE ,
-			lut_src[4351] / FRAC_SCALE ,
-			lut_src[4352] / FRAC_SCALE ,
-			lut_src[4353] / FRAC_SCALE ,
-			lut_src[4354] / FRAC_SCALE ,
-			lut_src[4355] / FRAC_SCALE ,
-			lut_src[4356] / FRAC_SCALE ,
-			lut_src[4357] / FRAC_SCALE ,
-			lut_src[4358] / FRAC_SCALE ,
-			lut_src[4359] / FRAC_SCALE ,
-			lut_src[4360] / FRAC_SCALE ,
-			lut_src[4361] / FRAC_SCALE ,
-			lut_src[4362] / FRAC_SCALE ,
-			lut_src[4363] / FRAC_SCALE ,
-			lut_src[4364] / FRAC_SCALE ,
-			lut_src[4365] / FRAC_SCALE ,
-			lut_src[4366] / FRAC_SCALE ,
-			lut_src[4367] / FRAC_SCALE ,
-			lut_src[4368] / FRAC_SCALE ,
-			lut_src[4369] / FRAC_SCALE ,
-			lut_src[4370] / FRAC_SCALE ,
-			lut_src[4371] / FRAC_SCALE ,
-			lut_src[4372] / FRAC_SCALE ,
-			lut_src[4373] / FRAC_SCALE ,
-			lut_src[4374] / FRAC_SCALE ,
-			lut_src[4375] / FRAC_SCALE ,
-			lut_src[4376] / FRAC_SCALE ,
-			lut_src[4377] / FRAC_SCALE ,
-			lut_src[4378] / FRAC_SCALE ,
-			lut_src[4379] / FRAC_SCALE ,
-			lut_src[4380] / FRAC_SCALE ,
-			lut_src[4381] / FRAC_SCALE ,
-			lut_src[4382] / FRAC_SCALE ,
-			lut_src[4383] / FRAC_SCALE ,
-			lut_src[4384] / FRAC_SCALE ,
-			lut_src[4385] / FRAC_SCALE ,
-			lut_src[4386] / FRAC_SCALE ,
-			lut_src[4387] / FRAC_SCALE ,
-			lut_src[4388] / FRAC_SCALE ,
-			lut_src[4389] / FRAC_SCALE ,
-			lut_src[4390] / FRAC_SCALE ,
-			lut_src[4391] / FRAC_SCALE ,
-			lut_src[4392] / FRAC_SCALE ,
-			lut_src[4393] / FRAC_SCALE ,
-			lut_src[4394] / FRAC_SCALE ,
-			lut_src[4395] / FRAC_SCALE ,
-			lut_src[4396] / FRAC_SCALE ,
-			lut_src[4397] / FRAC_SCALE ,
-			lut_src[4398] / FRAC_SCALE ,
-			lut_src[4399] / FRAC_SCALE ,
-			lut_src[4400] / FRAC_SCALE ,
-			lut_src[4401] / FRAC_SCALE ,
-			lut_src[4402] / FRAC_SCALE ,
-			lut_src[4403] / FRAC_SCALE ,
-			lut_src[4404] / FRAC_SCALE ,
-			lut_src[4405] / FRAC_SCALE ,
-			lut_src[4406] / FRAC_SCALE ,
-			lut_src[4407] / FRAC_SCALE ,
-			lut_src[4408] / FRAC_SCALE ,
-			lut_src[4409] / FRAC_SCALE ,
-			lut_src[4410] / FRAC_SCALE ,
-			lut_src[4411] / FRAC_SCALE ,
-			lut_src[4412] / FRAC_SCALE ,
-			lut_src[4413] / FRAC_SCALE ,
-			lut_src[4414] / FRAC_SCALE ,
-			lut_src[4415] / FRAC_SCALE ,
-			lut_src[4416] / FRAC_SCALE ,
-			lut_src[4417] / FRAC_SCALE ,
-			lut_src[4418] / FRAC_SCALE ,
-			lut_src[4419] / FRAC_SCALE ,
-			lut_src[4420] / FRAC_SCALE ,
-			lut_src[4421] / FRAC_SCALE ,
-			lut_src[4422] / FRAC_SCALE ,
-			lut_src[4423] / FRAC_SCALE ,
-			lut_src[4424] / FRAC_SCALE ,
-			lut_src[4425] / FRAC_SCALE ,
-			lut_src[4426] / FRAC_SCALE ,
-			lut_src[4427] / FRAC_SCALE ,
-			lut_src[4428] / FRAC_SCALE ,
-			lut_src[4429] / FRAC_SCALE ,
-			lut_src[4430] / FRAC_SCALE ,
-			lut_src[4431] / FRAC_SCALE ,
-			lut_src[4432] / FRAC_SCALE ,
-			lut_src[4433] / FRAC_SCALE ,
-			lut_src[4434] / FRAC_SCALE ,
-			lut_src[4435] / FRAC_SCALE ,
-			lut_src[4436] / FRAC_SCALE ,
-			lut_src[4437] / FRAC_SCALE ,
-			lut_src[4438] / FRAC_SCALE ,
-			lut_src[4439] / FRAC_SCALE ,
-			lut_src[4440] / FRAC_SCALE ,
-			lut_src[4441] / FRAC_SCALE ,
-			lut_src[4442] / FRAC_SCALE ,
-			lut_src[4443] / FRAC_SCALE ,
-			lut_src[4444] / FRAC_SCALE ,
-			lut_src[4445] / FRAC_SCALE ,
-			lut_src[4446] / FRAC_SCALE ,
-			lut_src[4447] / FRAC_SCALE ,
-			lut_src[4448] / FRAC_SCALE ,
-			lut_src[4449] / FRAC_SCALE ,
-			lut_src[4450] / FRAC_SCALE ,
-			lut_src[4451] / FRAC_SCALE ,
-			lut_src[4452] / FRAC_SCALE ,
-			lut_src[4453] / FRAC_SCALE ,
-			lut_src[4454] / FRAC_SCALE ,
-			lut_src[4455] / FRAC_SCALE ,
-			lut_src[4456] / FRAC_SCALE ,
-			lut_src[4457] / FRAC_SCALE ,
-			lut_src[4458] / FRAC_SCALE ,
-			lut_src[4459] / FRAC_SCALE ,
-			lut_src[4460] / FRAC_SCALE ,
-			lut_src[4461] / FRAC_SCALE ,
-			lut_src[4462] / FRAC_SCALE ,
-			lut_src[4463] / FRAC_SCALE ,
-			lut_src[4464] / FRAC_SCALE ,
-			lut_src[4465] / FRAC_SCALE ,
-			lut_src[4466] / FRAC_SCALE ,
-			lut_src[4467] / FRAC_SCALE ,
-			lut_src[4468] / FRAC_SCALE ,
-			lut_src[4469] / FRAC_SCALE ,
-			lut_src[4470] / FRAC_SCALE ,
-			lut_src[4471] / FRAC_SCALE ,
-			lut_src[4472] / FRAC_SCALE ,
-			lut_src[4473] / FRAC_SCALE ,
-			lut_src[4474] / FRAC_SCALE ,
-			lut_src[4475] / FRAC_SCALE ,
-			lut_src[4476] / FRAC_SCALE ,
-			lut_src[4477] / FRAC_SCALE ,
-			lut_src[4478] / FRAC_SCALE ,
-			lut_src[4479] / FRAC_SCALE ,
-			lut_src[4480] / FRAC_SCALE ,
-			lut_src[4481] / FRAC_SCALE ,
-			lut_src[4482] / FRAC_SCALE ,
-			lut_src[4483] / FRAC_SCALE ,
-			lut_src[4484] / FRAC_SCALE ,
-			lut_src[4485] / FRAC_SCALE ,
-			lut_src[4486] / FRAC_SCALE ,
-			lut_src[4487] / FRAC_SCALE ,
-			lut_src[4488] / FRAC_SCALE ,
-			lut_src[4489] / FRAC_SCALE ,
-			lut_src[4490] / FRAC_SCALE ,
-			lut_src[4491] / FRAC_SCALE ,
-			lut_src[4492] / FRAC_SCALE ,
-			lut_src[4493] / FRAC_SCALE ,
-			lut_src[4494] / FRAC_SCALE ,
-			lut_src[4495] / FRAC_SCALE ,
-			lut_src[4496] / FRAC_SCALE ,
-			lut_src[4497] / FRAC_SCALE ,
-			lut_src[4498] / FRAC_SCALE ,
-			lut_src[4499] / FRAC_SCALE ,
-			lut_src[4500] / FRAC_SCALE ,
-			lut_src[4501] / FRAC_SCALE ,
-			lut_src[4502] / FRAC_SCALE ,
-			lut_src[4503] / FRAC_SCALE ,
-			lut_src[4504] / FRAC_SCALE ,
-			lut_src[4505] / FRAC_SCALE ,
-			lut_src[4506] / FRAC_SCALE ,
-			lut_src[4507] / FRAC_SCALE ,
-			lut_src[4508] / FRAC_SCALE ,
-			lut_src[4509] / FRAC_SCALE ,
-			lut_src[4510] / FRAC_SCALE ,
-			lut_src[4511] / FRAC_SCALE ,
-			lut_src[4512] / FRAC_SCALE ,
-			lut_src[4513] / FRAC_SCALE ,
-			lut_src[4514] / FRAC_SCALE ,
-			lut_src[4515] / FRAC_SCALE ,
-			lut_src[4516] / FRAC_SCALE ,
-			lut_src[4517] / FRAC_SCALE ,
-			lut_src[4518] / FRAC_SCALE ,
-			lut_src[4519] / FRAC_SCALE ,
-			lut_src[4520] / FRAC_SCALE ,
-			lut_src[4521] / FRAC_SCALE ,
-			lut_src[4522] / FRAC_SCALE ,
-			lut_src[4523] / FRAC_SCALE ,
-			lut_src[4524] / FRAC_SCALE ,
-			lut_src[4525] / FRAC_SCALE ,
-			lut_src[4526] / FRAC_SCALE ,
-			lut_src[4527] / FRAC_SCALE ,
-			lut_src[4528] / FRAC_SCALE ,
-			lut_src[4529] / FRAC_SCALE ,
-			lut_src[4530] / FRAC_SCALE ,
-			lut_src[4531] / FRAC_SCALE ,
-			lut_src[4532] / FRAC_SCALE ,
-			lut_src[4533] / FRAC_SCALE ,
-			lut_src[4534] / FRAC_SCALE ,
-			lut_src[4535] / FRAC_SCALE ,
-			lut_src[4536] / FRAC_SCALE ,
-			lut_src[4537] / FRAC_SCALE ,
-			lut_src[4538] / FRAC_SCALE ,
-			lut_src[4539] / FRAC_SCALE ,
-			lut_src[4540] / FRAC_SCALE ,
-			lut_src[4541] / FRAC_SCALE ,
-			lut_src[4542] / FRAC_SCALE ,
-			lut_src[4543] / FRAC_SCALE ,
-			lut_src[4544] / FRAC_SCALE ,
-			lut_src[4545] / FRAC_SCALE ,
-			lut_src[4546] / FRAC_SCALE ,
-			lut_src[4547] / FRAC_SCALE ,
-			lut_src[4548] / FRAC_SCALE ,
-			lut_src[4549] / FRAC_SCALE ,
-			lut_src[4550] / FRAC_SCALE ,
-			lut_src[4551] / FRAC_SCALE ,
-			lut_src[4552] / FRAC_SCALE ,
-			lut_src[4553] / FRAC_SCALE ,
-			lut_src[4554] / FRAC_SCALE ,
-			lut_src[4555] / FRAC_SCALE ,
-			lut_src[4556] / FRAC_SCALE ,
-			lut_src[4557] / FRAC_SCALE ,
-			lut_src[4558] / FRAC_SCALE ,
-			lut_src[4559] / FRAC_SCALE ,
-			lut_src[4560] / FRAC_SCALE ,
-			lut_src[4561] / FRAC_SCALE ,
-			lut_src[4562] / FRAC_SCALE ,
-			lut_src[4563] / FRAC_SCALE ,
-			lut_src[4564] / FRAC_SCALE ,
-			lut_src[4565] / FRAC_SCALE ,
-			lut_src[4566] / FRAC_SCALE ,
-			lut_src[4567] / FRAC_SCALE ,
-			lut_src[4568] / FRAC_SCALE ,
-			lut_src[4569] / FRAC_SCALE ,
-			lut_src[4570] / FRAC_SCALE ,
-			lut_src[4571] / FRAC_SCALE ,
-			lut_src[4572] / FRAC_SCALE ,
-			lut_src[4573] / FRAC_SCALE ,
-			lut_src[4574] / FRAC_SCALE ,
-			lut_src[4575] / FRAC_SCALE ,
-			lut_src[4576] / FRAC_SCALE ,
-			lut_src[4577] / FRAC_SCALE ,
-			lut_src[4578] / FRAC_SCALE ,
-			lut_src[4579] / FRAC_SCALE ,
-			lut_src[4580] / FRAC_SCALE ,
-			lut_src[4581] / FRAC_SCALE ,
-			lut_src[4582] / FRAC_SCALE ,
-			lut_src[4583] / FRAC_SCALE ,
-			lut_src[4584] / FRAC_SCALE ,
-			lut_src[4585] / FRAC_SCALE ,
-			lut_src[4586] / FRAC_SCALE ,
-			lut_src[4587] / FRAC_SCALE ,
-			lut_src[4588] / FRAC_SCALE ,
-			lut_src[4589] / FRAC_SCALE ,
-			lut_src[4590] / FRAC_SCALE ,
-			lut_src[4591] / FRAC_SCALE ,
-			lut_src[4592] / FRAC_SCALE ,
-			lut_src[4593] / FRAC_SCALE ,
-			lut_src[4594] / FRAC_SCALE ,
-			lut_src[4595] / FRAC_SCALE ,
-			lut_src[4596] / FRAC_SCALE ,
-			lut_src[4597] / FRAC_SCALE ,
-			lut_src[4598] / FRAC_SCALE ,
-			lut_src[4599] / FRAC_SCALE ,
-			lut_src[4600] / FRAC_SCALE ,
-			lut_src[4601] / FRAC_SCALE ,
-			lut_src[4602] / FRAC_SCALE ,
-			lut_src[4603] / FRAC_SCALE ,
-			lut_src[4604] / FRAC_SCALE ,
-			lut_src[4605] / FRAC_SCALE ,
-			lut_src[4606] / FRAC_SCALE ,
-			lut_src[4607] / FRAC_SCALE ,
-			lut_src[4608] / FRAC_SCALE ,
-			lut_src[4609] / FRAC_SCALE ,
-			lut_src[4610] / FRAC_SCALE ,
-			lut_src[4611] / FRAC_SCALE ,
-			lut_src[4612] / FRAC_SCALE ,
-			lut_src[4613] / FRAC_SCALE ,
-			lut_src[4614] / FRAC_SCALE ,
-			lut_src[4615] / FRAC_SCALE ,
-			lut_src[4616] / FRAC_SCALE ,
-			lut_src[4617] / FRAC_SCALE ,
-			lut_src[4618] / FRAC_SCALE ,
-			lut_src[4619] / FRAC_SCALE ,
-			lut_src[4620] / FRAC_SCALE ,
-			lut_src[4621] / FRAC_SCALE ,
-			lut_src[4622] / FRAC_SCALE ,
-			lut_src[4623] / FRAC_SCALE ,
-			lut_src[4624] / FRAC_SCALE ,
-			lut_src[4625] / FRAC_SCALE ,
-			lut_src[4626] / FRAC_SCALE ,
-			lut_src[4627] / FRAC_SCALE ,
-			lut_src[4628] / FRAC_SCALE ,
-			lut_src[4629] / FRAC_SCALE ,
-			lut_src[4630] / FRAC_SCALE ,
-			lut_src[4631] / FRAC_SCALE ,
-			lut_src[4632] / FRAC_SCALE ,
-			lut_src[4633] / FRAC_SCALE ,
-			lut_src[4634] / FRAC_SCALE ,
-			lut_src[4635] / FRAC_SCALE ,
-			lut_src[4636] / FRAC_SCALE ,
-			lut_src[4637] / FRAC_SCALE ,
-			lut_src[4638] / FRAC_SCALE ,
-			lut_src[4639] / FRAC_SCALE ,
-			lut_src[4640] / FRAC_SCALE ,
-			lut_src[4641] / FRAC_SCALE ,
-			lut_src[4642] / FRAC_SCALE ,
-			lut_src[4643] / FRAC_SCALE ,
-			lut_src[4644] / FRAC_SCALE ,
-			lut_src[4645] / FRAC_SCALE ,
-			lut_src[4646] / FRAC_SCALE ,
-			lut_src[4647] / FRAC_SCALE ,
-			lut_src[4648] / FRAC_SCALE ,
-			lut_src[4649] / FRAC_SCALE ,
-			lut_src[4650] / FRAC_SCALE ,
-			lut_src[4651] / FRAC_SCALE ,
-			lut_src[4652] / FRAC_SCALE ,
-			lut_src[4653] / FRAC_SCALE ,
-			lut_src[4654] / FRAC_SCALE ,
-			lut_src[4655] / FRAC_SCALE ,
-			lut_src[4656] / FRAC_SCALE ,
-			lut_src[4657] / FRAC_SCALE ,
-			lut_src[4658] / FRAC_SCALE ,
-			lut_src[4659] / FRAC_SCALE ,
-			lut_src[4660] / FRAC_SCALE ,
-			lut_src[4661] / FRAC_SCALE ,
-			lut_src[4662] / FRAC_SCALE ,
-			lut_src[4663] / FRAC_SCALE ,
-			lut_src[4664] / FRAC_SCALE ,
-			lut_src[4665] / FRAC_SCALE ,
-			lut_src[4666] / FRAC_SCALE ,
-			lut_src[4667] / FRAC_SCALE ,
-			lut_src[4668] / FRAC_SCALE ,
-			lut_src[4669] / FRAC_SCALE ,
-			lut_src[4670] / FRAC_SCALE ,
-			lut_src[4671] / FRAC_SCALE ,
-			lut_src[4672] / FRAC_SCALE ,
-			lut_src[4673] / FRAC_SCALE ,
-			lut_src[4674] / FRAC_SCALE ,
-			lut_src[4675] / FRAC_SCALE ,
-			lut_src[4676] / FRAC_SCALE ,
-			lut_src[4677] / FRAC_SCALE ,
-			lut_src[4678] / FRAC_SCALE ,
-			lut_src[4679] / FRAC_SCALE ,
-			lut_src[4680] / FRAC_SCALE ,
-			lut_src[4681] / FRAC_SCALE ,
-			lut_src[4682] / FRAC_SCALE ,
-			lut_src[4683] / FRAC_SCALE ,
-			lut_src[4684] / FRAC_SCALE ,
-			lut_src[4685] / FRAC_SCALE ,
-			lut_src[4686] / FRAC_SCALE ,
-			lut_src[4687] / FRAC_SCALE ,
-			lut_src[4688] / FRAC_SCALE ,
-			lut_src[4689] / FRAC_SCALE ,
-			lut_src[4690] / FRAC_SCALE ,
-			lut_src[4691] / FRAC_SCALE ,
-			lut_src[4692] / FRAC_SCALE ,
-			lut_src[4693] / FRAC_SCALE ,
-			lut_src[4694] / FRAC_SCALE ,
-			lut_src[4695] / FRAC_SCALE ,
-			lut_src[4696] / FRAC_SCALE ,
-			lut_src[4697] / FRAC_SCALE ,
-			lut_src[4698] / FRAC_SCALE ,
-			lut_src[4699] / FRAC_SCALE ,
-			lut_src[4700] / FRAC_SCALE ,
-			lut_src[4701] / FRAC_SCALE ,
-			lut_src[4702] / FRAC_SCALE ,
-			lut_src[4703] / FRAC_SCALE ,
-			lut_src[4704] / FRAC_SCALE ,
-			lut_src[4705] / FRAC_SCALE ,
-			lut_src[4706] / FRAC_SCALE ,
-			lut_src[4707] / FRAC_SCALE ,
-			lut_src[4708] / FRAC_SCALE ,
-			lut_src[4709] / FRAC_SCALE ,
-			lut_src[4710] / FRAC_SCALE ,
-			lut_src[4711] / FRAC_SCALE ,
-			lut_src[4712] / FRAC_SCALE ,
-			lut_src[4713] / FRAC_SCALE ,
-			lut_src[4714] / FRAC_SCALE ,
-			lut_src[4715] / FRAC_SCALE ,
-			lut_src[4716] / FRAC_SCALE ,
-			lut_src[4717] / FRAC_SCALE ,
-			lut_src[4718] / FRAC_SCALE ,
-			lut_src[4719] / FRAC_SCALE ,
-			lut_src[4720] / FRAC_SCALE ,
-			lut_src[4721] / FRAC_SCALE ,
-			lut_src[4722] / FRAC_SCALE ,
-			lut_src[4723] / FRAC_SCALE ,
-			lut_src[4724] / FRAC_SCALE ,
-			lut_src[4725] / FRAC_SCALE ,
-			lut_src[4726] / FRAC_SCALE ,
-			lut_src[4727] / FRAC_SCALE ,
-			lut_src[4728] / FRAC_SCALE ,
-			lut_src[4729] / FRAC_SCALE ,
-			lut_src[4730] / FRAC_SCALE ,
-			lut_src[4731] / FRAC_SCALE ,
-			lut_src[4732] / FRAC_SCALE ,
-			lut_src[4733] / FRAC_SCALE ,
-			lut_src[4734] / FRAC_SCALE ,
-			lut_src[4735] / FRAC_SCALE ,
-			lut_src[4736] / FRAC_SCALE ,
-			lut_src[4737] / FRAC_SCALE ,
-			lut_src[4738] / FRAC_SCALE ,
-			lut_src[4739] / FRAC_SCALE ,
-			lut_src[4740] / FRAC_SCALE ,
-			lut_src[4741] / FRAC_SCALE ,
-			lut_src[4742] / FRAC_SCALE ,
-			lut_src[4743] / FRAC_SCALE ,
-			lut_src[4744] / FRAC_SCALE ,
-			lut_src[4745] / FRAC_SCALE ,
-			lut_src[4746] / FRAC_SCALE ,
-			lut_src[4747] / FRAC_SCALE ,
-			lut_src[4748] / FRAC_SCALE ,
-			lut_src[4749] / FRAC_SCALE ,
-			lut_src[4750] / FRAC_SCALE ,
-			lut_src[4751] / FRAC_SCALE ,
-			lut_src[4752] / FRAC_SCALE ,
-			lut_src[4753] / FRAC_SCALE ,
-			lut_src[4754] / FRAC_SCALE ,
-			lut_src[4755] / FRAC_SCALE ,
-			lut_src[4756] / FRAC_SCALE ,
-			lut_src[4757] / FRAC_SCALE ,
-			lut_src[4758] / FRAC_SCALE ,
-			lut_src[4759] / FRAC_SCALE ,
-			lut_src[4760] / FRAC_SCALE ,
-			lut_src[4761] / FRAC_SCALE ,
-			lut_src[4762] / FRAC_SCALE ,
-			lut_src[4763] / FRAC_SCALE ,
-			lut_src[4764] / FRAC_SCALE ,
-			lut_src[4765] / FRAC_SCALE ,
-			lut_src[4766] / FRAC_SCALE ,
-			lut_src[4767] / FRAC_SCALE ,
-			lut_src[4768] / FRAC_SCALE ,
-			lut_src[4769] / FRAC_SCALE ,
-			lut_src[4770] / FRAC_SCALE ,
-			lut_src[4771] / FRAC_SCALE ,
-			lut_src[4772] / FRAC_SCALE ,
-			lut_src[4773] / FRAC_SCALE ,
-			lut_src[4774] / FRAC_SCALE ,
-			lut_src[4775] / FRAC_SCALE ,
-			lut_src[4776] / FRAC_SCALE ,
-			lut_src[4777] / FRAC_SCALE ,
-			lut_src[4778] / FRAC_SCALE ,
-			lut_src[4779] / FRAC_SCALE ,
-			lut_src[4780] / FRAC_SCALE ,
-			lut_src[4781] / FRAC_SCALE ,
-			lut_src[4782] / FRAC_SCALE ,
-			lut_src[4783] / FRAC_SCALE ,
-			lut_src[4784] / FRAC_SCALE ,
-			lut_src[4785] / FRAC_SCALE ,
-			lut_src[4786] / FRAC_SCALE ,
-			lut_src[4787] / FRAC_SCALE ,
-			lut_src[4788] / FRAC_SCALE ,
-			lut_src[4789] / FRAC_SCALE ,
-			lut_src[4790] / FRAC_SCALE ,
-			lut_src[4791] / FRAC_SCALE ,
-			lut_src[4792] / FRAC_SCALE ,
-			lut_src[4793] / FRAC_SCALE ,
-			lut_src[4794] / FRAC_SCALE ,
-			lut_src[4795] / FRAC_SCALE ,
-			lut_src[4796] / FRAC_SCALE ,
-			lut_src[4797] / FRAC_SCALE ,
-			lut_src[4798] / FRAC_SCALE ,
-			lut_src[4799] / FRAC_SCALE ,
-			lut_src[4800] / FRAC_SCALE ,
-			lut_src[4801] / FRAC_SCALE ,
-			lut_src[4802] / FRAC_SCALE ,
-			lut_src[4803] / FRAC_SCALE ,
-			lut_src[4804] / FRAC_SCALE ,
-			lut_src[4805] / FRAC_SCALE ,
-			lut_src[4806] / FRAC_SCALE ,
-			lut_src[4807] / FRAC_SCALE ,
-			lut_src[4808] / FRAC_SCALE ,
-			lut_src[4809] / FRAC_SCALE ,
-			lut_src[4810] / FRAC_SCALE ,
-			lut_src[4811] / FRAC_SCALE ,
-			lut_src[4812] / FRAC_SCALE ,
-			lut_src[4813] / FRAC_SCALE ,
-			lut_src[4814] / FRAC_SCALE ,
-			lut_src[4815] / FRAC_SCALE ,
-			lut_src[4816] / FRAC_SCALE ,
-			lut_src[4817] / FRAC_SCALE ,
-			lut_src[4818] / FRAC_SCALE ,
-			lut_src[4819] / FRAC_SCALE ,
-			lut_src[4820] / FRAC_SCALE ,
-			lut_src[4821] / FRAC_SCALE ,
-			lut_src[4822] / FRAC_SCALE ,
-			lut_src[4823] / FRAC_SCALE ,
-			lut_src[4824] / FRAC_SCALE ,
-			lut_src[4825] / FRAC_SCALE ,
-			lut_src[4826] / FRAC_SCALE ,
-			lut_src[4827] / FRAC_SCALE ,
-			lut_src[4828] / FRAC_SCALE ,
-			lut_src[4829] / FRAC_SCALE ,
-			lut_src[4830] / FRAC_SCALE ,
-			lut_src[4831] / FRAC_SCALE ,
-			lut_src[4832] / FRAC_SCALE ,
-			lut_src[4833] / FRAC_SCALE ,
-			lut_src[4834] / FRAC_SCALE ,
-			lut_src[4835] / FRAC_SCALE ,
-			lut_src[4836] / FRAC_SCALE ,
-			lut_src[4837] / FRAC_SCALE ,
-			lut_src[4838] / FRAC_SCALE ,
-			lut_src[4839] / FRAC_SCALE ,
-			lut_src[4840] / FRAC_SCALE ,
-			lut_src[4841] / FRAC_SCALE ,
-			lut_src[4842] / FRAC_SCALE ,
-			lut_src[4843] / FRAC_SCALE ,
-			lut_src[4844] / FRAC_SCALE ,
-			lut_src[4845] / FRAC_SCALE ,
-			lut_src[4846] / FRAC_SCALE ,
-			lut_src[4847] / FRAC_SCALE ,
-			lut_src[4848] / FRAC_SCALE ,
-			lut_src[4849] / FRAC_SCALE ,
-			lut_src[4850] / FRAC_SCALE ,
-			lut_src[4851] / FRAC_SCALE ,
-			lut_src[4852] / FRAC_SCALE ,
-			lut_src[4853] / FRAC_SCALE ,
-			lut_src[4854] / FRAC_SCALE ,
-			lut_src[4855] / FRAC_SCALE ,
-			lut_src[4856] / FRAC_SCALE ,
-			lut_src[4857] / FRAC_SCALE ,
-			lut_src[4858] / FRAC_SCALE ,
-			lut_src[4859] / FRAC_SCALE ,
-			lut_src[4860] / FRAC_SCALE ,
-			lut_src[4861] / FRAC_SCALE ,
-			lut_src[4862] / FRAC_SCALE ,
-			lut_src[4863] / FRAC_SCALE ,
-			lut_src[4864] / FRAC_SCALE ,
-			lut_src[4865] / FRAC_SCALE ,
-			lut_src[4866] / FRAC_SCALE ,
-			lut_src[4867] / FRAC_SCALE ,
-			lut_src[4868] / FRAC_SCALE ,
-			lut_src[4869] / FRAC_SCALE ,
-			lut_src[4870] / FRAC_SCALE ,
-			lut_src[4871] / FRAC_SCALE ,
-			lut_src[4872] / FRAC_SCALE ,
-			lut_src[4873] / FRAC_SCALE ,
-			lut_src[4874] / FRAC_SCALE ,
-			lut_src[4875] / FRAC_SCALE ,
-			lut_src[4876] / FRAC_SCALE ,
-			lut_src[4877] / FRAC_SCALE ,
-			lut_src[4878] / FRAC_SCALE ,
-			lut_src[4879] / FRAC_SCALE ,
-			lut_src[4880] / FRAC_SCALE ,
-			lut_src[4881] / FRAC_SCALE ,
-			lut_src[4882] / FRAC_SCALE ,
-			lut_src[4883] / FRAC_SCALE ,
-			lut_src[4884] / FRAC_SCALE ,
-			lut_src[4885] / FRAC_SCALE ,
-			lut_src[4886] / FRAC_SCALE ,
-			lut_src[4887] / FRAC_SCALE ,
-			lut_src[4888] / FRAC_SCALE ,
-			lut_src[4889] / FRAC_SCALE ,
-			lut_src[4890] / FRAC_SCALE ,
-			lut_src[4891] / FRAC_SCALE ,
-			lut_src[4892] / FRAC_SCALE ,
-			lut_src[4893] / FRAC_SCALE ,
-			lut_src[4894] / FRAC_SCALE ,
-			lut_src[4895] / FRAC_SCALE ,
-			lut_src[4896] / FRAC_SCALE ,
-			lut_src[4897] / FRAC_SCALE ,
-			lut_src[4898] / FRAC_SCALE ,
-			lut_src[4899] / FRAC_SCALE ,
-			lut_src[4900] / FRAC_SCALE ,
-			lut_src[4901] / FRAC_SCALE ,
-			lut_src[4902] / FRAC_SCALE ,
-			lut_src[4903] / FRAC_SCALE ,
-			lut_src[4904] / FRAC_SCALE ,
-			lut_src[4905] / FRAC_SCALE ,
-			lut_src[4906] / FRAC_SCALE ,
-			lut_src[4907] / FRAC_SCALE ,
-			lut_src[4908] / FRAC_SCALE ,
-			lut_src[4909] / FRAC_SCALE ,
-			lut_src[4910] / FRAC_SCALE ,
-			lut_src[4911] / FRAC_SCALE ,
-			lut_src[4912] / FRAC_SCALE ,
-			lut_src[4913] / FRAC_SCALE ,
-			lut_src[4914] / FRAC_SCALE ,
-			lut_src[4915] / FRAC_SCALE ,
-			lut_src[4916] / FRAC_SCALE ,
-			lut_src[4917] / FRAC_SCALE ,
-			lut_src[4918] / FRAC_SCALE ,
-			lut_src[4919] / FRAC_SCALE ,
-			lut_src[4920] / FRAC_SCALE ,
-			lut_src[4921] / FRAC_SCALE ,
-			lut_src[4922] / FRAC_SCALE ,
-			lut_src[4923] / FRAC_SCALE ,
-			lut_src[4924] / FRAC_SCALE ,
-			lut_src[4925] / FRAC_SCALE ,
-			lut_src[4926] / FRAC_SCALE ,
-			lut_src[4927] / FRAC_SCALE ,
-			lut_src[4928] / FRAC_SCALE ,
-			lut_src[4929] / FRAC_SCALE ,
-			lut_src[4930] / FRAC_SCALE ,
-			lut_src[4931] / FRAC_SCALE ,
-			lut_src[4932] / FRAC_SCALE ,
-			lut_src[4933] / FRAC_SCALE ,
-			lut_src[4934] / FRAC_SCALE ,
-			lut_src[4935] / FRAC_SCALE ,
-			lut_src[4936] / FRAC_SCALE ,
-			lut_src[4937] / FRAC_SCALE ,
-			lut_src[4938] / FRAC_SCALE ,
-			lut_src[4939] / FRAC_SCALE ,
-			lut_src[4940] / FRAC_SCALE ,
-			lut_src[4941] / FRAC_SCALE ,
-			lut_src[4942] / FRAC_SCALE ,
-			lut_src[4943] / FRAC_SCALE ,
-			lut_src[4944] / FRAC_SCALE ,
-			lut_src[4945] / FRAC_SCALE ,
-			lut_src[4946] / FRAC_SCALE ,
-			lut_src[4947] / FRAC_SCALE ,
-			lut_src[4948] / FRAC_SCALE ,
-			lut_src[4949] / FRAC_SCALE ,
-			lut_src[4950] / FRAC_SCALE ,
-			lut_src[4951] / FRAC_SCALE ,
-			lut_src[4952] / FRAC_SCALE ,
-			lut_src[4953] / FRAC_SCALE ,
-			lut_src[4954] / FRAC_SCALE ,
-			lut_src[4955] / FRAC_SCALE ,
-			lut_src[4956] / FRAC_SCALE ,
-			lut_src[4957] / FRAC_SCALE ,
-			lut_src[4958] / FRAC_SCALE ,
-			lut_src[4959] / FRAC_SCALE ,
-			lut_src[4960] / FRAC_SCALE ,
-			lut_src[4961] / FRAC_SCALE ,
-			lut_src[4962] / FRAC_SCALE ,
-			lut_src[4963] / FRAC_SCALE ,
-			lut_src[4964] / FRAC_SCALE ,
-			lut_src[4965] / FRAC_SCALE ,
-			lut_src[4966] / FRAC_SCALE ,
-			lut_src[4967] / FRAC_SCALE ,
-			lut_src[4968] / FRAC_SCALE ,
-			lut_src[4969] / FRAC_SCALE ,
-			lut_src[4970] / FRAC_SCALE ,
-			lut_src[4971] / FRAC_SCALE ,
-			lut_src[4972] / FRAC_SCALE ,
-			lut_src[4973] / FRAC_SCALE ,
-			lut_src[4974] / FRAC_SCALE ,
-			lut_src[4975] / FRAC_SCALE ,
-			lut_src[4976] / FRAC_SCALE ,
-			lut_src[4977] / FRAC_SCALE ,
-			lut_src[4978] / FRAC_SCALE ,
-			lut_src[4979] / FRAC_SCALE ,
-			lut_src[4980] / FRAC_SCALE ,
-			lut_src[4981] / FRAC_SCALE ,
-			lut_src[4982] / FRAC_SCALE ,
-			lut_src[4983] / FRAC_SCALE ,
-			lut_src[4984] / FRAC_SCALE ,
-			lut_src[4985] / FRAC_SCALE ,
-			lut_src[4986] / FRAC_SCALE ,
-			lut_src[4987] / FRAC_SCALE ,
-			lut_src[4988] / FRAC_SCALE ,
-			lut_src[4989] / FRAC_SCALE ,
-			lut_src[4990] / FRAC_SCALE ,
-			lut_src[4991] / FRAC_SCALE ,
-			lut_src[4992] / FRAC_SCALE ,
-			lut_src[4993] / FRAC_SCALE ,
-			lut_src[4994] / FRAC_SCALE ,
-			lut_src[4995] / FRAC_SCALE ,
-			lut_src[4996] / FRAC_SCALE ,
-			lut_src[4997] / FRAC_SCALE ,
-			lut_src[4998] / FRAC_SCALE ,
-			lut_src[4999] / FRAC_SCALE ,
-			lut_src[5000] / FRAC_SCALE ,
-			lut_src[5001] / FRAC_SCALE ,
-			lut_src[5002] / FRAC_SCALE ,
-			lut_src[5003] / FRAC_SCALE ,
-			lut_src[5004] / FRAC_SCALE ,
-			lut_src[5005] / FRAC_SCALE ,
-			lut_src[5006] / FRAC_SCALE ,
-			lut_src[5007] / FRAC_SCALE ,
-			lut_src[5008] / FRAC_SCALE ,
-			lut_src[5009] / FRAC_SCALE ,
-			lut_src[5010] / FRAC_SCALE ,
-			lut_src[5011] / FRAC_SCALE ,
-			lut_src[5012] / FRAC_SCALE ,
-			lut_src[5013] / FRAC_SCALE ,
-			lut_src[5014] / FRAC_SCALE ,
-			lut_src[5015] / FRAC_SCALE ,
-			lut_src[5016] / FRAC_SCALE ,
-			lut_src[5017] / FRAC_SCALE ,
-			lut_src[5018] / FRAC_SCALE ,
-			lut_src[5019] / FRAC_SCALE ,
-			lut_src[5020] / FRAC_SCALE ,
-			lut_src[5021] / FRAC_SCALE ,
-			lut_src[5022] / FRAC_SCALE ,
-			lut_src[5023] / FRAC_SCALE ,
-			lut_src[5024] / FRAC_SCALE ,
-			lut_src[5025] / FRAC_SCALE ,
-			lut_src[5026] / FRAC_SCALE ,
-			lut_src[5027] / FRAC_SCALE ,
-			lut_src[5028] / FRAC_SCALE ,
-			lut_src[5029] / FRAC_SCALE ,
-			lut_src[5030] / FRAC_SCALE ,
-			lut_src[5031] / FRAC_SCALE ,
-			lut_src[5032] / FRAC_SCALE ,
-			lut_src[5033] / FRAC_SCALE ,
-			lut_src[5034] / FRAC_SCALE ,
-			lut_src[5035] / FRAC_SCALE ,
-			lut_src[5036] / FRAC_SCALE ,
-			lut_src[5037] / FRAC_SCALE ,
-			lut_src[5038] / FRAC_SCALE ,
-			lut_src[5039] / FRAC_SCALE ,
-			lut_src[5040] / FRAC_SCALE ,
-			lut_src[5041] / FRAC_SCALE ,
-			lut_src[5042] / FRAC_SCALE ,
-			lut_src[5043] / FRAC_SCALE ,
-			lut_src[5044] / FRAC_SCALE ,
-			lut_src[5045] / FRAC_SCALE ,
-			lut_src[5046] / FRAC_SCALE ,
-			lut_src[5047] / FRAC_SCALE ,
-			lut_src[5048] / FRAC_SCALE ,
-			lut_src[5049] / FRAC_SCALE ,
-			lut_src[5050] / FRAC_SCALE ,
-			lut_src[5051] / FRAC_SCALE ,
-			lut_src[5052] / FRAC_SCALE ,
-			lut_src[5053] / FRAC_SCALE ,
-			lut_src[5054] / FRAC_SCALE ,
-			lut_src[5055] / FRAC_SCALE ,
-			lut_src[5056] / FRAC_SCALE ,
-			lut_src[5057] / FRAC_SCALE ,
-			lut_src[5058] / FRAC_SCALE ,
-			lut_src[5059] / FRAC_SCALE ,
-			lut_src[5060] / FRAC_SCALE ,
-			lut_src[5061] / FRAC_SCALE ,
-			lut_src[5062] / FRAC_SCALE ,
-			lut_src[5063] / FRAC_SCALE ,
-			lut_src[5064] / FRAC_SCALE ,
-			lut_src[5065] / FRAC_SCALE ,
-			lut_src[5066] / FRAC_SCALE ,
-			lut_src[5067] / FRAC_SCALE ,
-			lut_src[5068] / FRAC_SCALE ,
-			lut_src[5069] / FRAC_SCALE ,
-			lut_src[5070] / FRAC_SCALE ,
-			lut_src[5071] / FRAC_SCALE ,
-			lut_src[5072] / FRAC_SCALE ,
-			lut_src[5073] / FRAC_SCALE ,
-			lut_src[5074] / FRAC_SCALE ,
-			lut_src[5075] / FRAC_SCALE ,
-			lut_src[5076] / FRAC_SCALE ,
-			lut_src[5077] / FRAC_SCALE ,
-			lut_src[5078] / FRAC_SCALE ,
-			lut_src[5079] / FRAC_SCALE ,
-			lut_src[5080] / FRAC_SCALE ,
-			lut_src[5081] / FRAC_SCALE ,
-			lut_src[5082] / FRAC_SCALE ,
-			lut_src[5083] / FRAC_SCALE ,
-			lut_src[5084] / FRAC_SCALE ,
-			lut_src[5085] / FRAC_SCALE ,
-			lut_src[5086] / FRAC_SCALE ,
-			lut_src[5087] / FRAC_SCALE ,
-			lut_src[5088] / FRAC_SCALE ,
-			lut_src[5089] / FRAC_SCALE ,
-			lut_src[5090] / FRAC_SCALE ,
-			lut_src[5091] / FRAC_SCALE ,
-			lut_src[5092] / FRAC_SCALE ,
-			lut_src[5093] / FRAC_SCALE ,
-			lut_src[5094] / FRAC_SCALE ,
-			lut_src[5095] / FRAC_SCALE ,
-			lut_src[5096] / FRAC_SCALE ,
-			lut_src[5097] / FRAC_SCALE ,
-			lut_src[5098] / FRAC_SCALE ,
-			lut_src[5099] / FRAC_SCALE ,
-			lut_src[5100] / FRAC_SCALE ,
-			lut_src[5101] / FRAC_SCALE ,
-			lut_src[5102] / FRAC_SCALE ,
-			lut_src[5103] / FRAC_SCALE ,
-			lut_src[5104] / FRAC_SCALE ,
-			lut_src[5105] / FRAC_SCALE ,
-			lut_src[5106] / FRAC_SCALE ,
-			lut_src[5107] / FRAC_SCALE ,
-			lut_src[5108] / FRAC_SCALE ,
-			lut_src[5109] / FRAC_SCALE ,
-			lut_src[5110] / FRAC_SCALE ,
-			lut_src[5111] / FRAC_SCALE ,
-			lut_src[5112] / FRAC_SCALE ,
-			lut_src[5113] / FRAC_SCALE ,
-			lut_src[5114] / FRAC_SCALE ,
-			lut_src[5115] / FRAC_SCALE ,
-			lut_src[5116] / FRAC_SCALE ,
-			lut_src[5117] / FRAC_SCALE ,
-			lut_src[5118] / FRAC_SCALE ,
-			lut_src[5119] / FRAC_SCALE ,
-			lut_src[5120] / FRAC_SCALE ,
-			lut_src[5121] / FRAC_SCALE ,
-			lut_src[5122] / FRAC_SCALE ,
-			lut_src[5123] / FRAC_SCALE ,
-			lut_src[5124] / FRAC_SCALE ,
-			lut_src[5125] / FRAC_SCALE ,
-			lut_src[5126] / FRAC_SCALE ,
-			lut_src[5127] / FRAC_SCALE ,
-			lut_src[5128] / FRAC_SCALE ,
-			lut_src[5129] / FRAC_SCALE ,
-			lut_src[5130] / FRAC_SCALE ,
-			lut_src[5131] / FRAC_SCALE ,
-			lut_src[5132] / FRAC_SCALE ,
-			lut_src[5133] / FRAC_SCALE ,
-			lut_src[5134] / FRAC_SCALE ,
-			lut_src[5135] / FRAC_SCALE ,
-			lut_src[5136] / FRAC_SCALE ,
-			lut_src[5137] / FRAC_SCALE ,
-			lut_src[5138] / FRAC_SCALE ,
-			lut_src[5139] / FRAC_SCALE ,
-			lut_src[5140] / FRAC_SCALE ,
-			lut_src[5141] / FRAC_SCALE ,
-			lut_src[5142] / FRAC_SCALE ,
-			lut_src[5143] / FRAC_SCALE ,
-			lut_src[5144] / FRAC_SCALE ,
-			lut_src[5145] / FRAC_SCALE ,
-			lut_src[5146] / FRAC_SCALE ,
-			lut_src[5147] / FRAC_SCALE ,
-			lut_src[5148] / FRAC_SCALE ,
-			lut_src[5149] / FRAC_SCALE ,
-			lut_src[5150] / FRAC_SCALE ,
-			lut_src[5151] / FRAC_SCALE ,
-			lut_src[5152] / FRAC_SCALE ,
-			lut_src[5153] / FRAC_SCALE ,
-			lut_src[5154] / FRAC_SCALE ,
-			lut_src[5155] / FRAC_SCALE ,
-			lut_src[5156] / FRAC_SCALE ,
-			lut_src[5157] / FRAC_SCALE ,
-			lut_src[5158] / FRAC_SCALE ,
-			lut_src[5159] / FRAC_SCALE ,
-			lut_src[5160] / FRAC_SCALE ,
-			lut_src[5161] / FRAC_SCALE ,
-			lut_src[5162] / FRAC_SCALE ,
-			lut_src[5163] / FRAC_SCALE ,
-			lut_src[5164] / FRAC_SCALE ,
-			lut_src[5165] / FRAC_SCALE ,
-			lut_src[5166] / FRAC_SCALE ,
-			lut_src[5167] / FRAC_SCALE ,
-			lut_src[5168] / FRAC_SCALE ,
-			lut_src[5169] / FRAC_SCALE ,
-			lut_src[5170] / FRAC_SCALE ,
-			lut_src[5171] / FRAC_SCALE ,
-			lut_src[5172] / FRAC_SCALE ,
-			lut_src[5173] / FRAC_SCALE ,
-			lut_src[5174] / FRAC_SCALE ,
-			lut_src[5175] / FRAC_SCALE ,
-			lut_src[5176] / FRAC_SCALE ,
-			lut_src[5177] / FRAC_SCALE ,
-			lut_src[5178] / FRAC_SCALE ,
-			lut_src[5179] / FRAC_SCALE ,
-			lut_src[5180] / FRAC_SCALE ,
-			lut_src[5181] / FRAC_SCALE ,
-			lut_src[5182] / FRAC_SCALE ,
-			lut_src[5183] / FRAC_SCALE ,
-			lut_src[5184] / FRAC_SCALE ,
-			lut_src[5185] / FRAC_SCALE ,
-			lut_src[5186] / FRAC_SCALE ,
-			lut_src[5187] / FRAC_SCALE ,
-			lut_src[5188] / FRAC_SCALE ,
-			lut_src[5189] / FRAC_SCALE ,
-			lut_src[5190] / FRAC_SCALE ,
-			lut_src[5191] / FRAC_SCALE ,
-			lut_src[5192] / FRAC_SCALE ,
-			lut_src[5193] / FRAC_SCALE ,
-			lut_src[5194] / FRAC_SCALE ,
-			lut_src[5195] / FRAC_SCALE ,
-			lut_src[5196] / FRAC_SCALE ,
-			lut_src[5197] / FRAC_SCALE ,
-			lut_src[5198] / FRAC_SCALE ,
-			lut_src[5199] / FRAC_SCALE ,
-			lut_src[5200] / FRAC_SCALE ,
-			lut_src[5201] / FRAC_SCALE ,
-			lut_src[5202] / FRAC_SCALE ,
-			lut_src[5203] / FRAC_SCALE ,
-			lut_src[5204] / FRAC_SCALE ,
-			lut_src[5205] / FRAC_SCALE ,
-			lut_src[5206] / FRAC_SCALE ,
-			lut_src[5207] / FRAC_SCALE ,
-			lut_src[5208] / FRAC_SCALE ,
-			lut_src[5209] / FRAC_SCALE ,
-			lut_src[5210] / FRAC_SCALE ,
-			lut_src[5211] / FRAC_SCALE ,
-			lut_src[5212] / FRAC_SCALE ,
-			lut_src[5213] / FRAC_SCALE ,
-			lut_src[5214] / FRAC_SCALE ,
-			lut_src[5215] / FRAC_SCALE ,
-			lut_src[5216] / FRAC_SCALE ,
-			lut_src[5217] / FRAC_SCALE ,
-			lut_src[5218] / FRAC_SCALE ,
-			lut_src[5219] / FRAC_SCALE ,
-			lut_src[5220] / FRAC_SCALE ,
-			lut_src[5221] / FRAC_SCALE ,
-			lut_src[5222] / FRAC_SCALE ,
-			lut_src[5223] / FRAC_SCALE ,
-			lut_src[5224] / FRAC_SCALE ,
-			lut_src[5225] / FRAC_SCALE ,
-			lut_src[5226] / FRAC_SCALE ,
-			lut_src[5227] / FRAC_SCALE ,
-			lut_src[5228] / FRAC_SCALE ,
-			lut_src[5229] / FRAC_SCALE ,
-			lut_src[5230] / FRAC_SCALE ,
-			lut_src[5231] / FRAC_SCALE ,
-			lut_src[5232] / FRAC_SCALE ,
-			lut_src[5233] / FRAC_SCALE ,
-			lut_src[5234] / FRAC_SCALE ,
-			lut_src[5235] / FRAC_SCALE ,
-			lut_src[5236] / FRAC_SCALE ,
-			lut_src[5237] / FRAC_SCALE ,
-			lut_src[5238] / FRAC_SCALE ,
-			lut_src[5239] / FRAC_SCALE ,
-			lut_src[5240] / FRAC_SCALE ,
-			lut_src[5241] / FRAC_SCALE ,
-			lut_src[5242] / FRAC_SCALE ,
-			lut_src[5243] / FRAC_SCALE ,
-			lut_src[5244] / FRAC_SCALE ,
-			lut_src[5245] / FRAC_SCALE ,
-			lut_src[5246] / FRAC_SCALE ,
-			lut_src[5247] / FRAC_SCALE ,
-			lut_src[5248] / FRAC_SCALE ,
-			lut_src[5249] / FRAC_SCALE ,
-			lut_src[5250] / FRAC_SCALE ,
-			lut_src[5251] / FRAC_SCALE ,
-			lut_src[5252] / FRAC_SCALE ,
-			lut_src[5253] / FRAC_SCALE ,
-			lut_src[5254] / FRAC_SCALE ,
-			lut_src[5255] / FRAC_SCALE ,
-			lut_src[5256] / FRAC_SCALE ,
-			lut_src[5257] / FRAC_SCALE ,
-			lut_src[5258] / FRAC_SCALE ,
-			lut_src[5259] / FRAC_SCALE ,
-			lut_src[5260] / FRAC_SCALE ,
-			lut_src[5261] / FRAC_SCALE ,
-			lut_src[5262] / FRAC_SCALE ,
-			lut_src[5263] / FRAC_SCALE ,
-			lut_src[5264] / FRAC_SCALE ,
-			lut_src[5265] / FRAC_SCALE ,
-			lut_src[5266] / FRAC_SCALE ,
-			lut_src[5267] / FRAC_SCALE ,
-			lut_src[5268] / FRAC_SCALE ,
-			lut_src[5269] / FRAC_SCALE ,
-			lut_src[5270] / FRAC_SCALE ,
-			lut_src[5271] / FRAC_SCALE ,
-			lut_src[5272] / FRAC_SCALE ,
-			lut_src[5273] / FRAC_SCALE ,
-			lut_src[5274] / FRAC_SCALE ,
-			lut_src[5275] / FRAC_SCALE ,
-			lut_src[5276] / FRAC_SCALE ,
-			lut_src[5277] / FRAC_SCALE ,
-			lut_src[5278] / FRAC_SCALE ,
-			lut_src[5279] / FRAC_SCALE ,
-			lut_src[5280] / FRAC_SCALE ,
-			lut_src[5281] / FRAC_SCALE ,
-			lut_src[5282] / FRAC_SCALE ,
-			lut_src[5283] / FRAC_SCALE ,
-			lut_src[5284] / FRAC_SCALE ,
-			lut_src[5285] / FRAC_SCALE ,
-			lut_src[5286] / FRAC_SCALE ,
-			lut_src[5287] / FRAC_SCALE ,
-			lut_src[5288] / FRAC_SCALE ,
-			lut_src[5289] / FRAC_SCALE ,
-			lut_src[5290] / FRAC_SCALE ,
-			lut_src[5291] / FRAC_SCALE ,
-			lut_src[5292] / FRAC_SCALE ,
-			lut_src[5293] / FRAC_SCALE ,
-			lut_src[5294] / FRAC_SCALE ,
-			lut_src[5295] / FRAC_SCALE ,
-			lut_src[5296] / FRAC_SCALE ,
-			lut_src[5297] / FRAC_SCALE ,
-			lut_src[5298] / FRAC_SCALE ,
-			lut_src[5299] / FRAC_SCALE ,
-			lut_src[5300] / FRAC_SCALE ,
-			lut_src[5301] / FRAC_SCALE ,
-			lut_src[5302] / FRAC_SCALE ,
-			lut_src[5303] / FRAC_SCALE ,
-			lut_src[5304] / FRAC_SCALE ,
-			lut_src[5305] / FRAC_SCALE ,
-			lut_src[5306] / FRAC_SCALE ,
-			lut_src[5307] / FRAC_SCALE ,
-			lut_src[5308] / FRAC_SCALE ,
-			lut_src[5309] / FRAC_SCALE ,
-			lut_src[5310] / FRAC_SCALE ,
-			lut_src[5311] / FRAC_SCALE ,
-			lut_src[5312] / FRAC_SCALE ,
-			lut_src[5313] / FRAC_SCALE ,
-			lut_src[5314] / FRAC_SCALE ,
-			lut_src[5315] / FRAC_SCALE ,
-			lut_src[5316] / FRAC_SCALE ,
-			lut_src[5317] / FRAC_SCALE ,
-			lut_src[5318] / FRAC_SCALE ,
-			lut_src[5319] / FRAC_SCALE ,
-			lut_src[5320] / FRAC_SCALE ,
-			lut_src[5321] / FRAC_SCALE ,
-			lut_src[5322] / FRAC_SCALE ,
-			lut_src[5323] / FRAC_SCALE ,
-			lut_src[5324] / FRAC_SCALE ,
-			lut_src[5325] / FRAC_SCALE ,
-			lut_src[5326] / FRAC_SCALE ,
-			lut_src[5327] / FRAC_SCALE ,
-			lut_src[5328] / FRAC_SCALE ,
-			lut_src[5329] / FRAC_SCALE ,
-			lut_src[5330] / FRAC_SCALE ,
-			lut_src[5331] / FRAC_SCALE ,
-			lut_src[5332] / FRAC_SCALE ,
-			lut_src[5333] / FRAC_SCALE ,
-			lut_src[5334] / FRAC_SCALE ,
-			lut_src[5335] / FRAC_SCALE ,
-			lut_src[5336] / FRAC_SCALE ,
-			lut_src[5337] / FRAC_SCALE ,
-			lut_src[5338] / FRAC_SCALE ,
-			lut_src[5339] / FRAC_SCALE ,
-			lut_src[5340] / FRAC_SCALE ,
-			lut_src[5341] / FRAC_SCALE ,
-			lut_src[5342] / FRAC_SCALE ,
-			lut_src[5343] / FRAC_SCALE ,
-			lut_src[5344] / FRAC_SCALE ,
-			lut_src[5345] / FRAC_SCALE ,
-			lut_src[5346] / FRAC_SCALE ,
-			lut_src[5347] / FRAC_SCALE ,
-			lut_src[5348] / FRAC_SCALE ,
-			lut_src[5349] / FRAC_SCALE ,
-			lut_src[5350] / FRAC_SCALE ,
-			lut_src[5351] / FRAC_SCALE ,
-			lut_src[5352] / FRAC_SCALE ,
-			lut_src[5353] / FRAC_SCALE ,
-			lut_src[5354] / FRAC_SCALE ,
-			lut_src[5355] / FRAC_SCALE ,
-			lut_src[5356] / FRAC_SCALE ,
-			lut_src[5357] / FRAC_SCALE ,
-			lut_src[5358] / FRAC_SCALE ,
-			lut_src[5359] / FRAC_SCALE ,
-			lut_src[5360] / FRAC_SCALE ,
-			lut_src[5361] / FRAC_SCALE ,
-			lut_src[5362] / FRAC_SCALE ,
-			lut_src[5363] / FRAC_SCALE ,
-			lut_src[5364] / FRAC_SCALE ,
-			lut_src[5365] / FRAC_SCALE ,
-			lut_src[5366] / FRAC_SCALE ,
-			lut_src[5367] / FRAC_SCALE ,
-			lut_src[5368] / FRAC_SCALE ,
-			lut_src[5369] / FRAC_SCALE ,
-			lut_src[5370] / FRAC_SCALE ,
-			lut_src[5371] / FRAC_SCALE ,
-			lut_src[5372] / FRAC_SCALE ,
-			lut_src[5373] / FRAC_SCALE ,
-			lut_src[5374] / FRAC_SCALE ,
-			lut_src[5375] / FRAC_SCALE ,
-			lut_src[5376] / FRAC_SCALE ,
-			lut_src[5377] / FRAC_SCALE ,
-			lut_src[5378] / FRAC_SCALE ,
-			lut_src[5379] / FRAC_SCALE ,
-			lut_src[5380] / FRAC_SCALE ,
-			lut_src[5381] / FRAC_SCALE ,
-			lut_src[5382] / FRAC_SCALE ,
-			lut_src[5383] / FRAC_SCALE ,
-			lut_src[5384] / FRAC_SCALE ,
-			lut_src[5385] / FRAC_SCALE ,
-			lut_src[5386] / FRAC_SCALE ,
-			lut_src[5387] / FRAC_SCALE ,
-			lut_src[5388] / FRAC_SCALE ,
-			lut_src[5389] / FRAC_SCALE ,
-			lut_src[5390] / FRAC_SCALE ,
-			lut_src[5391] / FRAC_SCALE ,
-			lut_src[5392] / FRAC_SCALE ,
-			lut_src[5393] / FRAC_SCALE ,
-			lut_src[5394] / FRAC_SCALE ,
-			lut_src[5395] / FRAC_SCALE ,
-			lut_src[5396] / FRAC_SCALE ,
-			lut_src[5397] / FRAC_SCALE ,
-			lut_src[5398] / FRAC_SCALE ,
-			lut_src[5399] / FRAC_SCALE ,
-			lut_src[5400] / FRAC_SCALE ,
-			lut_src[5401] / FRAC_SCALE ,
-			lut_src[5402] / FRAC_SCALE ,
-			lut_src[5403] / FRAC_SCALE ,
-			lut_src[5404] / FRAC_SCALE ,
-			lut_src[5405] / FRAC_SCALE ,
-			lut_src[5406] / FRAC_SCALE ,
-			lut_src[5407] / FRAC_SCALE ,
-			lut_src[5408] / FRAC_SCALE ,
-			lut_src[5409] / FRAC_SCALE ,
-			lut_src[5410] / FRAC_SCALE ,
-			lut_src[5411] / FRAC_SCALE ,
-			lut_src[5412] / FRAC_SCALE ,
-			lut_src[5413] / FRAC_SCALE ,
-			lut_src[5414] / FRAC_SCALE ,
-			lut_src[5415] / FRAC_SCALE ,
-			lut_src[5416] / FRAC_SCALE ,
-			lut_src[5417] / FRAC_SCALE ,
-			lut_src[5418] / FRAC_SCALE ,
-			lut_src[5419] / FRAC_SCALE ,
-			lut_src[5420] / FRAC_SCALE ,
-			lut_src[5421] / FRAC_SCALE ,
-			lut_src[5422] / FRAC_SCALE ,
-			lut_src[5423] / FRAC_SCALE ,
-			lut_src[5424] / FRAC_SCALE ,
-			lut_src[5425] / FRAC_SCALE ,
-			lut_src[5426] / FRAC_SCALE ,
-			lut_src[5427] / FRAC_SCALE ,
-			lut_src[5428] / FRAC_SCALE ,
-			lut_src[5429] / FRAC_SCALE ,
-			lut_src[5430] / FRAC_SCALE ,
-			lut_src[5431] / FRAC_SCALE ,
-			lut_src[5432] / FRAC_SCALE ,
-			lut_src[5433] / FRAC_SCALE ,
-			lut_src[5434] / FRAC_SCALE ,
-			lut_src[5435] / FRAC_SCALE ,
-			lut_src[5436] / FRAC_SCALE ,
-			lut_src[5437] / FRAC_SCALE ,
-			lut_src[5438] / FRAC_SCALE ,
-			lut_src[5439] / FRAC_SCALE ,
-			lut_src[5440] / FRAC_SCALE ,
-			lut_src[5441] / FRAC_SCALE ,
-			lut_src[5442] / FRAC_SCALE ,
-			lut_src[5443] / FRAC_SCALE ,
-			lut_src[5444] / FRAC_SCALE ,
-			lut_src[5445] / FRAC_SCALE ,
-			lut_src[5446] / FRAC_SCALE ,
-			lut_src[5447] / FRAC_SCALE ,
-			lut_src[5448] / FRAC_SCALE ,
-			lut_src[5449] / FRAC_SCALE ,
-			lut_src[5450] / FRAC_SCALE ,
-			lut_src[5451] / FRAC_SCALE ,
-			lut_src[5452] / FRAC_SCALE ,
-			lut_src[5453] / FRAC_SCALE ,
-			lut_src[5454] / FRAC_SCALE ,
-			lut_src[5455] / FRAC_SCALE ,
-			lut_src[5456] / FRAC_SCALE ,
-			lut_src[5457] / FRAC_SCALE ,
-			lut_src[5458] / FRAC_SCALE ,
-			lut_src[5459] / FRAC_SCALE ,
-			lut_src[5460] / FRAC_SCALE ,
-			lut_src[5461] / FRAC_SCALE ,
-			lut_src[5462] / FRAC_SCALE ,
-			lut_src[5463] / FRAC_SCALE ,
-			lut_src[5464] / FRAC_SCALE ,
-			lut_src[5465] / FRAC_SCALE ,
-			lut_src[5466] / FRAC_SCALE ,
-			lut_src[5467] / FRAC_SCALE ,
-			lut_src[5468] / FRAC_SCALE ,
-			lut_src[5469] / FRAC_SCALE ,
-			lut_src[5470] / FRAC_SCALE ,
-			lut_src[5471] / FRAC_SCALE ,
-			lut_src[5472] / FRAC_SCALE ,
-			lut_src[5473] / FRAC_SCALE ,
-			lut_src[5474] / FRAC_SCALE ,
-			lut_src[5475] / FRAC_SCALE ,
-			lut_src[5476] / FRAC_SCALE ,
-			lut_src[5477] / FRAC_SCALE ,
-			lut_src[5478] / FRAC_SCALE ,
-			lut_src[5479] / FRAC_SCALE ,
-			lut_src[5480] / FRAC_SCALE ,
-			lut_src[5481] / FRAC_SCALE ,
-			lut_src[5482] / FRAC_SCALE ,
-			lut_src[5483] / FRAC_SCALE ,
-			lut_src[5484] / FRAC_SCALE ,
-			lut_src[5485] / FRAC_SCALE ,
-			lut_src[5486] / FRAC_SCALE ,
-			lut_src[5487] / FRAC_SCALE ,
-			lut_src[5488] / FRAC_SCALE ,
-			lut_src[5489] / FRAC_SCALE ,
-			lut_src[5490] / FRAC_SCALE ,
-			lut_src[5491] / FRAC_SCALE ,
-			lut_src[5492] / FRAC_SCALE ,
-			lut_src[5493] / FRAC_SCALE ,
-			lut_src[5494] / FRAC_SCALE ,
-			lut_src[5495] / FRAC_SCALE ,
-			lut_src[5496] / FRAC_SCALE ,
-			lut_src[5497] / FRAC_SCALE ,
-			lut_src[5498] / FRAC_SCALE ,
-			lut_src[5499] / FRAC_SCALE ,
-			lut_src[5500] / FRAC_SCALE ,
-			lut_src[5501] / FRAC_SCALE ,
-			lut_src[5502] / FRAC_SCALE ,
-			lut_src[5503] / FRAC_SCALE ,
-			lut_src[5504] / FRAC_SCALE ,
-			lut_src[5505] / FRAC_SCALE ,
-			lut_src[5506] / FRAC_SCALE ,
-			lut_src[5507] / FRAC_SCALE ,
-			lut_src[5508] / FRAC_SCALE ,
-			lut_src[5509] / FRAC_SCALE ,
-			lut_src[5510] / FRAC_SCALE ,
-			lut_src[5511] / FRAC_SCALE ,
-			lut_src[5512] / FRAC_SCALE ,
-			lut_src[5513] / FRAC_SCALE ,
-			lut_src[5514] / FRAC_SCALE ,
-			lut_src[5515] / FRAC_SCALE ,
-			lut_src[5516] / FRAC_SCALE ,
-			lut_src[5517] / FRAC_SCALE ,
-			lut_src[5518] / FRAC_SCALE ,
-			lut_src[5519] / FRAC_SCALE ,
-			lut_src[5520] / FRAC_SCALE ,
-			lut_src[5521] / FRAC_SCALE ,
-			lut_src[5522] / FRAC_SCALE ,
-			lut_src[5523] / FRAC_SCALE ,
-			lut_src[5524] / FRAC_SCALE ,
-			lut_src[5525] / FRAC_SCALE ,
-			lut_src[5526] / FRAC_SCALE ,
-			lut_src[5527] / FRAC_SCALE ,
-			lut_src[5528] / FRAC_SCALE ,
-			lut_src[5529] / FRAC_SCALE ,
-			lut_src[5530] / FRAC_SCALE ,
-			lut_src[5531] / FRAC_SCALE ,
-			lut_src[5532] / FRAC_SCALE ,
-			lut_src[5533] / FRAC_SCALE ,
-			lut_src[5534] / FRAC_SCALE ,
-			lut_src[5535] / FRAC_SCALE ,
-			lut_src[5536] / FRAC_SCALE ,
-			lut_src[5537] / FRAC_SCALE ,
-			lut_src[5538] / FRAC_SCALE ,
-			lut_src[5539] / FRAC_SCALE ,
-			lut_src[5540] / FRAC_SCALE ,
-			lut_src[5541] / FRAC_SCALE ,
-			lut_src[5542] / FRAC_SCALE ,
-			lut_src[5543] / FRAC_SCALE ,
-			lut_src[5544] / FRAC_SCALE ,
-			lut_src[5545] / FRAC_SCALE ,
-			lut_src[5546] / FRAC_SCALE ,
-			lut_src[5547] / FRAC_SCALE ,
-			lut_src[5548] / FRAC_SCALE ,
-			lut_src[5549] / FRAC_SCALE ,
-			lut_src[5550] / FRAC_SCALE ,
-			lut_src[5551] / FRAC_SCALE ,
-			lut_src[5552] / FRAC_SCALE ,
-			lut_src[5553] / FRAC_SCALE ,
-			lut_src[5554] / FRAC_SCALE ,
-			lut_src[5555] / FRAC_SCALE ,
-			lut_src[5556] / FRAC_SCALE ,
-			lut_src[5557] / FRAC_SCALE ,
-			lut_src[5558] / FRAC_SCALE ,
-			lut_src[5559] / FRAC_SCALE ,
-			lut_src[5560] / FRAC_SCALE ,
-			lut_src[5561] / FRAC_SCALE ,
-			lut_src[5562] / FRAC_SCALE ,
-			lut_src[5563] / FRAC_SCALE ,
-			lut_src[5564] / FRAC_SCALE ,
-			lut_src[5565] / FRAC_SCALE ,
-			lut_src[5566] / FRAC_SCALE ,
-			lut_src[5567] / FRAC_SCALE ,
-			lut_src[5568] / FRAC_SCALE ,
-			lut_src[5569] / FRAC_SCALE ,
-			lut_src[5570] / FRAC_SCALE ,
-			lut_src[5571] / FRAC_SCALE ,
-			lut_src[5572] / FRAC_SCALE ,
-			lut_src[5573] / FRAC_SCALE ,
-			lut_src[5574] / FRAC_SCALE ,
-			lut_src[5575] / FRAC_SCALE ,
-			lut_src[5576] / FRAC_SCALE ,
-			lut_src[5577] / FRAC_SCALE ,
-			lut_src[5578] / FRAC_SCALE ,
-			lut_src[5579] / FRAC_SCALE ,
-			lut_src[5580] / FRAC_SCALE ,
-			lut_src[5581] / FRAC_SCALE ,
-			lut_src[5582] / FRAC_SCALE ,
-			lut_src[5583] / FRAC_SCALE ,
-			lut_src[5584] / FRAC_SCALE ,
-			lut_src[5585] / FRAC_SCALE ,
-			lut_src[5586] / FRAC_SCALE ,
-			lut_src[5587] / FRAC_SCALE ,
-			lut_src[5588] / FRAC_SCALE ,
-			lut_src[5589] / FRAC_SCALE ,
-			lut_src[5590] / FRAC_SCALE ,
-			lut_src[5591] / FRAC_SCALE ,
-			lut_src[5592] / FRAC_SCALE ,
-			lut_src[5593] / FRAC_SCALE ,
-			lut_src[5594] / FRAC_SCALE ,
-			lut_src[5595] / FRAC_SCALE ,
-			lut_src[5596] / FRAC_SCALE ,
-			lut_src[5597] / FRAC_SCALE ,
-			lut_src[5598] / FRAC_SCALE ,
-			lut_src[5599] / FRAC_SCALE ,
-			lut_src[5600] / FRAC_SCALE ,
-			lut_src[5601] / FRAC_SCALE ,
-			lut_src[5602] / FRAC_SCALE ,
-			lut_src[5603] / FRAC_SCALE ,
-			lut_src[5604] / FRAC_SCALE ,
-			lut_src[5605] / FRAC_SCALE ,
-			lut_src[5606] / FRAC_SCALE ,
-			lut_src[5607] / FRAC_SCALE ,
-			lut_src[5608] / FRAC_SCALE ,
-			lut_src[5609] / FRAC_SCALE ,
-			lut_src[5610] / FRAC_SCALE ,
-			lut_src[5611] / FRAC_SCALE ,
-			lut_src[5612] / FRAC_SCALE ,
-			lut_src[5613] / FRAC_SCALE ,
-			lut_src[5614] / FRAC_SCALE ,
-			lut_src[5615] / FRAC_SCALE ,
-			lut_src[5616] / FRAC_SCALE ,
-			lut_src[5617] / FRAC_SCALE ,
-			lut_src[5618] / FRAC_SCALE ,
-			lut_src[5619] / FRAC_SCALE ,
-			lut_src[5620] / FRAC_SCALE ,
-			lut_src[5621] / FRAC_SCALE ,
-			lut_src[5622] / FRAC_SCALE ,
-			lut_src[5623] / FRAC_SCALE ,
-			lut_src[5624] / FRAC_SCALE ,
-			lut_src[5625] / FRAC_SCALE ,
-			lut_src[5626] / FRAC_SCALE ,
-			lut_src[5627] / FRAC_SCALE ,
-			lut_src[5628] / FRAC_SCALE ,
-			lut_src[5629] / FRAC_SCALE ,
-			lut_src[5630] / FRAC_SCALE ,
-			lut_src[5631] / FRAC_SCALE ,
-			lut_src[5632] / FRAC_SCALE ,
-			lut_src[5633] / FRAC_SCALE ,
-			lut_src[5634] / FRAC_SCALE ,
-			lut_src[5635] / FRAC_SCALE ,
-			lut_src[5636] / FRAC_SCALE ,
-			lut_src[5637] / FRAC_SCALE ,
-			lut_src[5638] / FRAC_SCALE ,
-			lut_src[5639] / FRAC_SCALE ,
-			lut_src[5640] / FRAC_SCALE ,
-			lut_src[5641] / FRAC_SCALE ,
-			lut_src[5642] / FRAC_SCALE ,
-			lut_src[5643] / FRAC_SCALE ,
-			lut_src[5644] / FRAC_SCALE ,
-			lut_src[5645] / FRAC_SCALE ,
-			lut_src[5646] / FRAC_SCALE ,
-			lut_src[5647] / FRAC_SCALE ,
-			lut_src[5648] / FRAC_SCALE ,
-			lut_src[5649] / FRAC_SCALE ,
-			lut_src[5650] / FRAC_SCALE ,
-			lut_src[5651] / FRAC_SCALE ,
-			lut_src[5652] / FRAC_SCALE ,
-			lut_src[5653] / FRAC_SCALE ,
-			lut_src[5654] / FRAC_SCALE ,
-			lut_src[5655] / FRAC_SCALE ,
-			lut_src[5656] / FRAC_SCALE ,
-			lut_src[5657] / FRAC_SCALE ,
-			lut_src[5658] / FRAC_SCALE ,
-			lut_src[5659] / FRAC_SCALE ,
-			lut_src[5660] / FRAC_SCALE ,
-			lut_src[5661] / FRAC_SCALE ,
-			lut_src[5662] / FRAC_SCALE ,
-			lut_src[5663] / FRAC_SCALE ,
-			lut_src[5664] / FRAC_SCALE ,
-			lut_src[5665] / FRAC_SCALE ,
-			lut_src[5666] / FRAC_SCALE ,
-			lut_src[5667] / FRAC_SCALE ,
-			lut_src[5668] / FRAC_SCALE ,
-			lut_src[5669] / FRAC_SCALE ,
-			lut_src[5670] / FRAC_SCALE ,
-			lut_src[5671] / FRAC_SCALE ,
-			lut_src[5672] / FRAC_SCALE ,
-			lut_src[5673] / FRAC_SCALE ,
-			lut_src[5674] / FRAC_SCALE ,
-			lut_src[5675] / FRAC_SCALE ,
-			lut_src[5676] / FRAC_SCALE ,
-			lut_src[5677] / FRAC_SCALE ,
-			lut_src[5678] / FRAC_SCALE ,
-			lut_src[5679] / FRAC_SCALE ,
-			lut_src[5680] / FRAC_SCALE ,
-			lut_src[5681] / FRAC_SCALE ,
-			lut_src[5682] / FRAC_SCALE ,
-			lut_src[5683] / FRAC_SCALE ,
-			lut_src[5684] / FRAC_SCALE ,
-			lut_src[5685] / FRAC_SCALE ,
-			lut_src[5686] / FRAC_SCALE ,
-			lut_src[5687] / FRAC_SCALE ,
-			lut_src[5688] / FRAC_SCALE ,
-			lut_src[5689] / FRAC_SCALE ,
-			lut_src[5690] / FRAC_SCALE ,
-			lut_src[5691] / FRAC_SCALE ,
-			lut_src[5692] / FRAC_SCALE ,
-			lut_src[5693] / FRAC_SCALE ,
-			lut_src[5694] / FRAC_SCALE ,
-			lut_src[5695] / FRAC_SCALE ,
-			lut_src[5696] / FRAC_SCALE ,
-			lut_src[5697] / FRAC_SCALE ,
-			lut_src[5698] / FRAC_SCALE ,
-			lut_src[5699] / FRAC_SCALE ,
-			lut_src[5700] / FRAC_SCALE ,
-			lut_src[5701] / FRAC_SCALE ,
-			lut_src[5702] / FRAC_SCALE ,
-			lut_src[5703] / FRAC_SCALE ,
-			lut_src[5704] / FRAC_SCALE ,
-			lut_src[5705] / FRAC_SCALE ,
-			lut_src[5706] / FRAC_SCALE ,
-			lut_src[5707] / FRAC_SCALE ,
-			lut_src[5708] / FRAC_SCALE ,
-			lut_src[5709] / FRAC_SCALE ,
-			lut_src[5710] / FRAC_SCALE ,
-			lut_src[5711] / FRAC_SCALE ,
-			lut_src[5712] / FRAC_SCALE ,
-			lut_src[5713] / FRAC_SCALE ,
-			lut_src[5714] / FRAC_SCALE ,
-			lut_src[5715] / FRAC_SCALE ,
-			lut_src[5716] / FRAC_SCALE ,
-			lut_src[5717] / FRAC_SCALE ,
-			lut_src[5718] / FRAC_SCALE ,
-			lut_src[5719] / FRAC_SCALE ,
-			lut_src[5720] / FRAC_SCALE ,
-			lut_src[5721] / FRAC_SCALE ,
-			lut_src[5722] / FRAC_SCALE ,
-			lut_src[5723] / FRAC_SCALE ,
-			lut_src[5724] / FRAC_SCALE ,
-			lut_src[5725] / FRAC_SCALE ,
-			lut_src[5726] / FRAC_SCALE ,
-			lut_src[5727] / FRAC_SCALE ,
-			lut_src[5728] / FRAC_SCALE ,
-			lut_src[5729] / FRAC_SCALE ,
-			lut_src[5730] / FRAC_SCALE ,
-			lut_src[5731] / FRAC_SCALE ,
-			lut_src[5732] / FRAC_SCALE ,
-			lut_src[5733] / FRAC_SCALE ,
-			lut_src[5734] / FRAC_SCALE ,
-			lut_src[5735] / FRAC_SCALE ,
-			lut_src[5736] / FRAC_SCALE ,
-			lut_src[5737] / FRAC_SCALE ,
-			lut_src[5738] / FRAC_SCALE ,
-			lut_src[5739] / FRAC_SCALE ,
-			lut_src[5740] / FRAC_SCALE ,
-			lut_src[5741] / FRAC_SCALE ,
-			lut_src[5742] / FRAC_SCALE ,
-			lut_src[5743] / FRAC_SCALE ,
-			lut_src[5744] / FRAC_SCALE ,
-			lut_src[5745] / FRAC_SCALE ,
-			lut_src[5746] / FRAC_SCALE ,
-			lut_src[5747] / FRAC_SCALE ,
-			lut_src[5748] / FRAC_SCALE ,
-			lut_src[5749] / FRAC_SCALE ,
-			lut_src[5750] / FRAC_SCALE ,
-			lut_src[5751] / FRAC_SCALE ,
-			lut_src[5752] / FRAC_SCALE ,
-			lut_src[5753] / FRAC_SCALE ,
-			lut_src[5754] / FRAC_SCALE ,
-			lut_src[5755] / FRAC_SCALE ,
-			lut_src[5756] / FRAC_SCALE ,
-			lut_src[5757] / FRAC_SCALE ,
-			lut_src[5758] / FRAC_SCALE ,
-			lut_src[5759] / FRAC_SCALE ,
-			lut_src[5760] / FRAC_SCALE ,
-			lut_src[5761] / FRAC_SCALE ,
-			lut_src[5762] / FRAC_SCALE ,
-			lut_src[5763] / FRAC_SCALE ,
-			lut_src[5764] / FRAC_SCALE ,
-			lut_src[5765] / FRAC_SCALE ,
-			lut_src[5766] / FRAC_SCALE ,
-			lut_src[5767] / FRAC_SCALE ,
-			lut_src[5768] / FRAC_SCALE ,
-			lut_src[5769] / FRAC_SCALE ,
-			lut_src[5770] / FRAC_SCALE ,
-			lut_src[5771] / FRAC_SCALE ,
-			lut_src[5772] / FRAC_SCALE ,
-			lut_src[5773] / FRAC_SCALE ,
-			lut_src[5774] / FRAC_SCALE ,
-			lut_src[5775] / FRAC_SCALE ,
-			lut_src[5776] / FRAC_SCALE ,
-			lut_src[5777] / FRAC_SCALE ,
-			lut_src[5778] / FRAC_SCALE ,
-			lut_src[5779] / FRAC_SCALE ,
-			lut_src[5780] / FRAC_SCALE ,
-			lut_src[5781] / FRAC_SCALE ,
-			lut_src[5782] / FRAC_SCALE ,
-			lut_src[5783] / FRAC_SCALE ,
-			lut_src[5784] / FRAC_SCALE ,
-			lut_src[5785] / FRAC_SCALE ,
-			lut_src[5786] / FRAC_SCALE ,
-			lut_src[5787] / FRAC_SCALE ,
-			lut_src[5788] / FRAC_SCALE ,
-			lut_src[5789] / FRAC_SCALE ,
-			lut_src[5790] / FRAC_SCALE ,
-			lut_src[5791] / FRAC_SCALE ,
-			lut_src[5792] / FRAC_SCALE ,
-			lut_src[5793] / FRAC_SCALE ,
-			lut_src[5794] / FRAC_SCALE ,
-			lut_src[5795] / FRAC_SCALE ,
-			lut_src[5796] / FRAC_SCALE ,
-			lut_src[5797] / FRAC_SCALE ,
-			lut_src[5798] / FRAC_SCALE ,
-			lut_src[5799] / FRAC_SCALE ,
-			lut_src[5800] / FRAC_SCALE ,
-			lut_src[5801] / FRAC_SCALE ,
-			lut_src[5802] / FRAC_SCALE ,
-			lut_src[5803] / FRAC_SCALE ,
-			lut_src[5804] / FRAC_SCALE ,
-			lut_src[5805] / FRAC_SCALE ,
-			lut_src[5806] / FRAC_SCALE ,
-			lut_src[5807] / FRAC_SCALE ,
-			lut_src[5808] / FRAC_SCALE ,
-			lut_src[5809] / FRAC_SCALE ,
-			lut_src[5810] / FRAC_SCALE ,
-			lut_src[5811] / FRAC_SCALE ,
-			lut_src[5812] / FRAC_SCALE ,
-			lut_src[5813] / FRAC_SCALE ,
-			lut_src[5814] / FRAC_SCALE ,
-			lut_src[5815] / FRAC_SCALE ,
-			lut_src[5816] / FRAC_SCALE ,
-			lut_src[5817] / FRAC_SCALE ,
-			lut_src[5818] / FRAC_SCALE ,
-			lut_src[5819] / FRAC_SCALE ,
-			lut_src[5820] / FRAC_SCALE ,
-			lut_src[5821] / FRAC_SCALE ,
-			lut_src[5822] / FRAC_SCALE ,
-			lut_src[5823] / FRAC_SCALE ,
-			lut_src[5824] / FRAC_SCALE ,
-			lut_src[5825] / FRAC_SCALE ,
-			lut_src[5826] / FRAC_SCALE ,
-			lut_src[5827] / FRAC_SCALE ,
-			lut_src[5828] / FRAC_SCALE ,
-			lut_src[5829] / FRAC_SCALE ,
-			lut_src[5830] / FRAC_SCALE ,
-			lut_src[5831] / FRAC_SCALE ,
-			lut_src[5832] / FRAC_SCALE ,
-			lut_src[5833] / FRAC_SCALE ,
-			lut_src[5834] / FRAC_SCALE ,
-			lut_src[5835] / FRAC_SCALE ,
-			lut_src[5836] / FRAC_SCALE ,
-			lut_src[5837] / FRAC_SCALE ,
-			lut_src[5838] / FRAC_SCALE ,
-			lut_src[5839] / FRAC_SCALE ,
-			lut_src[5840] / FRAC_SCALE ,
-			lut_src[5841] / FRAC_SCALE ,
-			lut_src[5842] / FRAC_SCALE ,
-			lut_src[5843] / FRAC_SCALE ,
-			lut_src[5844] / FRAC_SCALE ,
-			lut_src[5845] / FRAC_SCALE ,
-			lut_src[5846] / FRAC_SCALE ,
-			lut_src[5847] / FRAC_SCALE ,
-			lut_src[5848] / FRAC_SCALE ,
-			lut_src[5849] / FRAC_SCALE ,
-			lut_src[5850] / FRAC_SCALE ,
-			lut_src[5851] / FRAC_SCALE ,
-			lut_src[5852] / FRAC_SCALE ,
-			lut_src[5853] / FRAC_SCALE ,
-			lut_src[5854] / FRAC_SCALE ,
-			lut_src[5855] / FRAC_SCALE ,
-			lut_src[5856] / FRAC_SCALE ,
-			lut_src[5857] / FRAC_SCALE ,
-			lut_src[5858] / FRAC_SCALE ,
-			lut_src[5859] / FRAC_SCALE ,
-			lut_src[5860] / FRAC_SCALE ,
-			lut_src[5861] / FRAC_SCALE ,
-			lut_src[5862] / FRAC_SCALE ,
-			lut_src[5863] / FRAC_SCALE ,
-			lut_src[5864] / FRAC_SCALE ,
-			lut_src[5865] / FRAC_SCALE ,
-			lut_src[5866] / FRAC_SCALE ,
-			lut_src[5867] / FRAC_SCALE ,
-			lut_src[5868] / FRAC_SCALE ,
-			lut_src[5869] / FRAC_SCALE ,
-			lut_src[5870] / FRAC_SCALE ,
-			lut_src[5871] / FRAC_SCALE ,
-			lut_src[5872] / FRAC_SCALE ,
-			lut_src[5873] / FRAC_SCALE ,
-			lut_src[5874] / FRAC_SCALE ,
-			lut_src[5875] / FRAC_SCALE ,
-			lut_src[5876] / FRAC_SCALE ,
-			lut_src[5877] / FRAC_SCALE ,
-			lut_src[5878] / FRAC_SCALE ,
-			lut_src[5879] / FRAC_SCALE ,
-			lut_src[5880] / FRAC_SCALE ,
-			lut_src[5881] / FRAC_SCALE ,
-			lut_src[5882] / FRAC_SCALE ,
-			lut_src[5883] / FRAC_SCALE ,
-			lut_src[5884] / FRAC_SCALE ,
-			lut_src[5885] / FRAC_SCALE ,
-			lut_src[5886] / FRAC_SCALE ,
-			lut_src[5887] / FRAC_SCALE ,
-			lut_src[5888] / FRAC_SCALE ,
-			lut_src[5889] / FRAC_SCALE ,
-			lut_src[5890] / FRAC_SCALE ,
-			lut_src[5891] / FRAC_SCALE ,
-			lut_src[5892] / FRAC_SCALE ,
-			lut_src[5893] / FRAC_SCALE ,
-			lut_src[5894] / FRAC_SCALE ,
-			lut_src[5895] / FRAC_SCALE ,
-			lut_src[5896] / FRAC_SCALE ,
-			lut_src[5897] / FRAC_SCALE ,
-			lut_src[5898] / FRAC_SCALE ,
-			lut_src[5899] / FRAC_SCALE ,
-			lut_src[5900] / FRAC_SCALE ,
-			lut_src[5901] / FRAC_SCALE ,
-			lut_src[5902] / FRAC_SCALE ,
-			lut_src[5903] / FRAC_SCALE ,
-			lut_src[5904] / FRAC_SCALE ,
-			lut_src[5905] / FRAC_SCALE ,
-			lut_src[5906] / FRAC_SCALE ,
-			lut_src[5907] / FRAC_SCALE ,
-			lut_src[5908] / FRAC_SCALE ,
-			lut_src[5909] / FRAC_SCALE ,
-			lut_src[5910] / FRAC_SCALE ,
-			lut_src[5911] / FRAC_SCALE ,
-			lut_src[5912] / FRAC_SCALE ,
-			lut_src[5913] / FRAC_SCALE ,
-			lut_src[5914] / FRAC_SCALE ,
-			lut_src[5915] / FRAC_SCALE ,
-			lut_src[5916] / FRAC_SCALE ,
-			lut_src[5917] / FRAC_SCALE ,
-			lut_src[5918] / FRAC_SCALE ,
-			lut_src[5919] / FRAC_SCALE ,
-			lut_src[5920] / FRAC_SCALE ,
-			lut_src[5921] / FRAC_SCALE ,
-			lut_src[5922] / FRAC_SCALE ,
-			lut_src[5923] / FRAC_SCALE ,
-			lut_src[5924] / FRAC_SCALE ,
-			lut_src[5925] / FRAC_SCALE ,
-			lut_src[5926] / FRAC_SCALE ,
-			lut_src[5927] / FRAC_SCALE ,
-			lut_src[5928] / FRAC_SCALE ,
-			lut_src[5929] / FRAC_SCALE ,
-			lut_src[5930] / FRAC_SCALE ,
-			lut_src[5931] / FRAC_SCALE ,
-			lut_src[5932] / FRAC_SCALE ,
-			lut_src[5933] / FRAC_SCALE ,
-			lut_src[5934] / FRAC_SCALE ,
-			lut_src[5935] / FRAC_SCALE ,
-			lut_src[5936] / FRAC_SCALE ,
-			lut_src[5937] / FRAC_SCALE ,
-			lut_src[5938] / FRAC_SCALE ,
-			lut_src[5939] / FRAC_SCALE ,
-			lut_src[5940] / FRAC_SCALE ,
-			lut_src[5941] / FRAC_SCALE ,
-			lut_src[5942] / FRAC_SCALE ,
-			lut_src[5943] / FRAC_SCALE ,
-			lut_src[5944] / FRAC_SCALE ,
-			lut_src[5945] / FRAC_SCALE ,
-			lut_src[5946] / FRAC_SCALE ,
-			lut_src[5947] / FRAC_SCALE ,
-			lut_src[5948] / FRAC_SCALE ,
-			lut_src[5949] / FRAC_SCALE ,
-			lut_src[5950] / FRAC_SCALE ,
-			lut_src[5951] / FRAC_SCALE ,
-			lut_src[5952] / FRAC_SCALE ,
-			lut_src[5953] / FRAC_SCALE ,
-			lut_src[5954] / FRAC_SCALE ,
-			lut_src[5955] / FRAC_SCALE ,
-			lut_src[5956] / FRAC_SCALE ,
-			lut_src[5957] / FRAC_SCALE ,
-			lut_src[5958] / FRAC_SCALE ,
-			lut_src[5959] / FRAC_SCALE ,
-			lut_src[5960] / FRAC_SCALE ,
-			lut_src[5961] / FRAC_SCALE ,
-			lut_src[5962] / FRAC_SCALE ,
-			lut_src[5963] / FRAC_SCALE ,
-			lut_src[5964] / FRAC_SCALE ,
-			lut_src[5965] / FRAC_SCALE ,
-			lut_src[5966] / FRAC_SCALE ,
-			lut_src[5967] / FRAC_SCALE ,
-			lut_src[5968] / FRAC_SCALE ,
-			lut_src[5969] / FRAC_SCALE ,
-			lut_src[5970] / FRAC_SCALE ,
-			lut_src[5971] / FRAC_SCALE ,
-			lut_src[5972] / FRAC_SCALE ,
-			lut_src[5973] / FRAC_SCALE ,
-			lut_src[5974] / FRAC_SCALE ,
-			lut_src[5975] / FRAC_SCALE ,
-			lut_src[5976] / FRAC_SCALE ,
-			lut_src[5977] / FRAC_SCALE ,
-			lut_src[5978] / FRAC_SCALE ,
-			lut_src[5979] / FRAC_SCALE ,
-			lut_src[5980] / FRAC_SCALE ,
-			lut_src[5981] / FRAC_SCALE ,
-			lut_src[5982] / FRAC_SCALE ,
-			lut_src[5983] / FRAC_SCALE ,
-			lut_src[5984] / FRAC_SCALE ,
-			lut_src[5985] / FRAC_SCALE ,
-			lut_src[5986] / FRAC_SCALE ,
-			lut_src[5987] / FRAC_SCALE ,
-			lut_src[5988] / FRAC_SCALE ,
-			lut_src[5989] / FRAC_SCALE ,
-			lut_src[5990] / FRAC_SCALE ,
-			lut_src[5991] / FRAC_SCALE ,
-			lut_src[5992] / FRAC_SCALE ,
-			lut_src[5993] / FRAC_SCALE ,
-			lut_src[5994] / FRAC_SCALE ,
-			lut_src[5995] / FRAC_SCALE ,
-			lut_src[5996] / FRAC_SCALE ,
-			lut_src[5997] / FRAC_SCALE ,
-			lut_src[5998] / FRAC_SCALE ,
-			lut_src[5999] / FRAC_SCALE ,
-			lut_src[6000] / FRAC_SCALE ,
-			lut_src[6001] / FRAC_SCALE ,
-			lut_src[6002] / FRAC_SCALE ,
-			lut_src[6003] / FRAC_SCALE ,
-			lut_src[6004] / FRAC_SCALE ,
-			lut_src[6005] / FRAC_SCALE ,
-			lut_src[6006] / FRAC_SCALE ,
-			lut_src[6007] / FRAC_SCALE ,
-			lut_src[6008] / FRAC_SCALE ,
-			lut_src[6009] / FRAC_SCALE ,
-			lut_src[6010] / FRAC_SCALE ,
-			lut_src[6011] / FRAC_SCALE ,
-			lut_src[6012] / FRAC_SCALE ,
-			lut_src[6013] / FRAC_SCALE ,
-			lut_src[6014] / FRAC_SCALE ,
-			lut_src[6015] / FRAC_SCALE ,
-			lut_src[6016] / FRAC_SCALE ,
-			lut_src[6017] / FRAC_SCALE ,
-			lut_src[6018] / FRAC_SCALE ,
-			lut_src[6019] / FRAC_SCALE ,
-			lut_src[6020] / FRAC_SCALE ,
-			lut_src[6021] / FRAC_SCALE ,
-			lut_src[6022] / FRAC_SCALE ,
-			lut_src[6023] / FRAC_SCALE ,
-			lut_src[6024] / FRAC_SCALE ,
-			lut_src[6025] / FRAC_SCALE ,
-			lut_src[6026] / FRAC_SCALE ,
-			lut_src[6027] / FRAC_SCALE ,
-			lut_src[6028] / FRAC_SCALE ,
-			lut_src[6029] / FRAC_SCALE ,
-			lut_src[6030] / FRAC_SCALE ,
-			lut_src[6031] / FRAC_SCALE ,
-			lut_src[6032] / FRAC_SCALE ,
-			lut_src[6033] / FRAC_SCALE ,
-			lut_src[6034] / FRAC_SCALE ,
-			lut_src[6035] / FRAC_SCALE ,
-			lut_src[6036] / FRAC_SCALE ,
-			lut_src[6037] / FRAC_SCALE ,
-			lut_src[6038] / FRAC_SCALE ,
-			lut_src[6039] / FRAC_SCALE ,
-			lut_src[6040] / FRAC_SCALE ,
-			lut_src[6041] / FRAC_SCALE ,
-			lut_src[6042] / FRAC_SCALE ,
-			lut_src[6043] / FRAC_SCALE ,
-			lut_src[6044] / FRAC_SCALE ,
-			lut_src[6045] / FRAC_SCALE ,
-			lut_src[6046] / FRAC_SCALE ,
-			lut_src[6047] / FRAC_SCALE ,
-			lut_src[6048] / FRAC_SCALE ,
-			lut_src[6049] / FRAC_SCALE ,
-			lut_src[6050] / FRAC_SCALE ,
-			lut_src[6051] / FRAC_SCALE ,
-			lut_src[6052] / FRAC_SCALE ,
-			lut_src[6053] / FRAC_SCALE ,
-			lut_src[6054] / FRAC_SCALE ,
-			lut_src[6055] / FRAC_SCALE ,
-			lut_src[6056] / FRAC_SCALE ,
-			lut_src[6057] / FRAC_SCALE ,
-			lut_src[6058] / FRAC_SCALE ,
-			lut_src[6059] / FRAC_SCALE ,
-			lut_src[6060] / FRAC_SCALE ,
-			lut_src[6061] / FRAC_SCALE ,
-			lut_src[6062] / FRAC_SCALE ,
-			lut_src[6063] / FRAC_SCALE ,
-			lut_src[6064] / FRAC_SCALE ,
-			lut_src[6065] / FRAC_SCALE ,
-			lut_src[6066] / FRAC_SCALE ,
-			lut_src[6067] / FRAC_SCALE ,
-			lut_src[6068] / FRAC_SCALE ,
-			lut_src[6069] / FRAC_SCALE ,
-			lut_src[6070] / FRAC_SCALE ,
-			lut_src[6071] / FRAC_SCALE ,
-			lut_src[6072] / FRAC_SCALE ,
-			lut_src[6073] / FRAC_SCALE ,
-			lut_src[6074] / FRAC_SCALE ,
-			lut_src[6075] / FRAC_SCALE ,
-			lut_src[6076] / FRAC_SCALE ,
-			lut_src[6077] / FRAC_SCALE ,
-			lut_src[6078] / FRAC_SCALE ,
-			lut_src[6079] / FRAC_SCALE ,
-			lut_src[6080] / FRAC_SCALE ,
-			lut_src[6081] / FRAC_SCALE ,
-			lut_src[6082] / FRAC_SCALE ,
-			lut_src[6083] / FRAC_SCALE ,
-			lut_src[6084] / FRAC_SCALE ,
-			lut_src[6085] / FRAC_SCALE ,
-			lut_src[6086] / FRAC_SCALE ,
-			lut_src[6087] / FRAC_SCALE ,
-			lut_src[6088] / FRAC_SCALE ,
-			lut_src[6089] / FRAC_SCALE ,
-			lut_src[6090] / FRAC_SCALE ,
-			lut_src[6091] / FRAC_SCALE ,
-			lut_src[6092] / FRAC_SCALE ,
-			lut_src[6093] / FRAC_SCALE ,
-			lut_src[6094] / FRAC_SCALE ,
-			lut_src[6095] / FRAC_SCALE ,
-			lut_src[6096] / FRAC_SCALE ,
-			lut_src[6097] / FRAC_SCALE ,
-			lut_src[6098] / FRAC_SCALE ,
-			lut_src[6099] / FRAC_SCALE ,
-			lut_src[6100] / FRAC_SCALE ,
-			lut_src[6101] / FRAC_SCALE ,
-			lut_src[6102] / FRAC_SCALE ,
-			lut_src[6103] / FRAC_SCALE ,
-			lut_src[6104] / FRAC_SCALE ,
-			lut_src[6105] / FRAC_SCALE ,
-			lut_src[6106] / FRAC_SCALE ,
-			lut_src[6107] / FRAC_SCALE ,
-			lut_src[6108] / FRAC_SCALE ,
-			lut_src[6109] / FRAC_SCALE ,
-			lut_src[6110] / FRAC_SCALE ,
-			lut_src[6111] / FRAC_SCALE ,
-			lut_src[6112] / FRAC_SCALE ,
-			lut_src[6113] / FRAC_SCALE ,
-			lut_src[6114] / FRAC_SCALE ,
-			lut_src[6115] / FRAC_SCALE ,
-			lut_src[6116] / FRAC_SCALE ,
-			lut_src[6117] / FRAC_SCALE ,
-			lut_src[6118] / FRAC_SCALE ,
-			lut_src[6119] / FRAC_SCALE ,
-			lut_src[6120] / FRAC_SCALE ,
-			lut_src[6121] / FRAC_SCALE ,
-			lut_src[6122] / FRAC_SCALE ,
-			lut_src[6123] / FRAC_SCALE ,
-			lut_src[6124] / FRAC_SCALE ,
-			lut_src[6125] / FRAC_SCALE ,
-			lut_src[6126] / FRAC_SCALE ,
-			lut_src[6127] / FRAC_SCALE ,
-			lut_src[6128] / FRAC_SCALE ,
-			lut_src[6129] / FRAC_SCALE ,
-			lut_src[6130] / FRAC_SCALE ,
-			lut_src[6131] / FRAC_SCALE ,
-			lut_src[6132] / FRAC_SCALE ,
-			lut_src[6133] / FRAC_SCALE ,
-			lut_src[6134] / FRAC_SCALE ,
-			lut_src[6135] / FRAC_SCALE ,
-			lut_src[6136] / FRAC_SCALE ,
-			lut_src[6137] / FRAC_SCALE ,
-			lut_src[6138] / FRAC_SCALE ,
-			lut_src[6139] / FRAC_SCALE ,
-			lut_src[6140] / FRAC_SCALE ,
-			lut_src[6141] / FRAC_SCALE ,
-			lut_src[6142] / FRAC_SCALE ,
-			lut_src[6143] / FRAC_SCALE ,
-			lut_src[6144] / FRAC_SCALE ,
-			lut_src[6145] / FRAC_SCALE ,
-			lut_src[6146] / FRAC_SCALE ,
-			lut_src[6147] / FRAC_SCALE ,
-			lut_src[6148] / FRAC_SCALE ,
-			lut_src[6149] / FRAC_SCALE ,
-			lut_src[6150] / FRAC_SCALE ,
-			lut_src[6151] / FRAC_SCALE ,
-			lut_src[6152] / FRAC_SCALE ,
-			lut_src[6153] / FRAC_SCALE ,
-			lut_src[6154] / FRAC_SCALE ,
-			lut_src[6155] / FRAC_SCALE ,
-			lut_src[6156] / FRAC_SCALE ,
-			lut_src[6157] / FRAC_SCALE ,
-			lut_src[6158] / FRAC_SCALE ,
-			lut_src[6159] / FRAC_SCALE ,
-			lut_src[6160] / FRAC_SCALE ,
-			lut_src[6161] / FRAC_SCALE ,
-			lut_src[6162] / FRAC_SCALE ,
-			lut_src[6163] / FRAC_SCALE ,
-			lut_src[6164] / FRAC_SCALE ,
-			lut_src[6165] / FRAC_SCALE ,
-			lut_src[6166] / FRAC_SCALE ,
-			lut_src[6167] / FRAC_SCALE ,
-			lut_src[6168] / FRAC_SCALE ,
-			lut_src[6169] / FRAC_SCALE ,
-			lut_src[6170] / FRAC_SCALE ,
-			lut_src[6171] / FRAC_SCALE ,
-			lut_src[6172] / FRAC_SCALE ,
-			lut_src[6173] / FRAC_SCALE ,
-			lut_src[6174] / FRAC_SCALE ,
-			lut_src[6175] / FRAC_SCALE ,
-			lut_src[6176] / FRAC_SCALE ,
-			lut_src[6177] / FRAC_SCALE ,
-			lut_src[6178] / FRAC_SCALE ,
-			lut_src[6179] / FRAC_SCALE ,
-			lut_src[6180] / FRAC_SCALE ,
-			lut_src[6181] / FRAC_SCALE ,
-			lut_src[6182] / FRAC_SCALE ,
-			lut_src[6183] / FRAC_SCALE ,
-			lut_src[6184] / FRAC_SCALE ,
-			lut_src[6185] / FRAC_SCALE ,
-			lut_src[6186] / FRAC_SCALE ,
-			lut_src[6187] / FRAC_SCALE ,
-			lut_src[6188] / FRAC_SCALE ,
-			lut_src[6189] / FRAC_SCALE ,
-			lut_src[6190] / FRAC_SCALE ,
-			lut_src[6191] / FRAC_SCALE ,
-			lut_src[6192] / FRAC_SCALE ,
-			lut_src[6193] / FRAC_SCALE ,
-			lut_src[6194] / FRAC_SCALE ,
-			lut_src[6195] / FRAC_SCALE ,
-			lut_src[6196] / FRAC_SCALE ,
-			lut_src[6197] / FRAC_SCALE ,
-			lut_src[6198] / FRAC_SCALE ,
-			lut_src[6199] / FRAC_SCALE ,
-			lut_src[6200] / FRAC_SCALE ,
-			lut_src[6201] / FRAC_SCALE ,
-			lut_src[6202] / FRAC_SCALE ,
-			lut_src[6203] / FRAC_SCALE ,
-			lut_src[6204] / FRAC_SCALE ,
-			lut_src[6205] / FRAC_SCALE ,
-			lut_src[6206] / FRAC_SCALE ,
-			lut_src[6207] / FRAC_SCALE ,
-			lut_src[6208] / FRAC_SCALE ,
-			lut_src[6209] / FRAC_SCALE ,
-			lut_src[6210] / FRAC_SCALE ,
-			lut_src[6211] / FRAC_SCALE ,
-			lut_src[6212] / FRAC_SCALE ,
-			lut_src[6213] / FRAC_SCALE ,
-			lut_src[6214] / FRAC_SCALE ,
-			lut_src[6215] / FRAC_SCALE ,
-			lut_src[6216] / FRAC_SCALE ,
-			lut_src[6217] / FRAC_SCALE ,
-			lut_src[6218] / FRAC_SCALE ,
-			lut_src[6219] / FRAC_SCALE ,
-			lut_src[6220] / FRAC_SCALE ,
-			lut_src[6221] / FRAC_SCALE ,
-			lut_src[6222] / FRAC_SCALE ,
-			lut_src[6223] / FRAC_SCALE ,
-			lut_src[6224] / FRAC_SCALE ,
-			lut_src[6225] / FRAC_SCALE ,
-			lut_src[6226] / FRAC_SCALE ,
-			lut_src[6227] / FRAC_SCALE ,
-			lut_src[6228] / FRAC_SCALE ,
-			lut_src[6229] / FRAC_SCALE ,
-			lut_src[6230] / FRAC_SCALE ,
-			lut_src[6231] / FRAC_SCALE ,
-			lut_src[6232] / FRAC_SCALE ,
-			lut_src[6233] / FRAC_SCALE ,
-			lut_src[6234] / FRAC_SCALE ,
-			lut_src[6235] / FRAC_SCALE ,
-			lut_src[6236] / FRAC_SCALE ,
-			lut_src[6237] / FRAC_SCALE ,
-			lut_src[6238] / FRAC_SCALE ,
-			lut_src[6239] / FRAC_SCALE ,
-			lut_src[6240] / FRAC_SCALE ,
-			lut_src[6241] / FRAC_SCALE ,
-			lut_src[6242] / FRAC_SCALE ,
-			lut_src[6243] / FRAC_SCALE ,
-			lut_src[6244] / FRAC_SCALE ,
-			lut_src[6245] / FRAC_SCALE ,
-			lut_src[6246] / FRAC_SCALE ,
-			lut_src[6247] / FRAC_SCALE ,
-			lut_src[6248] / FRAC_SCALE ,
-			lut_src[6249] / FRAC_SCALE ,
-			lut_src[6250] / FRAC_SCALE ,
-			lut_src[6251] / FRAC_SCALE ,
-			lut_src[6252] / FRAC_SCALE ,
-			lut_src[6253] / FRAC_SCALE ,
-			lut_src[6254] / FRAC_SCALE ,
-			lut_src[6255] / FRAC_SCALE ,
-			lut_src[6256] / FRAC_SCALE ,
-			lut_src[6257] / FRAC_SCALE ,
-			lut_src[6258] / FRAC_SCALE ,
-			lut_src[6259] / FRAC_SCALE ,
-			lut_src[6260] / FRAC_SCALE ,
-			lut_src[6261] / FRAC_SCALE ,
-			lut_src[6262] / FRAC_SCALE ,
-			lut_src[6263] / FRAC_SCALE ,
-			lut_src[6264] / FRAC_SCALE ,
-			lut_src[6265] / FRAC_SCALE ,
-			lut_src[6266] / FRAC_SCALE ,
-			lut_src[6267] / FRAC_SCALE ,
-			lut_src[6268] / FRAC_SCALE ,
-			lut_src[6269] / FRAC_SCALE ,
-			lut_src[6270] / FRAC_SCALE ,
-			lut_src[6271] / FRAC_SCALE ,
-			lut_src[6272] / FRAC_SCALE ,
-			lut_src[6273] / FRAC_SCALE ,
-			lut_src[6274] / FRAC_SCALE ,
-			lut_src[6275] / FRAC_SCALE ,
-			lut_src[6276] / FRAC_SCALE ,
-			lut_src[6277] / FRAC_SCALE ,
-			lut_src[6278] / FRAC_SCALE ,
-			lut_src[6279] / FRAC_SCALE ,
-			lut_src[6280] / FRAC_SCALE ,
-			lut_src[6281] / FRAC_SCALE ,
-			lut_src[6282] / FRAC_SCALE ,
-			lut_src[6283] / FRAC_SCALE ,
-			lut_src[6284] / FRAC_SCALE ,
-			lut_src[6285] / FRAC_SCALE ,
-			lut_src[6286] / FRAC_SCALE ,
-			lut_src[6287] / FRAC_SCALE ,
-			lut_src[6288] / FRAC_SCALE ,
-			lut_src[6289] / FRAC_SCALE ,
-			lut_src[6290] / FRAC_SCALE ,
-			lut_src[6291] / FRAC_SCALE ,
-			lut_src[6292] / FRAC_SCALE ,
-			lut_src[6293] / FRAC_SCALE ,
-			lut_src[6294] / FRAC_SCALE ,
-			lut_src[6295] / FRAC_SCALE ,
-			lut_src[6296] / FRAC_SCALE ,
-			lut_src[6297] / FRAC_SCALE ,
-			lut_src[6298] / FRAC_SCALE ,
-			lut_src[6299] / FRAC_SCALE ,
-			lut_src[6300] / FRAC_SCALE ,
-			lut_src[6301] / FRAC_SCALE ,
-			lut_src[6302] / FRAC_SCALE ,
-			lut_src[6303] / FRAC_SCALE ,
-			lut_src[6304] / FRAC_SCALE ,
-			lut_src[6305] / FRAC_SCALE ,
-			lut_src[6306] / FRAC_SCALE ,
-			lut_src[6307] / FRAC_SCALE ,
-			lut_src[6308] / FRAC_SCALE ,
-			lut_src[6309] / FRAC_SCALE ,
-			lut_src[6310] / FRAC_SCALE ,
-			lut_src[6311] / FRAC_SCALE ,
-			lut_src[6312] / FRAC_SCALE ,
-			lut_src[6313] / FRAC_SCALE ,
-			lut_src[6314] / FRAC_SCALE ,
-			lut_src[6315] / FRAC_SCALE ,
-			lut_src[6316] / FRAC_SCALE ,
-			lut_src[6317] / FRAC_SCALE ,
-			lut_src[6318] / FRAC_SCALE ,
-			lut_src[6319] / FRAC_SCALE ,
-			lut_src[6320] / FRAC_SCALE ,
-			lut_src[6321] / FRAC_SCALE ,
-			lut_src[6322] / FRAC_SCALE ,
-			lut_src[6323] / FRAC_SCALE ,
-			lut_src[6324] / FRAC_SCALE ,
-			lut_src[6325] / FRAC_SCALE ,
-			lut_src[6326] / FRAC_SCALE ,
-			lut_src[6327] / FRAC_SCALE ,
-			lut_src[6328] / FRAC_SCALE ,
-			lut_src[6329] / FRAC_SCALE ,
-			lut_src[6330] / FRAC_SCALE ,
-			lut_src[6331] / FRAC_SCALE ,
-			lut_src[6332] / FRAC_SCALE ,
-			lut_src[6333] / FRAC_SCALE ,
-			lut_src[6334] / FRAC_SCALE ,
-			lut_src[6335] / FRAC_SCALE ,
-			lut_src[6336] / FRAC_SCALE ,
-			lut_src[6337] / FRAC_SCALE ,
-			lut_src[6338] / FRAC_SCALE ,
-			lut_src[6339] / FRAC_SCALE ,
-			lut_src[6340] / FRAC_SCALE ,
-			lut_src[6341] / FRAC_SCALE ,
-			lut_src[6342] / FRAC_SCALE ,
-			lut_src[6343] / FRAC_SCALE ,
-			lut_src[6344] / FRAC_SCALE ,
-			lut_src[6345] / FRAC_SCALE ,
-			lut_src[6346] / FRAC_SCALE ,
-			lut_src[6347] / FRAC_SCALE ,
-			lut_src[6348] / FRAC_SCALE ,
-			lut_src[6349] / FRAC_SCALE ,
-			lut_src[6350] / FRAC_SCALE ,
-			lut_src[6351] / FRAC_SCALE ,
-			lut_src[6352] / FRAC_SCALE ,
-			lut_src[6353] / FRAC_SCALE ,
-			lut_src[6354] / FRAC_SCALE ,
-			lut_src[6355] / FRAC_SCALE ,
-			lut_src[6356] / FRAC_SCALE ,
-			lut_src[6357] / FRAC_SCALE ,
-			lut_src[6358] / FRAC_SCALE ,
-			lut_src[6359] / FRAC_SCALE ,
-			lut_src[6360] / FRAC_SCALE ,
-			lut_src[6361] / FRAC_SCALE ,
-			lut_src[6362] / FRAC_SCALE ,
-			lut_src[6363] / FRAC_SCALE ,
-			lut_src[6364] / FRAC_SCALE ,
-			lut_src[6365] / FRAC_SCALE ,
-			lut_src[6366] / FRAC_SCALE ,
-			lut_src[6367] / FRAC_SCALE ,
-			lut_src[6368] / FRAC_SCALE ,
-			lut_src[6369] / FRAC_SCALE ,
-			lut_src[6370] / FRAC_SCALE ,
-			lut_src[6371] / FRAC_SCALE ,
-			lut_src[6372] / FRAC_SCALE ,
-			lut_src[6373] / FRAC_SCALE ,
-			lut_src[6374] / FRAC_SCALE ,
-			lut_src[6375] / FRAC_SCALE ,
-			lut_src[6376] / FRAC_SCALE ,
-			lut_src[6377] / FRAC_SCALE ,
-			lut_src[6378] / FRAC_SCALE ,
-			lut_src[6379] / FRAC_SCALE ,
-			lut_src[6380] / FRAC_SCALE ,
-			lut_src[6381] / FRAC_SCALE ,
-			lut_src[6382] / FRAC_SCALE ,
-			lut_src[6383] / FRAC_SCALE ,
-			lut_src[6384] / FRAC_SCALE ,
-			lut_src[6385] / FRAC_SCALE ,
-			lut_src[6386] / FRAC_SCALE ,
-			lut_src[6387] / FRAC_SCALE ,
-			lut_src[6388] / FRAC_SCALE ,
-			lut_src[6389] / FRAC_SCALE ,
-			lut_src[6390] / FRAC_SCALE ,
-			lut_src[6391] / FRAC_SCALE ,
-			lut_src[6392] / FRAC_SCALE ,
-			lut_src[6393] / FRAC_SCALE ,
-			lut_src[6394] / FRAC_SCALE ,
-			lut_src[6395] / FRAC_SCALE ,
-			lut_src[6396] / FRAC_SCALE ,
-			lut_src[6397] / FRAC_SCALE ,
-			lut_src[6398] / FRAC_SCALE ,
-			lut_src[6399] / FRAC_SCALE ,
-			lut_src[6400] / FRAC_SCALE ,
-			lut_src[6401] / FRAC_SCALE ,
-			lut_src[6402] / FRAC_SCALE ,
-			lut_src[6403] / FRAC_SCALE ,
-			lut_src[6404] / FRAC_SCALE ,
-			lut_src[6405] / FRAC_SCALE ,
-			lut_src[6406] / FRAC_SCALE ,
-			lut_src[6407] / FRAC_SCALE ,
-			lut_src[6408] / FRAC_SCALE ,
-			lut_src[6409] / FRAC_SCALE ,
-			lut_src[6410] / FRAC_SCALE ,
-			lut_src[6411] / FRAC_SCALE ,
-			lut_src[6412] / FRAC_SCALE ,
-			lut_src[6413] / FRAC_SCALE ,
-			lut_src[6414] / FRAC_SCALE ,
-			lut_src[6415] / FRAC_SCALE ,
-			lut_src[6416] / FRAC_SCALE ,
-			lut_src[6417] / FRAC_SCALE ,
-			lut_src[6418] / FRAC_SCALE ,
-			lut_src[6419] / FRAC_SCALE ,
-			lut_src[6420] / FRAC_SCALE ,
-			lut_src[6421] / FRAC_SCALE ,
-			lut_src[6422] / FRAC_SCALE ,
-			lut_src[6423] / FRAC_SCALE ,
-			lut_src[6424] / FRAC_SCALE ,
-			lut_src[6425] / FRAC_SCALE ,
-			lut_src[6426] / FRAC_SCALE ,
-			lut_src[6427] / FRAC_SCALE ,
-			lut_src[6428] / FRAC_SCALE ,
-			lut_src[6429] / FRAC_SCALE ,
-			lut_src[6430] / FRAC_SCALE ,
-			lut_src[6431] / FRAC_SCALE ,
-			lut_src[6432] / FRAC_SCALE ,
-			lut_src[6433] / FRAC_SCALE ,
-			lut_src[6434] / FRAC_SCALE ,
-			lut_src[6435] / FRAC_SCALE ,
-			lut_src[6436] / FRAC_SCALE ,
-			lut_src[6437] / FRAC_SCALE ,
-			lut_src[6438] / FRAC_SCALE ,
-			lut_src[6439] / FRAC_SCALE ,
-			lut_src[6440] / FRAC_SCALE ,
-			lut_src[6441] / FRAC_SCALE ,
-			lut_src[6442] / FRAC_SCALE ,
-			lut_src[6443] / FRAC_SCALE ,
-			lut_src[6444] / FRAC_SCALE ,
-			lut_src[6445] / FRAC_SCALE ,
-			lut_src[6446] / FRAC_SCALE ,
-			lut_src[6447] / FRAC_SCALE ,
-			lut_src[6448] / FRAC_SCALE ,
-			lut_src[6449] / FRAC_SCALE ,
-			lut_src[6450] / FRAC_SCALE ,
-			lut_src[6451] / FRAC_SCALE ,
-			lut_src[6452] / FRAC_SCALE ,
-			lut_src[6453] / FRAC_SCALE ,
-			lut_src[6454] / FRAC_SCALE ,
-			lut_src[6455] / FRAC_SCALE ,
-			lut_src[6456] / FRAC_SCALE ,
-			lut_src[6457] / FRAC_SCALE ,
-			lut_src[6458] / FRAC_SCALE ,
-			lut_src[6459] / FRAC_SCALE ,
-			lut_src[6460] / FRAC_SCALE ,
-			lut_src[6461] / FRAC_SCALE ,
-			lut_src[6462] / FRAC_SCALE ,
-			lut_src[6463] / FRAC_SCALE ,
-			lut_src[6464] / FRAC_SCALE ,
-			lut_src[6465] / FRAC_SCALE ,
-			lut_src[6466] / FRAC_SCALE ,
-			lut_src[6467] / FRAC_SCALE ,
-			lut_src[6468] / FRAC_SCALE ,
-			lut_src[6469] / FRAC_SCALE ,
-			lut_src[6470] / FRAC_SCALE ,
-			lut_src[6471] / FRAC_SCALE ,
-			lut_src[6472] / FRAC_SCALE ,
-			lut_src[6473] / FRAC_SCALE ,
-			lut_src[6474] / FRAC_SCALE ,
-			lut_src[6475] / FRAC_SCALE ,
-			lut_src[6476] / FRAC_SCALE ,
-			lut_src[6477] / FRAC_SCALE ,
-			lut_src[6478] / FRAC_SCALE ,
-			lut_src[6479] / FRAC_SCALE ,
-			lut_src[6480] / FRAC_SCALE ,
-			lut_src[6481] / FRAC_SCALE ,
-			lut_src[6482] / FRAC_SCALE ,
-			lut_src[6483] / FRAC_SCALE ,
-			lut_src[6484] / FRAC_SCALE ,
-			lut_src[6485] / FRAC_SCALE ,
-			lut_src[6486] / FRAC_SCALE ,
-			lut_src[6487] / FRAC_SCALE ,
-			lut_src[6488] / FRAC_SCALE ,
-			lut_src[6489] / FRAC_SCALE ,
-			lut_src[6490] / FRAC_SCALE ,
-			lut_src[6491] / FRAC_SCALE ,
-			lut_src[6492] / FRAC_SCALE ,
-			lut_src[6493] / FRAC_SCALE ,
-			lut_src[6494] / FRAC_SCALE ,
-			lut_src[6495] / FRAC_SCALE ,
-			lut_src[6496] / FRAC_SCALE ,
-			lut_src[6497] / FRAC_SCALE ,
-			lut_src[6498] / FRAC_SCALE ,
-			lut_src[6499] / FRAC_SCALE ,
-			lut_src[6500] / FRAC_SCALE ,
-			lut_src[6501] / FRAC_SCALE ,
-			lut_src[6502] / FRAC_SCALE ,
-			lut_src[6503] / FRAC_SCALE ,
-			lut_src[6504] / FRAC_SCALE ,
-			lut_src[6505] / FRAC_SCALE ,
-			lut_src[6506] / FRAC_SCALE ,
-			lut_src[6507] / FRAC_SCALE ,
-			lut_src[6508] / FRAC_SCALE ,
-			lut_src[6509] / FRAC_SCALE ,
-			lut_src[6510] / FRAC_SCALE ,
-			lut_src[6511] / FRAC_SCALE ,
-			lut_src[6512] / FRAC_SCALE ,
-			lut_src[6513] / FRAC_SCALE ,
-			lut_src[6514] / FRAC_SCALE ,
-			lut_src[6515] / FRAC_SCALE ,
-			lut_src[6516] / FRAC_SCALE ,
-			lut_src[6517] / FRAC_SCALE ,
-			lut_src[6518] / FRAC_SCALE ,
-			lut_src[6519] / FRAC_SCALE ,
-			lut_src[6520] / FRAC_SCALE ,
-			lut_src[6521] / FRAC_SCALE ,
-			lut_src[6522] / FRAC_SCALE ,
-			lut_src[6523] / FRAC_SCALE ,
-			lut_src[6524] / FRAC_SCALE ,
-			lut_src[6525] / FRAC_SCALE ,
-			lut_src[6526] / FRAC_SCALE ,
-			lut_src[6527] / FRAC_SCALE ,
-			lut_src[6528] / FRAC_SCALE ,
-			lut_src[6529] / FRAC_SCALE ,
-			lut_src[6530] / FRAC_SCALE ,
-			lut_src[6531] / FRAC_SCALE ,
-			lut_src[6532] / FRAC_SCALE ,
-			lut_src[6533] / FRAC_SCALE ,
-			lut_src[6534] / FRAC_SCALE ,
-			lut_src[6535] / FRAC_SCALE ,
-			lut_src[6536] / FRAC_SCALE ,
-			lut_src[6537] / FRAC_SCALE ,
-			lut_src[6538] / FRAC_SCALE ,
-			lut_src[6539] / FRAC_SCALE ,
-			lut_src[6540] / FRAC_SCALE ,
-			lut_src[6541] / FRAC_SCALE ,
-			lut_src[6542] / FRAC_SCALE ,
-			lut_src[6543] / FRAC_SCALE ,
-			lut_src[6544] / FRAC_SCALE ,
-			lut_src[6545] / FRAC_SCALE ,
-			lut_src[6546] / FRAC_SCALE ,
-			lut_src[6547] / FRAC_SCALE ,
-			lut_src[6548] / FRAC_SCALE ,
-			lut_src[6549] / FRAC_SCALE ,
-			lut_src[6550] / FRAC_SCALE ,
-			lut_src[6551] / FRAC_SCALE ,
-			lut_src[6552] / FRAC_SCALE ,
-			lut_src[6553] / FRAC_SCALE ,
-			lut_src[6554] / FRAC_SCALE ,
-			lut_src[6555] / FRAC_SCALE ,
-			lut_src[6556] / FRAC_SCALE ,
-			lut_src[6557] / FRAC_SCALE ,
-			lut_src[6558] / FRAC_SCALE ,
-			lut_src[6559] / FRAC_SCALE ,
-			lut_src[6560] / FRAC_SCALE ,
-			lut_src[6561] / FRAC_SCALE ,
-			lut_src[6562] / FRAC_SCALE ,
-			lut_src[6563] / FRAC_SCALE ,
-			lut_src[6564] / FRAC_SCALE ,
-			lut_src[6565] / FRAC_SCALE ,
-			lut_src[6566] / FRAC_SCALE ,
-			lut_src[6567] / FRAC_SCALE ,
-			lut_src[6568] / FRAC_SCALE ,
-			lut_src[6569] / FRAC_SCALE ,
-			lut_src[6570] / FRAC_SCALE ,
-			lut_src[6571] / FRAC_SCALE ,
-			lut_src[6572] / FRAC_SCALE ,
-			lut_src[6573] / FRAC_SCALE ,
-			lut_src[6574] / FRAC_SCALE ,
-			lut_src[6575] / FRAC_SCALE ,
-			lut_src[6576] / FRAC_SCALE ,
-			lut_src[6577] / FRAC_SCALE ,
-			lut_src[6578] / FRAC_SCALE ,
-			lut_src[6579] / FRAC_SCALE ,
-			lut_src[6580] / FRAC_SCALE ,
-			lut_src[6581] / FRAC_SCALE ,
-			lut_src[6582] / FRAC_SCALE ,
-			lut_src[6583] / FRAC_SCALE ,
-			lut_src[6584] / FRAC_SCALE ,
-			lut_src[6585] / FRAC_SCALE ,
-			lut_src[6586] / FRAC_SCALE ,
-			lut_src[6587] / FRAC_SCALE ,
-			lut_src[6588] / FRAC_SCALE ,
-			lut_src[6589] / FRAC_SCALE ,
-			lut_src[6590] / FRAC_SCALE ,
-			lut_src[6591] / FRAC_SCALE ,
-			lut_src[6592] / FRAC_SCALE ,
-			lut_src[6593] / FRAC_SCALE ,
-			lut_src[6594] / FRAC_SCALE ,
-			lut_src[6595] / FRAC_SCALE ,
-			lut_src[6596] / FRAC_SCALE ,
-			lut_src[6597] / FRAC_SCALE ,
-			lut_src[6598] / FRAC_SCALE ,
-			lut_src[6599] / FRAC_SCALE ,
-			lut_src[6600] / FRAC_SCALE ,
-			lut_src[6601] / FRAC_SCALE ,
-			lut_src[6602] / FRAC_SCALE ,
-			lut_src[6603] / FRAC_SCALE ,
-			lut_src[6604] / FRAC_SCALE ,
-			lut_src[6605] / FRAC_SCALE ,
-			lut_src[6606] / FRAC_SCALE ,
-			lut_src[6607] / FRAC_SCALE ,
-			lut_src[6608] / FRAC_SCALE ,
-			lut_src[6609] / FRAC_SCALE ,
-			lut_src[6610] / FRAC_SCALE ,
-			lut_src[6611] / FRAC_SCALE ,
-			lut_src[6612] / FRAC_SCALE ,
-			lut_src[6613] / FRAC_SCALE ,
-			lut_src[6614] / FRAC_SCALE ,
-			lut_src[6615] / FRAC_SCALE ,
-			lut_src[6616] / FRAC_SCALE ,
-			lut_src[6617] / FRAC_SCALE ,
-			lut_src[6618] / FRAC_SCALE ,
-			lut_src[6619] / FRAC_SCALE ,
-			lut_src[6620] / FRAC_SCALE ,
-			lut_src[6621] / FRAC_SCALE ,
-			lut_src[6622] / FRAC_SCALE ,
-			lut_src[6623] / FRAC_SCALE ,
-			lut_src[6624] / FRAC_SCALE ,
-			lut_src[6625] / FRAC_SCALE ,
-			lut_src[6626] / FRAC_SCALE ,
-			lut_src[6627] / FRAC_SCALE ,
-			lut_src[6628] / FRAC_SCALE ,
-			lut_src[6629] / FRAC_SCALE ,
-			lut_src[6630] / FRAC_SCALE ,
-			lut_src[6631] / FRAC_SCALE ,
-			lut_src[6632] / FRAC_SCALE ,
-			lut_src[6633] / FRAC_SCALE ,
-			lut_src[6634] / FRAC_SCALE ,
-			lut_src[6635] / FRAC_SCALE ,
-			lut_src[6636] / FRAC_SCALE ,
-			lut_src[6637] / FRAC_SCALE ,
-			lut_src[6638] / FRAC_SCALE ,
-			lut_src[6639] / FRAC_SCALE ,
-			lut_src[6640] / FRAC_SCALE ,
-			lut_src[6641] / FRAC_SCALE ,
-			lut_src[6642] / FRAC_SCALE ,
-			lut_src[6643] / FRAC_SCALE ,
-			lut_src[6644] / FRAC_SCALE ,
-			lut_src[6645] / FRAC_SCALE ,
-			lut_src[6646] / FRAC_SCALE ,
-			lut_src[6647] / FRAC_SCALE ,
-			lut_src[6648] / FRAC_SCALE ,
-			lut_src[6649] / FRAC_SCALE ,
-			lut_src[6650] / FRAC_SCALE ,
-			lut_src[6651] / FRAC_SCALE ,
-			lut_src[6652] / FRAC_SCALE ,
-			lut_src[6653] / FRAC_SCALE ,
-			lut_src[6654] / FRAC_SCALE ,
-			lut_src[6655] / FRAC_SCALE ,
-			lut_src[6656] / FRAC_SCALE ,
-			lut_src[6657] / FRAC_SCALE ,
-			lut_src[6658] / FRAC_SCALE ,
-			lut_src[6659] / FRAC_SCALE ,
-			lut_src[6660] / FRAC_SCALE ,
-			lut_src[6661] / FRAC_SCALE ,
-			lut_src[6662] / FRAC_SCALE ,
-			lut_src[6663] / FRAC_SCALE ,
-			lut_src[6664] / FRAC_SCALE ,
-			lut_src[6665] / FRAC_SCALE ,
-			lut_src[6666] / FRAC_SCALE ,
-			lut_src[6667] / FRAC_SCALE ,
-			lut_src[6668] / FRAC_SCALE ,
-			lut_src[6669] / FRAC_SCALE ,
-			lut_src[6670] / FRAC_SCALE ,
-			lut_src[6671] / FRAC_SCALE ,
-			lut_src[6672] / FRAC_SCALE ,
-			lut_src[6673] / FRAC_SCALE ,
-			lut_src[6674] / FRAC_SCALE ,
-			lut_src[6675] / FRAC_SCALE ,
-			lut_src[6676] / FRAC_SCALE ,
-			lut_src[6677] / FRAC_SCALE ,
-			lut_src[6678] / FRAC_SCALE ,
-			lut_src[6679] / FRAC_SCALE ,
-			lut_src[6680] / FRAC_SCALE ,
-			lut_src[6681] / FRAC_SCALE ,
-			lut_src[6682] / FRAC_SCALE ,
-			lut_src[6683] / FRAC_SCALE ,
-			lut_src[6684] / FRAC_SCALE ,
-			lut_src[6685] / FRAC_SCALE ,
-			lut_src[6686] / FRAC_SCALE ,
-			lut_src[6687] / FRAC_SCALE ,
-			lut_src[6688] / FRAC_SCALE ,
-			lut_src[6689] / FRAC_SCALE ,
-			lut_src[6690] / FRAC_SCALE ,
-			lut_src[6691] / FRAC_SCALE ,
-			lut_src[6692] / FRAC_SCALE ,
-			lut_src[6693] / FRAC_SCALE ,
-			lut_src[6694] / FRAC_SCALE ,
-			lut_src[6695] / FRAC_SCALE ,
-			lut_src[6696] / FRAC_SCALE ,
-			lut_src[6697] / FRAC_SCALE ,
-			lut_src[6698] / FRAC_SCALE ,
-			lut_src[6699] / FRAC_SCALE ,
-			lut_src[6700] / FRAC_SCALE ,
-			lut_src[6701] / FRAC_SCALE ,
-			lut_src[6702] / FRAC_SCALE ,
-			lut_src[6703] / FRAC_SCALE ,
-			lut_src[6704] / FRAC_SCALE ,
-			lut_src[6705] / FRAC_SCALE ,
-			lut_src[6706] / FRAC_SCALE ,
-			lut_src[6707] / FRAC_SCALE ,
-			lut_src[6708] / FRAC_SCALE ,
-			lut_src[6709] / FRAC_SCALE ,
-			lut_src[6710] / FRAC_SCALE ,
-			lut_src[6711] / FRAC_SCALE ,
-			lut_src[6712] / FRAC_SCALE ,
-			lut_src[6713] / FRAC_SCALE ,
-			lut_src[6714] / FRAC_SCALE ,
-			lut_src[6715] / FRAC_SCALE ,
-			lut_src[6716] / FRAC_SCALE ,
-			lut_src[6717] / FRAC_SCALE ,
-			lut_src[6718] / FRAC_SCALE ,
-			lut_src[6719] / FRAC_SCALE ,
-			lut_src[6720] / FRAC_SCALE ,
-			lut_src[6721] / FRAC_SCALE ,
-			lut_src[6722] / FRAC_SCALE ,
-			lut_src[6723] / FRAC_SCALE ,
-			lut_src[6724] / FRAC_SCALE ,
-			lut_src[6725] / FRAC_SCALE ,
-			lut_src[6726] / FRAC_SCALE ,
-			lut_src[6727] / FRAC_SCALE ,
-			lut_src[6728] / FRAC_SCALE ,
-			lut_src[6729] / FRAC_SCALE ,
-			lut_src[6730] / FRAC_SCALE ,
-			lut_src[6731] / FRAC_SCALE ,
-			lut_src[6732] / FRAC_SCALE ,
-			lut_src[6733] / FRAC_SCALE ,
-			lut_src[6734] / FRAC_SCALE ,
-			lut_src[6735] / FRAC_SCALE ,
-			lut_src[6736] / FRAC_SCALE ,
-			lut_src[6737] / FRAC_SCALE ,
-			lut_src[6738] / FRAC_SCALE ,
-			lut_src[6739] / FRAC_SCALE ,
-			lut_src[6740] / FRAC_SCALE ,
-			lut_src[6741] / FRAC_SCALE ,
-			lut_src[6742] / FRAC_SCALE ,
-			lut_src[6743] / FRAC_SCALE ,
-			lut_src[6744] / FRAC_SCALE ,
-			lut_src[6745] / FRAC_SCALE ,
-			lut_src[6746] / FRAC_SCALE ,
-			lut_src[6747] / FRAC_SCALE ,
-			lut_src[6748] / FRAC_SCALE ,
-			lut_src[6749] / FRAC_SCALE ,
-			lut_src[6750] / FRAC_SCALE ,
-			lut_src[6751] / FRAC_SCALE ,
-			lut_src[6752] / FRAC_SCALE ,
-			lut_src[6753] / FRAC_SCALE ,
-			lut_src[6754] / FRAC_SCALE ,
-			lut_src[6755] / FRAC_SCALE ,
-			lut_src[6756] / FRAC_SCALE ,
-			lut_src[6757] / FRAC_SCALE ,
-			lut_src[6758] / FRAC_SCALE ,
-			lut_src[6759] / FRAC_SCALE ,
-			lut_src[6760] / FRAC_SCALE ,
-			lut_src[6761] / FRAC_SCALE ,
-			lut_src[6762] / FRAC_SCALE ,
-			lut_src[6763] / FRAC_SCALE ,
-			lut_src[6764] / FRAC_SCALE ,
-			lut_src[6765] / FRAC_SCALE ,
-			lut_src[6766] / FRAC_SCALE ,
-			lut_src[6767] / FRAC_SCALE ,
-			lut_src[6768] / FRAC_SCALE ,
-			lut_src[6769] / FRAC_SCALE ,
-			lut_src[6770] / FRAC_SCALE ,
-			lut_src[6771] / FRAC_SCALE ,
-			lut_src[6772] / FRAC_SCALE ,
-			lut_src[6773] / FRAC_SCALE ,
-			lut_src[6774] / FRAC_SCALE ,
-			lut_src[6775] / FRAC_SCALE ,
-			lut_src[6776] / FRAC_SCALE ,
-			lut_src[6777] / FRAC_SCALE ,
-			lut_src[6778] / FRAC_SCALE ,
-			lut_src[6779] / FRAC_SCALE ,
-			lut_src[6780] / FRAC_SCALE ,
-			lut_src[6781] / FRAC_SCALE ,
-			lut_src[6782] / FRAC_SCALE ,
-			lut_src[6783] / FRAC_SCALE ,
-			lut_src[6784] / FRAC_SCALE ,
-			lut_src[6785] / FRAC_SCALE ,
-			lut_src[6786] / FRAC_SCALE ,
-			lut_src[6787] / FRAC_SCALE ,
-			lut_src[6788] / FRAC_SCALE ,
-			lut_src[6789] / FRAC_SCALE ,
-			lut_src[6790] / FRAC_SCALE ,
-			lut_src[6791] / FRAC_SCALE ,
-			lut_src[6792] / FRAC_SCALE ,
-			lut_src[6793] / FRAC_SCALE ,
-			lut_src[6794] / FRAC_SCALE ,
-			lut_src[6795] / FRAC_SCALE ,
-			lut_src[6796] / FRAC_SCALE ,
-			lut_src[6797] / FRAC_SCALE ,
-			lut_src[6798] / FRAC_SCALE ,
-			lut_src[6799] / FRAC_SCALE ,
-			lut_src[6800] / FRAC_SCALE ,
-			lut_src[6801] / FRAC_SCALE ,
-			lut_src[6802] / FRAC_SCALE ,
-			lut_src[6803] / FRAC_SCALE ,
-			lut_src[6804] / FRAC_SCALE ,
-			lut_src[6805] / FRAC_SCALE ,
-			lut_src[6806] / FRAC_SCALE ,
-			lut_src[6807] / FRAC_SCALE ,
-			lut_src[6808] / FRAC_SCALE ,
-			lut_src[6809] / FRAC_SCALE ,
-			lut_src[6810] / FRAC_SCALE ,
-			lut_src[6811] / FRAC_SCALE ,
-			lut_src[6812] / FRAC_SCALE ,
-			lut_src[6813] / FRAC_SCALE ,
-			lut_src[6814] / FRAC_SCALE ,
-			lut_src[6815] / FRAC_SCALE ,
-			lut_src[6816] / FRAC_SCALE ,
-			lut_src[6817] / FRAC_SCALE ,
-			lut_src[6818] / FRAC_SCALE ,
-			lut_src[6819] / FRAC_SCALE ,
-			lut_src[6820] / FRAC_SCALE ,
-			lut_src[6821] / FRAC_SCALE ,
-			lut_src[6822] / FRAC_SCALE ,
-			lut_src[6823] / FRAC_SCALE ,
-			lut_src[6824] / FRAC_SCALE ,
-			lut_src[6825] / FRAC_SCALE ,
-			lut_src[6826] / FRAC_SCALE ,
-			lut_src[6827] / FRAC_SCALE ,
-			lut_src[6828] / FRAC_SCALE ,
-			lut_src[6829] / FRAC_SCALE ,
-			lut_src[6830] / FRAC_SCALE ,
-			lut_src[6831] / FRAC_SCALE ,
-			lut_src[6832] / FRAC_SCALE ,
-			lut_src[6833] / FRAC_SCALE ,
-			lut_src[6834] / FRAC_SCALE ,
-			lut_src[6835] / FRAC_SCALE ,
-			lut_src[6836] / FRAC_SCALE ,
-			lut_src[6837] / FRAC_SCALE ,
-			lut_src[6838] / FRAC_SCALE ,
-			lut_src[6839] / FRAC_SCALE ,
-			lut_src[6840] / FRAC_SCALE ,
-			lut_src[6841] / FRAC_SCALE ,
-			lut_src[6842] / FRAC_SCALE ,
-			lut_src[6843] / FRAC_SCALE ,
-			lut_src[6844] / FRAC_SCALE ,
-			lut_src[6845] / FRAC_SCALE ,
-			lut_src[6846] / FRAC_SCALE ,
-			lut_src[6847] / FRAC_SCALE ,
-			lut_src[6848] / FRAC_SCALE ,
-			lut_src[6849] / FRAC_SCALE ,
-			lut_src[6850] / FRAC_SCALE ,
-			lut_src[6851] / FRAC_SCALE ,
-			lut_src[6852] / FRAC_SCALE ,
-			lut_src[6853] / FRAC_SCALE ,
-			lut_src[6854] / FRAC_SCALE ,
-			lut_src[6855] / FRAC_SCALE ,
-			lut_src[6856] / FRAC_SCALE ,
-			lut_src[6857] / FRAC_SCALE ,
-			lut_src[6858] / FRAC_SCALE ,
-			lut_src[6859] / FRAC_SCALE ,
-			lut_src[6860] / FRAC_SCALE ,
-			lut_src[6861] / FRAC_SCALE ,
-			lut_src[6862] / FRAC_SCALE ,
-			lut_src[6863] / FRAC_SCALE ,
-			lut_src[6864] / FRAC_SCALE ,
-			lut_src[6865] / FRAC_SCALE ,
-			lut_src[6866] / FRAC_SCALE ,
-			lut_src[6867] / FRAC_SCALE ,
-			lut_src[6868] / FRAC_SCALE ,
-			lut_src[6869] / FRAC_SCALE ,
-			lut_src[6870] / FRAC_SCALE ,
-			lut_src[6871] / FRAC_SCALE ,
-			lut_src[6872] / FRAC_SCALE ,
-			lut_src[6873] / FRAC_SCALE ,
-			lut_src[6874] / FRAC_SCALE ,
-			lut_src[6875] / FRAC_SCALE ,
-			lut_src[6876] / FRAC_SCALE ,
-			lut_src[6877] / FRAC_SCALE ,
-			lut_src[6878] / FRAC_SCALE ,
-			lut_src[6879] / FRAC_SCALE ,
-			lut_src[6880] / FRAC_SCALE ,
-			lut_src[6881] / FRAC_SCALE ,
-			lut_src[6882] / FRAC_SCALE ,
-			lut_src[6883] / FRAC_SCALE ,
-			lut_src[6884] / FRAC_SCALE ,
-			lut_src[6885] / FRAC_SCALE ,
-			lut_src[6886] / FRAC_SCALE ,
-			lut_src[6887] / FRAC_SCALE ,
-			lut_src[6888] / FRAC_SCALE ,
-			lut_src[6889] / FRAC_SCALE ,
-			lut_src[6890] / FRAC_SCALE ,
-			lut_src[6891] / FRAC_SCALE ,
-			lut_src[6892] / FRAC_SCALE ,
-			lut_src[6893] / FRAC_SCALE ,
-			lut_src[6894] / FRAC_SCALE ,
-			lut_src[6895] / FRAC_SCALE ,
-			lut_src[6896] / FRAC_SCALE ,
-			lut_src[6897] / FRAC_SCALE ,
-			lut_src[6898] / FRAC_SCALE ,
-			lut_src[6899] / FRAC_SCALE ,
-			lut_src[6900] / FRAC_SCALE ,
-			lut_src[6901] / FRAC_SCALE ,
-			lut_src[6902] / FRAC_SCALE ,
-			lut_src[6903] / FRAC_SCALE ,
-			lut_src[6904] / FRAC_SCALE ,
-			lut_src[6905] / FRAC_SCALE ,
-			lut_src[6906] / FRAC_SCALE ,
-			lut_src[6907] / FRAC_SCALE ,
-			lut_src[6908] / FRAC_SCALE ,
-			lut_src[6909] / FRAC_SCALE ,
-			lut_src[6910] / FRAC_SCALE ,
-			lut_src[6911] / FRAC_SCALE ,
-			lut_src[6912] / FRAC_SCALE ,
-			lut_src[6913] / FRAC_SCALE ,
-			lut_src[6914] / FRAC_SCALE ,
-			lut_src[6915] / FRAC_SCALE ,
-			lut_src[6916] / FRAC_SCALE ,
-			lut_src[6917] / FRAC_SCALE ,
-			lut_src[6918] / FRAC_SCALE ,
-			lut_src[6919] / FRAC_SCALE ,
-			lut_src[6920] / FRAC_SCALE ,
-			lut_src[6921] / FRAC_SCALE ,
-			lut_src[6922] / FRAC_SCALE ,
-			lut_src[6923] / FRAC_SCALE ,
-			lut_src[6924] / FRAC_SCALE ,
-			lut_src[6925] / FRAC_SCALE ,
-			lut_src[6926] / FRAC_SCALE ,
-			lut_src[6927] / FRAC_SCALE ,
-			lut_src[6928] / FRAC_SCALE ,
-			lut_src[6929] / FRAC_SCALE ,
-			lut_src[6930] / FRAC_SCALE ,
-			lut_src[6931] / FRAC_SCALE ,
-			lut_src[6932] / FRAC_SCALE ,
-			lut_src[6933] / FRAC_SCALE ,
-			lut_src[6934] / FRAC_SCALE ,
-			lut_src[6935] / FRAC_SCALE ,
-			lut_src[6936] / FRAC_SCALE ,
-			lut_src[6937] / FRAC_SCALE ,
-			lut_src[6938] / FRAC_SCALE ,
-			lut_src[6939] / FRAC_SCALE ,
-			lut_src[6940] / FRAC_SCALE ,
-			lut_src[6941] / FRAC_SCALE ,
-			lut_src[6942] / FRAC_SCALE ,
-			lut_src[6943] / FRAC_SCALE ,
-			lut_src[6944] / FRAC_SCALE ,
-			lut_src[6945] / FRAC_SCALE ,
-			lut_src[6946] / FRAC_SCALE ,
-			lut_src[6947] / FRAC_SCALE ,
-			lut_src[6948] / FRAC_SCALE ,
-			lut_src[6949] / FRAC_SCALE ,
-			lut_src[6950] / FRAC_SCALE ,
-			lut_src[6951] / FRAC_SCALE ,
-			lut_src[6952] / FRAC_SCALE ,
-			lut_src[6953] / FRAC_SCALE ,
-			lut_src[6954] / FRAC_SCALE ,
-			lut_src[6955] / FRAC_SCALE ,
-			lut_src[6956] / FRAC_SCALE ,
-			lut_src[6957] / FRAC_SCALE ,
-			lut_src[6958] / FRAC_SCALE ,
-			lut_src[6959] / FRAC_SCALE ,
-			lut_src[6960] / FRAC_SCALE ,
-			lut_src[6961] / FRAC_SCALE ,
-			lut_src[6962] / FRAC_SCALE ,
-			lut_src[6963] / FRAC_SCALE ,
-			lut_src[6964] / FRAC_SCALE ,
-			lut_src[6965] / FRAC_SCALE ,
-			lut_src[6966] / FRAC_SCALE ,
-			lut_src[6967] / FRAC_SCALE ,
-			lut_src[6968] / FRAC_SCALE ,
-			lut_src[6969] / FRAC_SCALE ,
-			lut_src[6970] / FRAC_SCALE ,
-			lut_src[6971] / FRAC_SCALE ,
-			lut_src[6972] / FRAC_SCALE ,
-			lut_src[6973] / FRAC_SCALE ,
-			lut_src[6974] / FRAC_SCALE ,
-			lut_src[6975] / FRAC_SCALE ,
-			lut_src[6976] / FRAC_SCALE ,
-			lut_src[6977] / FRAC_SCALE ,
-			lut_src[6978] / FRAC_SCALE ,
-			lut_src[6979] / FRAC_SCALE ,
-			lut_src[6980] / FRAC_SCALE ,
-			lut_src[6981] / FRAC_SCALE ,
-			lut_src[6982] / FRAC_SCALE ,
-			lut_src[6983] / FRAC_SCALE ,
-			lut_src[6984] / FRAC_SCALE ,
-			lut_src[6985] / FRAC_SCALE ,
-			lut_src[6986] / FRAC_SCALE ,
-			lut_src[6987] / FRAC_SCALE ,
-			lut_src[6988] / FRAC_SCALE ,
-			lut_src[6989] / FRAC_SCALE ,
-			lut_src[6990] / FRAC_SCALE ,
-			lut_src[6991] / FRAC_SCALE ,
-			lut_src[6992] / FRAC_SCALE ,
-			lut_src[6993] / FRAC_SCALE ,
-			lut_src[6994] / FRAC_SCALE ,
-			lut_src[6995] / FRAC_SCALE ,
-			lut_src[6996] / FRAC_SCALE ,
-			lut_src[6997] / FRAC_SCALE ,
-			lut_src[6998] / FRAC_SCALE ,
-			lut_src[6999] / FRAC_SCALE ,
-			lut_src[7000] / FRAC_SCALE ,
-			lut_src[7001] / FRAC_SCALE ,
-			lut_src[7002] / FRAC_SCALE ,
-			lut_src[7003] / FRAC_SCALE ,
-			lut_src[7004] / FRAC_SCALE ,
-			lut_src[7005] / FRAC_SCALE ,
-			lut_src[7006] / FRAC_SCALE ,
-			lut_src[7007] / FRAC_SCALE ,
-			lut_src[7008] / FRAC_SCALE ,
-			lut_src[7009] / FRAC_SCALE ,
-			lut_src[7010] / FRAC_SCALE ,
-			lut_src[7011] / FRAC_SCALE ,
-			lut_src[7012] / FRAC_SCALE ,
-			lut_src[7013] / FRAC_SCALE ,
-			lut_src[7014] / FRAC_SCALE ,
-			lut_src[7015] / FRAC_SCALE ,
-			lut_src[7016] / FRAC_SCALE ,
-			lut_src[7017] / FRAC_SCALE ,
-			lut_src[7018] / FRAC_SCALE ,
-			lut_src[7019] / FRAC_SCALE ,
-			lut_src[7020] / FRAC_SCALE ,
-			lut_src[7021] / FRAC_SCALE ,
-			lut_src[7022] / FRAC_SCALE ,
-			lut_src[7023] / FRAC_SCALE ,
-			lut_src[7024] / FRAC_SCALE ,
-			lut_src[7025] / FRAC_SCALE ,
-			lut_src[7026] / FRAC_SCALE ,
-			lut_src[7027] / FRAC_SCALE ,
-			lut_src[7028] / FRAC_SCALE ,
-			lut_src[7029] / FRAC_SCALE ,
-			lut_src[7030] / FRAC_SCALE ,
-			lut_src[7031] / FRAC_SCALE ,
-			lut_src[7032] / FRAC_SCALE ,
-			lut_src[7033] / FRAC_SCALE ,
-			lut_src[7034] / FRAC_SCALE ,
-			lut_src[7035] / FRAC_SCALE ,
-			lut_src[7036] / FRAC_SCALE ,
-			lut_src[7037] / FRAC_SCALE ,
-			lut_src[7038] / FRAC_SCALE ,
-			lut_src[7039] / FRAC_SCALE ,
-			lut_src[7040] / FRAC_SCALE ,
-			lut_src[7041] / FRAC_SCALE ,
-			lut_src[7042] / FRAC_SCALE ,
-			lut_src[7043] / FRAC_SCALE ,
-			lut_src[7044] / FRAC_SCALE ,
-			lut_src[7045] / FRAC_SCALE ,
-			lut_src[7046] / FRAC_SCALE ,
-			lut_src[7047] / FRAC_SCALE ,
-			lut_src[7048] / FRAC_SCALE ,
-			lut_src[7049] / FRAC_SCALE ,
-			lut_src[7050] / FRAC_SCALE ,
-			lut_src[7051] / FRAC_SCALE ,
-			lut_src[7052] / FRAC_SCALE ,
-			lut_src[7053] / FRAC_SCALE ,
-			lut_src[7054] / FRAC_SCALE ,
-			lut_src[7055] / FRAC_SCALE ,
-			lut_src[7056] / FRAC_SCALE ,
-			lut_src[7057] / FRAC_SCALE ,
-			lut_src[7058] / FRAC_SCALE ,
-			lut_src[7059] / FRAC_SCALE ,
-			lut_src[7060] / FRAC_SCALE ,
-			lut_src[7061] / FRAC_SCALE ,
-			lut_src[7062] / FRAC_SCALE ,
-			lut_src[7063] / FRAC_SCALE ,
-			lut_src[7064] / FRAC_SCALE ,
-			lut_src[7065] / FRAC_SCALE ,
-			lut_src[7066] / FRAC_SCALE ,
-			lut_src[7067] / FRAC_SCALE ,
-			lut_src[7068] / FRAC_SCALE ,
-			lut_src[7069] / FRAC_SCALE ,
-			lut_src[7070] / FRAC_SCALE ,
-			lut_src[7071] / FRAC_SCALE ,
-			lut_src[7072] / FRAC_SCALE ,
-			lut_src[7073] / FRAC_SCALE ,
-			lut_src[7074] / FRAC_SCALE ,
-			lut_src[7075] / FRAC_SCALE ,
-			lut_src[7076] / FRAC_SCALE ,
-			lut_src[7077] / FRAC_SCALE ,
-			lut_src[7078] / FRAC_SCALE ,
-			lut_src[7079] / FRAC_SCALE ,
-			lut_src[7080] / FRAC_SCALE ,
-			lut_src[7081] / FRAC_SCALE ,
-			lut_src[7082] / FRAC_SCALE ,
-			lut_src[7083] / FRAC_SCALE ,
-			lut_src[7084] / FRAC_SCALE ,
-			lut_src[7085] / FRAC_SCALE ,
-			lut_src[7086] / FRAC_SCALE ,
-			lut_src[7087] / FRAC_SCALE ,
-			lut_src[7088] / FRAC_SCALE ,
-			lut_src[7089] / FRAC_SCALE ,
-			lut_src[7090] / FRAC_SCALE ,
-			lut_src[7091] / FRAC_SCALE ,
-			lut_src[7092] / FRAC_SCALE ,
-			lut_src[7093] / FRAC_SCALE ,
-			lut_src[7094] / FRAC_SCALE ,
-			lut_src[7095] / FRAC_SCALE ,
-			lut_src[7096] / FRAC_SCALE ,
-			lut_src[7097] / FRAC_SCALE ,
-			lut_src[7098] / FRAC_SCALE ,
-			lut_src[7099] / FRAC_SCALE ,
-			lut_src[7100] / FRAC_SCALE ,
-			lut_src[7101] / FRAC_SCALE ,
-			lut_src[7102] / FRAC_SCALE ,
-			lut_src[7103] / FRAC_SCALE ,
-			lut_src[7104] / FRAC_SCALE ,
-			lut_src[7105] / FRAC_SCALE ,
-			lut_src[7106] / FRAC_SCALE ,
-			lut_src[7107] / FRAC_SCALE ,
-			lut_src[7108] / FRAC_SCALE ,
-			lut_src[7109] / FRAC_SCALE ,
-			lut_src[7110] / FRAC_SCALE ,
-			lut_src[7111] / FRAC_SCALE ,
-			lut_src[7112] / FRAC_SCALE ,
-			lut_src[7113] / FRAC_SCALE ,
-			lut_src[7114] / FRAC_SCALE ,
-			lut_src[7115] / FRAC_SCALE ,
-			lut_src[7116] / FRAC_SCALE ,
-			lut_src[7117] / FRAC_SCALE ,
-			lut_src[7118] / FRAC_SCALE ,
-			lut_src[7119] / FRAC_SCALE ,
-			lut_src[7120] / FRAC_SCALE ,
-			lut_src[7121] / FRAC_SCALE ,
-			lut_src[7122] / FRAC_SCALE ,
-			lut_src[7123] / FRAC_SCALE ,
-			lut_src[7124] / FRAC_SCALE ,
-			lut_src[7125] / FRAC_SCALE ,
-			lut_src[7126] / FRAC_SCALE ,
-			lut_src[7127] / FRAC_SCALE ,
-			lut_src[7128] / FRAC_SCALE ,
-			lut_src[7129] / FRAC_SCALE ,
-			lut_src[7130] / FRAC_SCALE ,
-			lut_src[7131] / FRAC_SCALE ,
-			lut_src[7132] / FRAC_SCALE ,
-			lut_src[7133] / FRAC_SCALE ,
-			lut_src[7134] / FRAC_SCALE ,
-			lut_src[7135] / FRAC_SCALE ,
-			lut_src[7136] / FRAC_SCALE ,
-			lut_src[7137] / FRAC_SCALE ,
-			lut_src[7138] / FRAC_SCALE ,
-			lut_src[7139] / FRAC_SCALE ,
-			lut_src[7140] / FRAC_SCALE ,
-			lut_src[7141] / FRAC_SCALE ,
-			lut_src[7142] / FRAC_SCALE ,
-			lut_src[7143] / FRAC_SCALE ,
-			lut_src[7144] / FRAC_SCALE ,
-			lut_src[7145] / FRAC_SCALE ,
-			lut_src[7146] / FRAC_SCALE ,
-			lut_src[7147] / FRAC_SCALE ,
-			lut_src[7148] / FRAC_SCALE ,
-			lut_src[7149] / FRAC_SCALE ,
-			lut_src[7150] / FRAC_SCALE ,
-			lut_src[7151] / FRAC_SCALE ,
-			lut_src[7152] / FRAC_SCALE ,
-			lut_src[7153] / FRAC_SCALE ,
-			lut_src[7154] / FRAC_SCALE ,
-			lut_src[7155] / FRAC_SCALE ,
-			lut_src[7156] / FRAC_SCALE ,
-			lut_src[7157] / FRAC_SCALE ,
-			lut_src[7158] / FRAC_SCALE ,
-			lut_src[7159] / FRAC_SCALE ,
-			lut_src[7160] / FRAC_SCALE ,
-			lut_src[7161] / FRAC_SCALE ,
-			lut_src[7162] / FRAC_SCALE ,
-			lut_src[7163] / FRAC_SCALE ,
-			lut_src[7164] / FRAC_SCALE ,
-			lut_src[7165] / FRAC_SCALE ,
-			lut_src[7166] / FRAC_SCALE ,
-			lut_src[7167] / FRAC_SCALE ,
-			lut_src[7168] / FRAC_SCALE ,
-			lut_src[7169] / FRAC_SCALE ,
-			lut_src[7170] / FRAC_SCALE ,
-			lut_src[7171] / FRAC_SCALE ,
-			lut_src[7172] / FRAC_SCALE ,
-			lut_src[7173] / FRAC_SCALE ,
-			lut_src[7174] / FRAC_SCALE ,
-			lut_src[7175] / FRAC_SCALE ,
-			lut_src[7176] / FRAC_SCALE ,
-			lut_src[7177] / FRAC_SCALE ,
-			lut_src[7178] / FRAC_SCALE ,
-			lut_src[7179] / FRAC_SCALE ,
-			lut_src[7180] / FRAC_SCALE ,
-			lut_src[7181] / FRAC_SCALE ,
-			lut_src[7182] / FRAC_SCALE ,
-			lut_src[7183] / FRAC_SCALE ,
-			lut_src[7184] / FRAC_SCALE ,
-			lut_src[7185] / FRAC_SCALE ,
-			lut_src[7186] / FRAC_SCALE ,
-			lut_src[7187] / FRAC_SCALE ,
-			lut_src[7188] / FRAC_SCALE ,
-			lut_src[7189] / FRAC_SCALE ,
-			lut_src[7190] / FRAC_SCALE ,
-			lut_src[7191] / FRAC_SCALE ,
-			lut_src[7192] / FRAC_SCALE ,
-			lut_src[7193] / FRAC_SCALE ,
-			lut_src[7194] / FRAC_SCALE ,
-			lut_src[7195] / FRAC_SCALE ,
-			lut_src[7196] / FRAC_SCALE ,
-			lut_src[7197] / FRAC_SCALE ,
-			lut_src[7198] / FRAC_SCALE ,
-			lut_src[7199] / FRAC_SCALE ,
-			lut_src[7200] / FRAC_SCALE ,
-			lut_src[7201] / FRAC_SCALE ,
-			lut_src[7202] / FRAC_SCALE ,
-			lut_src[7203] / FRAC_SCALE ,
-			lut_src[7204] / FRAC_SCALE ,
-			lut_src[7205] / FRAC_SCALE ,
-			lut_src[7206] / FRAC_SCALE ,
-			lut_src[7207] / FRAC_SCALE ,
-			lut_src[7208] / FRAC_SCALE ,
-			lut_src[7209] / FRAC_SCALE ,
-			lut_src[7210] / FRAC_SCALE ,
-			lut_src[7211] / FRAC_SCALE ,
-			lut_src[7212] / FRAC_SCALE ,
-			lut_src[7213] / FRAC_SCALE ,
-			lut_src[7214] / FRAC_SCALE ,
-			lut_src[7215] / FRAC_SCALE ,
-			lut_src[7216] / FRAC_SCALE ,
-			lut_src[7217] / FRAC_SCALE ,
-			lut_src[7218] / FRAC_SCALE ,
-			lut_src[7219] / FRAC_SCALE ,
-			lut_src[7220] / FRAC_SCALE ,
-			lut_src[7221] / FRAC_SCALE ,
-			lut_src[7222] / FRAC_SCALE ,
-			lut_src[7223] / FRAC_SCALE ,
-			lut_src[7224] / FRAC_SCALE ,
-			lut_src[7225] / FRAC_SCALE ,
-			lut_src[7226] / FRAC_SCALE ,
-			lut_src[7227] / FRAC_SCALE ,
-			lut_src[7228] / FRAC_SCALE ,
-			lut_src[7229] / FRAC_SCALE ,
-			lut_src[7230] / FRAC_SCALE ,
-			lut_src[7231] / FRAC_SCALE ,
-			lut_src[7232] / FRAC_SCALE ,
-			lut_src[7233] / FRAC_SCALE ,
-			lut_src[7234] / FRAC_SCALE ,
-			lut_src[7235] / FRAC_SCALE ,
-			lut_src[7236] / FRAC_SCALE ,
-			lut_src[7237] / FRAC_SCALE ,
-			lut_src[7238] / FRAC_SCALE ,
-			lut_src[7239] / FRAC_SCALE ,
-			lut_src[7240] / FRAC_SCALE ,
-			lut_src[7241] / FRAC_SCALE ,
-			lut_src[7242] / FRAC_SCALE ,
-			lut_src[7243] / FRAC_SCALE ,
-			lut_src[7244] / FRAC_SCALE ,
-			lut_src[7245] / FRAC_SCALE ,
-			lut_src[7246] / FRAC_SCALE ,
-			lut_src[7247] / FRAC_SCALE ,
-			lut_src[7248] / FRAC_SCALE ,
-			lut_src[7249] / FRAC_SCALE ,
-			lut_src[7250] / FRAC_SCALE ,
-			lut_src[7251] / FRAC_SCALE ,
-			lut_src[7252] / FRAC_SCALE ,
-			lut_src[7253] / FRAC_SCALE ,
-			lut_src[7254] / FRAC_SCALE ,
-			lut_src[7255] / FRAC_SCALE ,
-			lut_src[7256] / FRAC_SCALE ,
-			lut_src[7257] / FRAC_SCALE ,
-			lut_src[7258] / FRAC_SCALE ,
-			lut_src[7259] / FRAC_SCALE ,
-			lut_src[7260] / FRAC_SCALE ,
-			lut_src[7261] / FRAC_SCALE ,
-			lut_src[7262] / FRAC_SCALE ,
-			lut_src[7263] / FRAC_SCALE ,
-			lut_src[7264] / FRAC_SCALE ,
-			lut_src[7265] / FRAC_SCALE ,
-			lut_src[7266] / FRAC_SCALE ,
-			lut_src[7267] / FRAC_SCALE ,
-			lut_src[7268] / FRAC_SCALE ,
-			lut_src[7269] / FRAC_SCALE ,
-			lut_src[7270] / FRAC_SCALE ,
-			lut_src[7271] / FRAC_SCALE ,
-			lut_src[7272] / FRAC_SCALE ,
-			lut_src[7273] / FRAC_SCALE ,
-			lut_src[7274] / FRAC_SCALE ,
-			lut_src[7275] / FRAC_SCALE ,
-			lut_src[7276] / FRAC_SCALE ,
-			lut_src[7277] / FRAC_SCALE ,
-			lut_src[7278] / FRAC_SCALE ,
-			lut_src[7279] / FRAC_SCALE ,
-			lut_src[7280] / FRAC_SCALE ,
-			lut_src[7281] / FRAC_SCALE ,
-			lut_src[7282] / FRAC_SCALE ,
-			lut_src[7283] / FRAC_SCALE ,
-			lut_src[7284] / FRAC_SCALE ,
-			lut_src[7285] / FRAC_SCALE ,
-			lut_src[7286] / FRAC_SCALE ,
-			lut_src[7287] / FRAC_SCALE ,
-			lut_src[7288] / FRAC_SCALE ,
-			lut_src[7289] / FRAC_SCALE ,
-			lut_src[7290] / FRAC_SCALE ,
-			lut_src[7291] / FRAC_SCALE ,
-			lut_src[7292] / FRAC_SCALE ,
-			lut_src[7293] / FRAC_SCALE ,
-			lut_src[7294] / FRAC_SCALE ,
-			lut_src[7295] / FRAC_SCALE ,
-			lut_src[7296] / FRAC_SCALE ,
-			lut_src[7297] / FRAC_SCALE ,
-			lut_src[7298] / FRAC_SCALE ,
-			lut_src[7299] / FRAC_SCALE ,
-			lut_src[7300] / FRAC_SCALE ,
-			lut_src[7301] / FRAC_SCALE ,
-			lut_src[7302] / FRAC_SCALE ,
-			lut_src[7303] / FRAC_SCALE ,
-			lut_src[7304] / FRAC_SCALE ,
-			lut_src[7305] / FRAC_SCALE ,
-			lut_src[7306] / FRAC_SCALE ,
-			lut_src[7307] / FRAC_SCALE ,
-			lut_src[7308] / FRAC_SCALE ,
-			lut_src[7309] / FRAC_SCALE ,
-			lut_src[7310] / FRAC_SCALE ,
-			lut_src[7311] / FRAC_SCALE ,
-			lut_src[7312] / FRAC_SCALE ,
-			lut_src[7313] / FRAC_SCALE ,
-			lut_src[7314] / FRAC_SCALE ,
-			lut_src[7315] / FRAC_SCALE ,
-			lut_src[7316] / FRAC_SCALE ,
-			lut_src[7317] / FRAC_SCALE ,
-			lut_src[7318] / FRAC_SCALE ,
-			lut_src[7319] / FRAC_SCALE ,
-			lut_src[7320] / FRAC_SCALE ,
-			lut_src[7321] / FRAC_SCALE ,
-			lut_src[7322] / FRAC_SCALE ,
-			lut_src[7323] / FRAC_SCALE ,
-			lut_src[7324] / FRAC_SCALE ,
-			lut_src[7325] / FRAC_SCALE ,
-			lut_src[7326] / FRAC_SCALE ,
-			lut_src[7327] / FRAC_SCALE ,
-			lut_src[7328] / FRAC_SCALE ,
-			lut_src[7329] / FRAC_SCALE ,
-			lut_src[7330] / FRAC_SCALE ,
-			lut_src[7331] / FRAC_SCALE ,
-			lut_src[7332] / FRAC_SCALE ,
-			lut_src[7333] / FRAC_SCALE ,
-			lut_src[7334] / FRAC_SCALE ,
-			lut_src[7335] / FRAC_SCALE ,
-			lut_src[7336] / FRAC_SCALE ,
-			lut_src[7337] / FRAC_SCALE ,
-			lut_src[7338] / FRAC_SCALE ,
-			lut_src[7339] / FRAC_SCALE ,
-			lut_src[7340] / FRAC_SCALE ,
-			lut_src[7341] / FRAC_SCALE ,
-			lut_src[7342] / FRAC_SCALE ,
-			lut_src[7343] / FRAC_SCALE ,
-			lut_src[7344] / FRAC_SCALE ,
-			lut_src[7345] / FRAC_SCALE ,
-			lut_src[7346] / FRAC_SCALE ,
-			lut_src[7347] / FRAC_SCALE ,
-			lut_src[7348] / FRAC_SCALE ,
-			lut_src[7349] / FRAC_SCALE ,
-			lut_src[7350] / FRAC_SCALE ,
-			lut_src[7351] / FRAC_SCALE ,
-			lut_src[7352] / FRAC_SCALE ,
-			lut_src[7353] / FRAC_SCALE ,
-			lut_src[7354] / FRAC_SCALE ,
-			lut_src[7355] / FRAC_SCALE ,
-			lut_src[7356] / FRAC_SCALE ,
-			lut_src[7357] / FRAC_SCALE ,
-			lut_src[7358] / FRAC_SCALE ,
-			lut_src[7359] / FRAC_SCALE ,
-			lut_src[7360] / FRAC_SCALE ,
-			lut_src[7361] / FRAC_SCALE ,
-			lut_src[7362] / FRAC_SCALE ,
-			lut_src[7363] / FRAC_SCALE ,
-			lut_src[7364] / FRAC_SCALE ,
-			lut_src[7365] / FRAC_SCALE ,
-			lut_src[7366] / FRAC_SCALE ,
-			lut_src[7367] / FRAC_SCALE ,
-			lut_src[7368] / FRAC_SCALE ,
-			lut_src[7369] / FRAC_SCALE ,
-			lut_src[7370] / FRAC_SCALE ,
-			lut_src[7371] / FRAC_SCALE ,
-			lut_src[7372] / FRAC_SCALE ,
-			lut_src[7373] / FRAC_SCALE ,
-			lut_src[7374] / FRAC_SCALE ,
-			lut_src[7375] / FRAC_SCALE ,
-			lut_src[7376] / FRAC_SCALE ,
-			lut_src[7377] / FRAC_SCALE ,
-			lut_src[7378] / FRAC_SCALE ,
-			lut_src[7379] / FRAC_SCALE ,
-			lut_src[7380] / FRAC_SCALE ,
-			lut_src[7381] / FRAC_SCALE ,
-			lut_src[7382] / FRAC_SCALE ,
-			lut_src[7383] / FRAC_SCALE ,
-			lut_src[7384] / FRAC_SCALE ,
-			lut_src[7385] / FRAC_SCALE ,
-			lut_src[7386] / FRAC_SCALE ,
-			lut_src[7387] / FRAC_SCALE ,
-			lut_src[7388] / FRAC_SCALE ,
-			lut_src[7389] / FRAC_SCALE ,
-			lut_src[7390] / FRAC_SCALE ,
-			lut_src[7391] / FRAC_SCALE ,
-			lut_src[7392] / FRAC_SCALE ,
-			lut_src[7393] / FRAC_SCALE ,
-			lut_src[7394] / FRAC_SCALE ,
-			lut_src[7395] / FRAC_SCALE ,
-			lut_src[7396] / FRAC_SCALE ,
-			lut_src[7397] / FRAC_SCALE ,
-			lut_src[7398] / FRAC_SCALE ,
-			lut_src[7399] / FRAC_SCALE ,
-			lut_src[7400] / FRAC_SCALE ,
-			lut_src[7401] / FRAC_SCALE ,
-			lut_src[7402] / FRAC_SCALE ,
-			lut_src[7403] / FRAC_SCALE ,
-			lut_src[7404] / FRAC_SCALE ,
-			lut_src[7405] / FRAC_SCALE ,
-			lut_src[7406] / FRAC_SCALE ,
-			lut_src[7407] / FRAC_SCALE ,
-			lut_src[7408] / FRAC_SCALE ,
-			lut_src[7409] / FRAC_SCALE ,
-			lut_src[7410] / FRAC_SCALE ,
-			lut_src[7411] / FRAC_SCALE ,
-			lut_src[7412] / FRAC_SCALE ,
-			lut_src[7413] / FRAC_SCALE ,
-			lut_src[7414] / FRAC_SCALE ,
-			lut_src[7415] / FRAC_SCALE ,
-			lut_src[7416] / FRAC_SCALE ,
-			lut_src[7417] / FRAC_SCALE ,
-			lut_src[7418] / FRAC_SCALE ,
-			lut_src[7419] / FRAC_SCALE ,
-			lut_src[7420] / FRAC_SCALE ,
-			lut_src[7421] / FRAC_SCALE ,
-			lut_src[7422] / FRAC_SCALE ,
-			lut_src[7423] / FRAC_SCALE ,
-			lut_src[7424] / FRAC_SCALE ,
-			lut_src[7425] / FRAC_SCALE ,
-			lut_src[7426] / FRAC_SCALE ,
-			lut_src[7427] / FRAC_SCALE ,
-			lut_src[7428] / FRAC_SCALE ,
-			lut_src[7429] / FRAC_SCALE ,
-			lut_src[7430] / FRAC_SCALE ,
-			lut_src[7431] / FRAC_SCALE ,
-			lut_src[7432] / FRAC_SCALE ,
-			lut_src[7433] / FRAC_SCALE ,
-			lut_src[7434] / FRAC_SCALE ,
-			lut_src[7435] / FRAC_SCALE ,
-			lut_src[7436] / FRAC_SCALE ,
-			lut_src[7437] / FRAC_SCALE ,
-			lut_src[7438] / FRAC_SCALE ,
-			lut_src[7439] / FRAC_SCALE ,
-			lut_src[7440] / FRAC_SCALE ,
-			lut_src[7441] / FRAC_SCALE ,
-			lut_src[7442] / FRAC_SCALE ,
-			lut_src[7443] / FRAC_SCALE ,
-			lut_src[7444] / FRAC_SCALE ,
-			lut_src[7445] / FRAC_SCALE ,
-			lut_src[7446] / FRAC_SCALE ,
-			lut_src[7447] / FRAC_SCALE ,
-			lut_src[7448] / FRAC_SCALE ,
-			lut_src[7449] / FRAC_SCALE ,
-			lut_src[7450] / FRAC_SCALE ,
-			lut_src[7451] / FRAC_SCALE ,
-			lut_src[7452] / FRAC_SCALE ,
-			lut_src[7453] / FRAC_SCALE ,
-			lut_src[7454] / FRAC_SCALE ,
-			lut_src[7455] / FRAC_SCALE ,
-			lut_src[7456] / FRAC_SCALE ,
-			lut_src[7457] / FRAC_SCALE ,
-			lut_src[7458] / FRAC_SCALE ,
-			lut_src[7459] / FRAC_SCALE ,
-			lut_src[7460] / FRAC_SCALE ,
-			lut_src[7461] / FRAC_SCALE ,
-			lut_src[7462] / FRAC_SCALE ,
-			lut_src[7463] / FRAC_SCALE ,
-			lut_src[7464] / FRAC_SCALE ,
-			lut_src[7465] / FRAC_SCALE ,
-			lut_src[7466] / FRAC_SCALE ,
-			lut_src[7467] / FRAC_SCALE ,
-			lut_src[7468] / FRAC_SCALE ,
-			lut_src[7469] / FRAC_SCALE ,
-			lut_src[7470] / FRAC_SCALE ,
-			lut_src[7471] / FRAC_SCALE ,
-			lut_src[7472] / FRAC_SCALE ,
-			lut_src[7473] / FRAC_SCALE ,
-			lut_src[7474] / FRAC_SCALE ,
-			lut_src[7475] / FRAC_SCALE ,
-			lut_src[7476] / FRAC_SCALE ,
-			lut_src[7477] / FRAC_SCALE ,
-			lut_src[7478] / FRAC_SCALE ,
-			lut_src[7479] / FRAC_SCALE ,
-			lut_src[7480] / FRAC_SCALE ,
-			lut_src[7481] / FRAC_SCALE ,
-			lut_src[7482] / FRAC_SCALE ,
-			lut_src[7483] / FRAC_SCALE ,
-			lut_src[7484] / FRAC_SCALE ,
-			lut_src[7485] / FRAC_SCALE ,
-			lut_src[7486] / FRAC_SCALE ,
-			lut_src[7487] / FRAC_SCALE ,
-			lut_src[7488] / FRAC_SCALE ,
-			lut_src[7489] / FRAC_SCALE ,
-			lut_src[7490] / FRAC_SCALE ,
-			lut_src[7491] / FRAC_SCALE ,
-			lut_src[7492] / FRAC_SCALE ,
-			lut_src[7493] / FRAC_SCALE ,
-			lut_src[7494] / FRAC_SCALE ,
-			lut_src[7495] / FRAC_SCALE ,
-			lut_src[7496] / FRAC_SCALE ,
-			lut_src[7497] / FRAC_SCALE ,
-			lut_src[7498] / FRAC_SCALE ,
-			lut_src[7499] / FRAC_SCALE ,
-			lut_src[7500] / FRAC_SCALE ,
-			lut_src[7501] / FRAC_SCALE ,
-			lut_src[7502] / FRAC_SCALE ,
-			lut_src[7503] / FRAC_SCALE ,
-			lut_src[7504] / FRAC_SCALE ,
-			lut_src[7505] / FRAC_SCALE ,
-			lut_src[7506] / FRAC_SCALE ,
-			lut_src[7507] / FRAC_SCALE ,
-			lut_src[7508] / FRAC_SCALE ,
-			lut_src[7509] / FRAC_SCALE ,
-			lut_src[7510] / FRAC_SCALE ,
-			lut_src[7511] / FRAC_SCALE ,
-			lut_src[7512] / FRAC_SCALE ,
-			lut_src[7513] / FRAC_SCALE ,
-			lut_src[7514] / FRAC_SCALE ,
-			lut_src[7515] / FRAC_SCALE ,
-			lut_src[7516] / FRAC_SCALE ,
-			lut_src[7517] / FRAC_SCALE ,
-			lut_src[7518] / FRAC_SCALE ,
-			lut_src[7519] / FRAC_SCALE ,
-			lut_src[7520] / FRAC_SCALE ,
-			lut_src[7521] / FRAC_SCALE ,
-			lut_src[7522] / FRAC_SCALE ,
-			lut_src[7523] / FRAC_SCALE ,
-			lut_src[7524] / FRAC_SCALE ,
-			lut_src[7525] / FRAC_SCALE ,
-			lut_src[7526] / FRAC_SCALE ,
-			lut_src[7527] / FRAC_SCALE ,
-			lut_src[7528] / FRAC_SCALE ,
-			lut_src[7529] / FRAC_SCALE ,
-			lut_src[7530] / FRAC_SCALE ,
-			lut_src[7531] / FRAC_SCALE ,
-			lut_src[7532] / FRAC_SCALE ,
-			lut_src[7533] / FRAC_SCALE ,
-			lut_src[7534] / FRAC_SCALE ,
-			lut_src[7535] / FRAC_SCALE ,
-			lut_src[7536] / FRAC_SCALE ,
-			lut_src[7537] / FRAC_SCALE ,
-			lut_src[7538] / FRAC_SCALE ,
-			lut_src[7539] / FRAC_SCALE ,
-			lut_src[7540] / FRAC_SCALE ,
-			lut_src[7541] / FRAC_SCALE ,
-			lut_src[7542] / FRAC_SCALE ,
-			lut_src[7543] / FRAC_SCALE ,
-			lut_src[7544] / FRAC_SCALE ,
-			lut_src[7545] / FRAC_SCALE ,
-			lut_src[7546] / FRAC_SCALE ,
-			lut_src[7547] / FRAC_SCALE ,
-			lut_src[7548] / FRAC_SCALE ,
-			lut_src[7549] / FRAC_SCALE ,
-			lut_src[7550] / FRAC_SCALE ,
-			lut_src[7551] / FRAC_SCALE ,
-			lut_src[7552] / FRAC_SCALE ,
-			lut_src[7553] / FRAC_SCALE ,
-			lut_src[7554] / FRAC_SCALE ,
-			lut_src[7555] / FRAC_SCALE ,
-			lut_src[7556] / FRAC_SCALE ,
-			lut_src[7557] / FRAC_SCALE ,
-			lut_src[7558] / FRAC_SCALE ,
-			lut_src[7559] / FRAC_SCALE ,
-			lut_src[7560] / FRAC_SCALE ,
-			lut_src[7561] / FRAC_SCALE ,
-			lut_src[7562] / FRAC_SCALE ,
-			lut_src[7563] / FRAC_SCALE ,
-			lut_src[7564] / FRAC_SCALE ,
-			lut_src[7565] / FRAC_SCALE ,
-			lut_src[7566] / FRAC_SCALE ,
-			lut_src[7567] / FRAC_SCALE ,
-			lut_src[7568] / FRAC_SCALE ,
-			lut_src[7569] / FRAC_SCALE ,
-			lut_src[7570] / FRAC_SCALE ,
-			lut_src[7571] / FRAC_SCALE ,
-			lut_src[7572] / FRAC_SCALE ,
-			lut_src[7573] / FRAC_SCALE ,
-			lut_src[7574] / FRAC_SCALE ,
-			lut_src[7575] / FRAC_SCALE ,
-			lut_src[7576] / FRAC_SCALE ,
-			lut_src[7577] / FRAC_SCALE ,
-			lut_src[7578] / FRAC_SCALE ,
-			lut_src[7579] / FRAC_SCALE ,
-			lut_src[7580] / FRAC_SCALE ,
-			lut_src[7581] / FRAC_SCALE ,
-			lut_src[7582] / FRAC_SCALE ,
-			lut_src[7583] / FRAC_SCALE ,
-			lut_src[7584] / FRAC_SCALE ,
-			lut_src[7585] / FRAC_SCALE ,
-			lut_src[7586] / FRAC_SCALE ,
-			lut_src[7587] / FRAC_SCALE ,
-			lut_src[7588] / FRAC_SCALE ,
-			lut_src[7589] / FRAC_SCALE ,
-			lut_src[7590] / FRAC_SCALE ,
-			lut_src[7591] / FRAC_SCALE ,
-			lut_src[7592] / FRAC_SCALE ,
-			lut_src[7593] / FRAC_SCALE ,
-			lut_src[7594] / FRAC_SCALE ,
-			lut_src[7595] / FRAC_SCALE ,
-			lut_src[7596] / FRAC_SCALE ,
-			lut_src[7597] / FRAC_SCALE ,
-			lut_src[7598] / FRAC_SCALE ,
-			lut_src[7599] / FRAC_SCALE ,
-			lut_src[7600] / FRAC_SCALE ,
-			lut_src[7601] / FRAC_SCALE ,
-			lut_src[7602] / FRAC_SCALE ,
-			lut_src[7603] / FRAC_SCALE ,
-			lut_src[7604] / FRAC_SCALE ,
-			lut_src[7605] / FRAC_SCALE ,
-			lut_src[7606] / FRAC_SCALE ,
-			lut_src[7607] / FRAC_SCALE ,
-			lut_src[7608] / FRAC_SCALE ,
-			lut_src[7609] / FRAC_SCALE ,
-			lut_src[7610] / FRAC_SCALE ,
-			lut_src[7611] / FRAC_SCALE ,
-			lut_src[7612] / FRAC_SCALE ,
-			lut_src[7613] / FRAC_SCALE ,
-			lut_src[7614] / FRAC_SCALE ,
-			lut_src[7615] / FRAC_SCALE ,
-			lut_src[7616] / FRAC_SCALE ,
-			lut_src[7617] / FRAC_SCALE ,
-			lut_src[7618] / FRAC_SCALE ,
-			lut_src[7619] / FRAC_SCALE ,
-			lut_src[7620] / FRAC_SCALE ,
-			lut_src[7621] / FRAC_SCALE ,
-			lut_src[7622] / FRAC_SCALE ,
-			lut_src[7623] / FRAC_SCALE ,
-			lut_src[7624] / FRAC_SCALE ,
-			lut_src[7625] / FRAC_SCALE ,
-			lut_src[7626] / FRAC_SCALE ,
-			lut_src[7627] / FRAC_SCALE ,
-			lut_src[7628] / FRAC_SCALE ,
-			lut_src[7629] / FRAC_SCALE ,
-			lut_src[7630] / FRAC_SCALE ,
-			lut_src[7631] / FRAC_SCALE ,
-			lut_src[7632] / FRAC_SCALE ,
-			lut_src[7633] / FRAC_SCALE ,
-			lut_src[7634] / FRAC_SCALE ,
-			lut_src[7635] / FRAC_SCALE ,
-			lut_src[7636] / FRAC_SCALE ,
-			lut_src[7637] / FRAC_SCALE ,
-			lut_src[7638] / FRAC_SCALE ,
-			lut_src[7639] / FRAC_SCALE ,
-			lut_src[7640] / FRAC_SCALE ,
-			lut_src[7641] / FRAC_SCALE ,
-			lut_src[7642] / FRAC_SCALE ,
-			lut_src[7643] / FRAC_SCALE ,
-			lut_src[7644] / FRAC_SCALE ,
-			lut_src[7645] / FRAC_SCALE ,
-			lut_src[7646] / FRAC_SCALE ,
-			lut_src[7647] / FRAC_SCALE ,
-			lut_src[7648] / FRAC_SCALE ,
-			lut_src[7649] / FRAC_SCALE ,
-			lut_src[7650] / FRAC_SCALE ,
-			lut_src[7651] / FRAC_SCALE ,
-			lut_src[7652] / FRAC_SCALE ,
-			lut_src[7653] / FRAC_SCALE ,
-			lut_src[7654] / FRAC_SCALE ,
-			lut_src[7655] / FRAC_SCALE ,
-			lut_src[7656] / FRAC_SCALE ,
-			lut_src[7657] / FRAC_SCALE ,
-			lut_src[7658] / FRAC_SCALE ,
-			lut_src[7659] / FRAC_SCALE ,
-			lut_src[7660] / FRAC_SCALE ,
-			lut_src[7661] / FRAC_SCALE ,
-			lut_src[7662] / FRAC_SCALE ,
-			lut_src[7663] / FRAC_SCALE ,
-			lut_src[7664] / FRAC_SCALE ,
-			lut_src[7665] / FRAC_SCALE ,
-			lut_src[7666] / FRAC_SCALE ,
-			lut_src[7667] / FRAC_SCALE ,
-			lut_src[7668] / FRAC_SCALE ,
-			lut_src[7669] / FRAC_SCALE ,
-			lut_src[7670] / FRAC_SCALE ,
-			lut_src[7671] / FRAC_SCALE ,
-			lut_src[7672] / FRAC_SCALE ,
-			lut_src[7673] / FRAC_SCALE ,
-			lut_src[7674] / FRAC_SCALE ,
-			lut_src[7675] / FRAC_SCALE ,
-			lut_src[7676] / FRAC_SCALE ,
-			lut_src[7677] / FRAC_SCALE ,
-			lut_src[7678] / FRAC_SCALE ,
-			lut_src[7679] / FRAC_SCALE ,
-			lut_src[7680] / FRAC_SCALE ,
-			lut_src[7681] / FRAC_SCALE ,
-			lut_src[7682] / FRAC_SCALE ,
-			lut_src[7683] / FRAC_SCALE ,
-			lut_src[7684] / FRAC_SCALE ,
-			lut_src[7685] / FRAC_SCALE ,
-			lut_src[7686] / FRAC_SCALE ,
-			lut_src[7687] / FRAC_SCALE ,
-			lut_src[7688] / FRAC_SCALE ,
-			lut_src[7689] / FRAC_SCALE ,
-			lut_src[7690] / FRAC_SCALE ,
-			lut_src[7691] / FRAC_SCALE ,
-			lut_src[7692] / FRAC_SCALE ,
-			lut_src[7693] / FRAC_SCALE ,
-			lut_src[7694] / FRAC_SCALE ,
-			lut_src[7695] / FRAC_SCALE ,
-			lut_src[7696] / FRAC_SCALE ,
-			lut_src[7697] / FRAC_SCALE ,
-			lut_src[7698] / FRAC_SCALE ,
-			lut_src[7699] / FRAC_SCALE ,
-			lut_src[7700] / FRAC_SCALE ,
-			lut_src[7701] / FRAC_SCALE ,
-			lut_src[7702] / FRAC_SCALE ,
-			lut_src[7703] / FRAC_SCALE ,
-			lut_src[7704] / FRAC_SCALE ,
-			lut_src[7705] / FRAC_SCALE ,
-			lut_src[7706] / FRAC_SCALE ,
-			lut_src[7707] / FRAC_SCALE ,
-			lut_src[7708] / FRAC_SCALE ,
-			lut_src[7709] / FRAC_SCALE ,
-			lut_src[7710] / FRAC_SCALE ,
-			lut_src[7711] / FRAC_SCALE ,
-			lut_src[7712] / FRAC_SCALE ,
-			lut_src[7713] / FRAC_SCALE ,
-			lut_src[7714] / FRAC_SCALE ,
-			lut_src[7715] / FRAC_SCALE ,
-			lut_src[7716] / FRAC_SCALE ,
-			lut_src[7717] / FRAC_SCALE ,
-			lut_src[7718] / FRAC_SCALE ,
-			lut_src[7719] / FRAC_SCALE ,
-			lut_src[7720] / FRAC_SCALE ,
-			lut_src[7721] / FRAC_SCALE ,
-			lut_src[7722] / FRAC_SCALE ,
-			lut_src[7723] / FRAC_SCALE ,
-			lut_src[7724] / FRAC_SCALE ,
-			lut_src[7725] / FRAC_SCALE ,
-			lut_src[7726] / FRAC_SCALE ,
-			lut_src[7727] / FRAC_SCALE ,
-			lut_src[7728] / FRAC_SCALE ,
-			lut_src[7729] / FRAC_SCALE ,
-			lut_src[7730] / FRAC_SCALE ,
-			lut_src[7731] / FRAC_SCALE ,
-			lut_src[7732] / FRAC_SCALE ,
-			lut_src[7733] / FRAC_SCALE ,
-			lut_src[7734] / FRAC_SCALE ,
-			lut_src[7735] / FRAC_SCALE ,
-			lut_src[7736] / FRAC_SCALE ,
-			lut_src[7737] / FRAC_SCALE ,
-			lut_src[7738] / FRAC_SCALE ,
-			lut_src[7739] / FRAC_SCALE ,
-			lut_src[7740] / FRAC_SCALE ,
-			lut_src[7741] / FRAC_SCALE ,
-			lut_src[7742] / FRAC_SCALE ,
-			lut_src[7743] / FRAC_SCALE ,
-			lut_src[7744] / FRAC_SCALE ,
-			lut_src[7745] / FRAC_SCALE ,
-			lut_src[7746] / FRAC_SCALE ,
-			lut_src[7747] / FRAC_SCALE ,
-			lut_src[7748] / FRAC_SCALE ,
-			lut_src[7749] / FRAC_SCALE ,
-			lut_src[7750] / FRAC_SCALE ,
-			lut_src[7751] / FRAC_SCALE ,
-			lut_src[7752] / FRAC_SCALE ,
-			lut_src[7753] / FRAC_SCALE ,
-			lut_src[7754] / FRAC_SCALE ,
-			lut_src[7755] / FRAC_SCALE ,
-			lut_src[7756] / FRAC_SCALE ,
-			lut_src[7757] / FRAC_SCALE ,
-			lut_src[7758] / FRAC_SCALE ,
-			lut_src[7759] / FRAC_SCALE ,
-			lut_src[7760] / FRAC_SCALE ,
-			lut_src[7761] / FRAC_SCALE ,
-			lut_src[7762] / FRAC_SCALE ,
-			lut_src[7763] / FRAC_SCALE ,
-			lut_src[7764] / FRAC_SCALE ,
-			lut_src[7765] / FRAC_SCALE ,
-			lut_src[7766] / FRAC_SCALE ,
-			lut_src[7767] / FRAC_SCALE ,
-			lut_src[7768] / FRAC_SCALE ,
-			lut_src[7769] / FRAC_SCALE ,
-			lut_src[7770] / FRAC_SCALE ,
-			lut_src[7771] / FRAC_SCALE ,
-			lut_src[7772] / FRAC_SCALE ,
-			lut_src[7773] / FRAC_SCALE ,
-			lut_src[7774] / FRAC_SCALE ,
-			lut_src[7775] / FRAC_SCALE ,
-			lut_src[7776] / FRAC_SCALE ,
-			lut_src[7777] / FRAC_SCALE ,
-			lut_src[7778] / FRAC_SCALE ,
-			lut_src[7779] / FRAC_SCALE ,
-			lut_src[7780] / FRAC_SCALE ,
-			lut_src[7781] / FRAC_SCALE ,
-			lut_src[7782] / FRAC_SCALE ,
-			lut_src[7783] / FRAC_SCALE ,
-			lut_src[7784] / FRAC_SCALE ,
-			lut_src[7785] / FRAC_SCALE ,
-			lut_src[7786] / FRAC_SCALE ,
-			lut_src[7787] / FRAC_SCALE ,
-			lut_src[7788] / FRAC_SCALE ,
-			lut_src[7789] / FRAC_SCALE ,
-			lut_src[7790] / FRAC_SCALE ,
-			lut_src[7791] / FRAC_SCALE ,
-			lut_src[7792] / FRAC_SCALE ,
-			lut_src[7793] / FRAC_SCALE ,
-			lut_src[7794] / FRAC_SCALE ,
-			lut_src[7795] / FRAC_SCALE ,
-			lut_src[7796] / FRAC_SCALE ,
-			lut_src[7797] / FRAC_SCALE ,
-			lut_src[7798] / FRAC_SCALE ,
-			lut_src[7799] / FRAC_SCALE ,
-			lut_src[7800] / FRAC_SCALE ,
-			lut_src[7801] / FRAC_SCALE ,
-			lut_src[7802] / FRAC_SCALE ,
-			lut_src[7803] / FRAC_SCALE ,
-			lut_src[7804] / FRAC_SCALE ,
-			lut_src[7805] / FRAC_SCALE ,
-			lut_src[7806] / FRAC_SCALE ,
-			lut_src[7807] / FRAC_SCALE ,
-			lut_src[7808] / FRAC_SCALE ,
-			lut_src[7809] / FRAC_SCALE ,
-			lut_src[7810] / FRAC_SCALE ,
-			lut_src[7811] / FRAC_SCALE ,
-			lut_src[7812] / FRAC_SCALE ,
-			lut_src[7813] / FRAC_SCALE ,
-			lut_src[7814] / FRAC_SCALE ,
-			lut_src[7815] / FRAC_SCALE ,
-			lut_src[7816] / FRAC_SCALE ,
-			lut_src[7817] / FRAC_SCALE ,
-			lut_src[7818] / FRAC_SCALE ,
-			lut_src[7819] / FRAC_SCALE ,
-			lut_src[7820] / FRAC_SCALE ,
-			lut_src[7821] / FRAC_SCALE ,
-			lut_src[7822] / FRAC_SCALE ,
-			lut_src[7823] / FRAC_SCALE ,
-			lut_src[7824] / FRAC_SCALE ,
-			lut_src[7825] / FRAC_SCALE ,
-			lut_src[7826] / FRAC_SCALE ,
-			lut_src[7827] / FRAC_SCALE ,
-			lut_src[7828] / FRAC_SCALE ,
-			lut_src[7829] / FRAC_SCALE ,
-			lut_src[7830] / FRAC_SCALE ,
-			lut_src[7831] / FRAC_SCALE ,
-			lut_src[7832] / FRAC_SCALE ,
-			lut_src[7833] / FRAC_SCALE ,
-			lut_src[7834] / FRAC_SCALE ,
-			lut_src[7835] / FRAC_SCALE ,
-			lut_src[7836] / FRAC_SCALE ,
-			lut_src[7837] / FRAC_SCALE ,
-			lut_src[7838] / FRAC_SCALE ,
-			lut_src[7839] / FRAC_SCALE ,
-			lut_src[7840] / FRAC_SCALE ,
-			lut_src[7841] / FRAC_SCALE ,
-			lut_src[7842] / FRAC_SCALE ,
-			lut_src[7843] / FRAC_SCALE ,
-			lut_src[7844] / FRAC_SCALE ,
-			lut_src[7845] / FRAC_SCALE ,
-			lut_src[7846] / FRAC_SCALE ,
-			lut_src[7847] / FRAC_SCALE ,
-			lut_src[7848] / FRAC_SCALE ,
-			lut_src[7849] / FRAC_SCALE ,
-			lut_src[7850] / FRAC_SCALE ,
-			lut_src[7851] / FRAC_SCALE ,
-			lut_src[7852] / FRAC_SCALE ,
-			lut_src[7853] / FRAC_SCALE ,
-			lut_src[7854] / FRAC_SCALE ,
-			lut_src[7855] / FRAC_SCALE ,
-			lut_src[7856] / FRAC_SCALE ,
-			lut_src[7857] / FRAC_SCALE ,
-			lut_src[7858] / FRAC_SCALE ,
-			lut_src[7859] / FRAC_SCALE ,
-			lut_src[7860] / FRAC_SCALE ,
-			lut_src[7861] / FRAC_SCALE ,
-			lut_src[7862] / FRAC_SCALE ,
-			lut_src[7863] / FRAC_SCALE ,
-			lut_src[7864] / FRAC_SCALE ,
-			lut_src[7865] / FRAC_SCALE ,
-			lut_src[7866] / FRAC_SCALE ,
-			lut_src[7867] / FRAC_SCALE ,
-			lut_src[7868] / FRAC_SCALE ,
-			lut_src[7869] / FRAC_SCALE ,
-			lut_src[7870] / FRAC_SCALE ,
-			lut_src[7871] / FRAC_SCALE ,
-			lut_src[7872] / FRAC_SCALE ,
-			lut_src[7873] / FRAC_SCALE ,
-			lut_src[7874] / FRAC_SCALE ,
-			lut_src[7875] / FRAC_SCALE ,
-			lut_src[7876] / FRAC_SCALE ,
-			lut_src[7877] / FRAC_SCALE ,
-			lut_src[7878] / FRAC_SCALE ,
-			lut_src[7879] / FRAC_SCALE ,
-			lut_src[7880] / FRAC_SCALE ,
-			lut_src[7881] / FRAC_SCALE ,
-			lut_src[7882] / FRAC_SCALE ,
-			lut_src[7883] / FRAC_SCALE ,
-			lut_src[7884] / FRAC_SCALE ,
-			lut_src[7885] / FRAC_SCALE ,
-			lut_src[7886] / FRAC_SCALE ,
-			lut_src[7887] / FRAC_SCALE ,
-			lut_src[7888] / FRAC_SCALE ,
-			lut_src[7889] / FRAC_SCALE ,
-			lut_src[7890] / FRAC_SCALE ,
-			lut_src[7891] / FRAC_SCALE ,
-			lut_src[7892] / FRAC_SCALE ,
-			lut_src[7893] / FRAC_SCALE ,
-			lut_src[7894] / FRAC_SCALE ,
-			lut_src[7895] / FRAC_SCALE ,
-			lut_src[7896] / FRAC_SCALE ,
-			lut_src[7897] / FRAC_SCALE ,
-			lut_src[7898] / FRAC_SCALE ,
-			lut_src[7899] / FRAC_SCALE ,
-			lut_src[7900] / FRAC_SCALE ,
-			lut_src[7901] / FRAC_SCALE ,
-			lut_src[7902] / FRAC_SCALE ,
-			lut_src[7903] / FRAC_SCALE ,
-			lut_src[7904] / FRAC_SCALE ,
-			lut_src[7905] / FRAC_SCALE ,
-			lut_src[7906] / FRAC_SCALE ,
-			lut_src[7907] / FRAC_SCALE ,
-			lut_src[7908] / FRAC_SCALE ,
-			lut_src[7909] / FRAC_SCALE ,
-			lut_src[7910] / FRAC_SCALE ,
-			lut_src[7911] / FRAC_SCALE ,
-			lut_src[7912] / FRAC_SCALE ,
-			lut_src[7913] / FRAC_SCALE ,
-			lut_src[7914] / FRAC_SCALE ,
-			lut_src[7915] / FRAC_SCALE ,
-			lut_src[7916] / FRAC_SCALE ,
-			lut_src[7917] / FRAC_SCALE ,
-			lut_src[7918] / FRAC_SCALE ,
-			lut_src[7919] / FRAC_SCALE ,
-			lut_src[7920] / FRAC_SCALE ,
-			lut_src[7921] / FRAC_SCALE ,
-			lut_src[7922] / FRAC_SCALE ,
-			lut_src[7923] / FRAC_SCALE ,
-			lut_src[7924] / FRAC_SCALE ,
-			lut_src[7925] / FRAC_SCALE ,
-			lut_src[7926] / FRAC_SCALE ,
-			lut_src[7927] / FRAC_SCALE ,
-			lut_src[7928] / FRAC_SCALE ,
-			lut_src[7929] / FRAC_SCALE ,
-			lut_src[7930] / FRAC_SCALE ,
-			lut_src[7931] / FRAC_SCALE ,
-			lut_src[7932] / FRAC_SCALE ,
-			lut_src[7933] / FRAC_SCALE ,
-			lut_src[7934] / FRAC_SCALE ,
-			lut_src[7935] / FRAC_SCALE ,
-			lut_src[7936] / FRAC_SCALE ,
-			lut_src[7937] / FRAC_SCALE ,
-			lut_src[7938] / FRAC_SCALE ,
-			lut_src[7939] / FRAC_SCALE ,
-			lut_src[7940] / FRAC_SCALE ,
-			lut_src[7941] / FRAC_SCALE ,
-			lut_src[7942] / FRAC_SCALE ,
-			lut_src[7943] / FRAC_SCALE ,
-			lut_src[7944] / FRAC_SCALE ,
-			lut_src[7945] / FRAC_SCALE ,
-			lut_src[7946] / FRAC_SCALE ,
-			lut_src[7947] / FRAC_SCALE ,
-			lut_src[7948] / FRAC_SCALE ,
-			lut_src[7949] / FRAC_SCALE ,
-			lut_src[7950] / FRAC_SCALE ,
-			lut_src[7951] / FRAC_SCALE ,
-			lut_src[7952] / FRAC_SCALE ,
-			lut_src[7953] / FRAC_SCALE ,
-			lut_src[7954] / FRAC_SCALE ,
-			lut_src[7955] / FRAC_SCALE ,
-			lut_src[7956] / FRAC_SCALE ,
-			lut_src[7957] / FRAC_SCALE ,
-			lut_src[7958] / FRAC_SCALE ,
-			lut_src[7959] / FRAC_SCALE ,
-			lut_src[7960] / FRAC_SCALE ,
-			lut_src[7961] / FRAC_SCALE ,
-			lut_src[7962] / FRAC_SCALE ,
-			lut_src[7963] / FRAC_SCALE ,
-			lut_src[7964] / FRAC_SCALE ,
-			lut_src[7965] / FRAC_SCALE ,
-			lut_src[7966] / FRAC_SCALE ,
-			lut_src[7967] / FRAC_SCALE ,
-			lut_src[7968] / FRAC_SCALE ,
-			lut_src[7969] / FRAC_SCALE ,
-			lut_src[7970] / FRAC_SCALE ,
-			lut_src[7971] / FRAC_SCALE ,
-			lut_src[7972] / FRAC_SCALE ,
-			lut_src[7973] / FRAC_SCALE ,
-			lut_src[7974] / FRAC_SCALE ,
-			lut_src[7975] / FRAC_SCALE ,
-			lut_src[7976] / FRAC_SCALE ,
-			lut_src[7977] / FRAC_SCALE ,
-			lut_src[7978] / FRAC_SCALE ,
-			lut_src[7979] / FRAC_SCALE ,
-			lut_src[7980] / FRAC_SCALE ,
-			lut_src[7981] / FRAC_SCALE ,
-			lut_src[7982] / FRAC_SCALE ,
-			lut_src[7983] / FRAC_SCALE ,
-			lut_src[7984] / FRAC_SCALE ,
-			lut_src[7985] / FRAC_SCALE ,
-			lut_src[7986] / FRAC_SCALE ,
-			lut_src[7987] / FRAC_SCALE ,
-			lut_src[7988] / FRAC_SCALE ,
-			lut_src[7989] / FRAC_SCALE ,
-			lut_src[7990] / FRAC_SCALE ,
-			lut_src[7991] / FRAC_SCALE ,
-			lut_src[7992] / FRAC_SCALE ,
-			lut_src[7993] / FRAC_SCALE ,
-			lut_src[7994] / FRAC_SCALE ,
-			lut_src[7995] / FRAC_SCALE ,
-			lut_src[7996] / FRAC_SCALE ,
-			lut_src[7997] / FRAC_SCALE ,
-			lut_src[7998] / FRAC_SCALE ,
-			lut_src[7999] / FRAC_SCALE ,
-			lut_src[8000] / FRAC_SCALE ,
-			lut_src[8001] / FRAC_SCALE ,
-			lut_src[8002] / FRAC_SCALE ,
-			lut_src[8003] / FRAC_SCALE ,
-			lut_src[8004] / FRAC_SCALE ,
-			lut_src[8005] / FRAC_SCALE ,
-			lut_src[8006] / FRAC_SCALE ,
-			lut_src[8007] / FRAC_SCALE ,
-			lut_src[8008] / FRAC_SCALE ,
-			lut_src[8009] / FRAC_SCALE ,
-			lut_src[8010] / FRAC_SCALE ,
-			lut_src[8011] / FRAC_SCALE ,
-			lut_src[8012] / FRAC_SCALE ,
-			lut_src[8013] / FRAC_SCALE ,
-			lut_src[8014] / FRAC_SCALE ,
-			lut_src[8015] / FRAC_SCALE ,
-			lut_src[8016] / FRAC_SCALE ,
-			lut_src[8017] / FRAC_SCALE ,
-			lut_src[8018] / FRAC_SCALE ,
-			lut_src[8019] / FRAC_SCALE ,
-			lut_src[8020] / FRAC_SCALE ,
-			lut_src[8021] / FRAC_SCALE ,
-			lut_src[8022] / FRAC_SCALE ,
-			lut_src[8023] / FRAC_SCALE ,
-			lut_src[8024] / FRAC_SCALE ,
-			lut_src[8025] / FRAC_SCALE ,
-			lut_src[8026] / FRAC_SCALE ,
-			lut_src[8027] / FRAC_SCALE ,
-			lut_src[8028] / FRAC_SCALE ,
-			lut_src[8029] / FRAC_SCALE ,
-			lut_src[8030] / FRAC_SCALE ,
-			lut_src[8031] / FRAC_SCALE ,
-			lut_src[8032] / FRAC_SCALE ,
-			lut_src[8033] / FRAC_SCALE ,
-			lut_src[8034] / FRAC_SCALE ,
-			lut_src[8035] / FRAC_SCALE ,
-			lut_src[8036] / FRAC_SCALE ,
-			lut_src[8037] / FRAC_SCALE ,
-			lut_src[8038] / FRAC_SCALE ,
-			lut_src[8039] / FRAC_SCALE ,
-			lut_src[8040] / FRAC_SCALE ,
-			lut_src[8041] / FRAC_SCALE ,
-			lut_src[8042] / FRAC_SCALE ,
-			lut_src[8043] / FRAC_SCALE ,
-			lut_src[8044] / FRAC_SCALE ,
-			lut_src[8045] / FRAC_SCALE ,
-			lut_src[8046] / FRAC_SCALE ,
-			lut_src[8047] / FRAC_SCALE ,
-			lut_src[8048] / FRAC_SCALE ,
-			lut_src[8049] / FRAC_SCALE ,
-			lut_src[8050] / FRAC_SCALE ,
-			lut_src[8051] / FRAC_SCALE ,
-			lut_src[8052] / FRAC_SCALE ,
-			lut_src[8053] / FRAC_SCALE ,
-			lut_src[8054] / FRAC_SCALE ,
-			lut_src[8055] / FRAC_SCALE ,
-			lut_src[8056] / FRAC_SCALE ,
-			lut_src[8057] / FRAC_SCALE ,
-			lut_src[8058] / FRAC_SCALE ,
-			lut_src[8059] / FRAC_SCALE ,
-			lut_src[8060] / FRAC_SCALE ,
-			lut_src[8061] / FRAC_SCALE ,
-			lut_src[8062] / FRAC_SCALE ,
-			lut_src[8063] / FRAC_SCALE ,
-			lut_src[8064] / FRAC_SCALE ,
-			lut_src[8065] / FRAC_SCALE ,
-			lut_src[8066] / FRAC_SCALE ,
-			lut_src[8067] / FRAC_SCALE ,
-			lut_src[8068] / FRAC_SCALE ,
-			lut_src[8069] / FRAC_SCALE ,
-			lut_src[8070] / FRAC_SCALE ,
-			lut_src[8071] / FRAC_SCALE ,
-			lut_src[8072] / FRAC_SCALE ,
-			lut_src[8073] / FRAC_SCALE ,
-			lut_src[8074] / FRAC_SCALE ,
-			lut_src[8075] / FRAC_SCALE ,
-			lut_src[8076] / FRAC_SCALE ,
-			lut_src[8077] / FRAC_SCALE ,
-			lut_src[8078] / FRAC_SCALE ,
-			lut_src[8079] / FRAC_SCALE ,
-			lut_src[8080] / FRAC_SCALE ,
-			lut_src[8081] / FRAC_SCALE ,
-			lut_src[8082] / FRAC_SCALE ,
-			lut_src[8083] / FRAC_SCALE ,
-			lut_src[8084] / FRAC_SCALE ,
-			lut_src[8085] / FRAC_SCALE ,
-			lut_src[8086] / FRAC_SCALE ,
-			lut_src[8087] / FRAC_SCALE ,
-			lut_src[8088] / FRAC_SCALE ,
-			lut_src[8089] / FRAC_SCALE ,
-			lut_src[8090] / FRAC_SCALE ,
-			lut_src[8091] / FRAC_SCALE ,
-			lut_src[8092] / FRAC_SCALE ,
-			lut_src[8093] / FRAC_SCALE ,
-			lut_src[8094] / FRAC_SCALE ,
-			lut_src[8095] / FRAC_SCALE ,
-			lut_src[8096] / FRAC_SCALE ,
-			lut_src[8097] / FRAC_SCALE ,
-			lut_src[8098] / FRAC_SCALE ,
-			lut_src[8099] / FRAC_SCALE ,
-			lut_src[8100] / FRAC_SCALE ,
-			lut_src[8101] / FRAC_SCALE ,
-			lut_src[8102] / FRAC_SCALE ,
-			lut_src[8103] / FRAC_SCALE ,
-			lut_src[8104] / FRAC_SCALE ,
-			lut_src[8105] / FRAC_SCALE ,
-			lut_src[8106] / FRAC_SCALE ,
-			lut_src[8107] / FRAC_SCALE ,
-			lut_src[8108] / FRAC_SCALE ,
-			lut_src[8109] / FRAC_SCALE ,
-			lut_src[8110] / FRAC_SCALE ,
-			lut_src[8111] / FRAC_SCALE ,
-			lut_src[8112] / FRAC_SCALE ,
-			lut_src[8113] / FRAC_SCALE ,
-			lut_src[8114] / FRAC_SCALE ,
-			lut_src[8115] / FRAC_SCALE ,
-			lut_src[8116] / FRAC_SCALE ,
-			lut_src[8117] / FRAC_SCALE ,
-			lut_src[8118] / FRAC_SCALE ,
-			lut_src[8119] / FRAC_SCALE ,
-			lut_src[8120] / FRAC_SCALE ,
-			lut_src[8121] / FRAC_SCALE ,
-			lut_src[8122] / FRAC_SCALE ,
-			lut_src[8123] / FRAC_SCALE ,
-			lut_src[8124] / FRAC_SCALE ,
-			lut_src[8125] / FRAC_SCALE ,
-			lut_src[8126] / FRAC_SCALE ,
-			lut_src[8127] / FRAC_SCALE ,
-			lut_src[8128] / FRAC_SCALE ,
-			lut_src[8129] / FRAC_SCALE ,
-			lut_src[8130] / FRAC_SCALE ,
-			lut_src[8131] / FRAC_SCALE ,
-			lut_src[8132] / FRAC_SCALE ,
-			lut_src[8133] / FRAC_SCALE ,
-			lut_src[8134] / FRAC_SCALE ,
-			lut_src[8135] / FRAC_SCALE ,
-			lut_src[8136] / FRAC_SCALE ,
-			lut_src[8137] / FRAC_SCALE ,
-			lut_src[8138] / FRAC_SCALE ,
-			lut_src[8139] / FRAC_SCALE ,
-			lut_src[8140] / FRAC_SCALE ,
-			lut_src[8141] / FRAC_SCALE ,
-			lut_src[8142] / FRAC_SCALE ,
-			lut_src[8143] / FRAC_SCALE ,
-			lut_src[8144] / FRAC_SCALE ,
-			lut_src[8145] / FRAC_SCALE ,
-			lut_src[8146] / FRAC_SCALE ,
-			lut_src[8147] / FRAC_SCALE ,
-			lut_src[8148] / FRAC_SCALE ,
-			lut_src[8149] / FRAC_SCALE ,
-			lut_src[8150] / FRAC_SCALE ,
-			lut_src[8151] / FRAC_SCALE ,
-			lut_src[8152] / FRAC_SCALE ,
-			lut_src[8153] / FRAC_SCALE ,
-			lut_src[8154] / FRAC_SCALE ,
-			lut_src[8155] / FRAC_SCALE ,
-			lut_src[8156] / FRAC_SCALE ,
-			lut_src[8157] / FRAC_SCALE ,
-			lut_src[8158] / FRAC_SCALE ,
-			lut_src[8159] / FRAC_SCALE ,
-			lut_src[8160] / FRAC_SCALE ,
-			lut_src[8161] / FRAC_SCALE ,
-			lut_src[8162] / FRAC_SCALE ,
-			lut_src[8163] / FRAC_SCALE ,
-			lut_src[8164] / FRAC_SCALE ,
-			lut_src[8165] / FRAC_SCALE ,
-			lut_src[8166] / FRAC_SCALE ,
-			lut_src[8167] / FRAC_SCALE ,
-			lut_src[8168] / FRAC_SCALE ,
-			lut_src[8169] / FRAC_SCALE ,
-			lut_src[8170] / FRAC_SCALE ,
-			lut_src[8171] / FRAC_SCALE ,
-			lut_src[8172] / FRAC_SCALE ,
-			lut_src[8173] / FRAC_SCALE ,
-			lut_src[8174] / FRAC_SCALE ,
-			lut_src[8175] / FRAC_SCALE ,
-			lut_src[8176] / FRAC_SCALE ,
-			lut_src[8177] / FRAC_SCALE ,
-			lut_src[8178] / FRAC_SCALE ,
-			lut_src[8179] / FRAC_SCALE ,
-			lut_src[8180] / FRAC_SCALE ,
-			lut_src[8181] / FRAC_SCALE ,
-			lut_src[8182] / FRAC_SCALE ,
-			lut_src[8183] / FRAC_SCALE ,
-			lut_src[8184] / FRAC_SCALE ,
-			lut_src[8185] / FRAC_SCALE ,
-			lut_src[8186] / FRAC_SCALE ,
-			lut_src[8187] / FRAC_SCALE ,
-			lut_src[8188] / FRAC_SCALE ,
-			lut_src[8189] / FRAC_SCALE ,
-			lut_src[8190] / FRAC_SCALE ,
-			lut_src[8191] / FRAC_SCALE ,
-			lut_src[8192] / FRAC_SCALE ,
-			lut_src[8193] / FRAC_SCALE ,
-			lut_src[8194] / FRAC_SCALE ,
-			lut_src[8195] / FRAC_SCALE ,
-			lut_src[8196] / FRAC_SCALE ,
-			lut_src[8197] / FRAC_SCALE ,
-			lut_src[8198] / FRAC_SCALE ,
-			lut_src[8199] / FRAC_SCALE ,
-			lut_src[8200] / FRAC_SCALE ,
-			lut_src[8201] / FRAC_SCALE ,
-			lut_src[8202] / FRAC_SCALE ,
-			lut_src[8203] / FRAC_SCALE ,
-			lut_src[8204] / FRAC_SCALE ,
-			lut_src[8205] / FRAC_SCALE ,
-			lut_src[8206] / FRAC_SCALE ,
-			lut_src[8207] / FRAC_SCALE ,
-			lut_src[8208] / FRAC_SCALE ,
-			lut_src[8209] / FRAC_SCALE ,
-			lut_src[8210] / FRAC_SCALE ,
-			lut_src[8211] / FRAC_SCALE ,
-			lut_src[8212] / FRAC_SCALE ,
-			lut_src[8213] / FRAC_SCALE ,
-			lut_src[8214] / FRAC_SCALE ,
-			lut_src[8215] / FRAC_SCALE ,
-			lut_src[8216] / FRAC_SCALE ,
-			lut_src[8217] / FRAC_SCALE ,
-			lut_src[8218] / FRAC_SCALE ,
-			lut_src[8219] / FRAC_SCALE ,
-			lut_src[8220] / FRAC_SCALE ,
-			lut_src[8221] / FRAC_SCALE ,
-			lut_src[8222] / FRAC_SCALE ,
-			lut_src[8223] / FRAC_SCALE ,
-			lut_src[8224] / FRAC_SCALE ,
-			lut_src[8225] / FRAC_SCALE ,
-			lut_src[8226] / FRAC_SCALE ,
-			lut_src[8227] / FRAC_SCALE ,
-			lut_src[8228] / FRAC_SCALE ,
-			lut_src[8229] / FRAC_SCALE ,
-			lut_src[8230] / FRAC_SCALE ,
-			lut_src[8231] / FRAC_SCALE ,
-			lut_src[8232] / FRAC_SCALE ,
-			lut_src[8233] / FRAC_SCALE ,
-			lut_src[8234] / FRAC_SCALE ,
-			lut_src[8235] / FRAC_SCALE ,
-			lut_src[8236] / FRAC_SCALE ,
-			lut_src[8237] / FRAC_SCALE ,
-			lut_src[8238] / FRAC_SCALE ,
-			lut_src[8239] / FRAC_SCALE ,
-			lut_src[8240] / FRAC_SCALE ,
-			lut_src[8241] / FRAC_SCALE ,
-			lut_src[8242] / FRAC_SCALE ,
-			lut_src[8243] / FRAC_SCALE ,
-			lut_src[8244] / FRAC_SCALE ,
-			lut_src[8245] / FRAC_SCALE ,
-			lut_src[8246] / FRAC_SCALE ,
-			lut_src[8247] / FRAC_SCALE ,
-			lut_src[8248] / FRAC_SCALE ,
-			lut_src[8249] / FRAC_SCALE ,
-			lut_src[8250] / FRAC_SCALE ,
-			lut_src[8251] / FRAC_SCALE ,
-			lut_src[8252] / FRAC_SCALE ,
-			lut_src[8253] / FRAC_SCALE ,
-			lut_src[8254] / FRAC_SCALE ,
-			lut_src[8255] / FRAC_SCALE ,
-			lut_src[8256] / FRAC_SCALE ,
-			lut_src[8257] / FRAC_SCALE ,
-			lut_src[8258] / FRAC_SCALE ,
-			lut_src[8259] / FRAC_SCALE ,
-			lut_src[8260] / FRAC_SCALE ,
-			lut_src[8261] / FRAC_SCALE ,
-			lut_src[8262] / FRAC_SCALE ,
-			lut_src[8263] / FRAC_SCALE ,
-			lut_src[8264] / FRAC_SCALE ,
-			lut_src[8265] / FRAC_SCALE ,
-			lut_src[8266] / FRAC_SCALE ,
-			lut_src[8267] / FRAC_SCALE ,
-			lut_src[8268] / FRAC_SCALE ,
-			lut_src[8269] / FRAC_SCALE ,
-			lut_src[8270] / FRAC_SCALE ,
-			lut_src[8271] / FRAC_SCALE ,
-			lut_src[8272] / FRAC_SCALE ,
-			lut_src[8273] / FRAC_SCALE ,
-			lut_src[8274] / FRAC_SCALE ,
-			lut_src[8275] / FRAC_SCALE ,
-			lut_src[8276] / FRAC_SCALE ,
-			lut_src[8277] / FRAC_SCALE ,
-			lut_src[8278] / FRAC_SCALE ,
-			lut_src[8279] / FRAC_SCALE ,
-			lut_src[8280] / FRAC_SCALE ,
-			lut_src[8281] / FRAC_SCALE ,
-			lut_src[8282] / FRAC_SCALE ,
-			lut_src[8283] / FRAC_SCALE ,
-			lut_src[8284] / FRAC_SCALE ,
-			lut_src[8285] / FRAC_SCALE ,
-			lut_src[8286] / FRAC_SCALE ,
-			lut_src[8287] / FRAC_SCALE ,
-			lut_src[8288] / FRAC_SCALE ,
-			lut_src[8289] / FRAC_SCALE ,
-			lut_src[8290] / FRAC_SCALE ,
-			lut_src[8291] / FRAC_SCALE ,
-			lut_src[8292] / FRAC_SCALE ,
-			lut_src[8293] / FRAC_SCALE ,
-			lut_src[8294] / FRAC_SCALE ,
-			lut_src[8295] / FRAC_SCALE ,
-			lut_src[8296] / FRAC_SCALE ,
-			lut_src[8297] / FRAC_SCALE ,
-			lut_src[8298] / FRAC_SCALE ,
-			lut_src[8299] / FRAC_SCALE ,
-			lut_src[8300] / FRAC_SCALE ,
-			lut_src[8301] / FRAC_SCALE ,
-			lut_src[8302] / FRAC_SCALE ,
-			lut_src[8303] / FRAC_SCALE ,
-			lut_src[8304] / FRAC_SCALE ,
-			lut_src[8305] / FRAC_SCALE ,
-			lut_src[8306] / FRAC_SCALE ,
-			lut_src[8307] / FRAC_SCALE ,
-			lut_src[8308] / FRAC_SCALE ,
-			lut_src[8309] / FRAC_SCALE ,
-			lut_src[8310] / FRAC_SCALE ,
-			lut_src[8311] / FRAC_SCALE ,
-			lut_src[8312] / FRAC_SCALE ,
-			lut_src[8313] / FRAC_SCALE ,
-			lut_src[8314] / FRAC_SCALE ,
-			lut_src[8315] / FRAC_SCALE ,
-			lut_src[8316] / FRAC_SCALE ,
-			lut_src[8317] / FRAC_SCALE ,
-			lut_src[8318] / FRAC_SCALE ,
-			lut_src[8319] / FRAC_SCALE ,
-			lut_src[8320] / FRAC_SCALE ,
-			lut_src[8321] / FRAC_SCALE ,
-			lut_src[8322] / FRAC_SCALE ,
-			lut_src[8323] / FRAC_SCALE ,
-			lut_src[8324] / FRAC_SCALE ,
-			lut_src[8325] / FRAC_SCALE ,
-			lut_src[8326] / FRAC_SCALE ,
-			lut_src[8327] / FRAC_SCALE ,
-			lut_src[8328] / FRAC_SCALE ,
-			lut_src[8329] / FRAC_SCALE ,
-			lut_src[8330] / FRAC_SCALE ,
-			lut_src[8331] / FRAC_SCALE ,
-			lut_src[8332] / FRAC_SCALE ,
-			lut_src[8333] / FRAC_SCALE ,
-			lut_src[8334] / FRAC_SCALE ,
-			lut_src[8335] / FRAC_SCALE ,
-			lut_src[8336] / FRAC_SCALE ,
-			lut_src[8337] / FRAC_SCALE ,
-			lut_src[8338] / FRAC_SCALE ,
-			lut_src[8339] / FRAC_SCALE ,
-			lut_src[8340] / FRAC_SCALE ,
-			lut_src[8341] / FRAC_SCALE ,
-			lut_src[8342] / FRAC_SCALE ,
-			lut_src[8343] / FRAC_SCALE ,
-			lut_src[8344] / FRAC_SCALE ,
-			lut_src[8345] / FRAC_SCALE ,
-			lut_src[8346] / FRAC_SCALE ,
-			lut_src[8347] / FRAC_SCALE ,
-			lut_src[8348] / FRAC_SCALE ,
-			lut_src[8349] / FRAC_SCALE ,
-			lut_src[8350] / FRAC_SCALE ,
-			lut_src[8351] / FRAC_SCALE ,
-			lut_src[8352] / FRAC_SCALE ,
-			lut_src[8353] / FRAC_SCALE ,
-			lut_src[8354] / FRAC_SCALE ,
-			lut_src[8355] / FRAC_SCALE ,
-			lut_src[8356] / FRAC_SCALE ,
-			lut_src[8357] / FRAC_SCALE ,
-			lut_src[8358] / FRAC_SCALE ,
-			lut_src[8359] / FRAC_SCALE ,
-			lut_src[8360] / FRAC_SCALE ,
-			lut_src[8361] / FRAC_SCALE ,
-			lut_src[8362] / FRAC_SCALE ,
-			lut_src[8363] / FRAC_SCALE ,
-			lut_src[8364] / FRAC_SCALE ,
-			lut_src[8365] / FRAC_SCALE ,
-			lut_src[8366] / FRAC_SCALE ,
-			lut_src[8367] / FRAC_SCALE ,
-			lut_src[8368] / FRAC_SCALE ,
-			lut_src[8369] / FRAC_SCALE ,
-			lut_src[8370] / FRAC_SCALE ,
-			lut_src[8371] / FRAC_SCALE ,
-			lut_src[8372] / FRAC_SCALE ,
-			lut_src[8373] / FRAC_SCALE ,
-			lut_src[8374] / FRAC_SCALE ,
-			lut_src[8375] / FRAC_SCALE ,
-			lut_src[8376] / FRAC_SCALE ,
-			lut_src[8377] / FRAC_SCALE ,
-			lut_src[8378] / FRAC_SCALE ,
-			lut_src[8379] / FRAC_SCALE ,
-			lut_src[8380] / FRAC_SCALE ,
-			lut_src[8381] / FRAC_SCALE ,
-			lut_src[8382] / FRAC_SCALE ,
-			lut_src[8383] / FRAC_SCALE ,
-			lut_src[8384] / FRAC_SCALE ,
-			lut_src[8385] / FRAC_SCALE ,
-			lut_src[8386] / FRAC_SCALE ,
-			lut_src[8387] / FRAC_SCALE ,
-			lut_src[8388] / FRAC_SCALE ,
-			lut_src[8389] / FRAC_SCALE ,
-			lut_src[8390] / FRAC_SCALE ,
-			lut_src[8391] / FRAC_SCALE ,
-			lut_src[8392] / FRAC_SCALE ,
-			lut_src[8393] / FRAC_SCALE ,
-			lut_src[8394] / FRAC_SCALE ,
-			lut_src[8395] / FRAC_SCALE ,
-			lut_src[8396] / FRAC_SCALE ,
-			lut_src[8397] / FRAC_SCALE ,
-			lut_src[8398] / FRAC_SCALE ,
-			lut_src[8399] / FRAC_SCALE ,
-			lut_src[8400] / FRAC_SCALE ,
-			lut_src[8401] / FRAC_SCALE ,
-			lut_src[8402] / FRAC_SCALE ,
-			lut_src[8403] / FRAC_SCALE ,
-			lut_src[8404] / FRAC_SCALE ,
-			lut_src[8405] / FRAC_SCALE ,
-			lut_src[8406] / FRAC_SCALE ,
-			lut_src[8407] / FRAC_SCALE ,
-			lut_src[8408] / FRAC_SCALE ,
-			lut_src[8409] / FRAC_SCALE ,
-			lut_src[8410] / FRAC_SCALE ,
-			lut_src[8411] / FRAC_SCALE ,
-			lut_src[8412] / FRAC_SCALE ,
-			lut_src[8413] / FRAC_SCALE ,
-			lut_src[8414] / FRAC_SCALE ,
-			lut_src[8415] / FRAC_SCALE ,
-			lut_src[8416] / FRAC_SCALE ,
-			lut_src[8417] / FRAC_SCALE ,
-			lut_src[8418] / FRAC_SCALE ,
-			lut_src[8419] / FRAC_SCALE ,
-			lut_src[8420] / FRAC_SCALE ,
-			lut_src[8421] / FRAC_SCALE ,
-			lut_src[8422] / FRAC_SCALE ,
-			lut_src[8423] / FRAC_SCALE ,
-			lut_src[8424] / FRAC_SCALE ,
-			lut_src[8425] / FRAC_SCALE ,
-			lut_src[8426] / FRAC_SCALE ,
-			lut_src[8427] / FRAC_SCALE ,
-			lut_src[8428] / FRAC_SCALE ,
-			lut_src[8429] / FRAC_SCALE ,
-			lut_src[8430] / FRAC_SCALE ,
-			lut_src[8431] / FRAC_SCALE ,
-			lut_src[8432] / FRAC_SCALE ,
-			lut_src[8433] / FRAC_SCALE ,
-			lut_src[8434] / FRAC_SCALE ,
-			lut_src[8435] / FRAC_SCALE ,
-			lut_src[8436] / FRAC_SCALE ,
-			lut_src[8437] / FRAC_SCALE ,
-			lut_src[8438] / FRAC_SCALE ,
-			lut_src[8439] / FRAC_SCALE ,
-			lut_src[8440] / FRAC_SCALE ,
-			lut_src[8441] / FRAC_SCALE ,
-			lut_src[8442] / FRAC_SCALE ,
-			lut_src[8443] / FRAC_SCALE ,
-			lut_src[8444] / FRAC_SCALE ,
-			lut_src[8445] / FRAC_SCALE ,
-			lut_src[8446] / FRAC_SCALE ,
-			lut_src[8447] / FRAC_SCALE ,
-			lut_src[8448] / FRAC_SCALE ,
-			lut_src[8449] / FRAC_SCALE ,
-			lut_src[8450] / FRAC_SCALE ,
-			lut_src[8451] / FRAC_SCALE ,
-			lut_src[8452] / FRAC_SCALE ,
-			lut_src[8453] / FRAC_SCALE ,
-			lut_src[8454] / FRAC_SCALE ,
-			lut_src[8455] / FRAC_SCALE ,
-			lut_src[8456] / FRAC_SCALE ,
-			lut_src[8457] / FRAC_SCALE ,
-			lut_src[8458] / FRAC_SCALE ,
-			lut_src[8459] / FRAC_SCALE ,
-			lut_src[8460] / FRAC_SCALE ,
-			lut_src[8461] / FRAC_SCALE ,
-			lut_src[8462] / FRAC_SCALE ,
-			lut_src[8463] / FRAC_SCALE ,
-			lut_src[8464] / FRAC_SCALE ,
-			lut_src[8465] / FRAC_SCALE ,
-			lut_src[8466] / FRAC_SCALE ,
-			lut_src[8467] / FRAC_SCALE ,
-			lut_src[8468] / FRAC_SCALE ,
-			lut_src[8469] / FRAC_SCALE ,
-			lut_src[8470] / FRAC_SCALE ,
-			lut_src[8471] / FRAC_SCALE ,
-			lut_src[8472] / FRAC_SCALE ,
-			lut_src[8473] / FRAC_SCALE ,
-			lut_src[8474] / FRAC_SCALE ,
-			lut_src[8475] / FRAC_SCALE ,
-			lut_src[8476] / FRAC_SCALE ,
-			lut_src[8477] / FRAC_SCALE ,
-			lut_src[8478] / FRAC_SCALE ,
-			lut_src[8479] / FRAC_SCALE ,
-			lut_src[8480] / FRAC_SCALE ,
-			lut_src[8481] / FRAC_SCALE ,
-			lut_src[8482] / FRAC_SCALE ,
-			lut_src[8483] / FRAC_SCALE ,
-			lut_src[8484] / FRAC_SCALE ,
-			lut_src[8485] / FRAC_SCALE ,
-			lut_src[8486] / FRAC_SCALE ,
-			lut_src[8487] / FRAC_SCALE ,
-			lut_src[8488] / FRAC_SCALE ,
-			lut_src[8489] / FRAC_SCALE ,
-			lut_src[8490] / FRAC_SCALE ,
-			lut_src[8491] / FRAC_SCALE ,
-			lut_src[8492] / FRAC_SCALE ,
-			lut_src[8493] / FRAC_SCALE ,
-			lut_src[8494] / FRAC_SCALE ,
-			lut_src[8495] / FRAC_SCALE ,
-			lut_src[8496] / FRAC_SCALE ,
-			lut_src[8497] / FRAC_SCALE ,
-			lut_src[8498] / FRAC_SCALE ,
-			lut_src[8499] / FRAC_SCALE ,
-			lut_src[8500] / FRAC_SCALE ,
-			lut_src[8501] / FRAC_SCALE ,
-			lut_src[8502] / FRAC_SCALE ,
-			lut_src[8503] / FRAC_SCALE ,
-			lut_src[8504] / FRAC_SCALE ,
-			lut_src[8505] / FRAC_SCALE ,
-			lut_src[8506] / FRAC_SCALE ,
-			lut_src[8507] / FRAC_SCALE ,
-			lut_src[8508] / FRAC_SCALE ,
-			lut_src[8509] / FRAC_SCALE ,
-			lut_src[8510] / FRAC_SCALE ,
-			lut_src[8511] / FRAC_SCALE ,
-			lut_src[8512] / FRAC_SCALE ,
-			lut_src[8513] / FRAC_SCALE ,
-			lut_src[8514] / FRAC_SCALE ,
-			lut_src[8515] / FRAC_SCALE ,
-			lut_src[8516] / FRAC_SCALE ,
-			lut_src[8517] / FRAC_SCALE ,
-			lut_src[8518] / FRAC_SCALE ,
-			lut_src[8519] / FRAC_SCALE ,
-			lut_src[8520] / FRAC_SCALE ,
-			lut_src[8521] / FRAC_SCALE ,
-			lut_src[8522] / FRAC_SCALE ,
-			lut_src[8523] / FRAC_SCALE ,
-			lut_src[8524] / FRAC_SCALE ,
-			lut_src[8525] / FRAC_SCALE ,
-			lut_src[8526] / FRAC_SCALE ,
-			lut_src[8527] / FRAC_SCALE ,
-			lut_src[8528] / FRAC_SCALE ,
-			lut_src[8529] / FRAC_SCALE ,
-			lut_src[8530] / FRAC_SCALE ,
-			lut_src[8531] / FRAC_SCALE ,
-			lut_src[8532] / FRAC_SCALE ,
-			lut_src[8533] / FRAC_SCALE ,
-			lut_src[8534] / FRAC_SCALE ,
-			lut_src[8535] / FRAC_SCALE ,
-			lut_src[8536] / FRAC_SCALE ,
-			lut_src[8537] / FRAC_SCALE ,
-			lut_src[8538] / FRAC_SCALE ,
-			lut_src[8539] / FRAC_SCALE ,
-			lut_src[8540] / FRAC_SCALE ,
-			lut_src[8541] / FRAC_SCALE ,
-			lut_src[8542] / FRAC_SCALE ,
-			lut_src[8543] / FRAC_SCALE ,
-			lut_src[8544] / FRAC_SCALE ,
-			lut_src[8545] / FRAC_SCALE ,
-			lut_src[8546] / FRAC_SCALE ,
-			lut_src[8547] / FRAC_SCALE ,
-			lut_src[8548] / FRAC_SCALE ,
-			lut_src[8549] / FRAC_SCALE ,
-			lut_src[8550] / FRAC_SCALE ,
-			lut_src[8551] / FRAC_SCALE ,
-			lut_src[8552] / FRAC_SCALE ,
-			lut_src[8553] / FRAC_SCALE ,
-			lut_src[8554] / FRAC_SCALE ,
-			lut_src[8555] / FRAC_SCALE ,
-			lut_src[8556] / FRAC_SCALE ,
-			lut_src[8557] / FRAC_SCALE ,
-			lut_src[8558] / FRAC_SCALE ,
-			lut_src[8559] / FRAC_SCALE ,
-			lut_src[8560] / FRAC_SCALE ,
-			lut_src[8561] / FRAC_SCALE ,
-			lut_src[8562] / FRAC_SCALE ,
-			lut_src[8563] / FRAC_SCALE ,
-			lut_src[8564] / FRAC_SCALE ,
-			lut_src[8565] / FRAC_SCALE ,
-			lut_src[8566] / FRAC_SCALE ,
-			lut_src[8567] / FRAC_SCALE ,
-			lut_src[8568] / FRAC_SCALE ,
-			lut_src[8569] / FRAC_SCALE ,
-			lut_src[8570] / FRAC_SCALE ,
-			lut_src[8571] / FRAC_SCALE ,
-			lut_src[8572] / FRAC_SCALE ,
-			lut_src[8573] / FRAC_SCALE ,
-			lut_src[8574] / FRAC_SCALE ,
-			lut_src[8575] / FRAC_SCALE ,
-			lut_src[8576] / FRAC_SCALE ,
-			lut_src[8577] / FRAC_SCALE ,
-			lut_src[8578] / FRAC_SCALE ,
-			lut_src[8579] / FRAC_SCALE ,
-			lut_src[8580] / FRAC_SCALE ,
-			lut_src[8581] / FRAC_SCALE ,
-			lut_src[8582] / FRAC_SCALE ,
-			lut_src[8583] / FRAC_SCALE ,
-			lut_src[8584] / FRAC_SCALE ,
-			lut_src[8585] / FRAC_SCALE ,
-			lut_src[8586] / FRAC_SCALE ,
-			lut_src[8587] / FRAC_SCALE ,
-			lut_src[8588] / FRAC_SCALE ,
-			lut_src[8589] / FRAC_SCALE ,
-			lut_src[8590] / FRAC_SCALE ,
-			lut_src[8591] / FRAC_SCALE ,
-			lut_src[8592] / FRAC_SCALE ,
-			lut_src[8593] / FRAC_SCALE ,
-			lut_src[8594] / FRAC_SCALE ,
-			lut_src[8595] / FRAC_SCALE ,
-			lut_src[8596] / FRAC_SCALE ,
-			lut_src[8597] / FRAC_SCALE ,
-			lut_src[8598] / FRAC_SCALE ,
-			lut_src[8599] / FRAC_SCALE ,
-			lut_src[8600] / FRAC_SCALE ,
-			lut_src[8601] / FRAC_SCALE ,
-			lut_src[8602] / FRAC_SCALE ,
-			lut_src[8603] / FRAC_SCALE ,
-			lut_src[8604] / FRAC_SCALE ,
-			lut_src[8605] / FRAC_SCALE ,
-			lut_src[8606] / FRAC_SCALE ,
-			lut_src[8607] / FRAC_SCALE ,
-			lut_src[8608] / FRAC_SCALE ,
-			lut_src[8609] / FRAC_SCALE ,
-			lut_src[8610] / FRAC_SCALE ,
-			lut_src[8611] / FRAC_SCALE ,
-			lut_src[8612] / FRAC_SCALE ,
-			lut_src[8613] / FRAC_SCALE ,
-			lut_src[8614] / FRAC_SCALE ,
-			lut_src[8615] / FRAC_SCALE ,
-			lut_src[8616] / FRAC_SCALE ,
-			lut_src[8617] / FRAC_SCALE ,
-			lut_src[8618] / FRAC_SCALE ,
-			lut_src[8619] / FRAC_SCALE ,
-			lut_src[8620] / FRAC_SCALE ,
-			lut_src[8621] / FRAC_SCALE ,
-			lut_src[8622] / FRAC_SCALE ,
-			lut_src[8623] / FRAC_SCALE ,
-			lut_src[8624] / FRAC_SCALE ,
-			lut_src[8625] / FRAC_SCALE ,
-			lut_src[8626] / FRAC_SCALE ,
-			lut_src[8627] / FRAC_SCALE ,
-			lut_src[8628] / FRAC_SCALE ,
-			lut_src[8629] / FRAC_SCALE ,
-			lut_src[8630] / FRAC_SCALE ,
-			lut_src[8631] / FRAC_SCALE ,
-			lut_src[8632] / FRAC_SCALE ,
-			lut_src[8633] / FRAC_SCALE ,
-			lut_src[8634] / FRAC_SCALE ,
-			lut_src[8635] / FRAC_SCALE ,
-			lut_src[8636] / FRAC_SCALE ,
-			lut_src[8637] / FRAC_SCALE ,
-			lut_src[8638] / FRAC_SCALE ,
-			lut_src[8639] / FRAC_SCALE ,
-			lut_src[8640] / FRAC_SCALE ,
-			lut_src[8641] / FRAC_SCALE ,
-			lut_src[8642] / FRAC_SCALE ,
-			lut_src[8643] / FRAC_SCALE ,
-			lut_src[8644] / FRAC_SCALE ,
-			lut_src[8645] / FRAC_SCALE ,
-			lut_src[8646] / FRAC_SCALE ,
-			lut_src[8647] / FRAC_SCALE ,
-			lut_src[8648] / FRAC_SCALE ,
-			lut_src[8649] / FRAC_SCALE ,
-			lut_src[8650] / FRAC_SCALE ,
-			lut_src[8651] / FRAC_SCALE ,
-			lut_src[8652] / FRAC_SCALE ,
-			lut_src[8653] / FRAC_SCALE ,
-			lut_src[8654] / FRAC_SCALE ,
-			lut_src[8655] / FRAC_SCALE ,
-			lut_src[8656] / FRAC_SCALE ,
-			lut_src[8657] / FRAC_SCALE ,
-			lut_src[8658] / FRAC_SCALE ,
-			lut_src[8659] / FRAC_SCALE ,
-			lut_src[8660] / FRAC_SCALE ,
-			lut_src[8661] / FRAC_SCALE ,
-			lut_src[8662] / FRAC_SCALE ,
-			lut_src[8663] / FRAC_SCALE ,
-			lut_src[8664] / FRAC_SCALE ,
-			lut_src[8665] / FRAC_SCALE ,
-			lut_src[8666] / FRAC_SCALE ,
-			lut_src[8667] / FRAC_SCALE ,
-			lut_src[8668] / FRAC_SCALE ,
-			lut_src[8669] / FRAC_SCALE ,
-			lut_src[8670] / FRAC_SCALE ,
-			lut_src[8671] / FRAC_SCALE ,
-			lut_src[8672] / FRAC_SCALE ,
-			lut_src[8673] / FRAC_SCALE ,
-			lut_src[8674] / FRAC_SCALE ,
-			lut_src[8675] / FRAC_SCALE ,
-			lut_src[8676] / FRAC_SCALE ,
-			lut_src[8677] / FRAC_SCALE ,
-			lut_src[8678] / FRAC_SCALE ,
-			lut_src[8679] / FRAC_SCALE ,
-			lut_src[8680] / FRAC_SCALE ,
-			lut_src[8681] / FRAC_SCALE ,
-			lut_src[8682] / FRAC_SCALE ,
-			lut_src[8683] / FRAC_SCALE ,
-			lut_src[8684] / FRAC_SCALE ,
-			lut_src[8685] / FRAC_SCALE ,
-			lut_src[8686] / FRAC_SCALE ,
-			lut_src[8687] / FRAC_SCALE ,
-			lut_src[8688] / FRAC_SCALE ,
-			lut_src[8689] / FRAC_SCALE ,
-			lut_src[8690] / FRAC_SCALE ,
-			lut_src[8691] / FRAC_SCALE ,
-			lut_src[8692] / FRAC_SCALE ,
-			lut_src[8693] / FRAC_SCALE ,
-			lut_src[8694] / FRAC_SCALE ,
-			lut_src[8695] / FRAC_SCALE ,
-			lut_src[8696] / FRAC_SCALE ,
-			lut_src[8697] / FRAC_SCALE ,
-			lut_src[8698] / FRAC_SCALE ,
-			lut_src[8699] / FRAC_SCALE ,
-			lut_src[8700] / FRAC_SCALE ,
-			lut_src[8701] / FRAC_SCALE ,
-			lut_src[8702] / FRAC_SCALE ,
-			lut_src[8703] / FRAC_SCALE ,
-			lut_src[8704] / FRAC_SCALE ,
-			lut_src[8705] / FRAC_SCALE ,
-			lut_src[8706] / FRAC_SCALE ,
-			lut_src[8707] / FRAC_SCALE ,
-			lut_src[8708] / FRAC_SCALE ,
-			lut_src[8709] / FRAC_SCALE ,
-			lut_src[8710] / FRAC_SCALE ,
-			lut_src[8711] / FRAC_SCALE ,
-			lut_src[8712] / FRAC_SCALE ,
-			lut_src[8713] / FRAC_SCALE ,
-			lut_src[8714] / FRAC_SCALE ,
-			lut_src[8715] / FRAC_SCALE ,
-			lut_src[8716] / FRAC_SCALE ,
-			lut_src[8717] / FRAC_SCALE ,
-			lut_src[8718] / FRAC_SCALE ,
-			lut_src[8719] / FRAC_SCALE ,
-			lut_src[8720] / FRAC_SCALE ,
-			lut_src[8721] / FRAC_SCALE ,
-			lut_src[8722] / FRAC_SCALE ,
-			lut_src[8723] / FRAC_SCALE ,
-			lut_src[8724] / FRAC_SCALE ,
-			lut_src[8725] / FRAC_SCALE ,
-			lut_src[8726] / FRAC_SCALE ,
-			lut_src[8727] / FRAC_SCALE ,
-			lut_src[8728] / FRAC_SCALE ,
-			lut_src[8729] / FRAC_SCALE ,
-			lut_src[8730] / FRAC_SCALE ,
-			lut_src[8731] / FRAC_SCALE ,
-			lut_src[8732] / FRAC_SCALE ,
-			lut_src[8733] / FRAC_SCALE ,
-			lut_src[8734] / FRAC_SCALE ,
-			lut_src[8735] / FRAC_SCALE ,
-			lut_src[8736] / FRAC_SCALE ,
-			lut_src[8737] / FRAC_SCALE ,
-			lut_src[8738] / FRAC_SCALE ,
-			lut_src[8739] / FRAC_SCALE ,
-			lut_src[8740] / FRAC_SCALE ,
-			lut_src[8741] / FRAC_SCALE ,
-			lut_src[8742] / FRAC_SCALE ,
-			lut_src[8743] / FRAC_SCALE ,
-			lut_src[8744] / FRAC_SCALE ,
-			lut_src[8745] / FRAC_SCALE ,
-			lut_src[8746] / FRAC_SCALE ,
-			lut_src[8747] / FRAC_SCALE ,
-			lut_src[8748] / FRAC_SCALE ,
-			lut_src[8749] / FRAC_SCALE ,
-			lut_src[8750] / FRAC_SCALE ,
-			lut_src[8751] / FRAC_SCALE ,
-			lut_src[8752] / FRAC_SCALE ,
-			lut_src[8753] / FRAC_SCALE ,
-			lut_src[8754] / FRAC_SCALE ,
-			lut_src[8755] / FRAC_SCALE ,
-			lut_src[8756] / FRAC_SCALE ,
-			lut_src[8757] / FRAC_SCALE ,
-			lut_src[8758] / FRAC_SCALE ,
-			lut_src[8759] / FRAC_SCALE ,
-			lut_src[8760] / FRAC_SCALE ,
-			lut_src[8761] / FRAC_SCALE ,
-			lut_src[8762] / FRAC_SCALE ,
-			lut_src[8763] / FRAC_SCALE ,
-			lut_src[8764] / FRAC_SCALE ,
-			lut_src[8765] / FRAC_SCALE ,
-			lut_src[8766] / FRAC_SCALE ,
-			lut_src[8767] / FRAC_SCALE ,
-			lut_src[8768] / FRAC_SCALE ,
-			lut_src[8769] / FRAC_SCALE ,
-			lut_src[8770] / FRAC_SCALE ,
-			lut_src[8771] / FRAC_SCALE ,
-			lut_src[8772] / FRAC_SCALE ,
-			lut_src[8773] / FRAC_SCALE ,
-			lut_src[8774] / FRAC_SCALE ,
-			lut_src[8775] / FRAC_SCALE ,
-			lut_src[8776] / FRAC_SCALE ,
-			lut_src[8777] / FRAC_SCALE ,
-			lut_src[8778] / FRAC_SCALE ,
-			lut_src[8779] / FRAC_SCALE ,
-			lut_src[8780] / FRAC_SCALE ,
-			lut_src[8781] / FRAC_SCALE ,
-			lut_src[8782] / FRAC_SCALE ,
-			lut_src[8783] / FRAC_SCALE ,
-			lut_src[8784] / FRAC_SCALE ,
-			lut_src[8785] / FRAC_SCALE ,
-			lut_src[8786] / FRAC_SCALE ,
-			lut_src[8787] / FRAC_SCALE ,
-			lut_src[8788] / FRAC_SCALE ,
-			lut_src[8789] / FRAC_SCALE ,
-			lut_src[8790] / FRAC_SCALE ,
-			lut_src[8791] / FRAC_SCALE ,
-			lut_src[8792] / FRAC_SCALE ,
-			lut_src[8793] / FRAC_SCALE ,
-			lut_src[8794] / FRAC_SCALE ,
-			lut_src[8795] / FRAC_SCALE ,
-			lut_src[8796] / FRAC_SCALE ,
-			lut_src[8797] / FRAC_SCALE ,
-			lut_src[8798] / FRAC_SCALE ,
-			lut_src[8799] / FRAC_SCALE ,
-			lut_src[8800] / FRAC_SCALE ,
-			lut_src[8801] / FRAC_SCALE ,
-			lut_src[8802] / FRAC_SCALE ,
-			lut_src[8803] / FRAC_SCALE ,
-			lut_src[8804] / FRAC_SCALE ,
-			lut_src[8805] / FRAC_SCALE ,
-			lut_src[8806] / FRAC_SCALE ,
-			lut_src[8807] / FRAC_SCALE ,
-			lut_src[8808] / FRAC_SCALE ,
-			lut_src[8809] / FRAC_SCALE ,
-			lut_src[8810] / FRAC_SCALE ,
-			lut_src[8811] / FRAC_SCALE ,
-			lut_src[8812] / FRAC_SCALE ,
-			lut_src[8813] / FRAC_SCALE ,
-			lut_src[8814] / FRAC_SCALE ,
-			lut_src[8815] / FRAC_SCALE ,
-			lut_src[8816] / FRAC_SCALE ,
-			lut_src[8817] / FRAC_SCALE ,
-			lut_src[8818] / FRAC_SCALE ,
-			lut_src[8819] / FRAC_SCALE ,
-			lut_src[8820] / FRAC_SCALE ,
-			lut_src[8821] / FRAC_SCALE ,
-			lut_src[8822] / FRAC_SCALE ,
-			lut_src[8823] / FRAC_SCALE ,
-			lut_src[8824] / FRAC_SCALE ,
-			lut_src[8825] / FRAC_SCALE ,
-			lut_src[8826] / FRAC_SCALE ,
-			lut_src[8827] / FRAC_SCALE ,
-			lut_src[8828] / FRAC_SCALE ,
-			lut_src[8829] / FRAC_SCALE ,
-			lut_src[8830] / FRAC_SCALE ,
-			lut_src[8831] / FRAC_SCALE ,
-			lut_src[8832] / FRAC_SCALE ,
-			lut_src[8833] / FRAC_SCALE ,
-			lut_src[8834] / FRAC_SCALE ,
-			lut_src[8835] / FRAC_SCALE ,
-			lut_src[8836] / FRAC_SCALE ,
-			lut_src[8837] / FRAC_SCALE ,
-			lut_src[8838] / FRAC_SCALE ,
-			lut_src[8839] / FRAC_SCALE ,
-			lut_src[8840] / FRAC_SCALE ,
-			lut_src[8841] / FRAC_SCALE ,
-			lut_src[8842] / FRAC_SCALE ,
-			lut_src[8843] / FRAC_SCALE ,
-			lut_src[8844] / FRAC_SCALE ,
-			lut_src[8845] / FRAC_SCALE ,
-			lut_src[8846] / FRAC_SCALE ,
-			lut_src[8847] / FRAC_SCALE ,
-			lut_src[8848] / FRAC_SCALE ,
-			lut_src[8849] / FRAC_SCALE ,
-			lut_src[8850] / FRAC_SCALE ,
-			lut_src[8851] / FRAC_SCALE ,
-			lut_src[8852] / FRAC_SCALE ,
-			lut_src[8853] / FRAC_SCALE ,
-			lut_src[8854] / FRAC_SCALE ,
-			lut_src[8855] / FRAC_SCALE ,
-			lut_src[8856] / FRAC_SCALE ,
-			lut_src[8857] / FRAC_SCALE ,
-			lut_src[8858] / FRAC_SCALE ,
-			lut_src[8859] / FRAC_SCALE ,
-			lut_src[8860] / FRAC_SCALE ,
-			lut_src[8861] / FRAC_SCALE ,
-			lut_src[8862] / FRAC_SCALE ,
-			lut_src[8863] / FRAC_SCALE ,
-			lut_src[8864] / FRAC_SCALE ,
-			lut_src[8865] / FRAC_SCALE ,
-			lut_src[8866] / FRAC_SCALE ,
-			lut_src[8867] / FRAC_SCALE ,
-			lut_src[8868] / FRAC_SCALE ,
-			lut_src[8869] / FRAC_SCALE ,
-			lut_src[8870] / FRAC_SCALE ,
-			lut_src[8871] / FRAC_SCALE ,
-			lut_src[8872] / FRAC_SCALE ,
-			lut_src[8873] / FRAC_SCALE ,
-			lut_src[8874] / FRAC_SCALE ,
-			lut_src[8875] / FRAC_SCALE ,
-			lut_src[8876] / FRAC_SCALE ,
-			lut_src[8877] / FRAC_SCALE ,
-			lut_src[8878] / FRAC_SCALE ,
-			lut_src[8879] / FRAC_SCALE ,
-			lut_src[8880] / FRAC_SCALE ,
-			lut_src[8881] / FRAC_SCALE ,
-			lut_src[8882] / FRAC_SCALE ,
-			lut_src[8883] / FRAC_SCALE ,
-			lut_src[8884] / FRAC_SCALE ,
-			lut_src[8885] / FRAC_SCALE ,
-			lut_src[8886] / FRAC_SCALE ,
-			lut_src[8887] / FRAC_SCALE ,
-			lut_src[8888] / FRAC_SCALE ,
-			lut_src[8889] / FRAC_SCALE ,
-			lut_src[8890] / FRAC_SCALE ,
-			lut_src[8891] / FRAC_SCALE ,
-			lut_src[8892] / FRAC_SCALE ,
-			lut_src[8893] / FRAC_SCALE ,
-			lut_src[8894] / FRAC_SCALE ,
-			lut_src[8895] / FRAC_SCALE ,
-			lut_src[8896] / FRAC_SCALE ,
-			lut_src[8897] / FRAC_SCALE ,
-			lut_src[8898] / FRAC_SCALE ,
-			lut_src[8899] / FRAC_SCALE ,
-			lut_src[8900] / FRAC_SCALE ,
-			lut_src[8901] / FRAC_SCALE ,
-			lut_src[8902] / FRAC_SCALE ,
-			lut_src[8903] / FRAC_SCALE ,
-			lut_src[8904] / FRAC_SCALE ,
-			lut_src[8905] / FRAC_SCALE ,
-			lut_src[8906] / FRAC_SCALE ,
-			lut_src[8907] / FRAC_SCALE ,
-			lut_src[8908] / FRAC_SCALE ,
-			lut_src[8909] / FRAC_SCALE ,
-			lut_src[8910] / FRAC_SCALE ,
-			lut_src[8911] / FRAC_SCALE ,
-			lut_src[8912] / FRAC_SCALE ,
-			lut_src[8913] / FRAC_SCALE ,
-			lut_src[8914] / FRAC_SCALE ,
-			lut_src[8915] / FRAC_SCALE ,
-			lut_src[8916] / FRAC_SCALE ,
-			lut_src[8917] / FRAC_SCALE ,
-			lut_src[8918] / FRAC_SCALE ,
-			lut_src[8919] / FRAC_SCALE ,
-			lut_src[8920] / FRAC_SCALE ,
-			lut_src[8921] / FRAC_SCALE ,
-			lut_src[8922] / FRAC_SCALE ,
-			lut_src[8923] / FRAC_SCALE ,
-			lut_src[8924] / FRAC_SCALE ,
-			lut_src[8925] / FRAC_SCALE ,
-			lut_src[8926] / FRAC_SCALE ,
-			lut_src[8927] / FRAC_SCALE ,
-			lut_src[8928] / FRAC_SCALE ,
-			lut_src[8929] / FRAC_SCALE ,
-			lut_src[8930] / FRAC_SCALE ,
-			lut_src[8931] / FRAC_SCALE ,
-			lut_src[8932] / FRAC_SCALE ,
-			lut_src[8933] / FRAC_SCALE ,
-			lut_src[8934] / FRAC_SCALE ,
-			lut_src[8935] / FRAC_SCALE ,
-			lut_src[8936] / FRAC_SCALE ,
-			lut_src[8937] / FRAC_SCALE ,
-			lut_src[8938] / FRAC_SCALE ,
-			lut_src[8939] / FRAC_SCALE ,
-			lut_src[8940] / FRAC_SCALE ,
-			lut_src[8941] / FRAC_SCALE ,
-			lut_src[8942] / FRAC_SCALE ,
-			lut_src[8943] / FRAC_SCALE ,
-			lut_src[8944] / FRAC_SCALE ,
-			lut_src[8945] / FRAC_SCALE ,
-			lut_src[8946] / FRAC_SCALE ,
-			lut_src[8947] / FRAC_SCALE ,
-			lut_src[8948] / FRAC_SCALE ,
-			lut_src[8949] / FRAC_SCALE ,
-			lut_src[8950] / FRAC_SCALE ,
-			lut_src[8951] / FRAC_SCALE ,
-			lut_src[8952] / FRAC_SCALE ,
-			lut_src[8953] / FRAC_SCALE ,
-			lut_src[8954] / FRAC_SCALE ,
-			lut_src[8955] / FRAC_SCALE ,
-			lut_src[8956] / FRAC_SCALE ,
-			lut_src[8957] / FRAC_SCALE ,
-			lut_src[8958] / FRAC_SCALE ,
-			lut_src[8959] / FRAC_SCALE ,
-			lut_src[8960] / FRAC_SCALE ,
-			lut_src[8961] / FRAC_SCALE ,
-			lut_src[8962] / FRAC_SCALE ,
-			lut_src[8963] / FRAC_SCALE ,
-			lut_src[8964] / FRAC_SCALE ,
-			lut_src[8965] / FRAC_SCALE ,
-			lut_src[8966] / FRAC_SCALE ,
-			lut_src[8967] / FRAC_SCALE ,
-			lut_src[8968] / FRAC_SCALE ,
-			lut_src[8969] / FRAC_SCALE ,
-			lut_src[8970] / FRAC_SCALE ,
-			lut_src[8971] / FRAC_SCALE ,
-			lut_src[8972] / FRAC_SCALE ,
-			lut_src[8973] / FRAC_SCALE ,
-			lut_src[8974] / FRAC_SCALE ,
-			lut_src[8975] / FRAC_SCALE ,
-			lut_src[8976] / FRAC_SCALE ,
-			lut_src[8977] / FRAC_SCALE ,
-			lut_src[8978] / FRAC_SCALE ,
-			lut_src[8979] / FRAC_SCALE ,
-			lut_src[8980] / FRAC_SCALE ,
-			lut_src[8981] / FRAC_SCALE ,
-			lut_src[8982] / FRAC_SCALE ,
-			lut_src[8983] / FRAC_SCALE ,
-			lut_src[8984] / FRAC_SCALE ,
-			lut_src[8985] / FRAC_SCALE ,
-			lut_src[8986] / FRAC_SCALE ,
-			lut_src[8987] / FRAC_SCALE ,
-			lut_src[8988] / FRAC_SCALE ,
-			lut_src[8989] / FRAC_SCALE ,
-			lut_src[8990] / FRAC_SCALE ,
-			lut_src[8991] / FRAC_SCALE ,
-			lut_src[8992] / FRAC_SCALE ,
-			lut_src[8993] / FRAC_SCALE ,
-			lut_src[8994] / FRAC_SCALE ,
-			lut_src[8995] / FRAC_SCALE ,
-			lut_src[8996] / FRAC_SCALE ,
-			lut_src[8997] / FRAC_SCALE ,
-			lut_src[8998] / FRAC_SCALE ,
-			lut_src[8999] / FRAC_SCALE ,
-			lut_src[9000] / FRAC_SCALE ,
-			lut_src[9001] / FRAC_SCALE ,
-			lut_src[9002] / FRAC_SCALE ,
-			lut_src[9003] / FRAC_SCALE ,
-			lut_src[9004] / FRAC_SCALE ,
-			lut_src[9005] / FRAC_SCALE ,
-			lut_src[9006] / FRAC_SCALE ,
-			lut_src[9007] / FRAC_SCALE ,
-			lut_src[9008] / FRAC_SCALE ,
-			lut_src[9009] / FRAC_SCALE ,
-			lut_src[9010] / FRAC_SCALE ,
-			lut_src[9011] / FRAC_SCALE ,
-			lut_src[9012] / FRAC_SCALE ,
-			lut_src[9013] / FRAC_SCALE ,
-			lut_src[9014] / FRAC_SCALE ,
-			lut_src[9015] / FRAC_SCALE ,
-			lut_src[9016] / FRAC_SCALE ,
-			lut_src[9017] / FRAC_SCALE ,
-			lut_src[9018] / FRAC_SCALE ,
-			lut_src[9019] / FRAC_SCALE ,
-			lut_src[9020] / FRAC_SCALE ,
-			lut_src[9021] / FRAC_SCALE ,
-			lut_src[9022] / FRAC_SCALE ,
-			lut_src[9023] / FRAC_SCALE ,
-			lut_src[9024] / FRAC_SCALE ,
-			lut_src[9025] / FRAC_SCALE ,
-			lut_src[9026] / FRAC_SCALE ,
-			lut_src[9027] / FRAC_SCALE ,
-			lut_src[9028] / FRAC_SCALE ,
-			lut_src[9029] / FRAC_SCALE ,
-			lut_src[9030] / FRAC_SCALE ,
-			lut_src[9031] / FRAC_SCALE ,
-			lut_src[9032] / FRAC_SCALE ,
-			lut_src[9033] / FRAC_SCALE ,
-			lut_src[9034] / FRAC_SCALE ,
-			lut_src[9035] / FRAC_SCALE ,
-			lut_src[9036] / FRAC_SCALE ,
-			lut_src[9037] / FRAC_SCALE ,
-			lut_src[9038] / FRAC_SCALE ,
-			lut_src[9039] / FRAC_SCALE ,
-			lut_src[9040] / FRAC_SCALE ,
-			lut_src[9041] / FRAC_SCALE ,
-			lut_src[9042] / FRAC_SCALE ,
-			lut_src[9043] / FRAC_SCALE ,
-			lut_src[9044] / FRAC_SCALE ,
-			lut_src[9045] / FRAC_SCALE ,
-			lut_src[9046] / FRAC_SCALE ,
-			lut_src[9047] / FRAC_SCALE ,
-			lut_src[9048] / FRAC_SCALE ,
-			lut_src[9049] / FRAC_SCALE ,
-			lut_src[9050] / FRAC_SCALE ,
-			lut_src[9051] / FRAC_SCALE ,
-			lut_src[9052] / FRAC_SCALE ,
-			lut_src[9053] / FRAC_SCALE ,
-			lut_src[9054] / FRAC_SCALE ,
-			lut_src[9055] / FRAC_SCALE ,
-			lut_src[9056] / FRAC_SCALE ,
-			lut_src[9057] / FRAC_SCALE ,
-			lut_src[9058] / FRAC_SCALE ,
-			lut_src[9059] / FRAC_SCALE ,
-			lut_src[9060] / FRAC_SCALE ,
-			lut_src[9061] / FRAC_SCALE ,
-			lut_src[9062] / FRAC_SCALE ,
-			lut_src[9063] / FRAC_SCALE ,
-			lut_src[9064] / FRAC_SCALE ,
-			lut_src[9065] / FRAC_SCALE ,
-			lut_src[9066] / FRAC_SCALE ,
-			lut_src[9067] / FRAC_SCALE ,
-			lut_src[9068] / FRAC_SCALE ,
-			lut_src[9069] / FRAC_SCALE ,
-			lut_src[9070] / FRAC_SCALE ,
-			lut_src[9071] / FRAC_SCALE ,
-			lut_src[9072] / FRAC_SCALE ,
-			lut_src[9073] / FRAC_SCALE ,
-			lut_src[9074] / FRAC_SCALE ,
-			lut_src[9075] / FRAC_SCALE ,
-			lut_src[9076] / FRAC_SCALE ,
-			lut_src[9077] / FRAC_SCALE ,
-			lut_src[9078] / FRAC_SCALE ,
-			lut_src[9079] / FRAC_SCALE ,
-			lut_src[9080] / FRAC_SCALE ,
-			lut_src[9081] / FRAC_SCALE ,
-			lut_src[9082] / FRAC_SCALE ,
-			lut_src[9083] / FRAC_SCALE ,
-			lut_src[9084] / FRAC_SCALE ,
-			lut_src[9085] / FRAC_SCALE ,
-			lut_src[9086] / FRAC_SCALE ,
-			lut_src[9087] / FRAC_SCALE ,
-			lut_src[9088] / FRAC_SCALE ,
-			lut_src[9089] / FRAC_SCALE ,
-			lut_src[9090] / FRAC_SCALE ,
-			lut_src[9091] / FRAC_SCALE ,
-			lut_src[9092] / FRAC_SCALE ,
-			lut_src[9093] / FRAC_SCALE ,
-			lut_src[9094] / FRAC_SCALE ,
-			lut_src[9095] / FRAC_SCALE ,
-			lut_src[9096] / FRAC_SCALE ,
-			lut_src[9097] / FRAC_SCALE ,
-			lut_src[9098] / FRAC_SCALE ,
-			lut_src[9099] / FRAC_SCALE ,
-			lut_src[9100] / FRAC_SCALE ,
-			lut_src[9101] / FRAC_SCALE ,
-			lut_src[9102] / FRAC_SCALE ,
-			lut_src[9103] / FRAC_SCALE ,
-			lut_src[9104] / FRAC_SCALE ,
-			lut_src[9105] / FRAC_SCALE ,
-			lut_src[9106] / FRAC_SCALE ,
-			lut_src[9107] / FRAC_SCALE ,
-			lut_src[9108] / FRAC_SCALE ,
-			lut_src[9109] / FRAC_SCALE ,
-			lut_src[9110] / FRAC_SCALE ,
-			lut_src[9111] / FRAC_SCALE ,
-			lut_src[9112] / FRAC_SCALE ,
-			lut_src[9113] / FRAC_SCALE ,
-			lut_src[9114] / FRAC_SCALE ,
-			lut_src[9115] / FRAC_SCALE ,
-			lut_src[9116] / FRAC_SCALE ,
-			lut_src[9117] / FRAC_SCALE ,
-			lut_src[9118] / FRAC_SCALE ,
-			lut_src[9119] / FRAC_SCALE ,
-			lut_src[9120] / FRAC_SCALE ,
-			lut_src[9121] / FRAC_SCALE ,
-			lut_src[9122] / FRAC_SCALE ,
-			lut_src[9123] / FRAC_SCALE ,
-			lut_src[9124] / FRAC_SCALE ,
-			lut_src[9125] / FRAC_SCALE ,
-			lut_src[9126] / FRAC_SCALE ,
-			lut_src[9127] / FRAC_SCALE ,
-			lut_src[9128] / FRAC_SCALE ,
-			lut_src[9129] / FRAC_SCALE ,
-			lut_src[9130] / FRAC_SCALE ,
-			lut_src[9131] / FRAC_SCALE ,
-			lut_src[9132] / FRAC_SCALE ,
-			lut_src[9133] / FRAC_SCALE ,
-			lut_src[9134] / FRAC_SCALE ,
-			lut_src[9135] / FRAC_SCALE ,
-			lut_src[9136] / FRAC_SCALE ,
-			lut_src[9137] / FRAC_SCALE ,
-			lut_src[9138] / FRAC_SCALE ,
-			lut_src[9139] / FRAC_SCALE ,
-			lut_src[9140] / FRAC_SCALE ,
-			lut_src[9141] / FRAC_SCALE ,
-			lut_src[9142] / FRAC_SCALE ,
-			lut_src[9143] / FRAC_SCALE ,
-			lut_src[9144] / FRAC_SCALE ,
-			lut_src[9145] / FRAC_SCALE ,
-			lut_src[9146] / FRAC_SCALE ,
-			lut_src[9147] / FRAC_SCALE ,
-			lut_src[9148] / FRAC_SCALE ,
-			lut_src[9149] / FRAC_SCALE ,
-			lut_src[9150] / FRAC_SCALE ,
-			lut_src[9151] / FRAC_SCALE ,
-			lut_src[9152] / FRAC_SCALE ,
-			lut_src[9153] / FRAC_SCALE ,
-			lut_src[9154] / FRAC_SCALE ,
-			lut_src[9155] / FRAC_SCALE ,
-			lut_src[9156] / FRAC_SCALE ,
-			lut_src[9157] / FRAC_SCALE ,
-			lut_src[9158] / FRAC_SCALE ,
-			lut_src[9159] / FRAC_SCALE ,
-			lut_src[9160] / FRAC_SCALE ,
-			lut_src[9161] / FRAC_SCALE ,
-			lut_src[9162] / FRAC_SCALE ,
-			lut_src[9163] / FRAC_SCALE ,
-			lut_src[9164] / FRAC_SCALE ,
-			lut_src[9165] / FRAC_SCALE ,
-			lut_src[9166] / FRAC_SCALE ,
-			lut_src[9167] / FRAC_SCALE ,
-			lut_src[9168] / FRAC_SCALE ,
-			lut_src[9169] / FRAC_SCALE ,
-			lut_src[9170] / FRAC_SCALE ,
-			lut_src[9171] / FRAC_SCALE ,
-			lut_src[9172] / FRAC_SCALE ,
-			lut_src[9173] / FRAC_SCALE ,
-			lut_src[9174] / FRAC_SCALE ,
-			lut_src[9175] / FRAC_SCALE ,
-			lut_src[9176] / FRAC_SCALE ,
-			lut_src[9177] / FRAC_SCALE ,
-			lut_src[9178] / FRAC_SCALE ,
-			lut_src[9179] / FRAC_SCALE ,
-			lut_src[9180] / FRAC_SCALE ,
-			lut_src[9181] / FRAC_SCALE ,
-			lut_src[9182] / FRAC_SCALE ,
-			lut_src[9183] / FRAC_SCALE ,
-			lut_src[9184] / FRAC_SCALE ,
-			lut_src[9185] / FRAC_SCALE ,
-			lut_src[9186] / FRAC_SCALE ,
-			lut_src[9187] / FRAC_SCALE ,
-			lut_src[9188] / FRAC_SCALE ,
-			lut_src[9189] / FRAC_SCALE ,
-			lut_src[9190] / FRAC_SCALE ,
-			lut_src[9191] / FRAC_SCALE ,
-			lut_src[9192] / FRAC_SCALE ,
-			lut_src[9193] / FRAC_SCALE ,
-			lut_src[9194] / FRAC_SCALE ,
-			lut_src[9195] / FRAC_SCALE ,
-			lut_src[9196] / FRAC_SCALE ,
-			lut_src[9197] / FRAC_SCALE ,
-			lut_src[9198] / FRAC_SCALE ,
-			lut_src[9199] / FRAC_SCALE ,
-			lut_src[9200] / FRAC_SCALE ,
-			lut_src[9201] / FRAC_SCALE ,
-			lut_src[9202] / FRAC_SCALE ,
-			lut_src[9203] / FRAC_SCALE ,
-			lut_src[9204] / FRAC_SCALE ,
-			lut_src[9205] / FRAC_SCALE ,
-			lut_src[9206] / FRAC_SCALE ,
-			lut_src[9207] / FRAC_SCALE ,
-			lut_src[9208] / FRAC_SCALE ,
-			lut_src[9209] / FRAC_SCALE ,
-			lut_src[9210] / FRAC_SCALE ,
-			lut_src[9211] / FRAC_SCALE ,
-			lut_src[9212] / FRAC_SCALE ,
-			lut_src[9213] / FRAC_SCALE ,
-			lut_src[9214] / FRAC_SCALE ,
-			lut_src[9215] / FRAC_SCALE ,
-			lut_src[9216] / FRAC_SCALE ,
-			lut_src[9217] / FRAC_SCALE ,
-			lut_src[9218] / FRAC_SCALE ,
-			lut_src[9219] / FRAC_SCALE ,
-			lut_src[9220] / FRAC_SCALE ,
-			lut_src[9221] / FRAC_SCALE ,
-			lut_src[9222] / FRAC_SCALE ,
-			lut_src[9223] / FRAC_SCALE ,
-			lut_src[9224] / FRAC_SCALE ,
-			lut_src[9225] / FRAC_SCALE ,
-			lut_src[9226] / FRAC_SCALE ,
-			lut_src[9227] / FRAC_SCALE ,
-			lut_src[9228] / FRAC_SCALE ,
-			lut_src[9229] / FRAC_SCALE ,
-			lut_src[9230] / FRAC_SCALE ,
-			lut_src[9231] / FRAC_SCALE ,
-			lut_src[9232] / FRAC_SCALE ,
-			lut_src[9233] / FRAC_SCALE ,
-			lut_src[9234] / FRAC_SCALE ,
-			lut_src[9235] / FRAC_SCALE ,
-			lut_src[9236] / FRAC_SCALE ,
-			lut_src[9237] / FRAC_SCALE ,
-			lut_src[9238] / FRAC_SCALE ,
-			lut_src[9239] / FRAC_SCALE ,
-			lut_src[9240] / FRAC_SCALE ,
-			lut_src[9241] / FRAC_SCALE ,
-			lut_src[9242] / FRAC_SCALE ,
-			lut_src[9243] / FRAC_SCALE ,
-			lut_src[9244] / FRAC_SCALE ,
-			lut_src[9245] / FRAC_SCALE ,
-			lut_src[9246] / FRAC_SCALE ,
-			lut_src[9247] / FRAC_SCALE ,
-			lut_src[9248] / FRAC_SCALE ,
-			lut_src[9249] / FRAC_SCALE ,
-			lut_src[9250] / FRAC_SCALE ,
-			lut_src[9251] / FRAC_SCALE ,
-			lut_src[9252] / FRAC_SCALE ,
-			lut_src[9253] / FRAC_SCALE ,
-			lut_src[9254] / FRAC_SCALE ,
-			lut_src[9255] / FRAC_SCALE ,
-			lut_src[9256] / FRAC_SCALE ,
-			lut_src[9257] / FRAC_SCALE ,
-			lut_src[9258] / FRAC_SCALE ,
-			lut_src[9259] / FRAC_SCALE ,
-			lut_src[9260] / FRAC_SCALE ,
-			lut_src[9261] / FRAC_SCALE ,
-			lut_src[9262] / FRAC_SCALE ,
-			lut_src[9263] / FRAC_SCALE ,
-			lut_src[9264] / FRAC_SCALE ,
-			lut_src[9265] / FRAC_SCALE ,
-			lut_src[9266] / FRAC_SCALE ,
-			lut_src[9267] / FRAC_SCALE ,
-			lut_src[9268] / FRAC_SCALE ,
-			lut_src[9269] / FRAC_SCALE ,
-			lut_src[9270] / FRAC_SCALE ,
-			lut_src[9271] / FRAC_SCALE ,
-			lut_src[9272] / FRAC_SCALE ,
-			lut_src[9273] / FRAC_SCALE ,
-			lut_src[9274] / FRAC_SCALE ,
-			lut_src[9275] / FRAC_SCALE ,
-			lut_src[9276] / FRAC_SCALE ,
-			lut_src[9277] / FRAC_SCALE ,
-			lut_src[9278] / FRAC_SCALE ,
-			lut_src[9279] / FRAC_SCALE ,
-			lut_src[9280] / FRAC_SCALE ,
-			lut_src[9281] / FRAC_SCALE ,
-			lut_src[9282] / FRAC_SCALE ,
-			lut_src[9283] / FRAC_SCALE ,
-			lut_src[9284] / FRAC_SCALE ,
-			lut_src[9285] / FRAC_SCALE ,
-			lut_src[9286] / FRAC_SCALE ,
-			lut_src[9287] / FRAC_SCALE ,
-			lut_src[9288] / FRAC_SCALE ,
-			lut_src[9289] / FRAC_SCALE ,
-			lut_src[9290] / FRAC_SCALE ,
-			lut_src[9291] / FRAC_SCALE ,
-			lut_src[9292] / FRAC_SCALE ,
-			lut_src[9293] / FRAC_SCALE ,
-			lut_src[9294] / FRAC_SCALE ,
-			lut_src[9295] / FRAC_SCALE ,
-			lut_src[9296] / FRAC_SCALE ,
-			lut_src[9297] / FRAC_SCALE ,
-			lut_src[9298] / FRAC_SCALE ,
-			lut_src[9299] / FRAC_SCALE ,
-			lut_src[9300] / FRAC_SCALE ,
-			lut_src[9301] / FRAC_SCALE ,
-			lut_src[9302] / FRAC_SCALE ,
-			lut_src[9303] / FRAC_SCALE ,
-			lut_src[9304] / FRAC_SCALE ,
-			lut_src[9305] / FRAC_SCALE ,
-			lut_src[9306] / FRAC_SCALE ,
-			lut_src[9307] / FRAC_SCALE ,
-			lut_src[9308] / FRAC_SCALE ,
-			lut_src[9309] / FRAC_SCALE ,
-			lut_src[9310] / FRAC_SCALE ,
-			lut_src[9311] / FRAC_SCALE ,
-			lut_src[9312] / FRAC_SCALE ,
-			lut_src[9313] / FRAC_SCALE ,
-			lut_src[9314] / FRAC_SCALE ,
-			lut_src[9315] / FRAC_SCALE ,
-			lut_src[9316] / FRAC_SCALE ,
-			lut_src[9317] / FRAC_SCALE ,
-			lut_src[9318] / FRAC_SCALE ,
-			lut_src[9319] / FRAC_SCALE ,
-			lut_src[9320] / FRAC_SCALE ,
-			lut_src[9321] / FRAC_SCALE ,
-			lut_src[9322] / FRAC_SCALE ,
-			lut_src[9323] / FRAC_SCALE ,
-			lut_src[9324] / FRAC_SCALE ,
-			lut_src[9325] / FRAC_SCALE ,
-			lut_src[9326] / FRAC_SCALE ,
-			lut_src[9327] / FRAC_SCALE ,
-			lut_src[9328] / FRAC_SCALE ,
-			lut_src[9329] / FRAC_SCALE ,
-			lut_src[9330] / FRAC_SCALE ,
-			lut_src[9331] / FRAC_SCALE ,
-			lut_src[9332] / FRAC_SCALE ,
-			lut_src[9333] / FRAC_SCALE ,
-			lut_src[9334] / FRAC_SCALE ,
-			lut_src[9335] / FRAC_SCALE ,
-			lut_src[9336] / FRAC_SCALE ,
-			lut_src[9337] / FRAC_SCALE ,
-			lut_src[9338] / FRAC_SCALE ,
-			lut_src[9339] / FRAC_SCALE ,
-			lut_src[9340] / FRAC_SCALE ,
-			lut_src[9341] / FRAC_SCALE ,
-			lut_src[9342] / FRAC_SCALE ,
-			lut_src[9343] / FRAC_SCALE ,
-			lut_src[9344] / FRAC_SCALE ,
-			lut_src[9345] / FRAC_SCALE ,
-			lut_src[9346] / FRAC_SCALE ,
-			lut_src[9347] / FRAC_SCALE ,
-			lut_src[9348] / FRAC_SCALE ,
-			lut_src[9349] / FRAC_SCALE ,
-			lut_src[9350] / FRAC_SCALE ,
-			lut_src[9351] / FRAC_SCALE ,
-			lut_src[9352] / FRAC_SCALE ,
-			lut_src[9353] / FRAC_SCALE ,
-			lut_src[9354] / FRAC_SCALE ,
-			lut_src[9355] / FRAC_SCALE ,
-			lut_src[9356] / FRAC_SCALE ,
-			lut_src[9357] / FRAC_SCALE ,
-			lut_src[9358] / FRAC_SCALE ,
-			lut_src[9359] / FRAC_SCALE ,
-			lut_src[9360] / FRAC_SCALE ,
-			lut_src[9361] / FRAC_SCALE ,
-			lut_src[9362] / FRAC_SCALE ,
-			lut_src[9363] / FRAC_SCALE ,
-			lut_src[9364] / FRAC_SCALE ,
-			lut_src[9365] / FRAC_SCALE ,
-			lut_src[9366] / FRAC_SCALE ,
-			lut_src[9367] / FRAC_SCALE ,
-			lut_src[9368] / FRAC_SCALE ,
-			lut_src[9369] / FRAC_SCALE ,
-			lut_src[9370] / FRAC_SCALE ,
-			lut_src[9371] / FRAC_SCALE ,
-			lut_src[9372] / FRAC_SCALE ,
-			lut_src[9373] / FRAC_SCALE ,
-			lut_src[9374] / FRAC_SCALE ,
-			lut_src[9375] / FRAC_SCALE ,
-			lut_src[9376] / FRAC_SCALE ,
-			lut_src[9377] / FRAC_SCALE ,
-			lut_src[9378] / FRAC_SCALE ,
-			lut_src[9379] / FRAC_SCALE ,
-			lut_src[9380] / FRAC_SCALE ,
-			lut_src[9381] / FRAC_SCALE ,
-			lut_src[9382] / FRAC_SCALE ,
-			lut_src[9383] / FRAC_SCALE ,
-			lut_src[9384] / FRAC_SCALE ,
-			lut_src[9385] / FRAC_SCALE ,
-			lut_src[9386] / FRAC_SCALE ,
-			lut_src[9387] / FRAC_SCALE ,
-			lut_src[9388] / FRAC_SCALE ,
-			lut_src[9389] / FRAC_SCALE ,
-			lut_src[9390] / FRAC_SCALE ,
-			lut_src[9391] / FRAC_SCALE ,
-			lut_src[9392] / FRAC_SCALE ,
-			lut_src[9393] / FRAC_SCALE ,
-			lut_src[9394] / FRAC_SCALE ,
-			lut_src[9395] / FRAC_SCALE ,
-			lut_src[9396] / FRAC_SCALE ,
-			lut_src[9397] / FRAC_SCALE ,
-			lut_src[9398] / FRAC_SCALE ,
-			lut_src[9399] / FRAC_SCALE ,
-			lut_src[9400] / FRAC_SCALE ,
-			lut_src[9401] / FRAC_SCALE ,
-			lut_src[9402] / FRAC_SCALE ,
-			lut_src[9403] / FRAC_SCALE ,
-			lut_src[9404] / FRAC_SCALE ,
-			lut_src[9405] / FRAC_SCALE ,
-			lut_src[9406] / FRAC_SCALE ,
-			lut_src[9407] / FRAC_SCALE ,
-			lut_src[9408] / FRAC_SCALE ,
-			lut_src[9409] / FRAC_SCALE ,
-			lut_src[9410] / FRAC_SCALE ,
-			lut_src[9411] / FRAC_SCALE ,
-			lut_src[9412] / FRAC_SCALE ,
-			lut_src[9413] / FRAC_SCALE ,
-			lut_src[9414] / FRAC_SCALE ,
-			lut_src[9415] / FRAC_SCALE ,
-			lut_src[9416] / FRAC_SCALE ,
-			lut_src[9417] / FRAC_SCALE ,
-			lut_src[9418] / FRAC_SCALE ,
-			lut_src[9419] / FRAC_SCALE ,
-			lut_src[9420] / FRAC_SCALE ,
-			lut_src[9421] / FRAC_SCALE ,
-			lut_src[9422] / FRAC_SCALE ,
-			lut_src[9423] / FRAC_SCALE ,
-			lut_src[9424] / FRAC_SCALE ,
-			lut_src[9425] / FRAC_SCALE ,
-			lut_src[9426] / FRAC_SCALE ,
-			lut_src[9427] / FRAC_SCALE ,
-			lut_src[9428] / FRAC_SCALE ,
-			lut_src[9429] / FRAC_SCALE ,
-			lut_src[9430] / FRAC_SCALE ,
-			lut_src[9431] / FRAC_SCALE ,
-			lut_src[9432] / FRAC_SCALE ,
-			lut_src[9433] / FRAC_SCALE ,
-			lut_src[9434] / FRAC_SCALE ,
-			lut_src[9435] / FRAC_SCALE ,
-			lut_src[9436] / FRAC_SCALE ,
-			lut_src[9437] / FRAC_SCALE ,
-			lut_src[9438] / FRAC_SCALE ,
-			lut_src[9439] / FRAC_SCALE ,
-			lut_src[9440] / FRAC_SCALE ,
-			lut_src[9441] / FRAC_SCALE ,
-			lut_src[9442] / FRAC_SCALE ,
-			lut_src[9443] / FRAC_SCALE ,
-			lut_src[9444] / FRAC_SCALE ,
-			lut_src[9445] / FRAC_SCALE ,
-			lut_src[9446] / FRAC_SCALE ,
-			lut_src[9447] / FRAC_SCALE ,
-			lut_src[9448] / FRAC_SCALE ,
-			lut_src[9449] / FRAC_SCALE ,
-			lut_src[9450] / FRAC_SCALE ,
-			lut_src[9451] / FRAC_SCALE ,
-			lut_src[9452] / FRAC_SCALE ,
-			lut_src[9453] / FRAC_SCALE ,
-			lut_src[9454] / FRAC_SCALE ,
-			lut_src[9455] / FRAC_SCALE ,
-			lut_src[9456] / FRAC_SCALE ,
-			lut_src[9457] / FRAC_SCALE ,
-			lut_src[9458] / FRAC_SCALE ,
-			lut_src[9459] / FRAC_SCALE ,
-			lut_src[9460] / FRAC_SCALE ,
-			lut_src[9461] / FRAC_SCALE ,
-			lut_src[9462] / FRAC_SCALE ,
-			lut_src[9463] / FRAC_SCALE ,
-			lut_src[9464] / FRAC_SCALE ,
-			lut_src[9465] / FRAC_SCALE ,
-			lut_src[9466] / FRAC_SCALE ,
-			lut_src[9467] / FRAC_SCALE ,
-			lut_src[9468] / FRAC_SCALE ,
-			lut_src[9469] / FRAC_SCALE ,
-			lut_src[9470] / FRAC_SCALE ,
-			lut_src[9471] / FRAC_SCALE ,
-			lut_src[9472] / FRAC_SCALE ,
-			lut_src[9473] / FRAC_SCALE ,
-			lut_src[9474] / FRAC_SCALE ,
-			lut_src[9475] / FRAC_SCALE ,
-			lut_src[9476] / FRAC_SCALE ,
-			lut_src[9477] / FRAC_SCALE ,
-			lut_src[9478] / FRAC_SCALE ,
-			lut_src[9479] / FRAC_SCALE ,
-			lut_src[9480] / FRAC_SCALE ,
-			lut_src[9481] / FRAC_SCALE ,
-			lut_src[9482] / FRAC_SCALE ,
-			lut_src[9483] / FRAC_SCALE ,
-			lut_src[9484] / FRAC_SCALE ,
-			lut_src[9485] / FRAC_SCALE ,
-			lut_src[9486] / FRAC_SCALE ,
-			lut_src[9487] / FRAC_SCALE ,
-			lut_src[9488] / FRAC_SCALE ,
-			lut_src[9489] / FRAC_SCALE ,
-			lut_src[9490] / FRAC_SCALE ,
-			lut_src[9491] / FRAC_SCALE ,
-			lut_src[9492] / FRAC_SCALE ,
-			lut_src[9493] / FRAC_SCALE ,
-			lut_src[9494] / FRAC_SCALE ,
-			lut_src[9495] / FRAC_SCALE ,
-			lut_src[9496] / FRAC_SCALE ,
-			lut_src[9497] / FRAC_SCALE ,
-			lut_src[9498] / FRAC_SCALE ,
-			lut_src[9499] / FRAC_SCALE ,
-			lut_src[9500] / FRAC_SCALE ,
-			lut_src[9501] / FRAC_SCALE ,
-			lut_src[9502] / FRAC_SCALE ,
-			lut_src[9503] / FRAC_SCALE ,
-			lut_src[9504] / FRAC_SCALE ,
-			lut_src[9505] / FRAC_SCALE ,
-			lut_src[9506] / FRAC_SCALE ,
-			lut_src[9507] / FRAC_SCALE ,
-			lut_src[9508] / FRAC_SCALE ,
-			lut_src[9509] / FRAC_SCALE ,
-			lut_src[9510] / FRAC_SCALE ,
-			lut_src[9511] / FRAC_SCALE ,
-			lut_src[9512] / FRAC_SCALE ,
-			lut_src[9513] / FRAC_SCALE ,
-			lut_src[9514] / FRAC_SCALE ,
-			lut_src[9515] / FRAC_SCALE ,
-			lut_src[9516] / FRAC_SCALE ,
-			lut_src[9517] / FRAC_SCALE ,
-			lut_src[9518] / FRAC_SCALE ,
-			lut_src[9519] / FRAC_SCALE ,
-			lut_src[9520] / FRAC_SCALE ,
-			lut_src[9521] / FRAC_SCALE ,
-			lut_src[9522] / FRAC_SCALE ,
-			lut_src[9523] / FRAC_SCALE ,
-			lut_src[9524] / FRAC_SCALE ,
-			lut_src[9525] / FRAC_SCALE ,
-			lut_src[9526] / FRAC_SCALE ,
-			lut_src[9527] / FRAC_SCALE ,
-			lut_src[9528] / FRAC_SCALE ,
-			lut_src[9529] / FRAC_SCALE ,
-			lut_src[9530] / FRAC_SCALE ,
-			lut_src[9531] / FRAC_SCALE ,
-			lut_src[9532] / FRAC_SCALE ,
-			lut_src[9533] / FRAC_SCALE ,
-			lut_src[9534] / FRAC_SCALE ,
-			lut_src[9535] / FRAC_SCALE ,
-			lut_src[9536] / FRAC_SCALE ,
-			lut_src[9537] / FRAC_SCALE ,
-			lut_src[9538] / FRAC_SCALE ,
-			lut_src[9539] / FRAC_SCALE ,
-			lut_src[9540] / FRAC_SCALE ,
-			lut_src[9541] / FRAC_SCALE ,
-			lut_src[9542] / FRAC_SCALE ,
-			lut_src[9543] / FRAC_SCALE ,
-			lut_src[9544] / FRAC_SCALE ,
-			lut_src[9545] / FRAC_SCALE ,
-			lut_src[9546] / FRAC_SCALE ,
-			lut_src[9547] / FRAC_SCALE ,
-			lut_src[9548] / FRAC_SCALE ,
-			lut_src[9549] / FRAC_SCALE ,
-			lut_src[9550] / FRAC_SCALE ,
-			lut_src[9551] / FRAC_SCALE ,
-			lut_src[9552] / FRAC_SCALE ,
-			lut_src[9553] / FRAC_SCALE ,
-			lut_src[9554] / FRAC_SCALE ,
-			lut_src[9555] / FRAC_SCALE ,
-			lut_src[9556] / FRAC_SCALE ,
-			lut_src[9557] / FRAC_SCALE ,
-			lut_src[9558] / FRAC_SCALE ,
-			lut_src[9559] / FRAC_SCALE ,
-			lut_src[9560] / FRAC_SCALE ,
-			lut_src[9561] / FRAC_SCALE ,
-			lut_src[9562] / FRAC_SCALE ,
-			lut_src[9563] / FRAC_SCALE ,
-			lut_src[9564] / FRAC_SCALE ,
-			lut_src[9565] / FRAC_SCALE ,
-			lut_src[9566] / FRAC_SCALE ,
-			lut_src[9567] / FRAC_SCALE ,
-			lut_src[9568] / FRAC_SCALE ,
-			lut_src[9569] / FRAC_SCALE ,
-			lut_src[9570] / FRAC_SCALE ,
-			lut_src[9571] / FRAC_SCALE ,
-			lut_src[9572] / FRAC_SCALE ,
-			lut_src[9573] / FRAC_SCALE ,
-			lut_src[9574] / FRAC_SCALE ,
-			lut_src[9575] / FRAC_SCALE ,
-			lut_src[9576] / FRAC_SCALE ,
-			lut_src[9577] / FRAC_SCALE ,
-			lut_src[9578] / FRAC_SCALE ,
-			lut_src[9579] / FRAC_SCALE ,
-			lut_src[9580] / FRAC_SCALE ,
-			lut_src[9581] / FRAC_SCALE ,
-			lut_src[9582] / FRAC_SCALE ,
-			lut_src[9583] / FRAC_SCALE ,
-			lut_src[9584] / FRAC_SCALE ,
-			lut_src[9585] / FRAC_SCALE ,
-			lut_src[9586] / FRAC_SCALE ,
-			lut_src[9587] / FRAC_SCALE ,
-			lut_src[9588] / FRAC_SCALE ,
-			lut_src[9589] / FRAC_SCALE ,
-			lut_src[9590] / FRAC_SCALE ,
-			lut_src[9591] / FRAC_SCALE ,
-			lut_src[9592] / FRAC_SCALE ,
-			lut_src[9593] / FRAC_SCALE ,
-			lut_src[9594] / FRAC_SCALE ,
-			lut_src[9595] / FRAC_SCALE ,
-			lut_src[9596] / FRAC_SCALE ,
-			lut_src[9597] / FRAC_SCALE ,
-			lut_src[9598] / FRAC_SCALE ,
-			lut_src[9599] / FRAC_SCALE ,
-			lut_src[9600] / FRAC_SCALE ,
-			lut_src[9601] / FRAC_SCALE ,
-			lut_src[9602] / FRAC_SCALE ,
-			lut_src[9603] / FRAC_SCALE ,
-			lut_src[9604] / FRAC_SCALE ,
-			lut_src[9605] / FRAC_SCALE ,
-			lut_src[9606] / FRAC_SCALE ,
-			lut_src[9607] / FRAC_SCALE ,
-			lut_src[9608] / FRAC_SCALE ,
-			lut_src[9609] / FRAC_SCALE ,
-			lut_src[9610] / FRAC_SCALE ,
-			lut_src[9611] / FRAC_SCALE ,
-			lut_src[9612] / FRAC_SCALE ,
-			lut_src[9613] / FRAC_SCALE ,
-			lut_src[9614] / FRAC_SCALE ,
-			lut_src[9615] / FRAC_SCALE ,
-			lut_src[9616] / FRAC_SCALE ,
-			lut_src[9617] / FRAC_SCALE ,
-			lut_src[9618] / FRAC_SCALE ,
-			lut_src[9619] / FRAC_SCALE ,
-			lut_src[9620] / FRAC_SCALE ,
-			lut_src[9621] / FRAC_SCALE ,
-			lut_src[9622] / FRAC_SCALE ,
-			lut_src[9623] / FRAC_SCALE ,
-			lut_src[9624] / FRAC_SCALE ,
-			lut_src[9625] / FRAC_SCALE ,
-			lut_src[9626] / FRAC_SCALE ,
-			lut_src[9627] / FRAC_SCALE ,
-			lut_src[9628] / FRAC_SCALE ,
-			lut_src[9629] / FRAC_SCALE ,
-			lut_src[9630] / FRAC_SCALE ,
-			lut_src[9631] / FRAC_SCALE ,
-			lut_src[9632] / FRAC_SCALE ,
-			lut_src[9633] / FRAC_SCALE ,
-			lut_src[9634] / FRAC_SCALE ,
-			lut_src[9635] / FRAC_SCALE ,
-			lut_src[9636] / FRAC_SCALE ,
-			lut_src[9637] / FRAC_SCALE ,
-			lut_src[9638] / FRAC_SCALE ,
-			lut_src[9639] / FRAC_SCALE ,
-			lut_src[9640] / FRAC_SCALE ,
-			lut_src[9641] / FRAC_SCALE ,
-			lut_src[9642] / FRAC_SCALE ,
-			lut_src[9643] / FRAC_SCALE ,
-			lut_src[9644] / FRAC_SCALE ,
-			lut_src[9645] / FRAC_SCALE ,
-			lut_src[9646] / FRAC_SCALE ,
-			lut_src[9647] / FRAC_SCALE ,
-			lut_src[9648] / FRAC_SCALE ,
-			lut_src[9649] / FRAC_SCALE ,
-			lut_src[9650] / FRAC_SCALE ,
-			lut_src[9651] / FRAC_SCALE ,
-			lut_src[9652] / FRAC_SCALE ,
-			lut_src[9653] / FRAC_SCALE ,
-			lut_src[9654] / FRAC_SCALE ,
-			lut_src[9655] / FRAC_SCALE ,
-			lut_src[9656] / FRAC_SCALE ,
-			lut_src[9657] / FRAC_SCALE ,
-			lut_src[9658] / FRAC_SCALE ,
-			lut_src[9659] / FRAC_SCALE ,
-			lut_src[9660] / FRAC_SCALE ,
-			lut_src[9661] / FRAC_SCALE ,
-			lut_src[9662] / FRAC_SCALE ,
-			lut_src[9663] / FRAC_SCALE ,
-			lut_src[9664] / FRAC_SCALE ,
-			lut_src[9665] / FRAC_SCALE ,
-			lut_src[9666] / FRAC_SCALE ,
-			lut_src[9667] / FRAC_SCALE ,
-			lut_src[9668] / FRAC_SCALE ,
-			lut_src[9669] / FRAC_SCALE ,
-			lut_src[9670] / FRAC_SCALE ,
-			lut_src[9671] / FRAC_SCALE ,
-			lut_src[9672] / FRAC_SCALE ,
-			lut_src[9673] / FRAC_SCALE ,
-			lut_src[9674] / FRAC_SCALE ,
-			lut_src[9675] / FRAC_SCALE ,
-			lut_src[9676] / FRAC_SCALE ,
-			lut_src[9677] / FRAC_SCALE ,
-			lut_src[9678] / FRAC_SCALE ,
-			lut_src[9679] / FRAC_SCALE ,
-			lut_src[9680] / FRAC_SCALE ,
-			lut_src[9681] / FRAC_SCALE ,
-			lut_src[9682] / FRAC_SCALE ,
-			lut_src[9683] / FRAC_SCALE ,
-			lut_src[9684] / FRAC_SCALE ,
-			lut_src[9685] / FRAC_SCALE ,
-			lut_src[9686] / FRAC_SCALE ,
-			lut_src[9687] / FRAC_SCALE ,
-			lut_src[9688] / FRAC_SCALE ,
-			lut_src[9689] / FRAC_SCALE ,
-			lut_src[9690] / FRAC_SCALE ,
-			lut_src[9691] / FRAC_SCALE ,
-			lut_src[9692] / FRAC_SCALE ,
-			lut_src[9693] / FRAC_SCALE ,
-			lut_src[9694] / FRAC_SCALE ,
-			lut_src[9695] / FRAC_SCALE ,
-			lut_src[9696] / FRAC_SCALE ,
-			lut_src[9697] / FRAC_SCALE ,
-			lut_src[9698] / FRAC_SCALE ,
-			lut_src[9699] / FRAC_SCALE ,
-			lut_src[9700] / FRAC_SCALE ,
-			lut_src[9701] / FRAC_SCALE ,
-			lut_src[9702] / FRAC_SCALE ,
-			lut_src[9703] / FRAC_SCALE ,
-			lut_src[9704] / FRAC_SCALE ,
-			lut_src[9705] / FRAC_SCALE ,
-			lut_src[9706] / FRAC_SCALE ,
-			lut_src[9707] / FRAC_SCALE ,
-			lut_src[9708] / FRAC_SCALE ,
-			lut_src[9709] / FRAC_SCALE ,
-			lut_src[9710] / FRAC_SCALE ,
-			lut_src[9711] / FRAC_SCALE ,
-			lut_src[9712] / FRAC_SCALE ,
-			lut_src[9713] / FRAC_SCALE ,
-			lut_src[9714] / FRAC_SCALE ,
-			lut_src[9715] / FRAC_SCALE ,
-			lut_src[9716] / FRAC_SCALE ,
-			lut_src[9717] / FRAC_SCALE ,
-			lut_src[9718] / FRAC_SCALE ,
-			lut_src[9719] / FRAC_SCALE ,
-			lut_src[9720] / FRAC_SCALE ,
-			lut_src[9721] / FRAC_SCALE ,
-			lut_src[9722] / FRAC_SCALE ,
-			lut_src[9723] / FRAC_SCALE ,
-			lut_src[9724] / FRAC_SCALE ,
-			lut_src[9725] / FRAC_SCALE ,
-			lut_src[9726] / FRAC_SCALE ,
-			lut_src[9727] / FRAC_SCALE ,
-			lut_src[9728] / FRAC_SCALE ,
-			lut_src[9729] / FRAC_SCALE ,
-			lut_src[9730] / FRAC_SCALE ,
-			lut_src[9731] / FRAC_SCALE ,
-			lut_src[9732] / FRAC_SCALE ,
-			lut_src[9733] / FRAC_SCALE ,
-			lut_src[9734] / FRAC_SCALE ,
-			lut_src[9735] / FRAC_SCALE ,
-			lut_src[9736] / FRAC_SCALE ,
-			lut_src[9737] / FRAC_SCALE ,
-			lut_src[9738] / FRAC_SCALE ,
-			lut_src[9739] / FRAC_SCALE ,
-			lut_src[9740] / FRAC_SCALE ,
-			lut_src[9741] / FRAC_SCALE ,
-			lut_src[9742] / FRAC_SCALE ,
-			lut_src[9743] / FRAC_SCALE ,
-			lut_src[9744] / FRAC_SCALE ,
-			lut_src[9745] / FRAC_SCALE ,
-			lut_src[9746] / FRAC_SCALE ,
-			lut_src[9747] / FRAC_SCALE ,
-			lut_src[9748] / FRAC_SCALE ,
-			lut_src[9749] / FRAC_SCALE ,
-			lut_src[9750] / FRAC_SCALE ,
-			lut_src[9751] / FRAC_SCALE ,
-			lut_src[9752] / FRAC_SCALE ,
-			lut_src[9753] / FRAC_SCALE ,
-			lut_src[9754] / FRAC_SCALE ,
-			lut_src[9755] / FRAC_SCALE ,
-			lut_src[9756] / FRAC_SCALE ,
-			lut_src[9757] / FRAC_SCALE ,
-			lut_src[9758] / FRAC_SCALE ,
-			lut_src[9759] / FRAC_SCALE ,
-			lut_src[9760] / FRAC_SCALE ,
-			lut_src[9761] / FRAC_SCALE ,
-			lut_src[9762] / FRAC_SCALE ,
-			lut_src[9763] / FRAC_SCALE ,
-			lut_src[9764] / FRAC_SCALE ,
-			lut_src[9765] / FRAC_SCALE ,
-			lut_src[9766] / FRAC_SCALE ,
-			lut_src[9767] / FRAC_SCALE ,
-			lut_src[9768] / FRAC_SCALE ,
-			lut_src[9769] / FRAC_SCALE ,
-			lut_src[9770] / FRAC_SCALE ,
-			lut_src[9771] / FRAC_SCALE ,
-			lut_src[9772] / FRAC_SCALE ,
-			lut_src[9773] / FRAC_SCALE ,
-			lut_src[9774] / FRAC_SCALE ,
-			lut_src[9775] / FRAC_SCALE ,
-			lut_src[9776] / FRAC_SCALE ,
-			lut_src[9777] / FRAC_SCALE ,
-			lut_src[9778] / FRAC_SCALE ,
-			lut_src[9779] / FRAC_SCALE ,
-			lut_src[9780] / FRAC_SCALE ,
-			lut_src[9781] / FRAC_SCALE ,
-			lut_src[9782] / FRAC_SCALE ,
-			lut_src[9783] / FRAC_SCALE ,
-			lut_src[9784] / FRAC_SCALE ,
-			lut_src[9785] / FRAC_SCALE ,
-			lut_src[9786] / FRAC_SCALE ,
-			lut_src[9787] / FRAC_SCALE ,
-			lut_src[9788] / FRAC_SCALE ,
-			lut_src[9789] / FRAC_SCALE ,
-			lut_src[9790] / FRAC_SCALE ,
-			lut_src[9791] / FRAC_SCALE ,
-			lut_src[9792] / FRAC_SCALE ,
-			lut_src[9793] / FRAC_SCALE ,
-			lut_src[9794] / FRAC_SCALE ,
-			lut_src[9795] / FRAC_SCALE ,
-			lut_src[9796] / FRAC_SCALE ,
-			lut_src[9797] / FRAC_SCALE ,
-			lut_src[9798] / FRAC_SCALE ,
-			lut_src[9799] / FRAC_SCALE ,
-			lut_src[9800] / FRAC_SCALE ,
-			lut_src[9801] / FRAC_SCALE ,
-			lut_src[9802] / FRAC_SCALE ,
-			lut_src[9803] / FRAC_SCALE ,
-			lut_src[9804] / FRAC_SCALE ,
-			lut_src[9805] / FRAC_SCALE ,
-			lut_src[9806] / FRAC_SCALE ,
-			lut_src[9807] / FRAC_SCALE ,
-			lut_src[9808] / FRAC_SCALE ,
-			lut_src[9809] / FRAC_SCALE ,
-			lut_src[9810] / FRAC_SCALE ,
-			lut_src[9811] / FRAC_SCALE ,
-			lut_src[9812] / FRAC_SCALE ,
-			lut_src[9813] / FRAC_SCALE ,
-			lut_src[9814] / FRAC_SCALE ,
-			lut_src[9815] / FRAC_SCALE ,
-			lut_src[9816] / FRAC_SCALE ,
-			lut_src[9817] / FRAC_SCALE ,
-			lut_src[9818] / FRAC_SCALE ,
-			lut_src[9819] / FRAC_SCALE ,
-			lut_src[9820] / FRAC_SCALE ,
-			lut_src[9821] / FRAC_SCALE ,
-			lut_src[9822] / FRAC_SCALE ,
-			lut_src[9823] / FRAC_SCALE ,
-			lut_src[9824] / FRAC_SCALE ,
-			lut_src[9825] / FRAC_SCALE ,
-			lut_src[9826] / FRAC_SCALE ,
-			lut_src[9827] / FRAC_SCALE ,
-			lut_src[9828] / FRAC_SCALE ,
-			lut_src[9829] / FRAC_SCALE ,
-			lut_src[9830] / FRAC_SCALE ,
-			lut_src[9831] / FRAC_SCALE ,
-			lut_src[9832] / FRAC_SCALE ,
-			lut_src[9833] / FRAC_SCALE ,
-			lut_src[9834] / FRAC_SCALE ,
-			lut_src[9835] / FRAC_SCALE ,
-			lut_src[9836] / FRAC_SCALE ,
-			lut_src[9837] / FRAC_SCALE ,
-			lut_src[9838] / FRAC_SCALE ,
-			lut_src[9839] / FRAC_SCALE ,
-			lut_src[9840] / FRAC_SCALE ,
-			lut_src[9841] / FRAC_SCALE ,
-			lut_src[9842] / FRAC_SCALE ,
-			lut_src[9843] / FRAC_SCALE ,
-			lut_src[9844] / FRAC_SCALE ,
-			lut_src[9845] / FRAC_SCALE ,
-			lut_src[9846] / FRAC_SCALE ,
-			lut_src[9847] / FRAC_SCALE ,
-			lut_src[9848] / FRAC_SCALE ,
-			lut_src[9849] / FRAC_SCALE ,
-			lut_src[9850] / FRAC_SCALE ,
-			lut_src[9851] / FRAC_SCALE ,
-			lut_src[9852] / FRAC_SCALE ,
-			lut_src[9853] / FRAC_SCALE ,
-			lut_src[9854] / FRAC_SCALE ,
-			lut_src[9855] / FRAC_SCALE ,
-			lut_src[9856] / FRAC_SCALE ,
-			lut_src[9857] / FRAC_SCALE ,
-			lut_src[9858] / FRAC_SCALE ,
-			lut_src[9859] / FRAC_SCALE ,
-			lut_src[9860] / FRAC_SCALE ,
-			lut_src[9861] / FRAC_SCALE ,
-			lut_src[9862] / FRAC_SCALE ,
-			lut_src[9863] / FRAC_SCALE ,
-			lut_src[9864] / FRAC_SCALE ,
-			lut_src[9865] / FRAC_SCALE ,
-			lut_src[9866] / FRAC_SCALE ,
-			lut_src[9867] / FRAC_SCALE ,
-			lut_src[9868] / FRAC_SCALE ,
-			lut_src[9869] / FRAC_SCALE ,
-			lut_src[9870] / FRAC_SCALE ,
-			lut_src[9871] / FRAC_SCALE ,
-			lut_src[9872] / FRAC_SCALE ,
-			lut_src[9873] / FRAC_SCALE ,
-			lut_src[9874] / FRAC_SCALE ,
-			lut_src[9875] / FRAC_SCALE ,
-			lut_src[9876] / FRAC_SCALE ,
-			lut_src[9877] / FRAC_SCALE ,
-			lut_src[9878] / FRAC_SCALE ,
-			lut_src[9879] / FRAC_SCALE ,
-			lut_src[9880] / FRAC_SCALE ,
-			lut_src[9881] / FRAC_SCALE ,
-			lut_src[9882] / FRAC_SCALE ,
-			lut_src[9883] / FRAC_SCALE ,
-			lut_src[9884] / FRAC_SCALE ,
-			lut_src[9885] / FRAC_SCALE ,
-			lut_src[9886] / FRAC_SCALE ,
-			lut_src[9887] / FRAC_SCALE ,
-			lut_src[9888] / FRAC_SCALE ,
-			lut_src[9889] / FRAC_SCALE ,
-			lut_src[9890] / FRAC_SCALE ,
-			lut_src[9891] / FRAC_SCALE ,
-			lut_src[9892] / FRAC_SCALE ,
-			lut_src[9893] / FRAC_SCALE ,
-			lut_src[9894] / FRAC_SCALE ,
-			lut_src[9895] / FRAC_SCALE ,
-			lut_src[9896] / FRAC_SCALE ,
-			lut_src[9897] / FRAC_SCALE ,
-			lut_src[9898] / FRAC_SCALE ,
-			lut_src[9899] / FRAC_SCALE ,
-			lut_src[9900] / FRAC_SCALE ,
-			lut_src[9901] / FRAC_SCALE ,
-			lut_src[9902] / FRAC_SCALE ,
-			lut_src[9903] / FRAC_SCALE ,
-			lut_src[9904] / FRAC_SCALE ,
-			lut_src[9905] / FRAC_SCALE ,
-			lut_src[9906] / FRAC_SCALE ,
-			lut_src[9907] / FRAC_SCALE ,
-			lut_src[9908] / FRAC_SCALE ,
-			lut_src[9909] / FRAC_SCALE ,
-			lut_src[9910] / FRAC_SCALE ,
-			lut_src[9911] / FRAC_SCALE ,
-			lut_src[9912] / FRAC_SCALE ,
-			lut_src[9913] / FRAC_SCALE ,
-			lut_src[9914] / FRAC_SCALE ,
-			lut_src[9915] / FRAC_SCALE ,
-			lut_src[9916] / FRAC_SCALE ,
-			lut_src[9917] / FRAC_SCALE ,
-			lut_src[9918] / FRAC_SCALE ,
-			lut_src[9919] / FRAC_SCALE ,
-			lut_src[9920] / FRAC_SCALE ,
-			lut_src[9921] / FRAC_SCALE ,
-			lut_src[9922] / FRAC_SCALE ,
-			lut_src[9923] / FRAC_SCALE ,
-			lut_src[9924] / FRAC_SCALE ,
-			lut_src[9925] / FRAC_SCALE ,
-			lut_src[9926] / FRAC_SCALE ,
-			lut_src[9927] / FRAC_SCALE ,
-			lut_src[9928] / FRAC_SCALE ,
-			lut_src[9929] / FRAC_SCALE ,
-			lut_src[9930] / FRAC_SCALE ,
-			lut_src[9931] / FRAC_SCALE ,
-			lut_src[9932] / FRAC_SCALE ,
-			lut_src[9933] / FRAC_SCALE ,
-			lut_src[9934] / FRAC_SCALE ,
-			lut_src[9935] / FRAC_SCALE ,
-			lut_src[9936] / FRAC_SCALE ,
-			lut_src[9937] / FRAC_SCALE ,
-			lut_src[9938] / FRAC_SCALE ,
-			lut_src[9939] / FRAC_SCALE ,
-			lut_src[9940] / FRAC_SCALE ,
-			lut_src[9941] / FRAC_SCALE ,
-			lut_src[9942] / FRAC_SCALE ,
-			lut_src[9943] / FRAC_SCALE ,
-			lut_src[9944] / FRAC_SCALE ,
-			lut_src[9945] / FRAC_SCALE ,
-			lut_src[9946] / FRAC_SCALE ,
-			lut_src[9947] / FRAC_SCALE ,
-			lut_src[9948] / FRAC_SCALE ,
-			lut_src[9949] / FRAC_SCALE ,
-			lut_src[9950] / FRAC_SCALE ,
-			lut_src[9951] / FRAC_SCALE ,
-			lut_src[9952] / FRAC_SCALE ,
-			lut_src[9953] / FRAC_SCALE ,
-			lut_src[9954] / FRAC_SCALE ,
-			lut_src[9955] / FRAC_SCALE ,
-			lut_src[9956] / FRAC_SCALE ,
-			lut_src[9957] / FRAC_SCALE ,
-			lut_src[9958] / FRAC_SCALE ,
-			lut_src[9959] / FRAC_SCALE ,
-			lut_src[9960] / FRAC_SCALE ,
-			lut_src[9961] / FRAC_SCALE ,
-			lut_src[9962] / FRAC_SCALE ,
-			lut_src[9963] / FRAC_SCALE ,
-			lut_src[9964] / FRAC_SCALE ,
-			lut_src[9965] / FRAC_SCALE ,
-			lut_src[9966] / FRAC_SCALE ,
-			lut_src[9967] / FRAC_SCALE ,
-			lut_src[9968] / FRAC_SCALE ,
-			lut_src[9969] / FRAC_SCALE ,
-			lut_src[9970] / FRAC_SCALE ,
-			lut_src[9971] / FRAC_SCALE ,
-			lut_src[9972] / FRAC_SCALE ,
-			lut_src[9973] / FRAC_SCALE ,
-			lut_src[9974] / FRAC_SCALE ,
-			lut_src[9975] / FRAC_SCALE ,
-			lut_src[9976] / FRAC_SCALE ,
-			lut_src[9977] / FRAC_SCALE ,
-			lut_src[9978] / FRAC_SCALE ,
-			lut_src[9979] / FRAC_SCALE ,
-			lut_src[9980] / FRAC_SCALE ,
-			lut_src[9981] / FRAC_SCALE ,
-			lut_src[9982] / FRAC_SCALE ,
-			lut_src[9983] / FRAC_SCALE ,
-			lut_src[9984] / FRAC_SCALE ,
-			lut_src[9985] / FRAC_SCALE ,
-			lut_src[9986] / FRAC_SCALE ,
-			lut_src[9987] / FRAC_SCALE ,
-			lut_src[9988] / FRAC_SCALE ,
-			lut_src[9989] / FRAC_SCALE ,
-			lut_src[9990] / FRAC_SCALE ,
-			lut_src[9991] / FRAC_SCALE ,
-			lut_src[9992] / FRAC_SCALE ,
-			lut_src[9993] / FRAC_SCALE ,
-			lut_src[9994] / FRAC_SCALE ,
-			lut_src[9995] / FRAC_SCALE ,
-			lut_src[9996] / FRAC_SCALE ,
-			lut_src[9997] / FRAC_SCALE ,
-			lut_src[9998] / FRAC_SCALE ,
-			lut_src[9999] / FRAC_SCALE ,
-			lut_src[10000] / FRAC_SCALE ,
-		};
+	// Tangent table over the first octant [0, pi/4] in Q1.62, the other octant
+	// is the reciprocal of its mirror.
+	//
+	// max error over the octant with FIXED_64_TRIG_LUT_BITS 10:
+	//   linear     2.9e-7, 16 KB
+	//   quadratic  5.7e-11, 24 KB
+	struct tan_lut
+	{
+		static constexpr unsigned int BITS = 10;
+		static constexpr size_t COUNT = size_t(1) << BITS;
 
+		static constexpr internal::trig_lut_entry data[COUNT] =
+		{
+#if FIXED_64_TRIG_LUT_INTERPOLATION >= 2
+			{ 0, 3537118529214745, 1040398306 },
+			{ 3537119569613051, 3537120610010138, 3121199820 },
+			{ 7074243300823009, 3537126852407334, 5202016020 },
+			{ 10611375355246363, 3537137256435711, 7282856706 },
+			{ 14148519894538780, 3537151822144226, 9363731668 },
+			{ 17685681080414674, 3537170549601441, 11444650694 },
+			{ 21222863074666809, 3537193438895484, 13525623584 },
+			{ 24760070039185877, 3537220490134085, 15606660130 },
+			{ 28297306135980092, 3537251703444549, 17687770130 },
+			{ 31834575527194771, 3537287078973788, 19768963376 },
+			{ 35371882375131935, 3537326616888289, 21850249670 },
+			{ 38909230842269894, 3537370317374159, 23931638790 },
+			{ 42446625091282843, 3537418180637053, 26013140566 },
+			{ 45984069285060462, 3537470206902263, 28094764778 },
+			{ 49521567586727503, 3537526396414676, 30176521232 },
+			{ 53059124159663411, 3537586749438764, 32258419728 },
+			{ 56596743167521903, 3537651266258623, 34340470066 },
+			{ 60134428774250592, 3537719947177936, 36422682060 },
+			{ 63672185144110588, 3537792792520013, 38505065510 },
+			{ 67210016441696111, 3537869802627761, 40587630234 },
+			{ 70747926831954106, 3537950977863725, 42670386034 },
+			{ 74285920480203865, 3538036318610057, 44753342722 },
+			{ 77824001552156644, 3538125825268535, 46836510114 },
+			{ 81362174213935293, 3538219498260580, 48919898016 },
+			{ 84900442632093889, 3538317338027206, 51003516272 },
+			{ 88438810973637367, 3538419345029115, 53087374678 },
+			{ 91977283406041160, 3538525519746608, 55171483072 },
+			{ 95515864097270840, 3538635862679665, 57255851274 },
+			{ 99054557215801779, 3538750374347889, 59340489118 },
+			{ 102593366930638786, 3538869055290570, 61425406424 },
+			{ 106132297411335780, 3538991906066641, 63510613030 },
+			{ 109671352828015451, 3539118927254700, 65596118776 },
+			{ 113210537351388927, 3539250119453022, 67681933508 },
+			{ 116749855152775457, 3539385483279571, 69768067058 },
+			{ 120289310404122086, 3539525019371985, 71854529278 },
+			{ 123828907278023349, 3539668728387609, 73941330010 },
+			{ 127368649947740968, 3539816611003462, 76028479116 },
+			{ 130908542587223546, 3539968667916299, 78115986442 },
+			{ 134448589371126287, 3540124899842559, 80203861858 },
+			{ 137988794474830704, 3540285307518419, 82292115222 },
+			{ 141529162074464345, 3540449891699769, 84380756406 },
+			{ 145069696346920520, 3540618653162246, 86469795280 },
+			{ 148610401469878046, 3540791592701239, 88559241706 },
+			{ 152151281621820991, 3540968711131856, 90649105580 },
+			{ 155692340982058427, 3541150009288981, 92739396782 },
+			{ 159233583730744190, 3541335488027277, 94830125194 },
+			{ 162775014048896661, 3541525148221153, 96921300714 },
+			{ 166316636118418528, 3541718990764838, 99012933232 },
+			{ 169858454122116598, 3541917016572323, 101105032654 },
+			{ 173400472243721575, 3542119226577412, 103197608888 },
+			{ 176942694667907875, 3542325621733735, 105290671834 },
+			{ 180485125580313444, 3542536203014710, 107384231428 },
+			{ 184027769167559582, 3542750971413625, 109478297570 },
+			{ 187570629617270777, 3542969927943580, 111572880196 },
+			{ 191113711118094553, 3543193073637545, 113667989230 },
+			{ 194657017859721328, 3543420409548342, 115763634608 },
+			{ 198200554032904278, 3543651936748655, 117859826282 },
+			{ 201744323829479215, 3543887656331071, 119956574190 },
+			{ 205288331442384476, 3544127569408057, 122053888290 },
+			{ 208832581065680823, 3544371677111996, 124151778532 },
+			{ 212377076894571351, 3544619980595176, 126250254888 },
+			{ 215921823125421415, 3544872481029812, 128349327328 },
+			{ 219466823955778555, 3545129179608082, 130449005816 },
+			{ 223012083584392453, 3545390077542080, 132549300348 },
+			{ 226557606211234881, 3545655176063889, 134650220906 },
+			{ 230103396037519676, 3545924476425570, 136751777476 },
+			{ 233649457265722722, 3546197979899149, 138853980074 },
+			{ 237195794099601945, 3546475687776676, 140956838700 },
+			{ 240742410744217321, 3546757601370198, 143060363376 },
+			{ 244289311405950895, 3547043722011811, 145164564110 },
+			{ 247836500292526816, 3547334051053640, 147269450932 },
+			{ 251383981613031388, 3547628589867865, 149375033878 },
+			{ 254931759577933131, 3547927339846721, 151481323002 },
+			{ 258479838399102854, 3548230302402562, 153588328328 },
+			{ 262028222289833744, 3548537478967801, 155696059930 },
+			{ 265576915464861475, 3548848870994989, 157804527858 },
+			{ 269125922140384322, 3549164479956775, 159913742198 },
+			{ 272675246534083295, 3549484307345976, 162023713016 },
+			{ 276224892865142287, 3549808354675555, 164134450398 },
+			{ 279774865354268240, 3550136623478640, 166245964440 },
+			{ 283325168223711320, 3550469115308544, 168358265248 },
+			{ 286875805697285112, 3550805831738804, 170471362916 },
+			{ 290426782000386832, 3551146774363135, 172585267586 },
+			{ 293978101360017553, 3551491944795529, 174699989358 },
+			{ 297529768004802440, 3551841344670196, 176815538380 },
+			{ 301081786165011016, 3552194975641640, 178931924780 },
+			{ 304634160072577436, 3552552839384620, 181049158724 },
+			{ 308186893961120780, 3552914937594210, 183167250360 },
+			{ 311739992065965350, 3553281271985811, 185286209858 },
+			{ 315293458624161019, 3553651844295129, 187406047398 },
+			{ 318847297874503546, 3554026656278256, 189526773160 },
+			{ 322401514057554962, 3554405709711633, 191648397338 },
+			{ 325956111415663933, 3554789006392090, 193770930140 },
+			{ 329511094192986163, 3555176548136874, 195894381772 },
+			{ 333066466635504809, 3555568336783648, 198018762460 },
+			{ 336622232991050917, 3555964374190513, 200144082434 },
+			{ 340178397509323864, 3556364662236050, 202270351928 },
+			{ 343734964441911842, 3556769202819296, 204397581204 },
+			{ 347291938042312342, 3557177997859805, 206525780514 },
+			{ 350849322565952661, 3557591049297645, 208654960130 },
+			{ 354407122270210436, 3558008359093431, 210785130322 },
+			{ 357965341414434189, 3558429929228319, 212916301394 },
+			{ 361523984259963902, 3558855761704058, 215048483636 },
+			{ 365083055070151596, 3559285858542995, 217181687358 },
+			{ 368642558110381949, 3559720221788084, 219315922888 },
+			{ 372202497648092921, 3560158853502949, 221451200538 },
+			{ 375762877952796408, 3560601755771824, 223587530676 },
+			{ 379323703296098908, 3561048930699680, 225724923632 },
+			{ 382884977951722220, 3561500380412151, 227863389786 },
+			{ 386446706195524157, 3561956107055629, 230002939490 },
+			{ 390008892305519276, 3562416112797224, 232143583148 },
+			{ 393571540561899648, 3562880399824829, 234285331146 },
+			{ 397134655247055623, 3563348970347127, 236428193894 },
+			{ 400698240645596644, 3563821826593615, 238572181806 },
+			{ 404262301044372065, 3564298970814622, 240717305316 },
+			{ 407826840732492003, 3564780405281344, 242863574856 },
+			{ 411391864001348203, 3565266132285848, 245011000888 },
+			{ 414957375144634939, 3565756154141108, 247159593876 },
+			{ 418523378458369923, 3566250473181033, 249309364298 },
+			{ 422089878240915254, 3566749091760481, 251460322638 },
+			{ 425656878792998373, 3567252012255289, 253612479394 },
+			{ 429224384417733056, 3567759237062290, 255765845084 },
+			{ 432792399420640430, 3568270768599353, 257920430222 },
+			{ 436360928109670005, 3568786609305387, 260076245350 },
+			{ 439929974795220742, 3569306761640365, 262233301026 },
+			{ 443499543790162133, 3569831228085365, 264391607814 },
+			{ 447069639409855312, 3570360011142626, 266551176268 },
+			{ 450640265972174206, 3570893113335472, 268712017004 },
+			{ 454211427797526682, 3571430537208454, 270874140604 },
+			{ 457783129208875740, 3571972285327309, 273037557686 },
+			{ 461355374531760735, 3572518360279002, 275202278876 },
+			{ 464928168094318613, 3573068764671747, 277368314818 },
+			{ 468501514227305178, 3573623501135038, 279535676168 },
+			{ 472075417264116384, 3574182572319701, 281704373582 },
+			{ 475649881540809667, 3574745980897854, 283874417756 },
+			{ 479224911396125277, 3575313729563018, 286045819376 },
+			{ 482800511171507671, 3575885821030084, 288218589148 },
+			{ 486376685211126903, 3576462258035355, 290392737806 },
+			{ 489953437861900064, 3577043043336595, 292568276078 },
+			{ 493530773473512737, 3577628179713034, 294745214716 },
+			{ 497108696398440487, 3578217669965400, 296923564488 },
+			{ 500687210991970375, 3578811516915953, 299103336178 },
+			{ 504266321612222506, 3579409723408527, 301284540562 },
+			{ 507846032620171595, 3580012292308530, 303467188464 },
+			{ 511426348379668589, 3580619226502984, 305651290704 },
+			{ 515007273257462277, 3581230528900569, 307836858122 },
+			{ 518588811623220968, 3581846202431638, 310023901572 },
+			{ 522170967849554178, 3582466250048243, 312212431930 },
+			{ 525753746312034351, 3583090674724192, 314402460072 },
+			{ 529337151389218615, 3583719479455054, 316593996892 },
+			{ 532921187462670561, 3584352667258197, 318787053310 },
+			{ 536505858916982068, 3584990241172807, 320981640258 },
+			{ 540091170139795133, 3585632204259958, 323177768672 },
+			{ 543677125521823763, 3586278559602569, 325375449542 },
+			{ 547263729456875874, 3586929310305530, 327574693824 },
+			{ 550850986341875228, 3587584459495681, 329775512510 },
+			{ 554438900576883419, 3588244010321835, 331977916614 },
+			{ 558027476565121868, 3588907965954820, 334181917168 },
+			{ 561616718712993856, 3589576329587533, 336387525214 },
+			{ 565206631430106603, 3590249104434955, 338594751810 },
+			{ 568797219129293368, 3590926293734177, 340803608034 },
+			{ 572388486226635579, 3591607900744457, 343014104978 },
+			{ 575980437141485014, 3592293928747233, 345226253742 },
+			{ 579573076296485989, 3592984381046156, 347440065468 },
+			{ 583166408117597613, 3593679260967132, 349655551296 },
+			{ 586760437034116041, 3594378571858373, 351872722382 },
+			{ 590355167478696796, 3595082317090379, 354091589922 },
+			{ 593950603887377097, 3595790500056057, 356312165086 },
+			{ 597546750699598240, 3596503124170669, 358534459102 },
+			{ 601143612358228011, 3597220192871907, 360758483210 },
+			{ 604741193309583128, 3597941709619944, 362984248648 },
+			{ 608339498003451720, 3598667677897458, 365211766672 },
+			{ 611938530893115850, 3599398101209619, 367441048602 },
+			{ 615538296435374071, 3600132983084216, 369672105716 },
+			{ 619138799090564003, 3600872327071632, 371904949344 },
+			{ 622740043322584979, 3601616136744879, 374139590830 },
+			{ 626342033598920688, 3602364415699678, 376376041528 },
+			{ 629944774390661894, 3603117167554447, 378614312822 },
+			{ 633548270172529163, 3603874395950375, 380854416102 },
+			{ 637152525422895640, 3604636104551441, 383096362786 },
+			{ 640757544623809867, 3605402297044449, 385340164318 },
+			{ 644363332261018634, 3606172977139090, 387585832144 },
+			{ 647969892823989868, 3606948148567946, 389833377744 },
+			{ 651577230805935558, 3607727815086559, 392082812614 },
+			{ 655185350703834731, 3608511980473473, 394334148250 },
+			{ 658794257018456454, 3609300648530220, 396587396208 },
+			{ 662403954254382882, 3610093823081436, 398842568024 },
+			{ 666014446920032342, 3610891507974837, 401099675286 },
+			{ 669625739527682465, 3611693707081303, 403358729574 },
+			{ 673237836593493342, 3612500424294895, 405619742506 },
+			{ 676850742637530743, 3613311663532893, 407882725722 },
+			{ 680464462183789358, 3614127428735854, 410147690872 },
+			{ 684078999760216084, 3614947723867660, 412414649612 },
+			{ 687694359898733356, 3615772552915502, 414683613668 },
+			{ 691310547135262526, 3616601919889987, 416954594750 },
+			{ 694927566009747263, 3617435828825163, 419227604590 },
+			{ 698545421066177016, 3618274283778551, 421502654946 },
+			{ 702164116852610513, 3619117288831170, 423779757612 },
+			{ 705783657921199295, 3619964848087643, 426058924362 },
+			{ 709404048828211300, 3620816965676141, 428340167058 },
+			{ 713025294134054499, 3621673645748538, 430623497508 },
+			{ 716647398403300545, 3622534892480351, 432908927610 },
+			{ 720270366204708506, 3623400710070886, 435196469220 },
+			{ 723894202111248612, 3624271102743162, 437486134284 },
+			{ 727518910700126058, 3625146074744065, 439777934722 },
+			{ 731144496552804845, 3626025630344349, 442071882486 },
+			{ 734770964255031680, 3626909773838655, 444367989566 },
+			{ 738398318396859901, 3627798509545612, 446666267948 },
+			{ 742026563572673461, 3628691841807829, 448966729666 },
+			{ 745655704381210956, 3629589774991971, 451269386766 },
+			{ 749285745425589693, 3630492313488814, 453574251308 },
+			{ 752916691313329815, 3631399461713232, 455881335408 },
+			{ 756548546656378455, 3632311224104328, 458190651168 },
+			{ 760181316071133951, 3633227605125429, 460502210726 },
+			{ 763815004178470106, 3634148609264135, 462816026254 },
+			{ 767449615603760495, 3635074241032359, 465132109950 },
+			{ 771085154976902804, 3636004504966447, 467450473994 },
+			{ 774721626932343245, 3636939405627105, 469771130654 },
+			{ 778359036109101004, 3637878947599537, 472094092178 },
+			{ 781997387150792719, 3638823135493483, 474419370846 },
+			{ 785636684705657048, 3639771973943227, 476746978978 },
+			{ 789276933426579253, 3640725467607681, 479076928902 },
+			{ 792918137971115836, 3641683621170439, 481409232966 },
+			{ 796560303001519241, 3642646439339789, 483743903570 },
+			{ 800203433184762600, 3643613926848785, 486080953122 },
+			{ 803847533192564507, 3644586088455336, 488420394040 },
+			{ 807492607701413883, 3645562928942170, 490762238804 },
+			{ 811138661392594857, 3646544453116957, 493106499890 },
+			{ 814785698952211704, 3647530665812342, 495453189812 },
+			{ 818433725071213858, 3648521571885997, 497802321086 },
+			{ 822082744445420941, 3649517176220634, 500153906300 },
+			{ 825732761775547875, 3650517483724124, 502507958020 },
+			{ 829383781767230019, 3651522499329500, 504864488876 },
+			{ 833035809131048395, 3652532227994997, 507223511518 },
+			{ 836688848582554910, 3653546674704188, 509585038600 },
+			{ 840342904842297698, 3654565844465944, 511949082812 },
+			{ 843997982635846454, 3655589742314547, 514315656874 },
+			{ 847654086693817875, 3656618373309680, 516684773552 },
+			{ 851311221751901107, 3657651742536566, 519056445608 },
+			{ 854969392550883281, 3658689855105961, 521430685846 },
+			{ 858628603836675088, 3659732716154225, 523807507098 },
+			{ 862288860360336411, 3660780330843373, 526186922230 },
+			{ 865950166878102014, 3661832704361176, 528568944088 },
+			{ 869612528151407278, 3662889841921104, 530953585636 },
+			{ 873275948946914018, 3663951748762495, 533340859802 },
+			{ 876940434036536315, 3665018430150583, 535730779538 },
+			{ 880605988197466436, 3666089891376522, 538123357852 },
+			{ 884272616212200810, 3667166137757460, 540518607776 },
+			{ 887940322868566046, 3668247174636605, 542916542354 },
+			{ 891609112959745005, 3669333007383276, 545317174676 },
+			{ 895278991284302957, 3670423641392959, 547720517854 },
+			{ 898949962646213770, 3671519082087346, 550126585040 },
+			{ 902622031854886156, 3672619334914455, 552535389390 },
+			{ 906295203725190001, 3673724405348613, 554946944114 },
+			{ 909969483077482728, 3674834298890559, 557361262446 },
+			{ 913644874737635733, 3675949021067501, 559778357634 },
+			{ 917321383537060868, 3677068577433157, 562198242978 },
+			{ 920999014312737003, 3678192973567836, 564620931796 },
+			{ 924677771907236635, 3679322215078472, 567046437436 },
+			{ 928357661168752543, 3680456307598719, 569474773282 },
+			{ 932038686951124544, 3681595256788985, 571905952746 },
+			{ 935720854113866275, 3682739068336493, 574339989274 },
+			{ 939404167522192042, 3683887747955377, 576776896326 },
+			{ 943088632047043745, 3685041301386686, 579216687424 },
+			{ 946774252565117855, 3686199734398490, 581659376104 },
+			{ 950461033958892449, 3687363052785953, 584104975914 },
+			{ 954148981116654316, 3688531262371336, 586553500476 },
+			{ 957838098932526128, 3689704369004132, 589004963404 },
+			{ 961528392306493664, 3690882378561073, 591459378366 },
+			{ 965219866144433103, 3692065296946225, 593916759058 },
+			{ 968912525358138386, 3693253130091053, 596377119198 },
+			{ 972606374865348637, 3694445883954442, 598840472560 },
+			{ 976301419589775639, 3695643564522841, 601306832926 },
+			{ 979997664461131406, 3696846177810233, 603776214138 },
+			{ 983695114415155777, 3698053729858299, 606248630038 },
+			{ 987393774393644114, 3699266226736420, 608724094512 },
+			{ 991093649344475046, 3700483674541752, 611202621484 },
+			{ 994794744221638282, 3701706079399292, 613684224924 },
+			{ 998497063985262498, 3702933447461964, 616168918820 },
+			{ 1002200613601643282, 3704165784910668, 618656717196 },
+			{ 1005905398043271146, 3705403097954364, 621147634108 },
+			{ 1009611422288859618, 3706645392830116, 623641683660 },
+			{ 1013318691323373394, 3707892675803199, 626138879958 },
+			{ 1017027210138056551, 3709144953167117, 628639237178 },
+			{ 1020736983730460846, 3710402231243700, 631142769520 },
+			{ 1024448017104474066, 3711664516383185, 633649491214 },
+			{ 1028160315270348465, 3712931814964271, 636159416518 },
+			{ 1031873883244729254, 3714204133394180, 638672559744 },
+			{ 1035588726050683178, 3715481478108744, 641188935224 },
+			{ 1039304848717727146, 3716763855572461, 643708557342 },
+			{ 1043022256281856949, 3718051272278609, 646231440478 },
+			{ 1046740953785576036, 3719343734749238, 648757599104 },
+			{ 1050460946277924378, 3720641249535292, 651287047704 },
+			{ 1054182238814507374, 3721943823216725, 653819800770 },
+			{ 1057904836457524869, 3723251462402466, 656355872876 },
+			{ 1061628744275800211, 3724564173730595, 658895278594 },
+			{ 1065353967344809400, 3725881963868334, 661438032572 },
+			{ 1069080510746710306, 3727204839512197, 663984149458 },
+			{ 1072808379570371961, 3728532807387996, 666533643968 },
+			{ 1076537578911403925, 3729865874250962, 669086530832 },
+			{ 1080268113872185719, 3731204046885805, 671642824826 },
+			{ 1083999989561896350, 3732547332106791, 674202540758 },
+			{ 1087733211096543899, 3733895736757782, 676765693500 },
+			{ 1091467783598995181, 3735249267712386, 679332297936 },
+			{ 1095203712199005503, 3736607931873986, 681902368976 },
+			{ 1098941002033248465, 3737971736175802, 684475921608 },
+			{ 1102679658245345875, 3739340687580991, 687052970838 },
+			{ 1106419685985897704, 3740714793082762, 689633531688 },
+			{ 1110161090412512154, 3742094059704355, 692217619270 },
+			{ 1113903876689835779, 3743478494499221, 694805248698 },
+			{ 1117648049989583698, 3744868104551045, 697396435130 },
+			{ 1121393615490569873, 3746262896973832, 699991193784 },
+			{ 1125140578378737489, 3747662878912012, 702589539888 },
+			{ 1128888943847189389, 3749068057540485, 705191488730 },
+			{ 1132638717096218604, 3750478440064727, 707797055634 },
+			{ 1136389903333338965, 3751894033720854, 710406255964 },
+			{ 1140142507773315783, 3753314845775715, 713019105122 },
+			{ 1143896535638196620, 3754740883526961, 715635618562 },
+			{ 1147651992157342143, 3756172154303139, 718255811770 },
+			{ 1151408882567457052, 3757608665463784, 720879700264 },
+			{ 1155167212112621100, 3759050424399472, 723507299616 },
+			{ 1158926986044320188, 3760497438531915, 726138625446 },
+			{ 1162688209621477549, 3761949715314061, 728773693402 },
+			{ 1166450888110485012, 3763407262230164, 731412519176 },
+			{ 1170215026785234352, 3764870086795848, 734055118520 },
+			{ 1173980630927148720, 3766338196558236, 736701507216 },
+			{ 1177747705825214172, 3767811599096024, 739351701064 },
+			{ 1181516256776011260, 3769290302019524, 742005715948 },
+			{ 1185286289083746732, 3770774312970806, 744663567776 },
+			{ 1189057808060285314, 3772263639623740, 747325272496 },
+			{ 1192830819025181550, 3773758289684126, 749990846108 },
+			{ 1196605327305711784, 3775258270889715, 752660304666 },
+			{ 1200381338236906165, 3776763591010406, 755333664228 },
+			{ 1204158857161580799, 3778274257848205, 758010940946 },
+			{ 1207937889430369950, 3779790279237420, 760692150980 },
+			{ 1211718440401758350, 3781311663044676, 763377310556 },
+			{ 1215500515442113582, 3782838417169055, 766066435934 },
+			{ 1219284119925718571, 3784370549542138, 768759543436 },
+			{ 1223069259234804145, 3785908068128186, 771456649384 },
+			{ 1226855938759581715, 3787450980924075, 774157770218 },
+			{ 1230644163898276008, 3788999295959570, 776862922348 },
+			{ 1234433940057157926, 3790553021297274, 779572122284 },
+			{ 1238225272650577484, 3792112165032778, 782285386564 },
+			{ 1242018167100996826, 3793676735294761, 785002731770 },
+			{ 1245812628839023357, 3795246740245073, 787724174530 },
+			{ 1249608663303442960, 3796822188078807, 790449731526 },
+			{ 1253406275941253293, 3798403087024440, 793179419472 },
+			{ 1257205472207697205, 3799989445343877, 795913255150 },
+			{ 1261006257566296232, 3801581271332558, 798651255388 },
+			{ 1264808637488884178, 3803178573319595, 801393437042 },
+			{ 1268612617455640815, 3804781359667821, 804139817022 },
+			{ 1272418202955125658, 3806389638773910, 806890412296 },
+			{ 1276225399484311864, 3808003419068413, 809645239906 },
+			{ 1280034212548620183, 3809622709015981, 812404316878 },
+			{ 1283844647661953042, 3811247517115355, 815167660342 },
+			{ 1287656710346728739, 3812877851899495, 817935287442 },
+			{ 1291470406133915676, 3814513721935690, 820707215396 },
+			{ 1295285740563066762, 3816155135825641, 823483461462 },
+			{ 1299102719182353865, 3817802102205557, 826264042958 },
+			{ 1302921347548602380, 3819454629746294, 829048977236 },
+			{ 1306741631227325910, 3821112727153403, 831838281702 },
+			{ 1310563575792761015, 3822776403167265, 834631973830 },
+			{ 1314387186827902110, 3824445666563181, 837430071118 },
+			{ 1318212469924536409, 3826120526151473, 840232591138 },
+			{ 1322039430683279020, 3827800990777598, 843039551496 },
+			{ 1325868074713608114, 3829487069322224, 845850969864 },
+			{ 1329698407633900202, 3831178770701370, 848666863960 },
+			{ 1333530435071465532, 3832876103866484, 851487251540 },
+			{ 1337364162662583556, 3834579077804541, 854312150446 },
+			{ 1341199596052538543, 3836287701538172, 857141578552 },
+			{ 1345036740895655267, 3838001984125759, 859975553778 },
+			{ 1348875602855334804, 3839721934661559, 862814094098 },
+			{ 1352716187604090461, 3841447562275737, 865657217570 },
+			{ 1356558500823583768, 3843178876134596, 868504942260 },
+			{ 1360402548204660624, 3844915885440565, 871357286318 },
+			{ 1364248335447387507, 3846658599432378, 874214267944 },
+			{ 1368095868261087829, 3848407027385150, 877075905396 },
+			{ 1371945152364378375, 3850161178610521, 879942216966 },
+			{ 1375796193485205862, 3851921062456734, 882813221008 },
+			{ 1379648997360883604, 3853686688308743, 885688935954 },
+			{ 1383503569738128301, 3855458065588320, 888569380280 },
+			{ 1387359916373096901, 3857235203754236, 891454572492 },
+			{ 1391218043031423629, 3859018112302247, 894344531194 },
+			{ 1395077955488257070, 3860806800765323, 897239275018 },
+			{ 1398939659528297411, 3862601278713724, 900138822644 },
+			{ 1402803160945833779, 3864401555755017, 903043192866 },
+			{ 1406668465544781662, 3866207641534403, 905952404450 },
+			{ 1410535579138720515, 3868019545734596, 908866476288 },
+			{ 1414404507550931399, 3869837278076090, 911785427308 },
+			{ 1418275256614434797, 3871660848317247, 914709276474 },
+			{ 1422147832172028518, 3873490266254348, 917638042848 },
+			{ 1426022240076325714, 3875325541721805, 920571745510 },
+			{ 1429898486189793029, 3877166684592189, 923510403638 },
+			{ 1433776576384788856, 3879013704776419, 926454036438 },
+			{ 1437656516543601713, 3880866612223839, 929402663186 },
+			{ 1441538312558488738, 3882725416922339, 932356303222 },
+			{ 1445421970331714299, 3884590128898487, 935314975946 },
+			{ 1449307495775588732, 3886460758217648, 938278700812 },
+			{ 1453194894812507192, 3888337314984091, 941247497346 },
+			{ 1457084173374988629, 3890219809341146, 944221385104 },
+			{ 1460975337405714879, 3892108251471257, 947200383750 },
+			{ 1464868392857569886, 3894002651596185, 950184512962 },
+			{ 1468763345693679033, 3895903019977079, 953173792506 },
+			{ 1472660201887448618, 3897809366914582, 956168242224 },
+			{ 1476558967422605424, 3899721702749032, 959167881980 },
+			{ 1480459648293236436, 3901640037860496, 962172731744 },
+			{ 1484362250503828676, 3903564382668978, 965182811512 },
+			{ 1488266780069309166, 3905494747634479, 968198141358 },
+			{ 1492173243015085003, 3907431143257154, 971218741420 },
+			{ 1496081645377083577, 3909373580077435, 974244631906 },
+			{ 1499991993201792918, 3911322068676149, 977275833078 },
+			{ 1503904292546302145, 3913276619674667, 980312365266 },
+			{ 1507818549478342078, 3915237243734998, 983354248872 },
+			{ 1511734770076325948, 3917203951559981, 986401504334 },
+			{ 1515652960429390263, 3919176753893309, 989454152206 },
+			{ 1519573126637435778, 3921155661519795, 992512213050 },
+			{ 1523495274811168623, 3923140685265387, 995575707530 },
+			{ 1527419411072141540, 3925131835997346, 998644656372 },
+			{ 1531345541552795258, 3927129124624389, 1001719080362 },
+			{ 1535273672396500009, 3929132562096810, 1004799000352 },
+			{ 1539203809757597171, 3931142159406588, 1007884437276 },
+			{ 1543135959801441035, 3933157927587593, 1010975412106 },
+			{ 1547070128704440734, 3935179877715621, 1014071945918 },
+			{ 1551006322654102273, 3937208020908620, 1017174059824 },
+			{ 1554944547849070717, 3939242368326781, 1020281775018 },
+			{ 1558884810499172516, 3941282931172648, 1023395112776 },
+			{ 1562827116825457940, 3943329720691367, 1026514094398 },
+			{ 1566771473060243705, 3945382748170658, 1029638741308 },
+			{ 1570717885447155671, 3947442024941089, 1032769074978 },
+			{ 1574666360241171738, 3949507562376159, 1035905116942 },
+			{ 1578616903708664839, 3951579371892445, 1039046888814 },
+			{ 1582569522127446098, 3953657464949754, 1042194412264 },
+			{ 1586524221786808116, 3955741853051257, 1045347709046 },
+			{ 1590481008987568419, 3957832547743584, 1048506801004 },
+			{ 1594439890042113007, 3959929560617086, 1051671710000 },
+			{ 1598400871274440093, 3962032903305839, 1054842458030 },
+			{ 1602363959020203962, 3964142587487890, 1058019067116 },
+			{ 1606329159626758968, 3966258624885345, 1061201559378 },
+			{ 1610296479453203691, 3968381027264541, 1064389957002 },
+			{ 1614265924870425234, 3970509806436205, 1067584282222 },
+			{ 1618237502261143661, 3972644974255528, 1070784557404 },
+			{ 1622211218019956593, 3974786542622404, 1073990804944 },
+			{ 1626187078553383941, 3976934523481539, 1077203047314 },
+			{ 1630165090279912794, 3979088928822588, 1080421307072 },
+			{ 1634145259630042454, 3981249770680318, 1083645606848 },
+			{ 1638127593046329620, 3983417061134760, 1086875969348 },
+			{ 1642112096983433728, 3985590812311340, 1090112417360 },
+			{ 1646098777908162428, 3987771036381079, 1093354973726 },
+			{ 1650087642299517233, 3989957745560672, 1096603661396 },
+			{ 1654078696648739301, 3992150952112729, 1099858503358 },
+			{ 1658071947459355388, 3994350668345843, 1103119522718 },
+			{ 1662067401247223949, 3996556906614773, 1106386742654 },
+			{ 1666065064540581376, 3998769679320662, 1109660186388 },
+			{ 1670064943880088426, 4000988998911089, 1112939877254 },
+			{ 1674067045818876769, 4003214877880319, 1116225838642 },
+			{ 1678071376922595730, 4005447328769380, 1119518094040 },
+			{ 1682077943769459150, 4007686364166293, 1122816666998 },
+			{ 1686086752950292441, 4009931996706161, 1126121581170 },
+			{ 1690097811068579772, 4012184239071405, 1129432860262 },
+			{ 1694111124740511439, 4014443103991849, 1132750528082 },
+			{ 1698126700595031370, 4016708604244936, 1136074608508 },
+			{ 1702144545273884814, 4018980752655895, 1139405125486 },
+			{ 1706164665431666195, 4021259562097790, 1142742103104 },
+			{ 1710187067735867089, 4023545045491887, 1146085565446 },
+			{ 1714211758866924422, 4025837215807640, 1149435536724 },
+			{ 1718238745518268786, 4028136086062928, 1152792041244 },
+			{ 1722268034396372958, 4030441669324193, 1156155103390 },
+			{ 1726299632220800541, 4032753978706689, 1159524747590 },
+			{ 1730333545724254820, 4035073027374517, 1162900998414 },
+			{ 1734369781652627751, 4037398828540885, 1166283880486 },
+			{ 1738408346765049122, 4039731395468304, 1169673418492 },
+			{ 1742449247833935918, 4042070741468642, 1173069637248 },
+			{ 1746492491645041808, 4044416879903376, 1176472561644 },
+			{ 1750538084997506828, 4046769824183771, 1179882216638 },
+			{ 1754586034703907237, 4049129587771021, 1183298627282 },
+			{ 1758636347590305540, 4051496184176417, 1186721818734 },
+			{ 1762689030496300691, 4053869626961539, 1190151816214 },
+			{ 1766744090275078444, 4056249929738450, 1193588645032 },
+			{ 1770801533793461926, 4058637106169817, 1197032330606 },
+			{ 1774861367931962349, 4061031169969139, 1200482898418 },
+			{ 1778923599584829906, 4063432134900880, 1203940374060 },
+			{ 1782988235660104846, 4065840014780706, 1207404783192 },
+			{ 1787055283079668744, 4068254823475565, 1210876151606 },
+			{ 1791124748779295915, 4070676574904011, 1214354505118 },
+			{ 1795196639708705044, 4073105283036251, 1217839869686 },
+			{ 1799270962831610981, 4075540961894371, 1221332271350 },
+			{ 1803347725125776702, 4077983625552546, 1224831736244 },
+			{ 1807426933583065492, 4080433288137218, 1228338290564 },
+			{ 1811508595209493274, 4082889963827230, 1231851960636 },
+			{ 1815592717025281140, 4085353666854067, 1235372772854 },
+			{ 1819679306064908061, 4087824411502031, 1238900753702 },
+			{ 1823768369377163794, 4090302212108367, 1242435929802 },
+			{ 1827859914025201963, 4092787083063561, 1245978327810 },
+			{ 1831953947086593334, 4095279038811424, 1249527974520 },
+			{ 1836050475653379278, 4097778093849338, 1253084896808 },
+			{ 1840149506832125424, 4100284262728449, 1256649121630 },
+			{ 1844251047743975503, 4102797560053820, 1260220676060 },
+			{ 1848355105524705383, 4105318000484655, 1263799587254 },
+			{ 1852461687324777292, 4107845598734459, 1267385882494 },
+			{ 1856570800309394245, 4110380369571309, 1270979589102 },
+			{ 1860682451658554656, 4112922327817935, 1274580734558 },
+			{ 1864796648567107149, 4115471488352011, 1278189346398 },
+			{ 1868913398244805558, 4118027866106313, 1281805452274 },
+			{ 1873032707916364145, 4120591476068887, 1285429079950 },
+			{ 1877154584821512982, 4123162333283330, 1289060257256 },
+			{ 1881279036215053568, 4125740452848895, 1292699012154 },
+			{ 1885406069366914617, 4128325849920755, 1296345372698 },
+			{ 1889535691562208070, 4130918539710171, 1299999367042 },
+			{ 1893667910101285283, 4133518537484725, 1303661023438 },
+			{ 1897802732299793446, 4136125858568527, 1307330370218 },
+			{ 1901940165488732191, 4138740518342323, 1311007435878 },
+			{ 1906080217014510392, 4141362532243864, 1314692248948 },
+			{ 1910222894239003204, 4143991915767953, 1318384838114 },
+			{ 1914368204539609271, 4146628684466759, 1322085232142 },
+			{ 1918516155309308172, 4149272853950001, 1325793459890 },
+			{ 1922666753956718063, 4151924439885110, 1329509550344 },
+			{ 1926820007906153517, 4154583457997499, 1333233532590 },
+			{ 1930975924597683606, 4157249924070720, 1336965435828 },
+			{ 1935134511487190154, 4159923853946744, 1340705289340 },
+			{ 1939295776046426238, 4162605263526121, 1344453122534 },
+			{ 1943459725763074893, 4165294168768190, 1348208964920 },
+			{ 1947626368140808003, 4167990585691327, 1351972846130 },
+			{ 1951795710699345460, 4170694530373153, 1355744795886 },
+			{ 1955967760974514499, 4173406018950750, 1359524844008 },
+			{ 1960142526518309257, 4176125067620850, 1363313020468 },
+			{ 1964320014898950575, 4178851692640097, 1367109355310 },
+			{ 1968500233700945982, 4181585910325255, 1370913878702 },
+			{ 1972683190525149939, 4184327737053402, 1374726620928 },
+			{ 1976868892988824269, 4187077189262205, 1378547612366 },
+			{ 1981057348725698840, 4189834283450067, 1382376883546 },
+			{ 1985248565386032453, 4192599036176447, 1386214465066 },
+			{ 1989442550636673966, 4195371464062014, 1390060387652 },
+			{ 1993639312161123632, 4198151583788891, 1393914682158 },
+			{ 1997838857659594681, 4200939412100908, 1397777379532 },
+			{ 2002041194849075121, 4203734965803775, 1401648510862 },
+			{ 2006246331463389758, 4206538261765401, 1405528107310 },
+			{ 2010454275253262469, 4209349316916015, 1409416200214 },
+			{ 2014665033986378698, 4212168148248501, 1413312820974 },
+			{ 2018878615447448173, 4214994772818551, 1417218001142 },
+			{ 2023095027438267866, 4217829207744972, 1421131772368 },
+			{ 2027314277777785206, 4220671470209859, 1425054166422 },
+			{ 2031536374302161487, 4223521577458869, 1428985215202 },
+			{ 2035761324864835558, 4226379546801426, 1432924950728 },
+			{ 2039989137336587712, 4229245395611011, 1436873405134 },
+			{ 2044219819605603857, 4232119141325361, 1440830610662 },
+			{ 2048453379577539880, 4235000801446725, 1444796599690 },
+			{ 2052689825175586295, 4237890393542088, 1448771404732 },
+			{ 2056929164340533115, 4240787935243429, 1452755058410 },
+			{ 2061171405030834954, 4243693444248026, 1456747593436 },
+			{ 2065416555222676416, 4246606938318560, 1460749042708 },
+			{ 2069664622910037684, 4249528435283509, 1464759439202 },
+			{ 2073915616104760395, 4252457953037288, 1468778816048 },
+			{ 2078169542836613731, 4255395509540590, 1472807206472 },
+			{ 2082426411153360793, 4258341122820572, 1476844643840 },
+			{ 2086686229120825205, 4261294810971081, 1480891161674 },
+			{ 2090949004822957960, 4264256592153056, 1484946793560 },
+			{ 2095214746361904576, 4267226484594569, 1489011573274 },
+			{ 2099483461858072419, 4270204506591273, 1493085534674 },
+			{ 2103755159450198366, 4273190676506534, 1497168711784 },
+			{ 2108029847295416684, 4276185012771744, 1501261138736 },
+			{ 2112307533569327164, 4279187533886554, 1505362849816 },
+			{ 2116588226466063534, 4282198258419202, 1509473879384 },
+			{ 2120871934198362120, 4285217205006676, 1513594261992 },
+			{ 2125158664997630788, 4288244392355030, 1517724032308 },
+			{ 2129448427114018126, 4291279839239651, 1521863225122 },
+			{ 2133741228816482899, 4294323564505532, 1526011875360 },
+			{ 2138037078392863791, 4297375587067499, 1530170018090 },
+			{ 2142335984149949380, 4300435925910529, 1534337688506 },
+			{ 2146637954413548415, 4303504600089963, 1538514921962 },
+			{ 2150942997528560340, 4306581628731849, 1542701753910 },
+			{ 2155251121859046099, 4309667031033178, 1546898219944 },
+			{ 2159562335788299221, 4312760826262096, 1551104355848 },
+			{ 2163876647718917165, 4315863033758319, 1555320197470 },
+			{ 2168194066072872954, 4318973672933277, 1559545780850 },
+			{ 2172514599291587081, 4322092763270465, 1563781142138 },
+			{ 2176838255835999684, 4325220324325687, 1568026317654 },
+			{ 2181165044186643025, 4328356375727368, 1572281343828 },
+			{ 2185494972843714221, 4331500937176818, 1576546257248 },
+			{ 2189828050327148287, 4334654028448511, 1580821094630 },
+			{ 2194164285176691428, 4337815669390367, 1585105892870 },
+			{ 2198503685951974665, 4340985879924053, 1589400688966 },
+			{ 2202846261232587684, 4344164680045291, 1593705520074 },
+			{ 2207192019618153049, 4347352089824069, 1598020423514 },
+			{ 2211540969728400632, 4350548129405028, 1602345436716 },
+			{ 2215893120203242376, 4353752819007689, 1606680597290 },
+			{ 2220248479702847355, 4356966178926764, 1611025942976 },
+			{ 2224607056907717095, 4360188229532459, 1615381511662 },
+			{ 2228968860518761216, 4363418991270763, 1619747341394 },
+			{ 2233333899257373373, 4366658484663743, 1624123470354 },
+			{ 2237702181865507470, 4369906730309867, 1628509936878 },
+			{ 2242073717105754215, 4373163748884222, 1632906779488 },
+			{ 2246448513761417925, 4376429561138944, 1637314036808 },
+			{ 2250826580636593677, 4379704187903437, 1641731747622 },
+			{ 2255207926556244736, 4382987650084686, 1646159950896 },
+			{ 2259592560366280318, 4386279968667577, 1650598685730 },
+			{ 2263980490933633625, 4389581164715213, 1655047991366 },
+			{ 2268371727146340204, 4392891259369198, 1659507907236 },
+			{ 2272766277913616638, 4396210273849953, 1663978472910 },
+			{ 2277164152165939501, 4399538229457091, 1668459728086 },
+			{ 2281565358855124678, 4402875147569607, 1672951712682 },
+			{ 2285969906954406967, 4406221049646300, 1677454466740 },
+			{ 2290377805458520007, 4409575957226053, 1681968030450 },
+			{ 2294789063383776510, 4412939891928171, 1686492444174 },
+			{ 2299203689768148855, 4416312875452660, 1691027748440 },
+			{ 2303621693671349955, 4419694929580583, 1695573983926 },
+			{ 2308043084174914464, 4423086076174375, 1700131191486 },
+			{ 2312467870382280325, 4426486337178148, 1704699412148 },
+			{ 2316896061418870621, 4429895734618070, 1709278687060 },
+			{ 2321327666432175751, 4433314290602652, 1713869057572 },
+			{ 2325762694591835975, 4436742027323060, 1718470565204 },
+			{ 2330201155089724239, 4440178967053505, 1723083251614 },
+			{ 2334643057140029358, 4443625132151537, 1727707158646 },
+			{ 2339088409979339541, 4447080545058371, 1732342328318 },
+			{ 2343537222866726230, 4450545228299260, 1736988802808 },
+			{ 2347989505083828298, 4454019204483820, 1741646624440 },
+			{ 2352445265934936558, 4457502496306328, 1746315835768 },
+			{ 2356904514747078654, 4460995126546146, 1750996479460 },
+			{ 2361367260870104260, 4464497118067977, 1755688598398 },
+			{ 2365833513676770635, 4468008493822286, 1760392235600 },
+			{ 2370303282562828521, 4471529276845587, 1765107434298 },
+			{ 2374776576947108406, 4475059490260835, 1769834237858 },
+			{ 2379253406271607099, 4478599157277757, 1774572689846 },
+			{ 2383733780001574702, 4482148301193193, 1779322834010 },
+			{ 2388217707625601905, 4485706945391455, 1784084714278 },
+			{ 2392705198655707638, 4489275113344733, 1788858374718 },
+			{ 2397196262627427089, 4492852828613357, 1793643859638 },
+			{ 2401690909099900084, 4496440114846239, 1798441213482 },
+			{ 2406189147655959805, 4500036995781205, 1803250480886 },
+			{ 2410690987902221896, 4503643495245368, 1808071706656 },
+			{ 2415196439469173920, 4507259637155440, 1812904935816 },
+			{ 2419705512011265176, 4510885445518173, 1817750213554 },
+			{ 2424218215206996903, 4514520944430699, 1822607585230 },
+			{ 2428734558759012832, 4518166158080857, 1827477096422 },
+			{ 2433254552394190111, 4521821110747672, 1832358792856 },
+			{ 2437778205863730639, 4525485826801601, 1837252720466 },
+			{ 2442305528943252706, 4529160330704988, 1842158925392 },
+			{ 2446836531432883086, 4532844647012415, 1847077453946 },
+			{ 2451371223157349447, 4536538800371123, 1852008352614 },
+			{ 2455909613966073184, 4540242815521316, 1856951668108 },
+			{ 2460451713733262608, 4543956717296629, 1861907447306 },
+			{ 2464997532358006543, 4547680530624434, 1866875737296 },
+			{ 2469547079764368273, 4551414280526292, 1871856585356 },
+			{ 2474100365901479921, 4555157992118332, 1876850038940 },
+			{ 2478657400743637193, 4558911690611573, 1881856145746 },
+			{ 2483218194290394512, 4562675401312429, 1886874953618 },
+			{ 2487782756566660559, 4566449149623017, 1891906510630 },
+			{ 2492351097622794206, 4570232961041576, 1896950865056 },
+			{ 2496923227534700838, 4574026861162925, 1902008065342 },
+			{ 2501499156403929105, 4577830875678737, 1907078160178 },
+			{ 2506078894357768020, 4581645030378105, 1912161198406 },
+			{ 2510662451549344531, 4585469351147788, 1917257229124 },
+			{ 2515249838157721443, 4589303863972724, 1922366301612 },
+			{ 2519841064387995779, 4593148594936432, 1927488465332 },
+			{ 2524436140471397543, 4597003570221358, 1932623769992 },
+			{ 2529035076665388893, 4600868816109357, 1937772265486 },
+			{ 2533637883253763736, 4604744358982080, 1942934001920 },
+			{ 2538244570546747736, 4608630225321374, 1948109029624 },
+			{ 2542855148881098734, 4612526441709736, 1953297399136 },
+			{ 2547469628620207606, 4616433034830747, 1958499161166 },
+			{ 2552088020154199519, 4620350031469448, 1963714366692 },
+			{ 2556710333900035659, 4624277458512773, 1968943066878 },
+			{ 2561336580301615310, 4628215342950053, 1974185313098 },
+			{ 2565966769829878461, 4632163711873313, 1979441156978 },
+			{ 2570600912982908752, 4636122592477837, 1984710650326 },
+			{ 2575239020286036915, 4640092012062531, 1989993845182 },
+			{ 2579881102291944628, 4644071998030388, 1995290793796 },
+			{ 2584527169580768812, 4648062577888897, 2000601548662 },
+			{ 2589177232760206371, 4652063779250536, 2005926162456 },
+			{ 2593831302465619363, 4656075629833153, 2011264688138 },
+			{ 2598489389360140654, 4660098157460469, 2016617178834 },
+			{ 2603151504134779957, 4664131390062486, 2021983687944 },
+			{ 2607817657508530387, 4668175355676004, 2027364269028 },
+			{ 2612487860228475419, 4672230082444967, 2032758975950 },
+			{ 2617162123069896336, 4676295598621003, 2038167862770 },
+			{ 2621840456836380109, 4680371932563876, 2043590983768 },
+			{ 2626522872359927753, 4684459112741911, 2049028393466 },
+			{ 2631209380501063130, 4688557167732483, 2054480146626 },
+			{ 2635899992148942239, 4692666126222472, 2059946298232 },
+			{ 2640594718221462943, 4696786017008751, 2065426903498 },
+			{ 2645293569665375192, 4700916868998631, 2070922017886 },
+			{ 2649996557456391709, 4705058711210318, 2076431697108 },
+			{ 2654703692599299135, 4709211572773441, 2081955997098 },
+			{ 2659414986128069674, 4713375482929501, 2087494974026 },
+			{ 2664130449105973201, 4717550471032359, 2093048684306 },
+			{ 2668850092625689866, 4721736566548674, 2098617184620 },
+			{ 2673573927809423160, 4725933799058488, 2104200531840 },
+			{ 2678301965809013488, 4730142198255595, 2109798783142 },
+			{ 2683034217806052225, 4734361793948115, 2115411995914 },
+			{ 2687770695011996254, 4738592616058938, 2121040227816 },
+			{ 2692511408668283008, 4742834694626322, 2126683536696 },
+			{ 2697256370046446026, 4747088059804179, 2132341980754 },
+			{ 2702005590448230959, 4751352741862832, 2138015618336 },
+			{ 2706759081205712127, 4755628771189306, 2143704508124 },
+			{ 2711516853681409557, 4759916178287991, 2149408708990 },
+			{ 2716278919268406538, 4764214993780997, 2155128280138 },
+			{ 2721045289390467673, 4768525248408829, 2160863280946 },
+			{ 2725815975502157448, 4772846973030803, 2166613771086 },
+			{ 2730590989088959337, 4777180198625557, 2172379810498 },
+			{ 2735370341667395392, 4781524956291592, 2178161459388 },
+			{ 2740154044785146372, 4785881277247839, 2183958778190 },
+			{ 2744942110021172401, 4790249192834080, 2189771827648 },
+			{ 2749734548985834129, 4794628734511590, 2195600668724 },
+			{ 2754531373321014443, 4799019933863594, 2201445362676 },
+			{ 2759332594700240713, 4803422822595794, 2207305971036 },
+			{ 2764138224828807543, 4807837432536970, 2213182555584 },
+			{ 2768948275443900097, 4812263795639467, 2219075178370 },
+			{ 2773762758314717934, 4816701943979743, 2224983901726 },
+			{ 2778581685242599403, 4821151909758897, 2230908788290 },
+			{ 2783405068061146590, 4825613725303280, 2236849900908 },
+			{ 2788232918636350778, 4830087423064984, 2242807302744 },
+			{ 2793065248866718506, 4834573035622413, 2248781057238 },
+			{ 2797902070683398157, 4839070595680845, 2254771228090 },
+			{ 2802743396050307092, 4843580136072978, 2260777879312 },
+			{ 2807589236964259382, 4848101689759504, 2266801075180 },
+			{ 2812439605455094066, 4852635289829662, 2272840880252 },
+			{ 2817294513585803980, 4857180969501854, 2278897359360 },
+			{ 2822153973452665194, 4861738762124090, 2284970577672 },
+			{ 2827017997185366956, 4866308701174755, 2291060600574 },
+			{ 2831886596947142285, 4870890820263002, 2297167493792 },
+			{ 2836759784934899079, 4875485153129418, 2303291323340 },
+			{ 2841637573379351837, 4880091733646623, 2309432155506 },
+			{ 2846519974545153966, 4884710595819805, 2315590056886 },
+			{ 2851407000731030657, 4889341773787375, 2321765094354 },
+			{ 2856298664269912386, 4893985301821453, 2327957335114 },
+			{ 2861194977529068953, 4898641214328598, 2334166846632 },
+			{ 2866095952910244183, 4903309545850295, 2340393696710 },
+			{ 2871001602849791188, 4907990331063620, 2346637953420 },
+			{ 2875911939818808228, 4912683604781800, 2352899685184 },
+			{ 2880826976323275212, 4917389401954876, 2359178960680 },
+			{ 2885746724904190768, 4922107757670307, 2365475848894 },
+			{ 2890671198137709969, 4926838707153501, 2371790419170 },
+			{ 2895600408635282640, 4931582285768525, 2378122741134 },
+			{ 2900534369043792299, 4936338529018709, 2384472884718 },
+			{ 2905473092045695726, 4941107472547262, 2390840920168 },
+			{ 2910416590359163156, 4945889152137873, 2397226918062 },
+			{ 2915364876738219091, 4950683603715382, 2403630949280 },
+			{ 2920317963972883753, 4955490863346415, 2410053085034 },
+			{ 2925275864889315202, 4960310967239976, 2416493396840 },
+			{ 2930238592349952018, 4965143951748168, 2422951956532 },
+			{ 2935206159253656718, 4969989853366729, 2429428836322 },
+			{ 2940178578535859769, 4974848708735767, 2435924108702 },
+			{ 2945155863168704238, 4979720554640421, 2442437846482 },
+			{ 2950138026161191141, 4984605428011470, 2448970122812 },
+			{ 2955125080559325423, 4989503365925981, 2455521011198 },
+			{ 2960117039446262602, 4994414405608019, 2462090585450 },
+			{ 2965113915942456071, 4999338584429284, 2468678919732 },
+			{ 2970115723205805087, 5004275939909787, 2475286088550 },
+			{ 2975122474431803424, 5009226509718521, 2481912166730 },
+			{ 2980134182853688675, 5014190331674197, 2488557229418 },
+			{ 2985150861742592290, 5019167443745794, 2495221352160 },
+			{ 2990172524407690244, 5024157884053371, 2501904610806 },
+			{ 2995199184196354421, 5029161690868689, 2508607081562 },
+			{ 3000230854494304672, 5034178902615918, 2515328840984 },
+			{ 3005267548725761574, 5039209557872363, 2522069965966 },
+			{ 3010309280353599903, 5044253695369095, 2528830533778 },
+			{ 3015356062879502776, 5049311353991734, 2535610622012 },
+			{ 3020407909844116522, 5054382572781079, 2542410308666 },
+			{ 3025464834827206267, 5059467390933898, 2549229672032 },
+			{ 3030526851447812197, 5064565847803586, 2556068790804 },
+			{ 3035593973364406587, 5069677982900924, 2562927744008 },
+			{ 3040666214275051519, 5074803835894739, 2569806611078 },
+			{ 3045743587917557336, 5079943446612680, 2576705471796 },
+			{ 3050826108069641812, 5085096855042007, 2583624406258 },
+			{ 3055913788549090077, 5090264101330190, 2590563495004 },
+			{ 3061006643213915271, 5095445225785720, 2597522818920 },
+			{ 3066104685962519911, 5100640268878918, 2604502459244 },
+			{ 3071207930733858073, 5105849271242533, 2611502497618 },
+			{ 3076316391507598224, 5111072273672641, 2618523016042 },
+			{ 3081430082304286907, 5116309317129272, 2625564096936 },
+			{ 3086549017185513115, 5121560442737307, 2632625823030 },
+			{ 3091673210254073452, 5126825691787124, 2639708277496 },
+			{ 3096802675654138072, 5132105105735401, 2646811543882 },
+			{ 3101937427571417355, 5137398726205914, 2653935706116 },
+			{ 3107077480233329385, 5142706594990342, 2661080848488 },
+			{ 3112222847909168215, 5148028754048895, 2668247055754 },
+			{ 3117373544910272864, 5153365245511305, 2675434412998 },
+			{ 3122529585590197167, 5158716111677494, 2682643005704 },
+			{ 3127690984344880365, 5164081395018365, 2689872919806 },
+			{ 3132857755612818536, 5169461138176609, 2697124241622 },
+			{ 3138029913875236767, 5174855383967612, 2704397057816 },
+			{ 3143207473656262195, 5180264175380110, 2711691455524 },
+			{ 3148390449523097829, 5185687555577056, 2719007522272 },
+			{ 3153578856086197157, 5191125567896477, 2726345346002 },
+			{ 3158772707999439636, 5196578255852273, 2733705015034 },
+			{ 3163972019960306943, 5202045663134991, 2741086618150 },
+			{ 3169176806710060084, 5207527833612778, 2748490244492 },
+			{ 3174387083033917354, 5213024811332026, 2755915983696 },
+			{ 3179602863761233076, 5218536640518395, 2763363925770 },
+			{ 3184824163765677241, 5224063365577584, 2770834161136 },
+			{ 3190050997965415961, 5229605031096121, 2778326780694 },
+			{ 3195283381323292776, 5235161681842344, 2785841875712 },
+			{ 3200521328847010832, 5240733362767141, 2793379537946 },
+			{ 3205764855589315919, 5246320119004840, 2800939859572 },
+			{ 3211013976648180331, 5251921995874171, 2808522933158 },
+			{ 3216268707166987660, 5257539038879013, 2816128851758 },
+			{ 3221529062334718431, 5263171293709348, 2823757708840 },
+			{ 3226795057386136619, 5268818806242090, 2831409598336 },
+			{ 3232066707601977045, 5274481622542012, 2839084614624 },
+			{ 3237344028309133681, 5280159788862629, 2846782852526 },
+			{ 3242627034880848836, 5285853351647108, 2854504407304 },
+			{ 3247915742736903248, 5291562357529139, 2862249374682 },
+			{ 3253210167343807069, 5297286853333865, 2870017850846 },
+			{ 3258510324214991780, 5303026886078818, 2877809932412 },
+			{ 3263816228911003010, 5308782502974731, 2885625716522 },
+			{ 3269127897039694263, 5314553751426634, 2893465300704 },
+			{ 3274445344256421601, 5320340679034630, 2901328783008 },
+			{ 3279768586264239239, 5326143333594891, 2909216261934 },
+			{ 3285097638814096064, 5331961763100616, 2917127836448 },
+			{ 3290432517705033128, 5337796015742893, 2925063606030 },
+			{ 3295773238784382051, 5343646139911798, 2933023670560 },
+			{ 3301119817947964409, 5349512184197198, 2941008130452 },
+			{ 3306472271140292059, 5355394197389757, 2949017086622 },
+			{ 3311830614354768438, 5361292228481967, 2957050640418 },
+			{ 3317194863633890823, 5367206326668999, 2965108893746 },
+			{ 3322565035069453568, 5373136541349838, 2973191948904 },
+			{ 3327941144802752310, 5379082922128127, 2981299908770 },
+			{ 3333323209024789207, 5385045518813182, 2989432876688 },
+			{ 3338711243976479077, 5391024381421065, 2997590956498 },
+			{ 3344105265948856640, 5397019560175483, 3005774252546 },
+			{ 3349505291283284669, 5403031105508865, 3013982869682 },
+			{ 3354911336371663216, 5409059068063326, 3022216913268 },
+			{ 3360323417656639810, 5415103498691699, 3030476489194 },
+			{ 3365741551631820703, 5421164448458586, 3038761703828 },
+			{ 3371165754841983117, 5427241968641332, 3047072664080 },
+			{ 3376596043883288529, 5433336110731122, 3055409477368 },
+			{ 3382032435403497019, 5439446926433956, 3063772251636 },
+			{ 3387474946102182611, 5445574467671751, 3072161095362 },
+			{ 3392923592730949724, 5451718786583328, 3080576117564 },
+			{ 3398378392093650616, 5457879935525593, 3089017427734 },
+			{ 3403839361046603943, 5464057967074402, 3097485135996 },
+			{ 3409306516498814341, 5470252934025873, 3105979352906 },
+			{ 3414779875412193120, 5476464889397236, 3114500189656 },
+			{ 3420259454801780012, 5482693886428097, 3123047757898 },
+			{ 3425745271735966007, 5488939978581399, 3131622169902 },
+			{ 3431237343336717308, 5495203219544564, 3140223538468 },
+			{ 3436735686779800340, 5501483663230641, 3148851976914 },
+			{ 3442240319295007895, 5507781363779341, 3157507599162 },
+			{ 3447751258166386398, 5514096375558194, 3166190519656 },
+			{ 3453268520732464248, 5520428753163629, 3174900853450 },
+			{ 3458792124386481327, 5526778551422171, 3183638716122 },
+			{ 3464322086576619620, 5533145825391505, 3192404223846 },
+			{ 3469858424806234971, 5539530630361654, 3201197493360 },
+			{ 3475401156634089985, 5545933021856141, 3210018641966 },
+			{ 3480950299674588092, 5552353055633061, 3218867787594 },
+			{ 3486505871598008747, 5558790787686391, 3227745048682 },
+			{ 3492067890130743820, 5565246274246977, 3236650544326 },
+			{ 3497636373055535123, 5571719571783856, 3245584394184 },
+			{ 3503211338211713163, 5578210737005380, 3254546718484 },
+			{ 3508792803495437027, 5584719826860358, 3263537638108 },
+			{ 3514380786859935493, 5591246898539364, 3272557274484 },
+			{ 3519975306315749341, 5597792009475807, 3281605749682 },
+			{ 3525576379930974830, 5604355217347271, 3290683186350 },
+			{ 3531184025831508451, 5610936580076643, 3299789707750 },
+			{ 3536798262201292844, 5617536155833310, 3308925437820 },
+			{ 3542419107282563974, 5624154003034501, 3318090501042 },
+			{ 3548046579376099517, 5630790180346443, 3327285022554 },
+			{ 3553680696841468514, 5637444746685657, 3336509128094 },
+			{ 3559321478097282265, 5644117761220112, 3345762944084 },
+			{ 3564968941621446461, 5650809283370622, 3355046597524 },
+			{ 3570623105951414607, 5657519372812016, 3364360216072 },
+			{ 3576283989684442695, 5664248089474438, 3373703928040 },
+			{ 3581951611477845173, 5670995493544637, 3383077862366 },
+			{ 3587625990049252176, 5677761645467262, 3392482148648 },
+			{ 3593307144176868086, 5684546605946128, 3401916917148 },
+			{ 3598995092699731362, 5691350435945588, 3411382298736 },
+			{ 3604689854517975686, 5698173196691735, 3420878425022 },
+			{ 3610391448593092443, 5705014949673877, 3430405428190 },
+			{ 3616099893948194510, 5711875756645710, 3439963441152 },
+			{ 3621815209668281372, 5718755679626738, 3449552597496 },
+			{ 3627537414900505606, 5725654780903612, 3459173031452 },
+			{ 3633266528854440670, 5732573123031483, 3468824877946 },
+			{ 3639002570802350099, 5739510768835351, 3478508272582 },
+			{ 3644745560079458032, 5746467781411412, 3488223351672 },
+			{ 3650495516084221116, 5753444224128486, 3497970252200 },
+			{ 3656252458278601802, 5760440160629359, 3507749111858 },
+			{ 3662016406188343019, 5767455654832225, 3517560069022 },
+			{ 3667787379403244266, 5774490770931988, 3527403262812 },
+			{ 3673565397577439066, 5781545573401805, 3537278833026 },
+			{ 3679350480429673897, 5788620126994431, 3547186920158 },
+			{ 3685142647743588486, 5795714496743630, 3557127665464 },
+			{ 3690941919367997580, 5802828747965653, 3567101210894 },
+			{ 3696748315217174127, 5809962946260650, 3577107699144 },
+			{ 3702561855271133921, 5817117157514166, 3587147273616 },
+			{ 3708382559575921703, 5824291447898543, 3597220078470 },
+			{ 3714210448243898716, 5831485883874467, 3607326258574 },
+			{ 3720045541454031757, 5838700532192370, 3617465959576 },
+			{ 3725887859452183703, 5845935459893928, 3627639327880 },
+			{ 3731737422551405511, 5853190734313648, 3637846510596 },
+			{ 3737594251132229755, 5860466423080276, 3648087655616 },
+			{ 3743458365642965647, 5867762594118318, 3658362911628 },
+			{ 3749329786599995593, 5875079315649648, 3668672428028 },
+			{ 3755208534588073269, 5882416656194953, 3679016355018 },
+			{ 3761094630260623240, 5889774684575316, 3689394843576 },
+			{ 3766988094340042132, 5897153469913785, 3699808045438 },
+			{ 3772888947618001355, 5904553081636869, 3710256113166 },
+			{ 3778797210955751390, 5911973589476191, 3720739200090 },
+			{ 3784712905284427671, 5919415063470021, 3731257460322 },
+			{ 3790636051605358014, 5926877573964900, 3741811048780 },
+			{ 3796566670990371694, 5934361191617199, 3752400121202 },
+			{ 3802504784582110095, 5941865987394717, 3763024834150 },
+			{ 3808450413594338962, 5949392032578426, 3773685344944 },
+			{ 3814403579312262332, 5956939398763897, 3784381811802 },
+			{ 3820364303092838031, 5964508157863148, 3795114393700 },
+			{ 3826332606365094879, 5972098382106159, 3805883250462 },
+			{ 3832308510630451500, 5979710144042563, 3816688542782 },
+			{ 3838292037463036845, 5987343516543358, 3827530432132 },
+			{ 3844283208510012335, 5994998572802517, 3838409080906 },
+			{ 3850282045491895758, 6002675386338751, 3849324652274 },
+			{ 3856288570202886783, 6010374030997192, 3860277310292 },
+			{ 3862302804511194267, 6018094580951008, 3871267219928 },
+			{ 3868324770359365203, 6025837110703305, 3882294546930 },
+			{ 3874354489764615438, 6033601695088712, 3893359457972 },
+			{ 3880391984819162122, 6041388409275210, 3904462120576 },
+			{ 3886437277690557908, 6049197328765798, 3915602703196 },
+			{ 3892490390622026902, 6057028529400401, 3926781375090 },
+			{ 3898551345932802393, 6064882087357458, 3937998306508 },
+			{ 3904620166018466359, 6072758079155926, 3949253668496 },
+			{ 3910696873351290781, 6080656581656834, 3960547633124 },
+			{ 3916781490480580739, 6088577672065305, 3971880373294 },
+			{ 3922874040033019338, 6096521427932316, 3983252062800 },
+			{ 3928974544713014454, 6104487927156434, 3994662876436 },
+			{ 3935083027303047324, 6112477247985804, 4006112989860 },
+			{ 3941199510664022988, 6120489469019899, 4017602579690 },
+			{ 3947324017735622577, 6128524669211410, 4029131823504 },
+			{ 3953456571536657491, 6136582927868170, 4040700899784 },
+			{ 3959597195165425445, 6144664324654997, 4052309987994 },
+			{ 3965745911800068436, 6152768939595616, 4063959268516 },
+			{ 3971902744698932568, 6160896853074563, 4075648922754 },
+			{ 3978067717200929885, 6169048145839124, 4087379133012 },
+			{ 3984240852725902021, 6177222899001248, 4099150082632 },
+			{ 3990422174774985901, 6185421194039529, 4110961955910 },
+			{ 3996611706930981340, 6193643112801116, 4122814938132 },
+			{ 4002809472858720588, 6201888737503804, 4134709215556 },
+			{ 4009015496305439948, 6210158150737867, 4146644975482 },
+			{ 4015229801101153297, 6218451435468167, 4158622406170 },
+			{ 4021452411159027634, 6226768675036116, 4170641696936 },
+			{ 4027683350475760686, 6235109953161743, 4182703038070 },
+			{ 4033922643131960499, 6243475353945664, 4194806620948 },
+			{ 4040170313292527111, 6251864961871227, 4206952637894 },
+			{ 4046426385207036232, 6260278861806473, 4219141282358 },
+			{ 4052690883210125063, 6268717139006263, 4231372748790 },
+			{ 4058963831721880116, 6277179879114423, 4243647232678 },
+			{ 4065245255248227217, 6285667168165721, 4255964930610 },
+			{ 4071535178381323548, 6294179092588099, 4268326040206 },
+			{ 4077833625799951853, 6302715739204749, 4280730760158 },
+			{ 4084140622269916760, 6311277195236273, 4293179290238 },
+			{ 4090456192644443271, 6319863548302783, 4305671831342 },
+			{ 4096780361864577396, 6328474886426187, 4318208585398 },
+			{ 4103113154959588981, 6337111298032247, 4330789755482 },
+			{ 4109454597047376710, 6345772871952869, 4343415545758 },
+			{ 4115804713334875337, 6354459697428326, 4356086161460 },
+			{ 4122163529118465123, 6363171864109332, 4368801809044 },
+			{ 4128531069784383499, 6371909462059481, 4381562696002 },
+			{ 4134907360809138982, 6380672581757409, 4394369030998 },
+			{ 4141292427759927389, 6389461314099007, 4407221023850 },
+			{ 4147686296295050246, 6398275750399861, 4420118885470 },
+			{ 4154088992164335577, 6407115982397389, 4433062827990 },
+			{ 4160500541209560956, 6415982102253226, 4446053064688 },
+			{ 4166920969364878870, 6424874202555589, 4459089809998 },
+			{ 4173350302657244457, 6433792376321526, 4472173279556 },
+			{ 4179788567206845539, 6442736716999413, 4485303690138 },
+			{ 4186235789227535090, 6451707318471144, 4498481259796 },
+			{ 4192691995027266030, 6460704275054692, 4511706207708 },
+			{ 4199157211008528430, 6469727681506429, 4524978754294 },
+			{ 4205631463668789153, 6478777633023557, 4538299121174 },
+			{ 4212114779600933884, 6487854225246528, 4551667531244 },
+			{ 4218607185493711656, 6496957554261540, 4565084208572 },
+			{ 4225108708132181768, 6506087716602990, 4578549378484 },
+			{ 4231619374398163242, 6515244809255866, 4592063267624 },
+			{ 4238139211270686732, 6524428929658439, 4605626103782 },
+			{ 4244668245826448953, 6533640175704618, 4619238116076 },
+			{ 4251206505240269647, 6542878645746502, 4632899534912 },
+			{ 4257754016785551061, 6552144438597020, 4646610591932 },
+			{ 4264310807834740013, 6561437653532381, 4660371520114 },
+			{ 4270876905859792508, 6570758390294723, 4674182553726 },
+			{ 4277452338432640957, 6580106749094767, 4688043928278 },
+			{ 4284037133225664002, 6589482830614232, 4701955880736 },
+			{ 4290631318012158970, 6598886736008722, 4715918649248 },
+			{ 4297234920666816940, 6608318566910231, 4729932473358 },
+			{ 4303847969166200529, 6617778425429782, 4743997593976 },
+			{ 4310470491589224287, 6627266414160188, 4758114253352 },
+			{ 4317102516117637827, 6636782636178810, 4772282695032 },
+			{ 4323744071036511669, 6646327195050091, 4786503164018 },
+			{ 4330395184734725778, 6655900194828487, 4800775906638 },
+			{ 4337055885705460903, 6665501740061076, 4815101170644 },
+			{ 4343726202546692623, 6675131935790434, 4829479205164 },
+			{ 4350406163961688221, 6684790887557420, 4843910260712 },
+			{ 4357095798759506353, 6694478701403910, 4858394589252 },
+			{ 4363795135855499515, 6704195483875721, 4872932444142 },
+			{ 4370504204271819378, 6713941342025377, 4887524080206 },
+			{ 4377223033137924961, 6723716383415043, 4902169753686 },
+			{ 4383951651691093690, 6733520716119385, 4916869722294 },
+			{ 4390690089276935369, 6743354448728441, 4931624245202 },
+			{ 4397438375349909012, 6753217690350647, 4946433583042 },
+			{ 4404196539473842701, 6763110550615651, 4961297997942 },
+			{ 4410964611322456294, 6773033139677402, 4976217753500 },
+			{ 4417742620679887196, 6782985568217051, 4991193114834 },
+			{ 4424530597441219081, 6792967947445952, 5006224348584 },
+			{ 4431328571613013617, 6802980389108751, 5021311722898 },
+			{ 4438136573313845266, 6813023005486362, 5036455507468 },
+			{ 4444954632774839096, 6823095909399108, 5051655973496 },
+			{ 4451782780340211700, 6833199214209727, 5066913393766 },
+			{ 4458621046467815193, 6843333033826500, 5082228042644 },
+			{ 4465469461729684337, 6853497482706412, 5097600196028 },
+			{ 4472328056812586777, 6863692675858305, 5113030131402 },
+			{ 4479196862518576484, 6873918728845969, 5128518127870 },
+			{ 4486075909765550323, 6884175757791389, 5144064466150 },
+			{ 4492965229587807862, 6894463879377969, 5159669428550 },
+			{ 4499864853136614381, 6904783210853736, 5175333299012 },
+			{ 4506774811680767129, 6915133870034622, 5191056363116 },
+			{ 4513695136607164867, 6925515975307708, 5206838908092 },
+			{ 4520625859421380667, 6935929645634542, 5222681222832 },
+			{ 4527567011748238041, 6946375000554451, 5238583597918 },
+			{ 4534518625332390410, 6956852160187894, 5254546325600 },
+			{ 4541480732038903904, 6967361245239838, 5270569699808 },
+			{ 4548453363853843550, 6977902377003155, 5286654016182 },
+			{ 4555436552884862887, 6988475677361931, 5302799572142 },
+			{ 4562430331361796960, 6999081268795100, 5319006666732 },
+			{ 4569434731637258792, 7009719274379736, 5335275600796 },
+			{ 4576449786187239324, 7020389817794579, 5351606676938 },
+			{ 4583475527611710841, 7031093023323553, 5368000199522 },
+			{ 4590511988635233916, 7041829015859322, 5384456474668 },
+			{ 4597559202107567906, 7052597920906791, 5400975810310 },
+			{ 4604617201004285007, 7063399864586715, 5417558516182 },
+#else
+			{ 0, 3537119569613051 },
+			{ 3537119569613051, 3537123731209958 },
+			{ 7074243300823009, 3537132054423354 },
+			{ 10611375355246363, 3537144539292417 },
+			{ 14148519894538780, 3537161185875894 },
+			{ 17685681080414674, 3537181994252135 },
+			{ 21222863074666809, 3537206964519068 },
+			{ 24760070039185877, 3537236096794215 },
+			{ 28297306135980092, 3537269391214679 },
+			{ 31834575527194771, 3537306847937164 },
+			{ 35371882375131935, 3537348467137959 },
+			{ 38909230842269894, 3537394249012949 },
+			{ 42446625091282843, 3537444193777619 },
+			{ 45984069285060462, 3537498301667041 },
+			{ 49521567586727503, 3537556572935908 },
+			{ 53059124159663411, 3537619007858492 },
+			{ 56596743167521903, 3537685606728689 },
+			{ 60134428774250592, 3537756369859996 },
+			{ 63672185144110588, 3537831297585523 },
+			{ 67210016441696111, 3537910390257995 },
+			{ 70747926831954106, 3537993648249759 },
+			{ 74285920480203865, 3538081071952779 },
+			{ 77824001552156644, 3538172661778649 },
+			{ 81362174213935293, 3538268418158596 },
+			{ 84900442632093889, 3538368341543478 },
+			{ 88438810973637367, 3538472432403793 },
+			{ 91977283406041160, 3538580691229680 },
+			{ 95515864097270840, 3538693118530939 },
+			{ 99054557215801779, 3538809714837007 },
+			{ 102593366930638786, 3538930480696994 },
+			{ 106132297411335780, 3539055416679671 },
+			{ 109671352828015451, 3539184523373476 },
+			{ 113210537351388927, 3539317801386530 },
+			{ 116749855152775457, 3539455251346629 },
+			{ 120289310404122086, 3539596873901263 },
+			{ 123828907278023349, 3539742669717619 },
+			{ 127368649947740968, 3539892639482578 },
+			{ 130908542587223546, 3540046783902741 },
+			{ 134448589371126287, 3540205103704417 },
+			{ 137988794474830704, 3540367599633641 },
+			{ 141529162074464345, 3540534272456175 },
+			{ 145069696346920520, 3540705122957526 },
+			{ 148610401469878046, 3540880151942945 },
+			{ 152151281621820991, 3541059360237436 },
+			{ 155692340982058427, 3541242748685763 },
+			{ 159233583730744190, 3541430318152471 },
+			{ 162775014048896661, 3541622069521867 },
+			{ 166316636118418528, 3541818003698070 },
+			{ 169858454122116598, 3542018121604977 },
+			{ 173400472243721575, 3542222424186300 },
+			{ 176942694667907875, 3542430912405569 },
+			{ 180485125580313444, 3542643587246138 },
+			{ 184027769167559582, 3542860449711195 },
+			{ 187570629617270777, 3543081500823776 },
+			{ 191113711118094553, 3543306741626775 },
+			{ 194657017859721328, 3543536173182950 },
+			{ 198200554032904278, 3543769796574937 },
+			{ 201744323829479215, 3544007612905261 },
+			{ 205288331442384476, 3544249623296347 },
+			{ 208832581065680823, 3544495828890528 },
+			{ 212377076894571351, 3544746230850064 },
+			{ 215921823125421415, 3545000830357140 },
+			{ 219466823955778555, 3545259628613898 },
+			{ 223012083584392453, 3545522626842428 },
+			{ 226557606211234881, 3545789826284795 },
+			{ 230103396037519676, 3546061228203046 },
+			{ 233649457265722722, 3546336833879223 },
+			{ 237195794099601945, 3546616644615376 },
+			{ 240742410744217321, 3546900661733574 },
+			{ 244289311405950895, 3547188886575921 },
+			{ 247836500292526816, 3547481320504572 },
+			{ 251383981613031388, 3547777964901743 },
+			{ 254931759577933131, 3548078821169723 },
+			{ 258479838399102854, 3548383890730890 },
+			{ 262028222289833744, 3548693175027731 },
+			{ 265576915464861475, 3549006675522847 },
+			{ 269125922140384322, 3549324393698973 },
+			{ 272675246534083295, 3549646331058992 },
+			{ 276224892865142287, 3549972489125953 },
+			{ 279774865354268240, 3550302869443080 },
+			{ 283325168223711320, 3550637473573792 },
+			{ 286875805697285112, 3550976303101720 },
+			{ 290426782000386832, 3551319359630721 },
+			{ 293978101360017553, 3551666644784887 },
+			{ 297529768004802440, 3552018160208576 },
+			{ 301081786165011016, 3552373907566420 },
+			{ 304634160072577436, 3552733888543344 },
+			{ 308186893961120780, 3553098104844570 },
+			{ 311739992065965350, 3553466558195669 },
+			{ 315293458624161019, 3553839250342527 },
+			{ 318847297874503546, 3554216183051416 },
+			{ 322401514057554962, 3554597358108971 },
+			{ 325956111415663933, 3554982777322230 },
+			{ 329511094192986163, 3555372442518646 },
+			{ 333066466635504809, 3555766355546108 },
+			{ 336622232991050917, 3556164518272947 },
+			{ 340178397509323864, 3556566932587978 },
+			{ 343734964441911842, 3556973600400500 },
+			{ 347291938042312342, 3557384523640319 },
+			{ 350849322565952661, 3557799704257775 },
+			{ 354407122270210436, 3558219144223753 },
+			{ 357965341414434189, 3558642845529713 },
+			{ 361523984259963902, 3559070810187694 },
+			{ 365083055070151596, 3559503040230353 },
+			{ 368642558110381949, 3559939537710972 },
+			{ 372202497648092921, 3560380304703487 },
+			{ 375762877952796408, 3560825343302500 },
+			{ 379323703296098908, 3561274655623312 },
+			{ 382884977951722220, 3561728243801937 },
+			{ 386446706195524157, 3562186109995119 },
+			{ 390008892305519276, 3562648256380372 },
+			{ 393571540561899648, 3563114685155975 },
+			{ 397134655247055623, 3563585398541021 },
+			{ 400698240645596644, 3564060398775421 },
+			{ 404262301044372065, 3564539688119938 },
+			{ 407826840732492003, 3565023268856200 },
+			{ 411391864001348203, 3565511143286736 },
+			{ 414957375144634939, 3566003313734984 },
+			{ 418523378458369923, 3566499782545331 },
+			{ 422089878240915254, 3567000552083119 },
+			{ 425656878792998373, 3567505624734683 },
+			{ 429224384417733056, 3568015002907374 },
+			{ 432792399420640430, 3568528689029575 },
+			{ 436360928109670005, 3569046685550737 },
+			{ 439929974795220742, 3569568994941391 },
+			{ 443499543790162133, 3570095619693179 },
+			{ 447069639409855312, 3570626562318894 },
+			{ 450640265972174206, 3571161825352476 },
+			{ 454211427797526682, 3571701411349058 },
+			{ 457783129208875740, 3572245322884995 },
+			{ 461355374531760735, 3572793562557878 },
+			{ 464928168094318613, 3573346132986565 },
+			{ 468501514227305178, 3573903036811206 },
+			{ 472075417264116384, 3574464276693283 },
+			{ 475649881540809667, 3575029855315610 },
+			{ 479224911396125277, 3575599775382394 },
+			{ 482800511171507671, 3576174039619232 },
+			{ 486376685211126903, 3576752650773161 },
+			{ 489953437861900064, 3577335611612673 },
+			{ 493530773473512737, 3577922924927750 },
+			{ 497108696398440487, 3578514593529888 },
+			{ 500687210991970375, 3579110620252131 },
+			{ 504266321612222506, 3579711007949089 },
+			{ 507846032620171595, 3580315759496994 },
+			{ 511426348379668589, 3580924877793688 },
+			{ 515007273257462277, 3581538365758691 },
+			{ 518588811623220968, 3582156226333210 },
+			{ 522170967849554178, 3582778462480173 },
+			{ 525753746312034351, 3583405077184264 },
+			{ 529337151389218615, 3584036073451946 },
+			{ 532921187462670561, 3584671454311507 },
+			{ 536505858916982068, 3585311222813065 },
+			{ 540091170139795133, 3585955382028630 },
+			{ 543677125521823763, 3586603935052111 },
+			{ 547263729456875874, 3587256884999354 },
+			{ 550850986341875228, 3587914235008191 },
+			{ 554438900576883419, 3588575988238449 },
+			{ 558027476565121868, 3589242147871988 },
+			{ 561616718712993856, 3589912717112747 },
+			{ 565206631430106603, 3590587699186765 },
+			{ 568797219129293368, 3591267097342211 },
+			{ 572388486226635579, 3591950914849435 },
+			{ 575980437141485014, 3592639155000975 },
+			{ 579573076296485989, 3593331821111624 },
+			{ 583166408117597613, 3594028916518428 },
+			{ 586760437034116041, 3594730444580755 },
+			{ 590355167478696796, 3595436408680301 },
+			{ 593950603887377097, 3596146812221143 },
+			{ 597546750699598240, 3596861658629771 },
+			{ 601143612358228011, 3597580951355117 },
+			{ 604741193309583128, 3598304693868592 },
+			{ 608339498003451720, 3599032889664130 },
+			{ 611938530893115850, 3599765542258221 },
+			{ 615538296435374071, 3600502655189932 },
+			{ 619138799090564003, 3601244232020976 },
+			{ 622740043322584979, 3601990276335709 },
+			{ 626342033598920688, 3602740791741206 },
+			{ 629944774390661894, 3603495781867269 },
+			{ 633548270172529163, 3604255250366477 },
+			{ 637152525422895640, 3605019200914227 },
+			{ 640757544623809867, 3605787637208767 },
+			{ 644363332261018634, 3606560562971234 },
+			{ 647969892823989868, 3607337981945690 },
+			{ 651577230805935558, 3608119897899173 },
+			{ 655185350703834731, 3608906314621723 },
+			{ 658794257018456454, 3609697235926428 },
+			{ 662403954254382882, 3610492665649460 },
+			{ 666014446920032342, 3611292607650123 },
+			{ 669625739527682465, 3612097065810877 },
+			{ 673237836593493342, 3612906044037401 },
+			{ 676850742637530743, 3613719546258615 },
+			{ 680464462183789358, 3614537576426726 },
+			{ 684078999760216084, 3615360138517272 },
+			{ 687694359898733356, 3616187236529170 },
+			{ 691310547135262526, 3617018874484737 },
+			{ 694927566009747263, 3617855056429753 },
+			{ 698545421066177016, 3618695786433497 },
+			{ 702164116852610513, 3619541068588782 },
+			{ 705783657921199295, 3620390907012005 },
+			{ 709404048828211300, 3621245305843199 },
+			{ 713025294134054499, 3622104269246046 },
+			{ 716647398403300545, 3622967801407961 },
+			{ 720270366204708506, 3623835906540106 },
+			{ 723894202111248612, 3624708588877446 },
+			{ 727518910700126058, 3625585852678787 },
+			{ 731144496552804845, 3626467702226835 },
+			{ 734770964255031680, 3627354141828221 },
+			{ 738398318396859901, 3628245175813560 },
+			{ 742026563572673461, 3629140808537495 },
+			{ 745655704381210956, 3630041044378737 },
+			{ 749285745425589693, 3630945887740122 },
+			{ 752916691313329815, 3631855343048640 },
+			{ 756548546656378455, 3632769414755496 },
+			{ 760181316071133951, 3633688107336155 },
+			{ 763815004178470106, 3634611425290389 },
+			{ 767449615603760495, 3635539373142309 },
+			{ 771085154976902804, 3636471955440441 },
+			{ 774721626932343245, 3637409176757759 },
+			{ 778359036109101004, 3638351041691715 },
+			{ 781997387150792719, 3639297554864329 },
+			{ 785636684705657048, 3640248720922205 },
+			{ 789276933426579253, 3641204544536583 },
+			{ 792918137971115836, 3642165030403405 },
+			{ 796560303001519241, 3643130183243359 },
+			{ 800203433184762600, 3644100007801907 },
+			{ 803847533192564507, 3645074508849376 },
+			{ 807492607701413883, 3646053691180974 },
+			{ 811138661392594857, 3647037559616847 },
+			{ 814785698952211704, 3648026119002154 },
+			{ 818433725071213858, 3649019374207083 },
+			{ 822082744445420941, 3650017330126934 },
+			{ 825732761775547875, 3651019991682144 },
+			{ 829383781767230019, 3652027363818376 },
+			{ 833035809131048395, 3653039451506515 },
+			{ 836688848582554910, 3654056259742788 },
+			{ 840342904842297698, 3655077793548756 },
+			{ 843997982635846454, 3656104057971421 },
+			{ 847654086693817875, 3657135058083232 },
+			{ 851311221751901107, 3658170798982174 },
+			{ 854969392550883281, 3659211285791807 },
+			{ 858628603836675088, 3660256523661323 },
+			{ 862288860360336411, 3661306517765603 },
+			{ 865950166878102014, 3662361273305264 },
+			{ 869612528151407278, 3663420795506740 },
+			{ 873275948946914018, 3664485089622297 },
+			{ 876940434036536315, 3665554160930121 },
+			{ 880605988197466436, 3666628014734374 },
+			{ 884272616212200810, 3667706656365236 },
+			{ 887940322868566046, 3668790091178959 },
+			{ 891609112959745005, 3669878324557952 },
+			{ 895278991284302957, 3670971361910813 },
+			{ 898949962646213770, 3672069208672386 },
+			{ 902622031854886156, 3673171870303845 },
+			{ 906295203725190001, 3674279352292727 },
+			{ 909969483077482728, 3675391660153005 },
+			{ 913644874737635733, 3676508799425135 },
+			{ 917321383537060868, 3677630775676135 },
+			{ 920999014312737003, 3678757594499632 },
+			{ 924677771907236635, 3679889261515908 },
+			{ 928357661168752543, 3681025782372001 },
+			{ 932038686951124544, 3682167162741731 },
+			{ 935720854113866275, 3683313408325767 },
+			{ 939404167522192042, 3684464524851703 },
+			{ 943088632047043745, 3685620518074110 },
+			{ 946774252565117855, 3686781393774594 },
+			{ 950461033958892449, 3687947157761867 },
+			{ 954148981116654316, 3689117815871812 },
+			{ 957838098932526128, 3690293373967536 },
+			{ 961528392306493664, 3691473837939439 },
+			{ 965219866144433103, 3692659213705283 },
+			{ 968912525358138386, 3693849507210251 },
+			{ 972606374865348637, 3695044724427002 },
+			{ 976301419589775639, 3696244871355767 },
+			{ 979997664461131406, 3697449954024371 },
+			{ 983695114415155777, 3698659978488337 },
+			{ 987393774393644114, 3699874950830932 },
+			{ 991093649344475046, 3701094877163236 },
+			{ 994794744221638282, 3702319763624216 },
+			{ 998497063985262498, 3703549616380784 },
+			{ 1002200613601643282, 3704784441627864 },
+			{ 1005905398043271146, 3706024245588472 },
+			{ 1009611422288859618, 3707269034513776 },
+			{ 1013318691323373394, 3708518814683157 },
+			{ 1017027210138056551, 3709773592404295 },
+			{ 1020736983730460846, 3711033374013220 },
+			{ 1024448017104474066, 3712298165874399 },
+			{ 1028160315270348465, 3713567974380789 },
+			{ 1031873883244729254, 3714842805953924 },
+			{ 1035588726050683178, 3716122667043968 },
+			{ 1039304848717727146, 3717407564129803 },
+			{ 1043022256281856949, 3718697503719087 },
+			{ 1046740953785576036, 3719992492348342 },
+			{ 1050460946277924378, 3721292536582996 },
+			{ 1054182238814507374, 3722597643017495 },
+			{ 1057904836457524869, 3723907818275342 },
+			{ 1061628744275800211, 3725223069009189 },
+			{ 1065353967344809400, 3726543401900906 },
+			{ 1069080510746710306, 3727868823661655 },
+			{ 1072808379570371961, 3729199341031964 },
+			{ 1076537578911403925, 3730534960781794 },
+			{ 1080268113872185719, 3731875689710631 },
+			{ 1083999989561896350, 3733221534647549 },
+			{ 1087733211096543899, 3734572502451282 },
+			{ 1091467783598995181, 3735928600010322 },
+			{ 1095203712199005503, 3737289834242962 },
+			{ 1098941002033248465, 3738656212097410 },
+			{ 1102679658245345875, 3740027740551829 },
+			{ 1106419685985897704, 3741404426614450 },
+			{ 1110161090412512154, 3742786277323625 },
+			{ 1113903876689835779, 3744173299747919 },
+			{ 1117648049989583698, 3745565500986175 },
+			{ 1121393615490569873, 3746962888167616 },
+			{ 1125140578378737489, 3748365468451900 },
+			{ 1128888943847189389, 3749773249029215 },
+			{ 1132638717096218604, 3751186237120361 },
+			{ 1136389903333338965, 3752604439976818 },
+			{ 1140142507773315783, 3754027864880837 },
+			{ 1143896535638196620, 3755456519145523 },
+			{ 1147651992157342143, 3756890410114909 },
+			{ 1151408882567457052, 3758329545164048 },
+			{ 1155167212112621100, 3759773931699088 },
+			{ 1158926986044320188, 3761223577157361 },
+			{ 1162688209621477549, 3762678489007463 },
+			{ 1166450888110485012, 3764138674749340 },
+			{ 1170215026785234352, 3765604141914368 },
+			{ 1173980630927148720, 3767074898065452 },
+			{ 1177747705825214172, 3768550950797088 },
+			{ 1181516256776011260, 3770032307735472 },
+			{ 1185286289083746732, 3771518976538582 },
+			{ 1189057808060285314, 3773010964896236 },
+			{ 1192830819025181550, 3774508280530234 },
+			{ 1196605327305711784, 3776010931194381 },
+			{ 1200381338236906165, 3777518924674634 },
+			{ 1204158857161580799, 3779032268789151 },
+			{ 1207937889430369950, 3780550971388400 },
+			{ 1211718440401758350, 3782075040355232 },
+			{ 1215500515442113582, 3783604483604989 },
+			{ 1219284119925718571, 3785139309085574 },
+			{ 1223069259234804145, 3786679524777570 },
+			{ 1226855938759581715, 3788225138694293 },
+			{ 1230644163898276008, 3789776158881918 },
+			{ 1234433940057157926, 3791332593419558 },
+			{ 1238225272650577484, 3792894450419342 },
+			{ 1242018167100996826, 3794461738026531 },
+			{ 1245812628839023357, 3796034464419603 },
+			{ 1249608663303442960, 3797612637810333 },
+			{ 1253406275941253293, 3799196266443912 },
+			{ 1257205472207697205, 3800785358599027 },
+			{ 1261006257566296232, 3802379922587946 },
+			{ 1264808637488884178, 3803979966756637 },
+			{ 1268612617455640815, 3805585499484843 },
+			{ 1272418202955125658, 3807196529186206 },
+			{ 1276225399484311864, 3808813064308319 },
+			{ 1280034212548620183, 3810435113332859 },
+			{ 1283844647661953042, 3812062684775697 },
+			{ 1287656710346728739, 3813695787186937 },
+			{ 1291470406133915676, 3815334429151086 },
+			{ 1295285740563066762, 3816978619287103 },
+			{ 1299102719182353865, 3818628366248515 },
+			{ 1302921347548602380, 3820283678723530 },
+			{ 1306741631227325910, 3821944565435105 },
+			{ 1310563575792761015, 3823611035141095 },
+			{ 1314387186827902110, 3825283096634299 },
+			{ 1318212469924536409, 3826960758742611 },
+			{ 1322039430683279020, 3828644030329094 },
+			{ 1325868074713608114, 3830332920292088 },
+			{ 1329698407633900202, 3832027437565330 },
+			{ 1333530435071465532, 3833727591118024 },
+			{ 1337364162662583556, 3835433389954987 },
+			{ 1341199596052538543, 3837144843116724 },
+			{ 1345036740895655267, 3838861959679537 },
+			{ 1348875602855334804, 3840584748755657 },
+			{ 1352716187604090461, 3842313219493307 },
+			{ 1356558500823583768, 3844047381076856 },
+			{ 1360402548204660624, 3845787242726883 },
+			{ 1364248335447387507, 3847532813700322 },
+			{ 1368095868261087829, 3849284103290546 },
+			{ 1371945152364378375, 3851041120827487 },
+			{ 1375796193485205862, 3852803875677742 },
+			{ 1379648997360883604, 3854572377244697 },
+			{ 1383503569738128301, 3856346634968600 },
+			{ 1387359916373096901, 3858126658326728 },
+			{ 1391218043031423629, 3859912456833441 },
+			{ 1395077955488257070, 3861704040040341 },
+			{ 1398939659528297411, 3863501417536368 },
+			{ 1402803160945833779, 3865304598947883 },
+			{ 1406668465544781662, 3867113593938853 },
+			{ 1410535579138720515, 3868928412210884 },
+			{ 1414404507550931399, 3870749063503398 },
+			{ 1418275256614434797, 3872575557593721 },
+			{ 1422147832172028518, 3874407904297196 },
+			{ 1426022240076325714, 3876246113467315 },
+			{ 1429898486189793029, 3878090194995827 },
+			{ 1433776576384788856, 3879940158812857 },
+			{ 1437656516543601713, 3881796014887025 },
+			{ 1441538312558488738, 3883657773225561 },
+			{ 1445421970331714299, 3885525443874433 },
+			{ 1449307495775588732, 3887399036918460 },
+			{ 1453194894812507192, 3889278562481437 },
+			{ 1457084173374988629, 3891164030726250 },
+			{ 1460975337405714879, 3893055451855007 },
+			{ 1464868392857569886, 3894952836109147 },
+			{ 1468763345693679033, 3896856193769585 },
+			{ 1472660201887448618, 3898765535156806 },
+			{ 1476558967422605424, 3900680870631012 },
+			{ 1480459648293236436, 3902602210592240 },
+			{ 1484362250503828676, 3904529565480490 },
+			{ 1488266780069309166, 3906462945775837 },
+			{ 1492173243015085003, 3908402361998574 },
+			{ 1496081645377083577, 3910347824709341 },
+			{ 1499991993201792918, 3912299344509227 },
+			{ 1503904292546302145, 3914256932039933 },
+			{ 1507818549478342078, 3916220597983870 },
+			{ 1511734770076325948, 3918190353064315 },
+			{ 1515652960429390263, 3920166208045515 },
+			{ 1519573126637435778, 3922148173732845 },
+			{ 1523495274811168623, 3924136260972917 },
+			{ 1527419411072141540, 3926130480653718 },
+			{ 1531345541552795258, 3928130843704751 },
+			{ 1535273672396500009, 3930137361097162 },
+			{ 1539203809757597171, 3932150043843864 },
+			{ 1543135959801441035, 3934168902999699 },
+			{ 1547070128704440734, 3936193949661539 },
+			{ 1551006322654102273, 3938225194968444 },
+			{ 1554944547849070717, 3940262650101799 },
+			{ 1558884810499172516, 3942306326285424 },
+			{ 1562827116825457940, 3944356234785765 },
+			{ 1566771473060243705, 3946412386911966 },
+			{ 1570717885447155671, 3948474794016067 },
+			{ 1574666360241171738, 3950543467493101 },
+			{ 1578616903708664839, 3952618418781259 },
+			{ 1582569522127446098, 3954699659362018 },
+			{ 1586524221786808116, 3956787200760303 },
+			{ 1590481008987568419, 3958881054544588 },
+			{ 1594439890042113007, 3960981232327086 },
+			{ 1598400871274440093, 3963087745763869 },
+			{ 1602363959020203962, 3965200606555006 },
+			{ 1606329159626758968, 3967319826444723 },
+			{ 1610296479453203691, 3969445417221543 },
+			{ 1614265924870425234, 3971577390718427 },
+			{ 1618237502261143661, 3973715758812932 },
+			{ 1622211218019956593, 3975860533427348 },
+			{ 1626187078553383941, 3978011726528853 },
+			{ 1630165090279912794, 3980169350129660 },
+			{ 1634145259630042454, 3982333416287166 },
+			{ 1638127593046329620, 3984503937104108 },
+			{ 1642112096983433728, 3986680924728700 },
+			{ 1646098777908162428, 3988864391354805 },
+			{ 1650087642299517233, 3991054349222068 },
+			{ 1654078696648739301, 3993250810616087 },
+			{ 1658071947459355388, 3995453787868561 },
+			{ 1662067401247223949, 3997663293357427 },
+			{ 1666065064540581376, 3999879339507050 },
+			{ 1670064943880088426, 4002101938788343 },
+			{ 1674067045818876769, 4004331103718961 },
+			{ 1678071376922595730, 4006566846863420 },
+			{ 1682077943769459150, 4008809180833291 },
+			{ 1686086752950292441, 4011058118287331 },
+			{ 1690097811068579772, 4013313671931667 },
+			{ 1694111124740511439, 4015575854519931 },
+			{ 1698126700595031370, 4017844678853444 },
+			{ 1702144545273884814, 4020120157781381 },
+			{ 1706164665431666195, 4022402304200894 },
+			{ 1710187067735867089, 4024691131057333 },
+			{ 1714211758866924422, 4026986651344364 },
+			{ 1718238745518268786, 4029288878104172 },
+			{ 1722268034396372958, 4031597824427583 },
+			{ 1726299632220800541, 4033913503454279 },
+			{ 1730333545724254820, 4036235928372931 },
+			{ 1734369781652627751, 4038565112421371 },
+			{ 1738408346765049122, 4040901068886796 },
+			{ 1742449247833935918, 4043243811105890 },
+			{ 1746492491645041808, 4045593352465020 },
+			{ 1750538084997506828, 4047949706400409 },
+			{ 1754586034703907237, 4050312886398303 },
+			{ 1758636347590305540, 4052682905995151 },
+			{ 1762689030496300691, 4055059778777753 },
+			{ 1766744090275078444, 4057443518383482 },
+			{ 1770801533793461926, 4059834138500423 },
+			{ 1774861367931962349, 4062231652867557 },
+			{ 1778923599584829906, 4064636075274940 },
+			{ 1782988235660104846, 4067047419563898 },
+			{ 1787055283079668744, 4069465699627171 },
+			{ 1791124748779295915, 4071890929409129 },
+			{ 1795196639708705044, 4074323122905937 },
+			{ 1799270962831610981, 4076762294165721 },
+			{ 1803347725125776702, 4079208457288790 },
+			{ 1807426933583065492, 4081661626427782 },
+			{ 1811508595209493274, 4084121815787866 },
+			{ 1815592717025281140, 4086589039626921 },
+			{ 1819679306064908061, 4089063312255733 },
+			{ 1823768369377163794, 4091544648038169 },
+			{ 1827859914025201963, 4094033061391371 },
+			{ 1831953947086593334, 4096528566785944 },
+			{ 1836050475653379278, 4099031178746146 },
+			{ 1840149506832125424, 4101540911850079 },
+			{ 1844251047743975503, 4104057780729880 },
+			{ 1848355105524705383, 4106581800071909 },
+			{ 1852461687324777292, 4109112984616953 },
+			{ 1856570800309394245, 4111651349160411 },
+			{ 1860682451658554656, 4114196908552493 },
+			{ 1864796648567107149, 4116749677698409 },
+			{ 1868913398244805558, 4119309671558587 },
+			{ 1873032707916364145, 4121876905148837 },
+			{ 1877154584821512982, 4124451393540586 },
+			{ 1881279036215053568, 4127033151861049 },
+			{ 1885406069366914617, 4129622195293453 },
+			{ 1889535691562208070, 4132218539077213 },
+			{ 1893667910101285283, 4134822198508163 },
+			{ 1897802732299793446, 4137433188938745 },
+			{ 1901940165488732191, 4140051525778201 },
+			{ 1906080217014510392, 4142677224492812 },
+			{ 1910222894239003204, 4145310300606067 },
+			{ 1914368204539609271, 4147950769698901 },
+			{ 1918516155309308172, 4150598647409891 },
+			{ 1922666753956718063, 4153253949435454 },
+			{ 1926820007906153517, 4155916691530089 },
+			{ 1930975924597683606, 4158586889506548 },
+			{ 1935134511487190154, 4161264559236084 },
+			{ 1939295776046426238, 4163949716648655 },
+			{ 1943459725763074893, 4166642377733110 },
+			{ 1947626368140808003, 4169342558537457 },
+			{ 1951795710699345460, 4172050275169039 },
+			{ 1955967760974514499, 4174765543794758 },
+			{ 1960142526518309257, 4177488380641318 },
+			{ 1964320014898950575, 4180218801995407 },
+			{ 1968500233700945982, 4182956824203957 },
+			{ 1972683190525149939, 4185702463674330 },
+			{ 1976868892988824269, 4188455736874571 },
+			{ 1981057348725698840, 4191216660333613 },
+			{ 1985248565386032453, 4193985250641513 },
+			{ 1989442550636673966, 4196761524449666 },
+			{ 1993639312161123632, 4199545498471049 },
+			{ 1997838857659594681, 4202337189480440 },
+			{ 2002041194849075121, 4205136614314637 },
+			{ 2006246331463389758, 4207943789872711 },
+			{ 2010454275253262469, 4210758733116229 },
+			{ 2014665033986378698, 4213581461069475 },
+			{ 2018878615447448173, 4216411990819693 },
+			{ 2023095027438267866, 4219250339517340 },
+			{ 2027314277777785206, 4222096524376281 },
+			{ 2031536374302161487, 4224950562674071 },
+			{ 2035761324864835558, 4227812471752154 },
+			{ 2039989137336587712, 4230682269016145 },
+			{ 2044219819605603857, 4233559971936023 },
+			{ 2048453379577539880, 4236445598046415 },
+			{ 2052689825175586295, 4239339164946820 },
+			{ 2056929164340533115, 4242240690301839 },
+			{ 2061171405030834954, 4245150191841462 },
+			{ 2065416555222676416, 4248067687361268 },
+			{ 2069664622910037684, 4250993194722711 },
+			{ 2073915616104760395, 4253926731853336 },
+			{ 2078169542836613731, 4256868316747062 },
+			{ 2082426411153360793, 4259817967464412 },
+			{ 2086686229120825205, 4262775702132755 },
+			{ 2090949004822957960, 4265741538946616 },
+			{ 2095214746361904576, 4268715496167843 },
+			{ 2099483461858072419, 4271697592125947 },
+			{ 2103755159450198366, 4274687845218318 },
+			{ 2108029847295416684, 4277686273910480 },
+			{ 2112307533569327164, 4280692896736370 },
+			{ 2116588226466063534, 4283707732298586 },
+			{ 2120871934198362120, 4286730799268668 },
+			{ 2125158664997630788, 4289762116387338 },
+			{ 2129448427114018126, 4292801702464773 },
+			{ 2133741228816482899, 4295849576380892 },
+			{ 2138037078392863791, 4298905757085589 },
+			{ 2142335984149949380, 4301970263599035 },
+			{ 2146637954413548415, 4305043115011925 },
+			{ 2150942997528560340, 4308124330485759 },
+			{ 2155251121859046099, 4311213929253122 },
+			{ 2159562335788299221, 4314311930617944 },
+			{ 2163876647718917165, 4317418353955789 },
+			{ 2168194066072872954, 4320533218714127 },
+			{ 2172514599291587081, 4323656544412603 },
+			{ 2176838255835999684, 4326788350643341 },
+			{ 2181165044186643025, 4329928657071196 },
+			{ 2185494972843714221, 4333077483434066 },
+			{ 2189828050327148287, 4336234849543141 },
+			{ 2194164285176691428, 4339400775283237 },
+			{ 2198503685951974665, 4342575280613019 },
+			{ 2202846261232587684, 4345758385565365 },
+			{ 2207192019618153049, 4348950110247583 },
+			{ 2211540969728400632, 4352150474841744 },
+			{ 2215893120203242376, 4355359499604979 },
+			{ 2220248479702847355, 4358577204869740 },
+			{ 2224607056907717095, 4361803611044121 },
+			{ 2228968860518761216, 4365038738612157 },
+			{ 2233333899257373373, 4368282608134097 },
+			{ 2237702181865507470, 4371535240246745 },
+			{ 2242073717105754215, 4374796655663710 },
+			{ 2246448513761417925, 4378066875175752 },
+			{ 2250826580636593677, 4381345919651059 },
+			{ 2255207926556244736, 4384633810035582 },
+			{ 2259592560366280318, 4387930567353307 },
+			{ 2263980490933633625, 4391236212706579 },
+			{ 2268371727146340204, 4394550767276434 },
+			{ 2272766277913616638, 4397874252322863 },
+			{ 2277164152165939501, 4401206689185177 },
+			{ 2281565358855124678, 4404548099282289 },
+			{ 2285969906954406967, 4407898504113040 },
+			{ 2290377805458520007, 4411257925256503 },
+			{ 2294789063383776510, 4414626384372345 },
+			{ 2299203689768148855, 4418003903201100 },
+			{ 2303621693671349955, 4421390503564509 },
+			{ 2308043084174914464, 4424786207365861 },
+			{ 2312467870382280325, 4428191036590296 },
+			{ 2316896061418870621, 4431605013305130 },
+			{ 2321327666432175751, 4435028159660224 },
+			{ 2325762694591835975, 4438460497888264 },
+			{ 2330201155089724239, 4441902050305119 },
+			{ 2334643057140029358, 4445352839310183 },
+			{ 2339088409979339541, 4448812887386689 },
+			{ 2343537222866726230, 4452282217102068 },
+			{ 2347989505083828298, 4455760851108260 },
+			{ 2352445265934936558, 4459248812142096 },
+			{ 2356904514747078654, 4462746123025606 },
+			{ 2361367260870104260, 4466252806666375 },
+			{ 2365833513676770635, 4469768886057886 },
+			{ 2370303282562828521, 4473294384279885 },
+			{ 2374776576947108406, 4476829324498693 },
+			{ 2379253406271607099, 4480373729967603 },
+			{ 2383733780001574702, 4483927624027203 },
+			{ 2388217707625601905, 4487491030105733 },
+			{ 2392705198655707638, 4491063971719451 },
+			{ 2397196262627427089, 4494646472472995 },
+			{ 2401690909099900084, 4498238556059721 },
+			{ 2406189147655959805, 4501840246262091 },
+			{ 2410690987902221896, 4505451566952024 },
+			{ 2415196439469173920, 4509072542091256 },
+			{ 2419705512011265176, 4512703195731727 },
+			{ 2424218215206996903, 4516343552015929 },
+			{ 2428734558759012832, 4519993635177279 },
+			{ 2433254552394190111, 4523653469540528 },
+			{ 2437778205863730639, 4527323079522067 },
+			{ 2442305528943252706, 4531002489630380 },
+			{ 2446836531432883086, 4534691724466361 },
+			{ 2451371223157349447, 4538390808723737 },
+			{ 2455909613966073184, 4542099767189424 },
+			{ 2460451713733262608, 4545818624743935 },
+			{ 2464997532358006543, 4549547406361730 },
+			{ 2469547079764368273, 4553286137111648 },
+			{ 2474100365901479921, 4557034842157272 },
+			{ 2478657400743637193, 4560793546757319 },
+			{ 2483218194290394512, 4564562276266047 },
+			{ 2487782756566660559, 4568341056133647 },
+			{ 2492351097622794206, 4572129911906632 },
+			{ 2496923227534700838, 4575928869228267 },
+			{ 2501499156403929105, 4579737953838915 },
+			{ 2506078894357768020, 4583557191576511 },
+			{ 2510662451549344531, 4587386608376912 },
+			{ 2515249838157721443, 4591226230274336 },
+			{ 2519841064387995779, 4595076083401764 },
+			{ 2524436140471397543, 4598936193991350 },
+			{ 2529035076665388893, 4602806588374843 },
+			{ 2533637883253763736, 4606687292984000 },
+			{ 2538244570546747736, 4610578334350998 },
+			{ 2542855148881098734, 4614479739108872 },
+			{ 2547469628620207606, 4618391533991913 },
+			{ 2552088020154199519, 4622313745836140 },
+			{ 2556710333900035659, 4626246401579651 },
+			{ 2561336580301615310, 4630189528263151 },
+			{ 2565966769829878461, 4634143153030291 },
+			{ 2570600912982908752, 4638107303128163 },
+			{ 2575239020286036915, 4642082005907713 },
+			{ 2579881102291944628, 4646067288824184 },
+			{ 2584527169580768812, 4650063179437559 },
+			{ 2589177232760206371, 4654069705412992 },
+			{ 2593831302465619363, 4658086894521291 },
+			{ 2598489389360140654, 4662114774639303 },
+			{ 2603151504134779957, 4666153373750430 },
+			{ 2607817657508530387, 4670202719945032 },
+			{ 2612487860228475419, 4674262841420917 },
+			{ 2617162123069896336, 4678333766483773 },
+			{ 2621840456836380109, 4682415523547644 },
+			{ 2626522872359927753, 4686508141135377 },
+			{ 2631209380501063130, 4690611647879109 },
+			{ 2635899992148942239, 4694726072520704 },
+			{ 2640594718221462943, 4698851443912249 },
+			{ 2645293569665375192, 4702987791016517 },
+			{ 2649996557456391709, 4707135142907426 },
+			{ 2654703692599299135, 4711293528770539 },
+			{ 2659414986128069674, 4715462977903527 },
+			{ 2664130449105973201, 4719643519716665 },
+			{ 2668850092625689866, 4723835183733294 },
+			{ 2673573927809423160, 4728037999590328 },
+			{ 2678301965809013488, 4732251997038737 },
+			{ 2683034217806052225, 4736477205944029 },
+			{ 2687770695011996254, 4740713656286754 },
+			{ 2692511408668283008, 4744961378163018 },
+			{ 2697256370046446026, 4749220401784933 },
+			{ 2702005590448230959, 4753490757481168 },
+			{ 2706759081205712127, 4757772475697430 },
+			{ 2711516853681409557, 4762065586996981 },
+			{ 2716278919268406538, 4766370122061135 },
+			{ 2721045289390467673, 4770686111689775 },
+			{ 2725815975502157448, 4775013586801889 },
+			{ 2730590989088959337, 4779352578436055 },
+			{ 2735370341667395392, 4783703117750980 },
+			{ 2740154044785146372, 4788065236026029 },
+			{ 2744942110021172401, 4792438964661728 },
+			{ 2749734548985834129, 4796824335180314 },
+			{ 2754531373321014443, 4801221379226270 },
+			{ 2759332594700240713, 4805630128566830 },
+			{ 2764138224828807543, 4810050615092554 },
+			{ 2768948275443900097, 4814482870817837 },
+			{ 2773762758314717934, 4818926927881469 },
+			{ 2778581685242599403, 4823382818547187 },
+			{ 2783405068061146590, 4827850575204188 },
+			{ 2788232918636350778, 4832330230367728 },
+			{ 2793065248866718506, 4836821816679651 },
+			{ 2797902070683398157, 4841325366908935 },
+			{ 2802743396050307092, 4845840913952290 },
+			{ 2807589236964259382, 4850368490834684 },
+			{ 2812439605455094066, 4854908130709914 },
+			{ 2817294513585803980, 4859459866861214 },
+			{ 2822153973452665194, 4864023732701762 },
+			{ 2827017997185366956, 4868599761775329 },
+			{ 2831886596947142285, 4873187987756794 },
+			{ 2836759784934899079, 4877788444452758 },
+			{ 2841637573379351837, 4882401165802129 },
+			{ 2846519974545153966, 4887026185876691 },
+			{ 2851407000731030657, 4891663538881729 },
+			{ 2856298664269912386, 4896313259156567 },
+			{ 2861194977529068953, 4900975381175230 },
+			{ 2866095952910244183, 4905649939547005 },
+			{ 2871001602849791188, 4910336969017040 },
+			{ 2875911939818808228, 4915036504466984 },
+			{ 2880826976323275212, 4919748580915556 },
+			{ 2885746724904190768, 4924473233519201 },
+			{ 2890671198137709969, 4929210497572671 },
+			{ 2895600408635282640, 4933960408509659 },
+			{ 2900534369043792299, 4938723001903427 },
+			{ 2905473092045695726, 4943498313467430 },
+			{ 2910416590359163156, 4948286379055935 },
+			{ 2915364876738219091, 4953087234664662 },
+			{ 2920317963972883753, 4957900916431449 },
+			{ 2925275864889315202, 4962727460636816 },
+			{ 2930238592349952018, 4967566903704700 },
+			{ 2935206159253656718, 4972419282203051 },
+			{ 2940178578535859769, 4977284632844469 },
+			{ 2945155863168704238, 4982162992486903 },
+			{ 2950138026161191141, 4987054398134282 },
+			{ 2955125080559325423, 4991958886937179 },
+			{ 2960117039446262602, 4996876496193469 },
+			{ 2965113915942456071, 5001807263349016 },
+			{ 2970115723205805087, 5006751225998337 },
+			{ 2975122474431803424, 5011708421885251 },
+			{ 2980134182853688675, 5016678888903615 },
+			{ 2985150861742592290, 5021662665097954 },
+			{ 2990172524407690244, 5026659788664177 },
+			{ 2995199184196354421, 5031670297950251 },
+			{ 3000230854494304672, 5036694231456902 },
+			{ 3005267548725761574, 5041731627838329 },
+			{ 3010309280353599903, 5046782525902873 },
+			{ 3015356062879502776, 5051846964613746 },
+			{ 3020407909844116522, 5056924983089745 },
+			{ 3025464834827206267, 5062016620605930 },
+			{ 3030526851447812197, 5067121916594390 },
+			{ 3035593973364406587, 5072240910644932 },
+			{ 3040666214275051519, 5077373642505817 },
+			{ 3045743587917557336, 5082520152084476 },
+			{ 3050826108069641812, 5087680479448265 },
+			{ 3055913788549090077, 5092854664825194 },
+			{ 3061006643213915271, 5098042748604640 },
+			{ 3066104685962519911, 5103244771338162 },
+			{ 3071207930733858073, 5108460773740151 },
+			{ 3076316391507598224, 5113690796688683 },
+			{ 3081430082304286907, 5118934881226208 },
+			{ 3086549017185513115, 5124193068560337 },
+			{ 3091673210254073452, 5129465400064620 },
+			{ 3096802675654138072, 5134751917279283 },
+			{ 3101937427571417355, 5140052661912030 },
+			{ 3107077480233329385, 5145367675838830 },
+			{ 3112222847909168215, 5150697001104649 },
+			{ 3117373544910272864, 5156040679924303 },
+			{ 3122529585590197167, 5161398754683198 },
+			{ 3127690984344880365, 5166771267938171 },
+			{ 3132857755612818536, 5172158262418231 },
+			{ 3138029913875236767, 5177559781025428 },
+			{ 3143207473656262195, 5182975866835634 },
+			{ 3148390449523097829, 5188406563099328 },
+			{ 3153578856086197157, 5193851913242479 },
+			{ 3158772707999439636, 5199311960867307 },
+			{ 3163972019960306943, 5204786749753141 },
+			{ 3169176806710060084, 5210276323857270 },
+			{ 3174387083033917354, 5215780727315722 },
+			{ 3179602863761233076, 5221300004444165 },
+			{ 3184824163765677241, 5226834199738720 },
+			{ 3190050997965415961, 5232383357876815 },
+			{ 3195283381323292776, 5237947523718056 },
+			{ 3200521328847010832, 5243526742305087 },
+			{ 3205764855589315919, 5249121058864412 },
+			{ 3211013976648180331, 5254730518807329 },
+			{ 3216268707166987660, 5260355167730771 },
+			{ 3221529062334718431, 5265995051418188 },
+			{ 3226795057386136619, 5271650215840426 },
+			{ 3232066707601977045, 5277320707156636 },
+			{ 3237344028309133681, 5283006571715155 },
+			{ 3242627034880848836, 5288707856054412 },
+			{ 3247915742736903248, 5294424606903821 },
+			{ 3253210167343807069, 5300156871184711 },
+			{ 3258510324214991780, 5305904696011230 },
+			{ 3263816228911003010, 5311668128691253 },
+			{ 3269127897039694263, 5317447216727338 },
+			{ 3274445344256421601, 5323242007817638 },
+			{ 3279768586264239239, 5329052549856825 },
+			{ 3285097638814096064, 5334878890937064 },
+			{ 3290432517705033128, 5340721079348923 },
+			{ 3295773238784382051, 5346579163582358 },
+			{ 3301119817947964409, 5352453192327650 },
+			{ 3306472271140292059, 5358343214476379 },
+			{ 3311830614354768438, 5364249279122385 },
+			{ 3317194863633890823, 5370171435562745 },
+			{ 3322565035069453568, 5376109733298742 },
+			{ 3327941144802752310, 5382064222036897 },
+			{ 3333323209024789207, 5388034951689870 },
+			{ 3338711243976479077, 5394021972377563 },
+			{ 3344105265948856640, 5400025334428029 },
+			{ 3349505291283284669, 5406045088378547 },
+			{ 3354911336371663216, 5412081284976594 },
+			{ 3360323417656639810, 5418133975180893 },
+			{ 3365741551631820703, 5424203210162414 },
+			{ 3371165754841983117, 5430289041305412 },
+			{ 3376596043883288529, 5436391520208490 },
+			{ 3382032435403497019, 5442510698685592 },
+			{ 3387474946102182611, 5448646628767113 },
+			{ 3392923592730949724, 5454799362700892 },
+			{ 3398378392093650616, 5460968952953327 },
+			{ 3403839361046603943, 5467155452210398 },
+			{ 3409306516498814341, 5473358913378779 },
+			{ 3414779875412193120, 5479579389586892 },
+			{ 3420259454801780012, 5485816934185995 },
+			{ 3425745271735966007, 5492071600751301 },
+			{ 3431237343336717308, 5498343443083032 },
+			{ 3436735686779800340, 5504632515207555 },
+			{ 3442240319295007895, 5510938871378503 },
+			{ 3447751258166386398, 5517262566077850 },
+			{ 3453268520732464248, 5523603654017079 },
+			{ 3458792124386481327, 5529962190138293 },
+			{ 3464322086576619620, 5536338229615351 },
+			{ 3469858424806234971, 5542731827855014 },
+			{ 3475401156634089985, 5549143040498107 },
+			{ 3480950299674588092, 5555571923420655 },
+			{ 3486505871598008747, 5562018532735073 },
+			{ 3492067890130743820, 5568482924791303 },
+			{ 3497636373055535123, 5574965156178040 },
+			{ 3503211338211713163, 5581465283723864 },
+			{ 3508792803495437027, 5587983364498466 },
+			{ 3514380786859935493, 5594519455813848 },
+			{ 3519975306315749341, 5601073615225489 },
+			{ 3525576379930974830, 5607645900533621 },
+			{ 3531184025831508451, 5614236369784393 },
+			{ 3536798262201292844, 5620845081271130 },
+			{ 3542419107282563974, 5627472093535543 },
+			{ 3548046579376099517, 5634117465368997 },
+			{ 3553680696841468514, 5640781255813751 },
+			{ 3559321478097282265, 5647463524164196 },
+			{ 3564968941621446461, 5654164329968146 },
+			{ 3570623105951414607, 5660883733028088 },
+			{ 3576283989684442695, 5667621793402478 },
+			{ 3581951611477845173, 5674378571407003 },
+			{ 3587625990049252176, 5681154127615910 },
+			{ 3593307144176868086, 5687948522863276 },
+			{ 3598995092699731362, 5694761818244324 },
+			{ 3604689854517975686, 5701594075116757 },
+			{ 3610391448593092443, 5708445355102067 },
+			{ 3616099893948194510, 5715315720086862 },
+			{ 3621815209668281372, 5722205232224234 },
+			{ 3627537414900505606, 5729113953935064 },
+			{ 3633266528854440670, 5736041947909429 },
+			{ 3639002570802350099, 5742989277107933 },
+			{ 3644745560079458032, 5749956004763084 },
+			{ 3650495516084221116, 5756942194380686 },
+			{ 3656252458278601802, 5763947909741217 },
+			{ 3662016406188343019, 5770973214901247 },
+			{ 3667787379403244266, 5778018174194800 },
+			{ 3673565397577439066, 5785082852234831 },
+			{ 3679350480429673897, 5792167313914589 },
+			{ 3685142647743588486, 5799271624409094 },
+			{ 3690941919367997580, 5806395849176547 },
+			{ 3696748315217174127, 5813540053959794 },
+			{ 3702561855271133921, 5820704304787782 },
+			{ 3708382559575921703, 5827888667977013 },
+			{ 3714210448243898716, 5835093210133041 },
+			{ 3720045541454031757, 5842317998151946 },
+			{ 3725887859452183703, 5849563099221808 },
+			{ 3731737422551405511, 5856828580824244 },
+			{ 3737594251132229755, 5864114510735892 },
+			{ 3743458365642965647, 5871420957029946 },
+			{ 3749329786599995593, 5878747988077676 },
+			{ 3755208534588073269, 5886095672549971 },
+			{ 3761094630260623240, 5893464079418892 },
+			{ 3766988094340042132, 5900853277959223 },
+			{ 3772888947618001355, 5908263337750035 },
+			{ 3778797210955751390, 5915694328676281 },
+			{ 3784712905284427671, 5923146320930343 },
+			{ 3790636051605358014, 5930619385013680 },
+			{ 3796566670990371694, 5938113591738401 },
+			{ 3802504784582110095, 5945629012228867 },
+			{ 3808450413594338962, 5953165717923370 },
+			{ 3814403579312262332, 5960723780575699 },
+			{ 3820364303092838031, 5968303272256848 },
+			{ 3826332606365094879, 5975904265356621 },
+			{ 3832308510630451500, 5983526832585345 },
+			{ 3838292037463036845, 5991171046975490 },
+			{ 3844283208510012335, 5998836981883423 },
+			{ 3850282045491895758, 6006524710991025 },
+			{ 3856288570202886783, 6014234308307484 },
+			{ 3862302804511194267, 6021965848170936 },
+			{ 3868324770359365203, 6029719405250235 },
+			{ 3874354489764615438, 6037495054546684 },
+			{ 3880391984819162122, 6045292871395786 },
+			{ 3886437277690557908, 6053112931468994 },
+			{ 3892490390622026902, 6060955310775491 },
+			{ 3898551345932802393, 6068820085663966 },
+			{ 3904620166018466359, 6076707332824422 },
+			{ 3910696873351290781, 6084617129289958 },
+			{ 3916781490480580739, 6092549552438599 },
+			{ 3922874040033019338, 6100504679995116 },
+			{ 3928974544713014454, 6108482590032870 },
+			{ 3935083027303047324, 6116483360975664 },
+			{ 3941199510664022988, 6124507071599589 },
+			{ 3947324017735622577, 6132553801034914 },
+			{ 3953456571536657491, 6140623628767954 },
+			{ 3959597195165425445, 6148716634642991 },
+			{ 3965745911800068436, 6156832898864132 },
+			{ 3971902744698932568, 6164972501997317 },
+			{ 3978067717200929885, 6173135524972136 },
+			{ 3984240852725902021, 6181322049083880 },
+			{ 3990422174774985901, 6189532155995439 },
+			{ 3996611706930981340, 6197765927739248 },
+			{ 4002809472858720588, 6206023446719360 },
+			{ 4009015496305439948, 6214304795713349 },
+			{ 4015229801101153297, 6222610057874337 },
+			{ 4021452411159027634, 6230939316733052 },
+			{ 4027683350475760686, 6239292656199813 },
+			{ 4033922643131960499, 6247670160566612 },
+			{ 4040170313292527111, 6256071914509121 },
+			{ 4046426385207036232, 6264498003088831 },
+			{ 4052690883210125063, 6272948511755053 },
+			{ 4058963831721880116, 6281423526347101 },
+			{ 4065245255248227217, 6289923133096331 },
+			{ 4071535178381323548, 6298447418628305 },
+			{ 4077833625799951853, 6306996469964907 },
+			{ 4084140622269916760, 6315570374526511 },
+			{ 4090456192644443271, 6324169220134125 },
+			{ 4096780361864577396, 6332793095011585 },
+			{ 4103113154959588981, 6341442087787729 },
+			{ 4109454597047376710, 6350116287498627 },
+			{ 4115804713334875337, 6358815783589786 },
+			{ 4122163529118465123, 6367540665918376 },
+			{ 4128531069784383499, 6376291024755483 },
+			{ 4134907360809138982, 6385066950788407 },
+			{ 4141292427759927389, 6393868535122857 },
+			{ 4147686296295050246, 6402695869285331 },
+			{ 4154088992164335577, 6411549045225379 },
+			{ 4160500541209560956, 6420428155317914 },
+			{ 4166920969364878870, 6429333292365587 },
+			{ 4173350302657244457, 6438264549601082 },
+			{ 4179788567206845539, 6447222020689551 },
+			{ 4186235789227535090, 6456205799730940 },
+			{ 4192691995027266030, 6465215981262400 },
+			{ 4199157211008528430, 6474252660260723 },
+			{ 4205631463668789153, 6483315932144731 },
+			{ 4212114779600933884, 6492405892777772 },
+			{ 4218607185493711656, 6501522638470112 },
+			{ 4225108708132181768, 6510666265981474 },
+			{ 4231619374398163242, 6519836872523490 },
+			{ 4238139211270686732, 6529034555762221 },
+			{ 4244668245826448953, 6538259413820694 },
+			{ 4251206505240269647, 6547511545281414 },
+			{ 4257754016785551061, 6556791049188952 },
+			{ 4264310807834740013, 6566098025052495 },
+			{ 4270876905859792508, 6575432572848449 },
+			{ 4277452338432640957, 6584794793023045 },
+			{ 4284037133225664002, 6594184786494968 },
+			{ 4290631318012158970, 6603602654657970 },
+			{ 4297234920666816940, 6613048499383589 },
+			{ 4303847969166200529, 6622522423023758 },
+			{ 4310470491589224287, 6632024528413540 },
+			{ 4317102516117637827, 6641554918873842 },
+			{ 4323744071036511669, 6651113698214109 },
+			{ 4330395184734725778, 6660700970735125 },
+			{ 4337055885705460903, 6670316841231720 },
+			{ 4343726202546692623, 6679961414995598 },
+			{ 4350406163961688221, 6689634797818132 },
+			{ 4357095798759506353, 6699337095993162 },
+			{ 4363795135855499515, 6709068416319863 },
+			{ 4370504204271819378, 6718828866105583 },
+			{ 4377223033137924961, 6728618553168729 },
+			{ 4383951651691093690, 6738437585841679 },
+			{ 4390690089276935369, 6748286072973643 },
+			{ 4397438375349909012, 6758164123933689 },
+			{ 4404196539473842701, 6768071848613593 },
+			{ 4410964611322456294, 6778009357430902 },
+			{ 4417742620679887196, 6787976761331885 },
+			{ 4424530597441219081, 6797974171794536 },
+			{ 4431328571613013617, 6808001700831649 },
+			{ 4438136573313845266, 6818059460993830 },
+			{ 4444954632774839096, 6828147565372604 },
+			{ 4451782780340211700, 6838266127603493 },
+			{ 4458621046467815193, 6848415261869144 },
+			{ 4465469461729684337, 6858595082902440 },
+			{ 4472328056812586777, 6868805705989707 },
+			{ 4479196862518576484, 6879047246973839 },
+			{ 4486075909765550323, 6889319822257539 },
+			{ 4492965229587807862, 6899623548806519 },
+			{ 4499864853136614381, 6909958544152748 },
+			{ 4506774811680767129, 6920324926397738 },
+			{ 4513695136607164867, 6930722814215800 },
+			{ 4520625859421380667, 6941152326857374 },
+			{ 4527567011748238041, 6951613584152369 },
+			{ 4534518625332390410, 6962106706513494 },
+			{ 4541480732038903904, 6972631814939646 },
+			{ 4548453363853843550, 6983189031019337 },
+			{ 4555436552884862887, 6993778476934073 },
+			{ 4562430331361796960, 7004400275461832 },
+			{ 4569434731637258792, 7015054549980532 },
+			{ 4576449786187239324, 7025741424471517 },
+			{ 4583475527611710841, 7036461023523075 },
+			{ 4590511988635233916, 7047213472333990 },
+			{ 4597559202107567906, 7057998896717101 },
+			{ 4604617201004285007, 7068817423102897 },
+#endif
+		};
+	};
 
+	// Arctangent table over [0, 1] in Q1.62, atan2 folds every octant onto it.
+	//
+	// max error over [0, 1] with FIXED_64_TRIG_LUT_BITS 10:
+	//   linear     7.7e-8, 16 KB
+	//   quadratic  1.5e-11, 24 KB
+	struct atan_lut
+	{
+		static constexpr unsigned int BITS = 10;
+		static constexpr size_t COUNT = size_t(1) << BITS;
 
+		static constexpr internal::trig_lut_entry data[COUNT] =
+		{
+#if FIXED_64_TRIG_LUT_INTERPOLATION >= 2
+			{ 0, 4503600343197659, -2147482110ll },
+			{ 4503598195715549, 4503596048227294, -6442421760ll },
+			{ 9007187801521083, 4503583163371483, -10737287678ll },
+			{ 13510760227604888, 4503561688777686, -15032030720ll },
+			{ 18014306884351854, 4503531624691661, -19326601746ll },
+			{ 22517819182441769, 4503492971457444, -23620951608ll },
+			{ 27021288532947605, 4503445729517374, -27915031184ll },
+			{ 31524706347433795, 4503389899412020, -32208791324ll },
+			{ 36028064038054491, 4503325481780240, -36502182924ll },
+			{ 40531353017651807, 4503252477359118, -40795156880ll },
+			{ 45034564699854045, 4503170886983952, -45087664096ll },
+			{ 49537690499173901, 4503080711588217, -49379655482ll },
+			{ 54040721831106636, 4502981952203573, -53671081986ll },
+			{ 58543650112228223, 4502874609959799, -57961894550ll },
+			{ 63046466760293472, 4502758686084767, -62252044130ll },
+			{ 67549163194334109, 4502634181904441, -66541481730ll },
+			{ 72051730834756820, 4502501098842796, -70830158348ll },
+			{ 76554161103441268, 4502359438421800, -75118025020ll },
+			{ 81056445423838048, 4502209202261356, -79405032780ll },
+			{ 85558575221066624, 4502050392079262, -83691132708ll },
+			{ 90060541922013178, 4501883009691199, -87976275918ll },
+			{ 94562336955428459, 4501707057010609, -92260413534ll },
+			{ 99063951752025534, 4501522536048682, -96543496704ll },
+			{ 103565377744577512, 4501329448914315, -100825476634ll },
+			{ 108066606368015193, 4501127797813998, -105106304528ll },
+			{ 112567629059524663, 4500917585051803, -109385931642ll },
+			{ 117068437258644824, 4500698813029292, -113664309264ll },
+			{ 121569022407364852, 4500471484245461, -117941388718ll },
+			{ 126069375950221595, 4500235601296632, -122217121344ll },
+			{ 130569489334396883, 4499991166876465, -126491458570ll },
+			{ 135069354009814778, 4499738183775793, -130764351830ll },
+			{ 139568961429238741, 4499476654882554, -135035752584ll },
+			{ 144068303048368711, 4499206583181747, -139305612350ll },
+			{ 148567370325938108, 4498927971755346, -143573882708ll },
+			{ 153066154723810746, 4498640823782180, -147840515268ll },
+			{ 157564647707077658, 4498345142537860, -152105461684ll },
+			{ 162062840744153834, 4498040931394673, -156368673654ll },
+			{ 166560725306874853, 4497728193821520, -160630102944ll },
+			{ 171058292870593429, 4497406933383768, -164889701352ll },
+			{ 175555534914275845, 4497077153743193, -169147420734ll },
+			{ 180052442920598304, 4496738858657838, -173403212996ll },
+			{ 184549008376043146, 4496392051981949, -177657030110ll },
+			{ 189045222770994985, 4496036737665831, -181908824102ll },
+			{ 193541077599836714, 4495672919755749, -186158547046ll },
+			{ 198036564361045417, 4495300602393788, -190406151076ll },
+			{ 202531674557288129, 4494919789817810, -194651588404ll },
+			{ 207026399695517535, 4494530486361214, -198894811268ll },
+			{ 211520731287067481, 4494132696452937, -203135772006ll },
+			{ 216014660847748412, 4493726424617239, -207374422994ll },
+			{ 220508179897942657, 4493311675473631, -211610716694ll },
+			{ 225001279962699594, 4492888453736689, -215844605606ll },
+			{ 229493952571830677, 4492456764215986, -220076042336ll },
+			{ 233986189260004327, 4492016611815914, -224304979536ll },
+			{ 238477981566840705, 4491568001535536, -228531369928ll },
+			{ 242969321037006313, 4491110938468483, -232755166314ll },
+			{ 247460199220308482, 4490645427802761, -236976321562ll },
+			{ 251950607671789681, 4490171474820678, -241194788636ll },
+			{ 256440537951821723, 4489689084898595, -245410520530ll },
+			{ 260929981626199788, 4489198263506846, -249623470352ll },
+			{ 265418930266236282, 4488699016209609, -253833591302ll },
+			{ 269907375448854589, 4488191348664632, -258040836616ll },
+			{ 274395308756682605, 4487675266623207, -262245159642ll },
+			{ 278882721778146170, 4487150775929905, -266446513794ll },
+			{ 283369606107562281, 4486617882522489, -270644852590ll },
+			{ 287855953345232180, 4486076592431691, -274840129610ll },
+			{ 292341755097534261, 4485526911781058, -279032298536ll },
+			{ 296827002977016783, 4484968846786808, -283221313128ll },
+			{ 301311688602490463, 4484402403757604, -287407127240ll },
+			{ 305795803599120827, 4483827589094434, -291589694820ll },
+			{ 310279339598520441, 4483244409290369, -295768969890ll },
+			{ 314762288238840920, 4482652870930446, -299944906588ll },
+			{ 319244641164864778, 4482052980691408, -304117459108ll },
+			{ 323726390028097078, 4481444745341601, -308286581786ll },
+			{ 328207526486856893, 4480828171740749, -312452229046ll },
+			{ 332688042206368596, 4480203266839711, -316614355370ll },
+			{ 337167928858852937, 4479570037680353, -320772915374ll },
+			{ 341647178123617916, 4478928491395342, -324927863764ll },
+			{ 346125781687149494, 4478278635207902, -329079155336ll },
+			{ 350603731243202060, 4477620476431686, -333226745016ll },
+			{ 355081018492888730, 4476954022470486, -337370587800ll },
+			{ 359557635144771416, 4476279280818116, -341510638828ll },
+			{ 364033572914950704, 4475596259058099, -345646853286ll },
+			{ 368508823527155517, 4474904964863571, -349779186538ll },
+			{ 372983378712832550, 4474205405996993, -353907594018ll },
+			{ 377457230211235525, 4473497590309903, -358032031242ll },
+			{ 381930369769514186, 4472781525742830, -362152453900ll },
+			{ 386402789142803116, 4472057220324924, -366268817744ll },
+			{ 390874480094310296, 4471324682173811, -370381078646ll },
+			{ 395345434395405461, 4470583919495402, -374489192632ll },
+			{ 399815643825708231, 4469834940583534, -378593115764ll },
+			{ 404285100173176001, 4469077753819925, -382692804326ll },
+			{ 408753795234191600, 4468312367673773, -386788214630ll },
+			{ 413221720813650743, 4467538790701573, -390879303114ll },
+			{ 417688868725049202, 4466757031546979, -394966026402ll },
+			{ 422155230790569779, 4465967098940416, -399048341168ll },
+			{ 426620798841169027, 4465169001698915, -403126204230ll },
+			{ 431085564716663712, 4464362748725905, -407199572558ll },
+			{ 435549520265817059, 4463548349010894, -411268403220ll },
+			{ 440012657346424733, 4462725811629232, -415332653388ll },
+			{ 444474967825400577, 4461895145741894, -419392280384ll },
+			{ 448936443578862087, 4461056360595256, -423447241676ll },
+			{ 453397076492215667, 4460209465520741, -427497494830ll },
+			{ 457856858460241578, 4459354469934647, -431542997534ll },
+			{ 462315781387178691, 4458491383337874, -435583707644ll },
+			{ 466773837186808921, 4457620215315631, -439619583118ll },
+			{ 471231017782541434, 4456740975537216, -443650582052ll },
+			{ 475687315107496598, 4455853673755722, -447676662688ll },
+			{ 480142721104589632, 4454958319807769, -451697783374ll },
+			{ 484597227726614027, 4454054923613249, -455713902618ll },
+			{ 489050826936324658, 4453143495175082, -459724979068ll },
+			{ 493503510706520672, 4452224044578868, -463730971488ll },
+			{ 497955271020128052, 4451296581992691, -467731838794ll },
+			{ 502406099870281949, 4450361117666776, -471727540032ll },
+			{ 506855989260408693, 4449417661933298, -475718034420ll },
+			{ 511304931204307571, 4448466225205990, -479703281268ll },
+			{ 515752917726232293, 4447506817979922, -483683240052ll },
+			{ 520199940860972163, 4446539450831257, -487657870402ll },
+			{ 524645992653933018, 4445564134416852, -491627132068ll },
+			{ 529091065161217802, 4444580879474118, -495590984984ll },
+			{ 533535150449706936, 4443589696820582, -499549389192ll },
+			{ 537978240597138326, 4442590597353651, -503502304874ll },
+			{ 542420327692187103, 4441583592050415, -507449692422ll },
+			{ 546861403834545096, 4440568691967168, -511391512300ll },
+			{ 551301461134999964, 4439545908239235, -515327725158ll },
+			{ 555740491715514041, 4438515252080693, -519258291822ll },
+			{ 560178487709302912, 4437476734783962, -523183173228ll },
+			{ 564615441260913646, 4436430367719562, -527102330468ll },
+			{ 569051344526302740, 4435376162335861, -531015724830ll },
+			{ 573486189672913771, 4434314130158627, -534923317674ll },
+			{ 577919968879754724, 4433244282790882, -538825070608ll },
+			{ 582352674337474998, 4432166631912489, -542720945346ll },
+			{ 586784298248442141, 4431081189279868, -546610903760ll },
+			{ 591214832826818249, 4429987966725680, -550494907900ll },
+			{ 595644270298636029, 4428886976158501, -554372919942ll },
+			{ 600072602901874588, 4427778229562541, -558244902254ll },
+			{ 604499822886534875, 4426661738997289, -562110817346ll },
+			{ 608925922514714818, 4425537516597190, -565970627884ll },
+			{ 613350894060684124, 4424405574571389, -569824296730ll },
+			{ 617774729810958783, 4423265925203296, -573671786856ll },
+			{ 622197422064375223, 4422118580850337, -577513061422ll },
+			{ 626618963132164138, 4420963553943665, -581348083790ll },
+			{ 631039345338024013, 4419800856987715, -585176817426ll },
+			{ 635458561018194302, 4418630502559967, -588999225990ll },
+			{ 639876602521528279, 4417452503310570, -592815273300ll },
+			{ 644293462209565549, 4416266871962061, -596624923362ll },
+			{ 648709132456604248, 4415073621308960, -600428140336ll },
+			{ 653123605649772872, 4413872764217490, -604224888544ll },
+			{ 657536874189101818, 4412664313625172, -608015132452ll },
+			{ 661948930487594538, 4411448282540620, -611798836776ll },
+			{ 666359766971298382, 4410224684043039, -615575966322ll },
+			{ 670769376079375099, 4408993531281991, -619346486110ll },
+			{ 675177750264170980, 4407754837477028, -623110361332ll },
+			{ 679584881991286676, 4406508615917306, -626867557316ll },
+			{ 683990763739646666, 4405254879961297, -630618039606ll },
+			{ 688395388001568357, 4403993643036436, -634361773912ll },
+			{ 692798747282830881, 4402724918638724, -638098726112ll },
+			{ 697200834102743493, 4401448720332389, -641828862222ll },
+			{ 701601640994213660, 4400165061749603, -645552148502ll },
+			{ 706001160503814761, 4398873956590064, -649268551352ll },
+			{ 710399385191853473, 4397575418620664, -652978037360ll },
+			{ 714796307632436777, 4396269461675102, -656680573276ll },
+			{ 719191920413538603, 4394956099653601, -660376126050ll },
+			{ 723586216137066154, 4393635346522458, -664064662784ll },
+			{ 727979187418925828, 4392307216313762, -667746150792ll },
+			{ 732370826889088798, 4390971723125004, -671420557540ll },
+			{ 736761127191656262, 4389628881118716, -675087850700ll },
+			{ 741150080984924278, 4388278704522089, -678747998098ll },
+			{ 745537680941448269, 4386921207626676, -682400967780ll },
+			{ 749923919748107165, 4385556404787946, -686046727940ll },
+			{ 754308790106167171, 4384184310424964, -689685246968ll },
+			{ 758692284731345167, 4382804939019997, -693316493418ll },
+			{ 763074396353871746, 4381418305118227, -696940436086ll },
+			{ 767455117718553887, 4380024423327254, -700557043892ll },
+			{ 771834441584837249, 4378623308316836, -704166285976ll },
+			{ 776212360726868109, 4377214974818435, -707768131622ll },
+			{ 780588867933554922, 4375799437624916, -711362550356ll },
+			{ 784963956008629482, 4374376711590153, -714949511858ll },
+			{ 789337617770707777, 4372946811628629, -718528986014ll },
+			{ 793709846053350392, 4371509752715066, -722100942868ll },
+			{ 798080633705122590, 4370065549884091, -725665352678ll },
+			{ 802449973589654003, 4368614218229807, -729222185882ll },
+			{ 806817858585697928, 4367155772905466, -732771413120ll },
+			{ 811184281587190274, 4365690229123025, -736313005186ll },
+			{ 815549235503308113, 4364217602152824, -739846933088ll },
+			{ 819912713258527849, 4362737907323216, -743373168044ll },
+			{ 824274707792683021, 4361251160020135, -746891681450ll },
+			{ 828635212061021706, 4359757375686718, -750402444856ll },
+			{ 832994219034263568, 4358256569822967, -753905430050ll },
+			{ 837351721698656485, 4356748757985336, -757400608996ll },
+			{ 841707713056032825, 4355233955786339, -760887953842ll },
+			{ 846062186123865322, 4353712178894224, -764367436964ll },
+			{ 850415133935322582, 4352183443032459, -767839030870ll },
+			{ 854766549539324171, 4350647763979491, -771302708294ll },
+			{ 859116426000595368, 4349105157568276, -774758442192ll },
+			{ 863464756399721452, 4347555639685938, -778206205680ll },
+			{ 867811533833201710, 4345999226273301, -781645972062ll },
+			{ 872156751413502949, 4344435933324584, -785077714852ll },
+			{ 876500402269112681, 4342865776887015, -788501407790ll },
+			{ 880842479544591906, 4341288773060317, -791917024730ll },
+			{ 885182976400627493, 4339704937996497, -795324539806ll },
+			{ 889521886014084184, 4338114287899316, -798723927304ll },
+			{ 893859201578056196, 4336516839023971, -802115161738ll },
+			{ 898194916301918429, 4334912607676627, -805498217750ll },
+			{ 902529023411377306, 4333301610214126, -808873070256ll },
+			{ 906861516148521176, 4331683863043505, -812239694318ll },
+			{ 911192387771870363, 4330059382621673, -815598065238ll },
+			{ 915521631556426798, 4328428185454952, -818948158480ll },
+			{ 919849240793723270, 4326790288098723, -822289949730ll },
+			{ 924175208791872263, 4325145707157004, -825623414840ll },
+			{ 928499528875614427, 4323494459282073, -828948529890ll },
+			{ 932822194386366610, 4321836561174108, -832265271172ll },
+			{ 937143198682269546, 4320172029580652, -835573615104ll },
+			{ 941462535138235094, 4318500881296427, -838873538398ll },
+			{ 945780197145993123, 4316823133162718, -842165017884ll },
+			{ 950096178114137957, 4315138802067167, -845448030654ll },
+			{ 954410471468174470, 4313447904943250, -848722553980ll },
+			{ 958723070650563740, 4311750458769885, -851988565294ll },
+			{ 963033969120768331, 4310046480571110, -855246042284ll },
+			{ 967343160355297157, 4308335987415609, -858494962798ll },
+			{ 971650637847749968, 4306618996416347, -861735304906ll },
+			{ 975956395108861409, 4304895524730166, -864967046864ll },
+			{ 980260425666544711, 4303165589557383, -868190167146ll },
+			{ 984562723065934948, 4301429208141391, -871404644414ll },
+			{ 988863280869431925, 4299686397768249, -874610457522ll },
+			{ 993162092656742652, 4297937175766273, -877807585522ll },
+			{ 997459152024923403, 4296181559505695, -880996007710ll },
+			{ 1001754452588421388, 4294419566398208, -884175703548ll },
+			{ 1006047987979116048, 4292651213896519, -887346652670ll },
+			{ 1010339751846359897, 4290876519494070, -890508834968ll },
+			{ 1014629737857018999, 4289095500724561, -893662230518ll },
+			{ 1018917939695513042, 4287308175161479, -896806819538ll },
+			{ 1023204351063854983, 4285514560417915, -899942582562ll },
+			{ 1027488965681690336, 4283714674145926, -903069500244ll },
+			{ 1031771777286336018, 4281908534036204, -906187553412ll },
+			{ 1036052779632818810, 4280096157817779, -909296723170ll },
+			{ 1040331966493913419, 4278277563257500, -912396990788ll },
+			{ 1044609331660180131, 4276452768159679, -915488337746ll },
+			{ 1048884868940002064, 4274621790365671, -918570745710ll },
+			{ 1053158572159622025, 4272784647753490, -921644196560ll },
+			{ 1057430435163178955, 4270941358237396, -924708672368ll },
+			{ 1061700451812743983, 4269091939767490, -927764155396ll },
+			{ 1065968615988356077, 4267236410329327, -930810628138ll },
+			{ 1070234921588057266, 4265374787943524, -933848073272ll },
+			{ 1074499362527927518, 4263507090665326, -936876473688ll },
+			{ 1078761932742119156, 4261633336584196, -939895812440ll },
+			{ 1083022626182890912, 4259753543823478, -942906072824ll },
+			{ 1087281436820641566, 4257867730539929, -945907238322ll },
+			{ 1091538358643943173, 4255975914923382, -948899292624ll },
+			{ 1095793385659573931, 4254078115196227, -951882219586ll },
+			{ 1100046511892550572, 4252174349613175, -954856003298ll },
+			{ 1104297731386160449, 4250264636460740, -957820628052ll },
+			{ 1108547038201993137, 4248348994056867, -960776078326ll },
+			{ 1112794426419971678, 4246427440750542, -963722338788ll },
+			{ 1117039890138383432, 4244499994921408, -966659394348ll },
+			{ 1121283423473910492, 4242566674979312, -969587230056ll },
+			{ 1125525020561659748, 4240627499363968, -972505831228ll },
+			{ 1129764675555192488, 4238682486544499, -975415183302ll },
+			{ 1134002382626553685, 4236731655019093, -978315271982ll },
+			{ 1138238135966300796, 4234775023314571, -981206083134ll },
+			{ 1142471929783532233, 4232812609986010, -984087602848ll },
+			{ 1146703758305915395, 4230844433616315, -986959817390ll },
+			{ 1150933615779714320, 4228870512815861, -989822713242ll },
+			{ 1155161496469816939, 4226890866222058, -992676277072ll },
+			{ 1159387394659761925, 4224905512498954, -995520495728ll },
+			{ 1163611304651765151, 4222914470336935, -998355356326ll },
+			{ 1167833220766745760, 4220917758452141, -1001180846082ll },
+			{ 1172053137344351819, 4218915395586282, -1003996952496ll },
+			{ 1176271048742985605, 4216907400506061, -1006803663206ll },
+			{ 1180486949339828460, 4214893792002928, -1009600966080ll },
+			{ 1184700833530865308, 4212874588892549, -1012388849154ll },
+			{ 1188912695730908703, 4210849810014555, -1015167300702ll },
+			{ 1193122530373622556, 4208819474232038, -1017936309168ll },
+			{ 1197330331911545426, 4206783600431178, -1020695863176ll },
+			{ 1201536094816113428, 4204742207520908, -1023445951584ll },
+			{ 1205739813577682752, 4202695314432479, -1026186563430ll },
+			{ 1209941482705551801, 4200642940119030, -1028917687908ll },
+			{ 1214141096727982923, 4198585103555307, -1031639314486ll },
+			{ 1218338650192223744, 4196521823737165, -1034351432754ll },
+			{ 1222534137664528155, 4194453119681210, -1037054032520ll },
+			{ 1226727553730176845, 4192379010424489, -1039747103826ll },
+			{ 1230918892993497508, 4190299515023946, -1042430636820ll },
+			{ 1235108150077884634, 4188214652556214, -1045104621952ll },
+			{ 1239295319625818896, 4186124442117057, -1047769049766ll },
+			{ 1243480396298886187, 4184028902821144, -1050423911080ll },
+			{ 1247663374777796251, 4181928053801495, -1053069196830ll },
+			{ 1251844249762400916, 4179821914209242, -1055704898180ll },
+			{ 1256023015971711978, 4177710503213203, -1058331006510ll },
+			{ 1260199668143918671, 4175593839999478, -1060947513384ll },
+			{ 1264374201036404765, 4173471943770998, -1063554410484ll },
+			{ 1268546609425765279, 4171344833747302, -1066151689772ll },
+			{ 1272716888107822809, 4169212529164057, -1068739343370ll },
+			{ 1276885031897643496, 4167075049272668, -1071317363580ll },
+			{ 1281051035629552584, 4164932413339928, -1073885742900ll },
+			{ 1285214894157149612, 4162784640647643, -1076444474018ll },
+			{ 1289376602353323237, 4160631750492230, -1078993549812ll },
+			{ 1293536155110265655, 4158473762184385, -1081532963362ll },
+			{ 1297693547339486678, 4156310695048631, -1084062707910ll },
+			{ 1301848773971827399, 4154142568422969, -1086582776858ll },
+			{ 1306001829957473510, 4151969401658616, -1089093163896ll },
+			{ 1310152710265968230, 4149791214119441, -1091593862810ll },
+			{ 1314301409886224861, 4147608025181694, -1094084867584ll },
+			{ 1318447923826538971, 4145419854233703, -1096566172454ll },
+			{ 1322592247114600220, 4143226720675295, -1099037771718ll },
+			{ 1326734374797503797, 4141028643917653, -1101499659990ll },
+			{ 1330874301941761460, 4138825643382828, -1103951831992ll },
+			{ 1335012023633312296, 4136617738503362, -1106394282656ll },
+			{ 1339147534977533002, 4134404948721985, -1108827007106ll },
+			{ 1343280831099247881, 4132187293491136, -1111250000592ll },
+			{ 1347411907142738425, 4129964792272750, -1113663258624ll },
+			{ 1351540758271752551, 4127737464537777, -1116066776850ll },
+			{ 1355667379669513478, 4125505329765824, -1118460551092ll },
+			{ 1359791766538728210, 4123268407444881, -1120844577394ll },
+			{ 1363913914101595697, 4121026717070875, -1123218851974ll },
+			{ 1368033817599814598, 4118780278147289, -1125583371166ll },
+			{ 1372151472294590721, 4116529110184883, -1127938131562ll },
+			{ 1376266873466644042, 4114273232701293, -1130283129898ll },
+			{ 1380380016416215437, 4112012665220660, -1132618363088ll },
+			{ 1384490896463073009, 4109747427273288, -1134943828228ll },
+			{ 1388599508946518069, 4107477538395309, -1137259522622ll },
+			{ 1392705849225390756, 4105203018128265, -1139565443690ll },
+			{ 1396809912678075331, 4102923886018803, -1141861589062ll },
+			{ 1400911694702505072, 4100640161618313, -1144147956550ll },
+			{ 1405011190716166835, 4098351864482614, -1146424544160ll },
+			{ 1409108396156105289, 4096059014171474, -1148691350000ll },
+			{ 1413203306478926763, 4093761630248438, -1150948372444ll },
+			{ 1417295917160802757, 4091459732280335, -1153195609994ll },
+			{ 1421386223697473098, 4089153339836994, -1155433061316ll },
+			{ 1425474221604248776, 4086842472490891, -1157660725274ll },
+			{ 1429559906416014393, 4084527149816767, -1159878600862ll },
+			{ 1433643273687230298, 4082207391391366, -1162086687320ll },
+			{ 1437724318991934344, 4079883216792997, -1164284983974ll },
+			{ 1441803037923743367, 4077554645601235, -1166473490382ll },
+			{ 1445879426095854220, 4075221697396634, -1168652206276ll },
+			{ 1449953479141044578, 4072884391760239, -1170821131494ll },
+			{ 1454025192711673323, 4070542748273437, -1172980266134ll },
+			{ 1458094562479680626, 4068196786517405, -1175129610354ll },
+			{ 1462161584136587677, 4065846526072985, -1177269164562ll },
+			{ 1466226253393496100, 4063491986520216, -1179398929324ll },
+			{ 1470288565981086992, 4061133187438023, -1181518905334ll },
+			{ 1474348517649619681, 4058770148403933, -1183629093506ll },
+			{ 1478406104168930108, 4056402888993672, -1185729494876ll },
+			{ 1482461321328428904, 4054031428780815, -1187820110610ll },
+			{ 1486514164937099109, 4051655787336656, -1189900942168ll },
+			{ 1490564630823493597, 4049275984229597, -1191971991038ll },
+			{ 1494612714835732156, 4046892039025018, -1194033258960ll },
+			{ 1498658412841498214, 4044503971284853, -1196084747758ll },
+			{ 1502701720728035309, 4042111800567321, -1198126459486ll },
+			{ 1506742634402143144, 4039715546426622, -1200158396360ll },
+			{ 1510781149790173406, 4037315228412492, -1202180560696ll },
+			{ 1514817262838025202, 4034910866070021, -1204192955014ll },
+			{ 1518850969511140209, 4032502478939257, -1206195581986ll },
+			{ 1522882265794497480, 4030090086554915, -1208188444442ll },
+			{ 1526911147692607953, 4027673708446047, -1210171545370ll },
+			{ 1530937611229508630, 4025253364135724, -1212144887904ll },
+			{ 1534961652448756450, 4022829073140763, -1214108475366ll },
+			{ 1538983267413421847, 4020400854971314, -1216062311184ll },
+			{ 1543002452206081977, 4017968729130664, -1218006398992ll },
+			{ 1547019202928813649, 4015532715114890, -1219940742564ll },
+			{ 1551033515703185975, 4013092832412481, -1221865345818ll },
+			{ 1555045386670252638, 4010649100504092, -1223780212800ll },
+			{ 1559054811990543930, 4008201538862263, -1225685347770ll },
+			{ 1563061787844058423, 4005750166951046, -1227580755092ll },
+			{ 1567066310430254377, 4003295004225765, -1229466439310ll },
+			{ 1571068375968040832, 4000836070132632, -1231342405092ll },
+			{ 1575067980695768372, 3998373384108552, -1233208657284ll },
+			{ 1579065120871219640, 3995906965580732, -1235065200872ll },
+			{ 1583059792771599500, 3993436833966388, -1236912040940ll },
+			{ 1587051992693524948, 3990963008672551, -1238749182834ll },
+			{ 1591041716953014665, 3988485509095637, -1240576631930ll },
+			{ 1595028961885478372, 3986004354621216, -1242394393832ll },
+			{ 1599013723845705756, 3983519564623742, -1244202474244ll },
+			{ 1602995999207855254, 3981031158466196, -1246000879028ll },
+			{ 1606975784365442422, 3978539155499832, -1247789614184ll },
+			{ 1610953075731328070, 3976043575063911, -1249568685866ll },
+			{ 1614927869737706115, 3973544436485422, -1251338100408ll },
+			{ 1618900162836091129, 3971041759078649, -1253097864198ll },
+			{ 1622869951497305580, 3968535562145137, -1254847983854ll },
+			{ 1626837232211466863, 3966025864973159, -1256588466086ll },
+			{ 1630802001487973936, 3963512686837618, -1258319317744ll },
+			{ 1634764255855493810, 3960996046999621, -1260040545818ll },
+			{ 1638723991861947613, 3958475964706363, -1261752157490ll },
+			{ 1642681206074496486, 3955952459190705, -1263454160014ll },
+			{ 1646635895079527177, 3953425549670918, -1265146560792ll },
+			{ 1650588055482637303, 3950895255350525, -1266829367406ll },
+			{ 1654537683908620422, 3948361595417866, -1268502587532ll },
+			{ 1658484777001450756, 3945824589045969, -1270166229014ll },
+			{ 1662429331424267711, 3943284255392091, -1271820299754ll },
+			{ 1666371343859360048, 3940740613597764, -1273464807924ll },
+			{ 1670310811008149888, 3938193682788134, -1275099761700ll },
+			{ 1674247729591176322, 3935643482072032, -1276725169472ll },
+			{ 1678182096348078882, 3933090030541468, -1278341039688ll },
+			{ 1682113908037580662, 3930533347271544, -1279947381000ll },
+			{ 1686043161437471206, 3927973451320080, -1281544202152ll },
+			{ 1689969853344589134, 3925410361727426, -1283131512056ll },
+			{ 1693893980574804504, 3922844097516109, -1284709319682ll },
+			{ 1697815539963000931, 3920274677690672, -1286277634200ll },
+			{ 1701734528363057403, 3917702121237352, -1287836464844ll },
+			{ 1705650942647829911, 3915126447123922, -1289385821072ll },
+			{ 1709564779709132761, 3912547674299250, -1290925712344ll },
+			{ 1713476036457719667, 3909965821693259, -1292456148338ll },
+			{ 1717384709823264588, 3907380908216537, -1293977138814ll },
+			{ 1721290796754342311, 3904792952760107, -1295488693642ll },
+			{ 1725194294218408776, 3902201974195252, -1296990822856ll },
+			{ 1729095199201781172, 3899607991373243, -1298483536626ll },
+			{ 1732993508709617789, 3897011023125000, -1299966845196ll },
+			{ 1736889219765897593, 3894411088260933, -1301440758906ll },
+			{ 1740782329413399620, 3891808205570741, -1302905288314ll },
+			{ 1744672834713682047, 3889202393823064, -1304360444008ll },
+			{ 1748560732747061103, 3886593671765319, -1305806236746ll },
+			{ 1752446020612589676, 3883982058123463, -1307242677390ll },
+			{ 1756328695428035749, 3881367571601718, -1308669776932ll },
+			{ 1760208754329860535, 3878750230882332, -1310087546428ll },
+			{ 1764086194473196439, 3876130054625362, -1311495997080ll },
+			{ 1767961013031824721, 3873507061468489, -1312895140218ll },
+			{ 1771833207198152992, 3870881270026756, -1314284987300ll },
+			{ 1775702774183192448, 3868252698892310, -1315665549876ll },
+			{ 1779569711216534882, 3865621366634199, -1317036839610ll },
+			{ 1783434015546329471, 3862987291798106, -1318398868240ll },
+			{ 1787295684439259337, 3860350492906228, -1319751647684ll },
+			{ 1791154715180517881, 3857710988456952, -1321095189928ll },
+			{ 1795011105073784905, 3855068796924699, -1322429507098ll },
+			{ 1798864851441202506, 3852423936759651, -1323754611398ll },
+			{ 1802715951623350759, 3849776426387546, -1325070515136ll },
+			{ 1806564402979223169, 3847126284209517, -1326377230774ll },
+			{ 1810410202886201912, 3844473528601811, -1327674770838ll },
+			{ 1814253348740032885, 3841818177915574, -1328963147956ll },
+			{ 1818093837954800503, 3839160250476698, -1330242374884ll },
+			{ 1821931667962902317, 3836499764585569, -1331512464486ll },
+			{ 1825766836215023400, 3833836738516871, -1332773429730ll },
+			{ 1829599340180110541, 3831171190519343, -1334025283650ll },
+			{ 1833429177345346234, 3828503138815623, -1335268039414ll },
+			{ 1837256345216122443, 3825832601602035, -1336501710310ll },
+			{ 1841080841316014168, 3823159597048349, -1337726309674ll },
+			{ 1844902663186752843, 3820484143297589, -1338941850966ll },
+			{ 1848721808388199466, 3817806258465933, -1340148347806ll },
+			{ 1852538274498317593, 3815125960642343, -1341345813822ll },
+			{ 1856352059113146114, 3812443267888433, -1342534262734ll },
+			{ 1860163159846771813, 3809758198238409, -1343713708474ll },
+			{ 1863971574331301748, 3807070769698673, -1344884164966ll },
+			{ 1867777300216835455, 3804381000247725, -1346045646246ll },
+			{ 1871580335171436934, 3801688907835975, -1347198166478ll },
+			{ 1875380676881106431, 3798994510385542, -1348341739880ll },
+			{ 1879178323049752093, 3796297825790123, -1349476380834ll },
+			{ 1882973271399161382, 3793598871914626, -1350602103712ll },
+			{ 1886765519668972296, 3790897666595195, -1351718923030ll },
+			{ 1890555065616644461, 3788194227638929, -1352826853418ll },
+			{ 1894341907017429972, 3785488572823714, -1353925909576ll },
+			{ 1898126041664344110, 3782780719898053, -1355016106314ll },
+			{ 1901907467368135849, 3780070686580790, -1356097458448ll },
+			{ 1905686181957258191, 3777358490561123, -1357169980998ll },
+			{ 1909462183277838316, 3774644149498249, -1358233688986ll },
+			{ 1913235469193647579, 3771927681021278, -1359288597564ll },
+			{ 1917006037586071293, 3769209102729059, -1360334721958ll },
+			{ 1920773886354078394, 3766488432189993, -1361372077502ll },
+			{ 1924539013414190885, 3763765686941784, -1362400679532ll },
+			{ 1928301416700453137, 3761040884491441, -1363420543566ll },
+			{ 1932061094164401012, 3758314042314963, -1364431685158ll },
+			{ 1935818043775030817, 3755585177857286, -1365434119980ll },
+			{ 1939572263518768123, 3752854308531940, -1366427863708ll },
+			{ 1943323751399436355, 3750121451721125, -1367412932190ll },
+			{ 1947072505438225290, 3747386624775367, -1368389341290ll },
+			{ 1950818523673659367, 3744649845013372, -1369357106952ll },
+			{ 1954561804161565787, 3741911129722046, -1370316245268ll },
+			{ 1958302344975042565, 3739170496156117, -1371266772346ll },
+			{ 1962040144204426336, 3736427961538045, -1372208704382ll },
+			{ 1965775199957259999, 3733683543057977, -1373142057666ll },
+			{ 1969507510358260310, 3730937257873380, -1374066848512ll },
+			{ 1973237073549285178, 3728189123109155, -1374983093382ll },
+			{ 1976963887689300951, 3725439155857247, -1375890808762ll },
+			{ 1980687950954349436, 3722687373176662, -1376790011240ll },
+			{ 1984409261537514858, 3719933792093195, -1377680717434ll },
+			{ 1988127817648890619, 3717178429599418, -1378562944116ll },
+			{ 1991843617515545921, 3714421302654424, -1379436708048ll },
+			{ 1995556659381492297, 3711662428183659, -1380302026070ll },
+			{ 1999266941507649886, 3708901823078958, -1381158915136ll },
+			{ 2002974462171813708, 3706139504198242, -1382007392276ll },
+			{ 2006679219668619674, 3703375488365421, -1382847474522ll },
+			{ 2010381212309510573, 3700609792370247, -1383679179022ll },
+			{ 2014080438422701798, 3697842432968236, -1384502522996ll },
+			{ 2017776896353147038, 3695073426880453, -1385317523686ll },
+			{ 2021470584462503805, 3692302790793453, -1386124198446ll },
+			{ 2025161501129098812, 3689530541359108, -1386922564692ll },
+			{ 2028849644747893228, 3686756695194455, -1387712639858ll },
+			{ 2032535013730447825, 3683981268881623, -1388494441510ll },
+			{ 2036217606504887938, 3681204278967733, -1389267987250ll },
+			{ 2039897421515868421, 3678425741964545, -1390033294674ll },
+			{ 2043574457224538292, 3675645674348729, -1390790381578ll },
+			{ 2047248712108505443, 3672864092561334, -1391539265668ll },
+			{ 2050920184661801109, 3670081013007984, -1392279964852ll },
+			{ 2054588873394844241, 3667296452058527, -1393012496974ll },
+			{ 2058254776834405794, 3664510426047082, -1393736880036ll },
+			{ 2061917893523572840, 3661722951271797, -1394453132010ll },
+			{ 2065578222021712627, 3658934043994811, -1395161270974ll },
+			{ 2069235760904436464, 3656143720442141, -1395861315078ll },
+			{ 2072890508763563527, 3653351996803525, -1396553282502ll },
+			{ 2076542464207084550, 3650558889232339, -1397237191502ll },
+			{ 2080191625859125387, 3647764413845433, -1397913060350ll },
+			{ 2083837992359910470, 3644968586723156, -1398580907444ll },
+			{ 2087481562365726182, 3642171423909010, -1399240751104ll },
+			{ 2091122334548884088, 3639372941409838, -1399892609864ll },
+			{ 2094760307597684062, 3636573155195476, -1400536502180ll },
+			{ 2098395480216377358, 3633772081198780, -1401172446636ll },
+			{ 2102027851125129502, 3630969735315492, -1401800461852ll },
+			{ 2105657419059983142, 3628166133404110, -1402420566480ll },
+			{ 2109284182772820772, 3625361291285828, -1403032779236ll },
+			{ 2112908141031327364, 3622555224744373, -1403637118854ll },
+			{ 2116529292618952883, 3619747949526052, -1404233604192ll },
+			{ 2120147636334874743, 3616939481339446, -1404822254052ll },
+			{ 2123763170993960137, 3614129835855474, -1405403087348ll },
+			{ 2127375895426728263, 3611319028707267, -1405976123034ll },
+			{ 2130985808479312496, 3608507075490053, -1406541380114ll },
+			{ 2134592909013422435, 3605693991761068, -1407098877624ll },
+			{ 2138197195906305879, 3602879793039457, -1407648634622ll },
+			{ 2141798668050710714, 3600064494806233, -1408190670274ll },
+			{ 2145397324354846673, 3597248112504117, -1408725003718ll },
+			{ 2148993163742347072, 3594430661537499, -1409251654146ll },
+			{ 2152586185152230425, 3591612157272420, -1409770640884ll },
+			{ 2156176387538861961, 3588792615036333, -1410281983174ll },
+			{ 2159763769871915120, 3585972050118055, -1410785700322ll },
+			{ 2163348331136332853, 3583150477767899, -1411281811762ll },
+			{ 2166930070332288990, 3580327913197290, -1411770336872ll },
+			{ 2170508986475149408, 3577504371578892, -1412251295128ll },
+			{ 2174085078595433172, 3574679868046459, -1412724706018ll },
+			{ 2177658345738773613, 3571854417694686, -1413190589008ll },
+			{ 2181228786965879291, 3569028035579338, -1413648963728ll },
+			{ 2184796401352494901, 3566200736717016, -1414099849780ll },
+			{ 2188361187989362137, 3563372536085059, -1414543266758ll },
+			{ 2191923145982180438, 3560543448621600, -1414979234372ll },
+			{ 2195482274451567666, 3557713489225406, -1415407772288ll },
+			{ 2199038572533020784, 3554882672755835, -1415828900258ll },
+			{ 2202592039376876361, 3552051014032807, -1416242638070ll },
+			{ 2206142674148271098, 3549218527836613, -1416649005478ll },
+			{ 2209690476027102233, 3546385228908057, -1417048022382ll },
+			{ 2213235444207987908, 3543551131948201, -1417439708606ll },
+			{ 2216777577900227503, 3540716251618391, -1417824084086ll },
+			{ 2220316876327761808, 3537880602540148, -1418201168692ll },
+			{ 2223853338729133264, 3535044199295140, -1418570982372ll },
+			{ 2227386964357446032, 3532207056425274, -1418933545216ll },
+			{ 2230917752480326090, 3529369188432220, -1419288877108ll },
+			{ 2234445702379881202, 3526530609777883, -1419636998182ll },
+			{ 2237970813352660903, 3523691334883902, -1419977928456ll },
+			{ 2241493084709616349, 3520851378131902, -1420311688064ll },
+			{ 2245012515776060187, 3518010753863212, -1420638297072ll },
+			{ 2248529105891626327, 3515169476379046, -1420957775684ll },
+			{ 2252042854410229689, 3512327559940194, -1421270144028ll },
+			{ 2255553760700025855, 3509485018767184, -1421575422284ll },
+			{ 2259061824143370755, 3506641867040165, -1421873630718ll },
+			{ 2262567044136780202, 3503798118898784, -1422164789504ll },
+			{ 2266069420090889482, 3500953788442326, -1422448919012ll },
+			{ 2269568951430412796, 3498108889729428, -1422726039448ll },
+			{ 2273065637594102776, 3495263436778167, -1422996171110ll },
+			{ 2276559478034709833, 3492417443566152, -1423259334420ll },
+			{ 2280050472218941565, 3489570924030088, -1423515549604ll },
+			{ 2283538619627422049, 3486723892066197, -1423764837098ll },
+			{ 2287023919754651148, 3483876361529870, -1424007217260ll },
+			{ 2290506372108963758, 3481028346235756, -1424242710536ll },
+			{ 2293985976212488978, 3478179859957664, -1424471337288ll },
+			{ 2297462731601109354, 3475330916428588, -1424693118020ll },
+			{ 2300936637824419922, 3472481529340628, -1424908073156ll },
+			{ 2304407694445687394, 3469631712344969, -1425116223190ll },
+			{ 2307875901041809173, 3466781479051818, -1425317588588ll },
+			{ 2311341257203272403, 3463930843030419, -1425512189846ll },
+			{ 2314803762534112976, 3461079817809047, -1425700047522ll },
+			{ 2318263416651874501, 3458228416874898, -1425881182156ll },
+			{ 2321720219187567243, 3455376653674068, -1426055614252ll },
+			{ 2325174169785627059, 3452524541611597, -1426223364406ll },
+			{ 2328625268103874250, 3449672094051407, -1426384453194ll },
+			{ 2332073513813472463, 3446819324316226, -1426538901180ll },
+			{ 2335518906598887509, 3443966245687626, -1426686728980ll },
+			{ 2338961446157846155, 3441112871406020, -1426827957208ll },
+			{ 2342401132201294967, 3438259214670528, -1426962606464ll },
+			{ 2345837964453359031, 3435405288639086, -1427090697412ll },
+			{ 2349271942651300705, 3432551106428328, -1427212250656ll },
+			{ 2352703066545478377, 3429696681113658, -1427327286888ll },
+			{ 2356131335899305147, 3426842025729095, -1427435826734ll },
+			{ 2359556750489207508, 3423987153267448, -1427537890904ll },
+			{ 2362979310104584052, 3421132076680063, -1427633500014ll },
+			{ 2366399014547764101, 3418276808877018, -1427722674784ll },
+			{ 2369815863633966335, 3415421362727036, -1427805435904ll },
+			{ 2373229857191257467, 3412565751057406, -1427881804060ll },
+			{ 2376640995060510813, 3409709986654032, -1427951799940ll },
+			{ 2380049277095364905, 3406854082261501, -1428015444298ll },
+			{ 2383454703162182108, 3403998050582845, -1428072757806ll },
+			{ 2386857273140007147, 3401141904279768, -1428123761172ll },
+			{ 2390256986920525743, 3398285655972514, -1428168475156ll },
+			{ 2393653844408023101, 3395429318239896, -1428206920452ll },
+			{ 2397047845519342545, 3392572903619286, -1428239117816ll },
+			{ 2400438990183844015, 3389716424606540, -1428265087952ll },
+			{ 2403827278343362603, 3386859893656134, -1428284851596ll },
+			{ 2407212709952167141, 3384003323181023, -1428298429486ll },
+			{ 2410595284976918678, 3381146725552738, -1428305842368ll },
+			{ 2413975003396629048, 3378290113101287, -1428307110938ll },
+			{ 2417351865202619397, 3375433498115259, -1428302255962ll },
+			{ 2420725870398478694, 3372576892841758, -1428291298184ll },
+			{ 2424097019000022268, 3369720309486396, -1428274258316ll },
+			{ 2427465311035250348, 3366863760213371, -1428251157150ll },
+			{ 2430830746544306569, 3364007257145318, -1428222015348ll },
+			{ 2434193325579436539, 3361150812363440, -1428186853636ll },
+			{ 2437553048204946343, 3358294437907535, -1428145692798ll },
+			{ 2440909914497161080, 3355438145775927, -1428098553538ll },
+			{ 2444263924544383469, 3352581947925440, -1428045456592ll },
+			{ 2447615078446852317, 3349725856271429, -1427986422622ll },
+			{ 2450963376316701124, 3346869882687949, -1427921472410ll },
+			{ 2454308818277916663, 3344014039007487, -1427850626650ll },
+			{ 2457651404466297500, 3341158337021176, -1427773906032ll },
+			{ 2460991135029412644, 3338302788478697, -1427691331250ll },
+			{ 2464328010126560091, 3335447405088342, -1427602923004ll },
+			{ 2467662029928725429, 3332592198517055, -1427508701978ll },
+			{ 2470993194618540506, 3329737180390363, -1427408688878ll },
+			{ 2474321504390241991, 3326882362292448, -1427302904364ll },
+			{ 2477646959449630075, 3324027755766134, -1427191369136ll },
+			{ 2480969560014027073, 3321173372312905, -1427074103810ll },
+			{ 2484289306312236168, 3318319223392883, -1426951129050ll },
+			{ 2487606198584500001, 3315465320425000, -1426822465528ll },
+			{ 2490920237082459473, 3312611674786761, -1426688133830ll },
+			{ 2494231422069112404, 3309758297814485, -1426548154602ll },
+			{ 2497539753818772287, 3306905200803252, -1426402548460ll },
+			{ 2500845232617027079, 3304052395006834, -1426251336016ll },
+			{ 2504147858760697897, 3301199891637899, -1426094537870ll },
+			{ 2507447632557797926, 3298347701867808, -1425932174576ll },
+			{ 2510744554327491158, 3295495836826820, -1425764266728ll },
+			{ 2514038624400051250, 3292644307604083, -1425590834922ll },
+			{ 2517329843116820411, 3289793125247582, -1425411899712ll },
+			{ 2520618210830168281, 3286942300764096, -1425227481544ll },
+			{ 2523903727903450833, 3284091845119466, -1425037600996ll },
+			{ 2527186394710969303, 3281241769238501, -1424842278610ll },
+			{ 2530466211637929194, 3278392084004857, -1424641534846ll },
+			{ 2533743179080399205, 3275542800261319, -1424435390230ll },
+			{ 2537017297445270294, 3272693928809612, -1424223865192ll },
+			{ 2540288567150214714, 3269845480410535, -1424006980186ll },
+			{ 2543556988623645063, 3266997465784011, -1423784755666ll },
+			{ 2546822562304673408, 3264149895609086, -1423557212088ll },
+			{ 2550085288643070406, 3261302780523877, -1423324369810ll },
+			{ 2553345168099224473, 3258456131125739, -1423086249246ll },
+			{ 2556602201144100966, 3255609957971262, -1422842870812ll },
+			{ 2559856388259201416, 3252764271576238, -1422594254848ll },
+			{ 2563107729936522806, 3249919082415673, -1422340421674ll },
+			{ 2566356226678516805, 3247074400924015, -1422081391654ll },
+			{ 2569601878998049166, 3244230237494916, -1421817185056ll },
+			{ 2572844687418359026, 3241386602481501, -1421547822202ll },
+			{ 2576084652473018325, 3238543506196313, -1421273323394ll },
+			{ 2579321774705891244, 3235700958911307, -1420993708870ll },
+			{ 2582556054671093681, 3232858970857864, -1420708998844ll },
+			{ 2585787492932952701, 3230017552227027, -1420419213578ll },
+			{ 2589016090065966150, 3227176713169270, -1420124373232ll },
+			{ 2592241846654762188, 3224336463794729, -1419824497986ll },
+			{ 2595464763294058931, 3221496814173204, -1419519608032ll },
+			{ 2598684840588624103, 3218657774334113, -1419209723486ll },
+			{ 2601902079153234730, 3215819354266640, -1418894864468ll },
+			{ 2605116479612636902, 3212981563919710, -1418575051080ll },
+			{ 2608328042601505532, 3210144413202033, -1418250303378ll },
+			{ 2611536768764404187, 3207307911982242, -1417920641444ll },
+			{ 2614742658755744985, 3204472070088776, -1417586085320ll },
+			{ 2617945713239748441, 3201636897310065, -1417246655014ll },
+			{ 2621145932890403492, 3198802403394471, -1416902370506ll },
+			{ 2624343318391427457, 3195968598050381, -1416553251758ll },
+			{ 2627537870436226080, 3193135490946329, -1416199318754ll },
+			{ 2630729589727853655, 3190303091710772, -1415840591312ll },
+			{ 2633918476978973115, 3187471409932579, -1415477089454ll },
+			{ 2637104532911816240, 3184640455160597, -1415108832946ll },
+			{ 2640287758258143891, 3181810236904102, -1414735841712ll },
+			{ 2643468153759206281, 3178980764632573, -1414358135542ll },
+			{ 2646645720165703312, 3176152047775844, -1413975734240ll },
+			{ 2649820458237744916, 3173324095724194, -1413588657580ll },
+			{ 2652992368744811530, 3170496917828319, -1413196925322ll },
+			{ 2656161452465714527, 3167670523399451, -1412800557194ll },
+			{ 2659327710188556784, 3164844921709307, -1412399572854ll },
+			{ 2662491142710693237, 3162020121990239, -1411993992010ll },
+			{ 2665651750838691466, 3159196133435339, -1411583834334ll },
+			{ 2668809535388292471, 3156372965198268, -1411169119404ll },
+			{ 2671964497184371335, 3153550626393496, -1410749866820ll },
+			{ 2675116637060898011, 3150729126096344, -1410326096136ll },
+			{ 2678265955860898219, 3147908473342942, -1409897826912ll },
+			{ 2681412454436414249, 3145088677130409, -1409465078658ll },
+			{ 2684556133648466000, 3142269746416829, -1409027870890ll },
+			{ 2687696994367011939, 3139451690121237, -1408586223026ll },
+			{ 2690835037470910150, 3136634517123820, -1408140154472ll },
+			{ 2693970263847879498, 3133818236265920, -1407689684672ll },
+			{ 2697102674394460746, 3131002856350036, -1407234832980ll },
+			{ 2700232270015977802, 3128188386139958, -1406775618724ll },
+			{ 2703359051626499036, 3125374834360816, -1406312061264ll },
+			{ 2706483020148798588, 3122562209699023, -1405844179830ll },
+			{ 2709604176514317781, 3119750520802500, -1405371993684ll },
+			{ 2712722521663126597, 3116939776280634, -1404895522072ll },
+			{ 2715838056543885159, 3114129984704421, -1404414784194ll },
+			{ 2718950782113805386, 3111321154606352, -1403929799200ll },
+			{ 2722060699338612538, 3108513294480715, -1403440586242ll },
+			{ 2725167809192507011, 3105706412783351, -1402947164338ll },
+			{ 2728272112658126024, 3102900517932148, -1402449552680ll },
+			{ 2731373610726505492, 3100095618306638, -1401947770244ll },
+			{ 2734472304397041886, 3097291722248369, -1401441836054ll },
+			{ 2737568194677454201, 3094488838060814, -1400931769072ll },
+			{ 2740661282583745943, 3091686974009607, -1400417588314ll },
+			{ 2743751569140167236, 3088886138322295, -1399899312610ll },
+			{ 2746839055379176921, 3086086339188771, -1399376960902ll },
+			{ 2749923742341404790, 3083287584761021, -1398850551982ll },
+			{ 2753005631075613829, 3080489883153452, -1398320104704ll },
+			{ 2756084722638662577, 3077693242442771, -1397785637874ll },
+			{ 2759161018095467474, 3074897670668114, -1397247170212ll },
+			{ 2762234518518965376, 3072103175831134, -1396704720456ll },
+			{ 2765305224990076054, 3069309765895949, -1396158307226ll },
+			{ 2768373138597664777, 3066517448789491, -1395607949282ll },
+			{ 2771438260438504986, 3063726232401281, -1395053665238ll },
+			{ 2774500591617241029, 3060936124583554, -1394495473624ll },
+			{ 2777560133246350959, 3058147133151359, -1393933392974ll },
+			{ 2780616886446109344, 3055359265882772, -1393367441860ll },
+			{ 2783670852344550256, 3052572530518736, -1392797638724ll },
+			{ 2786722032077430268, 3049786934763213, -1392224002030ll },
+			{ 2789770426788191451, 3047002486283412, -1391646550272ll },
+			{ 2792816037627924591, 3044219192709461, -1391065301674ll },
+			{ 2795858865755332378, 3041437061634927, -1390480274698ll },
+			{ 2798898912336692607, 3038656100616680, -1389891487636ll },
+			{ 2801936178545821651, 3035876317174805, -1389298958714ll },
+			{ 2804970665564037742, 3033097718793085, -1388702706262ll },
+			{ 2808002374580124565, 3030320312918531, -1388102748362ll },
+			{ 2811031306790294734, 3027544106962013, -1387499103262ll },
+			{ 2814057463398153485, 3024769108297977, -1386891789134ll },
+			{ 2817080845614662328, 3021995324264466, -1386280823948ll },
+			{ 2820101454658102846, 3019222762163541, -1385666225874ll },
+			{ 2823119291754040513, 3016451429261047, -1385048012898ll },
+			{ 2826134358135288662, 3013681332786727, -1384426202998ll },
+			{ 2829146655041872391, 3010912479934487, -1383800814158ll },
+			{ 2832156183720992720, 3008144877862167, -1383171864246ll },
+			{ 2835162945426990641, 3005378533691898, -1382539371152ll },
+			{ 2838166941421311387, 3002613454510032, -1381903352732ll },
+			{ 2841168172972468687, 2999849647367242, -1381263826800ll },
+			{ 2844166641356009129, 2997087119278507, -1380620811050ll },
+			{ 2847162347854476586, 2994325877223519, -1379974323346ll },
+			{ 2850155293757376759, 2991565928146153, -1379324381226ll },
+			{ 2853145480361141686, 2988807278955227, -1378671002438ll },
+			{ 2856132908969094475, 2986049936524026, -1378014204524ll },
+			{ 2859117580891413977, 2983293907690854, -1377354005192ll },
+			{ 2862099497445099639, 2980539199258600, -1376690421860ll },
+			{ 2865078659953936379, 2977785817995120, -1376023472012ll },
+			{ 2868055069748459487, 2975033770633508, -1375353173244ll },
+			{ 2871028728165919751, 2972283063871679, -1374679542890ll },
+			{ 2873999636550248540, 2969533704372728, -1374002598308ll },
+			{ 2876967796252022960, 2966785698765051, -1373322356866ll },
+			{ 2879933208628431145, 2964039053642392, -1372638835924ll },
+			{ 2882895875043237613, 2961293775563815, -1371952052746ll },
+			{ 2885855796866748682, 2958549871053781, -1371262024490ll },
+			{ 2888812975475777973, 2955807346602396, -1370568768408ll },
+			{ 2891767412253611961, 2953066208665312, -1369872301592ll },
+			{ 2894719108589975681, 2950326463663961, -1369172641234ll },
+			{ 2897668065880998408, 2947588117985507, -1368469804374ll },
+			{ 2900614285529179541, 2944851177982890, -1367763808016ll },
+			{ 2903557768943354415, 2942115649975108, -1367054669184ll },
+			{ 2906498517538660339, 2939381540247104, -1366342404824ll },
+			{ 2909436532736502619, 2936648855049903, -1365627031846ll },
+			{ 2912371815964520676, 2933917600600788, -1364908567168ll },
+			{ 2915304368656554296, 2931187783083152, -1364187027564ll },
+			{ 2918234192252609884, 2928459408646805, -1363462429834ll },
+			{ 2921161288198826855, 2925732483407985, -1362734790778ll },
+			{ 2924085657947444062, 2923007013449405, -1362004127090ll },
+			{ 2927007302956766377, 2920283004820292, -1361270455436ll },
+			{ 2929926224691131233, 2917560463536575, -1360533792434ll },
+			{ 2932842424620875374, 2914839395580909, -1359794154678ll },
+			{ 2935755904222301605, 2912119806902808, -1359051558772ll },
+			{ 2938666664977645641, 2909401703418609, -1358306021186ll },
+			{ 2941574708375043064, 2906685091011634, -1357557558384ll },
+			{ 2944480035908496314, 2903969975532332, -1356806186836ll },
+			{ 2947382649077841810, 2901256362798184, -1356051922880ll },
+			{ 2950282549388717114, 2898544258593966, -1355294782864ll },
+			{ 2953179738352528216, 2895833668671764, -1354534783140ll },
+			{ 2956074217486416840, 2893124598751042, -1353771939968ll },
+			{ 2958965988313227914, 2890417054518731, -1353006269602ll },
+			{ 2961855052361477043, 2887711041629180, -1352237788092ll },
+			{ 2964741411165318131, 2885006565704607, -1351466511722ll },
+			{ 2967625066264511016, 2882303632334828, -1350692456564ll },
+			{ 2970506019204389280, 2879602247077402, -1349915638644ll },
+			{ 2973384271535828038, 2876902415457794, -1349136073948ll },
+			{ 2976259824815211884, 2874204142969526, -1348353778536ll },
+			{ 2979132680604402874, 2871507435074105, -1347568768310ll },
+			{ 2982002840470708669, 2868812297201100, -1346781059136ll },
+			{ 2984870305986850633, 2866118734748403, -1345990666890ll },
+			{ 2987735078730932146, 2863426753082160, -1345197607388ll },
+			{ 2990597160286406918, 2860736357536868, -1344401896396ll },
+			{ 2993456552242047390, 2858047553415561, -1343603549650ll },
+			{ 2996313256191913301, 2855360345989725, -1342802582810ll },
+			{ 2999167273735320216, 2852674740499522, -1341999011516ll },
+			{ 3002018606476808222, 2849990742153868, -1341192851408ll },
+			{ 3004867256026110682, 2847308356130432, -1340384118004ll },
+			{ 3007713223998123110, 2844627587575707, -1339572826794ll },
+			{ 3010556512012872023, 2841948441605316, -1338758993308ll },
+			{ 3013397121695484031, 2839270923303802, -1337942632952ll },
+			{ 3016235054676154881, 2836595037724914, -1337123761152ll },
+			{ 3019070312590118643, 2833920789891559, -1336302393230ll },
+			{ 3021902897077616972, 2831248184796004, -1335478544480ll },
+			{ 3024732809783868496, 2828577227399835, -1334652230134ll },
+			{ 3027560052359038197, 2825907922634195, -1333823465466ll },
+			{ 3030384626458206926, 2823240275399808, -1332992265684ll },
+			{ 3033206533741341050, 2820574290566916, -1332158645840ll },
+			{ 3036025775873262126, 2817909972975528, -1331322621052ll },
+			{ 3038842354523616602, 2815247327435647, -1330484206430ll },
+			{ 3041656271366845819, 2812586358726833, -1329643416878ll },
+			{ 3044467528082155774, 2809927071598995, -1328800267466ll },
+			{ 3047276126353487303, 2807269470771872, -1327954773064ll },
+			{ 3050082067869486111, 2804613560935389, -1327106948538ll },
+			{ 3052885354323472962, 2801959346749791, -1326256808734ll },
+			{ 3055685987413414019, 2799306832845673, -1325404368542ll },
+			{ 3058483968841891150, 2796656023823826, -1324549642544ll },
+			{ 3061279300316072432, 2794006924255795, -1323692645578ll },
+			{ 3064071983547682649, 2791359538683525, -1322833392234ll },
+			{ 3066862020252973940, 2788713871619738, -1321971897196ll },
+			{ 3069649412152696482, 2786069927547871, -1321108175022ll },
+			{ 3072434160972069331, 2783427710922200, -1320242240268ll },
+			{ 3075216268440751263, 2780787226167879, -1319374107398ll },
+			{ 3077995736292811744, 2778148477681099, -1318503790846ll },
+			{ 3080772566266701997, 2775511469829180, -1317631305072ll },
+			{ 3083546760105226105, 2772876206950617, -1316756664430ll },
+			{ 3086318319555512292, 2770242693355094, -1315879883204ll },
+			{ 3089087246368984182, 2767610933323769, -1315000975746ll },
+			{ 3091853542301332205, 2764980931109140, -1314119956280ll },
+			{ 3094617209112485065, 2762352690935215, -1313236838930ll },
+			{ 3097378248566581350, 2759726216997753, -1312351637982ll },
+			{ 3100136662431941121, 2757101513463974, -1311464367392ll },
+			{ 3102892452481037703, 2754478584473083, -1310575041322ll },
+			{ 3105645620490469464, 2751857434136089, -1309683673806ll },
+			{ 3108396168240931747, 2749238066535916, -1308790278804ll },
+			{ 3111144097517188859, 2746620485727505, -1307894870202ll },
+			{ 3113889410108046162, 2744004695737976, -1306997461944ll },
+			{ 3116632107806322194, 2741390700566699, -1306098067918ll },
+			{ 3119372192408820975, 2738778504185175, -1305196701842ll },
+			{ 3122109665716304308, 2736168110537517, -1304293377614ll },
+			{ 3124844529533464211, 2733559523540095, -1303388108862ll },
+			{ 3127576785668895444, 2730952747081876, -1302480909256ll },
+			{ 3130306435935068064, 2728347785024553, -1301571792490ll },
+			{ 3133033482148300127, 2725744641202466, -1300660772168ll },
+			{ 3135757926128730425, 2723143319422791, -1299747861782ll },
+			{ 3138479769700291434, 2720543823465545, -1298833074870ll },
+			{ 3141199014690682109, 2717946157083746, -1297916424888ll },
+			{ 3143915662931340967, 2715350324003612, -1296997925320ll },
+			{ 3146629716257419259, 2712756327924292, -1296077589500ll },
+			{ 3149341176507754051, 2710164172518272, -1295155430748ll },
+			{ 3152050045524841575, 2707573861431440, -1294231462444ll },
+			{ 3154756325154810571, 2704985398282883, -1293305697718ll },
+			{ 3157460017247395736, 2702398786665411, -1292378149898ll },
+			{ 3160161123655911249, 2699814030145223, -1291448832050ll },
+			{ 3162859646237224422, 2697231132262318, -1290517757392ll },
+			{ 3165555586851729348, 2694650096530446, -1289584939024ll },
+			{ 3168248947363320770, 2692070926436918, -1288650389808ll },
+			{ 3170939729639367880, 2689493625443396, -1287714122948ll },
+			{ 3173627935550688328, 2686918196985218, -1286776151284ll },
+			{ 3176313566971522262, 2684344644471965, -1285836487818ll },
+			{ 3178996625779506409, 2681772971287333, -1284895145350ll },
+			{ 3181677113855648392, 2679203180789208, -1283952136664ll },
+			{ 3184355033084300936, 2676635276310013, -1283007474666ll },
+			{ 3187030385353136283, 2674069261156423, -1282061172014ll },
+			{ 3189703172553120692, 2671505138609684, -1281113241416ll },
+			{ 3192373396578488960, 2668942911925686, -1280163695568ll },
+			{ 3195041059326719078, 2666382584334998, -1279212547132ll },
+			{ 3197706162698506944, 2663824159042863, -1278259808586ll },
+			{ 3200368708597741221, 2661267639229351, -1277305492430ll },
+			{ 3203028698931478142, 2658713028049672, -1276349611236ll },
+			{ 3205686135609916578, 2656160328633912, -1275392177440ll },
+			{ 3208341020546373050, 2653609544087258, -1274433203424ll },
+			{ 3210993355657256884, 2651060677490225, -1273472701618ll },
+			{ 3213643142862045491, 2648513731898357, -1272510684246ll },
+			{ 3216290384083259602, 2645968710342735, -1271547163602ll },
+			{ 3218935081246438735, 2643425615829920, -1270582152004ll },
+			{ 3221577236280116651, 2640884451341858, -1269615661576ll },
+			{ 3224216851115796933, 2638345219836188, -1268647704468ll },
+			{ 3226853927687928653, 2635807924246194, -1267678292788ll },
+			{ 3229488467933882059, 2633272567481075, -1266707438658ll },
+			{ 3232120473793924476, 2630739152425698, -1265735154044ll },
+			{ 3234749947211196130, 2628207681941039, -1264761450986ll },
+			{ 3237376890131686183, 2625678158863982, -1263786341348ll },
+			{ 3240001304504208817, 2623150586007672, -1262809837160ll },
+			{ 3242623192280379329, 2620624966161278, -1261831950156ll },
+			{ 3245242555414590451, 2618101302090344, -1260852692176ll },
+			{ 3247859395863988619, 2615579596536804, -1259872075040ll },
+			{ 3250473715588450383, 2613059852218993, -1258890110458ll },
+			{ 3253085516550558918, 2610542071831861, -1257906810206ll },
+			{ 3255694800715580573, 2608026258046724, -1256922185732ll },
+			{ 3258301570051441565, 2605512413511882, -1255936248792ll },
+			{ 3260905826528704655, 2603000540852350, -1254949010996ll },
+			{ 3263507572120546009, 2600490642669940, -1253960483808ll },
+			{ 3266106808802732141, 2597982721543367, -1252970678690ll },
+			{ 3268703538553596818, 2595476780028418, -1251979607068ll },
+			{ 3271297763354018168, 2592972820658112, -1250987280428ll },
+			{ 3273889485187395852, 2590470845942449, -1249993710054ll },
+			{ 3276478706039628247, 2587970858368926, -1248998907348ll },
+			{ 3279065427899089825, 2585472860402241, -1248002883566ll },
+			{ 3281649652756608500, 2582976854484565, -1247005649922ll },
+			{ 3284231382605443143, 2580482843035569, -1246007217594ll },
+			{ 3286810619441261118, 2577990828452568, -1245007597776ll },
+			{ 3289387365262115910, 2575500813110641, -1244006801614ll },
+			{ 3291961622068424937, 2573012799362478, -1243004840168ll },
+			{ 3294533391862947247, 2570526789538648, -1242001724392ll },
+			{ 3297102676650761503, 2568042785947688, -1240997465328ll },
+			{ 3299669478439243863, 2565560790876166, -1239992073944ll },
+			{ 3302233799238046085, 2563080806588767, -1238985561182ll },
+			{ 3304795641059073670, 2560602835328250, -1237977937848ll },
+			{ 3307355005916464072, 2558126879315747, -1236969214894ll },
+			{ 3309911895826564925, 2555652940750593, -1235959402978ll },
+			{ 3312466312807912540, 2553181021810585, -1234948512906ll },
+			{ 3315018258881210219, 2550711124652056, -1233936555336ll },
+			{ 3317567736069306939, 2548243251409954, -1232923541048ll },
+			{ 3320114746397175845, 2545777404197736, -1231909480580ll },
+			{ 3322659291891893001, 2543313585107780, -1230894384584ll },
+			{ 3325201374582616197, 2540851796211106, -1229878263540ll },
+			{ 3327740996500563763, 2538392039557790, -1228861128052ll },
+			{ 3330278159678993501, 2535934317176806, -1227842988568ll },
+			{ 3332812866153181739, 2533478631076123, -1226823855446ll },
+			{ 3335345117960402416, 2531024983242979, -1225803739162ll },
+			{ 3337874917139906233, 2528573375643721, -1224782649990ll },
+			{ 3340402265732899964, 2526123810224083, -1223760598326ll },
+			{ 3342927165782525721, 2523676288909069, -1222737594354ll },
+			{ 3345449619333840436, 2521230813603228, -1221713648364ll },
+			{ 3347969628433795300, 2518787386190647, -1220688770562ll },
+			{ 3350487195131215385, 2516346008534935, -1219662971054ll },
+			{ 3353002321476779266, 2513906682479485, -1218636260002ll },
+			{ 3355515009522998749, 2511469409847444, -1217608647488ll },
+			{ 3358025261324198705, 2509034192441719, -1216580143474ll },
+			{ 3360533078936496950, 2506601032045207, -1215550758002ll },
+			{ 3363038464417784155, 2504169930420945, -1214520501082ll },
+			{ 3365541419827704018, 2501740889311673, -1213489382478ll },
+			{ 3368041947227633213, 2499313910440850, -1212457412276ll },
+			{ 3370540048680661787, 2496888995511661, -1211424600198ll },
+			{ 3373035726251573250, 2494466146207877, -1210390956078ll },
+			{ 3375528982006825049, 2492045364193583, -1209356489646ll },
+			{ 3378019818014528986, 2489626651113373, -1208321210690ll },
+			{ 3380508236344431669, 2487210008592307, -1207285128806ll },
+			{ 3382994239067895170, 2484795438236181, -1206248253714ll },
+			{ 3385477828257877637, 2482382941631453, -1205210594998ll },
+			{ 3387959005988914092, 2479972520345308, -1204172162232ll },
+			{ 3390437774337097168, 2477564175925885, -1203132964970ll },
+			{ 3392914135380058083, 2475157909902185, -1202093012690ll },
+			{ 3395388091196947578, 2472753723784161, -1201052314814ll },
+			{ 3397859643868416925, 2470351619063083, -1200010880854ll },
+			{ 3400328795476599154, 2467951597211069, -1198968720102ll },
+			{ 3402795548105090121, 2465553659681739, -1197925841958ll },
+			{ 3405259903838929902, 2463157807909934, -1196882255752ll },
+			{ 3407721864764584084, 2460764043311689, -1195837970594ll },
+			{ 3410181432969925179, 2458372367284849, -1194792995870ll },
+			{ 3412638610544214158, 2455982781208645, -1193747340778ll },
+			{ 3415093399578082025, 2453595286443770, -1192701014336ll },
+			{ 3417545802163511459, 2451209884332912, -1191654025812ll },
+			{ 3419995820393818559, 2448826576200263, -1190606384218ll },
+			{ 3422443456363634604, 2446445363351952, -1189558098580ll },
+			{ 3424888712168887976, 2444066247076049, -1188509177910ll },
+			{ 3427331589906786115, 2441689228642523, -1187459631150ll },
+			{ 3429772091675797488, 2439314309303553, -1186409467294ll },
+			{ 3432210219575633747, 2436941490293371, -1185358695246ll },
+			{ 3434645975707231872, 2434570772828449, -1184307323886ll },
+			{ 3437079362172736435, 2432202158107440, -1183255361940ll },
+			{ 3439510381075481935, 2429835647311410, -1182202818208ll },
+			{ 3441939034519975137, 2427471241603915, -1181149701442ll },
+			{ 3444365324611877610, 2425108942131037, -1180096020426ll },
+			{ 3446789253457988221, 2422748750021316, -1179041783772ll },
+			{ 3449210823166225765, 2420390666386021, -1177987000102ll },
+			{ 3451630035845611684, 2418034692319053, -1176931677990ll },
+			{ 3454046893606252747, 2415680828897385, -1175875826138ll },
+			{ 3456461398559323994, 2413329077180489, -1174819452954ll },
+			{ 3458873552817051529, 2410979438211018, -1173762566936ll },
+			{ 3461283358492695611, 2408631913014571, -1172705176590ll },
+			{ 3463690817700533592, 2406286502599888, -1171647290360ll },
+			{ 3466095932555843120, 2403943207958738, -1170588916548ll },
+			{ 3468498705174885310, 2401602030066293, -1169530063582ll },
+			{ 3470899137674888021, 2399262969880833, -1168470739706ll },
+			{ 3473297232174029148, 2396926028344182, -1167410953244ll },
+			{ 3475692990791420086, 2394591206381447, -1166350712350ll },
+			{ 3478086415647089183, 2392258504901471, -1165290025362ll },
+			{ 3480477508861965292, 2389927924796502, -1164228900376ll },
+			{ 3482866272557861418, 2387599466942445, -1163167345534ll },
+			{ 3485252708857458329, 2385273132199124, -1162105368996ll },
+			{ 3487636819884288457, 2382948921409914, -1161042978764ll },
+			{ 3490018607762719607, 2380626835402177, -1159980182842ll },
+			{ 3492398074617938942, 2378306874987210, -1158916989300ll },
+			{ 3494775222575936852, 2375989040960433, -1157853406114ll },
+			{ 3497150053763491171, 2373673334101010, -1156789441092ll },
+			{ 3499522570308151089, 2371359755172649, -1155725102226ll },
+			{ 3501892774338221512, 2369048304922951, -1154660397278ll },
+			{ 3504260667982747185, 2366738984084080, -1153595334200ll },
+			{ 3506626253371497065, 2364431793372438, -1152529920732ll },
+			{ 3508989532634948771, 2362126733488653, -1151464164530ll },
+			{ 3511350507904272894, 2359823805118195, -1150398073426ll },
+			{ 3513709181311317663, 2357523008930913, -1149331655070ll },
+			{ 3516065554988593506, 2355224345581251, -1148264917110ll },
+			{ 3518419631069257647, 2352927815708533, -1147197867214ll },
+			{ 3520771411687098966, 2350633419936512, -1146130512844ll },
+			{ 3523120898976522634, 2348341158874181, -1145062861646ll },
+			{ 3525468095072535169, 2346051033115103, -1143994921054ll },
+			{ 3527813002110729218, 2343763043238142, -1142926698740ll },
+			{ 3530155622227268620, 2341477189806866, -1141858201968ll },
+			{ 3532495957558873518, 2339193473370030, -1140789438136ll },
+			{ 3534834010242805412, 2336911894461787, -1139720414758ll },
+			{ 3537169782416852441, 2334632453601246, -1138651139072ll },
+			{ 3539503276219314615, 2332355151292968, -1137581618436ll },
+			{ 3541834493788989147, 2330079988026924, -1136511860184ll },
+			{ 3544163437265155887, 2327806964278311, -1135441871410ll },
+			{ 3546490108787562788, 2325536080508073, -1134371659434ll },
+			{ 3548814510496411427, 2323267337162617, -1133301231450ll },
+			{ 3551136644532342594, 2321000734674053, -1132230594626ll },
+			{ 3553456513036422021, 2318736273460066, -1131159756008ll },
+			{ 3555774118150126079, 2316473953924165, -1130088722686ll },
+			{ 3558089462015327558, 2314213776455774, -1129017501784ll },
+			{ 3560402546774281548, 2311955741430086, -1127946100220ll },
+			{ 3562713374569611414, 2309699849208286, -1126874524984ll },
+			{ 3565021947544294716, 2307446100137832, -1125802783228ll },
+			{ 3567328267841649320, 2305194494551855, -1124730881642ll },
+			{ 3569632337605319533, 2302945032769873, -1123658827162ll },
+			{ 3571934158979262244, 2300697715097698, -1122586626768ll },
+			{ 3574233734107733174, 2298452541827251, -1121514287126ll },
+			{ 3576531065135273299, 2296209513236930, -1120441815116ll },
+			{ 3578826154206695113, 2293968629591421, -1119369217446ll },
+			{ 3581119003467069088, 2291729891142084, -1118296500932ll },
+			{ 3583409615061710240, 2289493298126629, -1117223672182ll },
+			{ 3585697991136164687, 2287258850769504, -1116150737976ll },
+			{ 3587984133836196215, 2285026549281694, -1115077704824ll },
+			{ 3590268045307773085, 2282796393861008, -1114004579376ll },
+			{ 3592549727697054717, 2280568384691969, -1112931368186ll },
+			{ 3594829183150378500, 2278342521946097, -1111858077838ll },
+			{ 3597106413814246759, 2276118805781714, -1110784714836ll },
+			{ 3599381421835313637, 2273897236344091, -1109711285602ll },
+			{ 3601654209360372126, 2271677813765699, -1108637796706ll },
+			{ 3603924778536341119, 2269460538165978, -1107564254496ll },
+			{ 3606193131510252601, 2267245409651528, -1106490665356ll },
+			{ 3608459270429238773, 2265032428316173, -1105417035582ll },
+			{ 3610723197440519364, 2262821594241109, -1104343371562ll },
+			{ 3612984914691388911, 2260612907494830, -1103269679576ll },
+			{ 3615244424329204165, 2258406368133338, -1102195966000ll },
+			{ 3617501728501371503, 2256201976199900, -1101122236900ll },
+			{ 3619756829355334503, 2253999731725322, -1100048498436ll },
+#else
+			{ 0, 4503598195715549 },
+			{ 4503598195715549, 4503589605805534 },
+			{ 9007187801521083, 4503572426083805 },
+			{ 13510760227604888, 4503546656746966 },
+			{ 18014306884351854, 4503512298089915 },
+			{ 22517819182441769, 4503469350505836 },
+			{ 27021288532947605, 4503417814486190 },
+			{ 31524706347433795, 4503357690620696 },
+			{ 36028064038054491, 4503288979597316 },
+			{ 40531353017651807, 4503211682202238 },
+			{ 45034564699854045, 4503125799319856 },
+			{ 49537690499173901, 4503031331932735 },
+			{ 54040721831106636, 4502928281121587 },
+			{ 58543650112228223, 4502816648065249 },
+			{ 63046466760293472, 4502696434040637 },
+			{ 67549163194334109, 4502567640422711 },
+			{ 72051730834756820, 4502430268684448 },
+			{ 76554161103441268, 4502284320396780 },
+			{ 81056445423838048, 4502129797228576 },
+			{ 85558575221066624, 4501966700946554 },
+			{ 90060541922013178, 4501795033415281 },
+			{ 94562336955428459, 4501614796597075 },
+			{ 99063951752025534, 4501425992551978 },
+			{ 103565377744577512, 4501228623437681 },
+			{ 108066606368015193, 4501022691509470 },
+			{ 112567629059524663, 4500808199120161 },
+			{ 117068437258644824, 4500585148720028 },
+			{ 121569022407364852, 4500353542856743 },
+			{ 126069375950221595, 4500113384175288 },
+			{ 130569489334396883, 4499864675417895 },
+			{ 135069354009814778, 4499607419423963 },
+			{ 139568961429238741, 4499341619129970 },
+			{ 144068303048368711, 4499067277569397 },
+			{ 148567370325938108, 4498784397872638 },
+			{ 153066154723810746, 4498492983266912 },
+			{ 157564647707077658, 4498193037076176 },
+			{ 162062840744153834, 4497884562721019 },
+			{ 166560725306874853, 4497567563718576 },
+			{ 171058292870593429, 4497242043682416 },
+			{ 175555534914275845, 4496908006322459 },
+			{ 180052442920598304, 4496565455444842 },
+			{ 184549008376043146, 4496214394951839 },
+			{ 189045222770994985, 4495854828841729 },
+			{ 193541077599836714, 4495486761208703 },
+			{ 198036564361045417, 4495110196242712 },
+			{ 202531674557288129, 4494725138229406 },
+			{ 207026399695517535, 4494331591549946 },
+			{ 211520731287067481, 4493929560680931 },
+			{ 216014660847748412, 4493519050194245 },
+			{ 220508179897942657, 4493100064756937 },
+			{ 225001279962699594, 4492672609131083 },
+			{ 229493952571830677, 4492236688173650 },
+			{ 233986189260004327, 4491792306836378 },
+			{ 238477981566840705, 4491339470165608 },
+			{ 242969321037006313, 4490878183302169 },
+			{ 247460199220308482, 4490408451481199 },
+			{ 251950607671789681, 4489930280032042 },
+			{ 256440537951821723, 4489443674378065 },
+			{ 260929981626199788, 4488948640036494 },
+			{ 265418930266236282, 4488445182618307 },
+			{ 269907375448854589, 4487933307828016 },
+			{ 274395308756682605, 4487413021463565 },
+			{ 278882721778146170, 4486884329416111 },
+			{ 283369606107562281, 4486347237669899 },
+			{ 287855953345232180, 4485801752302081 },
+			{ 292341755097534261, 4485247879482522 },
+			{ 296827002977016783, 4484685625473680 },
+			{ 301311688602490463, 4484114996630364 },
+			{ 305795803599120827, 4483535999399614 },
+			{ 310279339598520441, 4482948640320479 },
+			{ 314762288238840920, 4482352926023858 },
+			{ 319244641164864778, 4481748863232300 },
+			{ 323726390028097078, 4481136458759815 },
+			{ 328207526486856893, 4480515719511703 },
+			{ 332688042206368596, 4479886652484341 },
+			{ 337167928858852937, 4479249264764979 },
+			{ 341647178123617916, 4478603563531578 },
+			{ 346125781687149494, 4477949556052566 },
+			{ 350603731243202060, 4477287249686670 },
+			{ 355081018492888730, 4476616651882686 },
+			{ 359557635144771416, 4475937770179288 },
+			{ 364033572914950704, 4475250612204813 },
+			{ 368508823527155517, 4474555185677033 },
+			{ 372983378712832550, 4473851498402975 },
+			{ 377457230211235525, 4473139558278661 },
+			{ 381930369769514186, 4472419373288930 },
+			{ 386402789142803116, 4471690951507180 },
+			{ 390874480094310296, 4470954301095165 },
+			{ 395345434395405461, 4470209430302770 },
+			{ 399815643825708231, 4469456347467770 },
+			{ 404285100173176001, 4468695061015599 },
+			{ 408753795234191600, 4467925579459143 },
+			{ 413221720813650743, 4467147911398459 },
+			{ 417688868725049202, 4466362065520577 },
+			{ 422155230790569779, 4465568050599248 },
+			{ 426620798841169027, 4464765875494685 },
+			{ 431085564716663712, 4463955549153347 },
+			{ 435549520265817059, 4463137080607674 },
+			{ 440012657346424733, 4462310478975844 },
+			{ 444474967825400577, 4461475753461510 },
+			{ 448936443578862087, 4460632913353580 },
+			{ 453397076492215667, 4459781968025911 },
+			{ 457856858460241578, 4458922926937113 },
+			{ 462315781387178691, 4458055799630230 },
+			{ 466773837186808921, 4457180595732513 },
+			{ 471231017782541434, 4456297324955164 },
+			{ 475687315107496598, 4455405997093034 },
+			{ 480142721104589632, 4454506622024395 },
+			{ 484597227726614027, 4453599209710631 },
+			{ 489050826936324658, 4452683770196014 },
+			{ 493503510706520672, 4451760313607380 },
+			{ 497955271020128052, 4450828850153897 },
+			{ 502406099870281949, 4449889390126744 },
+			{ 506855989260408693, 4448941943898878 },
+			{ 511304931204307571, 4447986521924722 },
+			{ 515752917726232293, 4447023134739870 },
+			{ 520199940860972163, 4446051792960855 },
+			{ 524645992653933018, 4445072507284784 },
+			{ 529091065161217802, 4444085288489134 },
+			{ 533535150449706936, 4443090147431390 },
+			{ 537978240597138326, 4442087095048777 },
+			{ 542420327692187103, 4441076142357993 },
+			{ 546861403834545096, 4440057300454868 },
+			{ 551301461134999964, 4439030580514077 },
+			{ 555740491715514041, 4437995993788871 },
+			{ 560178487709302912, 4436953551610734 },
+			{ 564615441260913646, 4435903265389094 },
+			{ 569051344526302740, 4434845146611031 },
+			{ 573486189672913771, 4433779206840953 },
+			{ 577919968879754724, 4432705457720274 },
+			{ 582352674337474998, 4431623910967143 },
+			{ 586784298248442141, 4430534578376108 },
+			{ 591214832826818249, 4429437471817780 },
+			{ 595644270298636029, 4428332603238559 },
+			{ 600072602901874588, 4427219984660287 },
+			{ 604499822886534875, 4426099628179943 },
+			{ 608925922514714818, 4424971545969306 },
+			{ 613350894060684124, 4423835750274659 },
+			{ 617774729810958783, 4422692253416440 },
+			{ 622197422064375223, 4421541067788915 },
+			{ 626618963132164138, 4420382205859875 },
+			{ 631039345338024013, 4419215680170289 },
+			{ 635458561018194302, 4418041503333977 },
+			{ 639876602521528279, 4416859688037270 },
+			{ 644293462209565549, 4415670247038699 },
+			{ 648709132456604248, 4414473193168624 },
+			{ 653123605649772872, 4413268539328946 },
+			{ 657536874189101818, 4412056298492720 },
+			{ 661948930487594538, 4410836483703844 },
+			{ 666359766971298382, 4409609108076717 },
+			{ 670769376079375099, 4408374184795881 },
+			{ 675177750264170980, 4407131727115696 },
+			{ 679584881991286676, 4405881748359990 },
+			{ 683990763739646666, 4404624261921691 },
+			{ 688395388001568357, 4403359281262524 },
+			{ 692798747282830881, 4402086819912612 },
+			{ 697200834102743493, 4400806891470167 },
+			{ 701601640994213660, 4399519509601101 },
+			{ 706001160503814761, 4398224688038712 },
+			{ 710399385191853473, 4396922440583304 },
+			{ 714796307632436777, 4395612781101826 },
+			{ 719191920413538603, 4394295723527551 },
+			{ 723586216137066154, 4392971281859674 },
+			{ 727979187418925828, 4391639470162970 },
+			{ 732370826889088798, 4390300302567464 },
+			{ 736761127191656262, 4388953793268016 },
+			{ 741150080984924278, 4387599956523991 },
+			{ 745537680941448269, 4386238806658896 },
+			{ 749923919748107165, 4384870358060006 },
+			{ 754308790106167171, 4383494625177996 },
+			{ 758692284731345167, 4382111622526579 },
+			{ 763074396353871746, 4380721364682141 },
+			{ 767455117718553887, 4379323866283362 },
+			{ 771834441584837249, 4377919142030860 },
+			{ 776212360726868109, 4376507206686813 },
+			{ 780588867933554922, 4375088075074560 },
+			{ 784963956008629482, 4373661762078295 },
+			{ 789337617770707777, 4372228282642615 },
+			{ 793709846053350392, 4370787651772198 },
+			{ 798080633705122590, 4369339884531413 },
+			{ 802449973589654003, 4367884996043925 },
+			{ 806817858585697928, 4366423001492346 },
+			{ 811184281587190274, 4364953916117839 },
+			{ 815549235503308113, 4363477755219736 },
+			{ 819912713258527849, 4361994534155172 },
+			{ 824274707792683021, 4360504268338685 },
+			{ 828635212061021706, 4359006973241862 },
+			{ 832994219034263568, 4357502664392917 },
+			{ 837351721698656485, 4355991357376340 },
+			{ 841707713056032825, 4354473067832497 },
+			{ 846062186123865322, 4352947811457260 },
+			{ 850415133935322582, 4351415604001589 },
+			{ 854766549539324171, 4349876461271197 },
+			{ 859116426000595368, 4348330399126084 },
+			{ 863464756399721452, 4346777433480258 },
+			{ 867811533833201710, 4345217580301239 },
+			{ 872156751413502949, 4343650855609732 },
+			{ 876500402269112681, 4342077275479225 },
+			{ 880842479544591906, 4340496856035587 },
+			{ 885182976400627493, 4338909613456691 },
+			{ 889521886014084184, 4337315563972012 },
+			{ 893859201578056196, 4335714723862233 },
+			{ 898194916301918429, 4334107109458877 },
+			{ 902529023411377306, 4332492737143870 },
+			{ 906861516148521176, 4330871623349187 },
+			{ 911192387771870363, 4329243784556435 },
+			{ 915521631556426798, 4327609237296472 },
+			{ 919849240793723270, 4325967998148993 },
+			{ 924175208791872263, 4324320083742164 },
+			{ 928499528875614427, 4322665510752183 },
+			{ 932822194386366610, 4321004295902936 },
+			{ 937143198682269546, 4319336455965548 },
+			{ 941462535138235094, 4317662007758029 },
+			{ 945780197145993123, 4315980968144834 },
+			{ 950096178114137957, 4314293354036513 },
+			{ 954410471468174470, 4312599182389270 },
+			{ 958723070650563740, 4310898470204591 },
+			{ 963033969120768331, 4309191234528826 },
+			{ 967343160355297157, 4307477492452811 },
+			{ 971650637847749968, 4305757261111441 },
+			{ 975956395108861409, 4304030557683302 },
+			{ 980260425666544711, 4302297399390237 },
+			{ 984562723065934948, 4300557803496977 },
+			{ 988863280869431925, 4298811787310727 },
+			{ 993162092656742652, 4297059368180751 },
+			{ 997459152024923403, 4295300563497985 },
+			{ 1001754452588421388, 4293535390694660 },
+			{ 1006047987979116048, 4291763867243849 },
+			{ 1010339751846359897, 4289986010659102 },
+			{ 1014629737857018999, 4288201838494043 },
+			{ 1018917939695513042, 4286411368341941 },
+			{ 1023204351063854983, 4284614617835353 },
+			{ 1027488965681690336, 4282811604645682 },
+			{ 1031771777286336018, 4281002346482792 },
+			{ 1036052779632818810, 4279186861094609 },
+			{ 1040331966493913419, 4277365166266712 },
+			{ 1044609331660180131, 4275537279821933 },
+			{ 1048884868940002064, 4273703219619961 },
+			{ 1053158572159622025, 4271863003556930 },
+			{ 1057430435163178955, 4270016649565028 },
+			{ 1061700451812743983, 4268164175612094 },
+			{ 1065968615988356077, 4266305599701189 },
+			{ 1070234921588057266, 4264440939870252 },
+			{ 1074499362527927518, 4262570214191638 },
+			{ 1078761932742119156, 4260693440771756 },
+			{ 1083022626182890912, 4258810637750654 },
+			{ 1087281436820641566, 4256921823301607 },
+			{ 1091538358643943173, 4255027015630758 },
+			{ 1095793385659573931, 4253126232976641 },
+			{ 1100046511892550572, 4251219493609877 },
+			{ 1104297731386160449, 4249306815832688 },
+			{ 1108547038201993137, 4247388217978541 },
+			{ 1112794426419971678, 4245463718411754 },
+			{ 1117039890138383432, 4243533335527060 },
+			{ 1121283423473910492, 4241597087749256 },
+			{ 1125525020561659748, 4239654993532740 },
+			{ 1129764675555192488, 4237707071361197 },
+			{ 1134002382626553685, 4235753339747111 },
+			{ 1138238135966300796, 4233793817231437 },
+			{ 1142471929783532233, 4231828522383162 },
+			{ 1146703758305915395, 4229857473798925 },
+			{ 1150933615779714320, 4227880690102619 },
+			{ 1155161496469816939, 4225898189944986 },
+			{ 1159387394659761925, 4223909992003226 },
+			{ 1163611304651765151, 4221916114980609 },
+			{ 1167833220766745760, 4219916577606059 },
+			{ 1172053137344351819, 4217911398633786 },
+			{ 1176271048742985605, 4215900596842855 },
+			{ 1180486949339828460, 4213884191036848 },
+			{ 1184700833530865308, 4211862200043395 },
+			{ 1188912695730908703, 4209834642713853 },
+			{ 1193122530373622556, 4207801537922870 },
+			{ 1197330331911545426, 4205762904568002 },
+			{ 1201536094816113428, 4203718761569324 },
+			{ 1205739813577682752, 4201669127869049 },
+			{ 1209941482705551801, 4199614022431122 },
+			{ 1214141096727982923, 4197553464240821 },
+			{ 1218338650192223744, 4195487472304411 },
+			{ 1222534137664528155, 4193416065648690 },
+			{ 1226727553730176845, 4191339263320663 },
+			{ 1230918892993497508, 4189257084387126 },
+			{ 1235108150077884634, 4187169547934262 },
+			{ 1239295319625818896, 4185076673067291 },
+			{ 1243480396298886187, 4182978478910064 },
+			{ 1247663374777796251, 4180874984604665 },
+			{ 1251844249762400916, 4178766209311062 },
+			{ 1256023015971711978, 4176652172206693 },
+			{ 1260199668143918671, 4174532892486094 },
+			{ 1264374201036404765, 4172408389360514 },
+			{ 1268546609425765279, 4170278682057530 },
+			{ 1272716888107822809, 4168143789820687 },
+			{ 1276885031897643496, 4166003731909088 },
+			{ 1281051035629552584, 4163858527597028 },
+			{ 1285214894157149612, 4161708196173625 },
+			{ 1289376602353323237, 4159552756942418 },
+			{ 1293536155110265655, 4157392229221023 },
+			{ 1297693547339486678, 4155226632340721 },
+			{ 1301848773971827399, 4153055985646111 },
+			{ 1306001829957473510, 4150880308494720 },
+			{ 1310152710265968230, 4148699620256631 },
+			{ 1314301409886224861, 4146513940314110 },
+			{ 1318447923826538971, 4144323288061249 },
+			{ 1322592247114600220, 4142127682903577 },
+			{ 1326734374797503797, 4139927144257663 },
+			{ 1330874301941761460, 4137721691550836 },
+			{ 1335012023633312296, 4135511344220706 },
+			{ 1339147534977533002, 4133296121714879 },
+			{ 1343280831099247881, 4131076043490544 },
+			{ 1347411907142738425, 4128851129014126 },
+			{ 1351540758271752551, 4126621397760927 },
+			{ 1355667379669513478, 4124386869214732 },
+			{ 1359791766538728210, 4122147562867487 },
+			{ 1363913914101595697, 4119903498218901 },
+			{ 1368033817599814598, 4117654694776123 },
+			{ 1372151472294590721, 4115401172053321 },
+			{ 1376266873466644042, 4113142949571395 },
+			{ 1380380016416215437, 4110880046857572 },
+			{ 1384490896463073009, 4108612483445060 },
+			{ 1388599508946518069, 4106340278872687 },
+			{ 1392705849225390756, 4104063452684575 },
+			{ 1396809912678075331, 4101782024429741 },
+			{ 1400911694702505072, 4099496013661763 },
+			{ 1405011190716166835, 4097205439938454 },
+			{ 1409108396156105289, 4094910322821474 },
+			{ 1413203306478926763, 4092610681875994 },
+			{ 1417295917160802757, 4090306536670341 },
+			{ 1421386223697473098, 4087997906775678 },
+			{ 1425474221604248776, 4085684811765617 },
+			{ 1429559906416014393, 4083367271215905 },
+			{ 1433643273687230298, 4081045304704046 },
+			{ 1437724318991934344, 4078718931809023 },
+			{ 1441803037923743367, 4076388172110853 },
+			{ 1445879426095854220, 4074053045190358 },
+			{ 1449953479141044578, 4071713570628745 },
+			{ 1454025192711673323, 4069369768007303 },
+			{ 1458094562479680626, 4067021656907051 },
+			{ 1462161584136587677, 4064669256908423 },
+			{ 1466226253393496100, 4062312587590892 },
+			{ 1470288565981086992, 4059951668532689 },
+			{ 1474348517649619681, 4057586519310427 },
+			{ 1478406104168930108, 4055217159498796 },
+			{ 1482461321328428904, 4052843608670205 },
+			{ 1486514164937099109, 4050465886394488 },
+			{ 1490564630823493597, 4048084012238559 },
+			{ 1494612714835732156, 4045698005766058 },
+			{ 1498658412841498214, 4043307886537095 },
+			{ 1502701720728035309, 4040913674107835 },
+			{ 1506742634402143144, 4038515388030262 },
+			{ 1510781149790173406, 4036113047851796 },
+			{ 1514817262838025202, 4033706673115007 },
+			{ 1518850969511140209, 4031296283357271 },
+			{ 1522882265794497480, 4028881898110473 },
+			{ 1526911147692607953, 4026463536900677 },
+			{ 1530937611229508630, 4024041219247820 },
+			{ 1534961652448756450, 4021614964665397 },
+			{ 1538983267413421847, 4019184792660130 },
+			{ 1543002452206081977, 4016750722731672 },
+			{ 1547019202928813649, 4014312774372326 },
+			{ 1551033515703185975, 4011870967066663 },
+			{ 1555045386670252638, 4009425320291292 },
+			{ 1559054811990543930, 4006975853514493 },
+			{ 1563061787844058423, 4004522586195954 },
+			{ 1567066310430254377, 4002065537786455 },
+			{ 1571068375968040832, 3999604727727540 },
+			{ 1575067980695768372, 3997140175451268 },
+			{ 1579065120871219640, 3994671900379860 },
+			{ 1583059792771599500, 3992199921925448 },
+			{ 1587051992693524948, 3989724259489717 },
+			{ 1591041716953014665, 3987244932463707 },
+			{ 1595028961885478372, 3984761960227384 },
+			{ 1599013723845705756, 3982275362149498 },
+			{ 1602995999207855254, 3979785157587168 },
+			{ 1606975784365442422, 3977291365885648 },
+			{ 1610953075731328070, 3974794006378045 },
+			{ 1614927869737706115, 3972293098385014 },
+			{ 1618900162836091129, 3969788661214451 },
+			{ 1622869951497305580, 3967280714161283 },
+			{ 1626837232211466863, 3964769276507073 },
+			{ 1630802001487973936, 3962254367519874 },
+			{ 1634764255855493810, 3959736006453803 },
+			{ 1638723991861947613, 3957214212548873 },
+			{ 1642681206074496486, 3954689005030691 },
+			{ 1646635895079527177, 3952160403110126 },
+			{ 1650588055482637303, 3949628425983119 },
+			{ 1654537683908620422, 3947093092830334 },
+			{ 1658484777001450756, 3944554422816955 },
+			{ 1662429331424267711, 3942012435092337 },
+			{ 1666371343859360048, 3939467148789840 },
+			{ 1670310811008149888, 3936918583026434 },
+			{ 1674247729591176322, 3934366756902560 },
+			{ 1678182096348078882, 3931811689501780 },
+			{ 1682113908037580662, 3929253399890544 },
+			{ 1686043161437471206, 3926691907117928 },
+			{ 1689969853344589134, 3924127230215370 },
+			{ 1693893980574804504, 3921559388196427 },
+			{ 1697815539963000931, 3918988400056472 },
+			{ 1701734528363057403, 3916414284772508 },
+			{ 1705650942647829911, 3913837061302850 },
+			{ 1709564779709132761, 3911256748586906 },
+			{ 1713476036457719667, 3908673365544921 },
+			{ 1717384709823264588, 3906086931077723 },
+			{ 1721290796754342311, 3903497464066465 },
+			{ 1725194294218408776, 3900904983372396 },
+			{ 1729095199201781172, 3898309507836617 },
+			{ 1732993508709617789, 3895711056279804 },
+			{ 1736889219765897593, 3893109647502027 },
+			{ 1740782329413399620, 3890505300282427 },
+			{ 1744672834713682047, 3887898033379056 },
+			{ 1748560732747061103, 3885287865528573 },
+			{ 1752446020612589676, 3882674815446073 },
+			{ 1756328695428035749, 3880058901824786 },
+			{ 1760208754329860535, 3877440143335904 },
+			{ 1764086194473196439, 3874818558628282 },
+			{ 1767961013031824721, 3872194166328271 },
+			{ 1771833207198152992, 3869566985039456 },
+			{ 1775702774183192448, 3866937033342434 },
+			{ 1779569711216534882, 3864304329794589 },
+			{ 1783434015546329471, 3861668892929866 },
+			{ 1787295684439259337, 3859030741258544 },
+			{ 1791154715180517881, 3856389893267024 },
+			{ 1795011105073784905, 3853746367417601 },
+			{ 1798864851441202506, 3851100182148253 },
+			{ 1802715951623350759, 3848451355872410 },
+			{ 1806564402979223169, 3845799906978743 },
+			{ 1810410202886201912, 3843145853830973 },
+			{ 1814253348740032885, 3840489214767618 },
+			{ 1818093837954800503, 3837830008101814 },
+			{ 1821931667962902317, 3835168252121083 },
+			{ 1825766836215023400, 3832503965087141 },
+			{ 1829599340180110541, 3829837165235693 },
+			{ 1833429177345346234, 3827167870776209 },
+			{ 1837256345216122443, 3824496099891725 },
+			{ 1841080841316014168, 3821821870738675 },
+			{ 1844902663186752843, 3819145201446623 },
+			{ 1848721808388199466, 3816466110118127 },
+			{ 1852538274498317593, 3813784614828521 },
+			{ 1856352059113146114, 3811100733625699 },
+			{ 1860163159846771813, 3808414484529935 },
+			{ 1863971574331301748, 3805725885533707 },
+			{ 1867777300216835455, 3803034954601479 },
+			{ 1871580335171436934, 3800341709669497 },
+			{ 1875380676881106431, 3797646168645662 },
+			{ 1879178323049752093, 3794948349409289 },
+			{ 1882973271399161382, 3792248269810914 },
+			{ 1886765519668972296, 3789545947672165 },
+			{ 1890555065616644461, 3786841400785511 },
+			{ 1894341907017429972, 3784134646914138 },
+			{ 1898126041664344110, 3781425703791739 },
+			{ 1901907467368135849, 3778714589122342 },
+			{ 1905686181957258191, 3776001320580125 },
+			{ 1909462183277838316, 3773285915809263 },
+			{ 1913235469193647579, 3770568392423714 },
+			{ 1917006037586071293, 3767848768007101 },
+			{ 1920773886354078394, 3765127060112491 },
+			{ 1924539013414190885, 3762403286262252 },
+			{ 1928301416700453137, 3759677463947875 },
+			{ 1932061094164401012, 3756949610629805 },
+			{ 1935818043775030817, 3754219743737306 },
+			{ 1939572263518768123, 3751487880668232 },
+			{ 1943323751399436355, 3748754038788935 },
+			{ 1947072505438225290, 3746018235434077 },
+			{ 1950818523673659367, 3743280487906420 },
+			{ 1954561804161565787, 3740540813476778 },
+			{ 1958302344975042565, 3737799229383771 },
+			{ 1962040144204426336, 3735055752833663 },
+			{ 1965775199957259999, 3732310401000311 },
+			{ 1969507510358260310, 3729563191024868 },
+			{ 1973237073549285178, 3726814140015773 },
+			{ 1976963887689300951, 3724063265048485 },
+			{ 1980687950954349436, 3721310583165422 },
+			{ 1984409261537514858, 3718556111375761 },
+			{ 1988127817648890619, 3715799866655302 },
+			{ 1991843617515545921, 3713041865946376 },
+			{ 1995556659381492297, 3710282126157589 },
+			{ 1999266941507649886, 3707520664163822 },
+			{ 2002974462171813708, 3704757496805966 },
+			{ 2006679219668619674, 3701992640890899 },
+			{ 2010381212309510573, 3699226113191225 },
+			{ 2014080438422701798, 3696457930445240 },
+			{ 2017776896353147038, 3693688109356767 },
+			{ 2021470584462503805, 3690916666595007 },
+			{ 2025161501129098812, 3688143618794416 },
+			{ 2028849644747893228, 3685368982554597 },
+			{ 2032535013730447825, 3682592774440113 },
+			{ 2036217606504887938, 3679815010980483 },
+			{ 2039897421515868421, 3677035708669871 },
+			{ 2043574457224538292, 3674254883967151 },
+			{ 2047248712108505443, 3671472553295666 },
+			{ 2050920184661801109, 3668688733043132 },
+			{ 2054588873394844241, 3665903439561553 },
+			{ 2058254776834405794, 3663116689167046 },
+			{ 2061917893523572840, 3660328498139787 },
+			{ 2065578222021712627, 3657538882723837 },
+			{ 2069235760904436464, 3654747859127063 },
+			{ 2072890508763563527, 3651955443521023 },
+			{ 2076542464207084550, 3649161652040837 },
+			{ 2080191625859125387, 3646366500785083 },
+			{ 2083837992359910470, 3643570005815712 },
+			{ 2087481562365726182, 3640772183157906 },
+			{ 2091122334548884088, 3637973048799974 },
+			{ 2094760307597684062, 3635172618693296 },
+			{ 2098395480216377358, 3632370908752144 },
+			{ 2102027851125129502, 3629567934853640 },
+			{ 2105657419059983142, 3626763712837630 },
+			{ 2109284182772820772, 3623958258506592 },
+			{ 2112908141031327364, 3621151587625519 },
+			{ 2116529292618952883, 3618343715921860 },
+			{ 2120147636334874743, 3615534659085394 },
+			{ 2123763170993960137, 3612724432768126 },
+			{ 2127375895426728263, 3609913052584233 },
+			{ 2130985808479312496, 3607100534109939 },
+			{ 2134592909013422435, 3604286892883444 },
+			{ 2138197195906305879, 3601472144404835 },
+			{ 2141798668050710714, 3598656304135959 },
+			{ 2145397324354846673, 3595839387500399 },
+			{ 2148993163742347072, 3593021409883353 },
+			{ 2152586185152230425, 3590202386631536 },
+			{ 2156176387538861961, 3587382333053159 },
+			{ 2159763769871915120, 3584561264417733 },
+			{ 2163348331136332853, 3581739195956137 },
+			{ 2166930070332288990, 3578916142860418 },
+			{ 2170508986475149408, 3576092120283764 },
+			{ 2174085078595433172, 3573267143340441 },
+			{ 2177658345738773613, 3570441227105678 },
+			{ 2181228786965879291, 3567614386615610 },
+			{ 2184796401352494901, 3564786636867236 },
+			{ 2188361187989362137, 3561957992818301 },
+			{ 2191923145982180438, 3559128469387228 },
+			{ 2195482274451567666, 3556298081453118 },
+			{ 2199038572533020784, 3553466843855577 },
+			{ 2202592039376876361, 3550634771394737 },
+			{ 2206142674148271098, 3547801878831135 },
+			{ 2209690476027102233, 3544968180885675 },
+			{ 2213235444207987908, 3542133692239595 },
+			{ 2216777577900227503, 3539298427534305 },
+			{ 2220316876327761808, 3536462401371456 },
+			{ 2223853338729133264, 3533625628312768 },
+			{ 2227386964357446032, 3530788122880058 },
+			{ 2230917752480326090, 3527949899555112 },
+			{ 2234445702379881202, 3525110972779701 },
+			{ 2237970813352660903, 3522271356955446 },
+			{ 2241493084709616349, 3519431066443838 },
+			{ 2245012515776060187, 3516590115566140 },
+			{ 2248529105891626327, 3513748518603362 },
+			{ 2252042854410229689, 3510906289796166 },
+			{ 2255553760700025855, 3508063443344900 },
+			{ 2259061824143370755, 3505219993409447 },
+			{ 2262567044136780202, 3502375954109280 },
+			{ 2266069420090889482, 3499531339523314 },
+			{ 2269568951430412796, 3496686163689980 },
+			{ 2273065637594102776, 3493840440607057 },
+			{ 2276559478034709833, 3490994184231732 },
+			{ 2280050472218941565, 3488147408480484 },
+			{ 2283538619627422049, 3485300127229099 },
+			{ 2287023919754651148, 3482452354312610 },
+			{ 2290506372108963758, 3479604103525220 },
+			{ 2293985976212488978, 3476755388620376 },
+			{ 2297462731601109354, 3473906223310568 },
+			{ 2300936637824419922, 3471056621267472 },
+			{ 2304407694445687394, 3468206596121779 },
+			{ 2307875901041809173, 3465356161463230 },
+			{ 2311341257203272403, 3462505330840573 },
+			{ 2314803762534112976, 3459654117761525 },
+			{ 2318263416651874501, 3456802535692742 },
+			{ 2321720219187567243, 3453950598059816 },
+			{ 2325174169785627059, 3451098318247191 },
+			{ 2328625268103874250, 3448245709598213 },
+			{ 2332073513813472463, 3445392785415046 },
+			{ 2335518906598887509, 3442539558958646 },
+			{ 2338961446157846155, 3439686043448812 },
+			{ 2342401132201294967, 3436832252064064 },
+			{ 2345837964453359031, 3433978197941674 },
+			{ 2349271942651300705, 3431123894177672 },
+			{ 2352703066545478377, 3428269353826770 },
+			{ 2356131335899305147, 3425414589902361 },
+			{ 2359556750489207508, 3422559615376544 },
+			{ 2362979310104584052, 3419704443180049 },
+			{ 2366399014547764101, 3416849086202234 },
+			{ 2369815863633966335, 3413993557291132 },
+			{ 2373229857191257467, 3411137869253346 },
+			{ 2376640995060510813, 3408282034854092 },
+			{ 2380049277095364905, 3405426066817203 },
+			{ 2383454703162182108, 3402569977825039 },
+			{ 2386857273140007147, 3399713780518596 },
+			{ 2390256986920525743, 3396857487497358 },
+			{ 2393653844408023101, 3394001111319444 },
+			{ 2397047845519342545, 3391144664501470 },
+			{ 2400438990183844015, 3388288159518588 },
+			{ 2403827278343362603, 3385431608804538 },
+			{ 2407212709952167141, 3382575024751537 },
+			{ 2410595284976918678, 3379718419710370 },
+			{ 2413975003396629048, 3376861805990349 },
+			{ 2417351865202619397, 3374005195859297 },
+			{ 2420725870398478694, 3371148601543574 },
+			{ 2424097019000022268, 3368292035228080 },
+			{ 2427465311035250348, 3365435509056221 },
+			{ 2430830746544306569, 3362579035129970 },
+			{ 2434193325579436539, 3359722625509804 },
+			{ 2437553048204946343, 3356866292214737 },
+			{ 2440909914497161080, 3354010047222389 },
+			{ 2444263924544383469, 3351153902468848 },
+			{ 2447615078446852317, 3348297869848807 },
+			{ 2450963376316701124, 3345441961215539 },
+			{ 2454308818277916663, 3342586188380837 },
+			{ 2457651404466297500, 3339730563115144 },
+			{ 2460991135029412644, 3336875097147447 },
+			{ 2464328010126560091, 3334019802165338 },
+			{ 2467662029928725429, 3331164689815077 },
+			{ 2470993194618540506, 3328309771701485 },
+			{ 2474321504390241991, 3325455059388084 },
+			{ 2477646959449630075, 3322600564396998 },
+			{ 2480969560014027073, 3319746298209095 },
+			{ 2484289306312236168, 3316892272263833 },
+			{ 2487606198584500001, 3314038497959472 },
+			{ 2490920237082459473, 3311184986652931 },
+			{ 2494231422069112404, 3308331749659883 },
+			{ 2497539753818772287, 3305478798254792 },
+			{ 2500845232617027079, 3302626143670818 },
+			{ 2504147858760697897, 3299773797100029 },
+			{ 2507447632557797926, 3296921769693232 },
+			{ 2510744554327491158, 3294070072560092 },
+			{ 2514038624400051250, 3291218716769161 },
+			{ 2517329843116820411, 3288367713347870 },
+			{ 2520618210830168281, 3285517073282552 },
+			{ 2523903727903450833, 3282666807518470 },
+			{ 2527186394710969303, 3279816926959891 },
+			{ 2530466211637929194, 3276967442470011 },
+			{ 2533743179080399205, 3274118364871089 },
+			{ 2537017297445270294, 3271269704944420 },
+			{ 2540288567150214714, 3268421473430349 },
+			{ 2543556988623645063, 3265573681028345 },
+			{ 2546822562304673408, 3262726338396998 },
+			{ 2550085288643070406, 3259879456154067 },
+			{ 2553345168099224473, 3257033044876493 },
+			{ 2556602201144100966, 3254187115100450 },
+			{ 2559856388259201416, 3251341677321390 },
+			{ 2563107729936522806, 3248496741993999 },
+			{ 2566356226678516805, 3245652319532361 },
+			{ 2569601878998049166, 3242808420309860 },
+			{ 2572844687418359026, 3239965054659299 },
+			{ 2576084652473018325, 3237122232872919 },
+			{ 2579321774705891244, 3234279965202437 },
+			{ 2582556054671093681, 3231438261859020 },
+			{ 2585787492932952701, 3228597133013449 },
+			{ 2589016090065966150, 3225756588796038 },
+			{ 2592241846654762188, 3222916639296743 },
+			{ 2595464763294058931, 3220077294565172 },
+			{ 2598684840588624103, 3217238564610627 },
+			{ 2601902079153234730, 3214400459402172 },
+			{ 2605116479612636902, 3211562988868630 },
+			{ 2608328042601505532, 3208726162898655 },
+			{ 2611536768764404187, 3205889991340798 },
+			{ 2614742658755744985, 3203054484003456 },
+			{ 2617945713239748441, 3200219650655051 },
+			{ 2621145932890403492, 3197385501023965 },
+			{ 2624343318391427457, 3194552044798623 },
+			{ 2627537870436226080, 3191719291627575 },
+			{ 2630729589727853655, 3188887251119460 },
+			{ 2633918476978973115, 3186055932843125 },
+			{ 2637104532911816240, 3183225346327651 },
+			{ 2640287758258143891, 3180395501062390 },
+			{ 2643468153759206281, 3177566406497031 },
+			{ 2646645720165703312, 3174738072041604 },
+			{ 2649820458237744916, 3171910507066614 },
+			{ 2652992368744811530, 3169083720902997 },
+			{ 2656161452465714527, 3166257722842257 },
+			{ 2659327710188556784, 3163432522136453 },
+			{ 2662491142710693237, 3160608127998229 },
+			{ 2665651750838691466, 3157784549601005 },
+			{ 2668809535388292471, 3154961796078864 },
+			{ 2671964497184371335, 3152139876526676 },
+			{ 2675116637060898011, 3149318800000208 },
+			{ 2678265955860898219, 3146498575516030 },
+			{ 2681412454436414249, 3143679212051751 },
+			{ 2684556133648466000, 3140860718545939 },
+			{ 2687696994367011939, 3138043103898211 },
+			{ 2690835037470910150, 3135226376969348 },
+			{ 2693970263847879498, 3132410546581248 },
+			{ 2697102674394460746, 3129595621517056 },
+			{ 2700232270015977802, 3126781610521234 },
+			{ 2703359051626499036, 3123968522299552 },
+			{ 2706483020148798588, 3121156365519193 },
+			{ 2709604176514317781, 3118345148808816 },
+			{ 2712722521663126597, 3115534880758562 },
+			{ 2715838056543885159, 3112725569920227 },
+			{ 2718950782113805386, 3109917224807152 },
+			{ 2722060699338612538, 3107109853894473 },
+			{ 2725167809192507011, 3104303465619013 },
+			{ 2728272112658126024, 3101498068379468 },
+			{ 2731373610726505492, 3098693670536394 },
+			{ 2734472304397041886, 3095890280412315 },
+			{ 2737568194677454201, 3093087906291742 },
+			{ 2740661282583745943, 3090286556421293 },
+			{ 2743751569140167236, 3087486239009685 },
+			{ 2746839055379176921, 3084686962227869 },
+			{ 2749923742341404790, 3081888734209039 },
+			{ 2753005631075613829, 3079091563048748 },
+			{ 2756084722638662577, 3076295456804897 },
+			{ 2759161018095467474, 3073500423497902 },
+			{ 2762234518518965376, 3070706471110678 },
+			{ 2765305224990076054, 3067913607588723 },
+			{ 2768373138597664777, 3065121840840209 },
+			{ 2771438260438504986, 3062331178736043 },
+			{ 2774500591617241029, 3059541629109930 },
+			{ 2777560133246350959, 3056753199758385 },
+			{ 2780616886446109344, 3053965898440912 },
+			{ 2783670852344550256, 3051179732880012 },
+			{ 2786722032077430268, 3048394710761183 },
+			{ 2789770426788191451, 3045610839733140 },
+			{ 2792816037627924591, 3042828127407787 },
+			{ 2795858865755332378, 3040046581360229 },
+			{ 2798898912336692607, 3037266209129044 },
+			{ 2801936178545821651, 3034487018216091 },
+			{ 2804970665564037742, 3031709016086823 },
+			{ 2808002374580124565, 3028932210170169 },
+			{ 2811031306790294734, 3026156607858751 },
+			{ 2814057463398153485, 3023382216508843 },
+			{ 2817080845614662328, 3020609043440518 },
+			{ 2820101454658102846, 3017837095937667 },
+			{ 2823119291754040513, 3015066381248149 },
+			{ 2826134358135288662, 3012296906583729 },
+			{ 2829146655041872391, 3009528679120329 },
+			{ 2832156183720992720, 3006761705997921 },
+			{ 2835162945426990641, 3003995994320746 },
+			{ 2838166941421311387, 3001231551157300 },
+			{ 2841168172972468687, 2998468383540442 },
+			{ 2844166641356009129, 2995706498467457 },
+			{ 2847162347854476586, 2992945902900173 },
+			{ 2850155293757376759, 2990186603764927 },
+			{ 2853145480361141686, 2987428607952789 },
+			{ 2856132908969094475, 2984671922319502 },
+			{ 2859117580891413977, 2981916553685662 },
+			{ 2862099497445099639, 2979162508836740 },
+			{ 2865078659953936379, 2976409794523108 },
+			{ 2868055069748459487, 2973658417460264 },
+			{ 2871028728165919751, 2970908384328789 },
+			{ 2873999636550248540, 2968159701774420 },
+			{ 2876967796252022960, 2965412376408185 },
+			{ 2879933208628431145, 2962666414806468 },
+			{ 2882895875043237613, 2959921823511069 },
+			{ 2885855796866748682, 2957178609029291 },
+			{ 2888812975475777973, 2954436777833988 },
+			{ 2891767412253611961, 2951696336363720 },
+			{ 2894719108589975681, 2948957291022727 },
+			{ 2897668065880998408, 2946219648181133 },
+			{ 2900614285529179541, 2943483414174874 },
+			{ 2903557768943354415, 2940748595305924 },
+			{ 2906498517538660339, 2938015197842280 },
+			{ 2909436532736502619, 2935283228018057 },
+			{ 2912371815964520676, 2932552692033620 },
+			{ 2915304368656554296, 2929823596055588 },
+			{ 2918234192252609884, 2927095946216971 },
+			{ 2921161288198826855, 2924369748617207 },
+			{ 2924085657947444062, 2921645009322315 },
+			{ 2927007302956766377, 2918921734364856 },
+			{ 2929926224691131233, 2916199929744141 },
+			{ 2932842424620875374, 2913479601426231 },
+			{ 2935755904222301605, 2910760755344036 },
+			{ 2938666664977645641, 2908043397397423 },
+			{ 2941574708375043064, 2905327533453250 },
+			{ 2944480035908496314, 2902613169345496 },
+			{ 2947382649077841810, 2899900310875304 },
+			{ 2950282549388717114, 2897188963811102 },
+			{ 2953179738352528216, 2894479133888624 },
+			{ 2956074217486416840, 2891770826811074 },
+			{ 2958965988313227914, 2889064048249129 },
+			{ 2961855052361477043, 2886358803841088 },
+			{ 2964741411165318131, 2883655099192885 },
+			{ 2967625066264511016, 2880952939878264 },
+			{ 2970506019204389280, 2878252331438758 },
+			{ 2973384271535828038, 2875553279383846 },
+			{ 2976259824815211884, 2872855789190990 },
+			{ 2979132680604402874, 2870159866305795 },
+			{ 2982002840470708669, 2867465516141964 },
+			{ 2984870305986850633, 2864772744081513 },
+			{ 2987735078730932146, 2862081555474772 },
+			{ 2990597160286406918, 2859391955640472 },
+			{ 2993456552242047390, 2856703949865911 },
+			{ 2996313256191913301, 2854017543406915 },
+			{ 2999167273735320216, 2851332741488006 },
+			{ 3002018606476808222, 2848649549302460 },
+			{ 3004867256026110682, 2845967972012428 },
+			{ 3007713223998123110, 2843288014748913 },
+			{ 3010556512012872023, 2840609682612008 },
+			{ 3013397121695484031, 2837932980670850 },
+			{ 3016235054676154881, 2835257913963762 },
+			{ 3019070312590118643, 2832584487498329 },
+			{ 3021902897077616972, 2829912706251524 },
+			{ 3024732809783868496, 2827242575169701 },
+			{ 3027560052359038197, 2824574099168729 },
+			{ 3030384626458206926, 2821907283134124 },
+			{ 3033206533741341050, 2819242131921076 },
+			{ 3036025775873262126, 2816578650354476 },
+			{ 3038842354523616602, 2813916843229217 },
+			{ 3041656271366845819, 2811256715309955 },
+			{ 3044467528082155774, 2808598271331529 },
+			{ 3047276126353487303, 2805941515998808 },
+			{ 3050082067869486111, 2803286453986851 },
+			{ 3052885354323472962, 2800633089941057 },
+			{ 3055685987413414019, 2797981428477131 },
+			{ 3058483968841891150, 2795331474181282 },
+			{ 3061279300316072432, 2792683231610217 },
+			{ 3064071983547682649, 2790036705291291 },
+			{ 3066862020252973940, 2787391899722542 },
+			{ 3069649412152696482, 2784748819372849 },
+			{ 3072434160972069331, 2782107468681932 },
+			{ 3075216268440751263, 2779467852060481 },
+			{ 3077995736292811744, 2776829973890253 },
+			{ 3080772566266701997, 2774193838524108 },
+			{ 3083546760105226105, 2771559450286187 },
+			{ 3086318319555512292, 2768926813471890 },
+			{ 3089087246368984182, 2766295932348023 },
+			{ 3091853542301332205, 2763666811152860 },
+			{ 3094617209112485065, 2761039454096285 },
+			{ 3097378248566581350, 2758413865359771 },
+			{ 3100136662431941121, 2755790049096582 },
+			{ 3102892452481037703, 2753168009431761 },
+			{ 3105645620490469464, 2750547750462283 },
+			{ 3108396168240931747, 2747929276257112 },
+			{ 3111144097517188859, 2745312590857303 },
+			{ 3113889410108046162, 2742697698276032 },
+			{ 3116632107806322194, 2740084602498781 },
+			{ 3119372192408820975, 2737473307483333 },
+			{ 3122109665716304308, 2734863817159903 },
+			{ 3124844529533464211, 2732256135431233 },
+			{ 3127576785668895444, 2729650266172620 },
+			{ 3130306435935068064, 2727046213232063 },
+			{ 3133033482148300127, 2724443980430298 },
+			{ 3135757926128730425, 2721843571561009 },
+			{ 3138479769700291434, 2719244990390675 },
+			{ 3141199014690682109, 2716648240658858 },
+			{ 3143915662931340967, 2714053326078292 },
+			{ 3146629716257419259, 2711460250334792 },
+			{ 3149341176507754051, 2708869017087524 },
+			{ 3152050045524841575, 2706279629968996 },
+			{ 3154756325154810571, 2703692092585165 },
+			{ 3157460017247395736, 2701106408515513 },
+			{ 3160161123655911249, 2698522581313173 },
+			{ 3162859646237224422, 2695940614504926 },
+			{ 3165555586851729348, 2693360511591422 },
+			{ 3168248947363320770, 2690782276047110 },
+			{ 3170939729639367880, 2688205911320448 },
+			{ 3173627935550688328, 2685631420833934 },
+			{ 3176313566971522262, 2683058807984147 },
+			{ 3178996625779506409, 2680488076141983 },
+			{ 3181677113855648392, 2677919228652544 },
+			{ 3184355033084300936, 2675352268835347 },
+			{ 3187030385353136283, 2672787199984409 },
+			{ 3189703172553120692, 2670224025368268 },
+			{ 3192373396578488960, 2667662748230118 },
+			{ 3195041059326719078, 2665103371787866 },
+			{ 3197706162698506944, 2662545899234277 },
+			{ 3200368708597741221, 2659990333736921 },
+			{ 3203028698931478142, 2657436678438436 },
+			{ 3205686135609916578, 2654884936456472 },
+			{ 3208341020546373050, 2652335110883834 },
+			{ 3210993355657256884, 2649787204788607 },
+			{ 3213643142862045491, 2647241221214111 },
+			{ 3216290384083259602, 2644697163179133 },
+			{ 3218935081246438735, 2642155033677916 },
+			{ 3221577236280116651, 2639614835680282 },
+			{ 3224216851115796933, 2637076572131720 },
+			{ 3226853927687928653, 2634540245953406 },
+			{ 3229488467933882059, 2632005860042417 },
+			{ 3232120473793924476, 2629473417271654 },
+			{ 3234749947211196130, 2626942920490053 },
+			{ 3237376890131686183, 2624414372522634 },
+			{ 3240001304504208817, 2621887776170512 },
+			{ 3242623192280379329, 2619363134211122 },
+			{ 3245242555414590451, 2616840449398168 },
+			{ 3247859395863988619, 2614319724461764 },
+			{ 3250473715588450383, 2611800962108535 },
+			{ 3253085516550558918, 2609284165021655 },
+			{ 3255694800715580573, 2606769335860992 },
+			{ 3258301570051441565, 2604256477263090 },
+			{ 3260905826528704655, 2601745591841354 },
+			{ 3263507572120546009, 2599236682186132 },
+			{ 3266106808802732141, 2596729750864677 },
+			{ 3268703538553596818, 2594224800421350 },
+			{ 3271297763354018168, 2591721833377684 },
+			{ 3273889485187395852, 2589220852232395 },
+			{ 3276478706039628247, 2586721859461578 },
+			{ 3279065427899089825, 2584224857518675 },
+			{ 3281649652756608500, 2581729848834643 },
+			{ 3284231382605443143, 2579236835817975 },
+			{ 3286810619441261118, 2576745820854792 },
+			{ 3289387365262115910, 2574256806309027 },
+			{ 3291961622068424937, 2571769794522310 },
+			{ 3294533391862947247, 2569284787814256 },
+			{ 3297102676650761503, 2566801788482360 },
+			{ 3299669478439243863, 2564320798802222 },
+			{ 3302233799238046085, 2561841821027585 },
+			{ 3304795641059073670, 2559364857390402 },
+			{ 3307355005916464072, 2556889910100853 },
+			{ 3309911895826564925, 2554416981347615 },
+			{ 3312466312807912540, 2551946073297679 },
+			{ 3315018258881210219, 2549477188096720 },
+			{ 3317567736069306939, 2547010327868906 },
+			{ 3320114746397175845, 2544545494717156 },
+			{ 3322659291891893001, 2542082690723196 },
+			{ 3325201374582616197, 2539621917947566 },
+			{ 3327740996500563763, 2537163178429738 },
+			{ 3330278159678993501, 2534706474188238 },
+			{ 3332812866153181739, 2532251807220677 },
+			{ 3335345117960402416, 2529799179503817 },
+			{ 3337874917139906233, 2527348592993731 },
+			{ 3340402265732899964, 2524900049625757 },
+			{ 3342927165782525721, 2522453551314715 },
+			{ 3345449619333840436, 2520009099954864 },
+			{ 3347969628433795300, 2517566697420085 },
+			{ 3350487195131215385, 2515126345563881 },
+			{ 3353002321476779266, 2512688046219483 },
+			{ 3355515009522998749, 2510251801199956 },
+			{ 3358025261324198705, 2507817612298245 },
+			{ 3360533078936496950, 2505385481287205 },
+			{ 3363038464417784155, 2502955409919863 },
+			{ 3365541419827704018, 2500527399929195 },
+			{ 3368041947227633213, 2498101453028574 },
+			{ 3370540048680661787, 2495677570911463 },
+			{ 3373035726251573250, 2493255755251799 },
+			{ 3375528982006825049, 2490836007703937 },
+			{ 3378019818014528986, 2488418329902683 },
+			{ 3380508236344431669, 2486002723463501 },
+			{ 3382994239067895170, 2483589189982467 },
+			{ 3385477828257877637, 2481177731036455 },
+			{ 3387959005988914092, 2478768348183076 },
+			{ 3390437774337097168, 2476361042960915 },
+			{ 3392914135380058083, 2473955816889495 },
+			{ 3395388091196947578, 2471552671469347 },
+			{ 3397859643868416925, 2469151608182229 },
+			{ 3400328795476599154, 2466752628490967 },
+			{ 3402795548105090121, 2464355733839781 },
+			{ 3405259903838929902, 2461960925654182 },
+			{ 3407721864764584084, 2459568205341095 },
+			{ 3410181432969925179, 2457177574288979 },
+			{ 3412638610544214158, 2454789033867867 },
+			{ 3415093399578082025, 2452402585429434 },
+			{ 3417545802163511459, 2450018230307100 },
+			{ 3419995820393818559, 2447635969816045 },
+			{ 3422443456363634604, 2445255805253372 },
+			{ 3424888712168887976, 2442877737898139 },
+			{ 3427331589906786115, 2440501769011373 },
+			{ 3429772091675797488, 2438127899836259 },
+			{ 3432210219575633747, 2435756131598125 },
+			{ 3434645975707231872, 2433386465504563 },
+			{ 3437079362172736435, 2431018902745500 },
+			{ 3439510381075481935, 2428653444493202 },
+			{ 3441939034519975137, 2426290091902473 },
+			{ 3444365324611877610, 2423928846110611 },
+			{ 3446789253457988221, 2421569708237544 },
+			{ 3449210823166225765, 2419212679385919 },
+			{ 3451630035845611684, 2416857760641063 },
+			{ 3454046893606252747, 2414504953071247 },
+			{ 3456461398559323994, 2412154257727535 },
+			{ 3458873552817051529, 2409805675644082 },
+			{ 3461283358492695611, 2407459207837981 },
+			{ 3463690817700533592, 2405114855309528 },
+			{ 3466095932555843120, 2402772619042190 },
+			{ 3468498705174885310, 2400432500002711 },
+			{ 3470899137674888021, 2398094499141127 },
+			{ 3473297232174029148, 2395758617390938 },
+			{ 3475692990791420086, 2393424855669097 },
+			{ 3478086415647089183, 2391093214876109 },
+			{ 3480477508861965292, 2388763695896126 },
+			{ 3482866272557861418, 2386436299596911 },
+			{ 3485252708857458329, 2384111026830128 },
+			{ 3487636819884288457, 2381787878431150 },
+			{ 3490018607762719607, 2379466855219335 },
+			{ 3492398074617938942, 2377147957997910 },
+			{ 3494775222575936852, 2374831187554319 },
+			{ 3497150053763491171, 2372516544659918 },
+			{ 3499522570308151089, 2370204030070423 },
+			{ 3501892774338221512, 2367893644525673 },
+			{ 3504260667982747185, 2365585388749880 },
+			{ 3506626253371497065, 2363279263451706 },
+			{ 3508989532634948771, 2360975269324123 },
+			{ 3511350507904272894, 2358673407044769 },
+			{ 3513709181311317663, 2356373677275843 },
+			{ 3516065554988593506, 2354076080664141 },
+			{ 3518419631069257647, 2351780617841319 },
+			{ 3520771411687098966, 2349487289423668 },
+			{ 3523120898976522634, 2347196096012535 },
+			{ 3525468095072535169, 2344907038194049 },
+			{ 3527813002110729218, 2342620116539402 },
+			{ 3530155622227268620, 2340335331604898 },
+			{ 3532495957558873518, 2338052683931894 },
+			{ 3534834010242805412, 2335772174047029 },
+			{ 3537169782416852441, 2333493802462174 },
+			{ 3539503276219314615, 2331217569674532 },
+			{ 3541834493788989147, 2328943476166740 },
+			{ 3544163437265155887, 2326671522406901 },
+			{ 3546490108787562788, 2324401708848639 },
+			{ 3548814510496411427, 2322134035931167 },
+			{ 3551136644532342594, 2319868504079427 },
+			{ 3553456513036422021, 2317605113704058 },
+			{ 3555774118150126079, 2315343865201479 },
+			{ 3558089462015327558, 2313084758953990 },
+			{ 3560402546774281548, 2310827795329866 },
+			{ 3562713374569611414, 2308572974683302 },
+			{ 3565021947544294716, 2306320297354604 },
+			{ 3567328267841649320, 2304069763670213 },
+			{ 3569632337605319533, 2301821373942711 },
+			{ 3571934158979262244, 2299575128470930 },
+			{ 3574233734107733174, 2297331027540125 },
+			{ 3576531065135273299, 2295089071421814 },
+			{ 3578826154206695113, 2292849260373975 },
+			{ 3581119003467069088, 2290611594641152 },
+			{ 3583409615061710240, 2288376074454447 },
+			{ 3585697991136164687, 2286142700031528 },
+			{ 3587984133836196215, 2283911471576870 },
+			{ 3590268045307773085, 2281682389281632 },
+			{ 3592549727697054717, 2279455453323783 },
+			{ 3594829183150378500, 2277230663868259 },
+			{ 3597106413814246759, 2275008021066878 },
+			{ 3599381421835313637, 2272787525058489 },
+			{ 3601654209360372126, 2270569175968993 },
+			{ 3603924778536341119, 2268352973911482 },
+			{ 3606193131510252601, 2266138918986172 },
+			{ 3608459270429238773, 2263927011280591 },
+			{ 3610723197440519364, 2261717250869547 },
+			{ 3612984914691388911, 2259509637815254 },
+			{ 3615244424329204165, 2257304172167338 },
+			{ 3617501728501371503, 2255100853963000 },
+			{ 3619756829355334503, 2252899683226886 },
+#endif
+		};
 	};
-
-	template<unsigned int F>
-	constexpr std::array<int64_t, 10001> sin_lut<F>::lut_src;
-	template<unsigned int F>
-	constexpr std::array<int64_t, 10001> sin_lut<F>::lut_dst;
 }
 
-#endif
\ No newline at end of file
+#endif
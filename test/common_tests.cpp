@@ -2,6 +2,7 @@
 #define FIXED_64_ENABLE_SATURATING 1
 
 #include "fixed64.hpp"
+#include "piecewise_chebyshev.hpp"
 #include <math.h>
 #include <assert.h>
 #include <algorithm>
@@ -16,6 +17,194 @@
 using namespace f64;
 using fixed = fixed64<FRACTION_BITS>;
 
+// the intrinsics behind fixed64 multiplies are not constexpr, tables built from
+// them are made at startup instead
+#if FIXED_64_ENABLE_INT128_ACCELERATION
+#define TEST_CONSTEXPR_TABLE const
+#else
+#define TEST_CONSTEXPR_TABLE constexpr
+#endif
+
+static double rsqrt(double x) { return 1 / std::sqrt(x); }
+static double cot(double x) { return 1 / std::tan(x); }
+static double sincos_sin(double x) { return std::sin(x); }
+static double sincos_cos(double x) { return std::cos(x); }
+template<unsigned int F> fixed64<F> sincos_sin(fixed64<F> x) { fixed64<F> s, c; sincos(x, &s, &c); return s; }
+template<unsigned int F> fixed64<F> sincos_cos(fixed64<F> x) { fixed64<F> s, c; sincos(x, &s, &c); return c; }
+static double sinhcosh_sinh(double x) { return std::sinh(x); }
+static double sinhcosh_cosh(double x) { return std::cosh(x); }
+template<unsigned int F> fixed64<F> sinhcosh_sinh(fixed64<F> x) { fixed64<F> s, c; sinhcosh(x, &s, &c); return s; }
+template<unsigned int F> fixed64<F> sinhcosh_cosh(fixed64<F> x) { fixed64<F> s, c; sinhcosh(x, &s, &c); return c; }
+static double angle_sin(double x) { return std::sin(x); }
+static double angle_cos(double x) { return std::cos(x); }
+static double angle_wrap(double x) { return std::remainder(x, 2 * 3.14159265358979323846); }
+template<unsigned int F> fixed64<F> angle_sin(fixed64<F> x) { return sin<F>(angle::from_radians(x)); }
+template<unsigned int F> fixed64<F> angle_cos(fixed64<F> x) { return cos<F>(angle::from_radians(x)); }
+template<unsigned int F> fixed64<F> angle_wrap(fixed64<F> x) { return angle::from_radians(x).template radians<F>(); }
+static double fast_exp2(double x) { return std::exp2(x); }
+static double fast_log2(double x) { return std::log2(x); }
+template<unsigned int F> fixed64<F> fast_exp2(fixed64<F> x) { return fast::exp2(x); }
+template<unsigned int F> fixed64<F> fast_log2(fixed64<F> x) { return fast::log2(x); }
+static double fast_exp(double x) { return std::exp(x); }
+static double fast_log(double x) { return std::log(x); }
+static double fast_tanh(double x) { return std::tanh(x); }
+static double fast_asin(double x) { return std::asin(x); }
+static double fast_atan2(double y, double x) { return std::atan2(y, x); }
+static double precise_sin(double x) { return std::sin(x); }
+static double precise_tan(double x) { return std::tan(x); }
+static double precise_atan(double x) { return std::atan(x); }
+static double precise_pow(double x, double y) { return std::pow(x, y); }
+template<unsigned int F> fixed64<F> fast_exp(fixed64<F> x) { return fast::exp(x); }
+template<unsigned int F> fixed64<F> fast_log(fixed64<F> x) { return fast::log(x); }
+template<unsigned int F> fixed64<F> fast_tanh(fixed64<F> x) { return fast::tanh(x); }
+template<unsigned int F> fixed64<F> fast_asin(fixed64<F> x) { return fast::asin(x); }
+template<unsigned int F> fixed64<F> fast_atan2(fixed64<F> y, fixed64<F> x) { return fast::atan2(y, x); }
+template<unsigned int F> fixed64<F> precise_sin(fixed64<F> x) { return precise::sin(x); }
+template<unsigned int F> fixed64<F> precise_tan(fixed64<F> x) { return precise::tan(x); }
+template<unsigned int F> fixed64<F> precise_atan(fixed64<F> x) { return precise::atan(x); }
+template<unsigned int F> fixed64<F> precise_pow(fixed64<F> x, fixed64<F> y) { return precise::pow(x, y); }
+static double cordic_cos(double x) { return std::cos(x); }
+static double cordic_sin(double x) { return std::sin(x); }
+static double cordic_atan2(double y, double x) { return std::atan2(y, x); }
+static double cordic_hypot(double x, double y) { return std::hypot(x, y); }
+template<unsigned int F> fixed64<F> cordic_cos(fixed64<F> x) { fixed64<F> c, s; cordic::polar(fixed64<F>(1), x, &c, &s); return c; }
+template<unsigned int F> fixed64<F> cordic_sin(fixed64<F> x) { fixed64<F> c, s; cordic::polar(fixed64<F>(1), x, &c, &s); return s; }
+template<unsigned int F> fixed64<F> cordic_atan2(fixed64<F> y, fixed64<F> x) { fixed64<F> r, t; cordic::vector_to_polar(x, y, &r, &t); return t; }
+template<unsigned int F> fixed64<F> cordic_hypot(fixed64<F> x, fixed64<F> y) { fixed64<F> r, t; cordic::vector_to_polar(x, y, &r, &t); return r; }
+static double chebyshev_falloff(double x) { return std::exp(-x * x); }
+TEST_CONSTEXPR_TABLE auto falloff_fit = chebyshev<FRACTION_BITS, 16>::fit([](fixed x) { return exp(-(x * x)); }, 0, 2);
+template<unsigned int F> constexpr fixed64<F> chebyshev_falloff(fixed64<F> x) { return falloff_fit(x); }
+static double lut_falloff(double x) { return std::exp(-x * x); }
+static double lut_falloff_linear(double x) { return std::exp(-x * x); }
+TEST_CONSTEXPR_TABLE auto falloff_lut = lut<FRACTION_BITS, 64, 3>::generate([](fixed x) { return exp(-(x * x)); }, 0, 2);
+TEST_CONSTEXPR_TABLE auto falloff_lut_linear = lut<FRACTION_BITS, 256, 1>::generate([](fixed x) { return exp(-(x * x)); }, 0, 2);
+template<unsigned int F> constexpr fixed64<F> lut_falloff(fixed64<F> x) { return falloff_lut(x); }
+template<unsigned int F> constexpr fixed64<F> lut_falloff_linear(fixed64<F> x) { return falloff_lut_linear(x); }
+static double pieces_falloff(double x) { return std::exp(-x * x); }
+static double pieces_polyline(double x) { const double f = std::floor(x * 2) / 2; return f * f + (x - f) * (2 * f + 0.5); }
+static const auto falloff_pieces = [] {
+	piecewise_chebyshev<FRACTION_BITS> p;
+	p.fit([](fixed x) { return exp(-(x * x)); }, fixed(0), fixed(2), fixed(0.000001));
+	return p;
+}();
+static const auto polyline_pieces = [] {
+	fixed x[9], y[9];
+	for (int i = 0; i < 9; ++i)
+	{
+		x[i] = fixed(i) / 2;
+		y[i] = x[i] * x[i];
+	}
+	piecewise_chebyshev<FRACTION_BITS> p;
+	p.fit(x, y, 9, fixed(0.00001));
+	return p;
+}();
+template<unsigned int F> fixed64<F> pieces_falloff(fixed64<F> x) { return falloff_pieces(x); }
+template<unsigned int F> fixed64<F> pieces_polyline(fixed64<F> x) { return polyline_pieces(x); }
+static double poly_exp(double x) { return std::exp(x); }
+static double poly_wide(double x) { return 1 + x + x * x + x * x * x / 8; }
+static double sequence_sin(double x) { return std::sin(0.5 + 8192 * x); }
+static double sequence_cos(double x) { return std::cos(0.5 + 8255 * x); }
+template<unsigned int F> fixed64<F> sequence_sin(fixed64<F> x)
+{
+	sincos_sequence<F> seq(fixed64<F>(0.5), x);
+	fixed64<F> s, c;
+	for (int i = 0; i <= 8192; ++i)
+		seq.next(&s, &c);
+	return s;
+}
+template<unsigned int F> fixed64<F> sequence_cos(fixed64<F> x)
+{
+	sincos_sequence<F> seq(fixed64<F>(0.5), x);
+	fixed64<F> s[64], c[64];
+	for (int i = 0; i < 129; ++i)
+		seq.fill(s, c, 64);
+	return c[63];
+}
+static const gradient_noise<FRACTION_BITS> noise(2024);
+static double noise_gradient(const int8_t* g, const double* d, int n) { double r = 0; for (int i = 0; i < n; ++i) r += g[i] * d[i]; return r; }
+static double noise_perlin(double x, double y)
+{
+	const uint8_t* p = noise.permutation();
+	const double v[3] = { x, y, (x + y) / 2 };
+	int cell[3]; double f[3], u[3];
+	for (int i = 0; i < 3; ++i)
+	{
+		cell[i] = int(std::floor(v[i])) & 255;
+		f[i] = v[i] - std::floor(v[i]);
+		u[i] = f[i] * f[i] * f[i] * (f[i] * (f[i] * 6 - 15) + 10);
+	}
+	double c[8];
+	for (int k = 0; k < 8; ++k)
+	{
+		const int o[3] = { k & 1, (k >> 1) & 1, (k >> 2) & 1 };
+		const double d[3] = { f[0] - o[0], f[1] - o[1], f[2] - o[2] };
+		c[k] = noise_gradient(internal::noise_gradients<3>::data[p[cell[0] + o[0] + p[cell[1] + o[1] + p[cell[2] + o[2]]]] & 15], d, 3);
+	}
+	for (int k = 0; k < 4; ++k) c[k] = c[2 * k] + u[0] * (c[2 * k + 1] - c[2 * k]);
+	for (int k = 0; k < 2; ++k) c[k] = c[2 * k] + u[1] * (c[2 * k + 1] - c[2 * k]);
+	return c[0] + u[2] * (c[1] - c[0]);
+}
+static double noise_simplex(double x, double y)
+{
+	const uint8_t* p = noise.permutation();
+	const double F2 = (std::sqrt(3.0) - 1) / 2, G2 = (3 - std::sqrt(3.0)) / 6;
+	const double s = (x + y) * F2;
+	const double i = std::floor(x + s), j = std::floor(y + s);
+	const double t = (i + j) * G2;
+	const double x0 = x - (i - t), y0 = y - (j - t);
+	const int i1 = x0 > y0, j1 = !i1;
+	const double d[3][2] = { { x0, y0 }, { x0 - i1 + G2, y0 - j1 + G2 }, { x0 - 1 + 2 * G2, y0 - 1 + 2 * G2 } };
+	const int ii = int(i) & 255, jj = int(j) & 255;
+	const int h[3] = { p[ii + p[jj]], p[ii + i1 + p[jj + j1]], p[ii + 1 + p[jj + 1]] };
+	double n = 0;
+	for (int k = 0; k < 3; ++k)
+	{
+		const double r = 0.5 - d[k][0] * d[k][0] - d[k][1] * d[k][1];
+		if (r > 0) n += r * r * r * r * noise_gradient(internal::noise_gradients<2>::data[h[k] & 7], d[k], 2);
+	}
+	return 70 * n;
+}
+static double noise_simplex4(double x, double y)
+{
+	const uint8_t* p = noise.permutation();
+	const double F4 = (std::sqrt(5.0) - 1) / 4, G4 = (5 - std::sqrt(5.0)) / 20;
+	const double v[4] = { x, y, (x + y) / 2, (x - y) / 2 };
+	const double s = (v[0] + v[1] + v[2] + v[3]) * F4;
+	double cell[4], d0[4];
+	for (int a = 0; a < 4; ++a) cell[a] = std::floor(v[a] + s);
+	const double t = (cell[0] + cell[1] + cell[2] + cell[3]) * G4;
+	int rank[4] = {};
+	for (int a = 0; a < 4; ++a) d0[a] = v[a] - (cell[a] - t);
+	for (int a = 0; a < 4; ++a) for (int b = a + 1; b < 4; ++b) ++rank[d0[a] > d0[b] ? a : b];
+	double n = 0;
+	for (int k = 0; k < 5; ++k)
+	{
+		int o[4], h = 0; double d[4], r = 0.6;
+		for (int a = 0; a < 4; ++a)
+		{
+			o[a] = rank[a] >= 4 - k;
+			d[a] = d0[a] - o[a] + k * G4;
+			r -= d[a] * d[a];
+		}
+		for (int a = 3; a >= 0; --a) h = p[(int(cell[a]) & 255) + o[a] + h];
+		if (r > 0) n += r * r * r * r * noise_gradient(internal::noise_gradients<4>::data[h & 31], d, 4);
+	}
+	return 27 * n;
+}
+template<unsigned int F> fixed64<F> noise_perlin(fixed64<F> x, fixed64<F> y) { return noise.perlin(x, y, (x + y) / 2); }
+template<unsigned int F> fixed64<F> noise_simplex(fixed64<F> x, fixed64<F> y) { return noise.simplex(x, y); }
+template<unsigned int F> fixed64<F> noise_simplex4(fixed64<F> x, fixed64<F> y) { return noise.simplex(x, y, (x + y) / 2, (x - y) / 2); }
+template<unsigned int F> constexpr fixed64<F> poly_exp(fixed64<F> x)
+{
+	constexpr int64_t ONE = int64_t(1) << F;
+	return poly_eval<ONE, ONE, ONE / 2, ONE / 6, ONE / 24, ONE / 120, ONE / 720, ONE / 5040>(x);
+}
+template<unsigned int F> constexpr fixed64<F> poly_wide(fixed64<F> x)
+{
+	constexpr int64_t ONE = int64_t(1) << F;
+	return poly_eval<ONE, ONE, ONE, ONE / 8>(x);
+}
+
 
 const auto max_error = 0.0001f;
 
@@ -101,20 +290,83 @@ auto test_func = [] {
 	TEST_MATH_OPT(-100, 100, round(a), count, max_error);
 	TEST_MATH_OPT(-100, 100, abs(a), count, max_error);
 	TEST_MATH_OPT(0, 1, exp(a), count, max_error);
+	TEST_MATH_OPT(-20, 10, exp(a), count, max_error);
 	TEST_MATH_OPT(0, 1, exp2(a), count, max_error);
+	TEST_MATH_OPT(-20, 10, exp2(a), count, max_error);
 	TEST_MATH_OPT(0, 100, log2(a), count, max_error);
+	TEST_MATH_OPT(0.001, 1000000, log2(a), count, max_error);
+	TEST_MATH_OPT(0.001, 1000000, log(a), count, max_error);
+	TEST_MATH_OPT(0.001, 1000000, log10(a), count, max_error);
+	TEST_MATH_OPT(-0.9, 100, log1p(a), count, max_error);
+	TEST_MATH_OPT(-0.01, 0.01, log1p(a), count, max_error);
+	TEST_MATH_OPT(-20, 10, expm1(a), count, max_error);
+	TEST_MATH_OPT(-0.01, 0.01, expm1(a), count, max_error);
+	TEST_MATH_OPT(-20, 5, fast_exp2(a), count, max_error);
+	TEST_MATH_OPT(0.001, 1000000, fast_log2(a), count, max_error);
+	TEST_MATH_OPT(-20, 5, fast_exp(a), count, max_error);
+	TEST_MATH_OPT(0.001, 1000000, fast_log(a), count, max_error);
+	TEST_MATH_OPT(-10, 10, fast_tanh(a), count, max_error);
+	TEST_MATH_OPT(-1, 1, fast_asin(a), count, max_error);
+	TEST_MATH_OPT(-100, 100, fast_atan2(a, b), count, max_error);
+	TEST_MATH_OPT(-100, 100, precise_sin(a), count, max_error);
+	TEST_MATH_OPT(-1.5, 1.5, precise_tan(a), count, max_error);
+	TEST_MATH_OPT(-100, 100, precise_atan(a), count, max_error);
+	TEST_MATH_OPT(0.5, 4, precise_pow(a, b), count, max_error);
 	TEST_MATH_OPT(0, 10000, sqrt(a), count, max_error);
+	TEST_MATH_OPT(0.01, 100, rsqrt(a), count, max_error);
+	TEST_MATH_OPT(-10000, 10000, cbrt(a), count, max_error);
+	TEST_MATH_OPT(-1000000, 1000000, hypot(a, b), count, max_error);
 
 	TEST_MATH_OPT(-100, 100, sin(a), count, max_error);
 	TEST_MATH_OPT(-100, 100, cos(a), count, max_error);
+	TEST_MATH_OPT(-100000000, 100000000, sin(a), count, max_error);
 	TEST_MATH_OPT(-pi / 4, pi / 4, tan(a), count, max_error);
+	TEST_MATH_OPT(-1.5, 1.5, tan(a), count, max_error);
+	TEST_MATH_OPT(pi / 8, pi * 3 / 8, cot(a), count, max_error);
+	TEST_MATH_OPT(-100, 100, sincos_sin(a), count, max_error);
+	TEST_MATH_OPT(-100, 100, sincos_cos(a), count, max_error);
+	TEST_MATH_OPT(-100, 100, angle_sin(a), count, max_error);
+	TEST_MATH_OPT(-100, 100, angle_cos(a), count, max_error);
+	TEST_MATH_OPT(-100, 100, angle_wrap(a), count, max_error);
 
 	TEST_MATH_OPT(-1, 1, asin(a), count, max_error);
 	TEST_MATH_OPT(-1, 1, acos(a), count, max_error);
+	TEST_MATH_OPT(0.9, 1, asin(a), count, max_error);
+	TEST_MATH_OPT(-1, -0.9, acos(a), count, max_error);
 	TEST_MATH_OPT(-100, 100, atan(a), count, max_error);
+	TEST_MATH_OPT(-100, 100, atan2(a, b), count, max_error);
+
+	TEST_MATH_OPT(-100, 100, cordic_cos(a), count, max_error);
+	TEST_MATH_OPT(-100, 100, cordic_sin(a), count, max_error);
+	TEST_MATH_OPT(-100, 100, cordic_atan2(a, b), count, max_error);
+	TEST_MATH_OPT(-1000000, 1000000, cordic_hypot(a, b), count, max_error);
+
+	TEST_MATH_OPT(0, 2, chebyshev_falloff(a), count, max_error);
+	TEST_MATH_OPT(0, 2, lut_falloff(a), count, max_error);
+	TEST_MATH_OPT(0, 2, lut_falloff_linear(a), count, max_error);
+	TEST_MATH_OPT(0, 2, pieces_falloff(a), count, max_error);
+	TEST_MATH_OPT(0, 3.99, pieces_polyline(a), count, max_error);
+	TEST_MATH_OPT(-0.5, 0.5, poly_exp(a), count, max_error);
+	TEST_MATH_OPT(-300, 300, poly_wide(a), count, max_error);
+	TEST_MATH_OPT(-0.001, 0.001, sequence_sin(a), count / 64, max_error);
+	TEST_MATH_OPT(-0.001, 0.001, sequence_cos(a), count / 64, max_error);
+	TEST_MATH_OPT(-300, 300, noise_perlin(a, b), count, max_error);
+	TEST_MATH_OPT(-300, 300, noise_simplex(a, b), count, max_error);
+	TEST_MATH_OPT(-300, 300, noise_simplex4(a, b), count, max_error);
+
+	TEST_MATH_OPT(-10, 10, sinh(a), count, max_error);
+	TEST_MATH_OPT(-10, 10, cosh(a), count, max_error);
+	TEST_MATH_OPT(-10, 10, tanh(a), count, max_error);
+	TEST_MATH_OPT(-0.1, 0.1, sinh(a), count, max_error);
+	TEST_MATH_OPT(-0.1, 0.1, tanh(a), count, max_error);
+	TEST_MATH_OPT(-10, 10, sinhcosh_sinh(a), count, max_error);
+	TEST_MATH_OPT(-10, 10, sinhcosh_cosh(a), count, max_error);
 
 	TEST_MATH_OPT(-100, 100, fmod(a,b), count, max_error);
 	TEST_MATH_OPT(0, 1, pow(a,b), count, max_error);
+	TEST_MATH_OPT(0.5, 4, pow(a,b), count, max_error);
+	TEST_MATH_OPT(0.5, 4, pow(a,5), count, max_error);
+	TEST_MATH_OPT(0.5, 4, pow(a,-5), count, max_error);
 
 
 
@@ -132,16 +384,45 @@ auto test_func = [] {
 
 #if __cplusplus >= 202002L || FIXED_64_FORCE_EVALUATE_IN_COMPILE_TIME // MSVC requires /Zc:__cplusplus 
 	TEST_CONSTEXPR(sqrt, c_a);
+	TEST_CONSTEXPR(rsqrt, c_a);
+	TEST_CONSTEXPR(cbrt, c_a);
+	TEST_CONSTEXPR(hypot, c_a, c_b);
+	TEST_CONSTEXPR(hypot, c_a, c_b, c_a);
 	TEST_CONSTEXPR(pow, c_a, c_b);
+	TEST_CONSTEXPR(pow, c_b, -3);
 	TEST_CONSTEXPR(log2, c_a);
+	TEST_CONSTEXPR(log, c_a);
+	TEST_CONSTEXPR(log10, c_a);
+	TEST_CONSTEXPR(log1p, c_b);
+	TEST_CONSTEXPR(expm1, c_b);
+	TEST_CONSTEXPR(sinh, c_a);
+	TEST_CONSTEXPR(cosh, c_a);
+	TEST_CONSTEXPR(tanh, c_a);
+	TEST_CONSTEXPR(sinh, c_b);
+	TEST_CONSTEXPR(tanh, c_b);
+	TEST_CONSTEXPR(sinhcosh_sinh, c_a);
+	TEST_CONSTEXPR(fast_exp2, c_a);
+	TEST_CONSTEXPR(fast_log2, c_a);
+	TEST_CONSTEXPR(fast_asin, c_b);
+	TEST_CONSTEXPR(precise_sin, c_a);
+	TEST_CONSTEXPR(precise_atan, c_a);
 
 	TEST_CONSTEXPR(sin, c_a);
 	TEST_CONSTEXPR(cos, c_a);
 	TEST_CONSTEXPR(tan, c_a);
+	TEST_CONSTEXPR(cot, c_a);
+	TEST_CONSTEXPR(angle_sin, c_a);
+	TEST_CONSTEXPR(angle_wrap, c_a);
 
 	TEST_CONSTEXPR(asin, c_a);
 	TEST_CONSTEXPR(acos, c_a);
 	TEST_CONSTEXPR(atan, c_a);
+	TEST_CONSTEXPR(atan2, c_a, c_b);
+	TEST_CONSTEXPR(cordic_sin, c_a);
+	TEST_CONSTEXPR(cordic_atan2, c_a, c_b);
+	TEST_CONSTEXPR(chebyshev_falloff, c_a);
+	TEST_CONSTEXPR(poly_exp, c_b);
+	TEST_CONSTEXPR(lut_falloff, c_a);
 
 #endif
 
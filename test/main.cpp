@@ -1,7 +1,11 @@
-extern void test_division_overflow_detection();
+extern int test_division_overflow_detection();
+extern int test_sqrt();
+extern int test_noise();
 
 int main()
 {
-    test_division_overflow_detection();
-    return 0;
+    int failed = test_division_overflow_detection();
+    failed += test_sqrt();
+    failed += test_noise();
+    return failed == 0 ? 0 : 1;
 }
\ No newline at end of file
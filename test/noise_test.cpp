@@ -0,0 +1,106 @@
+#include "fixed64.hpp"
+#include <cstdio>
+
+using namespace f64;
+
+static int pass_count = 0;
+static int fail_count = 0;
+
+static void check(const char* name, bool ok, const char* detail = nullptr)
+{
+    printf("  %s  %s", ok ? "PASS" : "FAIL", name);
+    if (detail) printf("  (%s)", detail);
+    printf("\n");
+    ok ? pass_count++ : fail_count++;
+}
+
+// FNV-1a over the raw values
+template <unsigned int F>
+static uint64_t hash_raw(const fixed64<F>* v, size_t n)
+{
+    uint64_t h = 0xCBF29CE484222325ull;
+    for (size_t i = 0; i < n; ++i)
+    {
+        const uint64_t r = uint64_t(v[i].raw_value());
+        for (int b = 0; b < 64; b += 8)
+            h = (h ^ ((r >> b) & 0xFF)) * 0x100000001B3ull;
+    }
+    return h;
+}
+
+static void check_hash(const char* name, uint64_t got, uint64_t expected)
+{
+    char buf[128];
+    snprintf(buf, sizeof(buf), "expect=%016llx, got=%016llx", (unsigned long long)expected, (unsigned long long)got);
+    check(name, got == expected, buf);
+}
+
+int test_noise()
+{
+    printf("==== test_noise ====\n");
+    printf("Verifies that seeded noise keeps the exact same bits, which lockstep clients rely on.\n\n");
+
+    using fixed = fixed64<32>;
+    const gradient_noise<32> noise(2024);
+    const fixed x0 = fixed(-7.3), y0 = fixed(11.1), z0 = fixed(0.45), step = fixed(0.173);
+
+    // Case 1: the shuffled permutation
+    {
+        const uint8_t* p = noise.permutation();
+        uint64_t h = 0xCBF29CE484222325ull;
+        bool doubled = true;
+        for (size_t i = 0; i < 2 * gradient_noise<32>::PERIOD; ++i)
+        {
+            h = (h ^ p[i]) * 0x100000001B3ull;
+            doubled = doubled && p[i] == p[i % gradient_noise<32>::PERIOD];
+        }
+        check_hash("permutation of seed 2024", h, 0x4416406879DEB6B9ull);
+        check("permutation is stored twice", doubled);
+    }
+
+    // Case 2: grids in 2D and 3D
+    {
+        static fixed out[32 * 32];
+        noise.perlin_grid(x0, y0, step, 32, 32, out);
+        check_hash("perlin_grid 32x32", hash_raw(out, 32 * 32), 0x520CBC73D03036B0ull);
+        noise.simplex_grid(x0, y0, step, 32, 32, out);
+        check_hash("simplex_grid 32x32", hash_raw(out, 32 * 32), 0x91A67B277DECC20Aull);
+        noise.perlin_grid(x0, y0, z0, step, 8, 8, 8, out);
+        check_hash("perlin_grid 8x8x8", hash_raw(out, 8 * 8 * 8), 0x53A0966D7E317061ull);
+        noise.simplex_grid(x0, y0, z0, step, 8, 8, 8, out);
+        check_hash("simplex_grid 8x8x8", hash_raw(out, 8 * 8 * 8), 0xD7AA7796D239B02Dull);
+    }
+
+    // Case 3: points in 4D, which have no grid
+    {
+        fixed out[2 * 64];
+        for (int i = 0; i < 64; ++i)
+        {
+            const fixed t = step * i;
+            out[2 * i] = noise.perlin(x0 + t, y0 - t, z0 + t * 2, t * 3);
+            out[2 * i + 1] = noise.simplex(x0 + t, y0 - t, z0 + t * 2, t * 3);
+        }
+        check_hash("perlin and simplex 4D", hash_raw(out, 2 * 64), 0x70980FDC4DD06AE4ull);
+    }
+
+    // Case 4: another precision and the default seed
+    {
+        static fixed64<16> out[16 * 16];
+        gradient_noise<16>().simplex_grid(fixed64<16>(-3), fixed64<16>(5), fixed64<16>(0.25), 16, 16, out);
+        check_hash("simplex_grid 16x16 in Q16, seed 0", hash_raw(out, 16 * 16), 0x5056C8AC34CF11D7ull);
+    }
+
+    // Case 5: a grid is the same as its points
+    {
+        static fixed out[16 * 16];
+        noise.simplex_grid(x0, y0, step, 16, 16, out);
+        bool same = true;
+        for (int j = 0; j < 16; ++j)
+            for (int i = 0; i < 16; ++i)
+                same = same && out[j * 16 + i].raw_value() == noise.simplex(x0 + step * i, y0 + step * j).raw_value();
+        check("simplex_grid matches simplex", same);
+    }
+
+    printf("\n==== noise_test: %d passed, %d failed ====\n", pass_count, fail_count);
+    return fail_count;
+}
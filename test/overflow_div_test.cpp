@@ -22,7 +22,7 @@ static void check(const char* name, bool ok, const char* detail = nullptr)
     ok ? pass_count++ : fail_count++;
 }
 
-void test_division_overflow_detection()
+int test_division_overflow_detection()
 {
     printf("==== test_division_overflow_detection ====\n");
     printf("Verifies that operator/= detects overflow and saturates correctly.\n");
@@ -118,4 +118,5 @@ void test_division_overflow_detection()
     }
 
     printf("\n==== overflow_div_test: %d passed, %d failed ====\n", pass_count, fail_count);
+    return fail_count;
 }
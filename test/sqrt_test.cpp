@@ -0,0 +1,129 @@
+#include "fixed64.hpp"
+#include <cstdio>
+#include <cmath>
+#include <random>
+
+using namespace f64;
+
+static int pass_count = 0;
+static int fail_count = 0;
+
+static void check(const char* name, bool ok, const char* detail = nullptr)
+{
+    printf("  %s  %s", ok ? "PASS" : "FAIL", name);
+    if (detail) printf("  (%s)", detail);
+    printf("\n");
+    ok ? pass_count++ : fail_count++;
+}
+
+int test_sqrt()
+{
+    printf("==== test_sqrt ====\n");
+    printf("Verifies that the seeded roots match the bit-by-bit loop exactly.\n\n");
+
+    // Case 1: perfect squares and their neighbours, where the seed is most likely to be off
+    {
+        uint64_t mismatch = 0;
+        for (uint64_t r = 1; r < 0x1'0000'0000ull; r = r * 3 / 2 + 1)
+        {
+            const uint64_t sq = r * r;
+            for (uint64_t n : { sq - 1, sq, sq + 1 })
+            {
+                if (internal::isqrt(n) != internal::isqrt_bitwise(n))
+                    mismatch++;
+            }
+        }
+        for (uint64_t n : { uint64_t(0), uint64_t(1), ~uint64_t(0), ~uint64_t(0) - 1, uint64_t(0xFFFF'FFFE'0000'0001ull) })
+        {
+            if (internal::isqrt(n) != internal::isqrt_bitwise(n))
+                mismatch++;
+        }
+
+        char buf[128];
+        snprintf(buf, sizeof(buf), "mismatches=%llu", (unsigned long long)mismatch);
+        check("isqrt == isqrt_bitwise near perfect squares", mismatch == 0, buf);
+    }
+
+    // Case 2: random raw values through the public function
+    {
+        std::mt19937_64 rng(1234);
+        uint64_t mismatch = 0;
+        for (int i = 0; i < 0xfffff; ++i)
+        {
+            const uint64_t n = rng() >> (rng() & 63);
+            if (internal::isqrt(n) != internal::isqrt_bitwise(n))
+                mismatch++;
+        }
+
+        char buf[128];
+        snprintf(buf, sizeof(buf), "mismatches=%llu", (unsigned long long)mismatch);
+        check("isqrt == isqrt_bitwise on random input", mismatch == 0, buf);
+    }
+
+    // Case 3: sanity check on an odd fraction
+    {
+        using f31 = fixed64<31>;
+        double got = (double)sqrt(f31(2));
+        bool ok = std::abs(got - std::sqrt(2.0)) < 1e-4;
+
+        char buf[128];
+        snprintf(buf, sizeof(buf), "sqrt(2) expect=1.414214, got=%.6f", got);
+        check("sqrt with odd FractionBits", ok, buf);
+    }
+
+    // Case 4: 128-bit root against the bit-by-bit loop
+    {
+        std::mt19937_64 rng(5678);
+        uint64_t mismatch = 0;
+        for (int i = 0; i < 0xfffff; ++i)
+        {
+            uint128 n = { rng() >> (rng() & 63), rng() };
+            if (internal::isqrt(n) != internal::isqrt_bitwise(n))
+                mismatch++;
+        }
+        for (uint64_t r : { uint64_t(0x1'0000'0000ull), uint64_t(0xFFFF'FFFF'FFFF'FFFFull), uint64_t(0x8000'0000'0000'0001ull) })
+        {
+            const uint128 sq = uint128::mul(r, r);
+            if (internal::isqrt(sq) != r || internal::isqrt(sq - uint128{ 0, 1 }) != r - 1)
+                mismatch++;
+        }
+
+        char buf[128];
+        snprintf(buf, sizeof(buf), "mismatches=%llu", (unsigned long long)mismatch);
+        check("128-bit isqrt == isqrt_bitwise", mismatch == 0, buf);
+    }
+
+    // Case 5: vector length whose squares overflow Q32.32
+    {
+        using fixed = fixed64<32>;
+        double got = (double)length3(fixed(100000), fixed(-200000), fixed(300000));
+        double expected = std::sqrt(100000.0 * 100000.0 + 200000.0 * 200000.0 + 300000.0 * 300000.0);
+        bool ok = std::abs(got - expected) < 1e-6;
+
+        char buf[128];
+        snprintf(buf, sizeof(buf), "expect=%.6f, got=%.6f", expected, got);
+        check("length3 without intermediate overflow", ok, buf);
+    }
+
+    // Case 6: high fractional precision, the result keeps all of its bits
+    {
+        using f60 = fixed64<60>;
+        double got = (double)length2(f60(1.5), f60(2));
+        bool ok = got == 2.5;
+
+        char buf[128];
+        snprintf(buf, sizeof(buf), "length2(1.5, 2) expect=2.5, got=%.17f", got);
+        check("length2 in Q3.60", ok, buf);
+    }
+
+    // Case 7: the root does not fit, saturate
+    {
+        using fixed = fixed64<32>;
+        fixed big = fixed::from_raw(fixed::MAXIMUM);
+        bool ok = length2(big, big).raw_value() == fixed::MAXIMUM;
+        check("length2 saturates to MAXIMUM", ok);
+    }
+
+    printf("\n==== sqrt_test: %d passed, %d failed ====\n", pass_count, fail_count);
+    return fail_count;
+}
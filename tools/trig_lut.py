@@ -0,0 +1,211 @@
+#!/usr/bin/env python3
+# Writes include/trig_lut.hpp, the sin, tan and atan tables of fixed64.
+#
+#   python3 tools/trig_lut.py            # 2^10 segments, the shipped header
+#   python3 tools/trig_lut.py --bits 12  # finer tables, 4 times the data
+#
+# The tables are built on integers only, every Q1.62 entry is exact to the last
+# bit whatever machine runs the script.
+
+import argparse
+import math
+import os
+
+MASK = (1 << 64) - 1
+ONE = 1 << 62
+HALF_PI = 7244019458077122842  # Q2.62
+
+
+# (a * b) >> shift with rounding
+def mul_shift(a, b, shift):
+    return ((a * b + (1 << (shift - 1))) >> shift) & MASK
+
+
+# num / den in Q62 with rounding for num <= den <= 2^63, one quotient bit per step
+def div_q62(num, den):
+    rem = num
+    quot = 0
+    for _ in range(63):
+        quot <<= 1
+        if rem >= den:
+            rem -= den
+            quot |= 1
+        rem <<= 1
+    return quot + (1 if rem >= den else 0)
+
+
+# sin(pi/2 * k / 2^n_bits) in Q1.62 for k <= 2^n_bits, by Taylor series
+def sin_q62(k, n_bits):
+    x = mul_shift(HALF_PI, k << (63 - n_bits), 63)
+    xx = mul_shift(x, x, 62)
+
+    term = x
+    total = x
+    i = 1
+    while term != 0:
+        term = mul_shift(term, xx, 62) // ((2 * i) * (2 * i + 1))
+        total += -term if i & 1 else term
+        i += 1
+    return total
+
+
+# tan(pi/4 * k / 2^n_bits) in Q1.62 for k <= 2^n_bits, rounded sin / cos
+def tan_q62(k, n_bits):
+    num = sin_q62(k, n_bits + 1)
+    den = sin_q62((2 << n_bits) - k, n_bits + 1)
+    return div_q62(num, den)
+
+
+# atan(k / 2^n_bits) in Q1.62 for k <= 2^n_bits by Euler's series
+# atan(x) = sum (2n)!! / (2n + 1)!! * y^n * x / (1 + x^2), y = x^2 / (1 + x^2) <= 1/2
+def atan_q62(k, n_bits):
+    x = k << (62 - n_bits)
+    xx = mul_shift(x, x, 62)
+    d = ONE + xx
+    y = div_q62(xx, d)
+
+    term = div_q62(x, d)
+    total = term
+    i = 1
+    while term != 0:
+        term = mul_shift(term, y, 62)
+        term = term // (2 * i + 1) * (2 * i) + term % (2 * i + 1) * (2 * i) // (2 * i + 1)
+        total += term
+        i += 1
+    return total
+
+
+# one entry per segment: the parabola through both ends and the midpoint, or the chord
+def build(func, bits, order):
+    table = []
+    for i in range(1 << bits):
+        f0 = func(2 * i, bits + 1)
+        fh = func(2 * i + 1, bits + 1)
+        f1 = func(2 * i + 2, bits + 1)
+        if order >= 2:
+            table.append((f0, 4 * (fh - f0) - (f1 - f0), 2 * (f0 - fh) + 2 * (f1 - fh)))
+        else:
+            table.append((f0, f1 - f0))
+    return table
+
+
+# largest distance to ref(u), u in [0, 1] over the span, checked at 16 points per segment
+def max_error(table, ref):
+    count = len(table)
+    error = 0.0
+    for i, e in enumerate(table):
+        for j in range(16):
+            t = j / 16
+            value = e[0] + e[1] * t + (e[2] * t * t if len(e) > 2 else 0)
+            error = max(error, abs(value / ONE - ref((i + t) / count)))
+    return error
+
+
+TABLES = [
+    ("sin_lut", sin_q62, lambda u: math.sin(math.pi / 2 * u), "the quarter wave", [
+        "Quarter-wave sine table in Q1.62, shared by every fraction precision.",
+        "Each entry keeps the interpolation coefficients of one segment together.",
+    ]),
+    ("tan_lut", tan_q62, lambda u: math.tan(math.pi / 4 * u), "the octant", [
+        "Tangent table over the first octant [0, pi/4] in Q1.62, the other octant",
+        "is the reciprocal of its mirror.",
+    ]),
+    ("atan_lut", atan_q62, math.atan, "[0, 1]", [
+        "Arctangent table over [0, 1] in Q1.62, atan2 folds every octant onto it.",
+    ]),
+]
+
+
+def exponent(v):
+    return ("%.2g" % v).replace("e-0", "e-")
+
+
+def literal(v):
+    return "%dll" % v if v < 0 else "%d" % v
+
+
+def header(bits):
+    out = []
+    w = out.append
+    w("// Generated by tools/trig_lut.py --bits %d, do not edit." % bits)
+    w("")
+    w("#ifndef FIXED_64_TRIG_LUT_H")
+    w("#define FIXED_64_TRIG_LUT_H")
+    w("")
+    w("#include <stdint.h>")
+    w("#include <stddef.h>")
+    w("")
+    w("// log2 of the segment count over a quarter wave, fixed when the header is generated")
+    w("#ifndef FIXED_64_TRIG_LUT_BITS")
+    w("#define FIXED_64_TRIG_LUT_BITS %d" % bits)
+    w("#endif")
+    w("")
+    w("#if FIXED_64_TRIG_LUT_BITS != %d" % bits)
+    w("#error \"trig_lut.hpp holds 2^%d segments, regenerate it with tools/trig_lut.py --bits N\"" % bits)
+    w("#endif")
+    w("")
+    w("// 1: linear, 2: quadratic")
+    w("#ifndef FIXED_64_TRIG_LUT_INTERPOLATION")
+    w("#define FIXED_64_TRIG_LUT_INTERPOLATION 2")
+    w("#endif")
+    w("")
+    w("namespace f64")
+    w("{")
+    w("\tnamespace internal")
+    w("\t{")
+    w("\t\tstruct trig_lut_entry")
+    w("\t\t{")
+    w("\t\t\tint64_t value;")
+    w("\t\t\tint64_t slope;")
+    w("#if FIXED_64_TRIG_LUT_INTERPOLATION >= 2")
+    w("\t\t\tint64_t curve;")
+    w("#endif")
+    w("\t\t};")
+    w("\t}")
+    for name, func, ref, span, doc in TABLES:
+        quadratic = build(func, bits, 2)
+        linear = build(func, bits, 1)
+        kb = (8 << bits) // 1024
+        w("")
+        for line in doc:
+            w("\t// " + line)
+        w("\t//")
+        w("\t// max error over %s with FIXED_64_TRIG_LUT_BITS %d:" % (span, bits))
+        w("\t//   linear     %-7s %d KB" % (exponent(max_error(linear, ref)) + ",", 2 * kb))
+        w("\t//   quadratic  %-7s %d KB" % (exponent(max_error(quadratic, ref)) + ",", 3 * kb))
+        w("\tstruct %s" % name)
+        w("\t{")
+        w("\t\tstatic constexpr unsigned int BITS = %d;" % bits)
+        w("\t\tstatic constexpr size_t COUNT = size_t(1) << BITS;")
+        w("")
+        w("\t\tstatic constexpr internal::trig_lut_entry data[COUNT] =")
+        w("\t\t{")
+        w("#if FIXED_64_TRIG_LUT_INTERPOLATION >= 2")
+        for e in quadratic:
+            w("\t\t\t{ %s }," % ", ".join(literal(v) for v in e))
+        w("#else")
+        for e in linear:
+            w("\t\t\t{ %s }," % ", ".join(literal(v) for v in e))
+        w("#endif")
+        w("\t\t};")
+        w("\t};")
+    w("}")
+    w("")
+    w("#endif")
+    return "\r\n".join(out) + "\r\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description="generate include/trig_lut.hpp")
+    parser.add_argument("--bits", type=int, default=10, help="log2 of the segment count, 4 to 14")
+    parser.add_argument("--output", default=os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "include", "trig_lut.hpp"))
+    args = parser.parse_args()
+    if not 4 <= args.bits <= 14:
+        parser.error("--bits should be in [4, 14]")
+
+    with open(args.output, "w", newline="") as f:
+        f.write(header(args.bits))
+
+
+if __name__ == "__main__":
+    main()